@@ -199,7 +199,7 @@ std::shared_ptr<Analyzer::Expr> OffsetInFragment::deep_copy() const {
 
 std::shared_ptr<Analyzer::Expr> WindowFunction::deep_copy() const {
   return makeExpr<WindowFunction>(
-      type_info, kind_, args_, partition_keys_, order_keys_, collation_);
+      type_info, kind_, args_, partition_keys_, order_keys_, collation_, frame_);
 }
 
 ExpressionPtr ArrayExpr::deep_copy() const {
@@ -2399,7 +2399,8 @@ bool WindowFunction::operator==(const Expr& rhs) const {
   }
   return expr_list_match(args_, rhs_window->args_) &&
          expr_list_match(partition_keys_, rhs_window->partition_keys_) &&
-         expr_list_match(order_keys_, rhs_window->order_keys_);
+         expr_list_match(order_keys_, rhs_window->order_keys_) &&
+         frame_ == rhs_window->frame_;
 }
 
 bool ArrayExpr::operator==(Expr const& rhs) const {
@@ -2795,9 +2796,34 @@ std::string WindowFunction::toString() const {
   for (const auto& arg : args_) {
     result += " " + arg->toString();
   }
+  if (frame_) {
+    result += " " + frame_->toString();
+  }
   return result + ") ";
 }
 
+std::string WindowFrameBound::toString() const {
+  switch (type) {
+    case Type::UNBOUNDED_PRECEDING:
+      return "UNBOUNDED PRECEDING";
+    case Type::PRECEDING:
+      return std::to_string(offset) + " PRECEDING";
+    case Type::CURRENT_ROW:
+      return "CURRENT ROW";
+    case Type::FOLLOWING:
+      return std::to_string(offset) + " FOLLOWING";
+    case Type::UNBOUNDED_FOLLOWING:
+      return "UNBOUNDED FOLLOWING";
+  }
+  UNREACHABLE();
+  return "";
+}
+
+std::string WindowFrame::toString() const {
+  return std::string(is_rows ? "ROWS" : "RANGE") + " BETWEEN " + lower.toString() +
+         " AND " + upper.toString();
+}
+
 std::string ArrayExpr::toString() const {
   std::string str{"ARRAY["};
 
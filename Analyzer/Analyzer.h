@@ -27,6 +27,7 @@
 #include <cstdint>
 #include <iostream>
 #include <list>
+#include <optional>
 #include <set>
 #include <string>
 #include <type_traits>
@@ -1421,6 +1422,42 @@ struct OrderEntry {
   bool nulls_first; /* true if nulls are ordered first.  otherwise last. */
 };
 
+/*
+ * @type WindowFrameBound
+ * @brief one end of a window frame. The offset of PRECEDING and FOLLOWING bounds is a
+ * number of rows for ROWS frames and a distance between order key values for RANGE
+ * frames.
+ */
+struct WindowFrameBound {
+  enum class Type {
+    UNBOUNDED_PRECEDING,
+    PRECEDING,
+    CURRENT_ROW,
+    FOLLOWING,
+    UNBOUNDED_FOLLOWING
+  };
+  bool operator==(const WindowFrameBound& rhs) const {
+    return type == rhs.type && offset == rhs.offset;
+  }
+  std::string toString() const;
+  Type type;
+  int64_t offset; /* only set for PRECEDING and FOLLOWING */
+};
+
+/*
+ * @type WindowFrame
+ * @brief the ROWS or RANGE BETWEEN frame of an aggregate window function.
+ */
+struct WindowFrame {
+  bool operator==(const WindowFrame& rhs) const {
+    return is_rows == rhs.is_rows && lower == rhs.lower && upper == rhs.upper;
+  }
+  std::string toString() const;
+  bool is_rows;
+  WindowFrameBound lower;
+  WindowFrameBound upper;
+};
+
 /*
  * @type WindowFunction
  * @brief A window function.
@@ -1432,13 +1469,15 @@ class WindowFunction : public Expr {
                  const std::vector<std::shared_ptr<Analyzer::Expr>>& args,
                  const std::vector<std::shared_ptr<Analyzer::Expr>>& partition_keys,
                  const std::vector<std::shared_ptr<Analyzer::Expr>>& order_keys,
-                 const std::vector<OrderEntry>& collation)
+                 const std::vector<OrderEntry>& collation,
+                 const std::optional<WindowFrame>& frame = std::nullopt)
       : Expr(ti)
       , kind_(kind)
       , args_(args)
       , partition_keys_(partition_keys)
       , order_keys_(order_keys)
-      , collation_(collation){};
+      , collation_(collation)
+      , frame_(frame){};
 
   std::shared_ptr<Analyzer::Expr> deep_copy() const override;
 
@@ -1459,12 +1498,17 @@ class WindowFunction : public Expr {
 
   const std::vector<OrderEntry>& getCollation() const { return collation_; }
 
+  // The explicit frame of an aggregate, nullopt for the default frame (the whole
+  // partition without order keys, up to the last peer of the current row otherwise).
+  const std::optional<WindowFrame>& getFrame() const { return frame_; }
+
  private:
   const SqlWindowFunctionKind kind_;
   const std::vector<std::shared_ptr<Analyzer::Expr>> args_;
   const std::vector<std::shared_ptr<Analyzer::Expr>> partition_keys_;
   const std::vector<std::shared_ptr<Analyzer::Expr>> order_keys_;
   const std::vector<OrderEntry> collation_;
+  const std::optional<WindowFrame> frame_;
 };
 
 /*
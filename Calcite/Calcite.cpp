@@ -22,6 +22,7 @@
  */
 
 #include "Calcite.h"
+#include "Calcite/CalcitePlanCache.h"
 #include "Catalog/Catalog.h"
 #include "Logger/Logger.h"
 #include "OSDependent/omnisci_path.h"
@@ -34,6 +35,7 @@
 #include <thrift/protocol/TBinaryProtocol.h>
 #include <thrift/transport/TSocket.h>
 #include <thrift/transport/TTransportUtils.h>
+#include <sstream>
 #include <type_traits>
 
 #ifdef _MSC_VER
@@ -405,6 +407,7 @@ Calcite::Calcite(const SystemParameters& system_parameters,
 }
 
 void Calcite::updateMetadata(std::string catalog, std::string table) {
+  CalcitePlanCache::instance().clear();
   if (server_available_) {
     auto ms = measure<>::execution([&]() {
       auto clientP = getClient(remote_calcite_port_);
@@ -465,13 +468,44 @@ TPlanResult Calcite::process(
     const bool is_view_optimize,
     const bool check_privileges,
     const std::string& calcite_session_id) {
-  TPlanResult result = processImpl(query_state_proxy,
-                                   std::move(sql_string),
-                                   filter_push_down_info,
-                                   legacy_syntax,
-                                   is_explain,
-                                   is_view_optimize,
-                                   calcite_session_id);
+  // Plans with pushed down filters depend on the statistics of the inputs.
+  const bool use_plan_cache =
+      g_enable_calcite_plan_cache && filter_push_down_info.empty() && !is_explain;
+  std::string plan_cache_key_prefix;
+  ParameterizedSql parameterized_sql;
+  std::optional<TPlanResult> cached_result;
+  if (use_plan_cache) {
+    const auto& session_info = *query_state_proxy.getQueryState().getConstSessionInfo();
+    const auto& cat = session_info.getCatalog();
+    plan_cache_key_prefix = std::to_string(cat.getDatabaseId()) + " " +
+                            cat.getCurrentDB().dbName + " " +
+                            std::to_string(legacy_syntax) +
+                            std::to_string(is_view_optimize);
+    if (const auto restriction = session_info.get_restriction_ptr()) {
+      std::ostringstream restriction_str;
+      restriction_str << *restriction;
+      plan_cache_key_prefix += " " + restriction_str.str();
+    }
+    parameterized_sql = parameterize_sql(sql_string);
+    cached_result =
+        CalcitePlanCache::instance().get(plan_cache_key_prefix, parameterized_sql);
+  }
+  TPlanResult result;
+  if (cached_result) {
+    VLOG(1) << "Reusing cached Calcite plan";
+    result = std::move(*cached_result);
+  } else {
+    result = processImpl(query_state_proxy,
+                         std::move(sql_string),
+                         filter_push_down_info,
+                         legacy_syntax,
+                         is_explain,
+                         is_view_optimize,
+                         calcite_session_id);
+    if (use_plan_cache) {
+      CalcitePlanCache::instance().put(plan_cache_key_prefix, parameterized_sql, result);
+    }
+  }
   if (check_privileges && !is_explain) {
     checkAccessedObjectsPrivileges(query_state_proxy, result);
   }
@@ -688,6 +722,7 @@ void Calcite::setRuntimeExtensionFunctions(
     const std::vector<TUserDefinedFunction>& udfs,
     const std::vector<TUserDefinedTableFunction>& udtfs,
     bool isruntime) {
+  CalcitePlanCache::instance().clear();
   if (server_available_) {
     auto clientP = getClient(remote_calcite_port_);
     clientP.first->setRuntimeExtensionFunctions(udfs, udtfs, isruntime);
@@ -0,0 +1,503 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Calcite/CalcitePlanCache.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <limits>
+#include <unordered_set>
+
+#include <boost/algorithm/string.hpp>
+
+#include "Logger/Logger.h"
+
+#include "rapidjson/document.h"
+#include "rapidjson/stringbuffer.h"
+#include "rapidjson/writer.h"
+
+bool g_enable_calcite_plan_cache{false};
+size_t g_calcite_plan_cache_max_entries{1024};
+
+namespace {
+
+// Marks a parameterized literal in the text of a ParameterizedSql. Can't occur in SQL.
+constexpr char kLiteralMarker{'\x01'};
+
+bool is_identifier_char(const char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$' ||
+         static_cast<unsigned char>(c) >= 0x80;
+}
+
+// Functions whose value Calcite may fold into the plan.
+bool is_nondeterministic_function(const std::string& word) {
+  static const std::unordered_set<std::string> functions{"NOW",
+                                                         "CURRENT_DATE",
+                                                         "CURRENT_TIME",
+                                                         "CURRENT_TIMESTAMP",
+                                                         "LOCALTIME",
+                                                         "LOCALTIMESTAMP",
+                                                         "CURRENT_USER",
+                                                         "SESSION_USER",
+                                                         "USER",
+                                                         "DATETIME"};
+  return functions.count(word);
+}
+
+// Keywords whose string operand Calcite converts into a literal of another type.
+bool is_typed_literal_prefix(const std::string& word) {
+  return word == "DATE" || word == "TIME" || word == "TIMESTAMP" || word == "INTERVAL";
+}
+
+// Parses an exact numeric literal ([-]digits[.digits]) into the unscaled value and scale
+// of the BigDecimal Calcite represents it with. Returns the placeholder type, or an
+// empty string if the literal doesn't fit a BIGINT.
+std::string parse_exact_numeric(const std::string& text, SqlLiteral& literal) {
+  const bool negative = text[0] == '-';
+  std::string digits;
+  int32_t scale = 0;
+  bool after_point = false;
+  for (const auto c : text) {
+    if (c == '.') {
+      after_point = true;
+    } else if (std::isdigit(static_cast<unsigned char>(c))) {
+      digits += c;
+      scale += after_point;
+    }
+  }
+  digits.erase(0, std::min(digits.find_first_not_of('0'), digits.size()));
+  if (digits.size() > std::numeric_limits<int64_t>::digits10) {
+    return {};
+  }
+  const auto precision = std::max(digits.size(), size_t(1));
+  literal.value =
+      (negative && !digits.empty() ? "-" : "") + (digits.empty() ? "0" : digits);
+  literal.scale = scale;
+  const auto unscaled = std::stoll(literal.value);
+  const bool is_int = unscaled >= std::numeric_limits<int32_t>::min() &&
+                      unscaled <= std::numeric_limits<int32_t>::max();
+  return "n" + std::to_string(precision) + "," + std::to_string(scale) +
+         (negative ? "-" : "") + (is_int ? "" : "l");
+}
+
+std::vector<rapidjson::Value*> get_plan_literals(rapidjson::Value& value) {
+  std::vector<rapidjson::Value*> literals;
+  std::vector<rapidjson::Value*> stack{&value};
+  while (!stack.empty()) {
+    auto current = stack.back();
+    stack.pop_back();
+    if (current->IsObject()) {
+      if (current->HasMember("literal") && current->HasMember("type") &&
+          current->HasMember("target_type")) {
+        literals.push_back(current);
+        continue;
+      }
+      // push in reverse so the literals come out in document order
+      for (auto it = current->MemberEnd(); it != current->MemberBegin();) {
+        --it;
+        stack.push_back(&it->value);
+      }
+    } else if (current->IsArray()) {
+      for (auto it = current->End(); it != current->Begin();) {
+        --it;
+        stack.push_back(it);
+      }
+    }
+  }
+  return literals;
+}
+
+bool plan_literal_matches(const rapidjson::Value& plan_literal,
+                          const SqlLiteral& literal) {
+  const auto& value = plan_literal["literal"];
+  const auto& type = plan_literal["type"];
+  if (!type.IsString()) {
+    return false;
+  }
+  const std::string type_name = type.GetString();
+  switch (literal.kind) {
+    case SqlLiteral::Kind::kExactNumeric:
+      return type_name == "DECIMAL" && value.IsInt64() &&
+             value.GetInt64() == std::stoll(literal.value) &&
+             plan_literal.HasMember("scale") && plan_literal["scale"].IsInt() &&
+             plan_literal["scale"].GetInt() == literal.scale;
+    case SqlLiteral::Kind::kApproxNumeric:
+      return type_name == "DOUBLE" && value.IsNumber() &&
+             value.GetDouble() == std::strtod(literal.value.c_str(), nullptr);
+    case SqlLiteral::Kind::kString:
+      return type_name == "CHAR" && value.IsString() &&
+             value.GetString() == literal.value;
+  }
+  return false;
+}
+
+void set_plan_literal(rapidjson::Value& plan_literal,
+                      const SqlLiteral& literal,
+                      rapidjson::Document::AllocatorType& allocator) {
+  auto& value = plan_literal["literal"];
+  switch (literal.kind) {
+    case SqlLiteral::Kind::kExactNumeric:
+      value.SetInt64(std::stoll(literal.value));
+      break;
+    case SqlLiteral::Kind::kApproxNumeric:
+      value.SetDouble(std::strtod(literal.value.c_str(), nullptr));
+      break;
+    case SqlLiteral::Kind::kString:
+      value.SetString(literal.value.c_str(), literal.value.size(), allocator);
+      break;
+  }
+}
+
+std::string serialize(const rapidjson::Document& document) {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  document.Accept(writer);
+  return std::string(buffer.GetString(), buffer.GetSize());
+}
+
+// Substitutes the literals at the given positions of the statement in a plan.
+std::string substitute_literals(const std::string& plan_json,
+                                const std::vector<int>& plan_literal_indexes,
+                                const ParameterizedSql& sql,
+                                const std::vector<size_t>& positions) {
+  rapidjson::Document document;
+  document.Parse(plan_json.c_str());
+  CHECK(!document.HasParseError());
+  const auto plan_literals = get_plan_literals(document);
+  for (const auto i : positions) {
+    const auto plan_literal_index = plan_literal_indexes[i];
+    CHECK_GE(plan_literal_index, 0);
+    CHECK_LT(static_cast<size_t>(plan_literal_index), plan_literals.size());
+    set_plan_literal(
+        *plan_literals[plan_literal_index], sql.literals[i], document.GetAllocator());
+  }
+  return serialize(document);
+}
+
+}  // namespace
+
+ParameterizedSql parameterize_sql(const std::string& sql) {
+  ParameterizedSql result;
+  auto& text = result.text;
+  std::string prev_word;       // last keyword or identifier, upper case
+  bool prev_is_value = false;  // last token ends an operand, so '-' is binary
+  bool pending_space = false;
+  const size_t n = sql.size();
+  size_t i = 0;
+  if (sql.find(kLiteralMarker) != std::string::npos) {
+    result.cacheable = false;
+  }
+  auto append = [&text, &pending_space](const std::string& token) {
+    if (pending_space && !text.empty()) {
+      text += ' ';
+    }
+    pending_space = false;
+    text += token;
+  };
+  auto add_literal = [&](SqlLiteral literal, const std::string& type) {
+    append(std::string(1, kLiteralMarker) + type + kLiteralMarker);
+    result.literals.push_back(std::move(literal));
+  };
+  while (i < n) {
+    const char c = sql[i];
+    const char next = i + 1 < n ? sql[i + 1] : '\0';
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      pending_space = true;
+      ++i;
+    } else if (c == '-' && next == '-') {
+      // line comments are kept, they carry query hints
+      const auto end = std::min(sql.find('\n', i), n);
+      append(sql.substr(i, end - i) + "\n");
+      i = end;
+    } else if (c == '/' && next == '*') {
+      const auto end = std::min(sql.find("*/", i + 2), n - 2) + 2;
+      append(sql.substr(i, end - i));
+      i = end;
+    } else if (c == '"') {
+      // quoted identifier
+      size_t end = i + 1;
+      while (end < n && !(sql[end] == '"' && (end + 1 == n || sql[end + 1] != '"'))) {
+        end += sql[end] == '"' ? 2 : 1;
+      }
+      end = std::min(end + 1, n);
+      append(sql.substr(i, end - i));
+      prev_word.clear();
+      prev_is_value = true;
+      i = end;
+    } else if (c == '\'') {
+      SqlLiteral literal{SqlLiteral::Kind::kString, "", i, n};
+      size_t end = i + 1;
+      bool terminated = false;
+      bool is_ascii = true;
+      while (end < n) {
+        if (sql[end] == '\'') {
+          if (end + 1 < n && sql[end + 1] == '\'') {
+            literal.value += '\'';
+            end += 2;
+            continue;
+          }
+          terminated = true;
+          ++end;
+          break;
+        }
+        is_ascii = is_ascii && static_cast<unsigned char>(sql[end]) < 0x80;
+        literal.value += sql[end++];
+      }
+      literal.end = end;
+      // Strings with a charset or type prefix are converted by Calcite. Calcite types
+      // string literals by their length in characters, only parameterize ASCII strings
+      // so that the byte length is the character length.
+      const bool has_prefix = i > 0 && is_identifier_char(sql[i - 1]);
+      if (!terminated || has_prefix || !is_ascii || is_typed_literal_prefix(prev_word)) {
+        append(sql.substr(i, end - i));
+        result.cacheable = result.cacheable && terminated;
+      } else {
+        const auto length = literal.value.size();
+        add_literal(std::move(literal), "s" + std::to_string(length));
+      }
+      prev_word.clear();
+      prev_is_value = true;
+      i = end;
+    } else if (c == '?') {
+      result.bind_markers.push_back(i);
+      append("?");
+      prev_word.clear();
+      prev_is_value = true;
+      ++i;
+    } else if ((std::isdigit(static_cast<unsigned char>(c)) ||
+                (c == '.' && std::isdigit(static_cast<unsigned char>(next))) ||
+                (c == '-' && !prev_is_value &&
+                 (std::isdigit(static_cast<unsigned char>(next)) || next == '.'))) &&
+               (i == 0 || !is_identifier_char(sql[i - 1]))) {
+      size_t end = i + (c == '-');
+      while (end < n && std::isdigit(static_cast<unsigned char>(sql[end]))) {
+        ++end;
+      }
+      if (end < n && sql[end] == '.') {
+        ++end;
+        while (end < n && std::isdigit(static_cast<unsigned char>(sql[end]))) {
+          ++end;
+        }
+      }
+      bool is_approx = false;
+      if (end < n && (sql[end] == 'e' || sql[end] == 'E')) {
+        auto exponent_end = end + 1;
+        if (exponent_end < n && (sql[exponent_end] == '+' || sql[exponent_end] == '-')) {
+          ++exponent_end;
+        }
+        if (exponent_end < n &&
+            std::isdigit(static_cast<unsigned char>(sql[exponent_end]))) {
+          is_approx = true;
+          end = exponent_end;
+          while (end < n && std::isdigit(static_cast<unsigned char>(sql[end]))) {
+            ++end;
+          }
+        }
+      }
+      const auto token = sql.substr(i, end - i);
+      SqlLiteral literal{is_approx ? SqlLiteral::Kind::kApproxNumeric
+                                   : SqlLiteral::Kind::kExactNumeric,
+                         token,
+                         i,
+                         end};
+      const auto type =
+          is_approx ? std::string("e") : parse_exact_numeric(token, literal);
+      if (type.empty() || (end < n && is_identifier_char(sql[end])) ||
+          is_typed_literal_prefix(prev_word) || token == "-" || token == "-.") {
+        append(token);
+      } else {
+        add_literal(std::move(literal), type);
+      }
+      prev_word.clear();
+      prev_is_value = true;
+      i = end;
+    } else if (is_identifier_char(c)) {
+      size_t end = i;
+      while (end < n && is_identifier_char(sql[end])) {
+        ++end;
+      }
+      const auto word = sql.substr(i, end - i);
+      append(word);
+      prev_word = boost::algorithm::to_upper_copy(word);
+      if (is_nondeterministic_function(prev_word)) {
+        result.cacheable = false;
+      }
+      prev_is_value = true;
+      i = end;
+    } else {
+      append(std::string(1, c));
+      prev_word.clear();
+      prev_is_value = c == ')';
+      ++i;
+    }
+  }
+  return result;
+}
+
+CalcitePlanCache& CalcitePlanCache::instance() {
+  static CalcitePlanCache cache;
+  return cache;
+}
+
+std::optional<TPlanResult> CalcitePlanCache::get(const std::string& key_prefix,
+                                                 const ParameterizedSql& sql) {
+  if (!sql.cacheable) {
+    return std::nullopt;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  const auto it = index_.find(key_prefix + '\n' + sql.text);
+  if (it == index_.end()) {
+    ++misses_;
+    return std::nullopt;
+  }
+  lru_.splice(lru_.begin(), lru_, it->second);
+  auto& plans = it->second->plans;
+  for (auto plan_it = plans.begin(); plan_it != plans.end(); ++plan_it) {
+    CHECK_EQ(plan_it->literal_values.size(), sql.literals.size());
+    std::vector<size_t> substituted_literals;
+    bool matches = true;
+    for (size_t i = 0; i < sql.literals.size() && matches; ++i) {
+      if (plan_it->literal_values[i] != sql.literals[i].value) {
+        matches = plan_it->verified[i];
+        substituted_literals.push_back(i);
+      }
+    }
+    if (!matches) {
+      continue;
+    }
+    plans.splice(plans.begin(), plans, plan_it);
+    ++hits_;
+    auto result = plans.front().plan;
+    if (substituted_literals.empty()) {
+      return result;
+    }
+    const auto plan_literal_indexes = plans.front().plan_literal_indexes;
+    lock.unlock();
+    result.plan_result = substitute_literals(
+        result.plan_result, plan_literal_indexes, sql, substituted_literals);
+    return result;
+  }
+  ++misses_;
+  return std::nullopt;
+}
+
+void CalcitePlanCache::put(const std::string& key_prefix,
+                           const ParameterizedSql& sql,
+                           const TPlanResult& plan) {
+  if (!sql.cacheable || g_calcite_plan_cache_max_entries == 0) {
+    return;
+  }
+  rapidjson::Document document;
+  document.Parse(plan.plan_result.c_str());
+  // only cache relational algebra, not DDL commands
+  if (document.HasParseError() || !document.IsObject() || !document.HasMember("rels")) {
+    return;
+  }
+  Plan new_plan;
+  new_plan.plan = plan;
+  new_plan.plan.plan_result = serialize(document);
+  new_plan.plan.execution_time_ms = 0;
+  const auto plan_literals = get_plan_literals(document);
+  for (size_t i = 0; i < sql.literals.size(); ++i) {
+    const auto& literal = sql.literals[i];
+    new_plan.literal_values.push_back(literal.value);
+    new_plan.verified.push_back(false);
+    int plan_literal_index = -1;
+    // A literal which occurs more than once can't be told apart from its copies.
+    if (std::count(sql.literals.begin(), sql.literals.end(), literal) == 1) {
+      for (size_t j = 0; j < plan_literals.size(); ++j) {
+        if (plan_literal_matches(*plan_literals[j], literal)) {
+          plan_literal_index = plan_literal_index == -1 ? static_cast<int>(j) : -2;
+        }
+      }
+    }
+    new_plan.plan_literal_indexes.push_back(std::max(plan_literal_index, -1));
+  }
+
+  const auto key = key_prefix + '\n' + sql.text;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    lru_.push_front(Entry{key, {}});
+    it = index_.emplace(key, lru_.begin()).first;
+    while (lru_.size() > g_calcite_plan_cache_max_entries) {
+      index_.erase(lru_.back().key);
+      lru_.pop_back();
+      ++evictions_;
+    }
+  } else {
+    lru_.splice(lru_.begin(), lru_, it->second);
+  }
+  auto& plans = it->second->plans;
+  for (auto plan_it = plans.begin(); plan_it != plans.end(); ++plan_it) {
+    auto& cached_plan = *plan_it;
+    CHECK_EQ(cached_plan.literal_values.size(), sql.literals.size());
+    std::vector<size_t> differing_literals;
+    for (size_t i = 0; i < sql.literals.size(); ++i) {
+      if (cached_plan.literal_values[i] != sql.literals[i].value) {
+        differing_literals.push_back(i);
+      }
+    }
+    if (differing_literals.empty()) {
+      // planned concurrently
+      return;
+    }
+    if (std::any_of(differing_literals.begin(),
+                    differing_literals.end(),
+                    [&cached_plan](const size_t i) {
+                      return cached_plan.plan_literal_indexes[i] < 0;
+                    })) {
+      continue;
+    }
+    // Verify that Calcite planned the statement with the new values like the cached
+    // statement, but for the substituted literals.
+    if (substitute_literals(cached_plan.plan.plan_result,
+                            cached_plan.plan_literal_indexes,
+                            sql,
+                            differing_literals) == new_plan.plan.plan_result) {
+      for (const auto i : differing_literals) {
+        cached_plan.verified[i] = true;
+      }
+      plans.splice(plans.begin(), plans, plan_it);
+      return;
+    }
+    for (const auto i : differing_literals) {
+      cached_plan.plan_literal_indexes[i] = -1;
+      cached_plan.verified[i] = false;
+    }
+  }
+  plans.push_front(std::move(new_plan));
+  if (plans.size() > kMaxPlansPerKey) {
+    plans.pop_back();
+  }
+}
+
+void CalcitePlanCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  lru_.clear();
+  index_.clear();
+}
+
+CalcitePlanCacheStats CalcitePlanCache::getStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  CalcitePlanCacheStats stats;
+  stats.num_entries = lru_.size();
+  stats.hits = hits_;
+  stats.misses = misses_;
+  stats.evictions = evictions_;
+  return stats;
+}
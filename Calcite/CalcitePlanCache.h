@@ -0,0 +1,126 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    CalcitePlanCache.h
+ * @brief   Cache of the relational algebra Calcite returns for a query, reused for
+ *          queries which only differ in the values of their literals.
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "gen-cpp/calciteserver_types.h"
+
+extern bool g_enable_calcite_plan_cache;
+extern size_t g_calcite_plan_cache_max_entries;
+
+// A numeric or string literal of a SQL statement which a cached plan may take as a
+// parameter.
+struct SqlLiteral {
+  enum class Kind { kExactNumeric, kApproxNumeric, kString };
+
+  Kind kind;
+  std::string value;  // unquoted, unescaped value of strings; digits of numbers
+  size_t begin;       // byte range of the literal in the SQL text
+  size_t end;
+  int32_t scale{0};  // digits after the decimal point of exact numerics
+
+  bool operator==(const SqlLiteral& that) const {
+    return kind == that.kind && value == that.value;
+  }
+};
+
+// A SQL statement with its parameterizable literals replaced by placeholders, which
+// record the type Calcite infers for the literal.
+struct ParameterizedSql {
+  std::string text;
+  std::vector<SqlLiteral> literals;
+  std::vector<size_t> bind_markers;  // offsets of '?' markers in the SQL text
+  bool cacheable{true};  // false for statements calling NOW(), CURRENT_USER etc.
+};
+
+ParameterizedSql parameterize_sql(const std::string& sql);
+
+struct CalcitePlanCacheStats {
+  size_t num_entries{0};
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
+};
+
+/**
+ * LRU cache of Calcite plans, keyed on the database, the Calcite options of the query
+ * and the text of the statement with its literals replaced by placeholders.
+ *
+ * A plan computed for one set of literal values is only reused for other values once a
+ * second Calcite plan confirmed that substituting the literal in the plan gives the plan
+ * Calcite returns: a literal is a parameter of a cached plan if its value occurs exactly
+ * once among the literals of the plan, and it is verified when the plan of a query
+ * with a different value for it equals the cached plan with the value substituted.
+ * Literals which Calcite folds or rewrites (LIMIT, INTERVAL, typed date literals, ...)
+ * never become parameters, so queries are only served from the cache when these match.
+ *
+ * Catalog changes clear the cache (see Calcite::updateMetadata). Privileges are checked
+ * on every query, cached or not.
+ */
+class CalcitePlanCache {
+ public:
+  static constexpr size_t kMaxPlansPerKey{4};
+
+  static CalcitePlanCache& instance();
+
+  std::optional<TPlanResult> get(const std::string& key_prefix,
+                                 const ParameterizedSql& sql);
+
+  void put(const std::string& key_prefix,
+           const ParameterizedSql& sql,
+           const TPlanResult& plan);
+
+  void clear();
+
+  CalcitePlanCacheStats getStats();
+
+ private:
+  struct Plan {
+    TPlanResult plan;  // plan_result serialized by rapidjson
+    std::vector<std::string> literal_values;
+    // index of the literal in the plan for every literal of the statement, -1 if the
+    // literal doesn't map to a unique literal of the plan
+    std::vector<int> plan_literal_indexes;
+    std::vector<bool> verified;
+  };
+
+  struct Entry {
+    std::string key;
+    std::list<Plan> plans;  // most recently used first
+  };
+
+  using EntryList = std::list<Entry>;
+
+  std::mutex mutex_;
+  EntryList lru_;  // most recently used first
+  std::unordered_map<std::string, EntryList::iterator> index_;
+  size_t hits_{0};
+  size_t misses_{0};
+  size_t evictions_{0};
+};
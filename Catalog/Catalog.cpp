@@ -66,6 +66,7 @@
 #include "MigrationMgr/MigrationMgr.h"
 #include "Parser/ParserNode.h"
 #include "QueryEngine/Execute.h"
+#include "QueryEngine/ExternalCacheInvalidators.h"
 #include "QueryEngine/TableOptimizer.h"
 #include "RefreshTimeCalculator.h"
 #include "Shared/DateTimeParser.h"
@@ -281,6 +282,11 @@ void Catalog::updateTableDescriptorSchema() {
                          std::to_string(-1));
       sqliteConnector_.query(queryString);
     }
+    if (std::find(cols.begin(), cols.end(), std::string("page_compression")) ==
+        cols.end()) {
+      sqliteConnector_.query(
+          "ALTER TABLE mapd_tables ADD page_compression BOOLEAN DEFAULT 0");
+    }
   } catch (std::exception& e) {
     sqliteConnector_.query("ROLLBACK TRANSACTION");
     throw;
@@ -966,7 +972,7 @@ void Catalog::buildMaps() {
       "SELECT tableid, name, ncolumns, isview, fragments, frag_type, max_frag_rows, "
       "max_chunk_size, frag_page_size, "
       "max_rows, partitions, shard_column_id, shard, num_shards, key_metainfo, userid, "
-      "sort_column_id, storage_type, max_rollback_epochs "
+      "sort_column_id, storage_type, max_rollback_epochs, page_compression "
       "from mapd_tables");
   sqliteConnector_.query(tableQuery);
   numRows = sqliteConnector_.getNumRows();
@@ -1012,6 +1018,7 @@ void Catalog::buildMaps() {
       td->fragmenter = nullptr;
     }
     td->maxRollbackEpochs = sqliteConnector_.getData<int>(r, 18);
+    td->pageCompression = sqliteConnector_.getData<bool>(r, 19);
     td->hasDeletedCol = false;
 
     tableDescriptorMap_[to_upper(td->tableName)] = td;
@@ -2293,7 +2300,7 @@ void Catalog::createTable(
   if (td.persistenceLevel == Data_Namespace::MemoryLevel::DISK_LEVEL) {
     try {
       sqliteConnector_.query_with_text_params(
-          R"(INSERT INTO mapd_tables (name, userid, ncolumns, isview, fragments, frag_type, max_frag_rows, max_chunk_size, frag_page_size, max_rows, partitions, shard_column_id, shard, num_shards, sort_column_id, storage_type, max_rollback_epochs, key_metainfo) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?))",
+          R"(INSERT INTO mapd_tables (name, userid, ncolumns, isview, fragments, frag_type, max_frag_rows, max_chunk_size, frag_page_size, max_rows, partitions, shard_column_id, shard, num_shards, sort_column_id, storage_type, max_rollback_epochs, page_compression, key_metainfo) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?))",
           std::vector<std::string>{td.tableName,
                                    std::to_string(td.userId),
                                    std::to_string(td.nColumns),
@@ -2311,6 +2318,7 @@ void Catalog::createTable(
                                    std::to_string(td.sortedColumnId),
                                    td.storageType,
                                    std::to_string(td.maxRollbackEpochs),
+                                   std::to_string(td.pageCompression),
                                    td.keyMetainfo});
 
       // now get the auto generated tableid
@@ -2913,6 +2921,7 @@ void Catalog::setTableEpoch(const int db_id, const int table_id, int new_epoch)
   File_Namespace::FileMgrParams file_mgr_params;
   file_mgr_params.epoch = new_epoch;
   file_mgr_params.max_rollback_epochs = td->maxRollbackEpochs;
+  file_mgr_params.page_compression = td->pageCompression;
 
   const auto physicalTableIt = logicalToPhysicalTableMapById_.find(table_id);
   if (physicalTableIt != logicalToPhysicalTableMapById_.end()) {
@@ -3013,6 +3022,7 @@ void Catalog::setMaxRollbackEpochs(const int32_t table_id,
   File_Namespace::FileMgrParams file_mgr_params;
   file_mgr_params.epoch = -1;  // Use existing epoch
   file_mgr_params.max_rollback_epochs = max_rollback_epochs;
+  file_mgr_params.page_compression = td->pageCompression;
   setTableFileMgrParams(table_id, file_mgr_params);
   // Unlock as alterTableCatalogMetadata will take write lock, and Catalog locks are not
   // upgradeable Should be safe as we have schema lock on this table
@@ -3050,6 +3060,7 @@ void Catalog::setUncappedTableEpoch(const std::string& table_name) {
 
   File_Namespace::FileMgrParams file_mgr_params;
   file_mgr_params.max_rollback_epochs = -1;
+  file_mgr_params.page_compression = td->pageCompression;
   setTableFileMgrParams(td->tableId, file_mgr_params);
 }
 
@@ -3122,6 +3133,7 @@ void Catalog::setTableEpochs(const int32_t db_id,
   CHECK(td);
   File_Namespace::FileMgrParams file_mgr_params;
   file_mgr_params.max_rollback_epochs = td->maxRollbackEpochs;
+  file_mgr_params.page_compression = td->pageCompression;
 
   cat_read_lock read_lock(this);
   for (const auto& table_epoch_info : table_epochs) {
@@ -3133,6 +3145,8 @@ void Catalog::setTableEpochs(const int32_t db_id,
               << ", table id: " << table_epoch_info.table_id
               << ", back to epoch: " << table_epoch_info.table_epoch;
   }
+  // the rows written since the epochs are gone, caches computed from them are stale
+  UpdateTriggeredCacheInvalidator::invalidateCaches();
 }
 
 namespace {
@@ -4554,6 +4568,9 @@ std::string Catalog::dumpSchema(const TableDescriptor* td) const {
     with_options.push_back("MAX_ROLLBACK_EPOCHS=" +
                            std::to_string(td->maxRollbackEpochs));
   }
+  if (td->pageCompression) {
+    with_options.emplace_back("COMPRESSION='BLOSC'");
+  }
   os << ") WITH (" + boost::algorithm::join(with_options, ", ") + ");";
   return os.str();
 }
@@ -4726,6 +4743,9 @@ std::string Catalog::dumpCreateTable(const TableDescriptor* td,
     CHECK(sort_cd);
     with_options.push_back("SORT_COLUMN='" + sort_cd->columnName + "'");
   }
+  if (!foreign_table && td->pageCompression) {
+    with_options.emplace_back("COMPRESSION='BLOSC'");
+  }
 
   if (!with_options.empty()) {
     if (!multiline_formatting) {
@@ -75,6 +75,7 @@ struct TableDescriptor {
   std::string storageType;          // foreign/local storage
 
   int32_t maxRollbackEpochs;
+  bool pageCompression;  // data pages stored Blosc compressed (COMPRESSION = 'BLOSC')
 
   // write mutex, only to be used inside catalog package
   std::shared_ptr<std::mutex> mutex_;
@@ -88,6 +89,7 @@ struct TableDescriptor {
       , persistenceLevel(Data_Namespace::MemoryLevel::DISK_LEVEL)
       , hasDeletedCol(true)
       , maxRollbackEpochs(DEFAULT_MAX_ROLLBACK_EPOCHS)
+      , pageCompression(false)
       , mutex_(std::make_shared<std::mutex>()) {}
 
   virtual ~TableDescriptor() = default;
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DataMgr/Allocators/NumaSlabAllocator.h"
+
+#include <new>
+#include <stdexcept>
+
+#include "Logger/Logger.h"
+#include "OSDependent/omnisci_numa.h"
+
+NumaPolicy parse_numa_policy(const std::string& policy) {
+  if (policy == "none") {
+    return NumaPolicy::kNone;
+  }
+  if (policy == "interleave") {
+    return NumaPolicy::kInterleave;
+  }
+  if (policy == "bind") {
+    return NumaPolicy::kBind;
+  }
+  throw std::runtime_error("Invalid NUMA policy " + policy +
+                           ", must be one of none, interleave or bind.");
+}
+
+NumaSlabAllocator::NumaSlabAllocator(const bool use_huge_pages,
+                                     const NumaPolicy numa_policy)
+    : use_huge_pages_(use_huge_pages)
+    , numa_policy_(numa_policy)
+    , numa_nodes_(omnisci::get_numa_nodes())
+    , next_numa_node_idx_(0) {
+  CHECK(!numa_nodes_.empty());
+  LOG(INFO) << "Allocating CPU buffer pool slabs with mmap"
+            << (use_huge_pages_ ? " on huge pages" : "") << ", " << numa_nodes_.size()
+            << " NUMA node(s)";
+}
+
+NumaSlabAllocator::~NumaSlabAllocator() {
+  freeAll();
+}
+
+std::pair<int8_t*, int> NumaSlabAllocator::allocate(const size_t num_bytes) {
+  const size_t mapping_size =
+      use_huge_pages_ ? (num_bytes + kHugePageSize - 1) / kHugePageSize * kHugePageSize
+                      : num_bytes;
+  auto ptr = omnisci::map_anonymous_memory(mapping_size, use_huge_pages_);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  mappings_.push_back({ptr, mapping_size});
+
+  int numa_node{-1};
+  if (numa_policy_ != NumaPolicy::kNone && numa_nodes_.size() > 1) {
+    if (numa_policy_ == NumaPolicy::kBind) {
+      numa_node = numa_nodes_[next_numa_node_idx_++ % numa_nodes_.size()];
+    }
+    if (!omnisci::set_numa_memory_policy(ptr, mapping_size, numa_node)) {
+      LOG(WARNING) << "Could not set the NUMA policy of a " << mapping_size
+                   << " bytes CPU buffer pool slab";
+      numa_node = -1;
+    }
+  }
+  return {reinterpret_cast<int8_t*>(ptr), numa_node};
+}
+
+void NumaSlabAllocator::freeAll() {
+  for (const auto& mapping : mappings_) {
+    omnisci::unmap_anonymous_memory(mapping.ptr, mapping.size);
+  }
+  mappings_.clear();
+}
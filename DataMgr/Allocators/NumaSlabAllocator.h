@@ -0,0 +1,68 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    NumaSlabAllocator.h
+ * @brief   Allocate CPU buffer pool slabs with mmap, on huge pages and NUMA nodes
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+enum class NumaPolicy {
+  kNone,        // pages are placed by the kernel, usually on the node first touching them
+  kInterleave,  // the pages of every slab are interleaved over all nodes
+  kBind         // every slab is bound to one node, taking the nodes round robin
+};
+
+// Parses the values of the cpu-buffer-numa-policy option: none, interleave or bind.
+NumaPolicy parse_numa_policy(const std::string& policy);
+
+/**
+ * Maps buffer pool slabs as anonymous memory, optionally backed by huge pages, and
+ * places them on NUMA nodes following the policy. Like the Arena allocator it replaces,
+ * memory is only returned by freeAll() and on destruction.
+ */
+class NumaSlabAllocator {
+ public:
+  static constexpr size_t kHugePageSize{size_t(2) << 20};
+
+  NumaSlabAllocator(const bool use_huge_pages, const NumaPolicy numa_policy);
+
+  ~NumaSlabAllocator();
+
+  // Returns the slab and the NUMA node it is bound to, -1 if it isn't bound to one node.
+  // Throws std::bad_alloc if the memory can't be mapped.
+  std::pair<int8_t*, int> allocate(const size_t num_bytes);
+
+  void freeAll();
+
+ private:
+  struct Mapping {
+    void* ptr;
+    size_t size;
+  };
+
+  const bool use_huge_pages_;
+  const NumaPolicy numa_policy_;
+  const std::vector<int> numa_nodes_;
+  size_t next_numa_node_idx_;
+  std::vector<Mapping> mappings_;
+};
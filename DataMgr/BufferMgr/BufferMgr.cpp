@@ -56,6 +56,7 @@ BufferMgr::BufferMgr(const int device_id,
     , min_slab_size_(min_slab_size)
     , max_slab_size_(max_slab_size)
     , page_size_(page_size)
+    , clock_slab_(0)
     , num_pages_allocated_(0)
     , allocations_capped_(false)
     , parent_mgr_(parent_mgr)
@@ -93,23 +94,144 @@ void BufferMgr::reinit() {
 
 void BufferMgr::clear() {
   std::lock_guard<std::mutex> sized_segs_lock(sized_segs_mutex_);
-  std::lock_guard<std::mutex> chunk_index_lock(chunk_index_mutex_);
-  std::lock_guard<std::mutex> unsized_segs_lock(unsized_segs_mutex_);
-  for (auto& buf : chunk_index_) {
-    delete buf.second->buffer;
+  for (auto& shard : chunk_index_) {
+    auto shard_lock = lockChunkIndexShard(shard);
+    for (auto& buf : shard.index) {
+      delete buf.second->buffer;
+    }
+    shard.index.clear();
   }
 
-  chunk_index_.clear();
+  std::lock_guard<std::mutex> unsized_segs_lock(unsized_segs_mutex_);
   slabs_.clear();
   slab_segments_.clear();
+  free_segments_.clear();
+  clock_hands_.clear();
+  clock_slab_ = 0;
   unsized_segs_.clear();
   buffer_epoch_ = 0;
 }
 
+BufferMgr::ChunkIndexShard& BufferMgr::getChunkIndexShard(const ChunkKey& key) {
+  return chunk_index_[boost::hash<ChunkKey>()(key) % kNumChunkIndexShards];
+}
+
+std::unique_lock<std::mutex> BufferMgr::lockChunkIndexShard(ChunkIndexShard& shard) {
+  ++num_chunk_index_lock_acquisitions_;
+  std::unique_lock<std::mutex> shard_lock(shard.mutex, std::try_to_lock);
+  if (!shard_lock.owns_lock()) {
+    ++num_chunk_index_lock_waits_;
+    shard_lock.lock();
+  }
+  return shard_lock;
+}
+
+std::vector<std::unique_lock<std::mutex>> BufferMgr::lockAllChunkIndexShards() {
+  // always in the same order
+  std::vector<std::unique_lock<std::mutex>> shard_locks;
+  shard_locks.reserve(kNumChunkIndexShards);
+  for (auto& shard : chunk_index_) {
+    shard_locks.emplace_back(lockChunkIndexShard(shard));
+  }
+  return shard_locks;
+}
+
+AbstractBuffer* BufferMgr::pinChunk(const ChunkKey& key) {
+  auto& shard = getChunkIndexShard(key);
+  auto shard_lock = lockChunkIndexShard(shard);
+  auto buffer_it = shard.index.find(key);
+  // skip the chunks still being created or fetched
+  if (buffer_it == shard.index.end() || !buffer_it->second->buffer ||
+      buffer_it->second->fetching) {
+    return nullptr;
+  }
+  auto seg_it = buffer_it->second;
+  seg_it->buffer->pin();
+  seg_it->referenced = true;
+  seg_it->last_touched = buffer_epoch_++;
+  return seg_it->buffer;
+}
+
+void BufferMgr::setChunkFetched(const ChunkKey& key) {
+  auto& shard = getChunkIndexShard(key);
+  auto shard_lock = lockChunkIndexShard(shard);
+  auto buffer_it = shard.index.find(key);
+  CHECK(buffer_it != shard.index.end());
+  buffer_it->second->fetching = false;
+}
+
+std::optional<BufferList::iterator> BufferMgr::findChunk(const ChunkKey& key) {
+  auto& shard = getChunkIndexShard(key);
+  auto shard_lock = lockChunkIndexShard(shard);
+  auto buffer_it = shard.index.find(key);
+  if (buffer_it == shard.index.end()) {
+    return std::nullopt;
+  }
+  return buffer_it->second;
+}
+
+void BufferMgr::eraseChunk(const ChunkKey& key) {
+  auto& shard = getChunkIndexShard(key);
+  auto shard_lock = lockChunkIndexShard(shard);
+  shard.index.erase(key);
+}
+
+std::vector<std::pair<ChunkKey, BufferList::iterator>> BufferMgr::findChunksWithPrefix(
+    const ChunkKey& key_prefix) {
+  std::vector<std::pair<ChunkKey, BufferList::iterator>> chunks;
+  for (auto& shard : chunk_index_) {
+    auto shard_lock = lockChunkIndexShard(shard);
+    for (const auto& [chunk_key, seg_it] : shard.index) {
+      if (chunk_key.size() >= key_prefix.size() &&
+          std::equal(key_prefix.begin(), key_prefix.end(), chunk_key.begin())) {
+        chunks.emplace_back(chunk_key, seg_it);
+      }
+    }
+  }
+  std::sort(chunks.begin(), chunks.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.first < rhs.first;
+  });
+  return chunks;
+}
+
+void BufferMgr::addFreeSegment(const int slab_num, BufferList::iterator seg_it) {
+  CHECK(seg_it->mem_status == FREE);
+  const auto inserted = free_segments_[slab_num].emplace(
+      std::make_pair(seg_it->num_pages, seg_it->start_page), seg_it);
+  CHECK(inserted.second);
+}
+
+void BufferMgr::removeFreeSegment(const int slab_num, BufferList::iterator seg_it) {
+  CHECK(seg_it->mem_status == FREE);
+  CHECK_EQ(free_segments_[slab_num].erase(
+               std::make_pair(seg_it->num_pages, seg_it->start_page)),
+           size_t(1));
+}
+
+BufferList::iterator BufferMgr::eraseSegment(const int slab_num,
+                                             BufferList::iterator seg_it) {
+  if (seg_it->mem_status == FREE) {
+    removeFreeSegment(slab_num, seg_it);
+  }
+  const bool clock_hand_on_segment = clock_hands_[slab_num] == seg_it;
+  auto next_it = slab_segments_[slab_num].erase(seg_it);
+  if (clock_hand_on_segment) {
+    clock_hands_[slab_num] = next_it;
+  }
+  return next_it;
+}
+
 /// Throws a runtime_error if the Chunk already exists
 AbstractBuffer* BufferMgr::createBuffer(const ChunkKey& chunk_key,
                                         const size_t chunk_page_size,
                                         const size_t initial_size) {
+  return createBufferImpl(chunk_key, chunk_page_size, initial_size, false);
+}
+
+AbstractBuffer* BufferMgr::createBufferImpl(const ChunkKey& chunk_key,
+                                            const size_t chunk_page_size,
+                                            const size_t initial_size,
+                                            const bool fetching) {
   // LOG(INFO) << printMap();
   size_t actual_chunk_page_size = chunk_page_size;
   if (actual_chunk_page_size == 0) {
@@ -117,36 +239,39 @@ AbstractBuffer* BufferMgr::createBuffer(const ChunkKey& chunk_key,
   }
 
   // chunk_page_size is just for recording dirty pages
+  BufferList::iterator seg_it;
   {
-    std::lock_guard<std::mutex> lock(chunk_index_mutex_);
-    CHECK(chunk_index_.find(chunk_key) == chunk_index_.end());
+    auto& shard = getChunkIndexShard(chunk_key);
+    auto shard_lock = lockChunkIndexShard(shard);
+    CHECK(shard.index.find(chunk_key) == shard.index.end());
     BufferSeg buffer_seg(BufferSeg(-1, 0, USED));
     buffer_seg.chunk_key = chunk_key;
+    buffer_seg.fetching = fetching;
     std::lock_guard<std::mutex> unsizedSegsLock(unsized_segs_mutex_);
     unsized_segs_.push_back(buffer_seg);  // race condition?
-    chunk_index_[chunk_key] =
-        std::prev(unsized_segs_.end(),
-                  1);  // need to do this before allocating Buffer because doing so could
-                       // change the segment used
+    seg_it = std::prev(unsized_segs_.end(), 1);
+    shard.index[chunk_key] =
+        seg_it;  // need to do this before allocating Buffer because doing so could
+                 // change the segment used
   }
   // following should be safe outside the lock b/c first thing Buffer
   // constructor does is pin (and its still in unsized segs at this point
   // so can't be evicted)
   try {
-    allocateBuffer(chunk_index_[chunk_key], actual_chunk_page_size, initial_size);
+    allocateBuffer(seg_it, actual_chunk_page_size, initial_size);
   } catch (const OutOfMemory&) {
-    auto buffer_it = chunk_index_.find(chunk_key);
-    CHECK(buffer_it != chunk_index_.end());
-    buffer_it->second->buffer =
+    auto buffer_it = findChunk(chunk_key);
+    CHECK(buffer_it);
+    (*buffer_it)->buffer =
         nullptr;  // constructor failed for the buffer object so make sure to mark it null
                   // so deleteBuffer doesn't try to delete it
     deleteBuffer(chunk_key);
     throw;
   }
-  CHECK(initial_size == 0 || chunk_index_[chunk_key]->buffer->getMemoryPtr());
-  // chunk_index_[chunk_key]->buffer->pin();
-  std::lock_guard<std::mutex> lock(chunk_index_mutex_);
-  return chunk_index_[chunk_key]->buffer;
+  auto buffer_it = findChunk(chunk_key);
+  CHECK(buffer_it);
+  CHECK(initial_size == 0 || (*buffer_it)->buffer->getMemoryPtr());
+  return (*buffer_it)->buffer;
 }
 
 BufferList::iterator BufferMgr::evict(BufferList::iterator& evict_start,
@@ -164,9 +289,12 @@ BufferList::iterator BufferMgr::evict(BufferList::iterator& evict_start,
     }
     num_pages += evict_it->num_pages;
     if (evict_it->mem_status == USED && evict_it->chunk_key.size() > 0) {
-      chunk_index_.erase(evict_it->chunk_key);
+      // the caller holds the locks of all the shards
+      getChunkIndexShard(evict_it->chunk_key).index.erase(evict_it->chunk_key);
+      ++num_evictions_;
     }
-    evict_it = slab_segments_[slab_num].erase(
+    evict_it = eraseSegment(
+        slab_num,
         evict_it);  // erase operations returns next iterator - safe if we ever move
                     // to a vector (as opposed to erase(evict_it++)
   }
@@ -180,11 +308,13 @@ BufferList::iterator BufferMgr::evict(BufferList::iterator& evict_start,
     size_t excess_pages = num_pages - num_pages_requested;
     if (evict_it != slab_segments_[slab_num].end() &&
         evict_it->mem_status == FREE) {  // need to merge with current page
+      removeFreeSegment(slab_num, evict_it);
       evict_it->start_page = start_page + num_pages_requested;
       evict_it->num_pages += excess_pages;
+      addFreeSegment(slab_num, evict_it);
     } else {  // need to insert a free seg before evict_it for excess_pages
       BufferSeg free_seg(start_page + num_pages_requested, excess_pages, FREE);
-      slab_segments_[slab_num].insert(evict_it, free_seg);
+      addFreeSegment(slab_num, slab_segments_[slab_num].insert(evict_it, free_seg));
     }
   }
   return data_seg_it;
@@ -209,9 +339,11 @@ BufferList::iterator BufferMgr::reserveBuffer(
         next_it->num_pages >= num_pages_extra_needed) {
       // Then we can just use the next BufferSeg which happens to be free
       size_t leftover_pages = next_it->num_pages - num_pages_extra_needed;
+      removeFreeSegment(slab_num, next_it);
       seg_it->num_pages = num_pages_requested;
       next_it->num_pages = leftover_pages;
       next_it->start_page = seg_it->start_page + seg_it->num_pages;
+      addFreeSegment(slab_num, next_it);
       return seg_it;
     }
   }
@@ -235,42 +367,97 @@ BufferList::iterator BufferMgr::reserveBuffer(
                                   new_seg_it->buffer->getType(),
                                   device_id_);
   }
-  // Decrement pin count to reverse effect above
-  removeSegment(seg_it);
   {
-    std::lock_guard<std::mutex> lock(chunk_index_mutex_);
-    chunk_index_[new_seg_it->chunk_key] = new_seg_it;
+    // hits must find the new segment before the old one is freed
+    auto& shard = getChunkIndexShard(new_seg_it->chunk_key);
+    auto shard_lock = lockChunkIndexShard(shard);
+    new_seg_it->referenced = seg_it->referenced;
+    new_seg_it->fetching = seg_it->fetching;
+    shard.index[new_seg_it->chunk_key] = new_seg_it;
   }
+  // Decrement pin count to reverse effect above
+  removeSegment(seg_it);
 
   return new_seg_it;
 }
 
 BufferList::iterator BufferMgr::findFreeBufferInSlab(const size_t slab_num,
                                                      const size_t num_pages_requested) {
-  for (auto buffer_it = slab_segments_[slab_num].begin();
-       buffer_it != slab_segments_[slab_num].end();
-       ++buffer_it) {
-    if (buffer_it->mem_status == FREE && buffer_it->num_pages >= num_pages_requested) {
-      // startPage doesn't change
-      size_t excess_pages = buffer_it->num_pages - num_pages_requested;
-      buffer_it->num_pages = num_pages_requested;
-      buffer_it->mem_status = USED;
-      buffer_it->last_touched = buffer_epoch_++;
-      buffer_it->slab_num = slab_num;
-      if (excess_pages > 0) {
-        BufferSeg free_seg(
-            buffer_it->start_page + num_pages_requested, excess_pages, FREE);
-        auto temp_it = buffer_it;  // this should make a copy and not be a reference
-        // - as we do not want to increment buffer_it
-        temp_it++;
-        slab_segments_[slab_num].insert(temp_it, free_seg);
+  // smallest free segment of sufficient size
+  auto& free_segments = free_segments_[slab_num];
+  auto free_it = free_segments.lower_bound(
+      std::make_pair(num_pages_requested, std::numeric_limits<int>::min()));
+  if (free_it == free_segments.end()) {
+    // If here then we did not find a free buffer of sufficient size in this slab,
+    // return the end iterator
+    return slab_segments_[slab_num].end();
+  }
+  auto buffer_it = free_it->second;
+  free_segments.erase(free_it);
+  CHECK(buffer_it->mem_status == FREE && buffer_it->num_pages >= num_pages_requested);
+  // startPage doesn't change
+  size_t excess_pages = buffer_it->num_pages - num_pages_requested;
+  buffer_it->num_pages = num_pages_requested;
+  buffer_it->mem_status = USED;
+  buffer_it->last_touched = buffer_epoch_++;
+  buffer_it->referenced = false;
+  buffer_it->slab_num = slab_num;
+  if (excess_pages > 0) {
+    BufferSeg free_seg(buffer_it->start_page + num_pages_requested, excess_pages, FREE);
+    auto temp_it = buffer_it;  // this should make a copy and not be a reference
+    // - as we do not want to increment buffer_it
+    temp_it++;
+    addFreeSegment(slab_num, slab_segments_[slab_num].insert(temp_it, free_seg));
+  }
+  return buffer_it;
+}
+
+BufferList::iterator BufferMgr::findEvictionCandidateInSlab(
+    const size_t slab_num,
+    const size_t num_pages_requested) {
+  auto& segments = slab_segments_[slab_num];
+  auto& clock_hand = clock_hands_[slab_num];
+  auto run_start = segments.end();
+  size_t run_pages = 0;
+  size_t num_visited = 0;
+  // Visit every segment once, and go on as long as a run of evictable segments which
+  // started before the hand came back to where it started may still grow large enough.
+  while (num_visited < segments.size() || run_start != segments.end()) {
+    if (clock_hand == segments.end()) {
+      // runs can't wrap around the end of the slab
+      clock_hand = segments.begin();
+      run_start = segments.end();
+      run_pages = 0;
+      continue;
+    }
+    auto seg_it = clock_hand++;
+    ++num_visited;
+    if (seg_it->mem_status == USED) {
+      // pinCount should never go up - only down because we have
+      // global lock on buffer pool and pin count only increments
+      // on getChunk
+      if (seg_it->buffer->getPinCount() > 0) {
+        run_start = segments.end();
+        run_pages = 0;
+        continue;
+      }
+      if (seg_it->referenced) {
+        // buffers referenced since the hand last passed them get a second chance
+        seg_it->referenced = false;
+        run_start = segments.end();
+        run_pages = 0;
+        continue;
       }
-      return buffer_it;
+    }
+    if (run_start == segments.end()) {
+      run_start = seg_it;
+    }
+    run_pages += seg_it->num_pages;
+    if (run_pages >= num_pages_requested) {
+      return run_start;
     }
   }
-  // If here then we did not find a free buffer of sufficient size in this slab,
-  // return the end iterator
-  return slab_segments_[slab_num].end();
+  return segments.end();
 }
 
 BufferList::iterator BufferMgr::findFreeBuffer(size_t num_bytes) {
@@ -309,6 +496,10 @@ BufferList::iterator BufferMgr::findFreeBuffer(size_t num_bytes) {
       }
       // if here then addSlab succeeded
       num_pages_allocated_ += current_max_slab_page_size_;
+      CHECK_EQ(slab_segments_.size(), num_slabs + 1);
+      free_segments_.emplace_back();
+      addFreeSegment(num_slabs, slab_segments_[num_slabs].begin());
+      clock_hands_.push_back(slab_segments_[num_slabs].begin());
       return findFreeBufferInSlab(
           num_slabs,
           num_pages_requested);  // has to succeed since we made sure to request a slab
@@ -345,68 +536,27 @@ BufferList::iterator BufferMgr::findFreeBuffer(size_t num_bytes) {
 
   // If here then we can't add a slab - so we need to evict
 
-  size_t min_score = std::numeric_limits<size_t>::max();
-  // We're going for lowest score here, like golf
-  // This is because score is the sum of the lastTouched score for all pages evicted.
-  // Evicting fewer pages and older pages will lower the score
-  BufferList::iterator best_eviction_start = slab_segments_[0].end();
+  // The clock hand sweeps the slabs round robin, starting with the slab of the last
+  // eviction. The first round clears the reference bits it passes, so unless buffers are
+  // pinned the second round finds enough space. No hit can pin a buffer while the locks
+  // of all the shards are held, from the pin count checks to the removal of the evicted
+  // chunks from the index.
+  const auto shard_locks = lockAllChunkIndexShards();
+  BufferList::iterator best_eviction_start;
   int best_eviction_start_slab = -1;
-  int slab_num = 0;
-
-  for (auto slab_it = slab_segments_.begin(); slab_it != slab_segments_.end();
-       ++slab_it, ++slab_num) {
-    for (auto buffer_it = slab_it->begin(); buffer_it != slab_it->end(); ++buffer_it) {
-      // Note there are some shortcuts we could take here - like we should never consider
-      // a USED buffer coming after a free buffer as we would have used the FREE buffer,
-      // but we won't worry about this for now
-
-      // We can't evict pinned buffers - only normal usedbuffers
-
-      // if (buffer_it->mem_status == FREE || buffer_it->buffer->getPinCount() == 0) {
-      size_t page_count = 0;
-      size_t score = 0;
-      bool solution_found = false;
-      auto evict_it = buffer_it;
-      for (; evict_it != slab_segments_[slab_num].end(); ++evict_it) {
-        // pinCount should never go up - only down because we have
-        // global lock on buffer pool and pin count only increments
-        // on getChunk
-        if (evict_it->mem_status == USED && evict_it->buffer->getPinCount() > 0) {
-          break;
-        }
-        page_count += evict_it->num_pages;
-        if (evict_it->mem_status == USED) {
-          // MAT changed from
-          // score += evictIt->lastTouched;
-          // Issue was thrashing when going from 8M fragment size chunks back to 64M
-          // basically the large chunks were being evicted prior to small as many small
-          // chunk score was larger than one large chunk so it always would evict a large
-          // chunk so under memory pressure a query would evict its own current chunks and
-          // cause reloads rather than evict several smaller unused older chunks.
-          score = std::max(score, static_cast<size_t>(evict_it->last_touched));
-        }
-        if (page_count >= num_pages_requested) {
-          solution_found = true;
-          break;
-        }
-      }
-      if (solution_found && score < min_score) {
-        min_score = score;
-        best_eviction_start = buffer_it;
+  for (size_t round = 0; round < 2 && best_eviction_start_slab < 0; ++round) {
+    for (size_t i = 0; i < num_slabs; ++i) {
+      const size_t slab_num = (clock_slab_ + i) % num_slabs;
+      auto seg_it = findEvictionCandidateInSlab(slab_num, num_pages_requested);
+      if (seg_it != slab_segments_[slab_num].end()) {
+        best_eviction_start = seg_it;
         best_eviction_start_slab = slab_num;
-      } else if (evict_it == slab_segments_[slab_num].end()) {
-        // this means that every segment after this will fail as well, so our search has
-        // proven futile
-        // throw std::runtime_error ("Couldn't evict chunks to get free space");
+        clock_slab_ = slab_num;
         break;
-        // in reality we should try to rearrange the buffer to get more contiguous free
-        // space
       }
-      // other possibility is ending at PINNED - do nothing in this case
-      //}
     }
   }
-  if (best_eviction_start == slab_segments_[0].end()) {
+  if (best_eviction_start_slab < 0) {
     LOG(ERROR) << "ALLOCATION failed to find " << num_bytes << "B throwing out of memory "
                << getStringMgrType() << ":" << device_id_;
     VLOG(2) << printSlabs();
@@ -466,17 +616,31 @@ std::string BufferMgr::printSlabs() {
 
 void BufferMgr::clearSlabs() {
   bool pinned_exists = false;
-  for (auto& segment_list : slab_segments_) {
-    for (auto& segment : segment_list) {
-      if (segment.mem_status == FREE) {
-        // no need to free
-      } else if (segment.buffer->getPinCount() < 1) {
-        deleteBuffer(segment.chunk_key, true);
-      } else {
-        pinned_exists = true;
+  std::vector<BufferList::iterator> unpinned_segments;
+  {
+    // as for evictions, so that hits can't pin the buffers being deleted
+    const auto shard_locks = lockAllChunkIndexShards();
+    for (auto& segment_list : slab_segments_) {
+      for (auto seg_it = segment_list.begin(); seg_it != segment_list.end(); ++seg_it) {
+        if (seg_it->mem_status == FREE) {
+          // no need to free
+        } else if (seg_it->buffer->getPinCount() < 1) {
+          getChunkIndexShard(seg_it->chunk_key).index.erase(seg_it->chunk_key);
+          unpinned_segments.push_back(seg_it);
+        } else {
+          pinned_exists = true;
+        }
       }
     }
   }
+  {
+    std::lock_guard<std::mutex> sized_segs_lock(sized_segs_mutex_);
+    for (auto& seg_it : unpinned_segments) {
+      delete seg_it->buffer;
+      seg_it->buffer = nullptr;
+      removeSegment(seg_it);
+    }
+  }
   if (!pinned_exists) {
     // lets actually clear the buffer from memory
     freeAllMem();
@@ -544,17 +708,15 @@ std::string BufferMgr::printMap() {
   tss << std::endl
       << "Map Contents: "
       << " " << getStringMgrType() << ":" << device_id_ << std::endl;
-  std::lock_guard<std::mutex> chunk_index_lock(chunk_index_mutex_);
-  for (auto seg_it = chunk_index_.begin(); seg_it != chunk_index_.end();
-       ++seg_it, ++seg_num) {
+  for (auto& [chunk_key, seg_it] : findChunksWithPrefix({})) {
     //    tss << "Map Entry " << seg_num << ": ";
-    //    for (auto vec_it = seg_it->first.begin(); vec_it != seg_it->first.end();
-    //    ++vec_it)
+    //    for (auto vec_it = chunk_key.begin(); vec_it != chunk_key.end(); ++vec_it)
     //    {
     //      tss << *vec_it << ",";
     //    }
     //    tss << " " << std::endl;
-    tss << printSeg(seg_it->second);
+    tss << printSeg(seg_it);
+    ++seg_num;
   }
   tss << "--------------------" << std::endl;
   return tss.str();
@@ -580,25 +742,27 @@ void BufferMgr::printSegs() {
 }
 
 bool BufferMgr::isBufferOnDevice(const ChunkKey& key) {
-  std::lock_guard<std::mutex> chunkIndexLock(chunk_index_mutex_);
-  if (chunk_index_.find(key) == chunk_index_.end()) {
-    return false;
-  } else {
-    return true;
-  }
+  return findChunk(key).has_value();
+}
+
+int BufferMgr::getChunkSlabNum(const ChunkKey& key) {
+  std::lock_guard<std::mutex> sized_segs_lock(sized_segs_mutex_);
+  const auto buffer_it = findChunk(key);
+  return buffer_it ? (*buffer_it)->slab_num : -1;
 }
 
 /// This method throws a runtime_error when deleting a Chunk that does not exist.
 void BufferMgr::deleteBuffer(const ChunkKey& key, const bool) {
   // Note: purge is unused
-  std::unique_lock<std::mutex> chunk_index_lock(chunk_index_mutex_);
+  auto& shard = getChunkIndexShard(key);
+  auto shard_lock = lockChunkIndexShard(shard);
 
   // lookup the buffer for the Chunk in chunk_index_
-  auto buffer_it = chunk_index_.find(key);
-  CHECK(buffer_it != chunk_index_.end());
+  auto buffer_it = shard.index.find(key);
+  CHECK(buffer_it != shard.index.end());
   auto seg_it = buffer_it->second;
-  chunk_index_.erase(buffer_it);
-  chunk_index_lock.unlock();
+  shard.index.erase(buffer_it);
+  shard_lock.unlock();
   std::lock_guard<std::mutex> sized_segs_lock(sized_segs_mutex_);
   if (seg_it->buffer) {
     delete seg_it->buffer;  // Delete Buffer for segment
@@ -613,26 +777,14 @@ void BufferMgr::deleteBuffersWithPrefix(const ChunkKey& key_prefix, const bool)
   std::lock_guard<std::mutex> sized_segs_lock(
       sized_segs_mutex_);  // Take this lock early to prevent deadlock with
                            // reserveBuffer which needs segs_mutex_ and then
-                           // chunk_index_mutex_
-  std::lock_guard<std::mutex> chunk_index_lock(chunk_index_mutex_);
-  auto startChunkIt = chunk_index_.lower_bound(key_prefix);
-  if (startChunkIt == chunk_index_.end()) {
-    return;
-  }
-
-  auto buffer_it = startChunkIt;
-  while (buffer_it != chunk_index_.end() &&
-         std::search(buffer_it->first.begin(),
-                     buffer_it->first.begin() + key_prefix.size(),
-                     key_prefix.begin(),
-                     key_prefix.end()) != buffer_it->first.begin() + key_prefix.size()) {
-    auto seg_it = buffer_it->second;
+                           // the chunk index shard locks
+  for (auto& [chunk_key, seg_it] : findChunksWithPrefix(key_prefix)) {
+    eraseChunk(chunk_key);
     if (seg_it->buffer) {
       delete seg_it->buffer;  // Delete Buffer for segment
       seg_it->buffer = nullptr;
     }
     removeSegment(seg_it);
-    chunk_index_.erase(buffer_it++);
   }
 }
 
@@ -651,29 +803,29 @@ void BufferMgr::removeSegment(BufferList::iterator& seg_it) {
       if (prev_it->mem_status == FREE) {
         seg_it->start_page = prev_it->start_page;
         seg_it->num_pages += prev_it->num_pages;
-        slab_segments_[slab_num].erase(prev_it);
+        eraseSegment(slab_num, prev_it);
       }
     }
     auto next_it = std::next(seg_it);
     if (next_it != slab_segments_[slab_num].end()) {
       if (next_it->mem_status == FREE) {
         seg_it->num_pages += next_it->num_pages;
-        slab_segments_[slab_num].erase(next_it);
+        eraseSegment(slab_num, next_it);
       }
     }
     seg_it->mem_status = FREE;
     // seg_it->pinCount = 0;
     seg_it->buffer = 0;
+    seg_it->referenced = false;
+    addFreeSegment(slab_num, seg_it);
   }
 }
 
 void BufferMgr::checkpoint() {
   std::lock_guard<std::mutex> lock(global_mutex_);  // granular lock
-  std::lock_guard<std::mutex> chunkIndexLock(chunk_index_mutex_);
 
-  for (auto& chunk_itr : chunk_index_) {
+  for (auto& [chunk_key, buffer_itr] : findChunksWithPrefix({})) {
     // checks that buffer is actual chunk (not just buffer) and is dirty
-    auto& buffer_itr = chunk_itr.second;
     if (buffer_itr->chunk_key[0] != -1 && buffer_itr->buffer->isDirty()) {
       parent_mgr_->putBuffer(buffer_itr->chunk_key, buffer_itr->buffer);
       buffer_itr->buffer->clearDirtyBits();
@@ -683,59 +835,57 @@ void BufferMgr::checkpoint() {
 
 void BufferMgr::checkpoint(const int db_id, const int tb_id) {
   std::lock_guard<std::mutex> lock(global_mutex_);  // granular lock
-  std::lock_guard<std::mutex> chunk_index_lock(chunk_index_mutex_);
 
   ChunkKey key_prefix;
   key_prefix.push_back(db_id);
   key_prefix.push_back(tb_id);
-  auto start_chunk_it = chunk_index_.lower_bound(key_prefix);
-  if (start_chunk_it == chunk_index_.end()) {
-    return;
-  }
-
-  auto buffer_it = start_chunk_it;
-  while (buffer_it != chunk_index_.end() &&
-         std::search(buffer_it->first.begin(),
-                     buffer_it->first.begin() + key_prefix.size(),
-                     key_prefix.begin(),
-                     key_prefix.end()) != buffer_it->first.begin() + key_prefix.size()) {
-    if (buffer_it->second->chunk_key[0] != -1 &&
-        buffer_it->second->buffer->isDirty()) {  // checks that buffer is actual chunk
-                                                 // (not just buffer) and is dirty
-
-      parent_mgr_->putBuffer(buffer_it->second->chunk_key, buffer_it->second->buffer);
-      buffer_it->second->buffer->clearDirtyBits();
+  for (auto& [chunk_key, seg_it] : findChunksWithPrefix(key_prefix)) {
+    if (seg_it->chunk_key[0] != -1 &&
+        seg_it->buffer->isDirty()) {  // checks that buffer is actual chunk
+                                      // (not just buffer) and is dirty
+
+      parent_mgr_->putBuffer(seg_it->chunk_key, seg_it->buffer);
+      seg_it->buffer->clearDirtyBits();
     }
-    buffer_it++;
   }
 }
 
+AbstractBuffer* BufferMgr::getBufferIfCached(const ChunkKey& key,
+                                             const size_t num_bytes) {
+  auto buffer = pinChunk(key);
+  if (!buffer) {
+    return nullptr;
+  }
+  if (buffer->size() < num_bytes) {
+    // the rest of the chunk is fetched holding global_mutex_
+    buffer->unPin();
+    return nullptr;
+  }
+  ++num_hits_;
+  return buffer;
+}
+
 /// Returns a pointer to the Buffer holding the chunk, if it exists; otherwise,
 /// throws a runtime_error.
 AbstractBuffer* BufferMgr::getBuffer(const ChunkKey& key, const size_t num_bytes) {
+  if (auto buffer = getBufferIfCached(key, num_bytes)) {
+    return buffer;
+  }
   std::lock_guard<std::mutex> lock(global_mutex_);  // granular lock
 
-  std::unique_lock<std::mutex> sized_segs_lock(sized_segs_mutex_);
-  std::unique_lock<std::mutex> chunk_index_lock(chunk_index_mutex_);
-  auto buffer_it = chunk_index_.find(key);
-  bool found_buffer = buffer_it != chunk_index_.end();
-  chunk_index_lock.unlock();
-  if (found_buffer) {
-    CHECK(buffer_it->second->buffer);
-    buffer_it->second->buffer->pin();
-    sized_segs_lock.unlock();
-
-    buffer_it->second->last_touched = buffer_epoch_++;  // race
-
-    if (buffer_it->second->buffer->size() < num_bytes) {
+  // another thread may have fetched the chunk meanwhile
+  auto buffer = pinChunk(key);
+  if (buffer) {
+    ++num_hits_;
+    if (buffer->size() < num_bytes) {
       // need to fetch part of buffer we don't have - up to numBytes
-      parent_mgr_->fetchBuffer(key, buffer_it->second->buffer, num_bytes);
+      parent_mgr_->fetchBuffer(key, buffer, num_bytes);
     }
-    return buffer_it->second->buffer;
+    return buffer;
   } else {  // If wasn't in pool then we need to fetch it
-    sized_segs_lock.unlock();
+    ++num_misses_;
     // createChunk pins for us
-    AbstractBuffer* buffer = createBuffer(key, page_size_, num_bytes);
+    buffer = createBufferImpl(key, page_size_, num_bytes, true);
     try {
       parent_mgr_->fetchBuffer(
           key, buffer, num_bytes);  // this should put buffer in a BufferSegment
@@ -748,6 +898,7 @@ AbstractBuffer* BufferMgr::getBuffer(const ChunkKey& key, const size_t num_bytes
       LOG(FATAL) << "Get chunk - Could not find chunk " << keyToString(key)
                  << " in buffer pool or parent buffer pools. Error was " << error.what();
     }
+    setChunkFetched(key);
     return buffer;
   }
 }
@@ -755,36 +906,31 @@ AbstractBuffer* BufferMgr::getBuffer(const ChunkKey& key, const size_t num_bytes
 void BufferMgr::fetchBuffer(const ChunkKey& key,
                             AbstractBuffer* dest_buffer,
                             const size_t num_bytes) {
-  std::unique_lock<std::mutex> lock(global_mutex_);  // granular lock
-  std::unique_lock<std::mutex> sized_segs_lock(sized_segs_mutex_);
-  std::unique_lock<std::mutex> chunk_index_lock(chunk_index_mutex_);
-
-  auto buffer_it = chunk_index_.find(key);
-  bool found_buffer = buffer_it != chunk_index_.end();
-  chunk_index_lock.unlock();
-  AbstractBuffer* buffer;
-  if (!found_buffer) {
-    sized_segs_lock.unlock();
-    CHECK(parent_mgr_ != 0);
-    buffer = createBuffer(key, page_size_, num_bytes);  // will pin buffer
-    try {
-      parent_mgr_->fetchBuffer(key, buffer, num_bytes);
-    } catch (std::runtime_error& error) {
-      LOG(FATAL) << "Could not fetch parent buffer " << keyToString(key);
-    }
-  } else {
-    buffer = buffer_it->second->buffer;
-    buffer->pin();
-    if (num_bytes > buffer->size()) {
+  auto buffer = getBufferIfCached(key, num_bytes);
+  if (!buffer) {
+    std::lock_guard<std::mutex> lock(global_mutex_);  // granular lock
+    buffer = pinChunk(key);
+    if (!buffer) {
+      ++num_misses_;
+      CHECK(parent_mgr_ != 0);
+      buffer = createBufferImpl(key, page_size_, num_bytes, true);  // will pin buffer
       try {
         parent_mgr_->fetchBuffer(key, buffer, num_bytes);
       } catch (std::runtime_error& error) {
         LOG(FATAL) << "Could not fetch parent buffer " << keyToString(key);
       }
+      setChunkFetched(key);
+    } else {
+      ++num_hits_;
+      if (num_bytes > buffer->size()) {
+        try {
+          parent_mgr_->fetchBuffer(key, buffer, num_bytes);
+        } catch (std::runtime_error& error) {
+          LOG(FATAL) << "Could not fetch parent buffer " << keyToString(key);
+        }
+      }
     }
-    sized_segs_lock.unlock();
   }
-  lock.unlock();
   buffer->copyTo(dest_buffer, num_bytes);
   buffer->unPin();
 }
@@ -792,15 +938,12 @@ void BufferMgr::fetchBuffer(const ChunkKey& key,
 AbstractBuffer* BufferMgr::putBuffer(const ChunkKey& key,
                                      AbstractBuffer* src_buffer,
                                      const size_t num_bytes) {
-  std::unique_lock<std::mutex> chunk_index_lock(chunk_index_mutex_);
-  auto buffer_it = chunk_index_.find(key);
-  bool found_buffer = buffer_it != chunk_index_.end();
-  chunk_index_lock.unlock();
+  auto buffer_it = findChunk(key);
   AbstractBuffer* buffer;
-  if (!found_buffer) {
+  if (!buffer_it) {
     buffer = createBuffer(key, page_size_);
   } else {
-    buffer = buffer_it->second->buffer;
+    buffer = (*buffer_it)->buffer;
   }
   size_t old_buffer_size = buffer->size();
   size_t new_buffer_size = num_bytes == 0 ? src_buffer->size() : num_bytes;
@@ -850,8 +993,12 @@ void BufferMgr::free(AbstractBuffer* buffer) {
 }
 
 size_t BufferMgr::getNumChunks() {
-  std::lock_guard<std::mutex> chunk_index_lock(chunk_index_mutex_);
-  return chunk_index_.size();
+  size_t num_chunks = 0;
+  for (auto& shard : chunk_index_) {
+    auto shard_lock = lockChunkIndexShard(shard);
+    num_chunks += shard.index.size();
+  }
+  return num_chunks;
 }
 
 size_t BufferMgr::size() {
@@ -875,6 +1022,16 @@ const std::vector<BufferList>& BufferMgr::getSlabSegments() {
   return slab_segments_;
 }
 
+BufferMgrStats BufferMgr::getStats() {
+  BufferMgrStats stats;
+  stats.hits = num_hits_;
+  stats.misses = num_misses_;
+  stats.evictions = num_evictions_;
+  stats.chunk_index_lock_acquisitions = num_chunk_index_lock_acquisitions_;
+  stats.chunk_index_lock_waits = num_chunk_index_lock_waits_;
+  return stats;
+}
+
 void BufferMgr::removeTableRelatedDS(const int db_id, const int table_id) {
   UNREACHABLE();
 }
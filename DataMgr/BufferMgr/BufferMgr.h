@@ -26,10 +26,16 @@
 
 #define BOOST_STACKTRACE_GNU_SOURCE_NOT_REQUIRED 1
 
+#include <array>
+#include <atomic>
 #include <iostream>
 #include <list>
 #include <map>
 #include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include <boost/functional/hash.hpp>
 
 #include "DataMgr/AbstractBuffer.h"
 #include "DataMgr/AbstractBufferMgr.h"
@@ -86,6 +92,14 @@ using namespace Data_Namespace;
 
 namespace Buffer_Namespace {
 
+struct BufferMgrStats {
+  size_t hits{0};       // chunks found in the buffer pool
+  size_t misses{0};     // chunks fetched from the parent buffer manager
+  size_t evictions{0};  // chunks evicted to make room for others
+  size_t chunk_index_lock_acquisitions{0};
+  size_t chunk_index_lock_waits{0};  // acquisitions which found the shard locked
+};
+
 /**
  * @class   BufferMgr
  * @brief
@@ -125,6 +139,7 @@ class BufferMgr : public AbstractBufferMgr {  // implements
   size_t getPageSize();
   bool isAllocationCapped() override;
   const std::vector<BufferList>& getSlabSegments();
+  BufferMgrStats getStats();
 
   /// Creates a chunk with the specified key and page size.
   AbstractBuffer* createBuffer(const ChunkKey& key,
@@ -139,6 +154,10 @@ class BufferMgr : public AbstractBufferMgr {  // implements
   /// Returns the a pointer to the chunk with the specified key.
   AbstractBuffer* getBuffer(const ChunkKey& key, const size_t num_bytes = 0) override;
 
+  /// Returns the pinned buffer of the chunk if its first num_bytes are in the buffer
+  /// pool, nullptr otherwise. Only takes the lock of the chunk index shard of the key.
+  AbstractBuffer* getBufferIfCached(const ChunkKey& key, const size_t num_bytes = 0);
+
   /**
    * @brief Puts the contents of d into the Buffer with ChunkKey key.
    * @param key - Unique identifier for a Chunk.
@@ -146,6 +165,8 @@ class BufferMgr : public AbstractBufferMgr {  // implements
    * @return AbstractBuffer*
    */
   bool isBufferOnDevice(const ChunkKey& key) override;
+  /// Returns the slab holding the chunk, -1 if it isn't in the buffer pool
+  int getChunkSlabNum(const ChunkKey& key);
   void fetchBuffer(const ChunkKey& key,
                    AbstractBuffer* dest_buffer,
                    const size_t num_bytes = 0) override;
@@ -187,19 +208,69 @@ class BufferMgr : public AbstractBufferMgr {  // implements
   void removeSegment(BufferList::iterator& seg_it);
   BufferList::iterator findFreeBufferInSlab(const size_t slab_num,
                                             const size_t num_pages_requested);
+  BufferList::iterator findEvictionCandidateInSlab(const size_t slab_num,
+                                                   const size_t num_pages_requested);
   int getBufferId();
   virtual void addSlab(const size_t slab_size) = 0;
   virtual void freeAllMem() = 0;
   virtual void allocateBuffer(BufferList::iterator seg_it,
                               const size_t page_size,
                               const size_t num_bytes) = 0;
-  std::mutex chunk_index_mutex_;
+  /**
+   * The chunk index is split into shards by the hash of the chunk key, each with its
+   * own mutex, so that lookups of different chunks don't serialize on a single lock.
+   * Operations on key prefixes (tables, databases) visit all shards.
+   *
+   * Hits pin their buffer holding the lock of its shard only. Evictions and clears check
+   * the pin counts, and remove the chunks from the index, holding the locks of all the
+   * shards, so that a chunk can't be evicted once a hit found it.
+   */
+  static constexpr size_t kNumChunkIndexShards{16};
+
+  struct ChunkIndexShard {
+    std::mutex mutex;
+    std::unordered_map<ChunkKey, BufferList::iterator, boost::hash<ChunkKey>> index;
+  };
+
+  ChunkIndexShard& getChunkIndexShard(const ChunkKey& key);
+  std::unique_lock<std::mutex> lockChunkIndexShard(ChunkIndexShard& shard);
+  std::vector<std::unique_lock<std::mutex>> lockAllChunkIndexShards();
+  // pins the buffer of the chunk and marks it referenced, nullptr if not in the pool
+  AbstractBuffer* pinChunk(const ChunkKey& key);
+  void setChunkFetched(const ChunkKey& key);
+  // hits skip the chunk of a buffer created to be fetched until setChunkFetched
+  AbstractBuffer* createBufferImpl(const ChunkKey& key,
+                                   const size_t page_size,
+                                   const size_t initial_size,
+                                   const bool fetching);
+  std::optional<BufferList::iterator> findChunk(const ChunkKey& key);
+  void eraseChunk(const ChunkKey& key);
+  // entries of all shards whose key starts with key_prefix, ordered by key
+  std::vector<std::pair<ChunkKey, BufferList::iterator>> findChunksWithPrefix(
+      const ChunkKey& key_prefix);
+
+  /**
+   * FREE segments of every slab, ordered by size, so that finding a free segment for a
+   * buffer is a best fit lookup rather than a scan of the slab. Every change to a FREE
+   * segment of a slab goes through addFreeSegment / removeFreeSegment.
+   */
+  using FreeSegmentIndex = std::map<std::pair<size_t, int>, BufferList::iterator>;
+
+  void addFreeSegment(const int slab_num, BufferList::iterator seg_it);
+  void removeFreeSegment(const int slab_num, BufferList::iterator seg_it);
+  BufferList::iterator eraseSegment(const int slab_num, BufferList::iterator seg_it);
+
   std::mutex sized_segs_mutex_;
   std::mutex unsized_segs_mutex_;
   std::mutex buffer_id_mutex_;
   std::mutex global_mutex_;
 
-  std::map<ChunkKey, BufferList::iterator> chunk_index_;
+  std::array<ChunkIndexShard, kNumChunkIndexShards> chunk_index_;
+  std::vector<FreeSegmentIndex> free_segments_;
+  // CLOCK eviction: the segment of every slab the hand points to, and the slab the
+  // last eviction happened in
+  std::vector<BufferList::iterator> clock_hands_;
+  size_t clock_slab_;
   size_t max_buffer_pool_num_pages_;  // max number of pages for buffer pool
   size_t num_pages_allocated_;
   size_t min_num_pages_per_slab_;
@@ -208,7 +279,13 @@ class BufferMgr : public AbstractBufferMgr {  // implements
   bool allocations_capped_;
   AbstractBufferMgr* parent_mgr_;
   int max_buffer_id_;
-  unsigned int buffer_epoch_;
+  std::atomic<unsigned int> buffer_epoch_;
+
+  std::atomic<size_t> num_hits_{0};
+  std::atomic<size_t> num_misses_{0};
+  std::atomic<size_t> num_evictions_{0};
+  std::atomic<size_t> num_chunk_index_lock_acquisitions_{0};
+  std::atomic<size_t> num_chunk_index_lock_waits_{0};  // on the hit path mostly
 
   BufferList unsized_segs_;
 
@@ -218,10 +295,11 @@ class BufferMgr : public AbstractBufferMgr {  // implements
   /**
    * @brief Gets a buffer of required size and returns an iterator to it
    *
-   * If possible, this function will just select a free buffer of
+   * If possible, this function will just select the smallest free buffer of
    * sufficient size and use that. If not, it will evict as many
    * non-pinned but used buffers as needed to have enough space for the
-   * buffer
+   * buffer, picking them with the CLOCK algorithm: buffers referenced since
+   * the clock hand last passed them get a second chance
    *
    * @return An iterator to the reserved buffer. We guarantee that this
    * buffer won't be evicted by PINNING it - caller should change this to
@@ -36,9 +36,17 @@ struct BufferSeg {
   unsigned int pin_count;
   int slab_num;
   unsigned int last_touched;
+  bool referenced;  // set on every hit, cleared as the eviction clock hand passes
+  bool fetching;    // in the chunk index while its contents are fetched from the parent
 
   BufferSeg()
-      : mem_status(FREE), buffer(0), pin_count(0), slab_num(-1), last_touched(0) {}
+      : mem_status(FREE)
+      , buffer(0)
+      , pin_count(0)
+      , slab_num(-1)
+      , last_touched(0)
+      , referenced(false)
+      , fetching(false) {}
   BufferSeg(const int start_page, const size_t num_pages)
       : start_page(start_page)
       , num_pages(num_pages)
@@ -46,7 +54,9 @@ struct BufferSeg {
       , buffer(0)
       , pin_count(0)
       , slab_num(-1)
-      , last_touched(0) {}
+      , last_touched(0)
+      , referenced(false)
+      , fetching(false) {}
   BufferSeg(const int start_page, const size_t num_pages, const MemStatus mem_status)
       : start_page(start_page)
       , num_pages(num_pages)
@@ -54,7 +64,9 @@ struct BufferSeg {
       , buffer(0)
       , pin_count(0)
       , slab_num(-1)
-      , last_touched(0) {}
+      , last_touched(0)
+      , referenced(false)
+      , fetching(false) {}
   BufferSeg(const int start_page,
             const size_t num_pages,
             const MemStatus mem_status,
@@ -65,7 +77,9 @@ struct BufferSeg {
       , buffer(0)
       , pin_count(0)
       , slab_num(-1)
-      , last_touched(last_touched) {}
+      , last_touched(last_touched)
+      , referenced(false)
+      , fetching(false) {}
 };
 
 using BufferList = std::list<BufferSeg>;
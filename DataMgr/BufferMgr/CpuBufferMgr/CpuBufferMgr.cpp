@@ -23,10 +23,17 @@
 namespace Buffer_Namespace {
 
 void CpuBufferMgr::addSlab(const size_t slab_size) {
-  CHECK(allocator_);
+  CHECK(allocator_ || slab_allocator_);
   slabs_.resize(slabs_.size() + 1);
   try {
-    slabs_.back() = reinterpret_cast<int8_t*>(allocator_->allocate(slab_size));
+    if (slab_allocator_) {
+      const auto [slab, numa_node] = slab_allocator_->allocate(slab_size);
+      slabs_.back() = slab;
+      slab_numa_nodes_.resize(slabs_.size(), -1);
+      slab_numa_nodes_.back() = numa_node;
+    } else {
+      slabs_.back() = reinterpret_cast<int8_t*>(allocator_->allocate(slab_size));
+    }
   } catch (std::bad_alloc&) {
     slabs_.resize(slabs_.size() - 1);
     throw FailedToCreateSlab(slab_size);
@@ -37,10 +44,23 @@ void CpuBufferMgr::addSlab(const size_t slab_size) {
 }
 
 void CpuBufferMgr::freeAllMem() {
+  if (slab_allocator_) {
+    slab_allocator_->freeAll();
+    slab_numa_nodes_.clear();
+    return;
+  }
   CHECK(allocator_);
   allocator_.reset(new Arena(max_slab_size_ + kArenaBlockOverhead));
 }
 
+int CpuBufferMgr::getChunkNumaNode(const ChunkKey& key) {
+  const auto slab_num = getChunkSlabNum(key);
+  if (slab_num < 0 || static_cast<size_t>(slab_num) >= slab_numa_nodes_.size()) {
+    return -1;
+  }
+  return slab_numa_nodes_[slab_num];
+}
+
 void CpuBufferMgr::allocateBuffer(BufferList::iterator seg_it,
                                   const size_t page_size,
                                   const size_t initial_size) {
@@ -19,6 +19,7 @@
 #include "DataMgr/BufferMgr/BufferMgr.h"
 
 #include "DataMgr/Allocators/ArenaAllocator.h"
+#include "DataMgr/Allocators/NumaSlabAllocator.h"
 
 namespace CudaMgr_Namespace {
 class CudaMgr;
@@ -34,16 +35,23 @@ class CpuBufferMgr : public BufferMgr {
                const size_t min_slab_size,
                const size_t max_slab_size,
                const size_t page_size,
-               AbstractBufferMgr* parent_mgr = nullptr)
+               AbstractBufferMgr* parent_mgr = nullptr,
+               const bool use_huge_pages = false,
+               const NumaPolicy numa_policy = NumaPolicy::kNone)
       : BufferMgr(device_id,
                   max_buffer_pool_size,
                   min_slab_size,
                   max_slab_size,
                   page_size,
                   parent_mgr)
-      , cuda_mgr_(cuda_mgr)
-      , allocator_(std::make_unique<Arena>(/*min_block_size=*/max_slab_size +
-                                           kArenaBlockOverhead)) {}
+      , cuda_mgr_(cuda_mgr) {
+    if (use_huge_pages || numa_policy != NumaPolicy::kNone) {
+      slab_allocator_ = std::make_unique<NumaSlabAllocator>(use_huge_pages, numa_policy);
+    } else {
+      allocator_ = std::make_unique<Arena>(/*min_block_size=*/max_slab_size +
+                                           kArenaBlockOverhead);
+    }
+  }
 
   ~CpuBufferMgr() {
     /* the destruction of the allocator automatically frees all memory */
@@ -52,6 +60,10 @@ class CpuBufferMgr : public BufferMgr {
   inline MgrType getMgrType() override { return CPU_MGR; }
   inline std::string getStringMgrType() override { return ToString(CPU_MGR); }
 
+  /// Returns the NUMA node the chunk is on, -1 if it isn't in the buffer pool or its slab
+  /// isn't bound to a node.
+  int getChunkNumaNode(const ChunkKey& key);
+
  private:
   void addSlab(const size_t slab_size) override;
   void freeAllMem() override;
@@ -61,6 +73,9 @@ class CpuBufferMgr : public BufferMgr {
 
   CudaMgr_Namespace::CudaMgr* cuda_mgr_;
   std::unique_ptr<Arena> allocator_;
+  // used instead of the arena to place slabs on huge pages or NUMA nodes
+  std::unique_ptr<NumaSlabAllocator> slab_allocator_;
+  std::vector<int> slab_numa_nodes_;
 };
 
 }  // namespace Buffer_Namespace
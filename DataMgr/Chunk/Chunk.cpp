@@ -21,6 +21,7 @@
 
 #include "DataMgr/Chunk/Chunk.h"
 #include "DataMgr/ArrayNoneEncoder.h"
+#include "DataMgr/DiffEncoder.h"
 #include "DataMgr/FixedLengthArrayNoneEncoder.h"
 #include "DataMgr/StringNoneEncoder.h"
 
@@ -269,6 +270,19 @@ ChunkIter Chunk::begin_iterator(const std::shared_ptr<ChunkMetadata>& chunk_meta
         index_buf_->getMemoryPtr() + start_idx * sizeof(StringOffsetT);
     it.end_pos = index_buf_->getMemoryPtr() + index_buf_->size() - sizeof(StringOffsetT);
     it.second_buf = buffer_->getMemoryPtr();
+  } else if (it.type_info.get_compression() == kENCODING_RL) {
+    // Run length encoded chunks aren't positional; the iterator walks virtual positions
+    // relative to the chunk header, which ChunkIter translates back to row indices.
+    it.second_buf = buffer_->getMemoryPtr();
+    it.current_pos = it.start_pos = it.second_buf + start_idx * it.skip_size;
+    it.end_pos = it.second_buf + chunk_metadata->numElements * it.skip_size;
+  } else if (it.type_info.get_compression() == kENCODING_DIFF) {
+    // The chunk header holds the baseline the deltas are relative to.
+    it.skip_size = it.type_info.get_comp_param() / 8;
+    it.second_buf = buffer_->getMemoryPtr();
+    it.current_pos = it.start_pos =
+        it.second_buf + kDiffEncodingHeaderSize + start_idx * it.skip_size;
+    it.end_pos = buffer_->getMemoryPtr() + buffer_->size();
   } else {
     it.current_pos = it.start_pos = buffer_->getMemoryPtr() + start_idx * it.skip_size;
     it.end_pos = buffer_->getMemoryPtr() + buffer_->size();
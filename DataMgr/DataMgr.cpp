@@ -24,6 +24,7 @@
 #include "BufferMgr/GpuCudaBufferMgr/GpuCudaBufferMgr.h"
 #include "CudaMgr/CudaMgr.h"
 #include "FileMgr/GlobalFileMgr.h"
+#include "OSDependent/omnisci_numa.h"
 #include "PersistentStorageMgr/PersistentStorageMgr.h"
 
 #ifdef __APPLE__
@@ -202,17 +203,24 @@ void DataMgr::populateMgrs(const SystemParameters& system_parameters,
   LOG(INFO) << "Max CPU Slab Size is " << (float)maxCpuSlabSize / (1024 * 1024) << "MB";
   LOG(INFO) << "Max memory pool size for CPU is " << (float)cpuBufferSize / (1024 * 1024)
             << "MB";
+  const auto cpu_numa_policy =
+      parse_numa_policy(system_parameters.cpu_buffer_numa_policy);
+  cpu_slabs_bound_to_numa_nodes_ =
+      cpu_numa_policy == NumaPolicy::kBind && omnisci::get_numa_nodes().size() > 1;
   if (hasGpus_ || cudaMgr_) {
     LOG(INFO) << "Reserved GPU memory is " << (float)reservedGpuMem_ / (1024 * 1024)
               << "MB includes render buffer allocation";
     bufferMgrs_.resize(3);
-    bufferMgrs_[1].push_back(new Buffer_Namespace::CpuBufferMgr(0,
-                                                                cpuBufferSize,
-                                                                cudaMgr_.get(),
-                                                                minCpuSlabSize,
-                                                                maxCpuSlabSize,
-                                                                page_size,
-                                                                bufferMgrs_[0][0]));
+    bufferMgrs_[1].push_back(
+        new Buffer_Namespace::CpuBufferMgr(0,
+                                           cpuBufferSize,
+                                           cudaMgr_.get(),
+                                           minCpuSlabSize,
+                                           maxCpuSlabSize,
+                                           page_size,
+                                           bufferMgrs_[0][0],
+                                           system_parameters.cpu_buffer_huge_pages,
+                                           cpu_numa_policy));
     levelSizes_.push_back(1);
     int numGpus = cudaMgr_->getDeviceCount();
     for (int gpuNum = 0; gpuNum < numGpus; ++gpuNum) {
@@ -242,13 +250,16 @@ void DataMgr::populateMgrs(const SystemParameters& system_parameters,
     }
     levelSizes_.push_back(numGpus);
   } else {
-    bufferMgrs_[1].push_back(new Buffer_Namespace::CpuBufferMgr(0,
-                                                                cpuBufferSize,
-                                                                cudaMgr_.get(),
-                                                                minCpuSlabSize,
-                                                                maxCpuSlabSize,
-                                                                page_size,
-                                                                bufferMgrs_[0][0]));
+    bufferMgrs_[1].push_back(
+        new Buffer_Namespace::CpuBufferMgr(0,
+                                           cpuBufferSize,
+                                           cudaMgr_.get(),
+                                           minCpuSlabSize,
+                                           maxCpuSlabSize,
+                                           page_size,
+                                           bufferMgrs_[0][0],
+                                           system_parameters.cpu_buffer_huge_pages,
+                                           cpu_numa_policy));
     levelSizes_.push_back(1);
   }
 }
@@ -315,6 +326,7 @@ std::vector<MemoryInfo> DataMgr::getMemoryInfo(const MemoryLevel memLevel) {
     mi.maxNumPages = cpu_buffer->getMaxSize() / mi.pageSize;
     mi.isAllocationCapped = cpu_buffer->isAllocationCapped();
     mi.numPageAllocated = cpu_buffer->getAllocated() / mi.pageSize;
+    mi.bufferMgrStats = cpu_buffer->getStats();
 
     const auto& slab_segments = cpu_buffer->getSlabSegments();
     for (size_t slab_num = 0; slab_num < slab_segments.size(); ++slab_num) {
@@ -344,6 +356,7 @@ std::vector<MemoryInfo> DataMgr::getMemoryInfo(const MemoryLevel memLevel) {
       mi.maxNumPages = gpu_buffer->getMaxSize() / mi.pageSize;
       mi.isAllocationCapped = gpu_buffer->isAllocationCapped();
       mi.numPageAllocated = gpu_buffer->getAllocated() / mi.pageSize;
+      mi.bufferMgrStats = gpu_buffer->getStats();
 
       const auto& slab_segments = gpu_buffer->getSlabSegments();
       for (size_t slab_num = 0; slab_num < slab_segments.size(); ++slab_num) {
@@ -407,6 +420,13 @@ bool DataMgr::isBufferOnDevice(const ChunkKey& key,
   return bufferMgrs_[memLevel][deviceId]->isBufferOnDevice(key);
 }
 
+int DataMgr::getChunkNumaNode(const ChunkKey& key) {
+  std::lock_guard<std::mutex> buffer_lock(buffer_access_mutex_);
+  auto cpu_buffer_mgr = dynamic_cast<Buffer_Namespace::CpuBufferMgr*>(
+      bufferMgrs_[MemoryLevel::CPU_LEVEL][0]);
+  return cpu_buffer_mgr ? cpu_buffer_mgr->getChunkNumaNode(key) : -1;
+}
+
 void DataMgr::getChunkMetadataVecForKeyPrefix(ChunkMetadataVector& chunkMetadataVec,
                                               const ChunkKey& keyPrefix) {
   std::lock_guard<std::mutex> buffer_lock(buffer_access_mutex_);
@@ -426,10 +446,17 @@ AbstractBuffer* DataMgr::getChunkBuffer(const ChunkKey& key,
                                         const MemoryLevel memoryLevel,
                                         const int deviceId,
                                         const size_t numBytes) {
-  std::lock_guard<std::mutex> buffer_lock(buffer_access_mutex_);
   const auto level = static_cast<size_t>(memoryLevel);
   CHECK_LT(level, levelSizes_.size());     // make sure we have a legit buffermgr
   CHECK_LT(deviceId, levelSizes_[level]);  // make sure we have a legit buffermgr
+  // chunks already in a buffer pool are pinned without serializing on the data manager
+  if (auto buffer_mgr =
+          dynamic_cast<Buffer_Namespace::BufferMgr*>(bufferMgrs_[level][deviceId])) {
+    if (auto buffer = buffer_mgr->getBufferIfCached(key, numBytes)) {
+      return buffer;
+    }
+  }
+  std::lock_guard<std::mutex> buffer_lock(buffer_access_mutex_);
   return bufferMgrs_[level][deviceId]->getBuffer(key, numBytes);
 }
 
@@ -63,6 +63,7 @@ struct MemoryInfo {
   size_t numPageAllocated;
   bool isAllocationCapped;
   std::vector<MemoryData> nodeMemoryData;
+  Buffer_Namespace::BufferMgrStats bufferMgrStats;
 };
 
 //! Parse /proc/meminfo into key/value pairs.
@@ -190,6 +191,10 @@ class DataMgr {
   bool isBufferOnDevice(const ChunkKey& key,
                         const MemoryLevel memLevel,
                         const int deviceId);
+  // NUMA node of the CPU buffer pool slab holding the chunk, -1 if unknown
+  int getChunkNumaNode(const ChunkKey& key);
+  // true if the CPU buffer pool slabs are bound to NUMA nodes
+  bool cpuSlabsBoundToNumaNodes() const { return cpu_slabs_bound_to_numa_nodes_; }
   std::vector<MemoryInfo> getMemoryInfo(const MemoryLevel memLevel);
   std::string dumpLevel(const MemoryLevel memLevel);
   void clearMemory(const MemoryLevel memLevel);
@@ -243,6 +248,7 @@ class DataMgr {
   std::string dataDir_;
   bool hasGpus_;
   size_t reservedGpuMem_;
+  bool cpu_slabs_bound_to_numa_nodes_{false};
   std::mutex buffer_access_mutex_;
 };
 
@@ -0,0 +1,290 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DIFF_ENCODER_H
+#define DIFF_ENCODER_H
+
+#include "Logger/Logger.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "AbstractBuffer.h"
+#include "Encoder.h"
+
+#include <Shared/DatumFetchers.h>
+
+// A differential encoded chunk starts with a 64-bit baseline (the first non-null value
+// written to the chunk, which may come with a later append when the chunk starts with
+// nulls) followed by one fixed width delta per row. The minimum value of
+// the delta type is reserved for nulls. The baseline travels with the chunk, which
+// keeps the decoding independent of the fragment being scanned (see
+// `diff_fixed_width_int_decode` in QueryEngine/DecodersImpl.h).
+constexpr size_t kDiffEncodingHeaderSize = sizeof(int64_t);
+
+// Decodes all the rows of a differential encoded chunk buffer. Nulls are returned as
+// `ret_null_val`.
+inline std::vector<int64_t> diff_decode_all(const int8_t* buf,
+                                            const size_t num_bytes,
+                                            const size_t byte_width,
+                                            const int64_t ret_null_val) {
+  std::vector<int64_t> values;
+  if (num_bytes < kDiffEncodingHeaderSize) {
+    return values;
+  }
+  const auto baseline = *reinterpret_cast<const int64_t*>(buf);
+  const auto deltas = buf + kDiffEncodingHeaderSize;
+  const auto num_elems = (num_bytes - kDiffEncodingHeaderSize) / byte_width;
+  values.reserve(num_elems);
+  for (size_t i = 0; i < num_elems; ++i) {
+    int64_t delta{0};
+    int64_t null_val{0};
+    switch (byte_width) {
+      case 1:
+        delta = reinterpret_cast<const int8_t*>(deltas)[i];
+        null_val = inline_int_null_value<int8_t>();
+        break;
+      case 2:
+        delta = reinterpret_cast<const int16_t*>(deltas)[i];
+        null_val = inline_int_null_value<int16_t>();
+        break;
+      case 4:
+        delta = reinterpret_cast<const int32_t*>(deltas)[i];
+        null_val = inline_int_null_value<int32_t>();
+        break;
+      default:
+        UNREACHABLE() << "Invalid differential encoding width " << byte_width;
+    }
+    values.push_back(delta == null_val ? ret_null_val : baseline + delta);
+  }
+  return values;
+}
+
+template <typename T, typename V>
+class DiffEncoder : public Encoder {
+ public:
+  DiffEncoder(Data_Namespace::AbstractBuffer* buffer)
+      : Encoder(buffer), baseline_(0), has_baseline_(false) {
+    resetChunkStats();
+  }
+
+  std::shared_ptr<ChunkMetadata> appendData(int8_t*& src_data,
+                                            const size_t num_elems_to_append,
+                                            const SQLTypeInfo&,
+                                            const bool replicating = false,
+                                            const int64_t offset = -1) override {
+    if (offset == 0 && num_elems_to_append >= num_elems_) {
+      // rewriting the entire chunk, pick a new baseline
+      resetChunkStats();
+      num_elems_ = 0;
+      buffer_->setSize(0);
+    }
+
+    const T* unencoded_data = reinterpret_cast<const T*>(src_data);
+    if (buffer_->size() == 0) {
+      baseline_ = 0;
+      has_baseline_ = false;
+      buffer_->append(reinterpret_cast<int8_t*>(&baseline_), kDiffEncodingHeaderSize);
+    }
+    if (!has_baseline_) {
+      // The chunk only holds nulls so far, whose deltas do not depend on the baseline,
+      // so the first non-null value becomes the baseline even in a later append.
+      for (size_t i = 0; i < num_elems_to_append; ++i) {
+        const auto data = unencoded_data[replicating ? 0 : i];
+        if (data != inline_int_null_value<T>()) {
+          baseline_ = static_cast<int64_t>(data);
+          has_baseline_ = true;
+          buffer_->write(reinterpret_cast<int8_t*>(&baseline_), kDiffEncodingHeaderSize);
+          break;
+        }
+      }
+    }
+
+    auto encoded_data = std::make_unique<V[]>(num_elems_to_append);
+    for (size_t i = 0; i < num_elems_to_append; ++i) {
+      size_t ri = replicating ? 0 : i;
+      encoded_data.get()[i] = encodeDataAndUpdateStats(unencoded_data[ri]);
+    }
+
+    if (offset == -1 || num_elems_ == 0) {
+      num_elems_ += num_elems_to_append;
+      buffer_->append(reinterpret_cast<int8_t*>(encoded_data.get()),
+                      num_elems_to_append * sizeof(V));
+      if (!replicating) {
+        src_data += num_elems_to_append * sizeof(T);
+      }
+    } else {
+      num_elems_ = offset + num_elems_to_append;
+      CHECK(!replicating);
+      CHECK_GE(offset, 0);
+      buffer_->write(reinterpret_cast<int8_t*>(encoded_data.get()),
+                     num_elems_to_append * sizeof(V),
+                     kDiffEncodingHeaderSize + static_cast<size_t>(offset) * sizeof(V));
+    }
+    auto chunk_metadata = std::make_shared<ChunkMetadata>();
+    getMetadata(chunk_metadata);
+    return chunk_metadata;
+  }
+
+  void getMetadata(const std::shared_ptr<ChunkMetadata>& chunkMetadata) override {
+    Encoder::getMetadata(chunkMetadata);  // call on parent class
+    chunkMetadata->fillChunkStats(dataMin, dataMax, has_nulls);
+  }
+
+  // Only called from the executor for synthesized meta-information.
+  std::shared_ptr<ChunkMetadata> getMetadata(const SQLTypeInfo& ti) override {
+    auto chunk_metadata = std::make_shared<ChunkMetadata>(ti, 0, 0, ChunkStats{});
+    chunk_metadata->fillChunkStats(dataMin, dataMax, has_nulls);
+    return chunk_metadata;
+  }
+
+  // Only called from the executor for synthesized meta-information.
+  void updateStats(const int64_t val, const bool is_null) override {
+    if (is_null) {
+      has_nulls = true;
+    } else {
+      const auto data = static_cast<T>(val);
+      dataMin = std::min(dataMin, data);
+      dataMax = std::max(dataMax, data);
+    }
+  }
+
+  // Only called from the executor for synthesized meta-information.
+  void updateStats(const double val, const bool is_null) override {
+    if (is_null) {
+      has_nulls = true;
+    } else {
+      const auto data = static_cast<T>(val);
+      dataMin = std::min(dataMin, data);
+      dataMax = std::max(dataMax, data);
+    }
+  }
+
+  void updateStats(const int8_t* const src_data, const size_t num_elements) override {
+    const T* unencoded_data = reinterpret_cast<const T*>(src_data);
+    for (size_t i = 0; i < num_elements; ++i) {
+      const auto data = unencoded_data[i];
+      if (data == inline_int_null_value<T>()) {
+        has_nulls = true;
+      } else {
+        decimal_overflow_validator_.validate(data);
+        dataMin = std::min(dataMin, data);
+        dataMax = std::max(dataMax, data);
+      }
+    }
+  }
+
+  void updateStats(const std::vector<std::string>* const src_data,
+                   const size_t start_idx,
+                   const size_t num_elements) override {
+    UNREACHABLE();
+  }
+
+  void updateStats(const std::vector<ArrayDatum>* const src_data,
+                   const size_t start_idx,
+                   const size_t num_elements) override {
+    UNREACHABLE();
+  }
+
+  // Only called from the executor for synthesized meta-information.
+  void reduceStats(const Encoder& that) override {
+    const auto that_typed = static_cast<const DiffEncoder<T, V>&>(that);
+    if (that_typed.has_nulls) {
+      has_nulls = true;
+    }
+    dataMin = std::min(dataMin, that_typed.dataMin);
+    dataMax = std::max(dataMax, that_typed.dataMax);
+  }
+
+  void copyMetadata(const Encoder* copyFromEncoder) override {
+    num_elems_ = copyFromEncoder->getNumElems();
+    auto castedEncoder = reinterpret_cast<const DiffEncoder<T, V>*>(copyFromEncoder);
+    dataMin = castedEncoder->dataMin;
+    dataMax = castedEncoder->dataMax;
+    has_nulls = castedEncoder->has_nulls;
+    baseline_ = castedEncoder->baseline_;
+    has_baseline_ = castedEncoder->has_baseline_;
+  }
+
+  void writeMetadata(FILE* f) override {
+    // assumes pointer is already in right place
+    fwrite((int8_t*)&num_elems_, sizeof(size_t), 1, f);
+    fwrite((int8_t*)&dataMin, sizeof(T), 1, f);
+    fwrite((int8_t*)&dataMax, sizeof(T), 1, f);
+    fwrite((int8_t*)&has_nulls, sizeof(bool), 1, f);
+    fwrite((int8_t*)&baseline_, sizeof(int64_t), 1, f);
+    fwrite((int8_t*)&has_baseline_, sizeof(bool), 1, f);
+  }
+
+  void readMetadata(FILE* f) override {
+    // assumes pointer is already in right place
+    fread((int8_t*)&num_elems_, sizeof(size_t), 1, f);
+    fread((int8_t*)&dataMin, sizeof(T), 1, f);
+    fread((int8_t*)&dataMax, sizeof(T), 1, f);
+    fread((int8_t*)&has_nulls, sizeof(bool), 1, f);
+    fread((int8_t*)&baseline_, sizeof(int64_t), 1, f);
+    fread((int8_t*)&has_baseline_, sizeof(bool), 1, f);
+  }
+
+  bool resetChunkStats(const ChunkStats& stats) override {
+    const auto new_min = DatumFetcher::getDatumVal<T>(stats.min);
+    const auto new_max = DatumFetcher::getDatumVal<T>(stats.max);
+
+    if (dataMin == new_min && dataMax == new_max && has_nulls == stats.has_nulls) {
+      return false;
+    }
+
+    dataMin = new_min;
+    dataMax = new_max;
+    has_nulls = stats.has_nulls;
+    return true;
+  }
+
+  void resetChunkStats() override {
+    dataMin = std::numeric_limits<T>::max();
+    dataMax = std::numeric_limits<T>::lowest();
+    has_nulls = false;
+  }
+
+  T dataMin;
+  T dataMax;
+  bool has_nulls;
+
+ private:
+  V encodeDataAndUpdateStats(const T& unencoded_data) {
+    if (unencoded_data == inline_int_null_value<T>()) {
+      has_nulls = true;
+      return inline_int_null_value<V>();
+    }
+    decimal_overflow_validator_.validate(unencoded_data);
+    const auto delta = static_cast<int64_t>(unencoded_data) - baseline_;
+    if (delta <= inline_int_null_value<V>() || delta > std::numeric_limits<V>::max()) {
+      throw std::runtime_error("DIFF encoding overflow: value " +
+                               std::to_string(unencoded_data) + " is out of range of " +
+                               std::to_string(sizeof(V) * 8) +
+                               " bit differences from chunk baseline " +
+                               std::to_string(baseline_));
+    }
+    dataMin = std::min(dataMin, unencoded_data);
+    dataMax = std::max(dataMax, unencoded_data);
+    return static_cast<V>(delta);
+  }
+
+  int64_t baseline_;
+  bool has_baseline_;  // false while the chunk only holds nulls
+};  // class DiffEncoder
+
+#endif  // DIFF_ENCODER_H
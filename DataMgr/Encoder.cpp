@@ -17,10 +17,12 @@
 #include "Encoder.h"
 #include "ArrayNoneEncoder.h"
 #include "DateDaysEncoder.h"
+#include "DiffEncoder.h"
 #include "FixedLengthArrayNoneEncoder.h"
 #include "FixedLengthEncoder.h"
 #include "Logger/Logger.h"
 #include "NoneEncoder.h"
+#include "RunLengthEncoder.h"
 #include "StringNoneEncoder.h"
 
 Encoder* Encoder::Create(Data_Namespace::AbstractBuffer* buffer,
@@ -171,6 +173,69 @@ Encoder* Encoder::Create(Data_Namespace::AbstractBuffer* buffer,
       }  // switch (sqlType)
       break;
     }  // Case: kENCODING_FIXED
+    case kENCODING_RL: {
+      switch (sqlType.get_type()) {
+        case kSMALLINT:
+          return new RunLengthEncoder<int16_t>(buffer);
+        case kINT:
+          return new RunLengthEncoder<int32_t>(buffer);
+        case kBIGINT:
+        case kNUMERIC:
+        case kDECIMAL:
+        case kTIME:
+        case kTIMESTAMP:
+        case kDATE:
+          return new RunLengthEncoder<int64_t>(buffer);
+        default:
+          return 0;
+      }
+      break;
+    }  // Case: kENCODING_RL
+    case kENCODING_DIFF: {
+      switch (sqlType.get_type()) {
+        case kSMALLINT: {
+          switch (sqlType.get_comp_param()) {
+            case 8:
+              return new DiffEncoder<int16_t, int8_t>(buffer);
+            default:
+              return 0;
+          }
+          break;
+        }
+        case kINT: {
+          switch (sqlType.get_comp_param()) {
+            case 8:
+              return new DiffEncoder<int32_t, int8_t>(buffer);
+            case 16:
+              return new DiffEncoder<int32_t, int16_t>(buffer);
+            default:
+              return 0;
+          }
+          break;
+        }
+        case kBIGINT:
+        case kNUMERIC:
+        case kDECIMAL:
+        case kTIME:
+        case kTIMESTAMP:
+        case kDATE: {
+          switch (sqlType.get_comp_param()) {
+            case 8:
+              return new DiffEncoder<int64_t, int8_t>(buffer);
+            case 16:
+              return new DiffEncoder<int64_t, int16_t>(buffer);
+            case 32:
+              return new DiffEncoder<int64_t, int32_t>(buffer);
+            default:
+              return 0;
+          }
+          break;
+        }
+        default:
+          return 0;
+      }
+      break;
+    }  // Case: kENCODING_DIFF
     case kENCODING_DICT: {
       if (sqlType.get_type() == kARRAY) {
         CHECK(IS_STRING(sqlType.get_subtype()));
@@ -22,12 +22,14 @@
 
 #include "DataMgr/FileMgr/FileBuffer.h"
 
+#include <cstring>
 #include <future>
 #include <map>
 #include <thread>
 #include <utility>  // std::pair
 
 #include "DataMgr/FileMgr/FileMgr.h"
+#include "Shared/Compressor.h"
 #include "Shared/File.h"
 #include "Shared/checked_alloc.h"
 
@@ -35,6 +37,22 @@ using namespace std;
 
 namespace File_Namespace {
 
+namespace {
+
+// Scratch buffers of the (de)compression of pages, reused by each thread across pages.
+thread_local std::vector<int8_t> stored_page_scratch;
+thread_local std::vector<int8_t> read_page_scratch;
+thread_local std::vector<int8_t> written_page_scratch;
+
+int8_t* get_scratch_buffer(std::vector<int8_t>& scratch, const size_t size) {
+  if (scratch.size() < size) {
+    scratch.resize(size);
+  }
+  return scratch.data();
+}
+
+}  // namespace
+
 FileBuffer::FileBuffer(FileMgr* fm,
                        const size_t pageSize,
                        const ChunkKey& chunkKey,
@@ -48,7 +66,7 @@ FileBuffer::FileBuffer(FileMgr* fm,
   CHECK(fm_);
   calcHeaderBuffer();
   CHECK_GT(pageSize_, reservedHeaderSize_);
-  pageDataSize_ = pageSize_ - reservedHeaderSize_;
+  calcPageDataSize();
   //@todo reintroduce initialSize - need to develop easy way of
   // differentiating these pre-allocated pages from "written-to" pages
   /*
@@ -76,7 +94,7 @@ FileBuffer::FileBuffer(FileMgr* fm,
     , chunkKey_(chunkKey) {
   CHECK(fm_);
   calcHeaderBuffer();
-  pageDataSize_ = pageSize_ - reservedHeaderSize_;
+  calcPageDataSize();
 }
 
 FileBuffer::FileBuffer(FileMgr* fm,
@@ -137,6 +155,9 @@ void FileBuffer::reserve(const size_t numBytes) {
   for (size_t pageNum = numCurrentPages; pageNum < numPagesRequested; ++pageNum) {
     Page page = addNewMultiPage(epoch);
     writeHeader(page, pageNum, epoch);
+    if (fm_->pageCompressionEnabled()) {
+      writeCompressedPage(page, 0, 0, nullptr);
+    }
   }
 }
 
@@ -150,6 +171,21 @@ void FileBuffer::calcHeaderBuffer() {
   }
 }
 
+void FileBuffer::calcPageDataSize() {
+  pageDataSize_ = pageSize_ - reservedHeaderSize_;
+  if (fm_->pageCompressionEnabled()) {
+    // compressed pages keep the size of their payload right after the header
+    CHECK_GT(pageDataSize_, compressedPageSizeBytes_);
+    pageDataSize_ -= compressedPageSizeBytes_;
+  }
+}
+
+size_t FileBuffer::getPageSourceBytes(const size_t pageNum,
+                                      const size_t bufferSize) const {
+  const size_t pageStart = pageNum * pageDataSize_;
+  return bufferSize > pageStart ? std::min(pageDataSize_, bufferSize - pageStart) : 0;
+}
+
 void FileBuffer::freePage(const Page& page) {
   freePage(page, false);
 }
@@ -228,6 +264,8 @@ void FileBuffer::freePagesBeforeEpoch(const int32_t targetEpoch) {
   }
 }
 
+constexpr size_t kMinPagesPerReaderThread{4};
+
 struct readThreadDS {
   FileMgr* t_fm;       // ptr to FileMgr
   size_t t_startPage;  // start page for the thread
@@ -247,6 +285,21 @@ static size_t readForThread(FileBuffer* fileBuffer, const readThreadDS threadDS)
   size_t totalBytesRead = 0;
   bool isFirstPage = threadDS.t_isFirstPage;
 
+  // Pages which follow each other in the same file are read with a single positioned
+  // read, the page headers in between go to a scratch buffer
+  std::vector<int8_t> headerScratch(fileBuffer->reservedHeaderSize());
+  std::vector<ReadRange> runRanges;
+  FileInfo* runFileInfo = nullptr;
+  size_t runOffset = 0;
+  size_t runNextPageNum = 0;
+  bool runReachesPageEnd = false;
+  auto readRun = [&runRanges, &runFileInfo, &runOffset]() {
+    if (runFileInfo) {
+      runFileInfo->readv(runOffset, runRanges);
+      runRanges.clear();
+    }
+  };
+
   // Traverse the logical pages
   for (size_t pageNum = startPage; pageNum < endPage; ++pageNum) {
     CHECK(threadDS.multiPages[pageNum].pageSize == fileBuffer->pageSize());
@@ -257,24 +310,31 @@ static size_t readForThread(FileBuffer* fileBuffer, const readThreadDS threadDS)
 
     // Read the page into the destination (dst) buffer at its
     // current (cur) location
-    size_t bytesRead = 0;
-    if (isFirstPage) {
-      bytesRead = fileInfo->read(
-          page.pageNum * fileBuffer->pageSize() + threadDS.t_startPageOffset +
-              fileBuffer->reservedHeaderSize(),
-          min(fileBuffer->pageDataSize() - threadDS.t_startPageOffset, bytesLeft),
-          curPtr);
-      isFirstPage = false;
+    const size_t pageOffset = isFirstPage ? threadDS.t_startPageOffset : 0;
+    const size_t bytesToRead = min(fileBuffer->pageDataSize() - pageOffset, bytesLeft);
+    isFirstPage = false;
+    if (threadDS.t_fm->pageCompressionEnabled()) {
+      // compressed pages have variable size and are read one at a time
+      fileBuffer->readCompressedPage(page, pageOffset, bytesToRead, curPtr);
     } else {
-      bytesRead = fileInfo->read(
-          page.pageNum * fileBuffer->pageSize() + fileBuffer->reservedHeaderSize(),
-          min(fileBuffer->pageDataSize(), bytesLeft),
-          curPtr);
+      if (fileInfo == runFileInfo && page.pageNum == runNextPageNum &&
+          runReachesPageEnd) {
+        runRanges.push_back({headerScratch.data(), headerScratch.size()});
+      } else {
+        readRun();
+        runFileInfo = fileInfo;
+        runOffset = page.pageNum * fileBuffer->pageSize() +
+                    fileBuffer->reservedHeaderSize() + pageOffset;
+      }
+      runRanges.push_back({curPtr, bytesToRead});
+      runNextPageNum = page.pageNum + 1;
+      runReachesPageEnd = pageOffset + bytesToRead == fileBuffer->pageDataSize();
     }
-    curPtr += bytesRead;
-    bytesLeft -= bytesRead;
-    totalBytesRead += bytesRead;
+    curPtr += bytesToRead;
+    bytesLeft -= bytesToRead;
+    totalBytesRead += bytesToRead;
   }
+  readRun();
   CHECK(bytesLeft == 0);
 
   return (totalBytesRead);
@@ -311,7 +371,11 @@ void FileBuffer::read(int8_t* const dst,
   size_t bytesRead = 0;               // total number of bytes already being read
   size_t bytesLeftForThread = 0;      // number of bytes to be read in the thread
   size_t numExtraPages = 0;  // extra pages to be assigned one per thread as needed
-  size_t numThreads = fm_->getNumReaderThreads();
+  // every reader thread gets a few pages to coalesce into large reads, small reads don't
+  // spawn threads
+  size_t numThreads = std::max(
+      size_t(1),
+      std::min(fm_->getNumReaderThreads(), numPagesToRead / kMinPagesPerReaderThread));
   std::vector<readThreadDS>
       threadDSArr;  // array of threadDS, needed to avoid racing conditions
 
@@ -403,6 +467,98 @@ void FileBuffer::copyPage(Page& srcPage,
   free(buffer);
 }
 
+size_t FileBuffer::readCompressedPage(const Page& page,
+                                      const size_t offset,
+                                      const size_t numBytes,
+                                      int8_t* dst) {
+  CHECK_LE(offset + numBytes, pageDataSize_);
+  FileInfo* fileInfo = fm_->getFileInfoForFileId(page.fileId);
+  CHECK(fileInfo);
+  const size_t storedPageOffset = page.pageNum * pageSize_ + reservedHeaderSize_;
+  uint32_t storedSize{0};
+  fileInfo->read(
+      storedPageOffset, compressedPageSizeBytes_, reinterpret_cast<int8_t*>(&storedSize));
+  CHECK_LE(storedSize, pageDataSize_);
+  if (storedSize == pageDataSize_) {
+    // the page didn't compress and is stored as is
+    return fileInfo->read(
+        storedPageOffset + compressedPageSizeBytes_ + offset, numBytes, dst);
+  }
+  auto storedData = get_scratch_buffer(stored_page_scratch, storedSize);
+  size_t bytesRead =
+      fileInfo->read(storedPageOffset + compressedPageSizeBytes_, storedSize, storedData);
+  CHECK_EQ(bytesRead, storedSize);
+  auto compressor = BloscCompressor::getCompressor();
+  if (offset == 0 && numBytes == pageDataSize_) {
+    compressor->decompress(reinterpret_cast<const uint8_t*>(storedData),
+                           reinterpret_cast<uint8_t*>(dst),
+                           pageDataSize_);
+    return numBytes;
+  }
+  auto pageData = get_scratch_buffer(read_page_scratch, pageDataSize_);
+  compressor->decompress(reinterpret_cast<const uint8_t*>(storedData),
+                         reinterpret_cast<uint8_t*>(pageData),
+                         pageDataSize_);
+  std::memcpy(dst, pageData + offset, numBytes);
+  return numBytes;
+}
+
+size_t FileBuffer::writeCompressedPage(const Page& page,
+                                       const size_t offset,
+                                       const size_t numBytes,
+                                       const int8_t* src,
+                                       const Page* sourcePage,
+                                       const size_t sourceBytes) {
+  CHECK_LE(offset + numBytes, pageDataSize_);
+  auto pageData = get_scratch_buffer(written_page_scratch, pageDataSize_);
+  std::memset(pageData, 0, pageDataSize_);
+  if (sourcePage && sourceBytes > 0 && (offset > 0 || offset + numBytes < sourceBytes)) {
+    readCompressedPage(*sourcePage, 0, sourceBytes, pageData);
+  }
+  if (numBytes > 0) {
+    std::memcpy(pageData + offset, src, numBytes);
+  }
+
+  auto compressor = BloscCompressor::getCompressor();
+  const size_t storedPageSize =
+      compressedPageSizeBytes_ + compressor->getScratchSpaceSize(pageDataSize_);
+  auto storedPage = get_scratch_buffer(stored_page_scratch, storedPageSize);
+  int8_t* storedData = storedPage + compressedPageSizeBytes_;
+  uint32_t storedSize = pageDataSize_;
+  try {
+    const auto compressedSize =
+        compressor->compress(reinterpret_cast<const uint8_t*>(pageData),
+                             pageDataSize_,
+                             reinterpret_cast<uint8_t*>(storedData),
+                             storedPageSize - compressedPageSizeBytes_,
+                             0);
+    if (static_cast<size_t>(compressedSize) < pageDataSize_) {
+      storedSize = compressedSize;
+    }
+  } catch (const CompressionFailedError& e) {
+    VLOG(1) << "Storing page " << page.pageNum << " of " << show_chunk(chunkKey_)
+            << " uncompressed: " << e.what();
+  }
+  if (storedSize == pageDataSize_) {
+    std::memcpy(storedData, pageData, pageDataSize_);
+  }
+  std::memcpy(storedPage, &storedSize, compressedPageSizeBytes_);
+
+  FileInfo* fileInfo = fm_->getFileInfoForFileId(page.fileId);
+  CHECK(fileInfo);
+  const size_t storedPageOffset = page.pageNum * pageSize_ + reservedHeaderSize_;
+  size_t bytesWritten = fileInfo->write(
+      storedPageOffset, compressedPageSizeBytes_ + storedSize, storedPage);
+  CHECK_EQ(bytesWritten, compressedPageSizeBytes_ + storedSize);
+  if (storedSize < pageDataSize_) {
+    // the rest of the page slot holds no data, release its disk blocks which a previous
+    // version of the slot may have filled
+    fileInfo->punchHole(storedPageOffset + compressedPageSizeBytes_ + storedSize,
+                        pageDataSize_ - storedSize);
+  }
+  return numBytes;
+}
+
 Page FileBuffer::addNewMultiPage(const int32_t epoch) {
   Page page = fm_->requestFreePage(pageSize_, false);
   MultiPage multiPage(pageSize_);
@@ -500,22 +656,41 @@ void FileBuffer::append(int8_t* src,
   size_t bytesLeft = numBytes;
   int8_t* curPtr = src;  // a pointer to the current location in dst being written to
   size_t initialNumPages = multiPages_.size();
+  const size_t initialSize = size_;
   size_ = size_ + numBytes;
   auto epoch = getFileMgrEpoch();
   for (size_t pageNum = startPage; pageNum < startPage + numPagesToWrite; ++pageNum) {
     Page page;
+    Page sourcePage;  // holds the unchanged content of a compressed page
     if (pageNum >= initialNumPages) {
       page = addNewMultiPage(epoch);
       writeHeader(page, pageNum, epoch);
+    } else if (fm_->pageCompressionEnabled() &&
+               multiPages_[pageNum].current().epoch < epoch) {
+      // recompressing rewrites the whole page, so a checkpointed page gets a new version
+      // at the current epoch to stay intact for rollbacks
+      sourcePage = multiPages_[pageNum].current().page;
+      page = fm_->requestFreePage(pageSize_, false);
+      multiPages_[pageNum].push(page, epoch);
+      writeHeader(page, pageNum, epoch);
     } else {
       // we already have a new page at current
       // epoch for this page - just grab this page
       page = multiPages_[pageNum].current().page;
+      sourcePage = page;
     }
     CHECK(page.fileId >= 0);  // make sure page was initialized
     FileInfo* fileInfo = fm_->getFileInfoForFileId(page.fileId);
     size_t bytesWritten;
-    if (pageNum == startPage) {
+    if (fm_->pageCompressionEnabled()) {
+      const size_t pageOffset = pageNum == startPage ? startPageOffset : 0;
+      bytesWritten = writeCompressedPage(page,
+                                         pageOffset,
+                                         min(pageDataSize_ - pageOffset, bytesLeft),
+                                         curPtr,
+                                         &sourcePage,
+                                         getPageSourceBytes(pageNum, initialSize));
+    } else if (pageNum == startPage) {
       bytesWritten = fileInfo->write(
           page.pageNum * pageSize_ + startPageOffset + reservedHeaderSize_,
           min(pageDataSize_ - startPageOffset, bytesLeft),
@@ -539,6 +714,7 @@ void FileBuffer::write(int8_t* src,
   CHECK(srcBufferType == CPU_LEVEL) << "Unsupported Buffer type";
 
   bool tempIsAppended = false;
+  const size_t initialSize = size_;
   setDirty();
   if (offset < size_) {
     setUpdated();
@@ -564,10 +740,14 @@ void FileBuffer::write(int8_t* src,
     for (size_t pageNum = initialNumPages; pageNum < startPage; ++pageNum) {
       Page page = addNewMultiPage(epoch);
       writeHeader(page, pageNum, epoch);
+      if (fm_->pageCompressionEnabled()) {
+        writeCompressedPage(page, 0, 0, nullptr);
+      }
     }
   }
   for (size_t pageNum = startPage; pageNum < startPage + numPagesToWrite; ++pageNum) {
     Page page;
+    Page sourcePage;  // holds the unchanged content of a compressed page
     if (pageNum >= initialNumPages) {
       page = addNewMultiPage(epoch);
       writeHeader(page, pageNum, epoch);
@@ -578,29 +758,43 @@ void FileBuffer::write(int8_t* src,
       Page lastPage = multiPages_[pageNum].current().page;
       page = fm_->requestFreePage(pageSize_, false);
       multiPages_[pageNum].push(page, epoch);
-      if (pageNum == startPage && startPageOffset > 0) {
-        // copyPage takes care of header offset so don't worry
-        // about it
-        copyPage(lastPage, page, startPageOffset, 0);
-      }
-      if (pageNum == (startPage + numPagesToWrite - 1) &&
-          bytesLeft > 0) {  // bytesLeft should always > 0
-        copyPage(lastPage,
-                 page,
-                 pageDataSize_ - bytesLeft,
-                 bytesLeft);  // these would be empty if we're appending but we won't
-                              // worry about it right now
+      if (fm_->pageCompressionEnabled()) {
+        // the whole page is recompressed from the previous version
+        sourcePage = lastPage;
+      } else {
+        if (pageNum == startPage && startPageOffset > 0) {
+          // copyPage takes care of header offset so don't worry
+          // about it
+          copyPage(lastPage, page, startPageOffset, 0);
+        }
+        if (pageNum == (startPage + numPagesToWrite - 1) &&
+            bytesLeft > 0) {  // bytesLeft should always > 0
+          copyPage(lastPage,
+                   page,
+                   pageDataSize_ - bytesLeft,
+                   bytesLeft);  // these would be empty if we're appending but we
+                                // won't worry about it right now
+        }
       }
       writeHeader(page, pageNum, epoch);
     } else {
       // we already have a new page at current
       // epoch for this page - just grab this page
       page = multiPages_[pageNum].current().page;
+      sourcePage = page;
     }
     CHECK(page.fileId >= 0);  // make sure page was initialized
     FileInfo* fileInfo = fm_->getFileInfoForFileId(page.fileId);
     size_t bytesWritten;
-    if (pageNum == startPage) {
+    if (fm_->pageCompressionEnabled()) {
+      const size_t pageOffset = pageNum == startPage ? startPageOffset : 0;
+      bytesWritten = writeCompressedPage(page,
+                                         pageOffset,
+                                         min(pageDataSize_ - pageOffset, bytesLeft),
+                                         curPtr,
+                                         &sourcePage,
+                                         getPageSourceBytes(pageNum, initialSize));
+    } else if (pageNum == startPage) {
       bytesWritten = fileInfo->write(
           page.pageNum * pageSize_ + startPageOffset + reservedHeaderSize_,
           min(pageDataSize_ - startPageOffset, bytesLeft),
@@ -637,7 +831,7 @@ std::string FileBuffer::dump() const {
 void FileBuffer::initMetadataAndPageDataSize() {
   CHECK(metadataPages_.current().page.fileId != -1);  // was initialized
   readMetadata(metadataPages_.current().page);
-  pageDataSize_ = pageSize_ - reservedHeaderSize_;
+  calcPageDataSize();
 }
 
 bool FileBuffer::isMissingPages() const {
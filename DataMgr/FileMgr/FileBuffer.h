@@ -119,6 +119,31 @@ class FileBuffer : public AbstractBuffer {
                 Page& destPage,
                 const size_t numBytes,
                 const size_t offset = 0);
+
+  /**
+   * @brief Reads numBytes at the given offset of the data portion of a compressed page.
+   *
+   * Compressed pages store the size of their payload in front of the data, a payload as
+   * large as the data portion of the page is stored uncompressed.
+   */
+  size_t readCompressedPage(const Page& page,
+                            const size_t offset,
+                            const size_t numBytes,
+                            int8_t* dst);
+
+  /**
+   * @brief Writes numBytes at the given offset of the data portion of a compressed page.
+   *
+   * The whole page is recompressed. The first sourceBytes of sourcePage, if given,
+   * provide the page content that is not overwritten. The page keeps its slot in the
+   * data file, the disk blocks of the slot past the stored bytes are released.
+   */
+  size_t writeCompressedPage(const Page& page,
+                             const size_t offset,
+                             const size_t numBytes,
+                             const int8_t* src,
+                             const Page* sourcePage = nullptr,
+                             const size_t sourceBytes = 0);
   inline Data_Namespace::MemoryLevel getType() const override { return DISK_LEVEL; }
 
   /// Not implemented for FileMgr -- throws a runtime_error
@@ -164,6 +189,7 @@ class FileBuffer : public AbstractBuffer {
   void freePage(const Page& page);
 
   static constexpr size_t headerBufferOffset_ = 32;
+  static constexpr size_t compressedPageSizeBytes_ = sizeof(uint32_t);
 
  private:
   // FileBuffer(const FileBuffer&);      // private copy constructor
@@ -180,6 +206,8 @@ class FileBuffer : public AbstractBuffer {
   void writeMetadata(const int32_t epoch);
   void readMetadata(const Page& page);
   void calcHeaderBuffer();
+  void calcPageDataSize();
+  size_t getPageSourceBytes(const size_t pageNum, const size_t bufferSize) const;
 
   void freePage(const Page& page, const bool isRolloff);
   void freePagesBeforeEpochForMultiPage(MultiPage& multiPage,
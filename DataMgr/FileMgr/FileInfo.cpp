@@ -50,6 +50,8 @@ void FileInfo::initNewFile() {
 
   int32_t headerSize = 0;
   int8_t* headerSizePtr = (int8_t*)(&headerSize);
+  std::lock_guard<std::mutex> lock(readWriteMutex_);
+  hasUnflushedWrites_ = true;
   for (size_t pageId = 0; pageId < numPages; ++pageId) {
     File_Namespace::write(f, pageId * pageSize, sizeof(int32_t), headerSizePtr);
     freePages.insert(pageId);
@@ -60,12 +62,41 @@ void FileInfo::initNewFile() {
 size_t FileInfo::write(const size_t offset, const size_t size, const int8_t* buf) {
   std::lock_guard<std::mutex> lock(readWriteMutex_);
   isDirty = true;
+  // set before writing, so that a concurrent readv() waits for the write and flushes it
+  hasUnflushedWrites_ = true;
   return File_Namespace::write(f, offset, size, buf);
 }
 
+void FileInfo::punchHole(const size_t offset, const size_t size) {
+  std::lock_guard<std::mutex> lock(readWriteMutex_);
+  // buffered writes to the range would fill the hole again when flushed
+  if (fflush(f) != 0) {
+    LOG(FATAL) << "Error trying to flush changes to disk, the error was: "
+               << std::strerror(errno);
+  }
+  hasUnflushedWrites_ = false;
+  File_Namespace::punchHole(f, offset, size);
+}
+
 size_t FileInfo::read(const size_t offset, const size_t size, int8_t* buf) {
+  return readv(offset, {{buf, size}});
+}
+
+size_t FileInfo::readv(const size_t offset, const std::vector<ReadRange>& ranges) {
+  if (hasUnflushedWrites_) {
+    // positioned reads bypass the buffer of the file stream
+    std::lock_guard<std::mutex> lock(readWriteMutex_);
+    if (fflush(f) != 0) {
+      LOG(FATAL) << "Error trying to flush changes to disk, the error was: "
+                 << std::strerror(errno);
+    }
+    hasUnflushedWrites_ = false;
+  }
+#ifdef _WIN32
+  // reads go through the position of the file stream
   std::lock_guard<std::mutex> lock(readWriteMutex_);
-  return File_Namespace::read(f, offset, size, buf);
+#endif
+  return File_Namespace::readv(f, offset, ranges);
 }
 
 void FileInfo::openExistingFile(std::vector<HeaderInfo>& headerVec) {
@@ -181,6 +212,7 @@ void FileInfo::freePage(int pageId, const bool isRolloff, int32_t epoch) {
   if (isRolloff) {
     epoch_freed_page[0] = ROLLOFF_CONTINGENT;
   }
+  hasUnflushedWrites_ = true;
   File_Namespace::write(f,
                         pageId * pageSize + sizeof(int32_t),
                         sizeof(epoch_freed_page),
@@ -242,8 +274,14 @@ void FileInfo::freePageImmediate(int32_t page_num) {
   // protecting from RO trying to write
   if (!g_read_only) {
     int32_t zero{0};
-    File_Namespace::write(
-        f, page_num * pageSize, sizeof(int32_t), reinterpret_cast<const int8_t*>(&zero));
+    {
+      std::lock_guard<std::mutex> lock(readWriteMutex_);
+      hasUnflushedWrites_ = true;
+      File_Namespace::write(f,
+                            page_num * pageSize,
+                            sizeof(int32_t),
+                            reinterpret_cast<const int8_t*>(&zero));
+    }
     freePageDeferred(page_num);
   }
 }
@@ -254,6 +292,8 @@ void FileInfo::recoverPage(const ChunkKey& chunk_key, int32_t page_num) {
   // as it seems we are no guaranteed to have f/synced so
   // protecting from RO trying to write
   if (!g_read_only) {
+    std::lock_guard<std::mutex> lock(readWriteMutex_);
+    hasUnflushedWrites_ = true;
     File_Namespace::write(f,
                           page_num * pageSize + sizeof(int32_t),
                           2 * sizeof(int32_t),
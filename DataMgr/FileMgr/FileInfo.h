@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 #include <mutex>
@@ -25,6 +26,7 @@
 #include <fcntl.h>
 #endif
 
+#include "../../Shared/File.h"
 #include "../../Shared/types.h"
 #include "Logger/Logger.h"
 #include "OSDependent/omnisci_fs.h"
@@ -62,6 +64,9 @@ struct FileInfo {
   std::set<size_t> freePages;  /// set of page numbers of free pages
   std::mutex freePagesMutex_;
   std::mutex readWriteMutex_;
+  // Set under readWriteMutex_ before every write to the file stream and cleared by
+  // readv() after flushing the stream
+  std::atomic<bool> hasUnflushedWrites_{false};
 
   /// Constructor
   FileInfo(FileMgr* fileMgr,
@@ -83,6 +88,11 @@ struct FileInfo {
   int32_t getFreePage();
   size_t write(const size_t offset, const size_t size, const int8_t* buf);
   size_t read(const size_t offset, const size_t size, int8_t* buf);
+  /// Releases the disk blocks of the byte range, see File_Namespace::punchHole.
+  void punchHole(const size_t offset, const size_t size);
+  /// Reads consecutive bytes from offset into the ranges. Reads don't lock the file, they
+  /// only flush the writes buffered by the file stream.
+  size_t readv(const size_t offset, const std::vector<ReadRange>& ranges);
 
   void openExistingFile(std::vector<HeaderInfo>& headerVec);
   /// Prints a summary of the file to stdout
@@ -42,6 +42,8 @@
 
 using namespace std;
 
+bool g_enable_page_compression{false};
+
 namespace File_Namespace {
 
 FileMgr::FileMgr(const int32_t deviceId,
@@ -50,11 +52,13 @@ FileMgr::FileMgr(const int32_t deviceId,
                  const int32_t maxRollbackEpochs,
                  const size_t num_reader_threads,
                  const int32_t epoch,
-                 const size_t defaultPageSize)
+                 const size_t defaultPageSize,
+                 const bool pageCompression)
     : AbstractBufferMgr(deviceId)
     , maxRollbackEpochs_(maxRollbackEpochs)
     , defaultPageSize_(defaultPageSize)
     , nextFileId_(0)
+    , pageCompressionEnabled_(pageCompression)
     , gfm_(gfm)
     , fileMgrKey_(fileMgrKey) {
   init(num_reader_threads, epoch);
@@ -138,6 +142,8 @@ bool FileMgr::coreInit() {
     }
     migrateToLatestFileMgrVersion();
     openAndReadEpochFile(EPOCH_FILENAME);
+    pageCompressionEnabled_ =
+        readVersionFromDisk(PAGE_FORMAT_FILENAME) == COMPRESSED_PAGE_FORMAT;
     return true;
   }
   return false;
@@ -310,6 +316,9 @@ void FileMgr::init(const size_t num_reader_threads, const int32_t epochOverride)
     }
     createEpochFile(EPOCH_FILENAME);
     writeAndSyncVersionToDisk(FILE_MGR_VERSION_FILENAME, fileMgrVersion_);
+    if (pageCompressionEnabled_) {
+      writeAndSyncVersionToDisk(PAGE_FORMAT_FILENAME, COMPRESSED_PAGE_FORMAT);
+    }
     incrementEpoch();
   }
 
@@ -43,6 +43,8 @@
 
 using namespace Data_Namespace;
 
+extern bool g_enable_page_compression;
+
 namespace File_Namespace {
 class GlobalFileMgr;  // forward declaration
 /**
@@ -156,7 +158,8 @@ class FileMgr : public AbstractBufferMgr {  // implements
           const int32_t max_rollback_epochs = -1,
           const size_t num_reader_threads = 0,
           const int32_t epoch = -1,
-          const size_t defaultPageSize = DEFAULT_PAGE_SIZE);
+          const size_t defaultPageSize = DEFAULT_PAGE_SIZE,
+          const bool pageCompression = false);
 
   // used only to initialize enough to drop or to get basic metadata
   FileMgr(const int32_t deviceId,
@@ -304,6 +307,15 @@ class FileMgr : public AbstractBufferMgr {  // implements
    */
   inline size_t getNumReaderThreads() { return num_reader_threads_; }
 
+  /**
+   * @brief True if the data pages of the table are stored Blosc compressed. The page
+   * format is chosen when the table directory is created, from the COMPRESSION option of
+   * the table, and never changes afterwards.
+   *
+   * @see FileBuffer::writeCompressedPage
+   */
+  inline bool pageCompressionEnabled() const { return pageCompressionEnabled_; }
+
   /**
    * @brief Returns FILE pointer associated with
    * requested fileId
@@ -377,7 +389,9 @@ class FileMgr : public AbstractBufferMgr {  // implements
   static constexpr char EPOCH_FILENAME[] = "epoch_metadata";
   static constexpr char DB_META_FILENAME[] = "dbmeta";
   static constexpr char FILE_MGR_VERSION_FILENAME[] = "filemgr_version";
+  static constexpr char PAGE_FORMAT_FILENAME[] = "page_format";
   static constexpr int32_t INVALID_VERSION = -1;
+  static constexpr int32_t COMPRESSED_PAGE_FORMAT = 1;
 
  protected:
   // Used to initialize CachingFileMgr.
@@ -396,6 +410,7 @@ class FileMgr : public AbstractBufferMgr {  // implements
                          /// GlobalFileMgr::omnisci_db_version_
   int32_t fileMgrVersion_;
   const int32_t latestFileMgrVersion_{1};
+  bool pageCompressionEnabled_{false};
   FILE* DBMetaFile_ = nullptr;  /// pointer to DB level metadata
   std::mutex getPageMutex_;
   mutable mapd_shared_mutex chunkIndexMutex_;
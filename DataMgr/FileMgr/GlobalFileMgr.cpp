@@ -169,7 +169,8 @@ void GlobalFileMgr::setFileMgrParams(const int32_t db_id,
       max_rollback_epochs,
       num_reader_threads_,
       file_mgr_params.epoch != -1 ? file_mgr_params.epoch : epoch_,
-      defaultPageSize_);
+      defaultPageSize_,
+      file_mgr_params.page_compression);
   CHECK(ownedFileMgrs_.insert(std::make_pair(file_mgr_key, s)).second);
   CHECK(allFileMgrs_.insert(std::make_pair(file_mgr_key, s.get())).second);
   max_rollback_epochs_per_table_[{db_id, tb_id}] = max_rollback_epochs;
@@ -209,7 +210,8 @@ AbstractBufferMgr* GlobalFileMgr::getFileMgr(const int32_t db_id, const int32_t
                                          max_rollback_epochs,
                                          num_reader_threads_,
                                          epoch_,
-                                         defaultPageSize_);
+                                         defaultPageSize_,
+                                         g_enable_page_compression);
       CHECK(ownedFileMgrs_.insert(std::make_pair(file_mgr_key, s)).second);
       CHECK(allFileMgrs_.insert(std::make_pair(file_mgr_key, s.get())).second);
       return s.get();
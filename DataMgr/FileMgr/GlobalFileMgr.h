@@ -43,9 +43,10 @@ using namespace Data_Namespace;
 namespace File_Namespace {
 
 struct FileMgrParams {
-  FileMgrParams() : epoch(-1), max_rollback_epochs(-1) {}
+  FileMgrParams() : epoch(-1), max_rollback_epochs(-1), page_compression(false) {}
   int32_t epoch;
   int32_t max_rollback_epochs;
+  bool page_compression;  // only used when the table directory is created
 };
 
 /**
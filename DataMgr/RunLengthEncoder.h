@@ -0,0 +1,274 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef RUN_LENGTH_ENCODER_H
+#define RUN_LENGTH_ENCODER_H
+
+#include "Logger/Logger.h"
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "AbstractBuffer.h"
+#include "Encoder.h"
+
+#include <Shared/DatumFetchers.h>
+
+// A run length encoded chunk starts with a 64-bit run count followed by the runs,
+// sorted by row position. Each run stores the (sign-extended) value and the exclusive
+// end row of the run, so the row at position `pos` is found with a binary search over
+// the run ends. Runs are fixed-size to keep the layout random-accessible from generated
+// code (see `run_length_int_decode` in QueryEngine/DecodersImpl.h).
+struct RunLengthEncodedRun {
+  int64_t value;
+  int64_t end;
+};
+
+constexpr size_t kRunLengthEncodingHeaderSize = sizeof(int64_t);
+
+// Decodes all the rows of a run length encoded chunk buffer.
+inline std::vector<int64_t> run_length_decode_all(const int8_t* buf,
+                                                  const size_t num_bytes) {
+  std::vector<int64_t> values;
+  if (num_bytes < kRunLengthEncodingHeaderSize) {
+    return values;
+  }
+  const auto run_count = *reinterpret_cast<const int64_t*>(buf);
+  CHECK_EQ(num_bytes,
+           kRunLengthEncodingHeaderSize + run_count * sizeof(RunLengthEncodedRun));
+  const auto runs =
+      reinterpret_cast<const RunLengthEncodedRun*>(buf + kRunLengthEncodingHeaderSize);
+  if (run_count) {
+    values.reserve(runs[run_count - 1].end);
+  }
+  int64_t start = 0;
+  for (int64_t i = 0; i < run_count; ++i) {
+    CHECK_GT(runs[i].end, start);
+    values.insert(values.end(), runs[i].end - start, runs[i].value);
+    start = runs[i].end;
+  }
+  return values;
+}
+
+template <typename T>
+class RunLengthEncoder : public Encoder {
+ public:
+  RunLengthEncoder(Data_Namespace::AbstractBuffer* buffer) : Encoder(buffer) {
+    resetChunkStats();
+  }
+
+  std::shared_ptr<ChunkMetadata> appendData(int8_t*& src_data,
+                                            const size_t num_elems_to_append,
+                                            const SQLTypeInfo&,
+                                            const bool replicating = false,
+                                            const int64_t offset = -1) override {
+    if (offset == 0 && num_elems_to_append >= num_elems_) {
+      // rewriting the entire chunk, drop the existing runs
+      resetChunkStats();
+      num_elems_ = 0;
+      buffer_->setSize(0);
+    } else if (offset != -1) {
+      throw std::runtime_error(
+          "Partial rewrite of RL (run length) encoded chunks is not supported.");
+    }
+
+    // Continue the last run of the chunk if the first appended value matches it.
+    RunLengthEncodedRun last_run{0, 0};
+    const bool has_last_run = num_elems_ > 0;
+    if (has_last_run) {
+      CHECK_GE(buffer_->size(),
+               kRunLengthEncodingHeaderSize + sizeof(RunLengthEncodedRun));
+      buffer_->read(reinterpret_cast<int8_t*>(&last_run),
+                    sizeof(RunLengthEncodedRun),
+                    buffer_->size() - sizeof(RunLengthEncodedRun));
+      CHECK_EQ(static_cast<size_t>(last_run.end), num_elems_);
+    }
+    bool last_run_extended = false;
+
+    const T* unencoded_data = reinterpret_cast<const T*>(src_data);
+    std::vector<RunLengthEncodedRun> new_runs;
+    int64_t row = num_elems_;
+    for (size_t i = 0; i < num_elems_to_append; ++i, ++row) {
+      const size_t ri = replicating ? 0 : i;
+      const auto data =
+          static_cast<int64_t>(validateDataAndUpdateStats(unencoded_data[ri]));
+      if (!new_runs.empty()) {
+        if (new_runs.back().value == data) {
+          new_runs.back().end = row + 1;
+          continue;
+        }
+      } else if (has_last_run && last_run.value == data) {
+        last_run.end = row + 1;
+        last_run_extended = true;
+        continue;
+      }
+      new_runs.push_back({data, row + 1});
+    }
+
+    if (last_run_extended) {
+      buffer_->write(reinterpret_cast<int8_t*>(&last_run),
+                     sizeof(RunLengthEncodedRun),
+                     buffer_->size() - sizeof(RunLengthEncodedRun));
+    }
+    if (!new_runs.empty()) {
+      int64_t run_count = new_runs.size();
+      if (buffer_->size() == 0) {
+        buffer_->append(reinterpret_cast<int8_t*>(&run_count),
+                        kRunLengthEncodingHeaderSize);
+      } else {
+        run_count += (buffer_->size() - kRunLengthEncodingHeaderSize) /
+                     sizeof(RunLengthEncodedRun);
+        buffer_->write(
+            reinterpret_cast<int8_t*>(&run_count), kRunLengthEncodingHeaderSize, 0);
+      }
+      buffer_->append(reinterpret_cast<int8_t*>(new_runs.data()),
+                      new_runs.size() * sizeof(RunLengthEncodedRun));
+    }
+    num_elems_ += num_elems_to_append;
+    if (!replicating) {
+      src_data += num_elems_to_append * sizeof(T);
+    }
+
+    auto chunk_metadata = std::make_shared<ChunkMetadata>();
+    getMetadata(chunk_metadata);
+    return chunk_metadata;
+  }
+
+  void getMetadata(const std::shared_ptr<ChunkMetadata>& chunkMetadata) override {
+    Encoder::getMetadata(chunkMetadata);  // call on parent class
+    chunkMetadata->fillChunkStats(dataMin, dataMax, has_nulls);
+  }
+
+  // Only called from the executor for synthesized meta-information.
+  std::shared_ptr<ChunkMetadata> getMetadata(const SQLTypeInfo& ti) override {
+    auto chunk_metadata = std::make_shared<ChunkMetadata>(ti, 0, 0, ChunkStats{});
+    chunk_metadata->fillChunkStats(dataMin, dataMax, has_nulls);
+    return chunk_metadata;
+  }
+
+  // Only called from the executor for synthesized meta-information.
+  void updateStats(const int64_t val, const bool is_null) override {
+    if (is_null) {
+      has_nulls = true;
+    } else {
+      const auto data = static_cast<T>(val);
+      dataMin = std::min(dataMin, data);
+      dataMax = std::max(dataMax, data);
+    }
+  }
+
+  // Only called from the executor for synthesized meta-information.
+  void updateStats(const double val, const bool is_null) override {
+    if (is_null) {
+      has_nulls = true;
+    } else {
+      const auto data = static_cast<T>(val);
+      dataMin = std::min(dataMin, data);
+      dataMax = std::max(dataMax, data);
+    }
+  }
+
+  void updateStats(const int8_t* const src_data, const size_t num_elements) override {
+    const T* unencoded_data = reinterpret_cast<const T*>(src_data);
+    for (size_t i = 0; i < num_elements; ++i) {
+      validateDataAndUpdateStats(unencoded_data[i]);
+    }
+  }
+
+  void updateStats(const std::vector<std::string>* const src_data,
+                   const size_t start_idx,
+                   const size_t num_elements) override {
+    UNREACHABLE();
+  }
+
+  void updateStats(const std::vector<ArrayDatum>* const src_data,
+                   const size_t start_idx,
+                   const size_t num_elements) override {
+    UNREACHABLE();
+  }
+
+  // Only called from the executor for synthesized meta-information.
+  void reduceStats(const Encoder& that) override {
+    const auto that_typed = static_cast<const RunLengthEncoder<T>&>(that);
+    if (that_typed.has_nulls) {
+      has_nulls = true;
+    }
+    dataMin = std::min(dataMin, that_typed.dataMin);
+    dataMax = std::max(dataMax, that_typed.dataMax);
+  }
+
+  void copyMetadata(const Encoder* copyFromEncoder) override {
+    num_elems_ = copyFromEncoder->getNumElems();
+    auto castedEncoder = reinterpret_cast<const RunLengthEncoder<T>*>(copyFromEncoder);
+    dataMin = castedEncoder->dataMin;
+    dataMax = castedEncoder->dataMax;
+    has_nulls = castedEncoder->has_nulls;
+  }
+
+  void writeMetadata(FILE* f) override {
+    // assumes pointer is already in right place
+    fwrite((int8_t*)&num_elems_, sizeof(size_t), 1, f);
+    fwrite((int8_t*)&dataMin, sizeof(T), 1, f);
+    fwrite((int8_t*)&dataMax, sizeof(T), 1, f);
+    fwrite((int8_t*)&has_nulls, sizeof(bool), 1, f);
+  }
+
+  void readMetadata(FILE* f) override {
+    // assumes pointer is already in right place
+    fread((int8_t*)&num_elems_, sizeof(size_t), 1, f);
+    fread((int8_t*)&dataMin, sizeof(T), 1, f);
+    fread((int8_t*)&dataMax, sizeof(T), 1, f);
+    fread((int8_t*)&has_nulls, sizeof(bool), 1, f);
+  }
+
+  bool resetChunkStats(const ChunkStats& stats) override {
+    const auto new_min = DatumFetcher::getDatumVal<T>(stats.min);
+    const auto new_max = DatumFetcher::getDatumVal<T>(stats.max);
+
+    if (dataMin == new_min && dataMax == new_max && has_nulls == stats.has_nulls) {
+      return false;
+    }
+
+    dataMin = new_min;
+    dataMax = new_max;
+    has_nulls = stats.has_nulls;
+    return true;
+  }
+
+  void resetChunkStats() override {
+    dataMin = std::numeric_limits<T>::max();
+    dataMax = std::numeric_limits<T>::lowest();
+    has_nulls = false;
+  }
+
+  T dataMin;
+  T dataMax;
+  bool has_nulls;
+
+ private:
+  T validateDataAndUpdateStats(const T& unencoded_data) {
+    if (unencoded_data == inline_int_null_value<T>()) {
+      has_nulls = true;
+    } else {
+      decimal_overflow_validator_.validate(unencoded_data);
+      dataMin = std::min(dataMin, unencoded_data);
+      dataMax = std::max(dataMax, unencoded_data);
+    }
+    return unencoded_data;
+  }
+};  // class RunLengthEncoder
+
+#endif  // RUN_LENGTH_ENCODER_H
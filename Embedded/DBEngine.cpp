@@ -45,6 +45,7 @@ class CursorImpl : public Cursor {
 
   ~CursorImpl() {
     col_names_.clear();
+    batch_iterator_.reset();
     record_batch_.reset();
     result_set_.reset();
   }
@@ -86,10 +87,23 @@ class CursorImpl : public Cursor {
     return nullptr;
   }
 
+  std::shared_ptr<arrow::RecordBatch> getNextArrowRecordBatch(size_t max_batch_rows) {
+    if (!result_set_ || !getColCount()) {
+      return nullptr;
+    }
+    if (!batch_iterator_) {
+      batch_iterator_ = std::make_unique<ArrowResultSetBatchIterator>(
+          std::make_unique<ArrowResultSetConverter>(result_set_, col_names_, -1),
+          max_batch_rows);
+    }
+    return batch_iterator_->next();
+  }
+
  private:
   std::shared_ptr<ResultSet> result_set_;
   std::vector<std::string> col_names_;
   std::shared_ptr<arrow::RecordBatch> record_batch_;
+  std::unique_ptr<ArrowResultSetBatchIterator> batch_iterator_;
 };
 
 /**
@@ -539,4 +553,10 @@ std::shared_ptr<arrow::RecordBatch> Cursor::getArrowRecordBatch() {
   CursorImpl* cursor = getImpl(this);
   return cursor->getArrowRecordBatch();
 }
+
+std::shared_ptr<arrow::RecordBatch> Cursor::getNextArrowRecordBatch(
+    size_t max_batch_rows) {
+  CursorImpl* cursor = getImpl(this);
+  return cursor->getNextArrowRecordBatch(max_batch_rows);
+}
 }  // namespace EmbeddedDatabase
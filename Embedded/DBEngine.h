@@ -29,6 +29,8 @@ class Cursor {
   Row getNextRow();
   ColumnType getColType(uint32_t col_num);
   std::shared_ptr<arrow::RecordBatch> getArrowRecordBatch();
+  // Returns the result in batches of at most max_batch_rows rows, nullptr at the end.
+  std::shared_ptr<arrow::RecordBatch> getNextArrowRecordBatch(size_t max_batch_rows = 0);
 
  protected:
   Cursor() {}
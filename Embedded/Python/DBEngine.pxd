@@ -47,6 +47,7 @@ cdef extern from "DBEngine.h" namespace 'EmbeddedDatabase':
         Row getNextRow()
         ColumnType getColType(uint32_t nPos)
         shared_ptr[CRecordBatch] getArrowRecordBatch() nogil except +
+        shared_ptr[CRecordBatch] getNextArrowRecordBatch(size_t) nogil except +
 
     cdef cppclass DBEngine:
         void executeDDL(string) except +
@@ -154,6 +154,14 @@ cdef class PyCursor:
             prb = pyarrow_wrap_batch(self.c_batch)
             return prb
 
+    def getNextArrowRecordBatch(self, size_t max_batch_rows=0):
+        cdef shared_ptr[CRecordBatch] c_next_batch
+        with nogil:
+            c_next_batch = self.c_cursor.get().getNextArrowRecordBatch(max_batch_rows)
+        if c_next_batch.get() is NULL:
+            return None
+        return pyarrow_wrap_batch(c_next_batch)
+
 ColumnDetailsTp = namedtuple("ColumnDetails", ["name", "type", "nullable",
                                              "precision", "scale",
                                              "comp_param", "encoding",
@@ -225,6 +225,20 @@ class AbstractFragmenter {
   virtual const std::vector<uint64_t> getVacuumOffsets(
       const std::shared_ptr<Chunk_NS::Chunk>& chunk) = 0;
 
+  /**
+   * @brief Sorts the rows of the given fragments by a column
+   *
+   * Rows are moved across the fragments, in the order of the fragment ids, while the
+   * number of rows of every fragment is kept. The fragments end up holding consecutive,
+   * non-overlapping ranges of the sort column, with nulls first.
+   */
+  virtual void sortRows(const Catalog_Namespace::Catalog* catalog,
+                        const TableDescriptor* td,
+                        const ColumnDescriptor* sort_cd,
+                        const std::vector<int>& fragment_ids,
+                        const Data_Namespace::MemoryLevel memory_level,
+                        UpdelRoll& updel_roll) = 0;
+
   virtual void dropColumns(const std::vector<int>& columnIds) = 0;
 
   //! Iterates through chunk metadata to return whether any rows have been deleted.
@@ -122,6 +122,7 @@ void InsertOrderFragmenter::conditionallyInstantiateFileMgrWithParams() {
         catalog_->getMetadataForTable(physicalTableId_, false /*populateFragmenter*/);
     File_Namespace::FileMgrParams fileMgrParams;
     fileMgrParams.max_rollback_epochs = td->maxRollbackEpochs;
+    fileMgrParams.page_compression = td->pageCompression;
     dataMgr_->getGlobalFileMgr()->setFileMgrParams(
         chunkKeyPrefix_[0], chunkKeyPrefix_[1], fileMgrParams);
   }
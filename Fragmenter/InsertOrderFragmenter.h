@@ -166,6 +166,13 @@ class InsertOrderFragmenter : public AbstractFragmenter {
   const std::vector<uint64_t> getVacuumOffsets(
       const std::shared_ptr<Chunk_NS::Chunk>& chunk) override;
 
+  void sortRows(const Catalog_Namespace::Catalog* catalog,
+                const TableDescriptor* td,
+                const ColumnDescriptor* sort_cd,
+                const std::vector<int>& fragment_ids,
+                const Data_Namespace::MemoryLevel memory_level,
+                UpdelRoll& updel_roll) override;
+
   auto getChunksForAllColumns(const TableDescriptor* td,
                               const FragmentInfo& fragment,
                               const Data_Namespace::MemoryLevel memory_level);
@@ -240,6 +247,12 @@ class InsertOrderFragmenter : public AbstractFragmenter {
                           const std::shared_ptr<Chunk_NS::Chunk>& chunk,
                           const std::vector<uint64_t>& frag_offsets);
 
+  std::shared_ptr<Chunk_NS::Chunk> getChunkForColumn(
+      const TableDescriptor* td,
+      const ColumnDescriptor* cd,
+      const FragmentInfo& fragment,
+      const Data_Namespace::MemoryLevel memory_level);
+
  private:
   bool isAddingNewColumns(const InsertData& insert_data) const;
   void dropFragmentsToSizeNoInsertLock(const size_t max_rows);
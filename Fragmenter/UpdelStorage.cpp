@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <cstring>
 #include <mutex>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -23,7 +25,9 @@
 
 #include "Catalog/Catalog.h"
 #include "DataMgr/ArrayNoneEncoder.h"
+#include "DataMgr/DiffEncoder.h"
 #include "DataMgr/FixedLengthArrayNoneEncoder.h"
+#include "DataMgr/RunLengthEncoder.h"
 #include "Fragmenter/InsertOrderFragmenter.h"
 #include "LockMgr/LockMgr.h"
 #include "QueryEngine/Execute.h"
@@ -49,6 +53,35 @@ inline bool is_integral(const SQLTypeInfo& t) {
   return t.is_integer() || t.is_boolean() || t.is_time() || t.is_timeinterval();
 }
 
+inline bool is_run_length_or_diff_encoded(const SQLTypeInfo& t) {
+  return t.get_compression() == kENCODING_RL || t.get_compression() == kENCODING_DIFF;
+}
+
+inline std::vector<int64_t> decode_run_length_or_diff(const SQLTypeInfo& t,
+                                                      const int8_t* buf,
+                                                      const size_t buf_size) {
+  return t.get_compression() == kENCODING_RL
+             ? run_length_decode_all(buf, buf_size)
+             : diff_decode_all(
+                   buf, buf_size, t.get_comp_param() / 8, inline_int_null_val(t));
+}
+
+inline void put_int_value(int8_t* dst, const int64_t v, const size_t element_size) {
+  switch (element_size) {
+    case 2:
+      *reinterpret_cast<int16_t*>(dst) = static_cast<int16_t>(v);
+      break;
+    case 4:
+      *reinterpret_cast<int32_t*>(dst) = static_cast<int32_t>(v);
+      break;
+    case 8:
+      *reinterpret_cast<int64_t*>(dst) = v;
+      break;
+    default:
+      UNREACHABLE() << "Unexpected element size " << element_size;
+  }
+}
+
 bool FragmentInfo::unconditionalVacuum_{false};
 
 void InsertOrderFragmenter::updateColumn(const Catalog_Namespace::Catalog* catalog,
@@ -640,6 +673,10 @@ std::optional<ChunkUpdateStats> InsertOrderFragmenter::updateColumn(
     const SQLTypeInfo& rhs_type,
     const Data_Namespace::MemoryLevel memory_level,
     UpdelRoll& updel_roll) {
+  if (is_run_length_or_diff_encoded(cd->columnType)) {
+    throw std::runtime_error("UPDATE of RL or DIFF encoded column " + cd->columnName +
+                             " is not supported.");
+  }
   updel_roll.catalog = catalog;
   updel_roll.logicalTableId = catalog->getLogicalTableId(td->tableId);
   updel_roll.memoryLevel = memory_level;
@@ -989,24 +1026,31 @@ auto InsertOrderFragmenter::getChunksForAllColumns(
     if (const auto cd = catalog_->getMetadataForColumn(td->tableId, col_id)) {
       ++ncol;
       if (!cd->isVirtualCol) {
-        auto chunk_meta_it = fragment.getChunkMetadataMapPhysical().find(col_id);
-        CHECK(chunk_meta_it != fragment.getChunkMetadataMapPhysical().end());
-        ChunkKey chunk_key{
-            catalog_->getCurrentDB().dbId, td->tableId, col_id, fragment.fragmentId};
-        auto chunk = Chunk_NS::Chunk::getChunk(cd,
-                                               &catalog_->getDataMgr(),
-                                               chunk_key,
-                                               memory_level,
-                                               0,
-                                               chunk_meta_it->second->numBytes,
-                                               chunk_meta_it->second->numElements);
-        chunks.push_back(chunk);
+        chunks.push_back(getChunkForColumn(td, cd, fragment, memory_level));
       }
     }
   }
   return chunks;
 }
 
+std::shared_ptr<Chunk_NS::Chunk> InsertOrderFragmenter::getChunkForColumn(
+    const TableDescriptor* td,
+    const ColumnDescriptor* cd,
+    const FragmentInfo& fragment,
+    const Data_Namespace::MemoryLevel memory_level) {
+  auto chunk_meta_it = fragment.getChunkMetadataMapPhysical().find(cd->columnId);
+  CHECK(chunk_meta_it != fragment.getChunkMetadataMapPhysical().end());
+  ChunkKey chunk_key{
+      catalog_->getCurrentDB().dbId, td->tableId, cd->columnId, fragment.fragmentId};
+  return Chunk_NS::Chunk::getChunk(cd,
+                                   &catalog_->getDataMgr(),
+                                   chunk_key,
+                                   memory_level,
+                                   0,
+                                   chunk_meta_it->second->numBytes,
+                                   chunk_meta_it->second->numElements);
+}
+
 // get a sorted vector of offsets of rows to vacuum
 const std::vector<uint64_t> InsertOrderFragmenter::getVacuumOffsets(
     const std::shared_ptr<Chunk_NS::Chunk>& chunk) {
@@ -1056,6 +1100,31 @@ static void set_chunk_stats(const SQLTypeInfo& col_type,
   }
 }
 
+// Accumulates the stats of the first nrows of a fixed length chunk. The stats of fixed
+// length arrays are updated in the encoder directly.
+static void update_fixlen_chunk_stats(const SQLTypeInfo& col_type,
+                                      Data_Namespace::AbstractBuffer* data_buffer,
+                                      const size_t nrows,
+                                      UpdateValuesStats& stats) {
+  auto daddr = data_buffer->getMemoryPtr();
+  auto element_size =
+      col_type.is_fixlen_array() ? col_type.get_size() : get_element_size(col_type);
+  for (size_t irow = 0; irow < nrows; ++irow, daddr += element_size) {
+    if (col_type.is_fixlen_array()) {
+      auto encoder =
+          dynamic_cast<FixedLengthArrayNoneEncoder*>(data_buffer->getEncoder());
+      CHECK(encoder);
+      encoder->updateMetadata((int8_t*)daddr);
+    } else if (col_type.is_fp()) {
+      set_chunk_stats(
+          col_type, daddr, stats.has_null, stats.min_double, stats.max_double);
+    } else {
+      set_chunk_stats(
+          col_type, daddr, stats.has_null, stats.min_int64t, stats.max_int64t);
+    }
+  }
+}
+
 static void set_chunk_metadata(const Catalog_Namespace::Catalog* catalog,
                                FragmentInfo& fragment,
                                const std::shared_ptr<Chunk_NS::Chunk>& chunk,
@@ -1313,30 +1382,11 @@ void InsertOrderFragmenter::compactRows(const Catalog_Namespace::Catalog* catalo
 
           set_chunk_metadata(catalog, fragment, chunk, nrows_to_keep, updel_roll);
 
-          auto daddr = data_addr;
-          auto element_size = col_type.is_fixlen_array() ? col_type.get_size()
-                                                         : get_element_size(col_type);
           data_buffer->getEncoder()->resetChunkStats();
-          for (size_t irow = 0; irow < nrows_to_keep; ++irow, daddr += element_size) {
-            if (col_type.is_fixlen_array()) {
-              auto encoder =
-                  dynamic_cast<FixedLengthArrayNoneEncoder*>(data_buffer->getEncoder());
-              CHECK(encoder);
-              encoder->updateMetadata((int8_t*)daddr);
-            } else if (col_type.is_fp()) {
-              set_chunk_stats(col_type,
-                              daddr,
-                              update_stats_per_thread[ci].new_values_stats.has_null,
-                              update_stats_per_thread[ci].new_values_stats.min_double,
-                              update_stats_per_thread[ci].new_values_stats.max_double);
-            } else {
-              set_chunk_stats(col_type,
-                              daddr,
-                              update_stats_per_thread[ci].new_values_stats.has_null,
-                              update_stats_per_thread[ci].new_values_stats.min_int64t,
-                              update_stats_per_thread[ci].new_values_stats.max_int64t);
-            }
-          }
+          update_fixlen_chunk_stats(col_type,
+                                    data_buffer,
+                                    nrows_to_keep,
+                                    update_stats_per_thread[ci].new_values_stats);
         };
 
     auto varlen_vacuum = [=, &updel_roll, &frag_offsets, &fragment] {
@@ -1358,7 +1408,51 @@ void InsertOrderFragmenter::compactRows(const Catalog_Namespace::Catalog* catalo
       set_chunk_metadata(catalog, fragment, chunk, nrows_to_keep, updel_roll);
     };
 
-    if (is_varlen) {
+    // Run length and differential encoded chunks aren't positional; decode the rows to
+    // keep and encode them again.
+    auto run_length_or_diff_vacuum =
+        [=, &update_stats_per_thread, &updel_roll, &frag_offsets, &fragment] {
+          const auto values =
+              decode_run_length_or_diff(col_type, data_addr, data_buffer->size());
+          CHECK_EQ(values.size(), nrows_in_fragment);
+          const auto element_size = col_type.get_size();
+          std::vector<int8_t> kept_rows(nrows_to_keep * element_size);
+          auto& stats = update_stats_per_thread[ci].new_values_stats;
+          const auto null_val = inline_int_null_val(col_type);
+          size_t irow_to_fill = 0;
+          auto deleted_it = frag_offsets.begin();
+          for (size_t irow = 0; irow < values.size(); ++irow) {
+            if (deleted_it != frag_offsets.end() && *deleted_it == irow) {
+              ++deleted_it;
+              continue;
+            }
+            const auto v = values[irow];
+            put_int_value(
+                kept_rows.data() + irow_to_fill++ * element_size, v, element_size);
+            if (v == null_val) {
+              stats.has_null = true;
+            } else {
+              set_minmax(stats.min_int64t, stats.max_int64t, v);
+            }
+          }
+          CHECK_EQ(irow_to_fill, nrows_to_keep);
+
+          auto encoder = data_buffer->getEncoder();
+          encoder->setNumElems(0);
+          encoder->resetChunkStats();
+          data_buffer->setSize(0);
+          if (nrows_to_keep > 0) {
+            auto src_data = kept_rows.data();
+            encoder->appendData(src_data, nrows_to_keep, col_type);
+          }
+          data_buffer->setUpdated();
+
+          set_chunk_metadata(catalog, fragment, chunk, nrows_to_keep, updel_roll);
+        };
+
+    if (is_run_length_or_diff_encoded(col_type)) {
+      threads.emplace_back(std::async(std::launch::async, run_length_or_diff_vacuum));
+    } else if (is_varlen) {
       threads.emplace_back(std::async(std::launch::async, varlen_vacuum));
     } else {
       threads.emplace_back(std::async(std::launch::async, fixlen_vacuum));
@@ -1393,6 +1487,283 @@ void InsertOrderFragmenter::compactRows(const Catalog_Namespace::Catalog* catalo
   }
 }
 
+// Returns the indexes of the rows of the given chunks of a scalar column over their
+// concatenation, ordered by value with nulls first. Rows with equal values keep their
+// relative order.
+template <typename T>
+static std::vector<size_t> get_sorted_row_indexes(
+    const std::vector<std::shared_ptr<Chunk_NS::Chunk>>& chunks,
+    const std::vector<size_t>& chunk_row_offsets) {
+  const auto& col_type = chunks.front()->getColumnDesc()->columnType;
+  // (is not null, value) pairs, which order nulls first
+  std::vector<std::pair<bool, T>> keys;
+  keys.reserve(chunk_row_offsets.back());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const auto data_buffer = chunks[i]->getBuffer();
+    const auto nrows = chunk_row_offsets[i + 1] - chunk_row_offsets[i];
+    if (is_run_length_or_diff_encoded(col_type)) {
+      const auto values = decode_run_length_or_diff(
+          col_type, data_buffer->getMemoryPtr(), data_buffer->size());
+      CHECK_EQ(values.size(), nrows);
+      const auto null_val = inline_int_null_val(col_type);
+      for (const auto v : values) {
+        keys.emplace_back(v != null_val, v != null_val ? v : T{});
+      }
+      continue;
+    }
+    auto daddr = data_buffer->getMemoryPtr();
+    const auto element_size = get_element_size(col_type);
+    for (size_t irow = 0; irow < nrows; ++irow, daddr += element_size) {
+      T v;
+      const auto is_null = get_scalar<T>(daddr, col_type, v);
+      keys.emplace_back(!is_null, is_null ? T{} : v);
+    }
+  }
+  std::vector<size_t> indexes(keys.size());
+  std::iota(indexes.begin(), indexes.end(), 0);
+  std::stable_sort(indexes.begin(), indexes.end(), [&keys](const auto a, const auto b) {
+    return keys[a] < keys[b];
+  });
+  return indexes;
+}
+
+// Moves the rows of fixed length chunks to the positions given by the row indexes over
+// the concatenation of the chunks and accumulates the stats of every chunk.
+static void sort_fixlen_rows(const std::vector<std::shared_ptr<Chunk_NS::Chunk>>& chunks,
+                             const std::vector<size_t>& chunk_row_offsets,
+                             const std::vector<size_t>& sorted_row_indexes,
+                             std::vector<UpdateValuesStats>& stats_per_chunk) {
+  const auto& col_type = chunks.front()->getColumnDesc()->columnType;
+  const size_t element_size =
+      col_type.is_fixlen_array() ? col_type.get_size() : get_element_size(col_type);
+  // the chunks are rewritten in place, so keep a copy of all the rows
+  std::vector<int8_t> rows(chunk_row_offsets.back() * element_size);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    std::memcpy(rows.data() + chunk_row_offsets[i] * element_size,
+                chunks[i]->getBuffer()->getMemoryPtr(),
+                (chunk_row_offsets[i + 1] - chunk_row_offsets[i]) * element_size);
+  }
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    auto data_buffer = chunks[i]->getBuffer();
+    auto daddr = data_buffer->getMemoryPtr();
+    const auto nrows = chunk_row_offsets[i + 1] - chunk_row_offsets[i];
+    for (size_t irow = 0; irow < nrows; ++irow) {
+      std::memcpy(daddr + irow * element_size,
+                  rows.data() +
+                      sorted_row_indexes[chunk_row_offsets[i] + irow] * element_size,
+                  element_size);
+    }
+    data_buffer->setUpdated();
+    data_buffer->getEncoder()->resetChunkStats();
+    update_fixlen_chunk_stats(col_type, data_buffer, nrows, stats_per_chunk[i]);
+  }
+}
+
+// Same as above for run length and differential encoded chunks, which are decoded and
+// encoded again.
+static void sort_run_length_or_diff_rows(
+    const std::vector<std::shared_ptr<Chunk_NS::Chunk>>& chunks,
+    const std::vector<size_t>& chunk_row_offsets,
+    const std::vector<size_t>& sorted_row_indexes,
+    std::vector<UpdateValuesStats>& stats_per_chunk) {
+  const auto& col_type = chunks.front()->getColumnDesc()->columnType;
+  std::vector<int64_t> values;
+  values.reserve(chunk_row_offsets.back());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const auto data_buffer = chunks[i]->getBuffer();
+    const auto chunk_values = decode_run_length_or_diff(
+        col_type, data_buffer->getMemoryPtr(), data_buffer->size());
+    CHECK_EQ(chunk_values.size(), chunk_row_offsets[i + 1] - chunk_row_offsets[i]);
+    values.insert(values.end(), chunk_values.begin(), chunk_values.end());
+  }
+  const auto element_size = col_type.get_size();
+  const auto null_val = inline_int_null_val(col_type);
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const auto nrows = chunk_row_offsets[i + 1] - chunk_row_offsets[i];
+    std::vector<int8_t> rows(nrows * element_size);
+    auto& stats = stats_per_chunk[i];
+    for (size_t irow = 0; irow < nrows; ++irow) {
+      const auto v = values[sorted_row_indexes[chunk_row_offsets[i] + irow]];
+      put_int_value(rows.data() + irow * element_size, v, element_size);
+      if (v == null_val) {
+        stats.has_null = true;
+      } else {
+        set_minmax(stats.min_int64t, stats.max_int64t, v);
+      }
+    }
+    auto data_buffer = chunks[i]->getBuffer();
+    auto encoder = data_buffer->getEncoder();
+    encoder->setNumElems(0);
+    encoder->resetChunkStats();
+    data_buffer->setSize(0);
+    if (nrows > 0) {
+      auto src_data = rows.data();
+      encoder->appendData(src_data, nrows, col_type);
+    }
+    data_buffer->setUpdated();
+  }
+}
+
+// Same as above for variable length chunks, which are appended again from the decoded
+// strings or arrays.
+static void sort_varlen_rows(const std::vector<std::shared_ptr<Chunk_NS::Chunk>>& chunks,
+                             const std::vector<size_t>& chunk_row_offsets,
+                             const std::vector<size_t>& sorted_row_indexes) {
+  const auto& col_type = chunks.front()->getColumnDesc()->columnType;
+  const auto is_varlen_array = col_type.is_varlen_array();
+  const auto nrows_total = chunk_row_offsets.back();
+  std::vector<std::string> strings;
+  // arrays point into copies of the data buffers, since the chunks are rewritten in
+  // place
+  std::vector<std::vector<int8_t>> array_data(chunks.size());
+  std::vector<ArrayDatum> arrays;
+  if (is_varlen_array) {
+    arrays.reserve(nrows_total);
+  } else {
+    strings.reserve(nrows_total);
+  }
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const auto data_buffer = chunks[i]->getBuffer();
+    const auto data_addr = data_buffer->getMemoryPtr();
+    const auto index_array =
+        reinterpret_cast<StringOffsetT*>(chunks[i]->getIndexBuf()->getMemoryPtr());
+    const auto nrows = chunk_row_offsets[i + 1] - chunk_row_offsets[i];
+    if (is_varlen_array) {
+      array_data[i].assign(data_addr, data_addr + data_buffer->size());
+    }
+    for (size_t irow = 0; irow < nrows; ++irow) {
+      const auto begin = get_buffer_offset(is_varlen_array, index_array, irow);
+      const auto end = get_buffer_offset(is_varlen_array, index_array, irow + 1);
+      if (is_varlen_array) {
+        const auto is_null = index_array[irow + 1] < 0;
+        arrays.emplace_back(is_null ? 0 : end - begin,
+                            is_null ? nullptr : array_data[i].data() + begin,
+                            is_null,
+                            DoNothingDeleter());
+      } else {
+        strings.emplace_back(reinterpret_cast<const char*>(data_addr) + begin,
+                             end - begin);
+      }
+    }
+  }
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    const auto nrows = chunk_row_offsets[i + 1] - chunk_row_offsets[i];
+    std::vector<std::string> chunk_strings;
+    std::vector<ArrayDatum> chunk_arrays;
+    DataBlockPtr data_block;
+    if (is_varlen_array) {
+      for (size_t irow = 0; irow < nrows; ++irow) {
+        chunk_arrays.push_back(arrays[sorted_row_indexes[chunk_row_offsets[i] + irow]]);
+      }
+      data_block.arraysPtr = &chunk_arrays;
+    } else {
+      for (size_t irow = 0; irow < nrows; ++irow) {
+        chunk_strings.push_back(
+            std::move(strings[sorted_row_indexes[chunk_row_offsets[i] + irow]]));
+      }
+      data_block.stringsPtr = &chunk_strings;
+    }
+    auto data_buffer = chunks[i]->getBuffer();
+    auto index_buffer = chunks[i]->getIndexBuf();
+    auto encoder = data_buffer->getEncoder();
+    encoder->setNumElems(0);
+    encoder->resetChunkStats();
+    data_buffer->setSize(0);
+    index_buffer->setSize(0);
+    if (nrows > 0) {
+      chunks[i]->appendData(data_block, nrows, 0);
+    }
+    data_buffer->setUpdated();
+    index_buffer->setUpdated();
+  }
+}
+
+void InsertOrderFragmenter::sortRows(const Catalog_Namespace::Catalog* catalog,
+                                     const TableDescriptor* td,
+                                     const ColumnDescriptor* sort_cd,
+                                     const std::vector<int>& fragment_ids,
+                                     const Data_Namespace::MemoryLevel memory_level,
+                                     UpdelRoll& updel_roll) {
+  std::vector<FragmentInfo*> fragments;
+  std::vector<size_t> fragment_row_offsets{0};
+  for (const auto fragment_id : fragment_ids) {
+    auto fragment = getFragmentInfo(fragment_id);
+    CHECK(fragment);
+    fragments.push_back(fragment);
+    fragment_row_offsets.push_back(fragment_row_offsets.back() +
+                                   fragment->getPhysicalNumTuples());
+  }
+  if (fragments.size() < 2) {
+    return;
+  }
+  auto get_chunks = [&](const ColumnDescriptor* cd) {
+    std::vector<std::shared_ptr<Chunk_NS::Chunk>> chunks;
+    for (const auto fragment : fragments) {
+      chunks.push_back(getChunkForColumn(td, cd, *fragment, memory_level));
+    }
+    return chunks;
+  };
+
+  const auto& sort_type = sort_cd->columnType;
+  CHECK(!sort_type.is_varlen() && !sort_type.is_fixlen_array());
+  const auto sort_chunks = get_chunks(sort_cd);
+  const auto sorted_row_indexes =
+      sort_type.is_fp()
+          ? get_sorted_row_indexes<double>(sort_chunks, fragment_row_offsets)
+          : get_sorted_row_indexes<int64_t>(sort_chunks, fragment_row_offsets);
+  CHECK_EQ(sorted_row_indexes.size(), fragment_row_offsets.back());
+
+  // parallel sort columns, one column of all the fragments at a time per thread
+  std::vector<std::future<void>> threads;
+  for (int col_id = 1, ncol = 0; ncol < td->nColumns; ++col_id) {
+    const auto cd = catalog_->getMetadataForColumn(td->tableId, col_id);
+    if (!cd) {
+      continue;
+    }
+    ++ncol;
+    if (cd->isVirtualCol) {
+      continue;
+    }
+    threads.emplace_back(std::async(std::launch::async, [&, cd] {
+      const auto chunks =
+          cd->columnId == sort_cd->columnId ? sort_chunks : get_chunks(cd);
+      const auto& col_type = cd->columnType;
+      std::vector<UpdateValuesStats> stats_per_chunk(chunks.size());
+      if (is_run_length_or_diff_encoded(col_type)) {
+        sort_run_length_or_diff_rows(
+            chunks, fragment_row_offsets, sorted_row_indexes, stats_per_chunk);
+      } else if (col_type.is_varlen_indeed()) {
+        sort_varlen_rows(chunks, fragment_row_offsets, sorted_row_indexes);
+      } else {
+        sort_fixlen_rows(
+            chunks, fragment_row_offsets, sorted_row_indexes, stats_per_chunk);
+      }
+      for (size_t i = 0; i < chunks.size(); ++i) {
+        auto& fragment = *fragments[i];
+        const auto nrows = fragment_row_offsets[i + 1] - fragment_row_offsets[i];
+        set_chunk_metadata(catalog, fragment, chunks[i], nrows, updel_roll);
+        if (col_type.is_fixlen_array()) {
+          continue;
+        }
+        // For DATE_IN_DAYS encoded columns, data is stored in days but the metadata is
+        // stored in seconds.
+        auto& stats = stats_per_chunk[i];
+        if (col_type.is_date_in_days()) {
+          stats.min_int64t =
+              DateConverters::get_epoch_seconds_from_days(stats.min_int64t);
+          stats.max_int64t =
+              DateConverters::get_epoch_seconds_from_days(stats.max_int64t);
+        }
+        updateColumnMetadata(cd, fragment, chunks[i], stats, col_type, updel_roll);
+      }
+    }));
+    if (threads.size() >= (size_t)cpu_threads()) {
+      wait_cleanup_threads(threads);
+    }
+  }
+  wait_cleanup_threads(threads);
+}
+
 }  // namespace Fragmenter_Namespace
 
 bool UpdelRoll::commitUpdate() {
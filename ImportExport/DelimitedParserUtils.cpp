@@ -22,12 +22,74 @@
 
 #include "ImportExport/DelimitedParserUtils.h"
 
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
 #include <string_view>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include "Logger/Logger.h"
 #include "StringDictionary/StringDictionary.h"
 
 namespace {
+/**
+ * Finds the next occurrence of any of a few structural characters (delimiters, quotes,
+ * line endings). With SSE2, blocks of 16 bytes are compared against all the characters
+ * at once, which skips over the content of fields much faster than a byte by byte scan.
+ */
+class StructuralCharFinder {
+ public:
+  StructuralCharFinder(std::initializer_list<char> chars) {
+    for (const auto c : chars) {
+      if (std::find(chars_, chars_ + num_chars_, c) == chars_ + num_chars_) {
+        CHECK_LT(num_chars_, kMaxChars);
+        chars_[num_chars_++] = c;
+      }
+    }
+#if defined(__SSE2__)
+    for (size_t i = 0; i < num_chars_; ++i) {
+      char_blocks_[i] = _mm_set1_epi8(chars_[i]);
+    }
+#endif
+  }
+
+  // Returns the first structural character in [begin, end), end if there's none.
+  inline const char* find(const char* begin, const char* end) const {
+#if defined(__SSE2__)
+    while (end - begin >= 16) {
+      const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+      auto matches = _mm_cmpeq_epi8(block, char_blocks_[0]);
+      for (size_t i = 1; i < num_chars_; ++i) {
+        matches = _mm_or_si128(matches, _mm_cmpeq_epi8(block, char_blocks_[i]));
+      }
+      const auto match_mask = _mm_movemask_epi8(matches);
+      if (match_mask) {
+        return begin + __builtin_ctz(match_mask);
+      }
+      begin += 16;
+    }
+#endif
+    for (; begin < end; ++begin) {
+      if (std::find(chars_, chars_ + num_chars_, *begin) != chars_ + num_chars_) {
+        return begin;
+      }
+    }
+    return end;
+  }
+
+ private:
+  static constexpr size_t kMaxChars{8};
+
+  char chars_[kMaxChars];
+  size_t num_chars_{0};
+#if defined(__SSE2__)
+  __m128i char_blocks_[kMaxChars];
+#endif
+};
+
 inline bool is_eol(const char& c, const import_export::CopyParams& copy_params) {
   return c == copy_params.line_delim || c == '\n' || c == '\r';
 }
@@ -85,36 +147,48 @@ size_t find_end(const char* buffer,
                 size_t offset) {
   size_t last_line_delim_pos = 0;
   const char* current = buffer + offset;
+  const char* buffer_end = buffer + size;
   if (copy_params.quoted) {
-    while (current < buffer + size) {
-      while (!in_quote && current < buffer + size) {
+    const StructuralCharFinder unquoted_char_finder{copy_params.line_delim,
+                                                    copy_params.quote};
+    const StructuralCharFinder quoted_char_finder{copy_params.escape, copy_params.quote};
+    while (current < buffer_end) {
+      if (!in_quote) {
         // We are outside of quotes. We have to find the last possible line delimiter.
+        current = unquoted_char_finder.find(current, buffer_end);
+        if (current == buffer_end) {
+          break;
+        }
         if (*current == copy_params.line_delim) {
           last_line_delim_pos = current - buffer;
           ++num_rows_this_buffer;
-        } else if (*current == copy_params.quote) {
+        } else {
           in_quote = true;
         }
-        ++current;
-      }
-
-      while (in_quote && current < buffer + size) {
+      } else {
         // We are in a quoted field. We have to find the ending quote.
-        if ((*current == copy_params.escape) && (current < buffer + size - 1) &&
+        current = quoted_char_finder.find(current, buffer_end);
+        if (current == buffer_end) {
+          break;
+        }
+        if ((*current == copy_params.escape) && (current < buffer_end - 1) &&
             (*(current + 1) == copy_params.quote)) {
           ++current;
         } else if (*current == copy_params.quote) {
           in_quote = false;
         }
-        ++current;
       }
+      ++current;
     }
   } else {
-    while (current < buffer + size) {
-      if (*current == copy_params.line_delim) {
-        last_line_delim_pos = current - buffer;
-        ++num_rows_this_buffer;
+    while (current < buffer_end) {
+      current = static_cast<const char*>(
+          std::memchr(current, copy_params.line_delim, buffer_end - current));
+      if (!current) {
+        break;
       }
+      last_line_delim_pos = current - buffer;
+      ++num_rows_this_buffer;
       ++current;
     }
   }
@@ -213,7 +287,17 @@ const char* get_row(const char* buf,
   bool has_escape = false;
   bool strip_quotes = false;
   try_single_thread = false;
-  for (p = buf; p < entire_buf_end; ++p) {
+  // only the characters handled below can end or change the state of a field
+  const StructuralCharFinder char_finder{
+      copy_params.escape,
+      copy_params.quoted ? copy_params.quote : copy_params.delimiter,
+      is_array ? copy_params.array_begin : copy_params.delimiter,
+      copy_params.delimiter,
+      copy_params.line_delim,
+      '\n',
+      '\r'};
+  for (p = char_finder.find(buf, entire_buf_end); p < entire_buf_end;
+       p = char_finder.find(p + 1, entire_buf_end)) {
     if (*p == copy_params.escape && p < entire_buf_end - 1 &&
         *(p + 1) == copy_params.quote) {
       p++;
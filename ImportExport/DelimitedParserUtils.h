@@ -53,6 +53,28 @@ size_t find_beginning(const char* buffer,
                       size_t end,
                       const CopyParams& copy_params);
 
+/**
+ * @brief Finds the closest possible row ending to the end of the given buffer.
+ *
+ * @param buffer                 Given buffer which has the rows in csv format. (NOT OWN)
+ * @param size                   Size of the buffer.
+ * @param copy_params            Copy params for the table.
+ * @param num_rows_this_buffer   Incremented by the number of row endings found.
+ * @param buffer_first_row_index Index of first row in the buffer.
+ * @param in_quote               Whether the scan starts (and ends) in a quoted field.
+ * @param offset                 Position in the buffer to start the scan at.
+ *
+ * @return The position after the closest possible row ending to the end of the given
+ * buffer. Throws InsufficientBufferSizeException if the buffer has no row ending.
+ */
+size_t find_end(const char* buffer,
+                size_t size,
+                const CopyParams& copy_params,
+                unsigned int& num_rows_this_buffer,
+                size_t buffer_first_row_index,
+                bool& in_quote,
+                size_t offset);
+
 /**
  * @brief Gets the maximum size to which thread buffers should be automatically resized.
  */
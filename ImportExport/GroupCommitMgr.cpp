@@ -0,0 +1,265 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ImportExport/GroupCommitMgr.h"
+
+#include <algorithm>
+
+#include "Catalog/SessionInfo.h"
+#include "LockMgr/LockMgr.h"
+#include "Logger/Logger.h"
+
+bool g_enable_ingest_group_commit{false};
+size_t g_ingest_group_commit_rows{1000000};
+size_t g_ingest_group_commit_interval_ms{1000};
+
+namespace import_export {
+
+GroupCommitMgr::GroupCommitMgr()
+    : stop_(false), committer_([this] { commitDueTables(); }) {}
+
+GroupCommitMgr::QueuedLoad::QueuedLoad(GroupCommitMgr& group_commit_mgr,
+                                       const TableKey& table_key)
+    : group_commit_mgr_(group_commit_mgr), table_key_(table_key), queued_(true) {
+  std::lock_guard<std::mutex> lock(group_commit_mgr_.pending_tables_mutex_);
+  ++group_commit_mgr_.queued_loads_[table_key_];
+}
+
+GroupCommitMgr::QueuedLoad::~QueuedLoad() {
+  std::lock_guard<std::mutex> lock(group_commit_mgr_.pending_tables_mutex_);
+  if (!queued_ || !group_commit_mgr_.dequeueLoad(*this)) {
+    return;
+  }
+  const auto it = group_commit_mgr_.pending_tables_.find(table_key_);
+  if (it != group_commit_mgr_.pending_tables_.end()) {
+    // the committer thread takes the table locks this load does not hold
+    it->second.abandoned = true;
+    group_commit_mgr_.pending_tables_cv_.notify_one();
+  }
+}
+
+GroupCommitMgr& GroupCommitMgr::instance() {
+  static GroupCommitMgr group_commit_mgr;
+  return group_commit_mgr;
+}
+
+GroupCommitMgr::~GroupCommitMgr() {
+  {
+    std::lock_guard<std::mutex> lock(pending_tables_mutex_);
+    stop_ = true;
+  }
+  pending_tables_cv_.notify_one();
+  committer_.join();
+}
+
+std::unique_ptr<GroupCommitMgr::QueuedLoad> GroupCommitMgr::queueLoad(
+    const Catalog_Namespace::Catalog& catalog,
+    const int table_id) {
+  return std::make_unique<QueuedLoad>(*this, TableKey{catalog.getDatabaseId(), table_id});
+}
+
+bool GroupCommitMgr::load(
+    Loader& loader,
+    const std::vector<std::unique_ptr<TypedImportBuffer>>& import_buffers,
+    const size_t row_count,
+    const Catalog_Namespace::SessionInfo* session_info,
+    QueuedLoad& queued_load,
+    std::shared_future<void>& committed) {
+  const auto td = loader.getTableDesc();
+  if (td->persistenceLevel != Data_Namespace::MemoryLevel::DISK_LEVEL) {
+    // nothing to checkpoint
+    return loader.load(import_buffers, row_count, session_info);
+  }
+  CHECK(session_info);
+  const TableKey table_key{loader.getCatalog().getDatabaseId(), td->tableId};
+  const auto rollback = [this, &loader, &table_key] {
+    const auto pending_table = takePendingTable(table_key);
+    LOG(WARNING) << "Rolling back the uncommitted rows of table " << table_key.second
+                 << " to its last checkpoint after a failed append";
+    loader.setTableEpochs(loader.getTableEpochs());
+    if (pending_table) {
+      // none of these rows were acknowledged yet
+      pending_table->committed->set_exception(std::make_exception_ptr(std::runtime_error(
+          "Rows rolled back after a failed append to the table, load them again")));
+    }
+  };
+  try {
+    if (!loader.loadNoCheckpoint(import_buffers, row_count, session_info)) {
+      rollback();
+      return false;
+    }
+  } catch (...) {
+    rollback();
+    throw;
+  }
+
+  std::optional<PendingTable> due_table;
+  {
+    std::lock_guard<std::mutex> lock(pending_tables_mutex_);
+    const bool last_queued_load = dequeueLoad(queued_load);
+    auto& pending_table = pending_tables_[table_key];
+    if (pending_table.row_count == 0) {
+      pending_table.catalog = session_info->get_catalog_ptr();
+      pending_table.first_append = std::chrono::steady_clock::now();
+      pending_table.committed = std::make_shared<std::promise<void>>();
+      pending_table.committed_future = pending_table.committed->get_future().share();
+      pending_tables_cv_.notify_one();
+    }
+    pending_table.row_count += row_count;
+    committed = pending_table.committed_future;
+    if (last_queued_load || pending_table.row_count >= g_ingest_group_commit_rows) {
+      due_table = std::move(pending_table);
+      pending_tables_.erase(table_key);
+    }
+  }
+  if (due_table) {
+    // the caller already holds the locks of the table
+    commit(table_key, *due_table);
+  }
+  return true;
+}
+
+void GroupCommitMgr::commitPendingRows(const Catalog_Namespace::Catalog& catalog,
+                                       const int table_id) {
+  const TableKey table_key{catalog.getDatabaseId(), table_id};
+  if (const auto pending_table = takePendingTable(table_key)) {
+    commit(table_key, *pending_table);
+    // the caller must not write to the table if its pending rows could not be committed
+    pending_table->committed_future.get();
+  }
+}
+
+void GroupCommitMgr::commitAll() {
+  std::vector<std::pair<TableKey, std::shared_ptr<Catalog_Namespace::Catalog>>> tables;
+  {
+    std::lock_guard<std::mutex> lock(pending_tables_mutex_);
+    for (const auto& [table_key, pending_table] : pending_tables_) {
+      tables.emplace_back(table_key, pending_table.catalog);
+    }
+  }
+  for (const auto& [table_key, catalog] : tables) {
+    lockAndCommit(table_key, *catalog);
+  }
+}
+
+size_t GroupCommitMgr::getNumQueuedLoads(const Catalog_Namespace::Catalog& catalog,
+                                         const int table_id) {
+  std::lock_guard<std::mutex> lock(pending_tables_mutex_);
+  const auto it = queued_loads_.find({catalog.getDatabaseId(), table_id});
+  return it == queued_loads_.end() ? 0 : it->second;
+}
+
+bool GroupCommitMgr::dequeueLoad(QueuedLoad& queued_load) {
+  CHECK(queued_load.queued_);
+  queued_load.queued_ = false;
+  const auto it = queued_loads_.find(queued_load.table_key_);
+  CHECK(it != queued_loads_.end());
+  CHECK_GT(it->second, size_t(0));
+  if (--it->second) {
+    return false;
+  }
+  queued_loads_.erase(it);
+  return true;
+}
+
+std::optional<GroupCommitMgr::PendingTable> GroupCommitMgr::takePendingTable(
+    const TableKey& table_key) {
+  std::lock_guard<std::mutex> lock(pending_tables_mutex_);
+  const auto it = pending_tables_.find(table_key);
+  if (it == pending_tables_.end()) {
+    return std::nullopt;
+  }
+  auto pending_table = std::move(it->second);
+  pending_tables_.erase(it);
+  return pending_table;
+}
+
+void GroupCommitMgr::lockAndCommit(const TableKey& table_key,
+                                   const Catalog_Namespace::Catalog& catalog) {
+  std::unique_ptr<lockmgr::TableSchemaLockContainer<lockmgr::ReadLock>> schema_read_lock;
+  std::unique_ptr<lockmgr::WriteLock> insert_data_lock;
+  try {
+    // same order as the load_table endpoints
+    schema_read_lock =
+        std::make_unique<lockmgr::TableSchemaLockContainer<lockmgr::ReadLock>>(
+            lockmgr::TableSchemaLockContainer<lockmgr::ReadLock>::acquireTableDescriptor(
+                catalog, table_key.second));
+    insert_data_lock = std::make_unique<lockmgr::WriteLock>(
+        lockmgr::InsertDataLockMgr::getWriteLockForTable(
+            ChunkKey{table_key.first, table_key.second}));
+  } catch (const std::exception& e) {
+    // the table was dropped meanwhile, along with its pending rows
+    if (const auto pending_table = takePendingTable(table_key)) {
+      pending_table->committed->set_exception(
+          std::make_exception_ptr(std::runtime_error(e.what())));
+    }
+    return;
+  }
+  // only taken out once no append can roll them back
+  if (const auto pending_table = takePendingTable(table_key)) {
+    commit(table_key, *pending_table);
+  }
+}
+
+void GroupCommitMgr::commit(const TableKey& table_key,
+                            const PendingTable& pending_table) {
+  try {
+    pending_table.catalog->checkpointWithAutoRollback(table_key.second);
+  } catch (const std::exception& e) {
+    LOG(ERROR) << "Group commit of " << pending_table.row_count << " rows of table "
+               << table_key.second << " failed: " << e.what();
+    pending_table.committed->set_exception(std::make_exception_ptr(std::runtime_error(
+        "Commit of the loaded rows failed: " + std::string(e.what()))));
+    return;
+  }
+  VLOG(1) << "Committed " << pending_table.row_count << " rows of table "
+          << table_key.second;
+  pending_table.committed->set_value();
+}
+
+void GroupCommitMgr::commitDueTables() {
+  std::unique_lock<std::mutex> lock(pending_tables_mutex_);
+  while (!stop_) {
+    const auto now = std::chrono::steady_clock::now();
+    const std::chrono::milliseconds interval(g_ingest_group_commit_interval_ms);
+    auto next_due = std::chrono::steady_clock::time_point::max();
+    std::vector<std::pair<TableKey, std::shared_ptr<Catalog_Namespace::Catalog>>>
+        due_tables;
+    for (const auto& [table_key, pending_table] : pending_tables_) {
+      const auto due = pending_table.first_append + interval;
+      if (pending_table.abandoned || due <= now) {
+        due_tables.emplace_back(table_key, pending_table.catalog);
+      } else {
+        next_due = std::min(next_due, due);
+      }
+    }
+    if (!due_tables.empty()) {
+      lock.unlock();
+      for (const auto& [table_key, catalog] : due_tables) {
+        lockAndCommit(table_key, *catalog);
+      }
+      lock.lock();
+      continue;
+    }
+    if (next_due == std::chrono::steady_clock::time_point::max()) {
+      pending_tables_cv_.wait(lock);
+    } else {
+      pending_tables_cv_.wait_until(lock, next_due);
+    }
+  }
+}
+
+}  // namespace import_export
@@ -0,0 +1,152 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    GroupCommitMgr.h
+ * @brief   Group commit of the rows streamed into tables through the load_table
+ *          endpoints.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "ImportExport/Importer.h"
+
+extern bool g_enable_ingest_group_commit;
+extern size_t g_ingest_group_commit_rows;
+extern size_t g_ingest_group_commit_interval_ms;
+
+namespace import_export {
+
+/**
+ * Appends rows to disk-resident tables without checkpointing them, so that frequent
+ * small batches do not each pay for a new epoch and the file syncs of a checkpoint.
+ * Appended rows go to the buffer pool through the fragmenter and are read by queries
+ * right away. Loads queue for the insert data lock of their table before appending, and
+ * a load leaves its rows pending only while another load is queued behind it: the last
+ * load in line commits, i.e. checkpoints, the rows of the whole group, so a single
+ * stream of loads commits each of them right away and concurrent streams share commits.
+ * A table is also committed once g_ingest_group_commit_rows rows are pending, and by a
+ * background thread g_ingest_group_commit_interval_ms after its first pending append,
+ * in case loads keep queuing. Loads are only acknowledged once their rows are committed:
+ * callers wait on the commit future of their rows after releasing the table locks, and
+ * get the error of the commit if it fails. A failed append rolls the table back to its
+ * last checkpoint, failing the loads still waiting on the pending rows. Other writers
+ * commit the pending rows of a table before writing to it, so that their own rollbacks
+ * do not discard them.
+ */
+class GroupCommitMgr {
+ public:
+  // database and table ids
+  using TableKey = std::pair<int, int>;
+
+  // A load waiting for the insert data lock of a table, from before it takes the lock
+  // until it appended its rows or gave up.
+  class QueuedLoad {
+   public:
+    QueuedLoad(GroupCommitMgr& group_commit_mgr, const TableKey& table_key);
+
+    // Lets the committer thread commit the rows left pending for this load, if it was
+    // the last one in line and never appended.
+    ~QueuedLoad();
+
+   private:
+    friend class GroupCommitMgr;
+
+    GroupCommitMgr& group_commit_mgr_;
+    const TableKey table_key_;
+    bool queued_;
+  };
+
+  static GroupCommitMgr& instance();
+
+  ~GroupCommitMgr();
+
+  // Queues a load of a table, before the caller takes its insert data lock.
+  std::unique_ptr<QueuedLoad> queueLoad(const Catalog_Namespace::Catalog& catalog,
+                                        const int table_id);
+
+  // Appends rows with the given loader, committing its table unless another load is
+  // queued behind this one and not enough rows are pending. The caller queued the load,
+  // holds the schema read lock and the insert data write lock of the table, and waits on
+  // the returned future, if valid, once it released them. Returns false, with the error
+  // in the loader, if the rows could not be loaded, in which case the table has been
+  // rolled back to its last checkpoint.
+  bool load(Loader& loader,
+            const std::vector<std::unique_ptr<TypedImportBuffer>>& import_buffers,
+            const size_t row_count,
+            const Catalog_Namespace::SessionInfo* session_info,
+            QueuedLoad& queued_load,
+            std::shared_future<void>& committed);
+
+  // Commits the pending rows of a table before another writer appends to, updates or
+  // rolls back the table. The caller holds the locks appends hold, or stronger ones.
+  void commitPendingRows(const Catalog_Namespace::Catalog& catalog, const int table_id);
+
+  // Commits the pending rows of every table.
+  void commitAll();
+
+  size_t getNumQueuedLoads(const Catalog_Namespace::Catalog& catalog,
+                           const int table_id);  // for unit tests
+
+ private:
+  GroupCommitMgr();
+
+  struct PendingTable {
+    std::shared_ptr<Catalog_Namespace::Catalog> catalog;
+    size_t row_count{0};
+    std::chrono::steady_clock::time_point first_append;
+    // no load left in line to commit the rows
+    bool abandoned{false};
+    std::shared_ptr<std::promise<void>> committed;
+    std::shared_future<void> committed_future;
+  };
+
+  std::optional<PendingTable> takePendingTable(const TableKey& table_key);
+
+  // Takes a load out of the queue of its table, returning true if it was the last one.
+  // The caller holds pending_tables_mutex_.
+  bool dequeueLoad(QueuedLoad& queued_load);
+
+  // Commits the pending rows of a table after taking the locks appends hold.
+  void lockAndCommit(const TableKey& table_key,
+                     const Catalog_Namespace::Catalog& catalog);
+
+  // Checkpoints a table, whose locks the caller holds, and completes the loads waiting
+  // on its pending rows.
+  static void commit(const TableKey& table_key, const PendingTable& pending_table);
+
+  void commitDueTables();
+
+  std::mutex pending_tables_mutex_;
+  std::condition_variable pending_tables_cv_;
+  std::map<TableKey, PendingTable> pending_tables_;
+  std::map<TableKey, size_t> queued_loads_;
+  bool stop_;
+  std::thread committer_;
+};
+
+}  // namespace import_export
@@ -546,6 +546,20 @@ void TypedImportBuffer::addDictEncodedString(const std::vector<std::string>& str
   }
 }
 
+// Note: default copy_params.null_str is "\N", but everyone uses "NULL".
+// So initially nullness may be missed and not passed to add_value,
+// which then might also check and still decide it's actually a NULL, e.g.
+// if kINT doesn't start with a digit or a '-' then it's considered NULL.
+// So "NULL" is not recognized as NULL but then it's not recognized as
+// a valid kINT, so it's a NULL after all.
+// Checking for "NULL" here too, as a widely accepted notation for NULL.
+// Empty fields of non string columns are NULL too.
+static bool is_null_field(const SQLTypeInfo& ti,
+                          const std::string_view val,
+                          const CopyParams& copy_params) {
+  return val == copy_params.null_str || val == "NULL" || (!ti.is_string() && val.empty());
+}
+
 void TypedImportBuffer::add_value(const ColumnDescriptor* cd,
                                   const std::string_view val,
                                   const bool is_null,
@@ -803,6 +817,127 @@ void TypedImportBuffer::pop_value() {
   }
 }
 
+bool TypedImportBuffer::is_batch_convertible(const SQLTypeInfo& ti) {
+  switch (ti.get_type()) {
+    case kTINYINT:
+    case kSMALLINT:
+    case kINT:
+    case kBIGINT:
+    case kFLOAT:
+    case kDOUBLE:
+    case kTIME:
+    case kTIMESTAMP:
+    case kDATE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+void TypedImportBuffer::convert_values(
+    const std::vector<std::vector<std::string_view>>& rows,
+    const size_t field_idx,
+    const CopyParams& copy_params,
+    std::vector<std::string>& row_errors) {
+  CHECK_EQ(rows.size(), row_errors.size());
+  auto ti = column_desc_->columnType;
+  CHECK(is_batch_convertible(ti));
+  const auto type = ti.get_type();
+  const bool is_fp = type == kFLOAT || type == kDOUBLE;
+  converted_int_values_.clear();
+  converted_fp_values_.clear();
+  if (is_fp) {
+    converted_fp_values_.resize(rows.size());
+  } else {
+    converted_int_values_.resize(rows.size());
+  }
+  // same null handling and leading character checks as add_value
+  for (size_t row_idx = 0; row_idx < rows.size(); ++row_idx) {
+    const auto val = rows[row_idx][field_idx];
+    if (!is_null_field(ti, val, copy_params) &&
+        (isdigit(val[0]) || val[0] == '-' || (is_fp && val[0] == '.'))) {
+      try {
+        if (is_fp) {
+          converted_fp_values_[row_idx] = std::atof(std::string(val).c_str());
+        } else {
+          const auto d = StringToDatum(val, ti);
+          switch (type) {
+            case kTINYINT:
+              converted_int_values_[row_idx] = d.tinyintval;
+              break;
+            case kSMALLINT:
+              converted_int_values_[row_idx] = d.smallintval;
+              break;
+            case kINT:
+              converted_int_values_[row_idx] = d.intval;
+              break;
+            default:
+              converted_int_values_[row_idx] = d.bigintval;
+          }
+        }
+      } catch (const std::exception& e) {
+        if (row_errors[row_idx].empty()) {
+          row_errors[row_idx] = e.what();
+        }
+      }
+    } else if (ti.get_notnull()) {
+      if (row_errors[row_idx].empty()) {
+        row_errors[row_idx] = "NULL for column " + column_desc_->columnName;
+      }
+    } else if (is_fp) {
+      converted_fp_values_[row_idx] = type == kFLOAT ? NULL_FLOAT : NULL_DOUBLE;
+    } else {
+      converted_int_values_[row_idx] = inline_fixed_encoding_null_val(ti);
+    }
+  }
+}
+
+namespace {
+
+template <typename BUFFER_TYPE, typename VALUE_TYPE>
+void append_converted_values(std::vector<BUFFER_TYPE>& buffer,
+                             const std::vector<VALUE_TYPE>& values,
+                             const std::vector<std::string>& row_errors) {
+  CHECK_EQ(values.size(), row_errors.size());
+  buffer.reserve(buffer.size() + values.size());
+  for (size_t row_idx = 0; row_idx < values.size(); ++row_idx) {
+    if (row_errors[row_idx].empty()) {
+      buffer.push_back(static_cast<BUFFER_TYPE>(values[row_idx]));
+    }
+  }
+}
+
+}  // namespace
+
+void TypedImportBuffer::add_converted_values(const std::vector<std::string>& row_errors) {
+  switch (column_desc_->columnType.get_type()) {
+    case kTINYINT:
+      append_converted_values(*tinyint_buffer_, converted_int_values_, row_errors);
+      break;
+    case kSMALLINT:
+      append_converted_values(*smallint_buffer_, converted_int_values_, row_errors);
+      break;
+    case kINT:
+      append_converted_values(*int_buffer_, converted_int_values_, row_errors);
+      break;
+    case kBIGINT:
+    case kTIME:
+    case kTIMESTAMP:
+    case kDATE:
+      append_converted_values(*bigint_buffer_, converted_int_values_, row_errors);
+      break;
+    case kFLOAT:
+      append_converted_values(*float_buffer_, converted_fp_values_, row_errors);
+      break;
+    case kDOUBLE:
+      append_converted_values(*double_buffer_, converted_fp_values_, row_errors);
+      break;
+    default:
+      CHECK(false) << "TypedImportBuffer::add_converted_values() does not support type "
+                   << column_desc_->columnType.get_type();
+  }
+}
+
 struct GeoImportException : std::runtime_error {
   using std::runtime_error::runtime_error;
 };
@@ -1894,6 +2029,85 @@ static ImportStatus import_thread_delimited(
     for (const auto& p : import_buffers) {
       p->clear();
     }
+
+    // Without geo columns, which may consume two fields or explode a row, the rows are
+    // imported in blocks, converting the integer, floating point and datetime fields of
+    // each block column by column rather than row by row.
+    std::vector<bool> is_batch_converted;
+    for (const auto cd : col_descs) {
+      is_batch_converted.push_back(
+          TypedImportBuffer::is_batch_convertible(cd->columnType));
+    }
+    const bool import_in_blocks =
+        phys_cols == 0 && !copy_params.geo_explode_collections &&
+        std::find(is_batch_converted.begin(), is_batch_converted.end(), true) !=
+            is_batch_converted.end();
+    constexpr size_t max_block_rows = 1024;
+    std::vector<std::vector<std::string_view>> block_rows;
+    std::vector<std::unique_ptr<char[]>> block_tmp_buffers;
+    auto import_block = [&]() {
+      std::vector<std::string> row_errors(block_rows.size());
+      for (size_t col_idx = 0; col_idx < import_buffers.size(); ++col_idx) {
+        if (is_batch_converted[col_idx]) {
+          import_buffers[col_idx]->convert_values(
+              block_rows, col_idx, copy_params, row_errors);
+        }
+      }
+      for (size_t row_idx = 0; row_idx < block_rows.size(); ++row_idx) {
+        const auto& block_row = block_rows[row_idx];
+        if (row_errors[row_idx].empty()) {
+          size_t col_idx = 0;
+          try {
+            for (const auto cd : col_descs) {
+              if (!is_batch_converted[col_idx]) {
+                const auto& field = block_row[col_idx];
+                import_buffers[col_idx]->add_value(
+                    cd,
+                    field,
+                    is_null_field(cd->columnType, field, copy_params),
+                    copy_params);
+              }
+              ++col_idx;
+            }
+          } catch (const std::exception& e) {
+            for (size_t col_idx_to_pop = 0; col_idx_to_pop < col_idx; ++col_idx_to_pop) {
+              if (!is_batch_converted[col_idx_to_pop]) {
+                import_buffers[col_idx_to_pop]->pop_value();
+              }
+            }
+            row_errors[row_idx] = e.what();
+          }
+        }
+        if (!row_errors[row_idx].empty()) {
+          thread_import_status.rows_rejected++;
+          LOG(ERROR) << "Input exception thrown: " << row_errors[row_idx]
+                     << ". Row discarded. Data: " << shared::printContainer(block_row);
+          if (thread_import_status.rows_rejected > copy_params.max_reject) {
+            LOG(ERROR) << "Load was cancelled due to max reject rows being reached";
+            thread_import_status.load_failed = true;
+            thread_import_status.load_msg =
+                "Load was cancelled due to max reject rows being reached";
+            return;
+          }
+          continue;
+        }
+        if (UNLIKELY((thread_import_status.rows_completed & 0xFFFF) == 0 &&
+                     checkInterrupt(query_session, executor))) {
+          thread_import_status.load_failed = true;
+          thread_import_status.load_msg = "Table load was cancelled via Query Interrupt";
+          return;
+        }
+        thread_import_status.rows_completed++;
+      }
+      for (size_t col_idx = 0; col_idx < import_buffers.size(); ++col_idx) {
+        if (is_batch_converted[col_idx]) {
+          import_buffers[col_idx]->add_converted_values(row_errors);
+        }
+      }
+      block_rows.clear();
+      block_tmp_buffers.clear();
+    };
+
     std::vector<std::string_view> row;
     size_t row_index_plus_one = 0;
     for (const char* p = thread_buf; p < thread_buf_end; p++) {
@@ -1936,6 +2150,21 @@ static ImportStatus import_thread_delimited(
         continue;
       }
 
+      if (import_in_blocks) {
+        block_rows.push_back(std::move(row));
+        row.clear();
+        std::move(tmp_buffers.begin(),
+                  tmp_buffers.end(),
+                  std::back_inserter(block_tmp_buffers));
+        if (block_rows.size() == max_block_rows) {
+          us = measure<std::chrono::microseconds>::execution(import_block);
+          if (thread_import_status.load_failed) {
+            break;
+          }
+        }
+        continue;
+      }
+
       //
       // lambda for importing a row (perhaps multiple times if exploding a collection)
       //
@@ -1948,20 +2177,7 @@ static ImportStatus import_thread_delimited(
             auto cd = *cd_it;
             const auto& col_ti = cd->columnType;
 
-            bool is_null =
-                (row[import_idx] == copy_params.null_str || row[import_idx] == "NULL");
-            // Note: default copy_params.null_str is "\N", but everyone uses "NULL".
-            // So initially nullness may be missed and not passed to add_value,
-            // which then might also check and still decide it's actually a NULL, e.g.
-            // if kINT doesn't start with a digit or a '-' then it's considered NULL.
-            // So "NULL" is not recognized as NULL but then it's not recognized as
-            // a valid kINT, so it's a NULL after all.
-            // Checking for "NULL" here too, as a widely accepted notation for NULL.
-
-            // Treating empty as NULL
-            if (!cd->columnType.is_string() && row[import_idx].empty()) {
-              is_null = true;
-            }
+            const bool is_null = is_null_field(col_ti, row[import_idx], copy_params);
 
             if (col_ti.get_physical_cols() == 0) {
               // not geo
@@ -2193,6 +2409,9 @@ static ImportStatus import_thread_delimited(
         break;
       }
     }  // end thread
+    if (!thread_import_status.load_failed && !block_rows.empty()) {
+      us = measure<std::chrono::microseconds>::execution(import_block);
+    }
     total_str_to_val_time_us += us;
     if (!thread_import_status.load_failed && thread_import_status.rows_completed > 0) {
       load_ms = measure<>::execution([&]() {
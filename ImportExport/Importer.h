@@ -466,6 +466,18 @@ class TypedImportBuffer : boost::noncopyable {
 
   void pop_value();
 
+  // Column-wise counterpart of add_value for the integer, floating point and datetime
+  // columns of a block of delimited rows. convert_values converts the field of the column
+  // in each row and records the error of the rows whose field can't be converted, then
+  // add_converted_values appends the values of the rows left without an error once all
+  // the columns of the block have been converted, so a bad row is discarded whole.
+  static bool is_batch_convertible(const SQLTypeInfo& ti);
+  void convert_values(const std::vector<std::vector<std::string_view>>& rows,
+                      const size_t field_idx,
+                      const CopyParams& copy_params,
+                      std::vector<std::string>& row_errors);
+  void add_converted_values(const std::vector<std::string>& row_errors);
+
   template <typename DATA_TYPE>
   size_t convert_arrow_val_to_import_buffer(const ColumnDescriptor* cd,
                                             const arrow::Array& array,
@@ -504,6 +516,9 @@ class TypedImportBuffer : boost::noncopyable {
   };
   const ColumnDescriptor* column_desc_;
   StringDictionary* string_dict_;
+  // values of the last block converted by convert_values
+  std::vector<int64_t> converted_int_values_;
+  std::vector<double> converted_fp_values_;
 };
 
 class Loader {
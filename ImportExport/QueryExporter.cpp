@@ -38,6 +38,12 @@ std::unique_ptr<QueryExporter> QueryExporter::create(FileType file_type) {
   return nullptr;
 }
 
+void QueryExporter::exportRow(const std::vector<TargetValue>& row,
+                              const std::vector<TargetMetaInfo>& column_infos) {
+  throw std::runtime_error(
+      "Exporting a stream of rows is not supported for this file type");
+}
+
 void QueryExporter::validateFileExtensions(
     const std::string& file_path,
     const std::string& file_type,
@@ -18,6 +18,7 @@
 
 #include <Distributed/AggregatedResult.h>
 #include <ImportExport/CopyParams.h>
+#include <QueryEngine/TargetValue.h>
 
 #include <string>
 #include <unordered_set>
@@ -48,6 +49,10 @@ class QueryExporter {
                            const FileCompression file_compression,
                            const ArrayNullHandling array_null_handling) = 0;
   virtual void exportResults(const std::vector<AggregatedResult>& query_results) = 0;
+  // Exports a row streamed from outside of a result set, e.g. merged from sorted runs
+  // spilled to disk, as returned by ResultSet::getNextRow(true, true).
+  virtual void exportRow(const std::vector<TargetValue>& row,
+                         const std::vector<TargetMetaInfo>& column_infos);
   virtual void endExport() = 0;
 
  protected:
@@ -146,120 +146,125 @@ void QueryExporterCSV::exportResults(const std::vector<AggregatedResult>& query_
       if (crt_row.empty()) {
         break;
       }
-      bool not_first = false;
-      for (size_t i = 0; i < results->colCount(); ++i) {
-        bool is_null{false};
-        auto const tv = crt_row[i];
-        auto const scalar_tv = boost::get<ScalarTargetValue>(&tv);
-        if (not_first) {
-          outfile_ << copy_params_.delimiter;
-        } else {
-          not_first = true;
-        }
-        if (copy_params_.quoted) {
-          outfile_ << copy_params_.quote;
-        }
-        auto const& ti = targets[i].get_type_info();
-        if (!scalar_tv) {
-          outfile_ << target_value_to_string(crt_row[i], ti, " | ");
-          if (copy_params_.quoted) {
-            outfile_ << copy_params_.quote;
-          }
-          continue;
-        }
-        if (boost::get<int64_t>(scalar_tv)) {
-          auto int_val = *(boost::get<int64_t>(scalar_tv));
-          switch (ti.get_type()) {
-            case kBOOLEAN:
-              is_null = (int_val == NULL_BOOLEAN);
-              break;
-            case kTINYINT:
-              is_null = (int_val == NULL_TINYINT);
-              break;
-            case kSMALLINT:
-              is_null = (int_val == NULL_SMALLINT);
-              break;
-            case kINT:
-              is_null = (int_val == NULL_INT);
-              break;
-            case kBIGINT:
-              is_null = (int_val == NULL_BIGINT);
-              break;
-            case kTIME:
-            case kTIMESTAMP:
-            case kDATE:
-              is_null = (int_val == NULL_BIGINT);
-              break;
-            default:
-              is_null = false;
-          }
-          if (is_null) {
-            outfile_ << copy_params_.null_str;
-          } else if (ti.get_type() == kTIME) {
-            constexpr size_t buf_size = 9;
-            char buf[buf_size];
-            size_t const len = shared::formatHMS(buf, buf_size, int_val);
-            CHECK_EQ(8u, len);  // 8 == strlen("HH:MM:SS")
-            outfile_ << buf;
-          } else {
-            outfile_ << int_val;
-          }
-        } else if (boost::get<double>(scalar_tv)) {
-          auto real_val = *(boost::get<double>(scalar_tv));
-          if (ti.get_type() == kFLOAT) {
-            is_null = (real_val == NULL_FLOAT);
-          } else {
-            is_null = (real_val == NULL_DOUBLE);
-          }
-          if (is_null) {
-            outfile_ << copy_params_.null_str;
-          } else if (ti.get_type() == kNUMERIC) {
-            outfile_ << std::setprecision(ti.get_precision()) << real_val;
-          } else {
-            outfile_ << std::setprecision(std::numeric_limits<double>::digits10 + 1)
-                     << real_val;
-          }
-        } else if (boost::get<float>(scalar_tv)) {
-          CHECK_EQ(kFLOAT, ti.get_type());
-          auto real_val = *(boost::get<float>(scalar_tv));
-          if (real_val == NULL_FLOAT) {
-            outfile_ << copy_params_.null_str;
-          } else {
-            outfile_ << std::setprecision(std::numeric_limits<float>::digits10 + 1)
-                     << real_val;
-          }
+      exportRow(crt_row, targets);
+    }
+  }
+}
+
+void QueryExporterCSV::exportRow(const std::vector<TargetValue>& crt_row,
+                                 const std::vector<TargetMetaInfo>& targets) {
+  bool not_first = false;
+  for (size_t i = 0; i < crt_row.size(); ++i) {
+    bool is_null{false};
+    auto const tv = crt_row[i];
+    auto const scalar_tv = boost::get<ScalarTargetValue>(&tv);
+    if (not_first) {
+      outfile_ << copy_params_.delimiter;
+    } else {
+      not_first = true;
+    }
+    if (copy_params_.quoted) {
+      outfile_ << copy_params_.quote;
+    }
+    auto const& ti = targets[i].get_type_info();
+    if (!scalar_tv) {
+      outfile_ << target_value_to_string(crt_row[i], ti, " | ");
+      if (copy_params_.quoted) {
+        outfile_ << copy_params_.quote;
+      }
+      continue;
+    }
+    if (boost::get<int64_t>(scalar_tv)) {
+      auto int_val = *(boost::get<int64_t>(scalar_tv));
+      switch (ti.get_type()) {
+        case kBOOLEAN:
+          is_null = (int_val == NULL_BOOLEAN);
+          break;
+        case kTINYINT:
+          is_null = (int_val == NULL_TINYINT);
+          break;
+        case kSMALLINT:
+          is_null = (int_val == NULL_SMALLINT);
+          break;
+        case kINT:
+          is_null = (int_val == NULL_INT);
+          break;
+        case kBIGINT:
+          is_null = (int_val == NULL_BIGINT);
+          break;
+        case kTIME:
+        case kTIMESTAMP:
+        case kDATE:
+          is_null = (int_val == NULL_BIGINT);
+          break;
+        default:
+          is_null = false;
+      }
+      if (is_null) {
+        outfile_ << copy_params_.null_str;
+      } else if (ti.get_type() == kTIME) {
+        constexpr size_t buf_size = 9;
+        char buf[buf_size];
+        size_t const len = shared::formatHMS(buf, buf_size, int_val);
+        CHECK_EQ(8u, len);  // 8 == strlen("HH:MM:SS")
+        outfile_ << buf;
+      } else {
+        outfile_ << int_val;
+      }
+    } else if (boost::get<double>(scalar_tv)) {
+      auto real_val = *(boost::get<double>(scalar_tv));
+      if (ti.get_type() == kFLOAT) {
+        is_null = (real_val == NULL_FLOAT);
+      } else {
+        is_null = (real_val == NULL_DOUBLE);
+      }
+      if (is_null) {
+        outfile_ << copy_params_.null_str;
+      } else if (ti.get_type() == kNUMERIC) {
+        outfile_ << std::setprecision(ti.get_precision()) << real_val;
+      } else {
+        outfile_ << std::setprecision(std::numeric_limits<double>::digits10 + 1)
+                 << real_val;
+      }
+    } else if (boost::get<float>(scalar_tv)) {
+      CHECK_EQ(kFLOAT, ti.get_type());
+      auto real_val = *(boost::get<float>(scalar_tv));
+      if (real_val == NULL_FLOAT) {
+        outfile_ << copy_params_.null_str;
+      } else {
+        outfile_ << std::setprecision(std::numeric_limits<float>::digits10 + 1)
+                 << real_val;
+      }
+    } else {
+      auto s = boost::get<NullableString>(scalar_tv);
+      is_null = !s || boost::get<void*>(s);
+      if (is_null) {
+        outfile_ << copy_params_.null_str;
+      } else {
+        auto s_notnull = boost::get<std::string>(s);
+        CHECK(s_notnull);
+        if (!copy_params_.quoted) {
+          outfile_ << *s_notnull;
         } else {
-          auto s = boost::get<NullableString>(scalar_tv);
-          is_null = !s || boost::get<void*>(s);
-          if (is_null) {
-            outfile_ << copy_params_.null_str;
+          size_t q = s_notnull->find(copy_params_.quote);
+          if (q == std::string::npos) {
+            outfile_ << *s_notnull;
           } else {
-            auto s_notnull = boost::get<std::string>(s);
-            CHECK(s_notnull);
-            if (!copy_params_.quoted) {
-              outfile_ << *s_notnull;
-            } else {
-              size_t q = s_notnull->find(copy_params_.quote);
-              if (q == std::string::npos) {
-                outfile_ << *s_notnull;
-              } else {
-                std::string str(*s_notnull);
-                while (q != std::string::npos) {
-                  str.insert(q, 1, copy_params_.escape);
-                  q = str.find(copy_params_.quote, q + 2);
-                }
-                outfile_ << str;
-              }
+            std::string str(*s_notnull);
+            while (q != std::string::npos) {
+              str.insert(q, 1, copy_params_.escape);
+              q = str.find(copy_params_.quote, q + 2);
             }
+            outfile_ << str;
           }
         }
-        if (copy_params_.quoted) {
-          outfile_ << copy_params_.quote;
-        }
       }
-      outfile_ << copy_params_.line_delim;
+    }
+    if (copy_params_.quoted) {
+      outfile_ << copy_params_.quote;
     }
   }
+  outfile_ << copy_params_.line_delim;
 }
 
 void QueryExporterCSV::endExport() {
@@ -34,6 +34,8 @@ class QueryExporterCSV : public QueryExporter {
                    const FileCompression file_compression,
                    const ArrayNullHandling array_null_handling) final;
   void exportResults(const std::vector<AggregatedResult>& query_results) final;
+  void exportRow(const std::vector<TargetValue>& row,
+                 const std::vector<TargetMetaInfo>& column_infos) final;
   void endExport() final;
 
  private:
@@ -61,6 +61,7 @@
 #include "Shared/file_delete.h"
 #include "Shared/scope.h"
 #include "ThriftHandler/ForeignTableRefreshScheduler.h"
+#include "ThriftHandler/SortedTableReclusterScheduler.h"
 
 using namespace ::apache::thrift;
 using namespace ::apache::thrift::concurrency;
@@ -377,6 +378,7 @@ int startMapdServer(CommandLineOptions& prog_config_opts, bool start_http_server
     if (g_enable_fsi) {
       foreign_storage::ForeignTableRefreshScheduler::stop();
     }
+    SortedTableReclusterScheduler::stop();
 
     Catalog_Namespace::SysCatalog::destroy();
 
@@ -457,6 +459,11 @@ int startMapdServer(CommandLineOptions& prog_config_opts, bool start_http_server
     foreign_storage::ForeignTableRefreshScheduler::start(g_running);
   }
 
+  if (g_recluster_interval_seconds > 0 && !prog_config_opts.read_only) {
+    SortedTableReclusterScheduler::setWaitDuration(g_recluster_interval_seconds);
+    SortedTableReclusterScheduler::start(g_running);
+  }
+
   // TCP port setup. We use Thrift both for a TCP socket and for an optional HTTP socket.
   std::shared_ptr<TServerSocket> tcp_socket;
   std::shared_ptr<TServerSocket> http_socket;
@@ -0,0 +1,208 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OSDependent/omnisci_numa.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sched.h>
+#include <sys/syscall.h>
+#endif
+
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Logger/Logger.h"
+
+namespace omnisci {
+
+namespace {
+
+#ifdef __linux__
+// parses the list format of sysfs, e.g. "0-3,8-11"
+std::vector<int> read_sysfs_list(const std::string& path) {
+  std::ifstream file(path);
+  std::string list;
+  if (!file || !std::getline(file, list)) {
+    return {};
+  }
+  std::vector<int> values;
+  std::istringstream ranges(list);
+  std::string range;
+  while (std::getline(ranges, range, ',')) {
+    if (range.empty()) {
+      continue;
+    }
+    const auto dash_pos = range.find('-');
+    try {
+      const int first = std::stoi(range.substr(0, dash_pos));
+      const int last =
+          dash_pos == std::string::npos ? first : std::stoi(range.substr(dash_pos + 1));
+      for (int value = first; value <= last; ++value) {
+        values.push_back(value);
+      }
+    } catch (const std::exception&) {
+      return {};
+    }
+  }
+  return values;
+}
+
+// memory policy modes of mbind(2), see linux/mempolicy.h
+constexpr int kMpolBind{2};
+constexpr int kMpolInterleave{3};
+constexpr size_t kMaxNumaNodes{1024};
+#endif
+
+}  // namespace
+
+std::vector<int> get_numa_nodes() {
+#ifdef __linux__
+  static const std::vector<int> nodes = [] {
+    auto online_nodes = read_sysfs_list("/sys/devices/system/node/online");
+    if (online_nodes.empty()) {
+      online_nodes.push_back(0);
+    }
+    return online_nodes;
+  }();
+  return nodes;
+#else
+  return {0};
+#endif
+}
+
+std::vector<int> get_numa_node_cpus(const int node) {
+#ifdef __linux__
+  return read_sysfs_list("/sys/devices/system/node/node" + std::to_string(node) +
+                         "/cpulist");
+#else
+  return {};
+#endif
+}
+
+void* map_anonymous_memory(const size_t size, const bool use_huge_pages) {
+  void* ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  if (use_huge_pages) {
+    ptr = mmap(nullptr,
+               size,
+               PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,
+               -1,
+               0);
+    if (ptr != MAP_FAILED) {
+      return ptr;
+    }
+    VLOG(1) << "Could not map " << size << " bytes of hugetlbfs pages, falling back to "
+            << "transparent huge pages";
+  }
+#endif
+  ptr = mmap(nullptr,
+             size,
+             PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS,
+             -1,
+             0);
+  if (ptr == MAP_FAILED) {
+    return nullptr;
+  }
+#ifdef MADV_HUGEPAGE
+  if (use_huge_pages) {
+    madvise(ptr, size, MADV_HUGEPAGE);
+  }
+#endif
+  return ptr;
+}
+
+void unmap_anonymous_memory(void* ptr, const size_t size) {
+  CHECK_EQ(0, munmap(ptr, size));
+}
+
+bool set_numa_memory_policy(void* ptr, const size_t size, const int node) {
+#ifdef __linux__
+  std::vector<unsigned long> node_mask(kMaxNumaNodes / (8 * sizeof(unsigned long)));
+  const auto set_node = [&node_mask](const int node) {
+    if (node < 0 || static_cast<size_t>(node) >= kMaxNumaNodes) {
+      return false;
+    }
+    node_mask[node / (8 * sizeof(unsigned long))] |=
+        1UL << (node % (8 * sizeof(unsigned long)));
+    return true;
+  };
+  if (node >= 0) {
+    if (!set_node(node)) {
+      return false;
+    }
+  } else {
+    for (const auto numa_node : get_numa_nodes()) {
+      if (!set_node(numa_node)) {
+        return false;
+      }
+    }
+  }
+  return syscall(SYS_mbind,
+                 ptr,
+                 size,
+                 node >= 0 ? kMpolBind : kMpolInterleave,
+                 node_mask.data(),
+                 kMaxNumaNodes + 1,
+                 0) == 0;
+#else
+  return false;
+#endif
+}
+
+std::vector<int> get_thread_cpu_affinity() {
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+    return {};
+  }
+  std::vector<int> cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpu_set)) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+#else
+  return {};
+#endif
+}
+
+bool set_thread_cpu_affinity(const std::vector<int>& cpus) {
+#ifdef __linux__
+  if (cpus.empty()) {
+    return false;
+  }
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      return false;
+    }
+    CPU_SET(cpu, &cpu_set);
+  }
+  return sched_setaffinity(0, sizeof(cpu_set), &cpu_set) == 0;
+#else
+  return false;
+#endif
+}
+
+}  // namespace omnisci
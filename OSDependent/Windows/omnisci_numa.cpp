@@ -0,0 +1,54 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OSDependent/omnisci_numa.h"
+
+#include <windows.h>
+
+#include "Logger/Logger.h"
+
+namespace omnisci {
+
+std::vector<int> get_numa_nodes() {
+  return {0};
+}
+
+std::vector<int> get_numa_node_cpus(const int node) {
+  return {};
+}
+
+void* map_anonymous_memory(const size_t size, const bool use_huge_pages) {
+  // large pages need the SeLockMemoryPrivilege, use regular pages
+  return VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+}
+
+void unmap_anonymous_memory(void* ptr, const size_t size) {
+  CHECK(VirtualFree(ptr, 0, MEM_RELEASE));
+}
+
+bool set_numa_memory_policy(void* ptr, const size_t size, const int node) {
+  return false;
+}
+
+std::vector<int> get_thread_cpu_affinity() {
+  return {};
+}
+
+bool set_thread_cpu_affinity(const std::vector<int>& cpus) {
+  return false;
+}
+
+}  // namespace omnisci
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace omnisci {
+
+// NUMA nodes of the host, a single node 0 where the topology is not known.
+std::vector<int> get_numa_nodes();
+
+// CPUs of a NUMA node, empty where the topology is not known.
+std::vector<int> get_numa_node_cpus(const int node);
+
+// Maps size bytes of anonymous memory, backed by huge pages if use_huge_pages: from the
+// hugetlbfs pool if it has enough pages, else transparent huge pages. Returns nullptr
+// if the memory can't be mapped.
+void* map_anonymous_memory(const size_t size, const bool use_huge_pages);
+
+void unmap_anonymous_memory(void* ptr, const size_t size);
+
+// Places the pages of memory returned by map_anonymous_memory on a NUMA node, or
+// interleaves them over all nodes for a negative node. Must be called before the memory
+// is first touched. Returns false if the policy can't be set.
+bool set_numa_memory_policy(void* ptr, const size_t size, const int node);
+
+// CPUs the calling thread may run on, empty if they can't be queried.
+std::vector<int> get_thread_cpu_affinity();
+
+// Restricts the calling thread to the given CPUs. Returns false on failure.
+bool set_thread_cpu_affinity(const std::vector<int>& cpus);
+
+}  // namespace omnisci
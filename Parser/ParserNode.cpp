@@ -52,6 +52,7 @@
 #include "Fragmenter/TargetValueConvertersFactories.h"
 #include "Geospatial/Compression.h"
 #include "Geospatial/Types.h"
+#include "ImportExport/GroupCommitMgr.h"
 #include "ImportExport/Importer.h"
 #include "LockMgr/LockMgr.h"
 #include "QueryEngine/CalciteAdapter.h"
@@ -59,6 +60,7 @@
 #include "QueryEngine/ErrorHandling.h"
 #include "QueryEngine/Execute.h"
 #include "QueryEngine/ExtensionFunctionsWhitelist.h"
+#include "QueryEngine/ExternalSort.h"
 #include "QueryEngine/JsonAccessors.h"
 #include "QueryEngine/RelAlgExecutor.h"
 #include "ReservedKeywords.h"
@@ -77,6 +79,7 @@ size_t g_leaf_count{0};
 bool g_test_drop_column_rollback{false};
 extern bool g_enable_experimental_string_functions;
 extern bool g_enable_fsi;
+extern bool g_enable_page_compression;
 
 using Catalog_Namespace::SysCatalog;
 using namespace std::string_literals;
@@ -2198,6 +2201,17 @@ decltype(auto) get_max_rollback_epochs_def(TableDescriptor& td,
       p, assignment);
 }
 
+decltype(auto) get_compression_def(TableDescriptor& td,
+                                   const NameValueAssign* p,
+                                   const std::list<ColumnDescriptor>& columns) {
+  return get_property_value<StringLiteral>(p, [&td](const auto compression_uc) {
+    if (compression_uc != "BLOSC" && compression_uc != "NONE") {
+      throw std::runtime_error("COMPRESSION must be BLOSC or NONE");
+    }
+    td.pageCompression = compression_uc == "BLOSC";
+  });
+}
+
 static const std::map<const std::string, const TableDefFuncPtr> tableDefFuncMap = {
     {"fragment_size"s, get_frag_size_def},
     {"max_chunk_size"s, get_max_chunk_size_def},
@@ -2208,7 +2222,8 @@ static const std::map<const std::string, const TableDefFuncPtr> tableDefFuncMap
     {"vacuum"s, get_vacuum_def},
     {"sort_column"s, get_sort_column_def},
     {"storage_type"s, get_storage_type},
-    {"max_rollback_epochs", get_max_rollback_epochs_def}};
+    {"max_rollback_epochs", get_max_rollback_epochs_def},
+    {"compression"s, get_compression_def}};
 
 void get_table_definitions(TableDescriptor& td,
                            const std::unique_ptr<NameValueAssign>& p,
@@ -2219,7 +2234,7 @@ void get_table_definitions(TableDescriptor& td,
         "Invalid CREATE TABLE option " + *p->get_name() +
         ". Should be FRAGMENT_SIZE, MAX_CHUNK_SIZE, PAGE_SIZE, MAX_ROLLBACK_EPOCHS, "
         "MAX_ROWS, "
-        "PARTITIONS, SHARD_COUNT, VACUUM, SORT_COLUMN, STORAGE_TYPE.");
+        "PARTITIONS, SHARD_COUNT, VACUUM, SORT_COLUMN, STORAGE_TYPE, COMPRESSION.");
   }
   return it->second(td, p.get(), columns);
 }
@@ -2233,7 +2248,7 @@ void get_table_definitions_for_ctas(TableDescriptor& td,
         "Invalid CREATE TABLE AS option " + *p->get_name() +
         ". Should be FRAGMENT_SIZE, MAX_CHUNK_SIZE, PAGE_SIZE, MAX_ROLLBACK_EPOCHS, "
         "MAX_ROWS, "
-        "PARTITIONS, SHARD_COUNT, VACUUM, SORT_COLUMN, STORAGE_TYPE or "
+        "PARTITIONS, SHARD_COUNT, VACUUM, SORT_COLUMN, STORAGE_TYPE, COMPRESSION or "
         "USE_SHARED_DICTIONARIES.");
   }
   return it->second(td, p.get(), columns);
@@ -2655,8 +2670,11 @@ std::shared_ptr<ResultSet> getResultSet(QueryStateProxy query_state_proxy,
   return result.getRows();
 }
 
-size_t LocalConnector::getOuterFragmentCount(QueryStateProxy query_state_proxy,
-                                             std::string& sql_query_string) {
+namespace {
+
+size_t get_outer_fragment_count(QueryStateProxy query_state_proxy,
+                                std::string& sql_query_string,
+                                std::list<Analyzer::OrderEntry>* order_entries) {
   auto const session = query_state_proxy.getQueryState().getConstSessionInfo();
   auto& catalog = session->getCatalog();
 
@@ -2697,7 +2715,22 @@ size_t LocalConnector::getOuterFragmentCount(QueryStateProxy query_state_proxy,
                          false,
                          0.9,
                          false};
-  return ra_executor.getOuterFragmentCount(co, eo);
+  return order_entries ? ra_executor.getSortedOuterFragmentCount(co, eo, *order_entries)
+                       : ra_executor.getOuterFragmentCount(co, eo);
+}
+
+}  // namespace
+
+size_t LocalConnector::getOuterFragmentCount(QueryStateProxy query_state_proxy,
+                                             std::string& sql_query_string) {
+  return get_outer_fragment_count(query_state_proxy, sql_query_string, nullptr);
+}
+
+size_t LocalConnector::getSortedOuterFragmentCount(
+    QueryStateProxy query_state_proxy,
+    std::string& sql_query_string,
+    std::list<Analyzer::OrderEntry>& order_entries) {
+  return get_outer_fragment_count(query_state_proxy, sql_query_string, &order_entries);
 }
 
 AggregatedResult LocalConnector::query(QueryStateProxy query_state_proxy,
@@ -3392,6 +3425,10 @@ void InsertIntoTableAsSelectStmt::execute(const Catalog_Namespace::SessionInfo&
   }
 
   const TableDescriptor* td = catalog.getMetadataForTable(table_name_);
+  if (td) {
+    // so that a failed insert only rolls back its own rows
+    import_export::GroupCommitMgr::instance().commitPendingRows(catalog, td->tableId);
+  }
   try {
     populateData(query_state->createQueryStateProxy(), td, true, false);
   } catch (...) {
@@ -3516,6 +3553,7 @@ void CreateTableAsSelectStmt::execute(const Catalog_Namespace::SessionInfo& sess
     td.fragPageSize = DEFAULT_PAGE_SIZE;
     td.maxRows = DEFAULT_MAX_ROWS;
     td.maxRollbackEpochs = DEFAULT_MAX_ROLLBACK_EPOCHS;
+    td.pageCompression = g_enable_page_compression;
     if (is_temporary_) {
       td.persistenceLevel = Data_Namespace::MemoryLevel::CPU_LEVEL;
     } else {
@@ -4479,6 +4517,8 @@ void CopyTableStmt::execute(const Catalog_Namespace::SessionInfo& session,
                                session.get_currentUser().userLoggable() +
                                " has no insert privileges for table " + *table + ".");
     }
+    // so that a failed import only rolls back its own rows
+    import_export::GroupCommitMgr::instance().commitPendingRows(catalog, td->tableId);
   }
 
   // since we'll have not only posix file names but also s3/hdfs/... url
@@ -5277,8 +5317,14 @@ void ExportQueryStmt::execute(const Catalog_Namespace::SessionInfo& session) {
       import_export::QueryExporter::FileCompression::kNone;
   import_export::QueryExporter::ArrayNullHandling array_null_handling =
       import_export::QueryExporter::ArrayNullHandling::kAbortWithWarning;
+  size_t sort_memory_budget{g_external_sort_memory_budget};
 
-  parseOptions(copy_params, file_type, layer_name, file_compression, array_null_handling);
+  parseOptions(copy_params,
+               file_type,
+               layer_name,
+               file_compression,
+               array_null_handling,
+               sort_memory_budget);
 
   if (file_path->empty()) {
     throw std::runtime_error("Invalid file path for COPY TO");
@@ -5318,6 +5364,24 @@ void ExportQueryStmt::execute(const Catalog_Namespace::SessionInfo& session) {
                               file_compression,
                               array_null_handling);
 
+  // an ORDER BY over several fragments is sorted externally, unless it fits in memory
+  if (g_enable_external_sort && leafs_connector_ == &local_connector &&
+      file_type == import_export::QueryExporter::FileType::kCSV) {
+    std::list<Analyzer::OrderEntry> order_entries;
+    const auto sorted_frag_count = local_connector.getSortedOuterFragmentCount(
+        query_state_proxy, *select_stmt, order_entries);
+    if (sorted_frag_count > 1 && exportSortedRuns(query_state_proxy,
+                                                  local_connector,
+                                                  *query_exporter,
+                                                  column_info_result.targets_meta,
+                                                  order_entries,
+                                                  sorted_frag_count,
+                                                  sort_memory_budget)) {
+      query_exporter->endExport();
+      return;
+    }
+  }
+
   // how many fragments?
   size_t outer_frag_count =
       leafs_connector_->getOuterFragmentCount(query_state_proxy, *select_stmt);
@@ -5343,12 +5407,59 @@ void ExportQueryStmt::execute(const Catalog_Namespace::SessionInfo& session) {
   query_exporter->endExport();
 }
 
+bool ExportQueryStmt::exportSortedRuns(
+    QueryStateProxy query_state_proxy,
+    LocalConnector& local_connector,
+    import_export::QueryExporter& query_exporter,
+    const std::vector<TargetMetaInfo>& targets,
+    const std::list<Analyzer::OrderEntry>& order_entries,
+    const size_t outer_frag_count,
+    const size_t sort_memory_budget) {
+  external_sort::SortedRuns sorted_runs(targets, order_entries);
+  size_t frags_per_run{1};
+  for (size_t outer_frag_idx = 0; outer_frag_idx < outer_frag_count;) {
+    std::vector<size_t> allowed_outer_fragment_indices;
+    while (allowed_outer_fragment_indices.size() < frags_per_run &&
+           outer_frag_idx < outer_frag_count) {
+      allowed_outer_fragment_indices.push_back(outer_frag_idx++);
+    }
+
+    // the query sorts the fragments of a run in memory
+    auto run_result = local_connector.query(
+        query_state_proxy, *select_stmt, allowed_outer_fragment_indices, false, false);
+    CHECK(run_result.rs);
+    const auto run_bytes = sorted_runs.spill(*run_result.rs);
+    if (sorted_runs.getRunCount() == 1) {
+      // size the runs after the first fragment, a run is held both as the result of its
+      // query and as the records to spill
+      const auto frag_bytes = std::max(run_bytes, size_t(1));
+      if (frag_bytes * outer_frag_count <= sort_memory_budget) {
+        return false;
+      }
+      frags_per_run = std::max(sort_memory_budget / (2 * frag_bytes), size_t(1));
+    }
+  }
+
+  LOG(INFO) << "Merging " << sorted_runs.getRunCount() << " sorted runs of "
+            << sorted_runs.getRowCount() << " rows in total for export";
+  auto run_merger = sorted_runs.merge(sort_memory_budget);
+  while (true) {
+    const auto row = run_merger->getNextRow();
+    if (row.empty()) {
+      break;
+    }
+    query_exporter.exportRow(row, targets);
+  }
+  return true;
+}
+
 void ExportQueryStmt::parseOptions(
     import_export::CopyParams& copy_params,
     import_export::QueryExporter::FileType& file_type,
     std::string& layer_name,
     import_export::QueryExporter::FileCompression& file_compression,
-    import_export::QueryExporter::ArrayNullHandling& array_null_handling) {
+    import_export::QueryExporter::ArrayNullHandling& array_null_handling,
+    size_t& sort_memory_budget) {
   // defaults for non-CopyParams values
   file_type = import_export::QueryExporter::FileType::kCSV;
   layer_name.clear();
@@ -5485,6 +5596,13 @@ void ExportQueryStmt::parseOptions(
               "Array Null Handling option must be 'Abort', 'Raw', 'Zero', or "
               "'NullField'");
         }
+      } else if (boost::iequals(*p->get_name(), "sort_memory_budget")) {
+        const IntLiteral* int_literal = dynamic_cast<const IntLiteral*>(p->get_value());
+        if (int_literal == nullptr || int_literal->get_intval() <= 0) {
+          throw std::runtime_error(
+              "Sort Memory Budget option must be a positive integer.");
+        }
+        sort_memory_budget = int_literal->get_intval();
       } else {
         throw std::runtime_error("Invalid option for COPY: " + *p->get_name());
       }
@@ -1018,6 +1018,12 @@ struct LocalConnector : public DistributedConnector {
 
   size_t getOuterFragmentCount(QueryStateProxy, std::string& sql_query_string) override;
 
+  // The outer fragment count of a query ordered without a limit or an offset, or zero
+  // for any other query, see RelAlgExecutor::getSortedOuterFragmentCount().
+  size_t getSortedOuterFragmentCount(QueryStateProxy,
+                                     std::string& sql_query_string,
+                                     std::list<Analyzer::OrderEntry>& order_entries);
+
   AggregatedResult query(QueryStateProxy,
                          std::string& sql_query_string,
                          std::vector<size_t> outer_frag_indices,
@@ -1225,6 +1231,15 @@ class OptimizeTableStmt : public DDLStmt {
     return false;
   }
 
+  bool shouldReclusterSortedRows() const {
+    for (const auto& e : options_) {
+      if (boost::iequals(*(e->get_name()), "RECLUSTER")) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   void execute(const Catalog_Namespace::SessionInfo& session) override {
     // Should pass optimize params to the table optimizer
     CHECK(false);
@@ -1884,7 +1899,20 @@ class ExportQueryStmt : public DDLStmt {
                     import_export::QueryExporter::FileType& file_type,
                     std::string& layer_name,
                     import_export::QueryExporter::FileCompression& file_compression,
-                    import_export::QueryExporter::ArrayNullHandling& array_null_handling);
+                    import_export::QueryExporter::ArrayNullHandling& array_null_handling,
+                    size_t& sort_memory_budget);
+
+  // Exports an ORDER BY over several outer fragments through an external sort: groups
+  // of fragments are sorted by the query and spilled as runs, which are then merged
+  // into the exporter. Returns false, having exported nothing, if the first fragment
+  // shows the whole result fits the sort memory budget.
+  bool exportSortedRuns(QueryStateProxy query_state_proxy,
+                        LocalConnector& local_connector,
+                        import_export::QueryExporter& query_exporter,
+                        const std::vector<TargetMetaInfo>& targets,
+                        const std::list<Analyzer::OrderEntry>& order_entries,
+                        const size_t outer_frag_count,
+                        const size_t sort_memory_budget);
 };
 
 /*
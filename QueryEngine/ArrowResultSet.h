@@ -23,7 +23,10 @@
 #include "TargetMetaInfo.h"
 #include "TargetValue.h"
 
+#include <future>
+#include <mutex>
 #include <type_traits>
+#include <unordered_map>
 
 #include "arrow/api.h"
 #include "arrow/ipc/api.h"
@@ -205,6 +208,9 @@ class ArrowResultSetConverter {
     std::unique_ptr<arrow::ArrayBuilder> builder;
     SQLTypeInfo col_type;
     SQLTypes physical_type;
+    // Shared string dictionary for dictionary encoded columns, whose builder then
+    // only collects the indices.
+    std::shared_ptr<arrow::Array> dictionary;
   };
 
   ArrowResultSetConverter(const std::shared_ptr<ResultSet>& results,
@@ -214,9 +220,27 @@ class ArrowResultSetConverter {
 
   std::shared_ptr<arrow::RecordBatch> convertToArrow() const;
 
+  // Converts only the result set entries in [begin_entry, end_entry). Batches converted
+  // by the same converter share their string dictionaries.
+  std::shared_ptr<arrow::RecordBatch> convertToArrow(const size_t begin_entry,
+                                                     const size_t end_entry) const;
+
+  std::shared_ptr<arrow::Schema> getSchema() const;
+
+  // Number of result set entries to convert, taking first_n into account.
+  size_t getEntryLimit() const;
+
+  ExecutorDeviceType getDeviceType() const { return device_type_; }
+
+  ArrowTransport getTransportMethod() const { return transport_method_; }
+
  private:
   std::shared_ptr<arrow::RecordBatch> getArrowBatch(
-      const std::shared_ptr<arrow::Schema>& schema) const;
+      const std::shared_ptr<arrow::Schema>& schema,
+      const size_t begin_entry,
+      const size_t end_entry) const;
+
+  std::shared_ptr<arrow::Array> getDictionary(const int dict_id) const;
 
   std::shared_ptr<arrow::Field> makeField(const std::string name,
                                           const SQLTypeInfo& target_type) const;
@@ -247,9 +271,48 @@ class ArrowResultSetConverter {
   int32_t top_n_;
   ArrowTransport transport_method_;
 
+  mutable std::mutex dictionaries_mutex_;
+  mutable std::unordered_map<int, std::shared_ptr<arrow::Array>> dictionaries_;
+
   friend class ArrowResultSet;
 };
 
+// Delivers a result set as a sequence of record batches of bounded size instead of a
+// single batch, converting the next batch in the background while the current one is
+// consumed. All batches share the schema and dictionaries of the first one.
+class ArrowResultSetBatchIterator {
+ public:
+  static constexpr size_t kDefaultMaxBatchRows = 1 << 20;
+
+  ArrowResultSetBatchIterator(std::unique_ptr<ArrowResultSetConverter> converter,
+                              const int64_t max_batch_rows);
+
+  std::shared_ptr<arrow::Schema> schema() const { return schema_; }
+
+  std::shared_ptr<arrow::Buffer> getSerializedSchema() const;
+
+  // Returns the next non-empty batch, or nullptr once the result set is exhausted.
+  std::shared_ptr<arrow::RecordBatch> next();
+
+  // Serializes the next batch to IPC memory. The first result carries the dictionary
+  // messages ahead of the records, so that the serialized schema followed by every
+  // result forms a complete Arrow stream. Returns a result with df_size 0 once the
+  // result set is exhausted. CPU only.
+  ArrowResult getNextArrowResult();
+
+ private:
+  void prefetch();
+
+  std::unique_ptr<ArrowResultSetConverter> converter_;
+  std::shared_ptr<arrow::Schema> schema_;
+  size_t max_batch_rows_;
+  size_t entry_limit_;
+  size_t next_entry_;
+  bool dictionaries_sent_;
+  // Declared last so that a pending conversion completes before the converter goes away.
+  std::future<std::shared_ptr<arrow::RecordBatch>> pending_batch_;
+};
+
 template <typename T>
 constexpr auto scale_epoch_values() {
   return std::is_same<T, arrow::Date32Builder>::value ||
@@ -179,6 +179,7 @@ template <typename C_TYPE,
           typename ARROW_TYPE = typename arrow::CTypeTraits<C_TYPE>::ArrowType>
 void convert_column(ResultSetPtr result,
                     size_t col,
+                    size_t begin_entry,
                     size_t entry_count,
                     std::shared_ptr<arrow::Array>& out) {
   CHECK(sizeof(C_TYPE) == result->getColType(col).get_size());
@@ -188,10 +189,14 @@ void convert_column(ResultSetPtr result,
   const int64_t buf_size = entry_count * sizeof(C_TYPE);
   if (result->isZeroCopyColumnarConversionPossible(col)) {
     values.reset(new ResultSetBuffer(
-        reinterpret_cast<const uint8_t*>(result->getColumnarBuffer(col)),
+        reinterpret_cast<const uint8_t*>(result->getColumnarBuffer(col)) +
+            begin_entry * sizeof(C_TYPE),
         buf_size,
         result));
   } else {
+    // Columns are only ever copied whole, partial ranges go through the row converter.
+    CHECK_EQ(begin_entry, size_t(0));
+    CHECK_EQ(entry_count, result->entryCount());
     auto res = arrow::AllocateBuffer(buf_size);
     CHECK(res.ok());
     values = std::move(res).ValueOrDie();
@@ -316,96 +321,79 @@ std::pair<key_t, std::shared_ptr<arrow::Buffer>> get_shm_buffer(size_t size) {
 #endif
 }
 
-}  // namespace
+std::shared_ptr<arrow::Buffer> serialize_dictionaries(
+    const arrow::RecordBatch& record_batch) {
+  arrow::ipc::DictionaryFieldMapper mapper(*record_batch.schema());
+  auto options = arrow::ipc::IpcWriteOptions::Defaults();
+  auto dict_stream = arrow::io::BufferOutputStream::Create(1024).ValueOrDie();
 
-namespace arrow {
+  ARROW_ASSIGN_OR_THROW(auto dictionaries, CollectDictionaries(record_batch, mapper));
 
-key_t get_and_copy_to_shm(const std::shared_ptr<Buffer>& data) {
-#ifdef _MSC_VER
-  throw std::runtime_error("Arrow IPC not yet supported on Windows.");
-#else
-  auto [key, ipc_ptr] = get_shm(data->size());
-  // copy the arrow records buffer to shared memory
-  // TODO(ptaylor): I'm sure it's possible to tell Arrow's RecordBatchStreamWriter to
-  // write directly to the shared memory segment as a sink
-  memcpy(ipc_ptr, data->data(), data->size());
-  // detach from the shared memory segment
-  shmdt(ipc_ptr);
-  return key;
-#endif
-}
+  ARROW_LOG("CPU") << "found " << dictionaries.size() << " dictionaries";
 
-}  // namespace arrow
+  for (auto& pair : dictionaries) {
+    arrow::ipc::IpcPayload payload;
+    int64_t dictionary_id = pair.first;
+    const auto& dictionary = pair.second;
 
-//! Serialize an Arrow result to IPC memory. Users are responsible for freeing all CPU IPC
-//! buffers using deallocateArrowResultBuffer. GPU buffers will become owned by the caller
-//! upon deserialization, and will be automatically freed when they go out of scope.
-ArrowResult ArrowResultSetConverter::getArrowResult() const {
-  auto timer = DEBUG_TIMER(__func__);
-  std::shared_ptr<arrow::RecordBatch> record_batch = convertToArrow();
+    ARROW_THROW_NOT_OK(
+        GetDictionaryPayload(dictionary_id, dictionary, options, &payload));
+    int32_t metadata_length = 0;
+    ARROW_THROW_NOT_OK(
+        WriteIpcPayload(payload, options, dict_stream.get(), &metadata_length));
+  }
+  return dict_stream->Finish().ValueOrDie();
+}
 
-  if (device_type_ == ExecutorDeviceType::CPU ||
-      transport_method_ == ArrowTransport::WIRE) {
-    const auto getWireResult =
-        [&](const int64_t schema_size,
-            const int64_t dict_size,
-            const int64_t records_size,
-            const std::shared_ptr<arrow::Buffer>& serialized_schema,
-            const std::shared_ptr<arrow::Buffer>& serialized_dict) -> ArrowResult {
+// Lays out the given already serialized IPC messages followed by the record batch in
+// one contiguous buffer, returned inline or in a new shared memory segment.
+ArrowResult serialize_arrow_result(
+    const std::vector<std::shared_ptr<arrow::Buffer>>& messages,
+    const arrow::RecordBatch& record_batch,
+    const ArrowTransport transport_method) {
+  int64_t messages_size = 0;
+  for (const auto& message : messages) {
+    messages_size += message->size();
+  }
+  int64_t records_size = 0;
+  ARROW_THROW_NOT_OK(arrow::ipc::GetRecordBatchSize(record_batch, &records_size));
+  const int64_t total_size = messages_size + records_size;
+
+  const auto write_records = [&](const std::shared_ptr<arrow::Buffer>& serialized) {
+    int64_t offset = 0;
+    for (const auto& message : messages) {
+      memcpy(serialized->mutable_data() + offset, message->data(), message->size());
+      offset += message->size();
+    }
+    arrow::io::FixedSizeBufferWriter stream(
+        SliceMutableBuffer(serialized, messages_size));
+    ARROW_THROW_NOT_OK(arrow::ipc::SerializeRecordBatch(
+        record_batch, arrow::ipc::IpcWriteOptions::Defaults(), &stream));
+  };
+
+  switch (transport_method) {
+    case ArrowTransport::WIRE: {
       auto timer = DEBUG_TIMER("serialize batch to wire");
-      const int64_t total_size = schema_size + records_size + dict_size;
       std::vector<char> record_handle_data(total_size);
       auto serialized_records =
           arrow::MutableBuffer::Wrap(record_handle_data.data(), total_size);
-
-      ARROW_ASSIGN_OR_THROW(auto writer, arrow::Buffer::GetWriter(serialized_records));
-
-      ARROW_THROW_NOT_OK(writer->Write(
-          reinterpret_cast<const uint8_t*>(serialized_schema->data()), schema_size));
-
-      ARROW_THROW_NOT_OK(writer->Write(
-          reinterpret_cast<const uint8_t*>(serialized_dict->data()), dict_size));
-
-      arrow::io::FixedSizeBufferWriter stream(
-          SliceMutableBuffer(serialized_records, schema_size + dict_size));
-
-      ARROW_THROW_NOT_OK(arrow::ipc::SerializeRecordBatch(
-          *record_batch, arrow::ipc::IpcWriteOptions::Defaults(), &stream));
-
+      write_records(serialized_records);
       return {std::vector<char>(0),
               0,
               std::vector<char>(0),
               serialized_records->size(),
               std::string{""},
               std::move(record_handle_data)};
-    };
-
-    const auto getShmResult =
-        [&](const int64_t schema_size,
-            const int64_t dict_size,
-            const int64_t records_size,
-            const std::shared_ptr<arrow::Buffer>& serialized_schema,
-            const std::shared_ptr<arrow::Buffer>& serialized_dict) -> ArrowResult {
+    }
+    case ArrowTransport::SHARED_MEMORY: {
       auto timer = DEBUG_TIMER("serialize batch to shared memory");
       std::shared_ptr<arrow::Buffer> serialized_records;
       std::vector<char> schema_handle_buffer;
       std::vector<char> record_handle_buffer(sizeof(key_t), 0);
       key_t records_shm_key = IPC_PRIVATE;
-      const int64_t total_size = schema_size + records_size + dict_size;
 
       std::tie(records_shm_key, serialized_records) = get_shm_buffer(total_size);
-
-      memcpy(serialized_records->mutable_data(),
-             serialized_schema->data(),
-             (size_t)schema_size);
-      memcpy(serialized_records->mutable_data() + schema_size,
-             serialized_dict->data(),
-             (size_t)dict_size);
-
-      arrow::io::FixedSizeBufferWriter stream(
-          SliceMutableBuffer(serialized_records, schema_size + dict_size));
-      ARROW_THROW_NOT_OK(arrow::ipc::SerializeRecordBatch(
-          *record_batch, arrow::ipc::IpcWriteOptions::Defaults(), &stream));
+      write_records(serialized_records);
       memcpy(&record_handle_buffer[0],
              reinterpret_cast<const unsigned char*>(&records_shm_key),
              sizeof(key_t));
@@ -415,50 +403,50 @@ ArrowResult ArrowResultSetConverter::getArrowResult() const {
               record_handle_buffer,
               serialized_records->size(),
               std::string{""}};
-    };
-
-    std::shared_ptr<arrow::Buffer> serialized_schema;
-    int64_t records_size = 0;
-    int64_t schema_size = 0;
-    arrow::ipc::DictionaryFieldMapper mapper(*record_batch->schema());
-    auto options = arrow::ipc::IpcWriteOptions::Defaults();
-    auto dict_stream = arrow::io::BufferOutputStream::Create(1024).ValueOrDie();
-
-    ARROW_ASSIGN_OR_THROW(auto dictionaries, CollectDictionaries(*record_batch, mapper));
-
-    ARROW_LOG("CPU") << "found " << dictionaries.size() << " dictionaries";
-
-    for (auto& pair : dictionaries) {
-      arrow::ipc::IpcPayload payload;
-      int64_t dictionary_id = pair.first;
-      const auto& dictionary = pair.second;
-
-      ARROW_THROW_NOT_OK(
-          GetDictionaryPayload(dictionary_id, dictionary, options, &payload));
-      int32_t metadata_length = 0;
-      ARROW_THROW_NOT_OK(
-          WriteIpcPayload(payload, options, dict_stream.get(), &metadata_length));
     }
-    auto serialized_dict = dict_stream->Finish().ValueOrDie();
-    auto dict_size = serialized_dict->size();
+    default:
+      UNREACHABLE();
+  }
+  return {std::vector<char>{}, 0, std::vector<char>{}, 0, ""};
+}
+
+}  // namespace
+
+namespace arrow {
+
+key_t get_and_copy_to_shm(const std::shared_ptr<Buffer>& data) {
+#ifdef _MSC_VER
+  throw std::runtime_error("Arrow IPC not yet supported on Windows.");
+#else
+  auto [key, ipc_ptr] = get_shm(data->size());
+  // copy the arrow records buffer to shared memory
+  // TODO(ptaylor): I'm sure it's possible to tell Arrow's RecordBatchStreamWriter to
+  // write directly to the shared memory segment as a sink
+  memcpy(ipc_ptr, data->data(), data->size());
+  // detach from the shared memory segment
+  shmdt(ipc_ptr);
+  return key;
+#endif
+}
 
+}  // namespace arrow
+
+//! Serialize an Arrow result to IPC memory. Users are responsible for freeing all CPU IPC
+//! buffers using deallocateArrowResultBuffer. GPU buffers will become owned by the caller
+//! upon deserialization, and will be automatically freed when they go out of scope.
+ArrowResult ArrowResultSetConverter::getArrowResult() const {
+  auto timer = DEBUG_TIMER(__func__);
+  std::shared_ptr<arrow::RecordBatch> record_batch = convertToArrow();
+
+  if (device_type_ == ExecutorDeviceType::CPU ||
+      transport_method_ == ArrowTransport::WIRE) {
+    std::shared_ptr<arrow::Buffer> serialized_schema;
     ARROW_ASSIGN_OR_THROW(serialized_schema,
                           arrow::ipc::SerializeSchema(*record_batch->schema(),
                                                       arrow::default_memory_pool()));
-    schema_size = serialized_schema->size();
-
-    ARROW_THROW_NOT_OK(arrow::ipc::GetRecordBatchSize(*record_batch, &records_size));
-
-    switch (transport_method_) {
-      case ArrowTransport::WIRE:
-        return getWireResult(
-            schema_size, dict_size, records_size, serialized_schema, serialized_dict);
-      case ArrowTransport::SHARED_MEMORY:
-        return getShmResult(
-            schema_size, dict_size, records_size, serialized_schema, serialized_dict);
-      default:
-        UNREACHABLE();
-    }
+    const auto serialized_dict = serialize_dictionaries(*record_batch);
+    return serialize_arrow_result(
+        {serialized_schema, serialized_dict}, *record_batch, transport_method_);
   }
 #ifdef HAVE_CUDA
   CHECK(device_type_ == ExecutorDeviceType::GPU);
@@ -583,6 +571,24 @@ ArrowResultSetConverter::getSerializedArrowOutput(
 
 std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::convertToArrow() const {
   auto timer = DEBUG_TIMER(__func__);
+  return getArrowBatch(getSchema(), 0, getEntryLimit());
+}
+
+std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::convertToArrow(
+    const size_t begin_entry,
+    const size_t end_entry) const {
+  auto timer = DEBUG_TIMER(__func__);
+  CHECK_LE(begin_entry, end_entry);
+  CHECK_LE(end_entry, getEntryLimit());
+  return getArrowBatch(getSchema(), begin_entry, end_entry);
+}
+
+size_t ArrowResultSetConverter::getEntryLimit() const {
+  return top_n_ < 0 ? results_->entryCount()
+                    : std::min(size_t(top_n_), results_->entryCount());
+}
+
+std::shared_ptr<arrow::Schema> ArrowResultSetConverter::getSchema() const {
   const auto col_count = results_->colCount();
   std::vector<std::shared_ptr<arrow::Field>> fields;
   CHECK(col_names_.empty() || col_names_.size() == col_count);
@@ -596,16 +602,17 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::convertToArrow() co
     VLOG(1) << "\t" << f->ToString(true);
   }
 #endif
-  return getArrowBatch(arrow::schema(fields));
+  return arrow::schema(fields);
 }
 
 std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
-    const std::shared_ptr<arrow::Schema>& schema) const {
+    const std::shared_ptr<arrow::Schema>& schema,
+    const size_t begin_entry,
+    const size_t end_entry) const {
   std::vector<std::shared_ptr<arrow::Array>> result_columns;
 
-  const size_t entry_count = top_n_ < 0
-                                 ? results_->entryCount()
-                                 : std::min(size_t(top_n_), results_->entryCount());
+  const size_t entry_count = end_entry - begin_entry;
+  const bool whole_result = begin_entry == 0 && entry_count == results_->entryCount();
   if (!entry_count) {
     return ARROW_RECORDBATCH_MAKE(schema, 0, result_columns);
   }
@@ -737,22 +744,22 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
       const auto& column = builders[col];
       switch (column.physical_type) {
         case kTINYINT:
-          convert_column<int8_t>(results_, col, entry_count, result[col]);
+          convert_column<int8_t>(results_, col, begin_entry, entry_count, result[col]);
           break;
         case kSMALLINT:
-          convert_column<int16_t>(results_, col, entry_count, result[col]);
+          convert_column<int16_t>(results_, col, begin_entry, entry_count, result[col]);
           break;
         case kINT:
-          convert_column<int32_t>(results_, col, entry_count, result[col]);
+          convert_column<int32_t>(results_, col, begin_entry, entry_count, result[col]);
           break;
         case kBIGINT:
-          convert_column<int64_t>(results_, col, entry_count, result[col]);
+          convert_column<int64_t>(results_, col, begin_entry, entry_count, result[col]);
           break;
         case kFLOAT:
-          convert_column<float>(results_, col, entry_count, result[col]);
+          convert_column<float>(results_, col, begin_entry, entry_count, result[col]);
           break;
         case kDOUBLE:
-          convert_column<double>(results_, col, entry_count, result[col]);
+          convert_column<double>(results_, col, begin_entry, entry_count, result[col]);
           break;
         default:
           throw std::runtime_error(column.col_type.get_type_name() +
@@ -766,8 +773,7 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
   const bool multithreaded = entry_count > 10000 && !results_->isTruncated();
   bool use_columnar_converter = results_->isDirectColumnarConversionPossible() &&
                                 results_->getQueryMemDesc().getQueryDescriptionType() ==
-                                    QueryDescriptionType::Projection &&
-                                entry_count == results_->entryCount();
+                                    QueryDescriptionType::Projection;
   std::vector<bool> non_lazy_cols;
   if (use_columnar_converter) {
     auto timer = DEBUG_TIMER("columnar converter");
@@ -795,6 +801,11 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
       if (builders[i].field->type()->id() == arrow::Type::DICTIONARY) {
         is_lazy = true;
       }
+      // Only whole columns can be copied out of a result set which doesn't allow zero
+      // copy conversion, fetch partial ranges row by row instead.
+      if (!whole_result && !results_->isZeroCopyColumnarConversionPossible(i)) {
+        is_lazy = true;
+      }
       non_lazy_cols.emplace_back(!is_lazy);
       if (!is_lazy) {
         ++non_lazy_col_count;
@@ -845,16 +856,16 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
       std::vector<std::vector<std::shared_ptr<std::vector<bool>>>> null_bitmap_segs(
           cpu_count, std::vector<std::shared_ptr<std::vector<bool>>>(col_count, nullptr));
       const auto stride = (entry_count + cpu_count - 1) / cpu_count;
-      for (size_t i = 0, start_entry = 0; start_entry < entry_count;
+      for (size_t i = 0, start_entry = begin_entry; start_entry < end_entry;
            ++i, start_entry += stride) {
-        const auto end_entry = std::min(entry_count, start_entry + stride);
+        const auto seg_end_entry = std::min(end_entry, start_entry + stride);
         child_threads.push_back(std::async(std::launch::async,
                                            fetch,
                                            std::ref(column_value_segs[i]),
                                            std::ref(null_bitmap_segs[i]),
                                            non_lazy_cols,
                                            start_entry,
-                                           end_entry));
+                                           seg_end_entry));
       }
       for (auto& child : child_threads) {
         row_count += child.get();
@@ -876,11 +887,11 @@ std::shared_ptr<arrow::RecordBatch> ArrowResultSetConverter::getArrowBatch(
       }
     } else {
       row_count =
-          fetch(column_values, null_bitmaps, non_lazy_cols, size_t(0), entry_count);
+          fetch(column_values, null_bitmaps, non_lazy_cols, begin_entry, end_entry);
       {
         auto timer = DEBUG_TIMER("append rows to arrow single thread");
         for (int i = 0; i < schema->num_fields(); ++i) {
-          if (!non_lazy_cols.empty() && non_lazy_cols[i]) {
+          if ((!non_lazy_cols.empty() && non_lazy_cols[i]) || !column_values[i]) {
             continue;
           }
 
@@ -1032,31 +1043,41 @@ void ArrowResultSetConverter::initializeColumnBuilder(
 
   auto value_type = field->type();
   if (col_type.is_dict_encoded_string()) {
-    column_builder.builder.reset(new arrow::StringDictionary32Builder());
-    // add values to the builder
-    const int dict_id = col_type.get_comp_param();
-    auto str_list = results_->getStringDictionaryPayloadCopy(dict_id);
-
-    arrow::StringBuilder str_array_builder;
-    ARROW_THROW_NOT_OK(str_array_builder.AppendValues(*str_list));
-    std::shared_ptr<arrow::StringArray> string_array;
-    ARROW_THROW_NOT_OK(str_array_builder.Finish(&string_array));
-
-    auto dict_builder =
-        dynamic_cast<arrow::StringDictionary32Builder*>(column_builder.builder.get());
-    CHECK(dict_builder);
-
-    ARROW_THROW_NOT_OK(dict_builder->InsertMemoValues(*string_array));
+    // The string ids are the dictionary indices, so only collect those and attach the
+    // dictionary when finishing the column.
+    column_builder.builder.reset(new arrow::Int32Builder());
+    column_builder.dictionary = getDictionary(col_type.get_comp_param());
   } else {
     ARROW_THROW_NOT_OK(arrow::MakeBuilder(
         arrow::default_memory_pool(), value_type, &column_builder.builder));
   }
 }
 
+std::shared_ptr<arrow::Array> ArrowResultSetConverter::getDictionary(
+    const int dict_id) const {
+  std::lock_guard<std::mutex> lock(dictionaries_mutex_);
+  auto it = dictionaries_.find(dict_id);
+  if (it != dictionaries_.end()) {
+    return it->second;
+  }
+  auto str_list = results_->getStringDictionaryPayloadCopy(dict_id);
+
+  arrow::StringBuilder str_array_builder;
+  ARROW_THROW_NOT_OK(str_array_builder.AppendValues(*str_list));
+  std::shared_ptr<arrow::Array> string_array;
+  ARROW_THROW_NOT_OK(str_array_builder.Finish(&string_array));
+  dictionaries_.emplace(dict_id, string_array);
+  return string_array;
+}
+
 std::shared_ptr<arrow::Array> ArrowResultSetConverter::finishColumnBuilder(
     ColumnBuilder& column_builder) const {
   std::shared_ptr<arrow::Array> values;
   ARROW_THROW_NOT_OK(column_builder.builder->Finish(&values));
+  if (column_builder.dictionary) {
+    return std::make_shared<arrow::DictionaryArray>(
+        column_builder.field->type(), values, column_builder.dictionary);
+  }
   return values;
 }
 
@@ -1066,9 +1087,6 @@ template <typename BUILDER_TYPE, typename VALUE_ARRAY_TYPE>
 void appendToColumnBuilder(ArrowResultSetConverter::ColumnBuilder& column_builder,
                            const ValueArray& values,
                            const std::shared_ptr<std::vector<bool>>& is_valid) {
-  static_assert(!std::is_same<BUILDER_TYPE, arrow::StringDictionary32Builder>::value,
-                "Dictionary encoded string builder requires function specialization.");
-
   std::vector<VALUE_ARRAY_TYPE> vals = boost::get<std::vector<VALUE_ARRAY_TYPE>>(values);
 
   if (scale_epoch_values<BUILDER_TYPE>()) {
@@ -1119,35 +1137,6 @@ void appendToColumnBuilder<arrow::Decimal128Builder, int64_t>(
   }
 }
 
-template <>
-void appendToColumnBuilder<arrow::StringDictionary32Builder, int32_t>(
-    ArrowResultSetConverter::ColumnBuilder& column_builder,
-    const ValueArray& values,
-    const std::shared_ptr<std::vector<bool>>& is_valid) {
-  auto typed_builder =
-      dynamic_cast<arrow::StringDictionary32Builder*>(column_builder.builder.get());
-  CHECK(typed_builder);
-
-  std::vector<int32_t> vals = boost::get<std::vector<int32_t>>(values);
-
-  if (column_builder.field->nullable()) {
-    CHECK(is_valid.get());
-    // TODO(adb): Generate this instead of the boolean bitmap
-    std::vector<uint8_t> transformed_bitmap;
-    transformed_bitmap.reserve(is_valid->size());
-    std::for_each(
-        is_valid->begin(), is_valid->end(), [&transformed_bitmap](const bool is_valid) {
-          transformed_bitmap.push_back(is_valid ? 1 : 0);
-        });
-
-    ARROW_THROW_NOT_OK(typed_builder->AppendIndices(
-        vals.data(), static_cast<int64_t>(vals.size()), transformed_bitmap.data()));
-  } else {
-    ARROW_THROW_NOT_OK(
-        typed_builder->AppendIndices(vals.data(), static_cast<int64_t>(vals.size())));
-  }
-}
-
 }  // namespace
 
 void ArrowResultSetConverter::append(
@@ -1157,8 +1146,7 @@ void ArrowResultSetConverter::append(
   if (column_builder.col_type.is_dict_encoded_string()) {
     CHECK_EQ(column_builder.physical_type,
              kINT);  // assume all dicts use none-encoded type for now
-    appendToColumnBuilder<arrow::StringDictionary32Builder, int32_t>(
-        column_builder, values, is_valid);
+    appendToColumnBuilder<arrow::Int32Builder, int32_t>(column_builder, values, is_valid);
     return;
   }
   switch (column_builder.physical_type) {
@@ -1216,3 +1204,65 @@ void ArrowResultSetConverter::append(
                                " is not supported in Arrow result sets.");
   }
 }
+
+ArrowResultSetBatchIterator::ArrowResultSetBatchIterator(
+    std::unique_ptr<ArrowResultSetConverter> converter,
+    const int64_t max_batch_rows)
+    : converter_(std::move(converter))
+    , max_batch_rows_(max_batch_rows > 0 ? static_cast<size_t>(max_batch_rows)
+                                         : kDefaultMaxBatchRows)
+    , next_entry_(0)
+    , dictionaries_sent_(false) {
+  CHECK(converter_);
+  schema_ = converter_->getSchema();
+  entry_limit_ = converter_->getEntryLimit();
+  prefetch();
+}
+
+std::shared_ptr<arrow::Buffer> ArrowResultSetBatchIterator::getSerializedSchema() const {
+  std::shared_ptr<arrow::Buffer> serialized_schema;
+  ARROW_ASSIGN_OR_THROW(
+      serialized_schema,
+      arrow::ipc::SerializeSchema(*schema_, arrow::default_memory_pool()));
+  return serialized_schema;
+}
+
+void ArrowResultSetBatchIterator::prefetch() {
+  if (next_entry_ >= entry_limit_) {
+    return;
+  }
+  const auto begin_entry = next_entry_;
+  const auto end_entry = std::min(entry_limit_, begin_entry + max_batch_rows_);
+  next_entry_ = end_entry;
+  pending_batch_ = std::async(std::launch::async, [this, begin_entry, end_entry] {
+    return converter_->convertToArrow(begin_entry, end_entry);
+  });
+}
+
+std::shared_ptr<arrow::RecordBatch> ArrowResultSetBatchIterator::next() {
+  // Entries of group by buffers can be empty, skip batches left without any rows.
+  while (pending_batch_.valid()) {
+    auto record_batch = pending_batch_.get();
+    prefetch();
+    if (record_batch->num_rows()) {
+      return record_batch;
+    }
+  }
+  return nullptr;
+}
+
+ArrowResult ArrowResultSetBatchIterator::getNextArrowResult() {
+  auto timer = DEBUG_TIMER(__func__);
+  CHECK(converter_->getDeviceType() == ExecutorDeviceType::CPU);
+  auto record_batch = next();
+  if (!record_batch) {
+    return {std::vector<char>{}, 0, std::vector<char>{}, 0, ""};
+  }
+  std::vector<std::shared_ptr<arrow::Buffer>> messages;
+  if (!dictionaries_sent_) {
+    messages.push_back(serialize_dictionaries(*record_batch));
+    dictionaries_sent_ = true;
+  }
+  return serialize_arrow_result(
+      messages, *record_batch, converter_->getTransportMethod());
+}
@@ -54,8 +54,14 @@ llvm::Instruction* FixedWidthUnsigned::codegenDecode(llvm::Value* byte_stream,
   return llvm::CallInst::Create(f, args);
 }
 
-DiffFixedWidthInt::DiffFixedWidthInt(const size_t byte_width, const int64_t baseline)
-    : byte_width_{byte_width}, baseline_{baseline} {}
+DiffFixedWidthInt::DiffFixedWidthInt(const size_t byte_width, const int64_t ret_null_val)
+    : byte_width_{byte_width}
+    , null_val_{byte_width == 1   ? NULL_TINYINT
+                : byte_width == 2 ? NULL_SMALLINT
+                                  : NULL_INT}
+    , ret_null_val_{ret_null_val} {
+  CHECK(byte_width == 1 || byte_width == 2 || byte_width == 4);
+}
 
 llvm::Instruction* DiffFixedWidthInt::codegenDecode(llvm::Value* byte_stream,
                                                     llvm::Value* pos,
@@ -66,11 +72,21 @@ llvm::Instruction* DiffFixedWidthInt::codegenDecode(llvm::Value* byte_stream,
   llvm::Value* args[] = {
       byte_stream,
       llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), byte_width_),
-      llvm::ConstantInt::get(llvm::Type::getInt32Ty(context), baseline_),
+      llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), null_val_),
+      llvm::ConstantInt::get(llvm::Type::getInt64Ty(context), ret_null_val_),
       pos};
   return llvm::CallInst::Create(f, args);
 }
 
+llvm::Instruction* RunLengthInt::codegenDecode(llvm::Value* byte_stream,
+                                               llvm::Value* pos,
+                                               llvm::Module* module) const {
+  auto f = module->getFunction("run_length_int_decode");
+  CHECK(f);
+  llvm::Value* args[] = {byte_stream, pos};
+  return llvm::CallInst::Create(f, args);
+}
+
 FixedWidthReal::FixedWidthReal(const bool is_double) : is_double_(is_double) {}
 
 llvm::Instruction* FixedWidthReal::codegenDecode(llvm::Value* byte_stream,
@@ -19,6 +19,8 @@
 #include <memory>
 
 #include "DataMgr/ArrayNoneEncoder.h"
+#include "DataMgr/DiffEncoder.h"
+#include "DataMgr/RunLengthEncoder.h"
 #include "QueryEngine/ErrorHandling.h"
 #include "QueryEngine/Execute.h"
 #include "Shared/Intervals.h"
@@ -43,6 +45,48 @@ inline const ColumnarResults* columnarize_result(
       row_set_mem_owner, *result, result->colCount(), col_types, thread_idx);
 }
 
+bool is_run_length_or_diff_encoded(const SQLTypeInfo& ti) {
+  return ti.get_compression() == kENCODING_RL || ti.get_compression() == kENCODING_DIFF;
+}
+
+// Decodes a run length or differential encoded chunk into a plain, fixed width column
+// buffer of the logical type, owned by the row set memory owner. Used by consumers
+// which read column buffers directly instead of through generated code, like hash
+// joins, window functions and table functions.
+int8_t* decode_run_length_or_diff_chunk(Data_Namespace::AbstractBuffer* ab,
+                                        const SQLTypeInfo& ti,
+                                        const size_t num_elems,
+                                        RowSetMemoryOwner* row_set_mem_owner,
+                                        const size_t thread_idx) {
+  CHECK(is_run_length_or_diff_encoded(ti));
+  const auto values =
+      ti.get_compression() == kENCODING_RL
+          ? run_length_decode_all(ab->getMemoryPtr(), ab->size())
+          : diff_decode_all(ab->getMemoryPtr(),
+                            ab->size(),
+                            ti.get_comp_param() / 8,
+                            inline_int_null_val(ti));
+  CHECK_EQ(values.size(), num_elems);
+  const auto elem_size = ti.get_size();
+  auto col_buff = row_set_mem_owner->allocate(num_elems * elem_size, thread_idx);
+  for (size_t i = 0; i < num_elems; ++i) {
+    switch (elem_size) {
+      case 2:
+        reinterpret_cast<int16_t*>(col_buff)[i] = static_cast<int16_t>(values[i]);
+        break;
+      case 4:
+        reinterpret_cast<int32_t*>(col_buff)[i] = static_cast<int32_t>(values[i]);
+        break;
+      case 8:
+        reinterpret_cast<int64_t*>(col_buff)[i] = values[i];
+        break;
+      default:
+        UNREACHABLE() << "Unexpected element size " << elem_size;
+    }
+  }
+  return col_buff;
+}
+
 std::string getMemoryLevelString(Data_Namespace::MemoryLevel memoryLevel) {
   switch (memoryLevel) {
     case DISK_LEVEL:
@@ -96,12 +140,16 @@ std::pair<const int8_t*, size_t> ColumnFetcher::getOneColumnFragment(
                        fragment.physicalTableId,
                        hash_col.get_column_id(),
                        fragment.fragmentId};
+    // Run length and differential encoded chunks are decoded on the CPU first.
+    const bool decode_chunk = is_run_length_or_diff_encoded(cd->columnType);
+    const auto chunk_mem_lvl =
+        decode_chunk ? Data_Namespace::CPU_LEVEL : effective_mem_lvl;
     const auto chunk = Chunk_NS::Chunk::getChunk(
         cd,
         &catalog.getDataMgr(),
         chunk_key,
-        effective_mem_lvl,
-        effective_mem_lvl == Data_Namespace::CPU_LEVEL ? 0 : device_id,
+        chunk_mem_lvl,
+        chunk_mem_lvl == Data_Namespace::CPU_LEVEL ? 0 : device_id,
         chunk_meta_it->second->numBytes,
         chunk_meta_it->second->numElements);
     chunks_owner.push_back(chunk);
@@ -109,6 +157,23 @@ std::pair<const int8_t*, size_t> ColumnFetcher::getOneColumnFragment(
     auto ab = chunk->getBuffer();
     CHECK(ab->getMemoryPtr());
     col_buff = reinterpret_cast<int8_t*>(ab->getMemoryPtr());
+    if (decode_chunk) {
+      const auto num_elems = chunk_meta_it->second->numElements;
+      auto decoded_buff =
+          decode_run_length_or_diff_chunk(ab,
+                                          cd->columnType,
+                                          num_elems,
+                                          executor->row_set_mem_owner_.get(),
+                                          thread_idx);
+      col_buff = decoded_buff;
+      if (effective_mem_lvl == Data_Namespace::GPU_LEVEL) {
+        const auto num_bytes = num_elems * cd->columnType.get_size();
+        CHECK(device_allocator);
+        auto gpu_col_buffer = device_allocator->alloc(num_bytes);
+        device_allocator->copyToDevice(gpu_col_buffer, decoded_buff, num_bytes);
+        col_buff = gpu_col_buffer;
+      }
+    }
   } else {  // temporary table
     const ColumnarResults* col_frag{nullptr};
     {
@@ -295,6 +360,12 @@ const int8_t* ColumnFetcher::getAllTableColumnFragments(
   const ColumnarResults* table_column = nullptr;
   const InputColDescriptor col_desc(col_id, table_id, int(0));
   CHECK(col_desc.getScanDesc().getSourceType() == InputSourceType::TABLE);
+  const auto cd = get_column_descriptor(col_id, table_id, *executor_->getCatalog());
+  if (is_run_length_or_diff_encoded(cd->columnType)) {
+    throw std::runtime_error("Column " + cd->columnName +
+                             ": RL and DIFF encoded columns of multi-fragment inner join "
+                             "tables are not supported yet.");
+  }
   {
     std::lock_guard<std::mutex> columnar_conversion_guard(columnar_fetch_mutex_);
     auto column_it = columnarized_scan_table_cache_.find(col_desc);
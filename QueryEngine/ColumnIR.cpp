@@ -73,6 +73,14 @@ std::shared_ptr<Decoder> get_col_decoder(const Analyzer::ColumnVar* col_var) {
       return col_var->get_comp_param() == 16 ? std::make_shared<FixedWidthSmallDate>(2)
                                              : std::make_shared<FixedWidthSmallDate>(4);
     }
+    case kENCODING_RL:
+      // runs store sign-extended values, nulls included
+      return std::make_shared<RunLengthInt>();
+    case kENCODING_DIFF: {
+      const auto bit_width = col_var->get_comp_param();
+      CHECK_EQ(0, bit_width % 8);
+      return std::make_shared<DiffFixedWidthInt>(bit_width / 8, inline_int_null_val(ti));
+    }
     default:
       abort();
   }
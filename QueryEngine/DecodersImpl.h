@@ -101,12 +101,57 @@ SUFFIX(fixed_width_unsigned_decode_noinline)(const int8_t* byte_stream,
   return SUFFIX(fixed_width_unsigned_decode)(byte_stream, byte_width, pos);
 }
 
+// Differential (DIFF) encoded chunks start with the 64-bit baseline, followed by the
+// fixed width deltas. See DataMgr/DiffEncoder.h.
 extern "C" DEVICE ALWAYS_INLINE int64_t
 SUFFIX(diff_fixed_width_int_decode)(const int8_t* byte_stream,
                                     const int32_t byte_width,
-                                    const int64_t baseline,
+                                    const int64_t null_val,
+                                    const int64_t ret_null_val,
                                     const int64_t pos) {
-  return SUFFIX(fixed_width_int_decode)(byte_stream, byte_width, pos) + baseline;
+  const auto baseline = *reinterpret_cast<const int64_t*>(byte_stream);
+  const auto delta =
+      SUFFIX(fixed_width_int_decode)(byte_stream + sizeof(int64_t), byte_width, pos);
+  return delta == null_val ? ret_null_val : baseline + delta;
+}
+
+extern "C" DEVICE NEVER_INLINE int64_t
+SUFFIX(diff_fixed_width_int_decode_noinline)(const int8_t* byte_stream,
+                                             const int32_t byte_width,
+                                             const int64_t null_val,
+                                             const int64_t ret_null_val,
+                                             const int64_t pos) {
+  return SUFFIX(diff_fixed_width_int_decode)(
+      byte_stream, byte_width, null_val, ret_null_val, pos);
+}
+
+// Run length (RL) encoded chunks start with the 64-bit run count, followed by
+// (value, exclusive end row) pairs of 64-bit integers sorted by row. Find the run
+// which contains `pos` with a binary search on the run ends. See
+// DataMgr/RunLengthEncoder.h.
+extern "C" DEVICE ALWAYS_INLINE int64_t
+SUFFIX(run_length_int_decode)(const int8_t* byte_stream, const int64_t pos) {
+#ifdef WITH_DECODERS_BOUNDS_CHECKING
+  assert(pos >= 0);
+#endif  // WITH_DECODERS_BOUNDS_CHECKING
+  const auto run_count = *reinterpret_cast<const int64_t*>(byte_stream);
+  const auto runs = reinterpret_cast<const int64_t*>(byte_stream) + 1;
+  int64_t lo = 0;
+  int64_t hi = run_count - 1;
+  while (lo < hi) {
+    const auto mid = lo + (hi - lo) / 2;
+    if (runs[2 * mid + 1] > pos) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return runs[2 * lo];
+}
+
+extern "C" DEVICE NEVER_INLINE int64_t
+SUFFIX(run_length_int_decode_noinline)(const int8_t* byte_stream, const int64_t pos) {
+  return SUFFIX(run_length_int_decode)(byte_stream, pos);
 }
 
 extern "C" DEVICE ALWAYS_INLINE float SUFFIX(
@@ -20,8 +20,29 @@
 #include "Catalog/TableDescriptor.h"
 #include "DataMgr/DataMgr.h"
 #include "QueryEngine/Execute.h"
+#include "QueryEngine/GeoFragmentBounds.h"
 #include "Shared/misc.h"
 
+namespace {
+
+// Besides the simple quals, which compare a column to a literal, IN lists of literals can
+// skip fragments based on the chunk metadata, and geo predicates on a literal geometry
+// based on the bounding boxes of the geo columns in the fragments.
+std::list<std::shared_ptr<Analyzer::Expr>> get_fragment_skipping_quals(
+    const RelAlgExecutionUnit& ra_exe_unit) {
+  auto fragment_skipping_quals = ra_exe_unit.simple_quals;
+  for (const auto& qual : ra_exe_unit.quals) {
+    if (std::dynamic_pointer_cast<const Analyzer::InValues>(qual) ||
+        (g_enable_geo_fragment_skipping &&
+         std::dynamic_pointer_cast<const Analyzer::FunctionOper>(qual))) {
+      fragment_skipping_quals.push_back(qual);
+    }
+  }
+  return fragment_skipping_quals;
+}
+
+}  // namespace
+
 QueryFragmentDescriptor::QueryFragmentDescriptor(
     const RelAlgExecutionUnit& ra_exe_unit,
     const std::vector<InputTableInfo>& query_infos,
@@ -101,6 +122,7 @@ void QueryFragmentDescriptor::buildFragmentKernelMap(
                               device_count,
                               num_bytes_for_row,
                               device_type,
+                              enable_inner_join_fragment_skipping,
                               executor);
   }
 }
@@ -116,6 +138,7 @@ void QueryFragmentDescriptor::buildFragmentPerKernelForTable(
     const ChunkMetadataVector& deleted_chunk_metadata_vec,
     const std::optional<size_t> table_desc_offset,
     const ExecutorDeviceType& device_type,
+    const bool enable_inner_join_fragment_skipping,
     Executor* executor) {
   auto get_fragment_tuple_count = [&deleted_chunk_metadata_vec, &is_temporary_table](
                                       const auto& fragment) -> std::optional<size_t> {
@@ -142,6 +165,7 @@ void QueryFragmentDescriptor::buildFragmentPerKernelForTable(
     return fragment.getNumTuples();
   };
 
+  const auto fragment_skipping_quals = get_fragment_skipping_quals(ra_exe_unit);
   for (size_t i = 0; i < fragments->size(); i++) {
     if (!allowed_outer_fragment_indices_.empty()) {
       if (std::find(allowed_outer_fragment_indices_.begin(),
@@ -152,8 +176,13 @@ void QueryFragmentDescriptor::buildFragmentPerKernelForTable(
     }
 
     const auto& fragment = (*fragments)[i];
-    const auto skip_frag = executor->skipFragment(
-        table_desc, fragment, ra_exe_unit.simple_quals, frag_offsets, i);
+    auto skip_frag = executor->skipFragment(
+        table_desc, fragment, fragment_skipping_quals, frag_offsets, i);
+    if (enable_inner_join_fragment_skipping &&
+        (skip_frag == std::pair<bool, int64_t>(false, -1))) {
+      skip_frag = executor->skipFragmentInnerJoins(
+          table_desc, ra_exe_unit, fragment, frag_offsets, i);
+    }
     if (skip_frag.first) {
       continue;
     }
@@ -263,6 +292,7 @@ void QueryFragmentDescriptor::buildFragmentPerKernelMapForUnion(
                                    {},
                                    j,
                                    device_type,
+                                   false,
                                    executor);
 
     std::vector<int> table_ids =
@@ -286,6 +316,7 @@ void QueryFragmentDescriptor::buildFragmentPerKernelMap(
     const int device_count,
     const size_t num_bytes_for_row,
     const ExecutorDeviceType& device_type,
+    const bool enable_inner_join_fragment_skipping,
     Executor* executor) {
   const auto& outer_table_desc = ra_exe_unit.input_descs.front();
   const int outer_table_id = outer_table_desc.getTableId();
@@ -342,6 +373,7 @@ void QueryFragmentDescriptor::buildFragmentPerKernelMap(
                                  deleted_chunk_metadata_vec,
                                  std::nullopt,
                                  device_type,
+                                 enable_inner_join_fragment_skipping,
                                  executor);
 }
 
@@ -365,6 +397,7 @@ void QueryFragmentDescriptor::buildMultifragKernelMap(
   outer_fragments_size_ = outer_fragments->size();
 
   const auto inner_table_id_to_join_condition = executor->getInnerTabIdToJoinCond();
+  const auto fragment_skipping_quals = get_fragment_skipping_quals(ra_exe_unit);
 
   for (size_t outer_frag_id = 0; outer_frag_id < outer_fragments->size();
        ++outer_frag_id) {
@@ -379,7 +412,7 @@ void QueryFragmentDescriptor::buildMultifragKernelMap(
     const auto& fragment = (*outer_fragments)[outer_frag_id];
     auto skip_frag = executor->skipFragment(outer_table_desc,
                                             fragment,
-                                            ra_exe_unit.simple_quals,
+                                            fragment_skipping_quals,
                                             frag_offsets,
                                             outer_frag_id);
     if (enable_inner_join_fragment_skipping &&
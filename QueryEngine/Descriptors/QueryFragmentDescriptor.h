@@ -167,6 +167,7 @@ class QueryFragmentDescriptor {
                                  const int device_count,
                                  const size_t num_bytes_for_row,
                                  const ExecutorDeviceType& device_type,
+                                 const bool enable_inner_join_fragment_skipping,
                                  Executor* executor);
 
   void buildMultifragKernelMap(const RelAlgExecutionUnit& ra_exe_unit,
@@ -188,6 +189,7 @@ class QueryFragmentDescriptor {
       const ChunkMetadataVector& deleted_chunk_metadata_vec,
       const std::optional<size_t> table_desc_offset,
       const ExecutorDeviceType& device_type,
+      const bool enable_inner_join_fragment_skipping,
       Executor* executor);
 
   bool terminateDispatchMaybe(size_t& tuple_count,
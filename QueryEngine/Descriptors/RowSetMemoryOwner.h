@@ -54,6 +54,7 @@ class RowSetMemoryOwner final : public SimpleAllocator, boost::noncopyable {
     CHECK_LT(thread_idx, allocators_.size());
     auto allocator = allocators_[thread_idx].get();
     std::lock_guard<std::mutex> lock(state_mutex_);
+    allocated_bytes_ += num_bytes;
     return reinterpret_cast<int8_t*>(allocator->allocate(num_bytes));
   }
 
@@ -62,6 +63,7 @@ class RowSetMemoryOwner final : public SimpleAllocator, boost::noncopyable {
     CHECK_LT(thread_idx, allocators_.size());
     auto allocator = allocators_[thread_idx].get();
     std::lock_guard<std::mutex> lock(state_mutex_);
+    allocated_bytes_ += num_bytes;
     auto ret = reinterpret_cast<int8_t*>(allocator->allocateAndZero(num_bytes));
     count_distinct_bitmaps_.emplace_back(
         CountDistinctBitmapBuffer{ret, num_bytes, /*physical_buffer=*/true});
@@ -185,6 +187,30 @@ class RowSetMemoryOwner final : public SimpleAllocator, boost::noncopyable {
     return rtn;
   }
 
+  // Owner of intermediate results which are released before the end of the query. It
+  // shares the string dictionary proxies of this owner, so that transient string ids
+  // stay valid, the proxies it adds are given back by adoptStrDictProxies.
+  std::shared_ptr<RowSetMemoryOwner> cloneForIntermediateResults(
+      const size_t num_kernel_threads) {
+    auto rtn = std::make_shared<RowSetMemoryOwner>(arena_block_size_, num_kernel_threads);
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    rtn->str_dict_proxy_owned_ = str_dict_proxy_owned_;
+    rtn->lit_str_dict_proxy_ = lit_str_dict_proxy_;
+    rtn->string_dictionary_generations_ = string_dictionary_generations_;
+    return rtn;
+  }
+
+  void adoptStrDictProxies(const RowSetMemoryOwner& that) {
+    std::lock(state_mutex_, that.state_mutex_);
+    std::lock_guard<std::mutex> lock(state_mutex_, std::adopt_lock);
+    std::lock_guard<std::mutex> that_lock(that.state_mutex_, std::adopt_lock);
+    str_dict_proxy_owned_.insert(that.str_dict_proxy_owned_.begin(),
+                                 that.str_dict_proxy_owned_.end());
+    if (!lit_str_dict_proxy_) {
+      lit_str_dict_proxy_ = that.lit_str_dict_proxy_;
+    }
+  }
+
   void setDictionaryGenerations(StringDictionaryGenerations generations) {
     string_dictionary_generations_ = generations;
   }
@@ -195,6 +221,12 @@ class RowSetMemoryOwner final : public SimpleAllocator, boost::noncopyable {
 
   quantile::TDigest* nullTDigest(double const q);
 
+  // bytes handed out by the arena allocators, which live as long as this owner
+  size_t getAllocatedBytes() const {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    return allocated_bytes_;
+  }
+
  private:
   struct CountDistinctBitmapBuffer {
     int8_t* ptr;
@@ -217,6 +249,7 @@ class RowSetMemoryOwner final : public SimpleAllocator, boost::noncopyable {
 
   size_t arena_block_size_;  // for cloning
   std::vector<std::unique_ptr<Arena>> allocators_;
+  size_t allocated_bytes_{0};
 
   mutable std::mutex state_mutex_;
 
@@ -26,6 +26,7 @@
 #include "ErrorHandling.h"
 #include "ExpressionRewrite.h"
 #include "ExternalCacheInvalidators.h"
+#include "GeoFragmentBounds.h"
 #include "GpuMemUtils.h"
 #include "InPlaceSort.h"
 #include "JoinHashTable/BaselineJoinHashTable.h"
@@ -44,6 +45,8 @@
 
 #include "CudaMgr/CudaMgr.h"
 #include "DataMgr/BufferMgr/BufferMgr.h"
+#include "Geospatial/Compression.h"
+#include "OSDependent/omnisci_numa.h"
 #include "Parser/ParserNode.h"
 #include "Shared/SystemParameters.h"
 #include "Shared/TypedDataAccessors.h"
@@ -58,18 +61,22 @@
 #include "StringDictionaryGenerations.h"
 
 #include <llvm/Transforms/Utils/BasicBlockUtils.h>
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
 
 #ifdef HAVE_CUDA
 #include <cuda.h>
 #endif  // HAVE_CUDA
+#include <atomic>
 #include <chrono>
+#include <cmath>
 #include <ctime>
 #include <future>
 #include <iostream>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <set>
 #include <thread>
 
@@ -83,6 +90,7 @@ bool g_null_div_by_zero{false};
 unsigned g_trivial_loop_join_threshold{1000};
 bool g_from_table_reordering{true};
 bool g_inner_join_fragment_skipping{true};
+size_t g_min_cpu_morsel_rows{1024 * 1024};
 extern bool g_enable_smem_group_by;
 extern std::unique_ptr<llvm::Module> udf_gpu_module;
 extern std::unique_ptr<llvm::Module> udf_cpu_module;
@@ -96,6 +104,7 @@ bool g_optimize_row_initialization{true};
 bool g_enable_overlaps_hashjoin{true};
 bool g_enable_hashjoin_many_to_many{false};
 size_t g_overlaps_max_table_size_bytes{1024 * 1024 * 1024};
+size_t g_hash_table_cache_max_size_bytes{size_t(4) * 1024 * 1024 * 1024};
 double g_overlaps_target_entries_per_bin{1.3};
 bool g_strip_join_covered_quals{false};
 size_t g_constrained_by_in_threshold{10};
@@ -103,6 +112,7 @@ size_t g_default_max_groups_buffer_entry_guess{16384};
 size_t g_big_group_threshold{g_default_max_groups_buffer_entry_guess};
 bool g_enable_window_functions{true};
 bool g_enable_table_functions{false};
+size_t g_table_function_partition_min_rows{100000};
 size_t g_max_memory_allocation_size{2000000000};  // set to max slab size
 size_t g_min_memory_allocation_size{
     256};  // minimum memory allocation required for projection query output buffer
@@ -199,6 +209,8 @@ void Executor::clearMemory(const Data_Namespace::MemoryLevel memory_level) {
         // For now, assume the user wants to purge the hash table cache when they clear
         // CPU memory (currently used in ExecuteTest to lower memory pressure)
         JoinHashTableCacheInvalidator::invalidateCaches();
+        // cached query results hold on to the CPU memory of their queries as well
+        ResultSetCache::getCacheInvalidator()();
       }
       break;
     }
@@ -891,10 +903,15 @@ ResultSetPtr Executor::resultsUnion(SharedKernelContext& shared_context,
   using IndexedResultSet = std::pair<ResultSetPtr, std::vector<size_t>>;
   std::sort(results_per_device.begin(),
             results_per_device.end(),
-            [](const IndexedResultSet& lhs, const IndexedResultSet& rhs) {
+            [&shared_context](const IndexedResultSet& lhs, const IndexedResultSet& rhs) {
               CHECK_GE(lhs.second.size(), size_t(1));
               CHECK_GE(rhs.second.size(), size_t(1));
-              return lhs.second.front() < rhs.second.front();
+              if (lhs.second.front() != rhs.second.front()) {
+                return lhs.second.front() < rhs.second.front();
+              }
+              // kernels of the same split fragment, in the order of their rows
+              return shared_context.getOuterFirstRow(lhs.first.get()) <
+                     shared_context.getOuterFirstRow(rhs.first.get());
             });
 
   return get_merged_result(results_per_device);
@@ -2104,6 +2121,34 @@ bool has_lazy_fetched_columns(const std::vector<ColumnLazyFetchInfo>& fetched_co
 
 }  // namespace
 
+namespace {
+
+// Number of rows of the outer fragment of a kernel which can be split into row ranges,
+// zero for the kernels which can't: rowid lookups and kernels over several fragments of
+// a table, since only the rows of the first fragment of a kernel can start past zero.
+size_t get_kernel_outer_fragment_rows(const FragmentsList& frag_list,
+                                      const std::vector<InputTableInfo>& table_infos,
+                                      const int64_t rowid_lookup_key) {
+  if (rowid_lookup_key >= 0 || frag_list.empty() || table_infos.empty()) {
+    return 0;
+  }
+  for (const auto& table_frags : frag_list) {
+    if (table_frags.fragment_ids.size() != 1) {
+      return 0;
+    }
+  }
+  const auto& outer_frags = frag_list.front();
+  const auto& outer_table_info = table_infos.front();
+  if (outer_table_info.table_id != outer_frags.table_id) {
+    return 0;
+  }
+  const auto frag_id = outer_frags.fragment_ids.front();
+  const auto& fragments = outer_table_info.info.fragments;
+  return frag_id < fragments.size() ? fragments[frag_id].getNumTuples() : 0;
+}
+
+}  // namespace
+
 std::vector<std::unique_ptr<ExecutionKernel>> Executor::createKernels(
     SharedKernelContext& shared_context,
     const RelAlgExecutionUnit& ra_exe_unit,
@@ -2199,6 +2244,19 @@ std::vector<std::unique_ptr<ExecutionKernel>> Executor::createKernels(
       }
     }
 
+    // On CPU, the outer fragments bigger than the share of the outer table of a worker
+    // are split into row ranges, each scanned by a kernel of its own, so a table of one
+    // or a few large fragments still keeps all the workers busy. The kernels of a split
+    // fragment produce a result set each, reduced like the ones of different fragments.
+    size_t morsel_rows{0};
+    if (device_type == ExecutorDeviceType::CPU && g_min_cpu_morsel_rows &&
+        !ra_exe_unit.union_all && !table_infos.empty()) {
+      const size_t worker_count = std::max(cpu_threads(), 1);
+      const auto outer_table_rows = table_infos.front().info.getNumTuplesUpperBound();
+      morsel_rows = std::max(g_min_cpu_morsel_rows,
+                             (outer_table_rows + worker_count - 1) / worker_count);
+    }
+
     size_t frag_list_idx{0};
     auto fragment_per_kernel_dispatch = [&ra_exe_unit,
                                          &execution_kernels,
@@ -2208,6 +2266,8 @@ std::vector<std::unique_ptr<ExecutionKernel>> Executor::createKernels(
                                          &device_type,
                                          &query_comp_desc,
                                          &query_mem_desc,
+                                         &table_infos,
+                                         morsel_rows,
                                          render_info](const int device_id,
                                                       const FragmentsList& frag_list,
                                                       const int64_t rowid_lookup_key) {
@@ -2216,6 +2276,32 @@ std::vector<std::unique_ptr<ExecutionKernel>> Executor::createKernels(
       }
       CHECK_GE(device_id, 0);
 
+      const auto outer_frag_rows =
+          get_kernel_outer_fragment_rows(frag_list, table_infos, rowid_lookup_key);
+      if (morsel_rows && outer_frag_rows > morsel_rows) {
+        const size_t morsel_count = (outer_frag_rows + morsel_rows - 1) / morsel_rows;
+        for (size_t morsel_idx = 0; morsel_idx < morsel_count; ++morsel_idx) {
+          const KernelRowRange row_range{
+              outer_frag_rows * morsel_idx / morsel_count,
+              outer_frag_rows * (morsel_idx + 1) / morsel_count};
+          execution_kernels.emplace_back(
+              std::make_unique<ExecutionKernel>(ra_exe_unit,
+                                                device_type,
+                                                device_id,
+                                                eo,
+                                                column_fetcher,
+                                                query_comp_desc,
+                                                query_mem_desc,
+                                                frag_list,
+                                                ExecutorDispatchMode::KernelPerFragment,
+                                                render_info,
+                                                rowid_lookup_key,
+                                                row_range));
+        }
+        ++frag_list_idx;
+        return;
+      }
+
       execution_kernels.emplace_back(
           std::make_unique<ExecutionKernel>(ra_exe_unit,
                                             device_type,
@@ -2238,27 +2324,185 @@ std::vector<std::unique_ptr<ExecutionKernel>> Executor::createKernels(
   return execution_kernels;
 }
 
+namespace {
+
+size_t get_outer_tuple_count(const ExecutionKernel& kernel,
+                             const std::vector<InputTableInfo>& query_infos) {
+  const auto& frag_list = kernel.getFragmentList();
+  if (frag_list.empty()) {
+    return 0;
+  }
+  if (kernel.getRowRange()) {
+    return kernel.getRowRange()->end - kernel.getRowRange()->begin;
+  }
+  const auto& outer_frags = frag_list.front();
+  const auto table_info_it =
+      std::find_if(query_infos.begin(),
+                   query_infos.end(),
+                   [&outer_frags](const InputTableInfo& table_info) {
+                     return table_info.table_id == outer_frags.table_id;
+                   });
+  if (table_info_it == query_infos.end()) {
+    return 0;
+  }
+  const auto& fragments = table_info_it->info.fragments;
+  size_t tuple_count{0};
+  for (const auto frag_id : outer_frags.fragment_ids) {
+    if (frag_id < fragments.size()) {
+      tuple_count += fragments[frag_id].getNumTuples();
+    }
+  }
+  return tuple_count;
+}
+
+// NUMA node holding the first outer fragment of a CPU kernel, -1 if it isn't known
+// (GPU kernels, temporary tables, chunks not loaded yet or slabs not bound to a node).
+int get_kernel_numa_node(const ExecutionKernel& kernel,
+                         const int db_id,
+                         Data_Namespace::DataMgr& data_mgr) {
+  const auto& frag_list = kernel.getFragmentList();
+  if (kernel.getDeviceType() != ExecutorDeviceType::CPU || frag_list.empty() ||
+      frag_list.front().fragment_ids.empty() || frag_list.front().table_id < 0) {
+    return -1;
+  }
+  const auto& outer_frags = frag_list.front();
+  for (const auto& col_desc : kernel.getExecutionUnit().input_col_descs) {
+    if (col_desc->getScanDesc().getTableId() != outer_frags.table_id) {
+      continue;
+    }
+    ChunkKey chunk_key{db_id,
+                       outer_frags.table_id,
+                       col_desc->getColId(),
+                       static_cast<int>(outer_frags.fragment_ids.front())};
+    auto numa_node = data_mgr.getChunkNumaNode(chunk_key);
+    if (numa_node < 0) {
+      // variable length columns keep their data in a separate chunk
+      chunk_key.push_back(1);
+      numa_node = data_mgr.getChunkNumaNode(chunk_key);
+    }
+    return numa_node;
+  }
+  return -1;
+}
+
+}  // namespace
+
 template <typename THREAD_POOL>
 void Executor::launchKernels(SharedKernelContext& shared_context,
                              std::vector<std::unique_ptr<ExecutionKernel>>&& kernels) {
   auto clock_begin = timer_start();
   std::lock_guard<std::mutex> kernel_lock(kernel_mutex_);
   kernel_queue_time_ms_ += timer_stop(clock_begin);
+  last_kernel_count_ = kernels.size();
+
+  // A fixed set of workers pulls the kernels from a shared queue, biggest inputs first,
+  // so a few large fragments don't leave the other workers idle at the end of the query.
+  std::vector<size_t> kernel_tuple_counts;
+  kernel_tuple_counts.reserve(kernels.size());
+  for (const auto& kernel : kernels) {
+    CHECK(kernel);
+    kernel_tuple_counts.push_back(
+        get_outer_tuple_count(*kernel, shared_context.getQueryInfos()));
+  }
+  std::vector<size_t> kernel_order(kernels.size());
+  std::iota(kernel_order.begin(), kernel_order.end(), 0);
+  std::stable_sort(kernel_order.begin(),
+                   kernel_order.end(),
+                   [&kernel_tuple_counts](const size_t lhs, const size_t rhs) {
+                     return kernel_tuple_counts[lhs] > kernel_tuple_counts[rhs];
+                   });
+
+  // When the CPU buffer pool binds its slabs to NUMA nodes, the kernels are split into
+  // one queue per node, plus a last queue for the kernels without a known node. Workers
+  // are pinned to a node round robin and drain its queue first, then the unplaced
+  // kernels and finally the queues of the other nodes, so no worker idles while kernels
+  // are left. Every queue keeps the biggest inputs first order. Finding the node of a
+  // kernel takes the buffer pool locks, so it's only done when the slabs are bound.
+  std::vector<int> numa_nodes;
+  std::vector<std::vector<size_t>> kernel_queues;
+  auto& data_mgr = catalog_->getDataMgr();
+  if (data_mgr.cpuSlabsBoundToNumaNodes()) {
+    const auto all_numa_nodes = omnisci::get_numa_nodes();
+    const auto db_id = catalog_->getCurrentDB().dbId;
+    kernel_queues.resize(all_numa_nodes.size() + 1);
+    for (const auto kernel_idx : kernel_order) {
+      const auto numa_node = get_kernel_numa_node(*kernels[kernel_idx], db_id, data_mgr);
+      const auto node_it =
+          std::find(all_numa_nodes.begin(), all_numa_nodes.end(), numa_node);
+      kernel_queues[node_it - all_numa_nodes.begin()].push_back(kernel_idx);
+    }
+    if (kernel_queues.back().size() < kernel_order.size()) {
+      numa_nodes = all_numa_nodes;
+    }
+  }
+  if (numa_nodes.empty()) {
+    kernel_queues = {std::move(kernel_order)};
+  }
+  std::vector<std::atomic<size_t>> next_kernels(kernel_queues.size());
+  for (auto& next_kernel : next_kernels) {
+    next_kernel = 0;
+  }
 
+  const size_t worker_count =
+      std::min(kernels.size(), static_cast<size_t>(std::max(cpu_threads(), 1)));
+  std::atomic<bool> kernel_failed{false};
   THREAD_POOL thread_pool;
-  VLOG(1) << "Launching " << kernels.size() << " kernels for query.";
-  size_t kernel_idx = 1;
-  for (auto& kernel : kernels) {
+  VLOG(1) << "Launching " << kernels.size() << " kernels for query on " << worker_count
+          << " worker threads"
+          << (numa_nodes.empty()
+                  ? std::string(".")
+                  : " over " + std::to_string(numa_nodes.size()) + " NUMA nodes.");
+  for (size_t worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
     thread_pool.spawn(
-        [this, &shared_context, parent_thread_id = logger::thread_id()](
-            ExecutionKernel* kernel, const size_t crt_kernel_idx) {
-          CHECK(kernel);
+        [this,
+         &shared_context,
+         &kernels,
+         &numa_nodes,
+         &kernel_queues,
+         &next_kernels,
+         &kernel_failed,
+         worker_idx,
+         parent_thread_id = logger::thread_id()](const size_t thread_idx) {
           DEBUG_TIMER_NEW_THREAD(parent_thread_id);
-          const size_t thread_idx = crt_kernel_idx % cpu_threads();
-          kernel->run(this, thread_idx, shared_context);
+          std::vector<size_t> queue_order;
+          std::vector<int> prev_cpu_affinity;
+          if (numa_nodes.empty()) {
+            queue_order.push_back(0);
+          } else {
+            const size_t home_queue = worker_idx % numa_nodes.size();
+            queue_order.push_back(home_queue);
+            queue_order.push_back(numa_nodes.size());
+            for (size_t i = 1; i < numa_nodes.size(); ++i) {
+              queue_order.push_back((home_queue + i) % numa_nodes.size());
+            }
+            prev_cpu_affinity = omnisci::get_thread_cpu_affinity();
+            omnisci::set_thread_cpu_affinity(
+                omnisci::get_numa_node_cpus(numa_nodes[home_queue]));
+          }
+          // pool threads are reused, give back the whole machine
+          ScopeGuard restore_cpu_affinity = [&prev_cpu_affinity] {
+            if (!prev_cpu_affinity.empty()) {
+              omnisci::set_thread_cpu_affinity(prev_cpu_affinity);
+            }
+          };
+          for (const auto queue_idx : queue_order) {
+            const auto& kernel_queue = kernel_queues[queue_idx];
+            auto& next_kernel = next_kernels[queue_idx];
+            for (size_t crt_kernel = next_kernel++;
+                 crt_kernel < kernel_queue.size() && !kernel_failed;
+                 crt_kernel = next_kernel++) {
+              auto& kernel = kernels[kernel_queue[crt_kernel]];
+              try {
+                kernel->run(this, thread_idx, shared_context);
+              } catch (...) {
+                // the error surfaces on join, don't start any more kernels
+                kernel_failed = true;
+                throw;
+              }
+            }
+          }
         },
-        kernel.get(),
-        kernel_idx++);
+        worker_idx);
   }
   thread_pool.join();
 }
@@ -2910,6 +3154,7 @@ int32_t Executor::executePlanWithoutGroupBy(
     Data_Namespace::DataMgr* data_mgr,
     const int device_id,
     const uint32_t start_rowid,
+    const bool rowid_lookup,
     const uint32_t num_tables,
     const bool allow_runtime_interrupt,
     RenderInfo* render_info) {
@@ -2962,6 +3207,7 @@ int32_t Executor::executePlanWithoutGroupBy(
                                                frag_offsets,
                                                0,
                                                &error_code,
+                                               rowid_lookup,
                                                num_tables,
                                                join_hash_table_ptrs);
     output_memory_scope.reset(new OutVecOwner(out_vec));
@@ -3125,6 +3371,7 @@ int32_t Executor::executePlanWithGroupBy(
     const int outer_table_id,
     const int64_t scan_limit,
     const uint32_t start_rowid,
+    const bool rowid_lookup,
     const uint32_t num_tables,
     const bool allow_runtime_interrupt,
     RenderInfo* render_info) {
@@ -3176,7 +3423,7 @@ int32_t Executor::executePlanWithGroupBy(
           << query_exe_context->query_mem_desc_.getEntryCount()
           << " device_id=" << device_id << " outer_table_id=" << outer_table_id
           << " scan_limit=" << scan_limit << " start_rowid=" << start_rowid
-          << " num_tables=" << num_tables;
+          << " rowid_lookup=" << rowid_lookup << " num_tables=" << num_tables;
 
   RelAlgExecutionUnit ra_exe_unit_copy = ra_exe_unit;
   // For UNION ALL, filter out input_descs and input_col_descs that are not associated
@@ -3215,6 +3462,7 @@ int32_t Executor::executePlanWithGroupBy(
         frag_offsets,
         ra_exe_unit_copy.union_all ? ra_exe_unit_copy.scan_limit : scan_limit,
         &error_code,
+        rowid_lookup,
         num_tables,
         join_hash_table_ptrs);
   } else {
@@ -3605,6 +3853,284 @@ bool Executor::isFragmentFullyDeleted(
   return false;
 }
 
+namespace {
+
+bool is_outer_table_column(const Analyzer::ColumnVar* col_var, const int table_id) {
+  return col_var && !dynamic_cast<const Analyzer::Var*>(col_var) &&
+         col_var->get_table_id() == table_id && !col_var->get_rte_idx();
+}
+
+// Returns the [min, max] range of the column in the fragment, if the chunk metadata holds
+// a valid one.
+std::optional<std::pair<int64_t, int64_t>> get_chunk_range(
+    const Analyzer::ColumnVar* col_var,
+    const Fragmenter_Namespace::FragmentInfo& fragment) {
+  const auto& chunk_metadata_map = fragment.getChunkMetadataMap();
+  const auto chunk_meta_it = chunk_metadata_map.find(col_var->get_column_id());
+  if (chunk_meta_it == chunk_metadata_map.end()) {
+    return std::nullopt;
+  }
+  const auto& chunk_type = col_var->get_type_info();
+  const auto chunk_min = extract_min_stat(chunk_meta_it->second->chunkStats, chunk_type);
+  const auto chunk_max = extract_max_stat(chunk_meta_it->second->chunkStats, chunk_type);
+  if (chunk_min > chunk_max) {
+    return std::nullopt;
+  }
+  return std::make_pair(chunk_min, chunk_max);
+}
+
+// Chunk metadata of dictionary encoded columns holds string ids. Rows can only reference
+// strings of the dictionary, so a literal missing from it gets an id which is outside the
+// range of every chunk.
+int64_t get_dict_id_of_literal(const Analyzer::Constant* literal,
+                               const SQLTypeInfo& col_ti,
+                               const Catalog_Namespace::Catalog& cat) {
+  CHECK(col_ti.is_dict_encoded_string());
+  CHECK(literal->get_constval().stringval);
+  const auto dd = cat.getMetadataForDict(col_ti.get_comp_param(), true);
+  CHECK(dd && dd->stringDict);
+  return dd->stringDict->getIdOfString(*literal->get_constval().stringval);
+}
+
+// Returns true if none of the values of an IN list on an integer, time or dictionary
+// encoded column of the outer table falls into the range of the column in the fragment.
+bool in_values_outside_chunk_range(const Analyzer::InValues& in_values,
+                                   const int table_id,
+                                   const Fragmenter_Namespace::FragmentInfo& fragment,
+                                   const Catalog_Namespace::Catalog& cat) {
+  const auto col_var = dynamic_cast<const Analyzer::ColumnVar*>(in_values.get_arg());
+  if (!is_outer_table_column(col_var, table_id)) {
+    return false;
+  }
+  const auto& col_ti = col_var->get_type_info();
+  if (!col_ti.is_integer() && !col_ti.is_time() && !col_ti.is_dict_encoded_string()) {
+    return false;
+  }
+  const auto chunk_range = get_chunk_range(col_var, fragment);
+  if (!chunk_range) {
+    return false;
+  }
+  for (const auto& value : in_values.get_value_list()) {
+    const auto literal = dynamic_cast<const Analyzer::Constant*>(value.get());
+    if (!literal) {
+      return false;
+    }
+    if (literal->get_is_null()) {
+      // never matches
+      continue;
+    }
+    const auto& literal_ti = literal->get_type_info();
+    int64_t literal_val{0};
+    if (col_ti.is_dict_encoded_string()) {
+      if (!literal_ti.is_string()) {
+        return false;
+      }
+      literal_val = get_dict_id_of_literal(literal, col_ti, cat);
+    } else {
+      if (literal_ti.get_type() != col_ti.get_type() ||
+          literal_ti.get_dimension() != col_ti.get_dimension()) {
+        return false;
+      }
+      literal_val = extract_from_datum(literal->get_constval(), literal_ti);
+    }
+    if (literal_val >= chunk_range->first && literal_val <= chunk_range->second) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns true if a geo predicate between a geo column of the outer table and a literal
+// geometry, ST_Contains, ST_Intersects or ST_DWithin, can't hold for any row of the
+// fragment: the bounding box of the column in the fragment is farther from the box of
+// the literal than the ST_DWithin distance.
+bool geo_literal_outside_fragment_bounds(
+    const Analyzer::FunctionOper& geo_predicate,
+    const int table_id,
+    const Fragmenter_Namespace::FragmentInfo& fragment,
+    const Catalog_Namespace::Catalog& cat) {
+  const auto name = geo_predicate.getName();
+  const bool is_dwithin = boost::algorithm::starts_with(name, "ST_DWithin_");
+  if (!is_dwithin && !boost::algorithm::starts_with(name, "ST_Contains_") &&
+      !boost::algorithm::starts_with(name, "ST_cContains_") &&
+      !boost::algorithm::starts_with(name, "ST_Intersects_")) {
+    return false;
+  }
+  // the geo args are followed by the compression and input srid of both geometries, the
+  // output srid and, for ST_DWithin, the distance
+  const size_t num_trailing_args = is_dwithin ? 6 : 5;
+  if (table_id <= 0 || geo_predicate.getArity() <= num_trailing_args) {
+    return false;
+  }
+  const size_t num_geo_args = geo_predicate.getArity() - num_trailing_args;
+  std::vector<int32_t> compressions_and_srids;
+  for (size_t i = num_geo_args; i < num_geo_args + 5; ++i) {
+    const auto arg = dynamic_cast<const Analyzer::Constant*>(geo_predicate.getArg(i));
+    if (!arg || arg->get_type_info().get_type() != kINT) {
+      return false;
+    }
+    compressions_and_srids.push_back(arg->get_constval().intval);
+  }
+  const auto output_srid = compressions_and_srids[4];
+  if (compressions_and_srids[1] != output_srid ||
+      compressions_and_srids[3] != output_srid) {
+    // transformed on the fly, the boxes aren't in the same coordinate system
+    return false;
+  }
+  double distance{0};
+  if (is_dwithin) {
+    const auto distance_arg =
+        dynamic_cast<const Analyzer::Constant*>(geo_predicate.getArg(num_geo_args + 5));
+    if (!distance_arg || distance_arg->get_is_null() ||
+        distance_arg->get_type_info().get_type() != kDOUBLE) {
+      return false;
+    }
+    distance = std::max(distance_arg->get_constval().doubleval, 0.0);
+  }
+
+  // a geo column is passed along with its bounds, a literal as constant coords, ring
+  // sizes and bounds arrays
+  const Analyzer::ColumnVar* geo_col{nullptr};
+  std::vector<const Analyzer::ColumnVar*> physical_cols;
+  const Analyzer::Constant* literal_coords{nullptr};
+  for (size_t i = 0; i < num_geo_args; ++i) {
+    const auto arg = geo_predicate.getArg(i);
+    if (const auto col_var = dynamic_cast<const Analyzer::ColumnVar*>(arg)) {
+      if (!is_outer_table_column(col_var, table_id)) {
+        return false;
+      }
+      if (IS_GEO(col_var->get_type_info().get_type())) {
+        if (geo_col) {
+          return false;
+        }
+        geo_col = col_var;
+      } else {
+        physical_cols.push_back(col_var);
+      }
+      continue;
+    }
+    const auto constant = dynamic_cast<const Analyzer::Constant*>(arg);
+    if (!constant || constant->get_is_null()) {
+      return false;
+    }
+    const auto& constant_ti = constant->get_type_info();
+    if (constant_ti.is_array() && constant_ti.get_subtype() == kTINYINT) {
+      if (literal_coords) {
+        return false;
+      }
+      literal_coords = constant;
+    }
+  }
+  if (!geo_col || !literal_coords) {
+    return false;
+  }
+  const auto geo_cd = cat.getMetadataForColumn(table_id, geo_col->get_column_id());
+  if (!geo_cd || !IS_GEO(geo_cd->columnType.get_type())) {
+    return false;
+  }
+  for (const auto physical_col : physical_cols) {
+    if (physical_col->get_column_id() <= geo_cd->columnId ||
+        physical_col->get_column_id() >
+            geo_cd->columnId + geo_cd->columnType.get_physical_cols()) {
+      return false;
+    }
+  }
+
+  std::vector<int8_t> compressed_coords;
+  for (const auto& value : literal_coords->get_value_list()) {
+    const auto coord_byte = dynamic_cast<const Analyzer::Constant*>(value.get());
+    if (!coord_byte) {
+      return false;
+    }
+    compressed_coords.push_back(coord_byte->get_constval().tinyintval);
+  }
+  const auto coords =
+      Geospatial::decompress_coords<double, SQLTypeInfo>(literal_coords->get_type_info(),
+                                                         compressed_coords.data(),
+                                                         compressed_coords.size());
+  auto literal_bounds = GeoBoundingBox::empty();
+  double max_abs_coord{0};
+  for (size_t i = 0; i + 1 < coords->size(); i += 2) {
+    literal_bounds.extend((*coords)[i], (*coords)[i + 1]);
+    max_abs_coord =
+        std::max({max_abs_coord, std::abs((*coords)[i]), std::abs((*coords)[i + 1])});
+  }
+  if (literal_bounds.isEmpty()) {
+    return false;
+  }
+  const auto fragment_bounds =
+      GeoFragmentBoundsCache::instance().getBounds(cat, geo_cd, fragment);
+  if (!fragment_bounds) {
+    return false;
+  }
+  // the predicates compare decompressed coords within a tolerance, allow for it and for
+  // the rounding of the distance computations
+  const bool compressed = compressions_and_srids[0] == COMPRESSION_GEOINT32 ||
+                          compressions_and_srids[2] == COMPRESSION_GEOINT32;
+  const double tolerance = (compressed ? TOLERANCE_GEOINT32 : TOLERANCE_DEFAULT) +
+                           1e-12 * std::max(max_abs_coord, distance);
+  return !fragment_bounds->overlaps(literal_bounds, distance + tolerance);
+}
+
+// Returns true if an equality condition of an inner join compares a column of the outer
+// table to an inner column whose value range doesn't overlap the range of the outer
+// column in the fragment, in which case no row of the fragment has a match. The inner
+// range covers the whole inner column, a superset of the keys in the join hash table.
+bool join_key_ranges_disjoint(
+    const int table_id,
+    const std::list<std::shared_ptr<Analyzer::Expr>>& join_quals,
+    const Fragmenter_Namespace::FragmentInfo& fragment,
+    const std::unordered_map<PhysicalInput, ExpressionRange>& col_ranges) {
+  for (const auto& join_qual : join_quals) {
+    for (const auto& qual : qual_to_conjunctive_form(join_qual).quals) {
+      const auto equi_join = dynamic_cast<const Analyzer::BinOper*>(qual.get());
+      if (!equi_join || equi_join->get_optype() != kEQ) {
+        continue;
+      }
+      auto outer_col =
+          dynamic_cast<const Analyzer::ColumnVar*>(equi_join->get_left_operand());
+      auto inner_col =
+          dynamic_cast<const Analyzer::ColumnVar*>(equi_join->get_right_operand());
+      if (!outer_col || !inner_col) {
+        continue;
+      }
+      if (outer_col->get_rte_idx()) {
+        std::swap(outer_col, inner_col);
+      }
+      if (!is_outer_table_column(outer_col, table_id) || !inner_col->get_rte_idx() ||
+          dynamic_cast<const Analyzer::Var*>(inner_col)) {
+        continue;
+      }
+      const auto& outer_ti = outer_col->get_type_info();
+      const auto& inner_ti = inner_col->get_type_info();
+      const bool same_dict = outer_ti.is_dict_encoded_string() &&
+                             inner_ti.is_dict_encoded_string() &&
+                             outer_ti.get_comp_param() == inner_ti.get_comp_param();
+      if (!same_dict && !(outer_ti.is_integer() && inner_ti.is_integer())) {
+        continue;
+      }
+      const auto chunk_range = get_chunk_range(outer_col, fragment);
+      const auto inner_range_it = col_ranges.find(
+          PhysicalInput{inner_col->get_column_id(), inner_col->get_table_id()});
+      if (!chunk_range || inner_range_it == col_ranges.end()) {
+        continue;
+      }
+      const auto& inner_range = inner_range_it->second;
+      if (inner_range.getType() != ExpressionRangeType::Integer ||
+          inner_range.getIntMin() > inner_range.getIntMax()) {
+        continue;
+      }
+      if (chunk_range->second < inner_range.getIntMin() ||
+          chunk_range->first > inner_range.getIntMax()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 std::pair<bool, int64_t> Executor::skipFragment(
     const InputDescriptor& table_desc,
     const Fragmenter_Namespace::FragmentInfo& fragment,
@@ -3621,11 +4147,28 @@ std::pair<bool, int64_t> Executor::skipFragment(
   }
 
   for (const auto& simple_qual : simple_quals) {
+    const auto geo_predicate =
+        std::dynamic_pointer_cast<const Analyzer::FunctionOper>(simple_qual);
+    if (geo_predicate) {
+      if (geo_literal_outside_fragment_bounds(
+              *geo_predicate, table_id, fragment, *catalog_)) {
+        return {true, -1};
+      }
+      continue;
+    }
+    const auto in_values =
+        std::dynamic_pointer_cast<const Analyzer::InValues>(simple_qual);
+    if (in_values) {
+      if (in_values_outside_chunk_range(*in_values, table_id, fragment, *catalog_)) {
+        return {true, -1};
+      }
+      continue;
+    }
     const auto comp_expr =
         std::dynamic_pointer_cast<const Analyzer::BinOper>(simple_qual);
     if (!comp_expr) {
-      // is this possible?
-      return {false, -1};
+      // every qual is a conjunct, the others can still skip the fragment
+      continue;
     }
     const auto lhs = comp_expr->get_left_operand();
     auto lhs_col = dynamic_cast<const Analyzer::ColumnVar*>(lhs);
@@ -3646,8 +4189,24 @@ std::pair<bool, int64_t> Executor::skipFragment(
     const auto rhs = comp_expr->get_right_operand();
     const auto rhs_const = dynamic_cast<const Analyzer::Constant*>(rhs);
     if (!rhs_const) {
-      // is this possible?
-      return {false, -1};
+      continue;
+    }
+    if (lhs->get_type_info().is_dict_encoded_string()) {
+      if (comp_expr->get_optype() != kEQ || lhs != lhs_col ||
+          lhs_col->get_table_id() != table_id || rhs_const->get_is_null() ||
+          !rhs_const->get_type_info().is_string()) {
+        continue;
+      }
+      const auto chunk_range = get_chunk_range(lhs_col, fragment);
+      if (!chunk_range) {
+        continue;
+      }
+      const auto str_id =
+          get_dict_id_of_literal(rhs_const, lhs_col->get_type_info(), *catalog_);
+      if (str_id < chunk_range->first || str_id > chunk_range->second) {
+        return {true, -1};
+      }
+      continue;
     }
     if (!lhs->get_type_info().is_integer() && !lhs->get_type_info().is_time()) {
       continue;
@@ -3752,7 +4311,9 @@ std::pair<bool, int64_t> Executor::skipFragment(
  * join_quals and gather all the ones that meet the "simple_qual" characteristics
  * (logical expressions with AND operations, etc.). It then uses the skipFragment function
  * to decide whether the fragment should be skipped or not. The fragment will be skipped
- * if at least one of these skipFragment calls return a true statment in its first value.
+ * if at least one of these skipFragment calls return a true statment in its first value,
+ * or if an equality condition of the join compares an outer column to an inner column
+ * whose value range doesn't overlap the range of the outer column in the fragment.
  *   - The code depends on skipFragment's output to have a meaningful (anything but -1)
  * second value only if its first value is "false".
  *   - It is assumed that {false, n  > -1} has higher priority than {true, -1},
@@ -3800,6 +4361,11 @@ std::pair<bool, int64_t> Executor::skipFragmentInnerJoins(
     } else {
       skip_frag.first = skip_frag.first || temp_skip_frag.first;
     }
+    skip_frag.first = skip_frag.first ||
+                      join_key_ranges_disjoint(table_desc.getTableId(),
+                                               inner_join.quals,
+                                               fragment,
+                                               agg_col_range_cache_.asMap());
   }
   return skip_frag;
 }
@@ -449,6 +449,9 @@ class Executor {
   void enableRuntimeQueryInterrupt(const double runtime_query_check_freq,
                                    const unsigned pending_query_check_freq) const;
 
+  // only for testing usage, number of kernels the last launch ran
+  size_t getLastKernelCount() const { return last_kernel_count_; }
+
   static const size_t high_scan_limit{32000000};
 
   int8_t warpSize() const;
@@ -694,6 +697,7 @@ class Executor {
                                  const int outer_table_id,
                                  const int64_t limit,
                                  const uint32_t start_rowid,
+                                 const bool rowid_lookup,
                                  const uint32_t num_tables,
                                  const bool allow_runtime_interrupt,
                                  RenderInfo* render_info);
@@ -711,6 +715,7 @@ class Executor {
       Data_Namespace::DataMgr* data_mgr,
       const int device_id,
       const uint32_t start_rowid,
+      const bool rowid_lookup,
       const uint32_t num_tables,
       const bool allow_runtime_interrupt,
       RenderInfo* render_info);
@@ -1061,6 +1066,7 @@ class Executor {
 
   int64_t kernel_queue_time_ms_ = 0;
   int64_t compilation_queue_time_ms_ = 0;
+  size_t last_kernel_count_ = 0;
 
   // Singleton instance used for an execution unit which is a project with window
   // functions.
@@ -74,14 +74,23 @@ const std::vector<uint64_t>& SharedKernelContext::getFragOffsets() {
 }
 
 void SharedKernelContext::addDeviceResults(ResultSetPtr&& device_results,
-                                           std::vector<size_t> outer_table_fragment_ids) {
+                                           std::vector<size_t> outer_table_fragment_ids,
+                                           const size_t outer_first_row) {
   std::lock_guard<std::mutex> lock(reduce_mutex_);
   if (!needs_skip_result(device_results)) {
+    if (outer_first_row) {
+      outer_first_rows_.emplace(device_results.get(), outer_first_row);
+    }
     all_fragment_results_.emplace_back(std::move(device_results),
                                        outer_table_fragment_ids);
   }
 }
 
+size_t SharedKernelContext::getOuterFirstRow(const ResultSet* device_results) const {
+  const auto it = outer_first_rows_.find(device_results);
+  return it == outer_first_rows_.end() ? 0 : it->second;
+}
+
 std::vector<std::pair<ResultSetPtr, std::vector<size_t>>>&
 SharedKernelContext::getFragmentResults() {
   return all_fragment_results_;
@@ -184,6 +193,16 @@ void ExecutionKernel::runImpl(Executor* executor,
     if (fetch_result.num_rows.empty()) {
       return;
     }
+    if (row_range) {
+      // scan the rows of the range only, the column buffers are the whole fragment's so
+      // the row positions stay the ones in the fragment
+      CHECK_EQ(fetch_result.num_rows.size(), size_t(1));
+      auto& outer_num_rows = fetch_result.num_rows.front().front();
+      outer_num_rows = std::min(outer_num_rows, static_cast<int64_t>(row_range->end));
+      if (outer_num_rows <= static_cast<int64_t>(row_range->begin)) {
+        return;
+      }
+    }
     if (eo.with_dynamic_watchdog &&
         !shared_context.dynamic_watchdog_set.test_and_set(std::memory_order_acquire)) {
       CHECK_GT(eo.dynamic_watchdog_time_limit, 0u);
@@ -241,6 +260,9 @@ void ExecutionKernel::runImpl(Executor* executor,
                                                            frag_row_count.end(),
                                                            total_num_input_rows);
                   });
+    if (row_range) {
+      total_num_input_rows -= row_range->begin;
+    }
     VLOG(2) << "total_num_input_rows=" << total_num_input_rows;
     // TODO(adb): we may want to take this early out for all queries, but we are most
     // likely to see this query pattern on the kernel per fragment path (e.g. with HAVING
@@ -284,6 +306,8 @@ void ExecutionKernel::runImpl(Executor* executor,
       start_rowid = rowid_lookup_key -
                     all_frag_row_offsets[frag_list.begin()->fragment_ids.front()];
     }
+  } else if (row_range) {
+    start_rowid = row_range->begin;
   }
 
   if (ra_exe_unit_.groupby_exprs.empty()) {
@@ -300,6 +324,7 @@ void ExecutionKernel::runImpl(Executor* executor,
                                               &catalog->getDataMgr(),
                                               chosen_device_id,
                                               start_rowid,
+                                              /*rowid_lookup=*/rowid_lookup_key >= 0,
                                               ra_exe_unit_.input_descs.size(),
                                               eo.allow_runtime_query_interrupt,
                                               do_render ? render_info_ : nullptr);
@@ -323,6 +348,7 @@ void ExecutionKernel::runImpl(Executor* executor,
                                            outer_table_id,
                                            ra_exe_unit_.scan_limit,
                                            start_rowid,
+                                           /*rowid_lookup=*/rowid_lookup_key >= 0,
                                            ra_exe_unit_.input_descs.size(),
                                            eo.allow_runtime_query_interrupt,
                                            do_render ? render_info_ : nullptr);
@@ -342,5 +368,6 @@ void ExecutionKernel::runImpl(Executor* executor,
   if (err) {
     throw QueryExecutionError(err);
   }
-  shared_context.addDeviceResults(std::move(device_results_), outer_tab_frag_ids);
+  shared_context.addDeviceResults(
+      std::move(device_results_), outer_tab_frag_ids, row_range ? row_range->begin : 0);
 }
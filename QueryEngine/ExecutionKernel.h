@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <optional>
+#include <unordered_map>
+
 #include "Logger/Logger.h"
 #include "QueryEngine/ColumnFetcher.h"
 #include "QueryEngine/Descriptors/QueryCompilationDescriptor.h"
@@ -28,10 +31,15 @@ class SharedKernelContext {
   const std::vector<uint64_t>& getFragOffsets();
 
   void addDeviceResults(ResultSetPtr&& device_results,
-                        std::vector<size_t> outer_table_fragment_ids);
+                        std::vector<size_t> outer_table_fragment_ids,
+                        const size_t outer_first_row = 0);
 
   std::vector<std::pair<ResultSetPtr, std::vector<size_t>>>& getFragmentResults();
 
+  // First outer row the kernel which produced the results scanned, non zero only for the
+  // kernels of a split fragment. Orders the results of such kernels.
+  size_t getOuterFirstRow(const ResultSet* device_results) const;
+
   const std::vector<InputTableInfo>& getQueryInfos() const { return query_infos_; }
 
   std::atomic_flag dynamic_watchdog_set = ATOMIC_FLAG_INIT;
@@ -39,6 +47,7 @@ class SharedKernelContext {
  private:
   std::mutex reduce_mutex_;
   std::vector<std::pair<ResultSetPtr, std::vector<size_t>>> all_fragment_results_;
+  std::unordered_map<const ResultSet*, size_t> outer_first_rows_;
 
   std::vector<uint64_t> all_frag_row_offsets_;
   std::mutex all_frag_row_offsets_mutex_;
@@ -46,6 +55,13 @@ class SharedKernelContext {
   const RegisteredQueryHint query_hint_;
 };
 
+// Rows [begin, end) of its outer fragment a CPU kernel scans, when a large fragment is
+// split into several kernels.
+struct KernelRowRange {
+  size_t begin;
+  size_t end;
+};
+
 class ExecutionKernel {
  public:
   ExecutionKernel(const RelAlgExecutionUnit& ra_exe_unit,
@@ -58,7 +74,8 @@ class ExecutionKernel {
                   const FragmentsList& frag_list,
                   const ExecutorDispatchMode kernel_dispatch_mode,
                   RenderInfo* render_info,
-                  const int64_t rowid_lookup_key)
+                  const int64_t rowid_lookup_key,
+                  const std::optional<KernelRowRange>& row_range = std::nullopt)
       : ra_exe_unit_(ra_exe_unit)
       , chosen_device_type(chosen_device_type)
       , chosen_device_id(chosen_device_id)
@@ -69,12 +86,21 @@ class ExecutionKernel {
       , frag_list(frag_list)
       , kernel_dispatch_mode(kernel_dispatch_mode)
       , render_info_(render_info)
-      , rowid_lookup_key(rowid_lookup_key) {}
+      , rowid_lookup_key(rowid_lookup_key)
+      , row_range(row_range) {}
 
   void run(Executor* executor,
            const size_t thread_idx,
            SharedKernelContext& shared_context);
 
+  const FragmentsList& getFragmentList() const { return frag_list; }
+
+  const RelAlgExecutionUnit& getExecutionUnit() const { return ra_exe_unit_; }
+
+  ExecutorDeviceType getDeviceType() const { return chosen_device_type; }
+
+  const std::optional<KernelRowRange>& getRowRange() const { return row_range; }
+
  private:
   const RelAlgExecutionUnit& ra_exe_unit_;
   const ExecutorDeviceType chosen_device_type;
@@ -87,6 +113,7 @@ class ExecutionKernel {
   const ExecutorDispatchMode kernel_dispatch_mode;
   RenderInfo* render_info_;
   const int64_t rowid_lookup_key;
+  const std::optional<KernelRowRange> row_range;
 
   ResultSetPtr device_results_;
 
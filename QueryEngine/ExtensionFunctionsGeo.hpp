@@ -513,6 +513,86 @@ DEVICE ALWAYS_INLINE bool tol_zero_template(const T x,
 
 enum class EdgeBehavior { kIncludePointOnEdge, kExcludePointOnEdge };
 
+/**
+ * Accumulates the crossing of the polygon edge e0 -> e1 by the ray shot from the point p
+ * into the winding number `wn`, see point_in_polygon_winding_number. Returns true if p
+ * lies on the edge, in which case the winding number is meaningless.
+ */
+template <typename T, EdgeBehavior TEdgeBehavior>
+DEVICE ALWAYS_INLINE bool winding_number_edge(const T e0x,
+                                              const T e0y,
+                                              const T e1x,
+                                              const T e1y,
+                                              const T px,
+                                              const T py,
+                                              int32_t* wn) {
+  constexpr bool include_point_on_edge =
+      TEdgeBehavior == EdgeBehavior::kIncludePointOnEdge;
+
+  auto get_epsilon = [=]() -> T {
+    if constexpr (std::is_floating_point<T>::value) {
+      const T edge_vec_magnitude =
+          (e1x - e0x) * (e1x - e0x) + (e1y - e0y) * (e1y - e0y);
+      return 0.003 * edge_vec_magnitude;
+    } else {
+      return T(0);
+    }
+    return T{};  // https://stackoverflow.com/a/64561686/2700898
+  };
+
+  const T epsilon = get_epsilon();
+  DEBUG_STMT(printf("using epsilon value %e\n", (double)epsilon));
+
+  if constexpr (include_point_on_edge) {
+    const T xp = (px - e1x) * (e0y - e1y) - (py - e1y) * (e0x - e1x);
+    const T pt_vec_magnitude = (px - e0x) * (px - e0x) + (py - e0y) * (py - e0y);
+    const T edge_vec_magnitude = (e1x - e0x) * (e1x - e0x) + (e1y - e0y) * (e1y - e0y);
+    if (tol_zero_template(xp, epsilon) && (pt_vec_magnitude <= edge_vec_magnitude)) {
+      DEBUG_STMT(printf("point is on edge: %e && %e <= %e\n",
+                        (double)xp,
+                        (double)pt_vec_magnitude,
+                        (double)edge_vec_magnitude));
+      return true;
+    }
+  }
+
+  if (e0y <= py) {
+    if (e1y > py) {
+      // upward crossing
+      DEBUG_STMT(printf("upward crossing\n"));
+      const auto is_left_val = is_left(e0x, e0y, e1x, e1y, px, py);
+      DEBUG_STMT(printf("Left val %f and tol zero left val %d\n",
+                        (double)is_left_val,
+                        tol_zero_template(is_left_val, epsilon)));
+      if (UNLIKELY(tol_zero_template(is_left_val, epsilon))) {
+        // p is on the edge
+        return true;
+      } else if (is_left_val > T(0)) {  // p left of edge
+        // valid up intersection
+        DEBUG_STMT(printf("++wn\n"));
+        ++*wn;
+      }
+    }
+  } else if (e1y <= py) {
+    // downward crossing
+    DEBUG_STMT(printf("downward crossing\n"));
+    const auto is_left_val = is_left(e0x, e0y, e1x, e1y, px, py);
+    DEBUG_STMT(printf("Left val %f and tol zero left val %d\n",
+                      (double)is_left_val,
+                      tol_zero_template(is_left_val, epsilon)));
+    if (UNLIKELY(tol_zero_template(is_left_val, epsilon))) {
+      // p is on the edge
+      return true;
+    } else if (is_left_val < T(0)) {  // p right of edge
+      // valid down intersection
+      DEBUG_STMT(printf("--wn\n"));
+      --*wn;
+    }
+  }
+
+  return false;
+}
+
 /**
  * Computes whether the point p is inside the polygon poly using the winding number
  * algorithm.
@@ -577,67 +657,10 @@ DEVICE ALWAYS_INLINE bool point_in_polygon_winding_number(const int8_t* poly,
     DEBUG_STMT(printf("edge 0: %ld : %f, %f\n", e0_index, (double)e0x, (double)e0y));
     DEBUG_STMT(printf("edge 1: %ld : %f, %f\n", e1_index, (double)e1x, (double)e1y));
 
-    auto get_epsilon = [=]() -> T {
-      if constexpr (std::is_floating_point<T>::value) {
-        const T edge_vec_magnitude =
-            (e1x - e0x) * (e1x - e0x) + (e1y - e0y) * (e1y - e0y);
-        return 0.003 * edge_vec_magnitude;
-      } else {
-        return T(0);
-      }
-      return T{};  // https://stackoverflow.com/a/64561686/2700898
-    };
-
-    const T epsilon = get_epsilon();
-    DEBUG_STMT(printf("using epsilon value %e\n", (double)epsilon));
-
-    if constexpr (include_point_on_edge) {
-      const T xp = (px - e1x) * (e0y - e1y) - (py - e1y) * (e0x - e1x);
-      const T pt_vec_magnitude = (px - e0x) * (px - e0x) + (py - e0y) * (py - e0y);
-      const T edge_vec_magnitude = (e1x - e0x) * (e1x - e0x) + (e1y - e0y) * (e1y - e0y);
-      if (tol_zero_template(xp, epsilon) && (pt_vec_magnitude <= edge_vec_magnitude)) {
-        DEBUG_STMT(printf("point is on edge: %e && %e <= %e\n",
-                          (double)xp,
-                          (double)pt_vec_magnitude,
-                          (double)edge_vec_magnitude));
-        return include_point_on_edge;
-      }
+    if (winding_number_edge<T, TEdgeBehavior>(e0x, e0y, e1x, e1y, px, py, &wn)) {
+      // p is on the edge
+      return include_point_on_edge;
     }
-
-    if (e0y <= py) {
-      if (e1y > py) {
-        // upward crossing
-        DEBUG_STMT(printf("upward crossing\n"));
-        const auto is_left_val = is_left(e0x, e0y, e1x, e1y, px, py);
-        DEBUG_STMT(printf("Left val %f and tol zero left val %d\n",
-                          (double)is_left_val,
-                          tol_zero_template(is_left_val, epsilon)));
-        if (UNLIKELY(tol_zero_template(is_left_val, epsilon))) {
-          // p is on the edge
-          return include_point_on_edge;
-        } else if (is_left_val > T(0)) {  // p left of edge
-          // valid up intersection
-          DEBUG_STMT(printf("++wn\n"));
-          ++wn;
-        }
-      }
-    } else if (e1y <= py) {
-      // downward crossing
-      DEBUG_STMT(printf("downward crossing\n"));
-      const auto is_left_val = is_left(e0x, e0y, e1x, e1y, px, py);
-      DEBUG_STMT(printf("Left val %f and tol zero left val %d\n",
-                        (double)is_left_val,
-                        tol_zero_template(is_left_val, epsilon)));
-      if (UNLIKELY(tol_zero_template(is_left_val, epsilon))) {
-        // p is on the edge
-        return include_point_on_edge;
-      } else if (is_left_val < T(0)) {  // p right of edge
-        // valid down intersection
-        DEBUG_STMT(printf("--wn\n"));
-        --wn;
-      }
-    }
-
     e0_index = e1_index;
     e0x = e1x;
     e0y = e1y;
@@ -3470,6 +3493,86 @@ DEVICE ALWAYS_INLINE bool Contains_Polygon_Point_Impl(const int8_t* poly_coords,
   return false;
 }
 
+/**
+ * Contains_Polygon_Point_Impl for ST_Contains, which excludes the points on edges, only
+ * testing the edges listed for the y band of the point by the polygon edge index of the
+ * inner table of an overlaps join, see PolygonEdgeIndex. `ring_edge_offsets` are the
+ * poly_num_rings + 1 offsets into `edges` of the listed edges of each ring, an edge being
+ * the ring relative index of its first point.
+ */
+template <typename T>
+DEVICE ALWAYS_INLINE bool Contains_Polygon_Point_Edge_Indexed_Impl(
+    const int8_t* poly_coords,
+    const int32_t* poly_ring_sizes,
+    const int64_t poly_num_rings,
+    const double* poly_bounds,
+    const int64_t poly_bounds_size,
+    const int8_t* p,
+    const int32_t* ring_edge_offsets,
+    const int32_t* edges,
+    const int32_t ic1,
+    const int32_t isr1,
+    const int32_t ic2,
+    const int32_t isr2,
+    const int32_t osr) {
+  if (poly_bounds) {
+    if (!box_contains_point(poly_bounds,
+                            poly_bounds_size,
+                            coord_x(p, 0, ic2, isr2, osr),
+                            coord_y(p, 1, ic2, isr2, osr))) {
+      return false;
+    }
+  }
+
+  auto get_coord = [=](const int8_t* data, const int32_t index, const bool x) -> T {
+    if constexpr (std::is_floating_point<T>::value) {
+      return x ? coord_x(data, index, ic1, isr1, osr)
+               : coord_y(data, index, ic1, isr1, osr);
+    } else {
+      return compressed_coord(data, index);
+    }
+    return T{};  // https://stackoverflow.com/a/64561686/2700898
+  };
+
+  T px, py;
+  if constexpr (std::is_floating_point<T>::value) {
+    px = coord_x(p, 0, ic2, isr2, osr);
+    py = coord_y(p, 1, ic2, isr2, osr);
+  } else {
+    px = compressed_coord(p, 0);
+    py = compressed_coord(p, 1);
+  }
+
+  auto ring = poly_coords;
+  for (int64_t r = 0; r < poly_num_rings; r++) {
+    const int32_t ring_num_points = poly_ring_sizes[r];
+    int32_t wn = 0;
+    for (int32_t i = ring_edge_offsets[r]; i < ring_edge_offsets[r + 1]; i++) {
+      const int32_t e0_index = edges[i];
+      const int32_t e1_index = (e0_index + 1) % ring_num_points;
+      if (winding_number_edge<T, EdgeBehavior::kExcludePointOnEdge>(
+              get_coord(ring, e0_index * 2, true),
+              get_coord(ring, e0_index * 2 + 1, false),
+              get_coord(ring, e1_index * 2, true),
+              get_coord(ring, e1_index * 2 + 1, false),
+              px,
+              py,
+              &wn)) {
+        // p is on the edge, outside of the ring
+        wn = 0;
+        break;
+      }
+    }
+    const bool inside_ring = wn != 0;
+    // inside the exterior ring and outside of the holes
+    if (inside_ring != (r == 0)) {
+      return false;
+    }
+    ring += ring_num_points * 2 * compression_unit_size(ic1);
+  }
+  return poly_num_rings > 0;
+}
+
 EXTENSION_NOINLINE bool ST_Contains_Polygon_Point(const int8_t* poly_coords,
                                                   const int64_t poly_coords_size,
                                                   const int32_t* poly_ring_sizes,
@@ -19,6 +19,7 @@
 #include "ExtensionFunctions.hpp"
 #include "ExtensionFunctionsBinding.h"
 #include "ExtensionFunctionsWhitelist.h"
+#include "JoinHashTable/OverlapsJoinHashTable.h"
 #include "TableFunctions/TableFunctions.hpp"
 
 #include <tuple>
@@ -223,8 +224,168 @@ bool ext_func_call_requires_nullcheck(const Analyzer::FunctionOper* function_ope
   return false;
 }
 
+// The edge index of the polygon of ST_Contains(polygon, point) built by the overlaps join
+// whose inner table holds the polygon column, if any.
+const PolygonEdgeIndex* get_polygon_edge_index(
+    const std::string& ext_func_name,
+    const Analyzer::FunctionOper* function_oper,
+    const PlanState* plan_state) {
+  if (ext_func_name != "ST_Contains_Polygon_Point" &&
+      ext_func_name != "ST_cContains_Polygon_Point") {
+    return nullptr;
+  }
+  CHECK_GT(function_oper->getArity(), size_t(0));
+  const auto poly_col =
+      dynamic_cast<const Analyzer::ColumnVar*>(function_oper->getArg(0));
+  if (!poly_col || poly_col->get_rte_idx() < 1) {
+    return nullptr;
+  }
+  for (const auto& hash_table : plan_state->join_info_.join_hash_tables_) {
+    const auto overlaps_hash_table =
+        dynamic_cast<const OverlapsJoinHashTable*>(hash_table.get());
+    if (!overlaps_hash_table ||
+        hash_table->getInnerTableRteIdx() != poly_col->get_rte_idx()) {
+      continue;
+    }
+    const auto polygon_edge_index = overlaps_hash_table->getPolygonEdgeIndex();
+    if (polygon_edge_index &&
+        polygon_edge_index->getTableId() == poly_col->get_table_id() &&
+        polygon_edge_index->getColumnId() == poly_col->get_column_id()) {
+      return polygon_edge_index;
+    }
+  }
+  return nullptr;
+}
+
+template <typename T>
+bool contains_polygon_point_edge_indexed(const int8_t* poly_coords,
+                                         const int64_t poly_coords_size,
+                                         const int32_t* poly_ring_sizes,
+                                         const int64_t poly_num_rings,
+                                         const double* poly_bounds,
+                                         const int64_t poly_bounds_size,
+                                         const int8_t* p,
+                                         const int64_t psize,
+                                         const int32_t ic1,
+                                         const int32_t isr1,
+                                         const int32_t ic2,
+                                         const int32_t isr2,
+                                         const int32_t osr,
+                                         const int64_t polygon_edge_index_handle,
+                                         const int64_t row) {
+  const auto polygon_edge_index =
+      reinterpret_cast<const PolygonEdgeIndex*>(polygon_edge_index_handle);
+  CHECK(polygon_edge_index);
+  // the index holds the untransformed y of the polygon, the compressed version compares
+  // compressed coords which decompress in the same order
+  const bool untransformed = !std::is_floating_point<T>::value || isr1 == osr;
+  if (untransformed) {
+    const double y = std::is_floating_point<T>::value
+                         ? coord_y(p, 1, ic2, isr2, osr)
+                         : decompress_coord(p, 1, ic2, false);
+    const int32_t* edges{nullptr};
+    const auto ring_edge_offsets = polygon_edge_index->getRingEdgeOffsets(
+        row, poly_coords_size / compression_unit_size(ic1), poly_num_rings, y, &edges);
+    if (ring_edge_offsets) {
+      return Contains_Polygon_Point_Edge_Indexed_Impl<T>(poly_coords,
+                                                         poly_ring_sizes,
+                                                         poly_num_rings,
+                                                         poly_bounds,
+                                                         poly_bounds_size,
+                                                         p,
+                                                         ring_edge_offsets,
+                                                         edges,
+                                                         ic1,
+                                                         isr1,
+                                                         ic2,
+                                                         isr2,
+                                                         osr);
+    }
+  }
+  return Contains_Polygon_Point_Impl<T, EdgeBehavior::kExcludePointOnEdge>(
+      poly_coords,
+      poly_coords_size,
+      poly_ring_sizes,
+      poly_num_rings,
+      poly_bounds,
+      poly_bounds_size,
+      p,
+      psize,
+      ic1,
+      isr1,
+      ic2,
+      isr2,
+      osr);
+}
+
 }  // namespace
 
+extern "C" RUNTIME_EXPORT bool ST_Contains_Polygon_Point_EdgeIndexed(
+    const int8_t* poly_coords,
+    const int64_t poly_coords_size,
+    const int32_t* poly_ring_sizes,
+    const int64_t poly_num_rings,
+    const double* poly_bounds,
+    const int64_t poly_bounds_size,
+    const int8_t* p,
+    const int64_t psize,
+    const int32_t ic1,
+    const int32_t isr1,
+    const int32_t ic2,
+    const int32_t isr2,
+    const int32_t osr,
+    const int64_t polygon_edge_index_handle,
+    const int64_t row) {
+  return contains_polygon_point_edge_indexed<double>(poly_coords,
+                                                     poly_coords_size,
+                                                     poly_ring_sizes,
+                                                     poly_num_rings,
+                                                     poly_bounds,
+                                                     poly_bounds_size,
+                                                     p,
+                                                     psize,
+                                                     ic1,
+                                                     isr1,
+                                                     ic2,
+                                                     isr2,
+                                                     osr,
+                                                     polygon_edge_index_handle,
+                                                     row);
+}
+
+extern "C" RUNTIME_EXPORT bool ST_cContains_Polygon_Point_EdgeIndexed(
+    const int8_t* poly_coords,
+    const int64_t poly_coords_size,
+    const int32_t* poly_ring_sizes,
+    const int64_t poly_num_rings,
+    const double* poly_bounds,
+    const int64_t poly_bounds_size,
+    const int8_t* p,
+    const int64_t psize,
+    const int32_t ic1,
+    const int32_t isr1,
+    const int32_t ic2,
+    const int32_t isr2,
+    const int32_t osr,
+    const int64_t polygon_edge_index_handle,
+    const int64_t row) {
+  return contains_polygon_point_edge_indexed<int64_t>(poly_coords,
+                                                      poly_coords_size,
+                                                      poly_ring_sizes,
+                                                      poly_num_rings,
+                                                      poly_bounds,
+                                                      poly_bounds_size,
+                                                      p,
+                                                      psize,
+                                                      ic1,
+                                                      isr1,
+                                                      ic2,
+                                                      isr2,
+                                                      osr,
+                                                      polygon_edge_index_handle,
+                                                      row);
+}
+
 extern "C" RUNTIME_EXPORT void register_buffer_with_executor_rsm(int64_t exec,
                                                                  int8_t* buffer) {
   Executor* exec_ptr = reinterpret_cast<Executor*>(exec);
@@ -368,8 +529,19 @@ llvm::Value* CodeGenerator::codegenFunctionOper(
     args.insert(args.begin(), buffer_ret);
   }
 
+  auto ext_func_name = ext_func_sig.getName();
+  if (co.device_type == ExecutorDeviceType::CPU) {
+    // ST_Contains after the probe of an overlaps join on the polygon, only test the
+    // polygon edges indexed for the band of the point
+    if (const auto polygon_edge_index =
+            get_polygon_edge_index(ext_func_name, function_oper, plan_state_)) {
+      args.push_back(cgen_state_->llInt(reinterpret_cast<int64_t>(polygon_edge_index)));
+      args.push_back(posArg(function_oper->getArg(0)));
+      ext_func_name += "_EdgeIndexed";
+    }
+  }
   const auto ext_call = cgen_state_->emitExternalCall(
-      ext_func_sig.getName(), ret_ty, args, {}, ret_ti.is_buffer());
+      ext_func_name, ret_ty, args, {}, ret_ti.is_buffer());
   auto ext_call_nullcheck = endArgsNullcheck(
       bbs, ret_ti.is_buffer() ? buffer_ret : ext_call, null_buffer_ptr, function_oper);
 
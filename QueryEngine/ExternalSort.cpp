@@ -0,0 +1,550 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/ExternalSort.h"
+
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#include "Catalog/SysCatalog.h"
+#include "Logger/Logger.h"
+#include "QueryEngine/ResultSet.h"
+#include "Shared/Intervals.h"
+#include "Shared/InlineNullValues.h"
+#include "Shared/thread_count.h"
+#include "Shared/threadpool.h"
+
+bool g_enable_external_sort{true};
+size_t g_external_sort_memory_budget{size_t(4) << 30};
+
+namespace external_sort {
+
+namespace {
+
+// size of the chunks in which the runs are written
+constexpr size_t kRunIoBufferBytes{size_t(1) << 20};
+
+// smallest read buffer of a run during the merge, whatever the budget
+constexpr size_t kMinMergeBufferBytes{size_t(64) << 10};
+
+// a record starts with the sizes of its key and of its values
+constexpr size_t kRecordHeaderBytes{2 * sizeof(uint32_t)};
+
+enum class ValueTag : int8_t {
+  kInt64,
+  kDouble,
+  kFloat,
+  kString,
+  kNullString,
+  kArray,
+  kNullArray
+};
+
+template <typename T>
+void append_raw(std::string& out, const T val) {
+  out.append(reinterpret_cast<const char*>(&val), sizeof(T));
+}
+
+template <typename T>
+T read_raw(std::string_view& in) {
+  CHECK_GE(in.size(), sizeof(T));
+  T val;
+  std::memcpy(&val, in.data(), sizeof(T));
+  in.remove_prefix(sizeof(T));
+  return val;
+}
+
+// Appends the bytes of |val| most significant first, so that unsigned values compare
+// as their encodings do.
+template <typename T>
+void append_big_endian(std::string& out, const T val) {
+  static_assert(std::is_unsigned<T>::value);
+  for (int shift = 8 * (sizeof(T) - 1); shift >= 0; shift -= 8) {
+    out.push_back(static_cast<char>((val >> shift) & 0xff));
+  }
+}
+
+void append_key_int(std::string& key, const int64_t val) {
+  // flipping the sign bit orders negative values first
+  append_big_endian(key, static_cast<uint64_t>(val) ^ (uint64_t(1) << 63));
+}
+
+template <typename FLOAT_TYPE, typename BITS_TYPE>
+void append_key_fp(std::string& key, const FLOAT_TYPE val) {
+  static_assert(sizeof(FLOAT_TYPE) == sizeof(BITS_TYPE));
+  constexpr BITS_TYPE sign_bit = BITS_TYPE(1) << (8 * sizeof(BITS_TYPE) - 1);
+  BITS_TYPE bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  // negative values get all their bits flipped, so that larger magnitudes come first
+  append_big_endian(key,
+                    (bits & sign_bit) ? BITS_TYPE(~bits) : BITS_TYPE(bits | sign_bit));
+}
+
+void append_key_string(std::string& key, const std::string& str) {
+  // zero bytes are escaped and the string terminated by two zeros, so that a string
+  // orders before any string it is a prefix of
+  for (const auto c : str) {
+    key.push_back(c);
+    if (c == '\0') {
+      key.push_back(static_cast<char>(0xff));
+    }
+  }
+  key.append(2, '\0');
+}
+
+bool is_null_int(const int64_t val, const SQLTypeInfo& ti) {
+  if (ti.is_boolean()) {
+    return val == NULL_BOOLEAN;
+  }
+  if (ti.is_time() || ti.is_decimal()) {
+    return val == NULL_BIGINT;
+  }
+  return val == inline_int_null_val(ti);
+}
+
+void append_key_scalar(std::string& key,
+                       const ScalarTargetValue& tv,
+                       const SQLTypeInfo& ti,
+                       const Analyzer::OrderEntry& order_entry) {
+  // nulls get a marker of their own on either side of the non null values, which
+  // holds for both directions
+  const char null_marker = order_entry.nulls_first ? 0 : 2;
+  const char value_marker = 1;
+  const auto key_begin = key.size();
+  if (const auto ival = boost::get<int64_t>(&tv)) {
+    if (is_null_int(*ival, ti)) {
+      key.push_back(null_marker);
+      return;
+    }
+    key.push_back(value_marker);
+    append_key_int(key, *ival);
+  } else if (const auto dval = boost::get<double>(&tv)) {
+    if (*dval == inline_fp_null_val(ti.is_decimal() ? SQLTypeInfo(kDOUBLE, false) : ti)) {
+      key.push_back(null_marker);
+      return;
+    }
+    key.push_back(value_marker);
+    append_key_fp<double, uint64_t>(key, *dval);
+  } else if (const auto fval = boost::get<float>(&tv)) {
+    if (*fval == NULL_FLOAT) {
+      key.push_back(null_marker);
+      return;
+    }
+    key.push_back(value_marker);
+    append_key_fp<float, uint32_t>(key, *fval);
+  } else {
+    const auto nullable_str = boost::get<NullableString>(&tv);
+    CHECK(nullable_str);
+    const auto str = boost::get<std::string>(nullable_str);
+    if (!str) {
+      key.push_back(null_marker);
+      return;
+    }
+    key.push_back(value_marker);
+    append_key_string(key, *str);
+  }
+  if (order_entry.is_desc) {
+    std::for_each(key.begin() + key_begin + 1, key.end(), [](char& c) { c = ~c; });
+  }
+}
+
+void append_scalar(std::string& out, const ScalarTargetValue& tv) {
+  if (const auto ival = boost::get<int64_t>(&tv)) {
+    append_raw(out, ValueTag::kInt64);
+    append_raw(out, *ival);
+  } else if (const auto dval = boost::get<double>(&tv)) {
+    append_raw(out, ValueTag::kDouble);
+    append_raw(out, *dval);
+  } else if (const auto fval = boost::get<float>(&tv)) {
+    append_raw(out, ValueTag::kFloat);
+    append_raw(out, *fval);
+  } else {
+    const auto nullable_str = boost::get<NullableString>(&tv);
+    CHECK(nullable_str);
+    const auto str = boost::get<std::string>(nullable_str);
+    if (!str) {
+      append_raw(out, ValueTag::kNullString);
+      return;
+    }
+    append_raw(out, ValueTag::kString);
+    append_raw(out, static_cast<uint32_t>(str->size()));
+    out.append(*str);
+  }
+}
+
+void append_target_value(std::string& out, const TargetValue& tv) {
+  if (const auto scalar_tv = boost::get<ScalarTargetValue>(&tv)) {
+    append_scalar(out, *scalar_tv);
+    return;
+  }
+  const auto array_tv = boost::get<ArrayTargetValue>(&tv);
+  if (!array_tv) {
+    throw std::runtime_error("Geospatial values can only be sorted as WKT strings");
+  }
+  if (!array_tv->is_initialized()) {
+    append_raw(out, ValueTag::kNullArray);
+    return;
+  }
+  append_raw(out, ValueTag::kArray);
+  append_raw(out, static_cast<uint32_t>(array_tv->get().size()));
+  for (const auto& elem_tv : array_tv->get()) {
+    append_scalar(out, elem_tv);
+  }
+}
+
+ScalarTargetValue read_scalar(std::string_view& in, const ValueTag tag) {
+  switch (tag) {
+    case ValueTag::kInt64:
+      return read_raw<int64_t>(in);
+    case ValueTag::kDouble:
+      return read_raw<double>(in);
+    case ValueTag::kFloat:
+      return read_raw<float>(in);
+    case ValueTag::kString: {
+      const auto size = read_raw<uint32_t>(in);
+      CHECK_GE(in.size(), size);
+      std::string str(in.data(), size);
+      in.remove_prefix(size);
+      return NullableString(std::move(str));
+    }
+    case ValueTag::kNullString:
+      return NullableString(nullptr);
+    default:
+      UNREACHABLE() << static_cast<int>(tag);
+  }
+  return int64_t(0);
+}
+
+TargetValue read_target_value(std::string_view& in) {
+  const auto tag = read_raw<ValueTag>(in);
+  switch (tag) {
+    case ValueTag::kArray: {
+      const auto size = read_raw<uint32_t>(in);
+      std::vector<ScalarTargetValue> elems;
+      elems.reserve(size);
+      for (uint32_t i = 0; i < size; ++i) {
+        elems.push_back(read_scalar(in, read_raw<ValueTag>(in)));
+      }
+      return ArrayTargetValue(std::move(elems));
+    }
+    case ValueTag::kNullArray:
+      return ArrayTargetValue(boost::none);
+    default:
+      return read_scalar(in, tag);
+  }
+}
+
+std::string_view record_key(const std::vector<char>& records, const size_t offset) {
+  uint32_t key_bytes;
+  std::memcpy(&key_bytes, records.data() + offset, sizeof(key_bytes));
+  return {records.data() + offset + kRecordHeaderBytes, key_bytes};
+}
+
+size_t record_bytes(const std::vector<char>& records, const size_t offset) {
+  uint32_t sizes[2];
+  std::memcpy(sizes, records.data() + offset, sizeof(sizes));
+  return kRecordHeaderBytes + sizes[0] + sizes[1];
+}
+
+// Sorts the records by key, equal keys staying in their original order: slices of the
+// records are sorted in parallel, then merged pairwise.
+void sort_records(std::vector<size_t>& offsets, const std::vector<char>& records) {
+  const auto is_less = [&records](const size_t lhs, const size_t rhs) {
+    const auto cmp = record_key(records, lhs).compare(record_key(records, rhs));
+    return cmp < 0 || (cmp == 0 && lhs < rhs);
+  };
+  std::vector<size_t> bounds{0};
+  threadpool::FuturesThreadPool<void> sort_threads;
+  for (auto interval : makeIntervals<size_t>(0, offsets.size(), cpu_threads())) {
+    sort_threads.spawn(
+        [&offsets, &is_less](const size_t begin, const size_t end) {
+          std::sort(offsets.begin() + begin, offsets.begin() + end, is_less);
+        },
+        interval.begin,
+        interval.end);
+    bounds.push_back(interval.end);
+  }
+  sort_threads.join();
+  while (bounds.size() > 2) {
+    std::vector<size_t> merged_bounds{0};
+    threadpool::FuturesThreadPool<void> merge_threads;
+    for (size_t i = 2; i < bounds.size(); i += 2) {
+      merge_threads.spawn(
+          [&offsets, &is_less](const size_t begin, const size_t mid, const size_t end) {
+            std::inplace_merge(offsets.begin() + begin,
+                               offsets.begin() + mid,
+                               offsets.begin() + end,
+                               is_less);
+          },
+          bounds[i - 2],
+          bounds[i - 1],
+          bounds[i]);
+      merged_bounds.push_back(bounds[i]);
+    }
+    if (bounds.size() % 2 == 0) {
+      // odd number of slices, the last one waits for the next round
+      merged_bounds.push_back(bounds.back());
+    }
+    merge_threads.join();
+    bounds.swap(merged_bounds);
+  }
+}
+
+boost::filesystem::path get_spill_dir() {
+  const auto spill_root = g_base_path.empty()
+                              ? boost::filesystem::temp_directory_path() / "omnisci_spill"
+                              : boost::filesystem::path(g_base_path) / "mapd_spill";
+  return spill_root / boost::filesystem::unique_path("sort_%%%%-%%%%-%%%%");
+}
+
+}  // namespace
+
+void append_normalized_key(std::string& key,
+                           const std::vector<TargetValue>& row,
+                           const std::list<Analyzer::OrderEntry>& order_entries,
+                           const std::vector<TargetMetaInfo>& targets) {
+  CHECK_EQ(row.size(), targets.size());
+  for (const auto& order_entry : order_entries) {
+    CHECK_GE(order_entry.tle_no, 1);
+    CHECK_LE(static_cast<size_t>(order_entry.tle_no), row.size());
+    const auto& tv = row[order_entry.tle_no - 1];
+    const auto scalar_tv = boost::get<ScalarTargetValue>(&tv);
+    if (!scalar_tv) {
+      throw std::runtime_error(
+          "Columns with geometry or array types cannot be used in an ORDER BY clause.");
+    }
+    append_key_scalar(
+        key, *scalar_tv, targets[order_entry.tle_no - 1].get_type_info(), order_entry);
+  }
+}
+
+SortedRuns::SortedRuns(const std::vector<TargetMetaInfo>& targets,
+                       const std::list<Analyzer::OrderEntry>& order_entries)
+    : targets_(targets)
+    , order_entries_(order_entries)
+    , spill_dir_(get_spill_dir())
+    , row_count_(0) {}
+
+SortedRuns::~SortedRuns() {
+  boost::system::error_code ec;
+  boost::filesystem::remove_all(spill_dir_, ec);
+  if (ec) {
+    LOG(WARNING) << "Failed to remove the sort spill directory " << spill_dir_ << ": "
+                 << ec.message();
+  }
+}
+
+size_t SortedRuns::spill(const ResultSet& rows) {
+  CHECK_EQ(targets_.size(), rows.colCount());
+  std::vector<char> records;
+  std::vector<size_t> offsets;
+  std::string key;
+  std::string prev_key;
+  std::string values;
+  bool in_order{true};
+  rows.moveToBegin();
+  while (true) {
+    const auto row = rows.getNextRow(true, true);
+    if (row.empty()) {
+      break;
+    }
+    key.clear();
+    append_normalized_key(key, row, order_entries_, targets_);
+    values.clear();
+    for (const auto& tv : row) {
+      append_target_value(values, tv);
+    }
+    if (in_order && !offsets.empty() && key < prev_key) {
+      in_order = false;
+    }
+    offsets.push_back(records.size());
+    const uint32_t sizes[2]{static_cast<uint32_t>(key.size()),
+                            static_cast<uint32_t>(values.size())};
+    const auto sizes_ptr = reinterpret_cast<const char*>(sizes);
+    records.insert(records.end(), sizes_ptr, sizes_ptr + sizeof(sizes));
+    records.insert(records.end(), key.begin(), key.end());
+    records.insert(records.end(), values.begin(), values.end());
+    key.swap(prev_key);
+  }
+  if (!in_order) {
+    VLOG(1) << "Sorting a run of " << offsets.size() << " rows on its normalized keys";
+    sort_records(offsets, records);
+  }
+
+  if (runs_.empty()) {
+    boost::filesystem::create_directories(spill_dir_);
+  }
+  const auto run_path = spill_dir_ / ("run_" + std::to_string(runs_.size()));
+  std::ofstream run_file(run_path.string(), std::ios::binary | std::ios::trunc);
+  if (!run_file) {
+    throw std::runtime_error("Could not create sort spill file " + run_path.string());
+  }
+  if (in_order) {
+    run_file.write(records.data(), records.size());
+  } else {
+    std::vector<char> records_buffer;
+    records_buffer.reserve(kRunIoBufferBytes);
+    for (const auto offset : offsets) {
+      const auto record_ptr = records.data() + offset;
+      records_buffer.insert(
+          records_buffer.end(), record_ptr, record_ptr + record_bytes(records, offset));
+      if (records_buffer.size() >= kRunIoBufferBytes) {
+        run_file.write(records_buffer.data(), records_buffer.size());
+        records_buffer.clear();
+      }
+    }
+    run_file.write(records_buffer.data(), records_buffer.size());
+  }
+  run_file.close();
+  if (!run_file) {
+    throw std::runtime_error("Could not write sort spill file " + run_path.string());
+  }
+  runs_.push_back({run_path, offsets.size()});
+  row_count_ += offsets.size();
+  VLOG(1) << "Spilled a sorted run of " << offsets.size() << " rows, " << records.size()
+          << " bytes, to " << run_path;
+  return records.size();
+}
+
+std::unique_ptr<RunMerger> SortedRuns::merge(const size_t memory_budget) const {
+  std::vector<boost::filesystem::path> run_paths;
+  for (const auto& run : runs_) {
+    run_paths.push_back(run.path);
+  }
+  const auto buffer_bytes =
+      std::max(kMinMergeBufferBytes, memory_budget / std::max(runs_.size(), size_t(1)));
+  return std::make_unique<RunMerger>(run_paths, buffer_bytes);
+}
+
+RunMerger::RunReader::RunReader(const boost::filesystem::path& path,
+                                const size_t buffer_bytes)
+    : file_(path.string(), std::ios::binary)
+    , path_(path.string())
+    , buffer_(buffer_bytes)
+    , begin_(0)
+    , end_(0)
+    , record_bytes_(0) {
+  if (!file_) {
+    throw std::runtime_error("Could not open sort spill file " + path_);
+  }
+}
+
+bool RunMerger::RunReader::fill(const size_t bytes) {
+  if (end_ - begin_ >= bytes) {
+    return true;
+  }
+  // move the partial record to the front, records larger than the buffer grow it
+  std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+  end_ -= begin_;
+  begin_ = 0;
+  if (buffer_.size() < bytes) {
+    buffer_.resize(bytes);
+  }
+  while (end_ < bytes && file_) {
+    file_.read(buffer_.data() + end_, buffer_.size() - end_);
+    end_ += file_.gcount();
+  }
+  if (file_.bad()) {
+    throw std::runtime_error("Could not read sort spill file " + path_);
+  }
+  return end_ >= bytes;
+}
+
+bool RunMerger::RunReader::next() {
+  begin_ += record_bytes_;
+  record_bytes_ = 0;
+  if (!fill(kRecordHeaderBytes)) {
+    if (begin_ != end_) {
+      throw std::runtime_error("Truncated sort spill file " + path_);
+    }
+    return false;
+  }
+  uint32_t sizes[2];
+  std::memcpy(sizes, buffer_.data() + begin_, sizeof(sizes));
+  record_bytes_ = kRecordHeaderBytes + sizes[0] + sizes[1];
+  if (!fill(record_bytes_)) {
+    throw std::runtime_error("Truncated sort spill file " + path_);
+  }
+  key_ = {buffer_.data() + begin_ + kRecordHeaderBytes, sizes[0]};
+  values_ = {key_.data() + sizes[0], sizes[1]};
+  return true;
+}
+
+std::vector<TargetValue> RunMerger::RunReader::row() const {
+  std::vector<TargetValue> row;
+  auto values = values_;
+  while (!values.empty()) {
+    row.push_back(read_target_value(values));
+  }
+  return row;
+}
+
+RunMerger::RunMerger(const std::vector<boost::filesystem::path>& run_paths,
+                     const size_t buffer_bytes) {
+  for (const auto& run_path : run_paths) {
+    readers_.emplace_back(std::make_unique<RunReader>(run_path, buffer_bytes));
+    exhausted_.push_back(!readers_.back()->next());
+  }
+  const auto run_count = readers_.size();
+  if (!run_count) {
+    return;
+  }
+  // the runs are the leaves run_count + i of the tree, node i has children 2i and 2i + 1
+  losers_.resize(run_count);
+  std::vector<size_t> winners(2 * run_count);
+  for (size_t i = 0; i < run_count; ++i) {
+    winners[run_count + i] = i;
+  }
+  for (size_t node = run_count - 1; node > 0; --node) {
+    const auto lhs = winners[2 * node];
+    const auto rhs = winners[2 * node + 1];
+    const bool rhs_wins = isLess(rhs, lhs);
+    winners[node] = rhs_wins ? rhs : lhs;
+    losers_[node] = rhs_wins ? lhs : rhs;
+  }
+  losers_[0] = winners[1];
+}
+
+bool RunMerger::isLess(const size_t lhs, const size_t rhs) const {
+  if (exhausted_[lhs]) {
+    return false;
+  }
+  if (exhausted_[rhs]) {
+    return true;
+  }
+  const auto cmp = readers_[lhs]->key().compare(readers_[rhs]->key());
+  return cmp < 0 || (cmp == 0 && lhs < rhs);
+}
+
+std::vector<TargetValue> RunMerger::getNextRow() {
+  if (readers_.empty() || exhausted_[losers_[0]]) {
+    return {};
+  }
+  auto winner = losers_[0];
+  auto row = readers_[winner]->row();
+  exhausted_[winner] = !readers_[winner]->next();
+  for (auto node = (winner + readers_.size()) / 2; node > 0; node /= 2) {
+    if (isLess(losers_[node], winner)) {
+      std::swap(losers_[node], winner);
+    }
+  }
+  losers_[0] = winner;
+  return row;
+}
+
+}  // namespace external_sort
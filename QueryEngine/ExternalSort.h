@@ -0,0 +1,141 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    ExternalSort.h
+ * @brief   Sort of query results larger than memory, as sorted runs spilled to disk
+ *          and merged back in a single stream of rows.
+ */
+
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+
+#include <fstream>
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Analyzer/Analyzer.h"
+#include "QueryEngine/TargetMetaInfo.h"
+#include "QueryEngine/TargetValue.h"
+
+extern bool g_enable_external_sort;
+extern size_t g_external_sort_memory_budget;
+
+class ResultSet;
+
+namespace external_sort {
+
+// Appends to |key| the ORDER BY values of a row, as returned by
+// ResultSet::getNextRow(true, true), encoded such that comparing the keys of two rows
+// byte by byte orders them as the order entries do, directions and nulls included.
+void append_normalized_key(std::string& key,
+                           const std::vector<TargetValue>& row,
+                           const std::list<Analyzer::OrderEntry>& order_entries,
+                           const std::vector<TargetMetaInfo>& targets);
+
+class RunMerger;
+
+/**
+ * Rows of a query result sorted in bounded runs, each spilled to disk under
+ * `<data dir>/mapd_spill` as records holding the normalized sort key of a row followed
+ * by its values. The runs are removed on destruction.
+ */
+class SortedRuns {
+ public:
+  SortedRuns(const std::vector<TargetMetaInfo>& targets,
+             const std::list<Analyzer::OrderEntry>& order_entries);
+
+  ~SortedRuns();
+
+  // Writes the rows of a result to a new run, in the order of the normalized keys. The
+  // rows are only sorted again, in parallel, if the result set is not already in that
+  // order. Returns the number of bytes spilled.
+  size_t spill(const ResultSet& rows);
+
+  // Streams the rows of all the runs in order, reading each run through a buffer of its
+  // share of |memory_budget| bytes.
+  std::unique_ptr<RunMerger> merge(const size_t memory_budget) const;
+
+  size_t getRowCount() const { return row_count_; }
+
+  size_t getRunCount() const { return runs_.size(); }
+
+ private:
+  struct Run {
+    boost::filesystem::path path;
+    size_t row_count;
+  };
+
+  const std::vector<TargetMetaInfo> targets_;
+  const std::list<Analyzer::OrderEntry> order_entries_;
+  boost::filesystem::path spill_dir_;
+  std::vector<Run> runs_;
+  size_t row_count_;
+};
+
+/**
+ * K-way merge of sorted runs through a tree of losers: every row popped replays a
+ * single path from its run to the root, i.e. log2(k) key comparisons. Rows with equal
+ * keys come out in run order.
+ */
+class RunMerger {
+ public:
+  RunMerger(const std::vector<boost::filesystem::path>& run_paths,
+            const size_t buffer_bytes);
+
+  // The next row in order, as ResultSet::getNextRow(true, true) would return it, or an
+  // empty row once all the runs are exhausted.
+  std::vector<TargetValue> getNextRow();
+
+ private:
+  class RunReader {
+   public:
+    RunReader(const boost::filesystem::path& path, const size_t buffer_bytes);
+
+    // Moves to the next record of the run, returns false at the end of it.
+    bool next();
+
+    std::string_view key() const { return key_; }
+
+    std::vector<TargetValue> row() const;
+
+   private:
+    bool fill(const size_t bytes);
+
+    std::ifstream file_;
+    std::string path_;
+    std::vector<char> buffer_;
+    // the current record starts at begin_ and takes record_bytes_
+    size_t begin_;
+    size_t end_;
+    size_t record_bytes_;
+    std::string_view key_;
+    std::string_view values_;
+  };
+
+  bool isLess(const size_t lhs, const size_t rhs) const;
+
+  std::vector<std::unique_ptr<RunReader>> readers_;
+  std::vector<bool> exhausted_;
+  // losers_[0] is the current winner, losers_[i] the loser of the match at node i
+  std::vector<size_t> losers_;
+};
+
+}  // namespace external_sort
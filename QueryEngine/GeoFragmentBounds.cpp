@@ -0,0 +1,173 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/GeoFragmentBounds.h"
+
+#include <limits>
+
+#include "Catalog/Catalog.h"
+#include "DataMgr/Chunk/Chunk.h"
+#include "Fragmenter/Fragmenter.h"
+#include "Geospatial/CompressionRuntime.h"
+#include "Logger/Logger.h"
+#include "Shared/InlineNullValues.h"
+
+bool g_enable_geo_fragment_skipping{true};
+
+namespace {
+
+// The physical column holding the bounds of the rows, the coords for points.
+const ColumnDescriptor* get_bounds_column(const Catalog_Namespace::Catalog& cat,
+                                          const ColumnDescriptor* geo_cd) {
+  const auto& geo_ti = geo_cd->columnType;
+  const int column_id =
+      geo_cd->columnId + (geo_ti.has_bounds() ? geo_ti.get_physical_coord_cols() + 1 : 1);
+  const auto bounds_cd = cat.getMetadataForColumn(geo_cd->tableId, column_id);
+  CHECK(bounds_cd);
+  CHECK(bounds_cd->isGeoPhyCol);
+  return bounds_cd;
+}
+
+GeoBoundingBox compute_points_bounds(const SQLTypeInfo& geo_ti,
+                                     const int8_t* coords,
+                                     const size_t num_points) {
+  auto bounds = GeoBoundingBox::empty();
+  if (geo_ti.get_compression() == kENCODING_GEOINT) {
+    CHECK_EQ(geo_ti.get_comp_param(), 32);
+    const auto compressed_coords = reinterpret_cast<const int32_t*>(coords);
+    for (size_t i = 0; i < num_points; ++i) {
+      const auto x = compressed_coords[2 * i];
+      const auto y = compressed_coords[2 * i + 1];
+      if (!geo_ti.get_notnull() && Geospatial::is_null_point_longitude_geoint32(x)) {
+        continue;
+      }
+      bounds.extend(Geospatial::decompress_longitude_coord_geoint32(x),
+                    Geospatial::decompress_lattitude_coord_geoint32(y));
+    }
+  } else {
+    CHECK_EQ(geo_ti.get_compression(), kENCODING_NONE);
+    const auto decompressed_coords = reinterpret_cast<const double*>(coords);
+    for (size_t i = 0; i < num_points; ++i) {
+      const auto x = decompressed_coords[2 * i];
+      const auto y = decompressed_coords[2 * i + 1];
+      if (!geo_ti.get_notnull() && x == NULL_ARRAY_DOUBLE) {
+        continue;
+      }
+      bounds.extend(x, y);
+    }
+  }
+  return bounds;
+}
+
+// Union of the xmin, ymin, xmax, ymax bounds of the rows.
+GeoBoundingBox compute_rows_bounds(const double* rows_bounds, const size_t num_rows) {
+  auto bounds = GeoBoundingBox::empty();
+  for (size_t i = 0; i < num_rows; ++i) {
+    const auto row_bounds = rows_bounds + 4 * i;
+    if (row_bounds[0] == NULL_ARRAY_DOUBLE) {
+      continue;
+    }
+    bounds.extend(row_bounds[0], row_bounds[1]);
+    bounds.extend(row_bounds[2], row_bounds[3]);
+  }
+  return bounds;
+}
+
+}  // namespace
+
+GeoBoundingBox GeoBoundingBox::empty() {
+  return {std::numeric_limits<double>::max(),
+          std::numeric_limits<double>::max(),
+          std::numeric_limits<double>::lowest(),
+          std::numeric_limits<double>::lowest()};
+}
+
+GeoFragmentBoundsCache& GeoFragmentBoundsCache::instance() {
+  static GeoFragmentBoundsCache geo_fragment_bounds_cache;
+  return geo_fragment_bounds_cache;
+}
+
+std::optional<GeoBoundingBox> GeoFragmentBoundsCache::getBounds(
+    const Catalog_Namespace::Catalog& cat,
+    const ColumnDescriptor* geo_cd,
+    const Fragmenter_Namespace::FragmentInfo& fragment) {
+  CHECK(IS_GEO(geo_cd->columnType.get_type()));
+  const auto td = cat.getMetadataForTable(geo_cd->tableId, false);
+  if (!td || td->isForeignTable()) {
+    // reading foreign data just to skip it would defeat the purpose
+    return std::nullopt;
+  }
+  const auto bounds_cd = get_bounds_column(cat, geo_cd);
+  const auto& chunk_metadata_map = fragment.getChunkMetadataMap();
+  const auto chunk_meta_it = chunk_metadata_map.find(bounds_cd->columnId);
+  if (chunk_meta_it == chunk_metadata_map.end()) {
+    return std::nullopt;
+  }
+  const size_t num_bytes = chunk_meta_it->second->numBytes;
+  const size_t num_elements = chunk_meta_it->second->numElements;
+  const int db_id = cat.getCurrentDB().dbId;
+  const Key key{db_id, fragment.physicalTableId, geo_cd->columnId, fragment.fragmentId};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = entries_.find(key);
+    if (it != entries_.end() && it->second.num_bytes == num_bytes &&
+        it->second.num_elements == num_elements) {
+      return it->second.bounds;
+    }
+  }
+
+  // both the row bounds and the point coords are fixed length arrays
+  const auto row_size = bounds_cd->columnType.get_size();
+  if (row_size <= 0 || num_bytes != num_elements * row_size) {
+    return std::nullopt;
+  }
+  auto bounds = GeoBoundingBox::empty();
+  if (num_elements) {
+    const ChunkKey chunk_key{
+        db_id, fragment.physicalTableId, bounds_cd->columnId, fragment.fragmentId};
+    const auto chunk = Chunk_NS::Chunk::getChunk(bounds_cd,
+                                                 &cat.getDataMgr(),
+                                                 chunk_key,
+                                                 Data_Namespace::CPU_LEVEL,
+                                                 0,
+                                                 num_bytes,
+                                                 num_elements);
+    const auto data = chunk->getBuffer()->getMemoryPtr();
+    if (geo_cd->columnType.has_bounds()) {
+      CHECK_EQ(row_size, static_cast<int>(4 * sizeof(double)));
+      bounds = compute_rows_bounds(reinterpret_cast<const double*>(data), num_elements);
+    } else {
+      bounds = compute_points_bounds(geo_cd->columnType, data, num_elements);
+    }
+  }
+  VLOG(2) << "Computed the bounds of geo column " << geo_cd->columnName
+          << " in fragment " << fragment.fragmentId << " of table "
+          << fragment.physicalTableId << ": " << bounds.min_x << ", " << bounds.min_y
+          << ", " << bounds.max_x << ", " << bounds.max_y;
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_[key] = {num_bytes, num_elements, bounds};
+  return bounds;
+}
+
+void GeoFragmentBoundsCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+}
+
+size_t GeoFragmentBoundsCache::getNumEntries() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
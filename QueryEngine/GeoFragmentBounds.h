@@ -0,0 +1,111 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    GeoFragmentBounds.h
+ * @brief   Bounding boxes of the geo columns of table fragments, used to skip fragments
+ *          on geo predicates.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <tuple>
+
+namespace Catalog_Namespace {
+class Catalog;
+}  // namespace Catalog_Namespace
+
+namespace Fragmenter_Namespace {
+class FragmentInfo;
+}  // namespace Fragmenter_Namespace
+
+struct ColumnDescriptor;
+
+extern bool g_enable_geo_fragment_skipping;
+
+struct GeoBoundingBox {
+  double min_x;
+  double min_y;
+  double max_x;
+  double max_y;
+
+  // Box of no geometry, e.g. of a fragment of nulls.
+  static GeoBoundingBox empty();
+
+  bool isEmpty() const { return min_x > max_x || min_y > max_y; }
+
+  void extend(const double x, const double y) {
+    min_x = std::min(min_x, x);
+    min_y = std::min(min_y, y);
+    max_x = std::max(max_x, x);
+    max_y = std::max(max_y, y);
+  }
+
+  // True if the boxes are no more than `distance` apart along both axes.
+  bool overlaps(const GeoBoundingBox& that, const double distance) const {
+    return !isEmpty() && !that.isEmpty() && min_x <= that.max_x + distance &&
+           that.min_x <= max_x + distance && min_y <= that.max_y + distance &&
+           that.min_y <= max_y + distance;
+  }
+};
+
+/**
+ * Cache of the bounding boxes of the geo columns of table fragments. The chunk stats of
+ * the coords and bounds arrays of a geo column are the range of all their elements, x and
+ * y mixed, so the box of a fragment is computed from its data instead, the row bounds of
+ * lines and polygons or the coords of points, the first time a geo predicate needs it.
+ * Appends change the chunk sizes of the fragment, which recomputes its box. Updates,
+ * deletes, DDL and table epoch rollbacks clear the cache through the external cache
+ * invalidators, since a rollback followed by an append of the same size would keep the
+ * sizes unchanged.
+ */
+class GeoFragmentBoundsCache {
+ public:
+  static GeoFragmentBoundsCache& instance();
+
+  static std::function<void()> getCacheInvalidator() {
+    return []() -> void { instance().clear(); };
+  }
+
+  // Returns the box of the non null geometries of the geo column in the fragment, or
+  // nullopt if it can't be computed.
+  std::optional<GeoBoundingBox> getBounds(
+      const Catalog_Namespace::Catalog& cat,
+      const ColumnDescriptor* geo_cd,
+      const Fragmenter_Namespace::FragmentInfo& fragment);
+
+  void clear();
+
+  size_t getNumEntries();  // for unit tests
+
+ private:
+  // database, physical table, geo column and fragment ids
+  using Key = std::tuple<int, int, int, int>;
+
+  struct Entry {
+    size_t num_bytes;
+    size_t num_elements;
+    std::optional<GeoBoundingBox> bounds;
+  };
+
+  std::mutex mutex_;
+  std::map<Key, Entry> entries_;
+};
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef ENABLE_GEOS
+
+#include "QueryEngine/GeosContextPool.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Logger/Logger.h"
+
+#define MAX_GEOS_MESSAGE_LEN 200
+
+namespace {
+
+class GeosContextPool {
+ public:
+  GeosPooledContext* acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_contexts_.empty()) {
+      // zeroed: no handle and an empty cache yet
+      contexts_.push_back(std::make_unique<GeosPooledContext>());
+      return contexts_.back().get();
+    }
+    auto context = free_contexts_.back();
+    free_contexts_.pop_back();
+    return context;
+  }
+
+  void release(GeosPooledContext* context) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_contexts_.push_back(context);
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<GeosPooledContext>> contexts_;
+  // last released first, its cache is the most likely to be warm
+  std::vector<GeosPooledContext*> free_contexts_;
+};
+
+GeosContextPool& get_geos_context_pool() {
+  // never destroyed, like the GEOS library the contexts come from: generated code may
+  // still run on other threads during exit
+  static auto pool = new GeosContextPool();
+  return *pool;
+}
+
+std::mutex geos_log_info_mutex;
+std::mutex geos_log_error_mutex;
+
+}  // namespace
+
+extern "C" RUNTIME_EXPORT GeosPooledContext* geos_acquire_context() {
+  return get_geos_context_pool().acquire();
+}
+
+extern "C" RUNTIME_EXPORT void geos_release_context(GeosPooledContext* context) {
+  get_geos_context_pool().release(context);
+}
+
+// called by GEOS on notice
+extern "C" RUNTIME_EXPORT void geos_notice_handler(const char* fmt, ...) {
+  char buffer[MAX_GEOS_MESSAGE_LEN];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buffer, MAX_GEOS_MESSAGE_LEN, fmt, args);
+  va_end(args);
+  {
+    std::lock_guard<std::mutex> guard(geos_log_info_mutex);
+    LOG(INFO) << "GEOS Notice: " << std::string(buffer);
+  }
+}
+
+// called by GEOS on error
+extern "C" RUNTIME_EXPORT void geos_error_handler(const char* fmt, ...) {
+  va_list args;
+  char buffer[MAX_GEOS_MESSAGE_LEN];
+  va_start(args, fmt);
+  vsnprintf(buffer, MAX_GEOS_MESSAGE_LEN, fmt, args);
+  va_end(args);
+  {
+    std::lock_guard<std::mutex> guard(geos_log_error_mutex);
+    LOG(ERROR) << "GEOS Error: " << std::string(buffer);
+  }
+}
+
+#endif
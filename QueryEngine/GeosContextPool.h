@@ -0,0 +1,68 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    GeosContextPool.h
+ * @brief   GEOS contexts lent to the GEOS runtime functions of generated code.
+ *
+ * The GEOS runtime is linked into every generated module and released with its code,
+ * so it cannot own anything outliving a query. The pool and the GEOS message handlers
+ * live in the server instead, and are called from the runtime.
+ */
+
+#ifndef QUERYENGINE_GEOSCONTEXTPOOL_H
+#define QUERYENGINE_GEOSCONTEXTPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Shared/funcannotations.h"
+
+#define GEOS_PREPARED_CACHE_SIZE 8
+
+// A copy of a geometry argument of the GEOS runtime, with the geometry built from it
+// and, once the same argument came again, its prepared form.
+struct GeosCachedGeometry {
+  int type;
+  int32_t ic;
+  int8_t* coords;
+  int64_t coords_size;
+  int32_t* meta1;
+  int64_t meta1_size;
+  int32_t* meta2;
+  int64_t meta2_size;
+  void* geometry;           // GEOSGeometry*
+  void* prepared_geometry;  // const GEOSPreparedGeometry*
+  int64_t hits;
+};
+
+// A GEOS context handle, created by the runtime on first use, along with the geometries
+// of the arguments it saw repeatedly. Only used by one thread at a time.
+struct GeosPooledContext {
+  void* handle;  // GEOSContextHandle_t
+  GeosCachedGeometry cache[GEOS_PREPARED_CACHE_SIZE];
+  int64_t replacements;
+};
+
+extern "C" RUNTIME_EXPORT GeosPooledContext* geos_acquire_context();
+
+extern "C" RUNTIME_EXPORT void geos_release_context(GeosPooledContext* context);
+
+extern "C" RUNTIME_EXPORT void geos_notice_handler(const char* fmt, ...);
+
+extern "C" RUNTIME_EXPORT void geos_error_handler(const char* fmt, ...);
+
+#endif  // QUERYENGINE_GEOSCONTEXTPOOL_H
@@ -18,11 +18,11 @@
 
 #ifndef __CUDACC__
 
-#include <cstdarg>
-#include <mutex>
+#include <cstring>
 
 #include "Geospatial/Compression.h"
 #include "Geospatial/Types.h"
+#include "QueryEngine/GeosContextPool.h"
 #include "QueryEngine/GeosRuntime.h"
 #include "Shared/checked_alloc.h"
 #include "Shared/funcannotations.h"
@@ -34,38 +34,8 @@ using namespace Geospatial;
 
 using WKB = std::vector<uint8_t>;
 
-#define MAX_GEOS_MESSAGE_LEN 200
-
-static std::mutex geos_log_info_mutex;
-static std::mutex geos_log_error_mutex;
-
-// called by GEOS on notice
-static void geos_notice_handler(const char* fmt, ...) {
-  char buffer[MAX_GEOS_MESSAGE_LEN];
-  va_list args;
-  va_start(args, fmt);
-  vsnprintf(buffer, MAX_GEOS_MESSAGE_LEN, fmt, args);
-  va_end(args);
-  {
-    std::lock_guard<std::mutex> guard(geos_log_info_mutex);
-    LOG(INFO) << "GEOS Notice: " << std::string(buffer);
-  }
-}
-
-// called by GEOS on error
-static void geos_error_handler(const char* fmt, ...) {
-  va_list args;
-  char buffer[MAX_GEOS_MESSAGE_LEN];
-  va_start(args, fmt);
-  vsnprintf(buffer, MAX_GEOS_MESSAGE_LEN, fmt, args);
-  va_end(args);
-  {
-    std::lock_guard<std::mutex> guard(geos_log_error_mutex);
-    LOG(ERROR) << "GEOS Error: " << std::string(buffer);
-  }
-}
-
 GEOSContextHandle_t create_context() {
+  // the message handlers are server functions, which outlive this module
 #if GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR < 5
   GEOSContextHandle_t context = initGEOS_r(geos_notice_handler, geos_error_handler);
   CHECK(context);
@@ -79,13 +49,240 @@ GEOSContextHandle_t create_context() {
 #endif
 }
 
-void destroy_context(GEOSContextHandle_t context) {
-  CHECK(context);
-#if GEOS_VERSION_MAJOR == 3 && GEOS_VERSION_MINOR < 5
-  finishGEOS_r(context);
-#else
-  GEOS_finish_r(context);
-#endif
+// Lends a context of the server pool to a GEOS runtime call, creating its handle on
+// first use rather than for every row.
+class PooledContext {
+ public:
+  PooledContext() : pooled_context_(geos_acquire_context()) {
+    CHECK(pooled_context_);
+    if (!pooled_context_->handle) {
+      pooled_context_->handle = create_context();
+    }
+  }
+
+  ~PooledContext() { geos_release_context(pooled_context_); }
+
+  GEOSContextHandle_t handle() const {
+    return static_cast<GEOSContextHandle_t>(pooled_context_->handle);
+  }
+
+  GeosPooledContext* get() const { return pooled_context_; }
+
+ private:
+  GeosPooledContext* pooled_context_;
+};
+
+// A geometry argument of the GEOS runtime, in its column representation.
+struct GeoArg {
+  int type;
+  int8_t* coords;
+  int64_t coords_size;
+  int32_t* meta1;
+  int64_t meta1_size;
+  int32_t* meta2;
+  int64_t meta2_size;
+  int32_t ic;
+};
+
+// Points [first_point, first_point + num_points) of decompressed coords, followed by
+// the first one again if |close|: rings are stored open.
+GEOSCoordSequence* make_coord_seq(GEOSContextHandle_t context,
+                                  const std::vector<double>& coords,
+                                  const size_t first_point,
+                                  const size_t num_points,
+                                  const bool close) {
+  if (num_points == 0 || 2 * (first_point + num_points) > coords.size()) {
+    return nullptr;
+  }
+  const auto seq_size = num_points + (close ? 1 : 0);
+  auto seq = GEOSCoordSeq_create_r(context, static_cast<unsigned>(seq_size), 2);
+  if (!seq) {
+    return nullptr;
+  }
+  for (size_t i = 0; i < seq_size; ++i) {
+    const auto point = first_point + (i < num_points ? i : 0);
+    const auto idx = static_cast<unsigned>(i);
+    if (!GEOSCoordSeq_setX_r(context, seq, idx, coords[2 * point]) ||
+        !GEOSCoordSeq_setY_r(context, seq, idx, coords[2 * point + 1])) {
+      GEOSCoordSeq_destroy_r(context, seq);
+      return nullptr;
+    }
+  }
+  return seq;
+}
+
+// Polygon of |num_rings| rings starting at |first_point|, which is advanced past them.
+GEOSGeometry* make_polygon(GEOSContextHandle_t context,
+                           const std::vector<double>& coords,
+                           size_t& first_point,
+                           const int32_t* ring_sizes,
+                           const int64_t num_rings) {
+  if (num_rings <= 0) {
+    return nullptr;
+  }
+  std::vector<GEOSGeometry*> rings;
+  for (int64_t r = 0; r < num_rings; ++r) {
+    auto seq = make_coord_seq(context, coords, first_point, ring_sizes[r], true);
+    first_point += ring_sizes[r];
+    auto ring = seq ? GEOSGeom_createLinearRing_r(context, seq) : nullptr;
+    if (!ring) {
+      for (auto built_ring : rings) {
+        GEOSGeom_destroy_r(context, built_ring);
+      }
+      return nullptr;
+    }
+    rings.push_back(ring);
+  }
+  return GEOSGeom_createPolygon_r(
+      context, rings.front(), rings.data() + 1, static_cast<unsigned>(rings.size() - 1));
+}
+
+// Builds the GEOS geometry of an argument straight from its decompressed coords, the
+// same geometry a WKB round trip through Geospatial types would give.
+GEOSGeometry* make_geometry(GEOSContextHandle_t context, const GeoArg& arg) {
+  const auto cv =
+      Geospatial::decompress_coords<double, int32_t>(arg.ic, arg.coords, arg.coords_size);
+  const auto& coords = *cv;
+  const auto num_points = coords.size() / 2;
+  switch (static_cast<SQLTypes>(arg.type)) {
+    case kPOINT: {
+      auto seq = make_coord_seq(context, coords, 0, 1, false);
+      return seq ? GEOSGeom_createPoint_r(context, seq) : nullptr;
+    }
+    case kLINESTRING: {
+      auto seq = make_coord_seq(context, coords, 0, num_points, false);
+      return seq ? GEOSGeom_createLineString_r(context, seq) : nullptr;
+    }
+    case kPOLYGON: {
+      size_t first_point = 0;
+      return make_polygon(context, coords, first_point, arg.meta1, arg.meta1_size);
+    }
+    case kMULTIPOLYGON: {
+      // Recognize GEOMETRYCOLLECTION EMPTY encoding
+      // MULTIPOLYGON (((0 0,0.00000012345 0.0,0.0 0.00000012345,0 0)))
+      // Used to pass along EMPTY from ST_Intersection to ST_IsEmpty for example
+      if (arg.meta1_size == 1 && arg.meta2_size == 1) {
+        const std::vector<double> ecv = {
+            0.0, 0.0, 0.00000012345, 0.0, 0.0, 0.00000012345};
+        if (coords == ecv) {
+          return GEOSGeom_createEmptyCollection_r(context, GEOS_GEOMETRYCOLLECTION);
+        }
+      }
+      std::vector<GEOSGeometry*> polys;
+      size_t first_point = 0;
+      int64_t first_ring = 0;
+      for (int64_t p = 0; p < arg.meta2_size; ++p) {
+        const auto num_rings = arg.meta2[p];
+        auto poly = first_ring + num_rings <= arg.meta1_size
+                        ? make_polygon(context,
+                                       coords,
+                                       first_point,
+                                       arg.meta1 + first_ring,
+                                       num_rings)
+                        : nullptr;
+        first_ring += num_rings;
+        if (!poly) {
+          for (auto built_poly : polys) {
+            GEOSGeom_destroy_r(context, built_poly);
+          }
+          return nullptr;
+        }
+        polys.push_back(poly);
+      }
+      return GEOSGeom_createCollection_r(
+          context, GEOS_MULTIPOLYGON, polys.data(), static_cast<unsigned>(polys.size()));
+    }
+    default:
+      return nullptr;
+  }
+}
+
+template <typename T>
+bool equal_values(const T* lhs, const T* rhs, const int64_t size) {
+  return size <= 0 || std::memcmp(lhs, rhs, size * sizeof(T)) == 0;
+}
+
+template <typename T>
+T* copy_values(const T* values, const int64_t size) {
+  if (size <= 0) {
+    return nullptr;
+  }
+  auto copy = reinterpret_cast<T*>(checked_malloc(size * sizeof(T)));
+  std::memcpy(copy, values, size * sizeof(T));
+  return copy;
+}
+
+bool is_cached(const GeosCachedGeometry& cached, const GeoArg& arg) {
+  return cached.geometry && cached.type == arg.type && cached.ic == arg.ic &&
+         cached.coords_size == arg.coords_size && cached.meta1_size == arg.meta1_size &&
+         cached.meta2_size == arg.meta2_size &&
+         equal_values(cached.coords, arg.coords, arg.coords_size) &&
+         equal_values(cached.meta1, arg.meta1, arg.meta1_size) &&
+         equal_values(cached.meta2, arg.meta2, arg.meta2_size);
+}
+
+// The cached geometry of an argument seen before on this context, prepared now that it
+// repeats, or nullptr.
+GeosCachedGeometry* find_cached_geometry(GeosPooledContext* pooled_context,
+                                         const GeoArg& arg) {
+  auto context = static_cast<GEOSContextHandle_t>(pooled_context->handle);
+  for (auto& cached : pooled_context->cache) {
+    if (is_cached(cached, arg)) {
+      ++cached.hits;
+      if (!cached.prepared_geometry) {
+        cached.prepared_geometry =
+            const_cast<GEOSPreparedGeometry*>(GEOSPrepare_r(
+                context, static_cast<const GEOSGeometry*>(cached.geometry)));
+      }
+      return &cached;
+    }
+  }
+  return nullptr;
+}
+
+void clear_cached_geometry(GEOSContextHandle_t context, GeosCachedGeometry& cached) {
+  if (cached.prepared_geometry) {
+    GEOSPreparedGeom_destroy_r(
+        context, static_cast<const GEOSPreparedGeometry*>(cached.prepared_geometry));
+  }
+  if (cached.geometry) {
+    GEOSGeom_destroy_r(context, static_cast<GEOSGeometry*>(cached.geometry));
+  }
+  free(cached.coords);
+  free(cached.meta1);
+  free(cached.meta2);
+  cached = GeosCachedGeometry{};
+}
+
+// Hands the geometry of an argument over to the cache of the context, in place of the
+// least hit one. Hit counts are halved every GEOS_PREPARED_CACHE_SIZE replacements, so
+// the arguments repeated by the current query, typically a literal or the rows of a
+// small joined table, stay cached while those of past queries age out.
+void cache_geometry(GeosPooledContext* pooled_context,
+                    const GeoArg& arg,
+                    GEOSGeometry* geometry) {
+  auto context = static_cast<GEOSContextHandle_t>(pooled_context->handle);
+  auto victim = &pooled_context->cache[0];
+  for (auto& cached : pooled_context->cache) {
+    if (cached.hits < victim->hits || (victim->geometry && !cached.geometry)) {
+      victim = &cached;
+    }
+  }
+  if (++pooled_context->replacements % GEOS_PREPARED_CACHE_SIZE == 0) {
+    for (auto& cached : pooled_context->cache) {
+      cached.hits /= 2;
+    }
+  }
+  clear_cached_geometry(context, *victim);
+  victim->type = arg.type;
+  victim->ic = arg.ic;
+  victim->coords = copy_values(arg.coords, arg.coords_size);
+  victim->coords_size = arg.coords_size;
+  victim->meta1 = copy_values(arg.meta1, arg.meta1_size);
+  victim->meta1_size = arg.meta1_size;
+  victim->meta2 = copy_values(arg.meta2, arg.meta2_size);
+  victim->meta2_size = arg.meta2_size;
+  victim->geometry = geometry;
 }
 
 bool toWkb(WKB& wkb,
@@ -304,73 +501,93 @@ extern "C" RUNTIME_EXPORT bool Geos_Wkb_Wkb(
   // What if intersection is empty? Return null buffer pointers? Return false?
   // What if geos fails?
 
-  WKB wkb1{};
-  if (!toWkb(wkb1,
-             arg1_type,
-             arg1_coords,
-             arg1_coords_size,
-             arg1_meta1,
-             arg1_meta1_size,
-             arg1_meta2,
-             arg1_meta2_size,
-             arg1_ic,
-             nullptr)) {
-    return false;
-  }
-  WKB wkb2{};
-  if (!toWkb(wkb2,
-             arg2_type,
-             arg2_coords,
-             arg2_coords_size,
-             arg2_meta1,
-             arg2_meta1_size,
-             arg2_meta2,
-             arg2_meta2_size,
-             arg2_ic,
-             nullptr)) {
-    return false;
-  }
+  const GeoArg arg1{arg1_type,
+                    arg1_coords,
+                    arg1_coords_size,
+                    arg1_meta1,
+                    arg1_meta1_size,
+                    arg1_meta2,
+                    arg1_meta2_size,
+                    arg1_ic};
+  const GeoArg arg2{arg2_type,
+                    arg2_coords,
+                    arg2_coords_size,
+                    arg2_meta1,
+                    arg2_meta1_size,
+                    arg2_meta2,
+                    arg2_meta2_size,
+                    arg2_ic};
+  const auto geo_op = static_cast<GeoBase::GeoOp>(op);
+  // A repeated argument is prepared to test whether it intersects the other one, which
+  // gives the result of a disjoint intersection or difference without an overlay.
+  const bool use_cache = geo_op == GeoBase::GeoOp::kINTERSECTION ||
+                         geo_op == GeoBase::GeoOp::kDIFFERENCE;
   auto status = false;
-  auto context = create_context();
-  if (!context) {
-    return status;
-  }
-  auto* g1 = GEOSGeomFromWKB_buf_r(context, wkb1.data(), wkb1.size());
-  if (g1) {
-    auto* g2 = GEOSGeomFromWKB_buf_r(context, wkb2.data(), wkb2.size());
-    if (g2) {
-      GEOSGeometry* g = nullptr;
-      if (static_cast<GeoBase::GeoOp>(op) == GeoBase::GeoOp::kINTERSECTION) {
-        g = GEOSIntersection_r(context, g1, g2);
-      } else if (static_cast<GeoBase::GeoOp>(op) == GeoBase::GeoOp::kDIFFERENCE) {
-        g = GEOSDifference_r(context, g1, g2);
-      } else if (static_cast<GeoBase::GeoOp>(op) == GeoBase::GeoOp::kUNION) {
-        g = GEOSUnion_r(context, g1, g2);
-      }
-      g = postprocess(context, g);
-      if (g) {
-        size_t wkb_size = 0ULL;
-        auto wkb_buf = GEOSGeomToWKB_buf_r(context, g, &wkb_size);
-        if (wkb_buf && wkb_size > 0ULL) {
-          WKB wkb(wkb_buf, wkb_buf + wkb_size);
-          free(wkb_buf);
-          status = fromWkb(wkb,
-                           result_type,
-                           result_coords,
-                           result_coords_size,
-                           result_meta1,
-                           result_meta1_size,
-                           result_meta2,
-                           result_meta2_size,
-                           nullptr);
-        }
-        GEOSGeom_destroy_r(context, g);
+  PooledContext pooled_context;
+  auto context = pooled_context.handle();
+  auto cached1 = use_cache ? find_cached_geometry(pooled_context.get(), arg1) : nullptr;
+  auto cached2 = use_cache ? find_cached_geometry(pooled_context.get(), arg2) : nullptr;
+  auto* g1 = cached1 ? static_cast<GEOSGeometry*>(cached1->geometry)
+                     : make_geometry(context, arg1);
+  auto* g2 = cached2 ? static_cast<GEOSGeometry*>(cached2->geometry)
+                     : make_geometry(context, arg2);
+  if (g1 && g2) {
+    char intersects = 2;  // unknown
+    if (cached1 && cached1->prepared_geometry) {
+      const auto prepared =
+          static_cast<const GEOSPreparedGeometry*>(cached1->prepared_geometry);
+      intersects = GEOSPreparedIntersects_r(context, prepared, g2);
+    } else if (cached2 && cached2->prepared_geometry) {
+      const auto prepared =
+          static_cast<const GEOSPreparedGeometry*>(cached2->prepared_geometry);
+      intersects = GEOSPreparedIntersects_r(context, prepared, g1);
+    }
+    GEOSGeometry* g = nullptr;
+    if (geo_op == GeoBase::GeoOp::kINTERSECTION) {
+      g = intersects == 0
+              ? GEOSGeom_createEmptyCollection_r(context, GEOS_GEOMETRYCOLLECTION)
+              : GEOSIntersection_r(context, g1, g2);
+    } else if (geo_op == GeoBase::GeoOp::kDIFFERENCE) {
+      g = intersects == 0 ? GEOSGeom_clone_r(context, g1)
+                          : GEOSDifference_r(context, g1, g2);
+    } else if (geo_op == GeoBase::GeoOp::kUNION) {
+      g = GEOSUnion_r(context, g1, g2);
+    }
+    g = postprocess(context, g);
+    if (g) {
+      size_t wkb_size = 0ULL;
+      auto wkb_buf = GEOSGeomToWKB_buf_r(context, g, &wkb_size);
+      if (wkb_buf && wkb_size > 0ULL) {
+        WKB wkb(wkb_buf, wkb_buf + wkb_size);
+        free(wkb_buf);
+        status = fromWkb(wkb,
+                         result_type,
+                         result_coords,
+                         result_coords_size,
+                         result_meta1,
+                         result_meta1_size,
+                         result_meta2,
+                         result_meta2_size,
+                         nullptr);
       }
+      GEOSGeom_destroy_r(context, g);
+    }
+  }
+  // the geometries built for this call go to the cache, in case their arguments repeat
+  if (g1 && !cached1) {
+    if (use_cache) {
+      cache_geometry(pooled_context.get(), arg1, g1);
+    } else {
+      GEOSGeom_destroy_r(context, g1);
+    }
+  }
+  if (g2 && !cached2) {
+    if (use_cache) {
+      cache_geometry(pooled_context.get(), arg2, g2);
+    } else {
       GEOSGeom_destroy_r(context, g2);
     }
-    GEOSGeom_destroy_r(context, g1);
   }
-  destroy_context(context);
   return status;
 #else
   return false;
@@ -408,25 +625,33 @@ extern "C" RUNTIME_EXPORT bool Geos_Wkb_double(
   }
   WKB wkb1{};
   // Project to best planar srid before running certain geos ops
-  if (!toWkb(wkb1,
-             arg1_type,
-             arg1_coords,
-             arg1_coords_size,
-             arg1_meta1,
-             arg1_meta1_size,
-             arg1_meta2,
-             arg1_meta2_size,
-             arg1_ic,
-             best_planar_srid_ptr)) {
+  if (best_planar_srid_ptr && !toWkb(wkb1,
+                                     arg1_type,
+                                     arg1_coords,
+                                     arg1_coords_size,
+                                     arg1_meta1,
+                                     arg1_meta1_size,
+                                     arg1_meta2,
+                                     arg1_meta2_size,
+                                     arg1_ic,
+                                     best_planar_srid_ptr)) {
     return false;
   }
 
   auto status = false;
-  auto context = create_context();
-  if (!context) {
-    return status;
-  }
-  auto* g1 = GEOSGeomFromWKB_buf_r(context, wkb1.data(), wkb1.size());
+  PooledContext pooled_context;
+  auto context = pooled_context.handle();
+  auto* g1 = best_planar_srid_ptr
+                 ? GEOSGeomFromWKB_buf_r(context, wkb1.data(), wkb1.size())
+                 : make_geometry(context,
+                                 {arg1_type,
+                                  arg1_coords,
+                                  arg1_coords_size,
+                                  arg1_meta1,
+                                  arg1_meta1_size,
+                                  arg1_meta2,
+                                  arg1_meta2_size,
+                                  arg1_ic});
   if (g1) {
     GEOSGeometry* g = nullptr;
     if (static_cast<GeoBase::GeoOp>(op) == GeoBase::GeoOp::kBUFFER) {
@@ -455,7 +680,6 @@ extern "C" RUNTIME_EXPORT bool Geos_Wkb_double(
     }
     GEOSGeom_destroy_r(context, g1);
   }
-  destroy_context(context);
   return status;
 #else
   return false;
@@ -476,26 +700,22 @@ extern "C" RUNTIME_EXPORT bool Geos_Wkb(
     int32_t arg_srid,
     bool* result) {
 #ifndef __CUDACC__
-  WKB wkb1{};
-  if (!result || !toWkb(wkb1,
-                        arg_type,
-                        arg_coords,
-                        arg_coords_size,
-                        arg_meta1,
-                        arg_meta1_size,
-                        arg_meta2,
-                        arg_meta2_size,
-                        arg_ic,
-                        nullptr)) {
+  if (!result) {
     return false;
   }
 
   auto status = false;
-  auto context = create_context();
-  if (!context) {
-    return status;
-  }
-  auto* g1 = GEOSGeomFromWKB_buf_r(context, wkb1.data(), wkb1.size());
+  PooledContext pooled_context;
+  auto context = pooled_context.handle();
+  auto* g1 = make_geometry(context,
+                           {arg_type,
+                            arg_coords,
+                            arg_coords_size,
+                            arg_meta1,
+                            arg_meta1_size,
+                            arg_meta2,
+                            arg_meta2_size,
+                            arg_ic});
   if (g1) {
     if (static_cast<GeoBase::GeoOp>(op) == GeoBase::GeoOp::kISEMPTY) {
       *result = GEOSisEmpty_r(context, g1);
@@ -506,7 +726,6 @@ extern "C" RUNTIME_EXPORT bool Geos_Wkb(
     }
     GEOSGeom_destroy_r(context, g1);
   }
-  destroy_context(context);
   return status;
 #else
   return false;
@@ -1421,7 +1421,8 @@ llvm::Value* GroupByAndAggregate::codegenWindowRowPointer(
   AUTOMATIC_IR_METADATA(executor_->cgen_state_.get());
   const auto window_func_context =
       WindowProjectNodeContext::getActiveWindowFunctionContext(executor_);
-  if (window_func_context && window_function_is_aggregate(window_func->getKind())) {
+  if (window_func_context && window_function_is_aggregate(window_func->getKind()) &&
+      !window_function_is_framed_aggregate(window_func)) {
     const int32_t row_size_quad = query_mem_desc.didOutputColumnar()
                                       ? 0
                                       : query_mem_desc.getRowSize() / sizeof(int64_t);
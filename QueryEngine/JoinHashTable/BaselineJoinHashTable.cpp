@@ -32,7 +32,8 @@
 std::unique_ptr<
     HashTableCache<HashTableCacheKey, BaselineJoinHashTable::HashTableCacheValue>>
     BaselineJoinHashTable::hash_table_cache_ = std::make_unique<
-        HashTableCache<HashTableCacheKey, BaselineJoinHashTable::HashTableCacheValue>>();
+        HashTableCache<HashTableCacheKey, BaselineJoinHashTable::HashTableCacheValue>>(
+        get_hash_table_cache_entry_size);
 
 //! Make hash table from an in-flight SQL query's parse tree etc.
 std::shared_ptr<BaselineJoinHashTable> BaselineJoinHashTable::getInstance(
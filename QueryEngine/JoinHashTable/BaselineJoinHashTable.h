@@ -48,6 +48,16 @@ struct HashTableCacheKey {
     return num_elements == that.num_elements && chunk_keys == that.chunk_keys &&
            optype == that.optype && join_type == that.join_type;
   }
+
+  size_t hash() const {
+    size_t seed = num_elements;
+    for (const auto& chunk_key : chunk_keys) {
+      boost::hash_combine(seed, boost::hash_range(chunk_key.begin(), chunk_key.end()));
+    }
+    boost::hash_combine(seed, static_cast<int>(optype));
+    boost::hash_combine(seed, static_cast<int>(join_type));
+    return seed;
+  }
 };
 
 class HashTypeCache {
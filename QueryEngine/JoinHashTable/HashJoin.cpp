@@ -529,6 +529,19 @@ std::shared_ptr<HashJoin> HashJoin::getSyntheticInstance(
   return hash_table;
 }
 
+std::vector<std::pair<std::string, HashTableCacheStats>>
+HashJoin::getHashTableCacheStats() {
+  std::vector<std::pair<std::string, HashTableCacheStats>> cache_stats;
+  auto perfect_hash_table_cache = PerfectJoinHashTable::getHashTableCache();
+  CHECK(perfect_hash_table_cache);
+  cache_stats.emplace_back("Perfect", perfect_hash_table_cache->getStats());
+  cache_stats.emplace_back("Baseline",
+                           BaselineJoinHashTable::getHashTableCache()->getStats());
+  cache_stats.emplace_back("Overlaps",
+                           OverlapsJoinHashTable::getHashTableCache()->getStats());
+  return cache_stats;
+}
+
 void HashJoin::checkHashJoinReplicationConstraint(const int table_id,
                                                   const size_t shard_count,
                                                   const Executor* executor) {
@@ -27,6 +27,7 @@
 #include "QueryEngine/CompilationOptions.h"
 #include "QueryEngine/Descriptors/RowSetMemoryOwner.h"
 #include "QueryEngine/JoinHashTable/HashTable.h"
+#include "QueryEngine/JoinHashTable/HashTableCache.h"
 #include "QueryEngine/JoinHashTable/Runtime/HashJoinRuntime.h"
 
 class TooManyHashEntries : public std::runtime_error {
@@ -202,6 +203,10 @@ class HashJoin {
       ColumnCacheMap& column_cache,
       Executor* executor);
 
+  //! Statistics of the perfect, baseline and overlaps hash table caches.
+  static std::vector<std::pair<std::string, HashTableCacheStats>>
+  getHashTableCacheStats();
+
   static int getInnerTableId(const std::vector<InnerOuter>& inner_outer_pairs) {
     CHECK(!inner_outer_pairs.empty());
     const auto first_inner_col = inner_outer_pairs.front().first;
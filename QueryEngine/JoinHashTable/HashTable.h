@@ -71,3 +71,9 @@ class HashTable {
       size_t buffer_size,
       bool raw = false);
 };
+
+// Join hash table caches only hold hash tables built on CPU.
+inline size_t get_hash_table_cache_entry_size(
+    const std::shared_ptr<HashTable>& hash_table) {
+  return hash_table ? hash_table->getHashTableBufferSize(ExecutorDeviceType::CPU) : 0;
+}
@@ -16,65 +16,265 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
+#include <limits>
+#include <list>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <unordered_map>
 #include <vector>
 
+#include <boost/functional/hash.hpp>
+
 #include "Logger/Logger.h"
 
+// Byte budget of every join hash table cache, 0 means unbounded.
+extern size_t g_hash_table_cache_max_size_bytes;
+
+struct HashTableCacheStats {
+  size_t num_entries{0};
+  size_t size_bytes{0};
+  size_t max_size_bytes{0};
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
+};
+
+/**
+ * Sharded, size-bounded LRU cache of join hash tables. Keys provide `hash()` and
+ * `operator==`; the hash must only depend on members which `operator==` compares
+ * exactly. Each shard keeps its entries in LRU order. Once the sum of the entry sizes,
+ * as reported by the size estimator, exceeds `g_hash_table_cache_max_size_bytes`, the
+ * least recently used shard tail is evicted until the cache fits its budget again.
+ * Caches without a size estimator are never evicted.
+ */
 template <class K, class V>
 class HashTableCache {
  public:
-  HashTableCache() {}
+  using SizeEstimator = std::function<size_t(const V&)>;
+
+  static constexpr size_t kDefaultNumShards{16};
+
+  HashTableCache(SizeEstimator size_estimator = nullptr,
+                 const size_t num_shards = kDefaultNumShards)
+      : size_estimator_(size_estimator)
+      , num_shards_(num_shards)
+      , shards_(std::make_unique<Shard[]>(num_shards)) {
+    CHECK_GT(num_shards_, size_t(0));
+  }
 
   std::function<void()> getCacheInvalidator() {
     return [this]() -> void {
-      std::lock_guard<std::mutex> guard(mutex_);
-      VLOG(1) << "Invalidating " << contents_.size() << " cached hash tables.";
-      contents_.clear();
+      VLOG(1) << "Invalidating " << getNumberOfCachedHashTables()
+              << " cached hash tables.";
+      clear();
     };
   }
 
+  // returns the idx-th cached hash table in insertion order, for unit tests
   V getCachedHashTable(const size_t idx) {
-    std::lock_guard<std::mutex> guard(mutex_);
-    CHECK_LT(idx, contents_.size());
-    return contents_.at(idx).second;
+    std::vector<std::pair<size_t, V>> contents;
+    for (size_t i = 0; i < num_shards_; ++i) {
+      auto& shard = shards_[i];
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      for (const auto& entry : shard.lru) {
+        contents.emplace_back(entry.insertion_id, entry.value);
+      }
+    }
+    CHECK_LT(idx, contents.size());
+    std::sort(contents.begin(),
+              contents.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    return contents[idx].second;
   }
 
   size_t getNumberOfCachedHashTables() {
-    std::lock_guard<std::mutex> guard(mutex_);
-    return contents_.size();
+    size_t num_entries{0};
+    for (size_t i = 0; i < num_shards_; ++i) {
+      auto& shard = shards_[i];
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      num_entries += shard.lru.size();
+    }
+    return num_entries;
+  }
+
+  HashTableCacheStats getStats() {
+    HashTableCacheStats stats;
+    stats.num_entries = getNumberOfCachedHashTables();
+    stats.size_bytes = size_bytes_;
+    stats.max_size_bytes = g_hash_table_cache_max_size_bytes;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.evictions = evictions_;
+    return stats;
   }
 
   void clear() {
-    std::lock_guard<std::mutex> guard(mutex_);
-    contents_.clear();
+    for (size_t i = 0; i < num_shards_; ++i) {
+      auto& shard = shards_[i];
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      for (const auto& entry : shard.lru) {
+        size_bytes_ -= entry.size;
+      }
+      shard.index.clear();
+      shard.lru.clear();
+    }
   }
 
   void insert(const K& key, V& hash_table) {
-    std::lock_guard<std::mutex> guard(mutex_);
-    for (auto& kv : contents_) {
-      if (kv.first == key) {
-        auto& cached_hash_table = kv.second;
-        cached_hash_table = hash_table;
+    const auto entry_size = size_estimator_ ? size_estimator_(hash_table) : size_t(0);
+    const auto hash = key.hash();
+    auto& shard = shards_[hash % num_shards_];
+    const auto max_size_bytes = g_hash_table_cache_max_size_bytes;
+    {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      auto entry_it = findEntry(shard, key, hash);
+      if (max_size_bytes && entry_size > max_size_bytes) {
+        VLOG(1) << "Skipped caching a hash table of " << entry_size
+                << " bytes, exceeding the cache budget of " << max_size_bytes
+                << " bytes.";
+        if (entry_it != shard.lru.end()) {
+          evictEntry(shard, entry_it);
+        }
         return;
       }
+      if (entry_it != shard.lru.end()) {
+        size_bytes_ -= entry_it->size;
+        entry_it->value = hash_table;
+        entry_it->size = entry_size;
+        entry_it->last_access = access_clock_++;
+        shard.lru.splice(shard.lru.begin(), shard.lru, entry_it);
+      } else {
+        shard.lru.emplace_front(
+            key, hash_table, entry_size, hash, next_insertion_id_++, access_clock_++);
+        shard.index.emplace(hash, shard.lru.begin());
+      }
+      size_bytes_ += entry_size;
+    }
+    if (max_size_bytes) {
+      // the new entry fits the budget on its own and is the most recently used one, so
+      // it is evicted last
+      evictToBudget(max_size_bytes);
     }
-    contents_.emplace_back(key, hash_table);
   }
 
   // makes a copy
   std::optional<V> get(const K& key) {
-    std::lock_guard<std::mutex> guard(mutex_);
-    for (const auto& kv : contents_) {
-      if (kv.first == key) {
-        return kv.second;
-      }
+    auto kv = getWithKey(key);
+    if (kv) {
+      return kv->second;
     }
     return std::nullopt;
   }
 
+  // makes a copy of both the cached key and value, keys can compare equal without being
+  // identical (see OverlapsHashTableCacheKey)
+  std::optional<std::pair<K, V>> getWithKey(const K& key) {
+    const auto hash = key.hash();
+    auto& shard = shards_[hash % num_shards_];
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto entry_it = findEntry(shard, key, hash);
+    if (entry_it == shard.lru.end()) {
+      ++misses_;
+      return std::nullopt;
+    }
+    ++hits_;
+    entry_it->last_access = access_clock_++;
+    shard.lru.splice(shard.lru.begin(), shard.lru, entry_it);
+    return std::make_pair(entry_it->key, entry_it->value);
+  }
+
  protected:
-  std::vector<std::pair<K, V>> contents_;
-  std::mutex mutex_;
+  struct Entry {
+    Entry(const K& key,
+          const V& value,
+          const size_t size,
+          const size_t hash,
+          const size_t insertion_id,
+          const size_t last_access)
+        : key(key)
+        , value(value)
+        , size(size)
+        , hash(hash)
+        , insertion_id(insertion_id)
+        , last_access(last_access) {}
+
+    const K key;
+    V value;
+    size_t size;
+    const size_t hash;
+    const size_t insertion_id;
+    size_t last_access;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  struct Shard {
+    std::mutex mutex;
+    EntryList lru;  // most recently used first
+    std::unordered_multimap<size_t, typename EntryList::iterator> index;
+  };
+
+  // must be called with the shard mutex held
+  typename EntryList::iterator findEntry(Shard& shard, const K& key, const size_t hash) {
+    const auto range = shard.index.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second->key == key) {
+        return it->second;
+      }
+    }
+    return shard.lru.end();
+  }
+
+  void evictToBudget(const size_t max_size_bytes) {
+    while (size_bytes_ > max_size_bytes) {
+      // shard tails are the least recently used entries of their shard, evict the oldest
+      std::optional<size_t> victim_shard_idx;
+      size_t oldest_access{std::numeric_limits<size_t>::max()};
+      for (size_t i = 0; i < num_shards_; ++i) {
+        auto& shard = shards_[i];
+        std::lock_guard<std::mutex> guard(shard.mutex);
+        if (!shard.lru.empty() && shard.lru.back().last_access < oldest_access) {
+          oldest_access = shard.lru.back().last_access;
+          victim_shard_idx = i;
+        }
+      }
+      if (!victim_shard_idx) {
+        break;
+      }
+      auto& victim_shard = shards_[*victim_shard_idx];
+      std::lock_guard<std::mutex> guard(victim_shard.mutex);
+      if (!victim_shard.lru.empty()) {
+        evictEntry(victim_shard, std::prev(victim_shard.lru.end()));
+      }
+    }
+  }
+
+  // must be called with the shard mutex held
+  void evictEntry(Shard& shard, typename EntryList::iterator entry_it) {
+    const auto range = shard.index.equal_range(entry_it->hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second == entry_it) {
+        shard.index.erase(it);
+        break;
+      }
+    }
+    size_bytes_ -= entry_it->size;
+    ++evictions_;
+    shard.lru.erase(entry_it);
+  }
+
+  const SizeEstimator size_estimator_;
+  const size_t num_shards_;
+  std::unique_ptr<Shard[]> shards_;
+
+  std::atomic<size_t> size_bytes_{0};
+  std::atomic<size_t> next_insertion_id_{0};
+  std::atomic<size_t> access_clock_{0};
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+  std::atomic<size_t> evictions_{0};
 };
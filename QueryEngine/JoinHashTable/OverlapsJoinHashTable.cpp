@@ -25,11 +25,12 @@
 #include "QueryEngine/JoinHashTable/Runtime/HashJoinKeyHandlers.h"
 #include "QueryEngine/JoinHashTable/Runtime/JoinHashTableGpuUtils.h"
 
-std::unique_ptr<OverlapsHashTableCache<OverlapsHashTableCacheKey,
-                                       OverlapsJoinHashTable::HashTableCacheValue>>
-    OverlapsJoinHashTable::hash_table_cache_ = std::make_unique<
-        OverlapsHashTableCache<OverlapsHashTableCacheKey,
-                               OverlapsJoinHashTable::HashTableCacheValue>>();
+std::unique_ptr<HashTableCache<OverlapsHashTableCacheKey,
+                               OverlapsJoinHashTable::HashTableCacheValue>>
+    OverlapsJoinHashTable::hash_table_cache_ =
+        std::make_unique<HashTableCache<OverlapsHashTableCacheKey,
+                                        OverlapsJoinHashTable::HashTableCacheValue>>(
+            get_hash_table_cache_entry_size);
 
 std::unique_ptr<HashTableCache<OverlapsHashTableCacheKey,
                                std::pair<OverlapsJoinHashTable::BucketThreshold,
@@ -39,6 +40,14 @@ std::unique_ptr<HashTableCache<OverlapsHashTableCacheKey,
                                         std::pair<OverlapsJoinHashTable::BucketThreshold,
                                                   OverlapsJoinHashTable::BucketSizes>>>();
 
+std::unique_ptr<
+    HashTableCache<PolygonEdgeIndexCacheKey, std::shared_ptr<PolygonEdgeIndex>>>
+    OverlapsJoinHashTable::polygon_edge_index_cache_ = std::make_unique<
+        HashTableCache<PolygonEdgeIndexCacheKey, std::shared_ptr<PolygonEdgeIndex>>>(
+        [](const std::shared_ptr<PolygonEdgeIndex>& polygon_edge_index) {
+          return polygon_edge_index ? polygon_edge_index->getMemoryUsage() : size_t(0);
+        });
+
 //! Make hash table from an in-flight SQL query's parse tree etc.
 std::shared_ptr<OverlapsJoinHashTable> OverlapsJoinHashTable::getInstance(
     const std::shared_ptr<Analyzer::BinOper> condition,
@@ -1091,6 +1100,7 @@ void OverlapsJoinHashTable::reify(const HashType preferred_layout) {
   }
   try {
     reifyWithLayout(layout);
+    reifyPolygonEdgeIndex();
     return;
   } catch (const std::exception& e) {
     VLOG(1) << "Caught exception while building overlaps baseline hash table: "
@@ -1099,6 +1109,40 @@ void OverlapsJoinHashTable::reify(const HashType preferred_layout) {
   }
 }
 
+void OverlapsJoinHashTable::reifyPolygonEdgeIndex() {
+  if (!g_enable_overlaps_polygon_edge_index ||
+      memory_level_ != Data_Namespace::CPU_LEVEL) {
+    // only the CPU code of ST_Contains reads the index
+    return;
+  }
+  CHECK_EQ(inner_outer_pairs_.size(), size_t(1));
+  const auto inner_col = inner_outer_pairs_.front().first;
+  const auto table_id = inner_col->get_table_id();
+  if (table_id <= 0) {
+    return;
+  }
+  // the inner column of ST_Contains(polygon, point) is the bounds of the polygon, the
+  // physical column which follows its coords and ring sizes
+  const auto& cat = *executor_->getCatalog();
+  const auto geo_cd = cat.getMetadataForColumn(table_id, inner_col->get_column_id() - 3);
+  if (!geo_cd || geo_cd->isGeoPhyCol || geo_cd->columnType.get_type() != kPOLYGON ||
+      geo_cd->columnId + geo_cd->columnType.get_physical_coord_cols() + 1 !=
+          inner_col->get_column_id()) {
+    return;
+  }
+  const auto& query_info = get_inner_query_info(table_id, query_infos_).info;
+  const auto cache_key = PolygonEdgeIndex::getCacheKey(cat, geo_cd, query_info.fragments);
+  CHECK(polygon_edge_index_cache_);
+  if (auto cached_polygon_edge_index = polygon_edge_index_cache_->get(cache_key)) {
+    polygon_edge_index_ = *cached_polygon_edge_index;
+    return;
+  }
+  polygon_edge_index_ = PolygonEdgeIndex::build(cat, geo_cd, query_info.fragments);
+  if (!query_hint_.isHintRegistered(QueryHint::kOverlapsNoCache)) {
+    polygon_edge_index_cache_->insert(cache_key, polygon_edge_index_);
+  }
+}
+
 void OverlapsJoinHashTable::reifyImpl(std::vector<ColumnsForDevice>& columns_per_device,
                                       const Fragmenter_Namespace::TableInfo& query_info,
                                       const HashType layout,
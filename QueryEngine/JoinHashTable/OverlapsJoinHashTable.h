@@ -20,6 +20,7 @@
 #include "QueryEngine/JoinHashTable/BaselineJoinHashTable.h"
 #include "QueryEngine/JoinHashTable/HashJoin.h"
 #include "QueryEngine/JoinHashTable/HashTableCache.h"
+#include "QueryEngine/JoinHashTable/PolygonEdgeIndex.h"
 
 struct OverlapsHashTableCacheKey {
   const size_t num_elements;
@@ -44,6 +45,18 @@ struct OverlapsHashTableCacheKey {
            bucket_threshold == that.bucket_threshold;
   }
 
+  // inverse bucket sizes are compared approximately and must not contribute to the hash
+  size_t hash() const {
+    size_t seed = num_elements;
+    for (const auto& chunk_key : chunk_keys) {
+      boost::hash_combine(seed, boost::hash_range(chunk_key.begin(), chunk_key.end()));
+    }
+    boost::hash_combine(seed, static_cast<int>(optype));
+    boost::hash_combine(seed, max_hashtable_size);
+    boost::hash_combine(seed, bucket_threshold);
+    return seed;
+  }
+
   OverlapsHashTableCacheKey(const size_t num_elements,
                             const std::vector<ChunkKey>& chunk_keys,
                             const SQLOps& optype,
@@ -70,20 +83,6 @@ struct OverlapsHashTableCacheKey {
       , inverse_bucket_sizes(inverse_bucket_sizes) {}
 };
 
-template <class K, class V>
-class OverlapsHashTableCache : public HashTableCache<K, V> {
- public:
-  std::optional<std::pair<K, V>> getWithKey(const K& key) {
-    std::lock_guard<std::mutex> guard(this->mutex_);
-    for (const auto& kv : this->contents_) {
-      if (kv.first == key) {
-        return kv;
-      }
-    }
-    return std::nullopt;
-  }
-};
-
 class OverlapsJoinHashTable : public HashJoin {
  public:
   OverlapsJoinHashTable(const std::shared_ptr<Analyzer::BinOper> condition,
@@ -129,6 +128,11 @@ class OverlapsJoinHashTable : public HashJoin {
       CHECK(hash_table_cache_);
       auto main_cache_invalidator = hash_table_cache_->getCacheInvalidator();
       main_cache_invalidator();
+
+      CHECK(polygon_edge_index_cache_);
+      auto polygon_edge_index_cache_invalidator =
+          polygon_edge_index_cache_->getCacheInvalidator();
+      polygon_edge_index_cache_invalidator();
     };
   }
 
@@ -139,11 +143,29 @@ class OverlapsJoinHashTable : public HashJoin {
            auto_tuner_cache_->getNumberOfCachedHashTables();
   }
 
+  static auto* getHashTableCache() {
+    CHECK(hash_table_cache_);
+    return hash_table_cache_.get();
+  }
+
+  static auto* getPolygonEdgeIndexCache() {
+    CHECK(polygon_edge_index_cache_);
+    return polygon_edge_index_cache_.get();
+  }
+
+  // The edge index of the polygon column of the inner table, see PolygonEdgeIndex, only
+  // built for CPU execution.
+  const PolygonEdgeIndex* getPolygonEdgeIndex() const {
+    return polygon_edge_index_.get();
+  }
+
  protected:
   void reify(const HashType preferred_layout);
 
   void reifyWithLayout(const HashType layout);
 
+  void reifyPolygonEdgeIndex();
+
   virtual void reifyImpl(std::vector<ColumnsForDevice>& columns_per_device,
                          const Fragmenter_Namespace::TableInfo& query_info,
                          const HashType layout,
@@ -363,8 +385,7 @@ class OverlapsJoinHashTable : public HashJoin {
 
   using HashTableCacheValue = std::shared_ptr<HashTable>;
   // includes bucket threshold
-  static std::unique_ptr<
-      OverlapsHashTableCache<OverlapsHashTableCacheKey, HashTableCacheValue>>
+  static std::unique_ptr<HashTableCache<OverlapsHashTableCacheKey, HashTableCacheValue>>
       hash_table_cache_;
   // skips bucket threshold
   using BucketThreshold = double;
@@ -373,5 +394,10 @@ class OverlapsJoinHashTable : public HashJoin {
       HashTableCache<OverlapsHashTableCacheKey, std::pair<BucketThreshold, BucketSizes>>>
       auto_tuner_cache_;
 
+  std::shared_ptr<PolygonEdgeIndex> polygon_edge_index_;
+  static std::unique_ptr<
+      HashTableCache<PolygonEdgeIndexCacheKey, std::shared_ptr<PolygonEdgeIndex>>>
+      polygon_edge_index_cache_;
+
   RegisteredQueryHint query_hint_;
 };
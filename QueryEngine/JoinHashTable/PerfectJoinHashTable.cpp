@@ -34,7 +34,8 @@ std::unique_ptr<HashTableCache<PerfectJoinHashTable::JoinHashTableCacheKey,
                                PerfectJoinHashTable::HashTableCacheValue>>
     PerfectJoinHashTable::hash_table_cache_ =
         std::make_unique<HashTableCache<PerfectJoinHashTable::JoinHashTableCacheKey,
-                                        PerfectJoinHashTable::HashTableCacheValue>>();
+                                        PerfectJoinHashTable::HashTableCacheValue>>(
+            get_hash_table_cache_entry_size);
 
 namespace {
 
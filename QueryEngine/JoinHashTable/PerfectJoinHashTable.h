@@ -217,6 +217,14 @@ class PerfectJoinHashTable : public HashJoin {
              chunk_key == that.chunk_key && optype == that.optype &&
              join_type == that.join_type;
     }
+
+    size_t hash() const {
+      size_t seed = boost::hash_range(chunk_key.begin(), chunk_key.end());
+      boost::hash_combine(seed, num_elements);
+      boost::hash_combine(seed, static_cast<int>(optype));
+      boost::hash_combine(seed, static_cast<int>(join_type));
+      return seed;
+    }
   };
 
   static std::unique_ptr<HashTableCache<JoinHashTableCacheKey, HashTableCacheValue>>
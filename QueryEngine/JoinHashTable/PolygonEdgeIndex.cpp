@@ -0,0 +1,255 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/JoinHashTable/PolygonEdgeIndex.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "Catalog/Catalog.h"
+#include "DataMgr/Chunk/Chunk.h"
+#include "Fragmenter/Fragmenter.h"
+#include "Geospatial/CompressionRuntime.h"
+#include "Logger/Logger.h"
+#include "Shared/measure.h"
+
+bool g_enable_overlaps_polygon_edge_index{true};
+
+namespace {
+
+// Polygons with fewer edges are cheap enough to test edge by edge.
+constexpr size_t kMinIndexedEdges{32};
+// Average number of edges per band the number of bands is chosen for.
+constexpr size_t kEdgesPerBand{4};
+constexpr size_t kMaxBands{1024};
+// Bound on the number of times the edges of a polygon are listed, over all the bands.
+// Long edges are listed for every band they cross, the bands are halved until the
+// polygon fits.
+constexpr size_t kMaxEdgeListings{8};
+
+struct GeoColumns {
+  const ColumnDescriptor* coords_cd;
+  const ColumnDescriptor* ring_sizes_cd;
+};
+
+GeoColumns get_polygon_physical_columns(const Catalog_Namespace::Catalog& cat,
+                                        const ColumnDescriptor* geo_cd) {
+  CHECK_EQ(geo_cd->columnType.get_type(), kPOLYGON);
+  const auto coords_cd = cat.getMetadataForColumn(geo_cd->tableId, geo_cd->columnId + 1);
+  CHECK(coords_cd);
+  CHECK(coords_cd->isGeoPhyCol);
+  const auto ring_sizes_cd =
+      cat.getMetadataForColumn(geo_cd->tableId, geo_cd->columnId + 2);
+  CHECK(ring_sizes_cd);
+  CHECK(ring_sizes_cd->isGeoPhyCol);
+  return {coords_cd, ring_sizes_cd};
+}
+
+std::shared_ptr<ChunkMetadata> get_chunk_metadata(
+    const Fragmenter_Namespace::FragmentInfo& fragment,
+    const ColumnDescriptor* cd) {
+  const auto& chunk_metadata_map = fragment.getChunkMetadataMap();
+  const auto chunk_meta_it = chunk_metadata_map.find(cd->columnId);
+  CHECK(chunk_meta_it != chunk_metadata_map.end());
+  return chunk_meta_it->second;
+}
+
+std::shared_ptr<Chunk_NS::Chunk> get_chunk(
+    const Catalog_Namespace::Catalog& cat,
+    const ColumnDescriptor* cd,
+    const Fragmenter_Namespace::FragmentInfo& fragment,
+    const std::shared_ptr<ChunkMetadata>& chunk_metadata) {
+  const ChunkKey chunk_key{cat.getCurrentDB().dbId,
+                           fragment.physicalTableId,
+                           cd->columnId,
+                           fragment.fragmentId};
+  return Chunk_NS::Chunk::getChunk(cd,
+                                   &cat.getDataMgr(),
+                                   chunk_key,
+                                   Data_Namespace::CPU_LEVEL,
+                                   0,
+                                   chunk_metadata->numBytes,
+                                   chunk_metadata->numElements);
+}
+
+}  // namespace
+
+std::shared_ptr<PolygonEdgeIndex> PolygonEdgeIndex::build(
+    const Catalog_Namespace::Catalog& cat,
+    const ColumnDescriptor* geo_cd,
+    const std::vector<Fragmenter_Namespace::FragmentInfo>& fragments) {
+  auto timer = DEBUG_TIMER(__func__);
+  const auto [coords_cd, ring_sizes_cd] = get_polygon_physical_columns(cat, geo_cd);
+  const bool compressed = geo_cd->columnType.get_compression() == kENCODING_GEOINT;
+  auto polygon_edge_index =
+      std::make_shared<PolygonEdgeIndex>(geo_cd->tableId, geo_cd->columnId);
+  for (const auto& fragment : fragments) {
+    if (fragment.isEmptyPhysicalFragment()) {
+      continue;
+    }
+    const auto coords_metadata = get_chunk_metadata(fragment, coords_cd);
+    const auto ring_sizes_metadata = get_chunk_metadata(fragment, ring_sizes_cd);
+    CHECK_EQ(coords_metadata->numElements, ring_sizes_metadata->numElements);
+    const auto num_rows = coords_metadata->numElements;
+    if (!num_rows) {
+      continue;
+    }
+    const auto coords_chunk = get_chunk(cat, coords_cd, fragment, coords_metadata);
+    const auto ring_sizes_chunk =
+        get_chunk(cat, ring_sizes_cd, fragment, ring_sizes_metadata);
+    auto coords_it = coords_chunk->begin_iterator(coords_metadata);
+    auto ring_sizes_it = ring_sizes_chunk->begin_iterator(ring_sizes_metadata);
+    for (size_t i = 0; i < num_rows; ++i) {
+      ArrayDatum coords;
+      ArrayDatum ring_sizes;
+      bool is_end;
+      ChunkIter_get_nth(&coords_it, i, &coords, &is_end);
+      CHECK(!is_end);
+      ChunkIter_get_nth(&ring_sizes_it, i, &ring_sizes, &is_end);
+      CHECK(!is_end);
+      if (coords.is_null || ring_sizes.is_null) {
+        polygon_edge_index->addUnindexedRow();
+        continue;
+      }
+      polygon_edge_index->addRow(coords.pointer,
+                                 coords.length,
+                                 reinterpret_cast<const int32_t*>(ring_sizes.pointer),
+                                 ring_sizes.length / sizeof(int32_t),
+                                 compressed);
+    }
+  }
+  VLOG(1) << "Built the edge index of polygon column " << geo_cd->columnName
+          << " of table " << geo_cd->tableId << ": "
+          << polygon_edge_index->getNumRows() << " rows, "
+          << polygon_edge_index->getMemoryUsage() << " bytes";
+  return polygon_edge_index;
+}
+
+PolygonEdgeIndexCacheKey PolygonEdgeIndex::getCacheKey(
+    const Catalog_Namespace::Catalog& cat,
+    const ColumnDescriptor* geo_cd,
+    const std::vector<Fragmenter_Namespace::FragmentInfo>& fragments) {
+  const auto coords_cd = get_polygon_physical_columns(cat, geo_cd).coords_cd;
+  size_t num_elements{0};
+  std::vector<ChunkKey> chunk_keys;
+  for (const auto& fragment : fragments) {
+    if (fragment.isEmptyPhysicalFragment()) {
+      continue;
+    }
+    num_elements += get_chunk_metadata(fragment, coords_cd)->numElements;
+    chunk_keys.push_back({cat.getCurrentDB().dbId,
+                          fragment.physicalTableId,
+                          coords_cd->columnId,
+                          fragment.fragmentId});
+  }
+  return {num_elements, chunk_keys};
+}
+
+void PolygonEdgeIndex::addRow(const int8_t* coords,
+                              const size_t coords_size,
+                              const int32_t* ring_sizes,
+                              const size_t num_rings,
+                              const bool compressed) {
+  const size_t num_coords =
+      coords_size / (compressed ? sizeof(int32_t) : sizeof(double));
+  // the y of the point, as ST_Contains reads it from untransformed coords
+  const auto get_y = [coords, compressed](const size_t point) -> double {
+    if (compressed) {
+      return Geospatial::decompress_lattitude_coord_geoint32(
+          reinterpret_cast<const int32_t*>(coords)[2 * point + 1]);
+    }
+    return reinterpret_cast<const double*>(coords)[2 * point + 1];
+  };
+
+  size_t num_edges{0};
+  for (size_t r = 0; r < num_rings; ++r) {
+    if (ring_sizes[r] <= 0) {
+      addUnindexedRow();
+      return;
+    }
+    num_edges += ring_sizes[r];
+  }
+  if (!num_rings || 2 * num_edges != num_coords || num_edges < kMinIndexedEdges ||
+      num_edges > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    addUnindexedRow();
+    return;
+  }
+  double min_y = std::numeric_limits<double>::max();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (size_t point = 0; point < num_edges; ++point) {
+    min_y = std::min(min_y, get_y(point));
+    max_y = std::max(max_y, get_y(point));
+  }
+  if (!(max_y > min_y)) {
+    addUnindexedRow();
+    return;
+  }
+
+  // calls f(ring, edge, first band, last band) for every edge, an edge being the ring
+  // relative index of its first point
+  const auto for_each_edge = [&](const Row& row, const auto& f) {
+    size_t ring_first_point{0};
+    for (size_t r = 0; r < num_rings; ++r) {
+      const size_t ring_num_points = ring_sizes[r];
+      for (size_t e = 0; e < ring_num_points; ++e) {
+        const auto y0 = get_y(ring_first_point + e);
+        const auto y1 = get_y(ring_first_point + (e + 1) % ring_num_points);
+        f(r, e, getBand(row, std::min(y0, y1)), getBand(row, std::max(y0, y1)));
+      }
+      ring_first_point += ring_num_points;
+    }
+  };
+
+  for (auto num_bands = std::min(num_edges / kEdgesPerBand, kMaxBands); num_bands > 1;
+       num_bands /= 2) {
+    const Row row{static_cast<int64_t>(num_coords),
+                  static_cast<int32_t>(num_rings),
+                  static_cast<int32_t>(num_bands),
+                  min_y,
+                  num_bands / (max_y - min_y),
+                  static_cast<int64_t>(band_offsets_.size()),
+                  static_cast<int64_t>(edges_.size())};
+    // number of edges listed for each band and ring, shifted by one slot to turn into
+    // the offsets
+    std::vector<int32_t> offsets(num_bands * num_rings + 1, 0);
+    size_t num_listings{0};
+    for_each_edge(
+        row, [&](const size_t r, const size_t, const int32_t b0, const int32_t b1) {
+          for (auto b = b0; b <= b1; ++b) {
+            ++offsets[b * num_rings + r + 1];
+          }
+          num_listings += b1 - b0 + 1;
+        });
+    if (num_listings > kMaxEdgeListings * num_edges) {
+      continue;
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    CHECK_EQ(static_cast<size_t>(offsets.back()), num_listings);
+    edges_.resize(row.edges + num_listings);
+    auto next_listing = offsets;
+    for_each_edge(
+        row, [&](const size_t r, const size_t e, const int32_t b0, const int32_t b1) {
+          for (auto b = b0; b <= b1; ++b) {
+            edges_[row.edges + next_listing[b * num_rings + r]++] = e;
+          }
+        });
+    band_offsets_.insert(band_offsets_.end(), offsets.begin(), offsets.end());
+    rows_.push_back(row);
+    return;
+  }
+  addUnindexedRow();
+}
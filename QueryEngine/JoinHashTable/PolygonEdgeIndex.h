@@ -0,0 +1,161 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    PolygonEdgeIndex.h
+ * @brief   Index of the edges of the polygons of the inner table of an overlaps join,
+ *          used by ST_Contains to only test the edges around the y of the point.
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "Shared/types.h"
+
+namespace Catalog_Namespace {
+class Catalog;
+}  // namespace Catalog_Namespace
+
+namespace Fragmenter_Namespace {
+class FragmentInfo;
+}  // namespace Fragmenter_Namespace
+
+struct ColumnDescriptor;
+
+extern bool g_enable_overlaps_polygon_edge_index;
+
+struct PolygonEdgeIndexCacheKey {
+  const size_t num_elements;
+  const std::vector<ChunkKey> chunk_keys;
+
+  bool operator==(const PolygonEdgeIndexCacheKey& that) const {
+    return num_elements == that.num_elements && chunk_keys == that.chunk_keys;
+  }
+
+  size_t hash() const {
+    size_t seed = num_elements;
+    for (const auto& chunk_key : chunk_keys) {
+      boost::hash_combine(seed, boost::hash_range(chunk_key.begin(), chunk_key.end()));
+    }
+    return seed;
+  }
+};
+
+/**
+ * Y band index of the edges of the polygons of a POLYGON column, built on the build side
+ * of an overlaps join so that the ST_Contains check which follows the bucket probe
+ * doesn't walk every edge of the matched polygon. The y range of each polygon is split
+ * into bands of equal height, and every edge is listed, per ring, for each band its y
+ * range overlaps. When points on edges are excluded, only the edges whose y range
+ * contains the y of the point affect the winding number, and all of them are listed for
+ * the band of the point, so testing the band edges gives the same result as testing all
+ * the edges. Rows are the positions of the linearized inner column, across the
+ * fragments in the order they are given. Small polygons, nulls and polygons without a
+ * ring aren't indexed, ST_Contains tests all their edges.
+ */
+class PolygonEdgeIndex {
+ public:
+  PolygonEdgeIndex(const int table_id, const int column_id)
+      : table_id_(table_id), column_id_(column_id) {}
+
+  // Builds the index of the POLYGON column `geo_cd` over the fragments.
+  static std::shared_ptr<PolygonEdgeIndex> build(
+      const Catalog_Namespace::Catalog& cat,
+      const ColumnDescriptor* geo_cd,
+      const std::vector<Fragmenter_Namespace::FragmentInfo>& fragments);
+
+  static PolygonEdgeIndexCacheKey getCacheKey(
+      const Catalog_Namespace::Catalog& cat,
+      const ColumnDescriptor* geo_cd,
+      const std::vector<Fragmenter_Namespace::FragmentInfo>& fragments);
+
+  int getTableId() const { return table_id_; }
+
+  int getColumnId() const { return column_id_; }
+
+  size_t getNumRows() const { return rows_.size(); }
+
+  size_t getMemoryUsage() const {
+    return rows_.size() * sizeof(Row) +
+           (band_offsets_.size() + edges_.size()) * sizeof(int32_t);
+  }
+
+  // Returns the num_rings + 1 offsets into `*edges` of the edges of each ring of the
+  // polygon at `row` listed for the band of `y`, an edge being the ring relative index
+  // of its first point, or nullptr if the row isn't indexed. The number of coords and
+  // rings of the polygon must match the indexed ones.
+  const int32_t* getRingEdgeOffsets(const int64_t row,
+                                    const int64_t num_coords,
+                                    const int64_t num_rings,
+                                    const double y,
+                                    const int32_t** edges) const {
+    if (row < 0 || static_cast<size_t>(row) >= rows_.size()) {
+      return nullptr;
+    }
+    const auto& indexed_row = rows_[row];
+    if (!indexed_row.num_bands || indexed_row.num_coords != num_coords ||
+        indexed_row.num_rings != num_rings) {
+      return nullptr;
+    }
+    *edges = edges_.data() + indexed_row.edges;
+    return band_offsets_.data() + indexed_row.band_offsets +
+           getBand(indexed_row, y) * indexed_row.num_rings;
+  }
+
+  void addRow(const int8_t* coords,
+              const size_t coords_size,
+              const int32_t* ring_sizes,
+              const size_t num_rings,
+              const bool compressed);
+
+  void addUnindexedRow() { rows_.push_back({0, 0, 0, 0, 0, 0, 0}); }
+
+ private:
+  struct Row {
+    int64_t num_coords;
+    int32_t num_rings;
+    int32_t num_bands;  // 0 if the row isn't indexed
+    double min_y;
+    double inverse_band_height;
+    // the first offset of the row in band_offsets_, band major, num_rings per band
+    // followed by the end offset of the last band
+    int64_t band_offsets;
+    // the first edge of the row in edges_, the band offsets are relative to it
+    int64_t edges;
+  };
+
+  // Monotonic in y, so the band of a y within the range of an edge is within the bands
+  // of the ends of the edge.
+  static int32_t getBand(const Row& row, const double y) {
+    const double band = std::floor((y - row.min_y) * row.inverse_band_height);
+    if (!(band > 0)) {
+      return 0;
+    }
+    return band >= row.num_bands - 1 ? row.num_bands - 1 : static_cast<int32_t>(band);
+  }
+
+  const int table_id_;
+  const int column_id_;
+  std::vector<Row> rows_;
+  std::vector<int32_t> band_offsets_;
+  std::vector<int32_t> edges_;
+};
@@ -20,6 +20,7 @@
 #include "GpuSharedMemoryUtils.h"
 #include "LLVMFunctionAttributesUtil.h"
 #include "OutputBufferInitialization.h"
+#include "PersistentCodeCache.h"
 #include "QueryTemplateGenerator.h"
 
 #include "CudaMgr/CudaMgr.h"
@@ -416,12 +417,15 @@ std::string assemblyForCPU(ExecutionEngineWrapper& execution_engine,
 ExecutionEngineWrapper CodeGenerator::generateNativeCPUCode(
     llvm::Function* func,
     const std::unordered_set<llvm::Function*>& live_funcs,
-    const CompilationOptions& co) {
+    const CompilationOptions& co,
+    PersistentObjectCache* object_cache) {
   auto module = func->getParent();
-  // run optimizations
+  // run optimizations, unless MCJIT loads the object code from the cache
 #ifndef WITH_JIT_DEBUG
   llvm::legacy::PassManager pass_manager;
-  optimize_ir(func, module, pass_manager, live_funcs, co);
+  if (!object_cache || !object_cache->hasCachedObject()) {
+    optimize_ir(func, module, pass_manager, live_funcs, co);
+  }
 #endif  // WITH_JIT_DEBUG
 
   auto init_err = llvm::InitializeNativeTarget();
@@ -454,7 +458,14 @@ ExecutionEngineWrapper CodeGenerator::generateNativeCPUCode(
   CHECK(execution_engine.get());
   LOG(ASM) << assemblyForCPU(execution_engine, module);
 
+  if (object_cache) {
+    execution_engine->setObjectCache(object_cache);
+  }
   execution_engine->finalizeObject();
+  if (object_cache) {
+    // the module is compiled (or loaded) by now, the object cache is scoped to it
+    execution_engine->setObjectCache(nullptr);
+  }
   return execution_engine;
 }
 
@@ -502,8 +513,12 @@ std::shared_ptr<CompilationContext> Executor::optimizeAndCodegenCPU(
 #endif
   }
 
-  auto execution_engine =
-      CodeGenerator::generateNativeCPUCode(query_func, live_funcs, co);
+  std::unique_ptr<PersistentObjectCache> object_cache;
+  if (auto persistent_code_cache = PersistentCodeCache::get()) {
+    object_cache = std::make_unique<PersistentObjectCache>(*persistent_code_cache, key);
+  }
+  auto execution_engine = CodeGenerator::generateNativeCPUCode(
+      query_func, live_funcs, co, object_cache.get());
   auto cpu_compilation_context =
       std::make_shared<CpuCompilationContext>(std::move(execution_engine));
   cpu_compilation_context->setFunctionPointer(multifrag_query_func);
@@ -1366,6 +1381,7 @@ bool CodeGenerator::alwaysCloneRuntimeFunction(const llvm::Function* func) {
          func->getName() == "fixed_width_int_decode" ||
          func->getName() == "fixed_width_unsigned_decode" ||
          func->getName() == "diff_fixed_width_int_decode" ||
+         func->getName() == "run_length_int_decode" ||
          func->getName() == "fixed_width_double_decode" ||
          func->getName() == "fixed_width_float_decode" ||
          func->getName() == "fixed_width_small_date_decode" ||
@@ -1759,8 +1775,14 @@ void read_udf_cpu_module(const std::string& udf_ir_filename) {
 
   udf_cpu_module = llvm::parseIRFile(file_name_arg, parse_error, getGlobalLLVMContext());
   if (!udf_cpu_module) {
+    PersistentCodeCache::setUdfModuleIR(PersistentCodeCache::UdfModule::kLoadTime, "");
     throw_parseIR_error(parse_error, udf_ir_filename);
   }
+  std::string udf_ir;
+  llvm::raw_string_ostream os(udf_ir);
+  udf_cpu_module->print(os, nullptr);
+  PersistentCodeCache::setUdfModuleIR(PersistentCodeCache::UdfModule::kLoadTime,
+                                      os.str());
 }
 
 void read_rt_udf_gpu_module(const std::string& udf_ir_string) {
@@ -1795,8 +1817,11 @@ void read_rt_udf_cpu_module(const std::string& udf_ir_string) {
   rt_udf_cpu_module = llvm::parseIR(*buf, parse_error, getGlobalLLVMContext());
   if (!rt_udf_cpu_module) {
     LOG(IR) << "read_rt_udf_cpu_module:LLVM IR:\n" << udf_ir_string << "\nEnd of LLVM IR";
+    PersistentCodeCache::setUdfModuleIR(PersistentCodeCache::UdfModule::kRuntime, "");
     throw_parseIR_error(parse_error);
   }
+  PersistentCodeCache::setUdfModuleIR(PersistentCodeCache::UdfModule::kRuntime,
+                                      udf_ir_string);
 }
 
 std::unordered_set<llvm::Function*> CodeGenerator::markDeadRuntimeFuncs(
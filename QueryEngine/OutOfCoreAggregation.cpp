@@ -0,0 +1,326 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/OutOfCoreAggregation.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Analyzer/Analyzer.h"
+#include "Logger/Logger.h"
+#include "QueryEngine/ExpressionRange.h"
+#include "QueryEngine/RuntimeFunctions.h"
+
+extern bool g_bigint_count;
+
+bool g_enable_out_of_core_aggregation{true};
+size_t g_out_of_core_aggregation_max_groups{64000000};
+
+namespace out_of_core_aggregation {
+
+namespace {
+
+bool is_supported_target(const TargetInfo& target_info) {
+  if (target_info.sql_type.is_varlen() || target_info.is_varlen_projection) {
+    return false;
+  }
+  if (!target_info.is_agg) {
+    return true;
+  }
+  if (target_info.is_distinct) {
+    return false;
+  }
+  switch (target_info.agg_kind) {
+    case kAVG:
+    case kMIN:
+    case kMAX:
+    case kSUM:
+    case kCOUNT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The aggregated value of a target is kept as a projected column of its final type.
+TargetInfo get_compact_target_info(const TargetInfo& target_info) {
+  const auto sql_type = target_info.is_agg && target_info.agg_kind == kAVG
+                            ? SQLTypeInfo(kDOUBLE, false)
+                            : target_info.sql_type;
+  return {false, kMIN, sql_type, SQLTypeInfo(kNULLT, false), false, false, false};
+}
+
+// Floats are read back from 4 byte slots, everything else from 8 byte slots.
+size_t get_slot_width(const SQLTypeInfo& ti) {
+  return ti.get_type() == kFLOAT ? sizeof(float) : sizeof(int64_t);
+}
+
+void write_slot(int8_t* slot_ptr,
+                const TargetValue& target_value,
+                const SQLTypeInfo& ti) {
+  const auto scalar_tv = boost::get<ScalarTargetValue>(&target_value);
+  CHECK(scalar_tv);
+  if (ti.get_type() == kFLOAT) {
+    const auto fval = boost::get<float>(scalar_tv);
+    CHECK(fval);
+    std::memcpy(slot_ptr, fval, sizeof(float));
+  } else if (ti.get_type() == kDOUBLE) {
+    const auto dval = boost::get<double>(scalar_tv);
+    CHECK(dval);
+    std::memcpy(slot_ptr, dval, sizeof(double));
+  } else {
+    const auto ival = boost::get<int64_t>(scalar_tv);
+    CHECK(ival);
+    std::memcpy(slot_ptr, ival, sizeof(int64_t));
+  }
+}
+
+std::shared_ptr<Analyzer::Expr> make_bound(const SQLTypeInfo& key_ti,
+                                           const int64_t value) {
+  Datum d;
+  switch (key_ti.get_type()) {
+    case kTINYINT:
+      d.tinyintval = static_cast<int8_t>(value);
+      break;
+    case kSMALLINT:
+      d.smallintval = static_cast<int16_t>(value);
+      break;
+    case kINT:
+      d.intval = static_cast<int32_t>(value);
+      break;
+    case kBIGINT:
+    case kNUMERIC:
+    case kDECIMAL:
+      d.bigintval = value;
+      break;
+    default:
+      UNREACHABLE() << key_ti.get_type_name();
+  }
+  return makeExpr<Analyzer::Constant>(key_ti, false, d);
+}
+
+}  // namespace
+
+bool is_supported(const RelAlgExecutionUnit& ra_exe_unit) {
+  if (ra_exe_unit.groupby_exprs.empty() || !ra_exe_unit.groupby_exprs.front() ||
+      ra_exe_unit.estimator || ra_exe_unit.union_all ||
+      ra_exe_unit.sort_info.algorithm == SortAlgorithm::SpeculativeTopN) {
+    return false;
+  }
+  return std::all_of(ra_exe_unit.target_exprs.begin(),
+                     ra_exe_unit.target_exprs.end(),
+                     [](const Analyzer::Expr* target_expr) {
+                       return is_supported_target(
+                           get_target_info(target_expr, g_bigint_count));
+                     });
+}
+
+std::optional<PartitionKey> get_partition_key(
+    const RelAlgExecutionUnit& ra_exe_unit,
+    const std::vector<InputTableInfo>& query_infos,
+    const Executor* executor) {
+  std::optional<PartitionKey> partition_key;
+  uint64_t key_span{0};
+  for (const auto& groupby_expr : ra_exe_unit.groupby_exprs) {
+    const auto& ti = groupby_expr->get_type_info();
+    if (!ti.is_integer() && !ti.is_decimal()) {
+      continue;
+    }
+    const auto range = getExpressionRange(groupby_expr.get(), query_infos, executor);
+    if (range.getType() != ExpressionRangeType::Integer ||
+        range.getIntMax() < range.getIntMin()) {
+      continue;
+    }
+    // computed unsigned, the range may cover the whole 64-bit domain
+    const auto span = static_cast<uint64_t>(range.getIntMax()) -
+                      static_cast<uint64_t>(range.getIntMin());
+    if (!partition_key || span > key_span) {
+      partition_key = PartitionKey{groupby_expr, range.getIntMin(), range.getIntMax()};
+      key_span = span;
+    }
+  }
+  return partition_key;
+}
+
+std::vector<KeyRange> split_key_range(const KeyRange& range,
+                                      const size_t partition_count) {
+  CHECK_GT(partition_count, size_t(0));
+  CHECK_LE(range.start, range.end);
+  const auto span = static_cast<uint64_t>(range.end) - static_cast<uint64_t>(range.start);
+  const auto actual_partition_count = static_cast<size_t>(
+      std::min(span, static_cast<uint64_t>(partition_count - 1)) + 1);
+  // split the span + 1 values of the range as evenly as possible
+  const auto quotient = (span - (actual_partition_count - 1)) / actual_partition_count;
+  const auto remainder = (span - (actual_partition_count - 1)) % actual_partition_count;
+  std::vector<KeyRange> ranges;
+  auto start = static_cast<uint64_t>(range.start);
+  for (size_t partition_idx = 0; partition_idx < actual_partition_count;
+       ++partition_idx) {
+    const auto end = start + quotient + (partition_idx < remainder ? 1 : 0);
+    ranges.push_back({static_cast<int64_t>(start),
+                      static_cast<int64_t>(end),
+                      range.is_lowest && partition_idx == 0,
+                      range.is_highest && partition_idx + 1 == actual_partition_count});
+    start = end + 1;
+  }
+  CHECK_EQ(ranges.back().end, range.end);
+  return ranges;
+}
+
+PartitionQuals make_partition_quals(const PartitionKey& partition_key,
+                                    const KeyRange& range) {
+  const auto& key_ti = partition_key.expr->get_type_info();
+  PartitionQuals partition_quals;
+  if (!range.is_lowest) {
+    auto lower_bound =
+        makeExpr<Analyzer::BinOper>(kBOOLEAN,
+                                    kGE,
+                                    kONE,
+                                    partition_key.expr->deep_copy(),
+                                    make_bound(key_ti, range.start));
+    if (range.is_highest) {
+      lower_bound = makeExpr<Analyzer::BinOper>(
+          kBOOLEAN,
+          kOR,
+          kONE,
+          lower_bound,
+          makeExpr<Analyzer::UOper>(
+              kBOOLEAN, kISNULL, partition_key.expr->deep_copy()));
+    }
+    partition_quals.push_back(lower_bound);
+  }
+  if (!range.is_highest) {
+    partition_quals.push_back(
+        makeExpr<Analyzer::BinOper>(kBOOLEAN,
+                                    kLE,
+                                    kONE,
+                                    partition_key.expr->deep_copy(),
+                                    make_bound(key_ti, range.end)));
+  }
+  return partition_quals;
+}
+
+RelAlgExecutionUnit add_partition_quals(const RelAlgExecutionUnit& ra_exe_unit,
+                                        const PartitionQuals& partition_quals) {
+  auto partition_exe_unit = ra_exe_unit;
+  for (const auto& qual : partition_quals) {
+    const auto bin_oper = std::dynamic_pointer_cast<const Analyzer::BinOper>(qual);
+    // plain range checks of a column can also skip whole fragments
+    if (bin_oper && bin_oper->get_optype() != kOR &&
+        dynamic_cast<const Analyzer::ColumnVar*>(bin_oper->get_left_operand())) {
+      partition_exe_unit.simple_quals.push_back(qual);
+    } else {
+      partition_exe_unit.quals.push_back(qual);
+    }
+  }
+  return partition_exe_unit;
+}
+
+AggregatedPartitions::AggregatedPartitions(
+    const std::vector<TargetInfo>& targets,
+    const std::shared_ptr<RowSetMemoryOwner>& row_set_mem_owner,
+    const Catalog_Namespace::Catalog* catalog,
+    const unsigned block_size,
+    const unsigned grid_size)
+    : row_set_mem_owner_(row_set_mem_owner)
+    , catalog_(catalog)
+    , block_size_(block_size)
+    , grid_size_(grid_size)
+    , row_count_(0)
+    , partition_count_(0) {
+  for (const auto& target_info : targets) {
+    targets_.push_back(get_compact_target_info(target_info));
+    slot_widths_.push_back(get_slot_width(targets_.back().sql_type));
+  }
+  CHECK(!targets_.empty());
+}
+
+void AggregatedPartitions::add(ResultSet& partition_rows) {
+  CHECK_EQ(targets_.size(), partition_rows.colCount());
+  ++partition_count_;
+  const auto entry_count = partition_rows.rowCount();
+  if (!entry_count) {
+    return;
+  }
+  auto rows = allocateResult(entry_count);
+  const auto& query_mem_desc = rows->getQueryMemDesc();
+  const auto buff = rows->getStorage()->getUnderlyingBuffer();
+  const auto index_buff = reinterpret_cast<int64_t*>(buff);
+  std::vector<int8_t*> col_buffs;
+  for (size_t i = 0; i < targets_.size(); ++i) {
+    col_buffs.push_back(buff + query_mem_desc.getColOffInBytes(i));
+  }
+  size_t entry_idx{0};
+  partition_rows.moveToBegin();
+  while (true) {
+    const auto row = partition_rows.getNextRow(false, false);
+    if (row.empty()) {
+      break;
+    }
+    CHECK_EQ(targets_.size(), row.size());
+    CHECK_LT(entry_idx, entry_count);
+    index_buff[entry_idx] = entry_idx;
+    for (size_t i = 0; i < targets_.size(); ++i) {
+      write_slot(
+          col_buffs[i] + entry_idx * slot_widths_[i], row[i], targets_[i].sql_type);
+    }
+    ++entry_idx;
+  }
+  CHECK_EQ(entry_idx, entry_count);
+  if (result_) {
+    result_->append(*rows);
+  } else {
+    result_ = rows;
+  }
+  row_count_ += entry_count;
+  VLOG(1) << "Compacted " << entry_count << " aggregated groups of partition "
+          << partition_count_;
+}
+
+std::shared_ptr<ResultSet> AggregatedPartitions::getResult() {
+  if (!result_) {
+    // the single entry is marked empty, there are no groups at all
+    result_ = allocateResult(1);
+    reinterpret_cast<int64_t*>(result_->getStorage()->getUnderlyingBuffer())[0] =
+        EMPTY_KEY_64;
+  }
+  return result_;
+}
+
+std::shared_ptr<ResultSet> AggregatedPartitions::allocateResult(
+    const size_t entry_count) const {
+  // a columnar projection, the prepended index column tells the entries apart from the
+  // empty one allocated when there are no groups at all
+  QueryMemoryDescriptor query_mem_desc(
+      QueryDescriptionType::Projection, 0, 0, false, {8});
+  for (const auto slot_width : slot_widths_) {
+    query_mem_desc.addColSlotInfo({std::make_tuple(static_cast<int8_t>(slot_width),
+                                                   static_cast<int8_t>(slot_width))});
+  }
+  query_mem_desc.setOutputColumnar(true);
+  query_mem_desc.setEntryCount(entry_count);
+  auto rows = std::make_shared<ResultSet>(targets_,
+                                          ExecutorDeviceType::CPU,
+                                          query_mem_desc,
+                                          row_set_mem_owner_,
+                                          catalog_,
+                                          block_size_,
+                                          grid_size_);
+  rows->allocateStorage();
+  return rows;
+}
+
+}  // namespace out_of_core_aggregation
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    OutOfCoreAggregation.h
+ * @brief   Aggregation of group by queries with more groups than fit the group by
+ *          buffers, in several passes over partitions of the group keys.
+ */
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "QueryEngine/InputMetadata.h"
+#include "QueryEngine/RelAlgExecutionUnit.h"
+#include "QueryEngine/ResultSet.h"
+
+extern bool g_enable_out_of_core_aggregation;
+extern size_t g_out_of_core_aggregation_max_groups;
+
+class Executor;
+
+namespace out_of_core_aggregation {
+
+using PartitionQuals = std::list<std::shared_ptr<Analyzer::Expr>>;
+
+// the group keys are never split more finely than this, whatever the estimates
+constexpr size_t kMaxPartitionCount{1024};
+
+// Whether every target of the unit aggregates to a fixed width value which can be
+// spilled and read back as is, and nothing needs all the groups at once.
+bool is_supported(const RelAlgExecutionUnit& ra_exe_unit);
+
+// The integer group by expression whose value ranges partition the group keys.
+struct PartitionKey {
+  std::shared_ptr<Analyzer::Expr> expr;
+  int64_t min;
+  int64_t max;
+};
+
+// A range of partition key values, end included. The lowest and the highest ranges are
+// open ended, so that values outside of stale metadata ranges are still aggregated
+// exactly once, and the highest range also holds the nulls.
+struct KeyRange {
+  int64_t start;
+  int64_t end;
+  bool is_lowest;
+  bool is_highest;
+};
+
+// The integer group by expression of the unit with the widest range, or nothing if
+// there is no such expression.
+std::optional<PartitionKey> get_partition_key(
+    const RelAlgExecutionUnit& ra_exe_unit,
+    const std::vector<InputTableInfo>& query_infos,
+    const Executor* executor);
+
+// Splits a range in at most |partition_count| disjoint ranges of as many values each.
+// A range of a single value is returned as is.
+std::vector<KeyRange> split_key_range(const KeyRange& range,
+                                      const size_t partition_count);
+
+// The filters selecting the rows whose partition key is in the given range.
+PartitionQuals make_partition_quals(const PartitionKey& partition_key,
+                                    const KeyRange& range);
+
+// The unit restricted to one partition of the group keys.
+RelAlgExecutionUnit add_partition_quals(const RelAlgExecutionUnit& ra_exe_unit,
+                                        const PartitionQuals& partition_quals);
+
+/**
+ * The aggregated partitions of a group by. The groups of every partition are copied to
+ * a columnar buffer of exactly their count, allocated from the owner of the final
+ * result, so that the group by buffers of a partition are released before the next one
+ * is aggregated. Partitions hold disjoint groups, so their buffers are appended to the
+ * final result set as they are, without any further reduction.
+ */
+class AggregatedPartitions {
+ public:
+  AggregatedPartitions(const std::vector<TargetInfo>& targets,
+                       const std::shared_ptr<RowSetMemoryOwner>& row_set_mem_owner,
+                       const Catalog_Namespace::Catalog* catalog,
+                       const unsigned block_size,
+                       const unsigned grid_size);
+
+  // Copies the groups of an aggregated partition.
+  void add(ResultSet& partition_rows);
+
+  // All the groups added so far, in order.
+  std::shared_ptr<ResultSet> getResult();
+
+  size_t getRowCount() const { return row_count_; }
+
+  size_t getPartitionCount() const { return partition_count_; }
+
+ private:
+  std::shared_ptr<ResultSet> allocateResult(const size_t entry_count) const;
+
+  // the finalized targets, AVG is kept as its double value
+  std::vector<TargetInfo> targets_;
+  std::vector<size_t> slot_widths_;
+  std::shared_ptr<RowSetMemoryOwner> row_set_mem_owner_;
+  const Catalog_Namespace::Catalog* catalog_;
+  const unsigned block_size_;
+  const unsigned grid_size_;
+  std::shared_ptr<ResultSet> result_;
+  size_t row_count_;
+  size_t partition_count_;
+};
+
+}  // namespace out_of_core_aggregation
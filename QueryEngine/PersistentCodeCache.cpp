@@ -0,0 +1,247 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/PersistentCodeCache.h"
+
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/Host.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+
+#include "Catalog/SysCatalog.h"
+#include "Logger/Logger.h"
+#include "MapDRelease.h"
+
+bool g_enable_persistent_code_cache{false};
+size_t g_persistent_code_cache_max_size_bytes{size_t(1) << 30};  // 1GB
+
+namespace {
+
+const std::string kObjectFileExtension{".o"};
+
+}  // namespace
+
+std::mutex PersistentCodeCache::udf_module_hashes_mutex_;
+std::array<size_t, 2> PersistentCodeCache::udf_module_hashes_{};
+
+PersistentCodeCache::PersistentCodeCache(const std::string& cache_dir,
+                                         const size_t max_size_bytes)
+    : cache_dir_(cache_dir), max_size_bytes_(max_size_bytes) {}
+
+PersistentCodeCache* PersistentCodeCache::get() {
+  if (!g_enable_persistent_code_cache || g_base_path.empty()) {
+    return nullptr;
+  }
+  static std::unique_ptr<PersistentCodeCache> code_cache;
+  static std::once_flag code_cache_init_flag;
+  std::call_once(code_cache_init_flag, []() {
+    code_cache = std::make_unique<PersistentCodeCache>(
+        g_base_path + "/mapd_code_cache", g_persistent_code_cache_max_size_bytes);
+  });
+  return code_cache.get();
+}
+
+std::string PersistentCodeCache::serializeKey(const CodeCacheKey& key) {
+  std::ostringstream oss;
+  oss << MAPD_RELEASE << '\n'
+      << LLVM_VERSION_STRING << '\n'
+      << llvm::sys::getProcessTriple() << '\n'
+      << llvm::sys::getHostCPUName().str() << '\n';
+  {
+    std::lock_guard<std::mutex> lock(udf_module_hashes_mutex_);
+    for (const auto udf_module_hash : udf_module_hashes_) {
+      oss << udf_module_hash << '\n';
+    }
+  }
+  for (const auto& key_part : key) {
+    oss << key_part.size() << '\n' << key_part;
+  }
+  return oss.str();
+}
+
+void PersistentCodeCache::setUdfModuleIR(const UdfModule udf_module,
+                                         const std::string& module_ir) {
+  std::lock_guard<std::mutex> lock(udf_module_hashes_mutex_);
+  udf_module_hashes_[static_cast<size_t>(udf_module)] =
+      module_ir.empty() ? 0 : boost::hash<std::string>()(module_ir);
+}
+
+std::string PersistentCodeCache::getPath(const std::string& serialized_key) const {
+  std::ostringstream oss;
+  oss << std::hex << std::setw(16) << std::setfill('0')
+      << boost::hash<std::string>()(serialized_key);
+  return cache_dir_ + "/" + oss.str() + kObjectFileExtension;
+}
+
+std::unique_ptr<llvm::MemoryBuffer> PersistentCodeCache::getObject(
+    const std::string& serialized_key) {
+  const auto path = getPath(serialized_key);
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return nullptr;
+  }
+  uint64_t key_size{0};
+  file.read(reinterpret_cast<char*>(&key_size), sizeof(key_size));
+  if (!file || key_size != serialized_key.size()) {
+    return nullptr;
+  }
+  std::string cached_key(key_size, '\0');
+  file.read(&cached_key[0], key_size);
+  if (!file || cached_key != serialized_key) {
+    return nullptr;
+  }
+  const std::string object{std::istreambuf_iterator<char>(file),
+                           std::istreambuf_iterator<char>()};
+  if (object.empty()) {
+    return nullptr;
+  }
+  // the modification time orders the entries for eviction
+  boost::system::error_code ec;
+  boost::filesystem::last_write_time(path, std::time(nullptr), ec);
+  VLOG(1) << "Loaded " << object.size() << " bytes of cached object code from " << path;
+  return llvm::MemoryBuffer::getMemBufferCopy(object);
+}
+
+void PersistentCodeCache::putObject(const std::string& serialized_key,
+                                    llvm::MemoryBufferRef object) {
+  const uint64_t entry_size =
+      sizeof(uint64_t) + serialized_key.size() + object.getBufferSize();
+  if (entry_size > max_size_bytes_) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  boost::system::error_code ec;
+  boost::filesystem::create_directories(cache_dir_, ec);
+  if (ec) {
+    LOG(WARNING) << "Could not create the code cache directory " << cache_dir_ << ": "
+                 << ec.message();
+    return;
+  }
+  initSize();
+  const auto path = getPath(serialized_key);
+  // write to a temporary file first, concurrent readers only ever see complete entries
+  const auto tmp_path = boost::filesystem::unique_path(path + ".%%%%-%%%%").string();
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    const uint64_t key_size = serialized_key.size();
+    file.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    file.write(serialized_key.data(), serialized_key.size());
+    file.write(object.getBufferStart(), object.getBufferSize());
+    if (!file) {
+      LOG(WARNING) << "Could not write the code cache entry " << tmp_path;
+      file.close();
+      boost::filesystem::remove(tmp_path, ec);
+      return;
+    }
+  }
+  const auto replaced_size = boost::filesystem::file_size(path, ec);
+  if (!ec) {
+    *size_bytes_ -= std::min(*size_bytes_, static_cast<size_t>(replaced_size));
+  }
+  boost::filesystem::rename(tmp_path, path, ec);
+  if (ec) {
+    LOG(WARNING) << "Could not add the code cache entry " << path << ": "
+                 << ec.message();
+    boost::filesystem::remove(tmp_path, ec);
+    return;
+  }
+  *size_bytes_ += entry_size;
+  evictToBudget(path);
+}
+
+size_t PersistentCodeCache::getSizeBytes() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  initSize();
+  return *size_bytes_;
+}
+
+void PersistentCodeCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  boost::system::error_code ec;
+  std::vector<boost::filesystem::path> cache_files;
+  for (boost::filesystem::directory_iterator it(cache_dir_, ec), end; !ec && it != end;
+       it.increment(ec)) {
+    if (it->path().extension() == kObjectFileExtension) {
+      cache_files.push_back(it->path());
+    }
+  }
+  for (const auto& path : cache_files) {
+    boost::filesystem::remove(path, ec);
+  }
+  // recomputed from the files that could not be removed, if any
+  size_bytes_.reset();
+  VLOG(1) << "Cleared the code cache " << cache_dir_;
+}
+
+void PersistentCodeCache::initSize() {
+  if (size_bytes_) {
+    return;
+  }
+  size_bytes_ = 0;
+  boost::system::error_code ec;
+  for (boost::filesystem::directory_iterator it(cache_dir_, ec), end; !ec && it != end;
+       it.increment(ec)) {
+    boost::system::error_code file_ec;
+    const auto file_size = boost::filesystem::file_size(it->path(), file_ec);
+    if (!file_ec && it->path().extension() == kObjectFileExtension) {
+      *size_bytes_ += file_size;
+    }
+  }
+}
+
+void PersistentCodeCache::evictToBudget(const std::string& new_entry_path) {
+  CHECK(size_bytes_);
+  if (*size_bytes_ <= max_size_bytes_) {
+    return;
+  }
+  struct CacheFile {
+    std::time_t last_access;
+    boost::filesystem::path path;
+    size_t size;
+  };
+  std::vector<CacheFile> cache_files;
+  boost::system::error_code ec;
+  for (boost::filesystem::directory_iterator it(cache_dir_, ec), end; !ec && it != end;
+       it.increment(ec)) {
+    boost::system::error_code file_ec;
+    const auto last_access = boost::filesystem::last_write_time(it->path(), file_ec);
+    const auto file_size = boost::filesystem::file_size(it->path(), file_ec);
+    if (!file_ec && it->path().extension() == kObjectFileExtension &&
+        it->path() != new_entry_path) {
+      cache_files.push_back({last_access, it->path(), file_size});
+    }
+  }
+  std::sort(cache_files.begin(), cache_files.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.last_access < rhs.last_access;
+  });
+  for (const auto& cache_file : cache_files) {
+    if (*size_bytes_ <= max_size_bytes_) {
+      break;
+    }
+    if (boost::filesystem::remove(cache_file.path, ec) && !ec) {
+      *size_bytes_ -= std::min(*size_bytes_, cache_file.size);
+      VLOG(1) << "Evicted " << cache_file.path << " from the code cache.";
+    }
+  }
+}
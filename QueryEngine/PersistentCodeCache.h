@@ -0,0 +1,116 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    PersistentCodeCache.h
+ * @brief   On-disk cache of the object code generated for CPU queries, which survives
+ *          server restarts.
+ */
+
+#pragma once
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include <array>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include "QueryEngine/CodeCache.h"
+
+extern bool g_enable_persistent_code_cache;
+extern size_t g_persistent_code_cache_max_size_bytes;
+
+/**
+ * Stores one file per compiled module under `<data dir>/mapd_code_cache`. Entries are
+ * keyed on the serialized CodeCacheKey together with the server release, the LLVM
+ * version, the host target and the contents of the linked UDF modules, so that object
+ * code is never reused by a different binary, on a different CPU or with different
+ * UDFs. Every file also holds its full key, a hash collision is
+ * treated as a miss. Files are read on demand and the least recently used ones are
+ * removed once the cache exceeds `g_persistent_code_cache_max_size_bytes`.
+ */
+class PersistentCodeCache {
+ public:
+  PersistentCodeCache(const std::string& cache_dir, const size_t max_size_bytes);
+
+  // Returns the cache under the server data directory, or nullptr when disabled.
+  static PersistentCodeCache* get();
+
+  static std::string serializeKey(const CodeCacheKey& key);
+
+  enum class UdfModule { kLoadTime, kRuntime };
+
+  // Records the IR of a UDF module linked into the generated code, an empty IR string
+  // means the module is not loaded.
+  static void setUdfModuleIR(const UdfModule udf_module, const std::string& module_ir);
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const std::string& serialized_key);
+
+  void putObject(const std::string& serialized_key, llvm::MemoryBufferRef object);
+
+  size_t getSizeBytes();
+
+  // Removes all entries, e.g. once they were compiled against replaced runtime UDFs.
+  void clear();
+
+ private:
+  std::string getPath(const std::string& serialized_key) const;
+
+  // must be called with the mutex held
+  void initSize();
+
+  // must be called with the mutex held, the entry just added is never evicted
+  void evictToBudget(const std::string& new_entry_path);
+
+  const std::string cache_dir_;
+  const size_t max_size_bytes_;
+  std::mutex mutex_;
+  std::optional<size_t> size_bytes_;
+
+  static std::mutex udf_module_hashes_mutex_;
+  static std::array<size_t, 2> udf_module_hashes_;
+};
+
+/**
+ * Adapts the persistent code cache to the MCJIT object cache interface for the
+ * compilation of a single module.
+ */
+class PersistentObjectCache : public llvm::ObjectCache {
+ public:
+  PersistentObjectCache(PersistentCodeCache& code_cache, const CodeCacheKey& key)
+      : code_cache_(code_cache)
+      , serialized_key_(PersistentCodeCache::serializeKey(key))
+      , cached_object_(code_cache_.getObject(serialized_key_)) {}
+
+  // The module doesn't have to be optimized if its object code is cached already.
+  bool hasCachedObject() const { return cached_object_ != nullptr; }
+
+  void notifyObjectCompiled(const llvm::Module*, llvm::MemoryBufferRef object) override {
+    code_cache_.putObject(serialized_key_, object);
+  }
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module*) override {
+    return std::move(cached_object_);
+  }
+
+ private:
+  PersistentCodeCache& code_cache_;
+  const std::string serialized_key_;
+  std::unique_ptr<llvm::MemoryBuffer> cached_object_;
+};
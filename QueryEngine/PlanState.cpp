@@ -32,6 +32,11 @@ bool PlanState::isLazyFetchColumn(const Analyzer::Expr* target_expr) const {
     if (cd->isVirtualCol) {
       return false;
     }
+    // The result set can't decode run length or differential encoded chunks lazily.
+    if (cd->columnType.get_compression() == kENCODING_RL ||
+        cd->columnType.get_compression() == kENCODING_DIFF) {
+      return false;
+    }
   }
   std::set<std::pair<int, int>> intersect;
   std::set_intersection(columns_to_fetch_.begin(),
@@ -16,20 +16,50 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <future>
+#include <map>
 #include <mutex>
-#include <queue>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
+
+#include "Logger/Logger.h"
 
 /**
  * QueryDispatchQueue maintains a list of pending queries and dispatches those queries as
- * Executors become available
+ * Executors become available.
+ *
+ * Pending queries are grouped in flows, one per (user, priority class) pair, and served
+ * in weighted fair queuing order: every query gets a virtual finish time of one unit of
+ * work divided by the weight of its priority class past the last query of its flow, and
+ * the pending query with the earliest virtual finish time is dispatched first. Users
+ * therefore share the executors evenly regardless of how many queries they queue up,
+ * and interactive queries overtake batch queries without starving them.
  */
 class QueryDispatchQueue {
  public:
   using Task = std::packaged_task<void(size_t)>;
 
+  enum class Priority { kInteractive = 0, kNormal, kBatch };
+
+  // upper bounds (in ms) of the queue wait time histogram buckets, the last bucket holds
+  // all the longer waits
+  static constexpr std::array<size_t, 5> kWaitTimeBucketsMs{1, 10, 100, 1000, 10000};
+
+  struct Stats {
+    size_t queue_depth{0};
+    size_t max_queue_depth{0};
+    size_t num_dispatched{0};
+    std::array<size_t, kWaitTimeBucketsMs.size() + 1> wait_time_ms_histogram{};
+  };
+
   QueryDispatchQueue(const size_t parallel_executors_max) {
     workers_.resize(parallel_executors_max);
     for (size_t i = 0; i < workers_.size(); i++) {
@@ -38,12 +68,29 @@ class QueryDispatchQueue {
     }
   }
 
+  static Priority parsePriority(const std::string& priority_str) {
+    if (priority_str == "interactive") {
+      return Priority::kInteractive;
+    }
+    if (priority_str == "normal") {
+      return Priority::kNormal;
+    }
+    if (priority_str == "batch") {
+      return Priority::kBatch;
+    }
+    throw std::runtime_error("Invalid query priority " + priority_str +
+                             ", expected interactive, normal or batch.");
+  }
+
   /**
    * Submit a new task to the queue. Blocks until the task begins execution. The caller is
    * expected to maintain a copy of the shared_ptr which will be used to access results
-   * once the task runs.
+   * once the task runs. Tasks of the same user and priority run in submission order.
    */
-  void submit(std::shared_ptr<Task> task, const bool is_update_delete) {
+  void submit(std::shared_ptr<Task> task,
+              const bool is_update_delete,
+              const std::string& user_name = "",
+              const Priority priority = Priority::kNormal) {
     if (workers_.size() == 1 && is_update_delete) {
       std::lock_guard<decltype(update_delete_mutex_)> update_delete_lock(
           update_delete_mutex_);
@@ -58,12 +105,26 @@ class QueryDispatchQueue {
     }
     std::unique_lock<decltype(queue_mutex_)> lock(queue_mutex_);
 
-    LOG(INFO) << "Dispatching query with " << queue_.size() << " queries in the queue.";
-    queue_.push(task);
+    LOG(INFO) << "Dispatching query with " << queue_depth_ << " queries in the queue.";
+    auto& flow = flows_[std::make_pair(user_name, priority)];
+    flow.last_finish_time =
+        std::max(flow.last_finish_time, virtual_time_) + 1.0 / getWeight(priority);
+    flow.pending.push_back({task,
+                            flow.last_finish_time,
+                            next_sequence_id_++,
+                            std::chrono::steady_clock::now()});
+    ++queue_depth_;
+    stats_.queue_depth = queue_depth_;
+    stats_.max_queue_depth = std::max(stats_.max_queue_depth, queue_depth_);
     lock.unlock();
     cv_.notify_all();
   }
 
+  Stats getStats() {
+    std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
+    return stats_;
+  }
+
   ~QueryDispatchQueue() {
     {
       std::lock_guard<decltype(queue_mutex_)> lock(queue_mutex_);
@@ -76,22 +137,87 @@ class QueryDispatchQueue {
   }
 
  private:
+  using FlowKey = std::pair<std::string, Priority>;
+
+  struct PendingTask {
+    std::shared_ptr<Task> task;
+    double finish_time;
+    size_t sequence_id;
+    std::chrono::steady_clock::time_point enqueue_time;
+  };
+
+  struct Flow {
+    std::deque<PendingTask> pending;
+    double last_finish_time{0};
+  };
+
+  static double getWeight(const Priority priority) {
+    switch (priority) {
+      case Priority::kInteractive:
+        return 4;
+      case Priority::kNormal:
+        return 2;
+      case Priority::kBatch:
+        return 1;
+    }
+    UNREACHABLE();
+    return 1;
+  }
+
+  // must be called with the queue mutex held
+  PendingTask popNextTask() {
+    auto next_flow_it = flows_.end();
+    for (auto flow_it = flows_.begin(); flow_it != flows_.end(); ++flow_it) {
+      CHECK(!flow_it->second.pending.empty());
+      const auto& head = flow_it->second.pending.front();
+      if (next_flow_it == flows_.end()) {
+        next_flow_it = flow_it;
+        continue;
+      }
+      const auto& next_head = next_flow_it->second.pending.front();
+      if (std::make_pair(head.finish_time, head.sequence_id) <
+          std::make_pair(next_head.finish_time, next_head.sequence_id)) {
+        next_flow_it = flow_it;
+      }
+    }
+    CHECK(next_flow_it != flows_.end());
+    auto pending_task = next_flow_it->second.pending.front();
+    next_flow_it->second.pending.pop_front();
+    virtual_time_ = pending_task.finish_time;
+    if (next_flow_it->second.pending.empty()) {
+      // idle flows restart from the current virtual time
+      flows_.erase(next_flow_it);
+    }
+    --queue_depth_;
+
+    const auto wait_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                  std::chrono::steady_clock::now() -
+                                  pending_task.enqueue_time)
+                                  .count();
+    const auto bucket_it = std::lower_bound(kWaitTimeBucketsMs.begin(),
+                                            kWaitTimeBucketsMs.end(),
+                                            static_cast<size_t>(wait_time_ms));
+    ++stats_.wait_time_ms_histogram[bucket_it - kWaitTimeBucketsMs.begin()];
+    ++stats_.num_dispatched;
+    stats_.queue_depth = queue_depth_;
+    return pending_task;
+  }
+
   void worker(const size_t worker_idx) {
     std::unique_lock<std::mutex> lock(queue_mutex_);
     while (true) {
-      cv_.wait(lock, [this] { return !queue_.empty() || threads_should_exit_; });
+      cv_.wait(lock, [this] { return queue_depth_ > 0 || threads_should_exit_; });
 
       if (threads_should_exit_) {
         return;
       }
 
-      if (!queue_.empty()) {
-        auto task = queue_.front();
-        queue_.pop();
+      if (queue_depth_ > 0) {
+        auto task = popNextTask().task;
 
         LOG(INFO) << "Worker " << worker_idx
                   << " running query and returning control. There are now "
-                  << queue_.size() << " queries in the queue.";
+                  << queue_depth_ << " queries in the queue.";
         // allow other threads to pick up tasks
         lock.unlock();
         CHECK(task);
@@ -108,6 +234,10 @@ class QueryDispatchQueue {
   std::mutex update_delete_mutex_;
 
   bool threads_should_exit_{false};
-  std::queue<std::shared_ptr<Task>> queue_;
+  std::map<FlowKey, Flow> flows_;
+  size_t queue_depth_{0};
+  double virtual_time_{0};
+  size_t next_sequence_id_{0};
+  Stats stats_;
   std::vector<std::thread> workers_;
 };
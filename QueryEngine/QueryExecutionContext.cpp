@@ -594,6 +594,7 @@ std::vector<int64_t*> QueryExecutionContext::launchCpuCode(
     const std::vector<std::vector<uint64_t>>& frag_offsets,
     const int32_t scan_limit,
     int32_t* error_code,
+    const bool rowid_lookup,
     const uint32_t num_tables,
     const std::vector<int64_t>& join_hash_tables) {
   auto timer = DEBUG_TIMER(__func__);
@@ -638,7 +639,9 @@ std::vector<int64_t*> QueryExecutionContext::launchCpuCode(
     flatened_frag_offsets.insert(
         flatened_frag_offsets.end(), offsets.begin(), offsets.end());
   }
-  int64_t rowid_lookup_num_rows{*error_code ? *error_code + 1 : 0};
+  // the error code holds the row to start from, the looked up row for a rowid lookup or
+  // the first row of the range a kernel of a split fragment scans
+  int64_t rowid_lookup_num_rows{rowid_lookup && *error_code ? *error_code + 1 : 0};
   auto num_rows_ptr =
       rowid_lookup_num_rows ? &rowid_lookup_num_rows : &flatened_num_rows[0];
   int32_t total_matched_init{0};
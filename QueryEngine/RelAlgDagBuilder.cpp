@@ -2605,6 +2605,39 @@ class RelAlgDispatcher {
 
 }  // namespace details
 
+namespace {
+
+// Returns false if the query calls a function whose value depends on the time or the
+// session the query runs in.
+bool is_deterministic_query(const rapidjson::Value& value) {
+  static const std::unordered_set<std::string> non_deterministic_ops{"NOW",
+                                                                     "CURRENT_DATE",
+                                                                     "CURRENT_TIME",
+                                                                     "CURRENT_TIMESTAMP",
+                                                                     "CURRENT_USER",
+                                                                     "DATETIME"};
+  if (value.IsObject()) {
+    for (auto it = value.MemberBegin(); it != value.MemberEnd(); ++it) {
+      if (std::string(it->name.GetString()) == "op" && it->value.IsString() &&
+          non_deterministic_ops.count(it->value.GetString())) {
+        return false;
+      }
+      if (!is_deterministic_query(it->value)) {
+        return false;
+      }
+    }
+  } else if (value.IsArray()) {
+    for (auto it = value.Begin(); it != value.End(); ++it) {
+      if (!is_deterministic_query(*it)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 RelAlgDagBuilder::RelAlgDagBuilder(const std::string& query_ra,
                                    const Catalog_Namespace::Catalog& cat,
                                    const RenderInfo* render_info)
@@ -2624,6 +2657,12 @@ RelAlgDagBuilder::RelAlgDagBuilder(const std::string& query_ra,
   CHECK(query_ast.IsObject());
   RelAlgNode::resetRelAlgFirstId();
   build(query_ast, *this);
+  if (is_deterministic_query(query_ast)) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    query_ast.Accept(writer);
+    query_plan_key_ = buffer.GetString();
+  }
 }
 
 RelAlgDagBuilder::RelAlgDagBuilder(RelAlgDagBuilder& root_dag_builder,
@@ -1850,6 +1850,13 @@ class RelAlgDagBuilder : public boost::noncopyable {
 
   const RegisteredQueryHint getQueryHints() const { return query_hint_; }
 
+  /**
+   * Returns the normalized relational algebra of the query, which identifies its plan
+   * across executions. Empty if the results of the query depend on when or by whom it
+   * runs (e.g. it calls NOW()) and must not be reused.
+   */
+  const std::string& getQueryPlanKey() const { return query_plan_key_; }
+
   /**
    * Gets all registered subqueries. Only the root DAG can contain subqueries.
    */
@@ -1863,6 +1870,7 @@ class RelAlgDagBuilder : public boost::noncopyable {
   std::vector<std::shared_ptr<RexSubQuery>> subqueries_;
   const RenderInfo* render_info_;
   RegisteredQueryHint query_hint_;
+  std::string query_plan_key_;
 };
 
 using RANodeOutput = std::vector<RexInput>;
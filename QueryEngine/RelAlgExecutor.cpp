@@ -17,6 +17,7 @@
 #include "RelAlgExecutor.h"
 #include "DataMgr/ForeignStorage/ForeignStorageException.h"
 #include "DataMgr/ForeignStorage/MetadataPlaceholder.h"
+#include "ImportExport/GroupCommitMgr.h"
 #include "Parser/ParserNode.h"
 #include "QueryEngine/CalciteDeserializerUtils.h"
 #include "QueryEngine/CardinalityEstimator.h"
@@ -27,6 +28,7 @@
 #include "QueryEngine/ExtensionFunctionsBinding.h"
 #include "QueryEngine/ExternalExecutor.h"
 #include "QueryEngine/FromTableReordering.h"
+#include "QueryEngine/OutOfCoreAggregation.h"
 #include "QueryEngine/QueryPhysicalInputsCollector.h"
 #include "QueryEngine/RangeTableIndexVisitor.h"
 #include "QueryEngine/RelAlgDagBuilder.h"
@@ -44,6 +46,7 @@
 #include <boost/range/adaptor/reversed.hpp>
 
 #include <algorithm>
+#include <deque>
 #include <functional>
 #include <numeric>
 
@@ -153,10 +156,37 @@ void prepare_foreign_table_for_execution(const RelAlgNode& ra_node,
   prepare_string_dictionaries(ra_node, catalog);
 }
 
+// TODO(alex): Once we're fully migrated to the relational algebra model, change
+// the executor interface to use the collation directly and remove this conversion.
+std::list<Analyzer::OrderEntry> get_order_entries(const RelSort* sort) {
+  std::list<Analyzer::OrderEntry> result;
+  for (size_t i = 0; i < sort->collationCount(); ++i) {
+    const auto sort_field = sort->getCollation(i);
+    result.emplace_back(sort_field.getField() + 1,
+                        sort_field.getSortDir() == SortDirection::Descending,
+                        sort_field.getNullsPosition() == NullSortedPosition::First);
+  }
+  return result;
+}
+
 }  // namespace
 
 size_t RelAlgExecutor::getOuterFragmentCount(const CompilationOptions& co,
                                              const ExecutionOptions& eo) {
+  return getOuterFragmentCountImpl(co, eo, nullptr);
+}
+
+size_t RelAlgExecutor::getSortedOuterFragmentCount(
+    const CompilationOptions& co,
+    const ExecutionOptions& eo,
+    std::list<Analyzer::OrderEntry>& order_entries) {
+  return getOuterFragmentCountImpl(co, eo, &order_entries);
+}
+
+size_t RelAlgExecutor::getOuterFragmentCountImpl(
+    const CompilationOptions& co,
+    const ExecutionOptions& eo,
+    std::list<Analyzer::OrderEntry>* order_entries) {
   if (eo.find_push_down_candidates) {
     return 0;
   }
@@ -198,11 +228,23 @@ size_t RelAlgExecutor::getOuterFragmentCount(const CompilationOptions& co,
   auto exec_desc_ptr = ed_seq.getDescriptor(0);
   CHECK(exec_desc_ptr);
   auto& exec_desc = *exec_desc_ptr;
-  const auto body = exec_desc.getBody();
+  auto body = exec_desc.getBody();
   if (body->isNop()) {
     return 0;
   }
 
+  const auto sort = dynamic_cast<const RelSort*>(body);
+  if (order_entries) {
+    // the input of a full sort is split in fragments like any other projection, each
+    // group of fragments is then sorted on its own
+    if (!sort || !sort->collationCount() || sort->getLimit() || sort->getOffset() ||
+        sort->isEmptyResult()) {
+      return 0;
+    }
+    *order_entries = get_order_entries(sort);
+    body = sort->getInput(0);
+  }
+
   const auto project = dynamic_cast<const RelProject*>(body);
   if (project) {
     auto work_unit =
@@ -443,6 +485,20 @@ ExecutionResult RelAlgExecutor::executeRelAlgQueryNoRetry(const CompilationOptio
     return executeRelAlgQueryWithFilterPushDown(
         ed_seq, co, eo, render_info, queue_time_ms);
   }
+  std::optional<ResultSetCacheKey> result_set_cache_key;
+  // the results of a subset of the outer fragments are not keyed apart from the others
+  if (g_enable_result_set_cache && !render_info && !validate_or_explain_query &&
+      !g_cluster && eo.outer_fragment_indices.empty()) {
+    result_set_cache_key = getResultSetCacheKey();
+    if (result_set_cache_key) {
+      auto cached_result = ResultSetCache::instance().get(*result_set_cache_key);
+      if (cached_result) {
+        VLOG(1) << "Returning cached query results.";
+        cached_result->setQueueTime(queue_time_ms);
+        return *cached_result;
+      }
+    }
+  }
   timer_setup.stop();
 
   // Dispatch the subqueries first
@@ -458,7 +514,43 @@ ExecutionResult RelAlgExecutor::executeRelAlgQueryNoRetry(const CompilationOptio
     auto result = ra_executor.executeRelAlgSeq(subquery_seq, co, eo, nullptr, 0);
     subquery->setExecutionResult(std::make_shared<ExecutionResult>(result));
   }
-  return executeRelAlgSeq(ed_seq, co, eo, render_info, queue_time_ms);
+  auto result = executeRelAlgSeq(ed_seq, co, eo, render_info, queue_time_ms);
+  if (result_set_cache_key) {
+    ResultSetCache::instance().put(*result_set_cache_key, result);
+  }
+  return result;
+}
+
+std::optional<ResultSetCacheKey> RelAlgExecutor::getResultSetCacheKey() {
+  CHECK(query_dag_);
+  const auto& query_plan = query_dag_->getQueryPlanKey();
+  if (query_plan.empty()) {
+    return std::nullopt;
+  }
+  auto table_ids = get_physical_table_inputs(&getRootRelAlgNode());
+  for (const auto& subquery : getSubqueries()) {
+    const auto subquery_table_ids = get_physical_table_inputs(subquery->getRelAlg());
+    table_ids.insert(subquery_table_ids.begin(), subquery_table_ids.end());
+  }
+  ResultSetCacheKey key{cat_.getDatabaseId(), query_plan, {}};
+  for (const int table_id : table_ids) {
+    const auto td = cat_.getMetadataForTable(table_id, false);
+    // only the epochs of tables stored on disk track their changes
+    if (!td || td->isTemporaryTable() || td->isForeignTable()) {
+      return std::nullopt;
+    }
+    for (const auto physical_td : cat_.getPhysicalTablesDescriptors(td)) {
+      const auto physical_table_id = physical_td->tableId;
+      key.table_versions.push_back(
+          {physical_table_id,
+           cat_.getDataMgr().getTableEpoch(cat_.getDatabaseId(), physical_table_id),
+           executor_->getTableInfo(physical_table_id).getPhysicalNumTuples()});
+    }
+  }
+  std::sort(key.table_versions.begin(),
+            key.table_versions.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.table_id < rhs.table_id; });
+  return key;
 }
 
 AggregatedColRange RelAlgExecutor::computeColRangesCache() {
@@ -1987,6 +2079,34 @@ std::unique_ptr<WindowFunctionContext> RelAlgExecutor::createWindowFunctionConte
     CHECK_EQ(join_col_elem_count, elem_count);
     context->addOrderColumn(column, order_col.get(), chunks_owner);
   }
+  if (window_function_is_framed_aggregate(window_func) &&
+      !window_func->getArgs().empty()) {
+    auto arg = window_func->getArgs().front();
+    // a cast of a column is applied to the fetched column by the window context
+    const auto arg_cast = std::dynamic_pointer_cast<const Analyzer::UOper>(arg);
+    if (arg_cast && arg_cast->get_optype() == kCAST) {
+      arg = arg_cast->get_own_operand();
+    }
+    const auto arg_col = std::dynamic_pointer_cast<const Analyzer::ColumnVar>(arg);
+    if (!arg_col) {
+      throw std::runtime_error(
+          "Only column arguments or their casts supported for window frames for now");
+    }
+    const int8_t* column;
+    size_t arg_col_elem_count;
+    std::tie(column, arg_col_elem_count) =
+        ColumnFetcher::getOneColumnFragment(executor_,
+                                            *arg_col,
+                                            query_infos.front().info.fragments.front(),
+                                            memory_level,
+                                            0,
+                                            nullptr,
+                                            /*thread_idx=*/0,
+                                            chunks_owner,
+                                            column_cache_map);
+    CHECK_EQ(arg_col_elem_count, elem_count);
+    context->setAggregateArgument(column, arg_col->get_type_info(), chunks_owner);
+  }
   return context;
 }
 
@@ -2493,6 +2613,8 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
   auto data_memory_holder = import_export::fill_missing_columns(&cat_, insert_data);
   const auto table_descriptor = cat_.getMetadataForTable(table_id);
   CHECK(table_descriptor);
+  // so that a failed insert only rolls back its own row
+  import_export::GroupCommitMgr::instance().commitPendingRows(cat_, table_id);
   if (table_descriptor->nShards > 0) {
     auto shard = get_shard_for_key(table_descriptor, cat_, insert_data);
     CHECK(shard);
@@ -2521,19 +2643,6 @@ ExecutionResult RelAlgExecutor::executeSimpleInsert(const Analyzer::Query& query
 
 namespace {
 
-// TODO(alex): Once we're fully migrated to the relational algebra model, change
-// the executor interface to use the collation directly and remove this conversion.
-std::list<Analyzer::OrderEntry> get_order_entries(const RelSort* sort) {
-  std::list<Analyzer::OrderEntry> result;
-  for (size_t i = 0; i < sort->collationCount(); ++i) {
-    const auto sort_field = sort->getCollation(i);
-    result.emplace_back(sort_field.getField() + 1,
-                        sort_field.getSortDir() == SortDirection::Descending,
-                        sort_field.getNullsPosition() == NullSortedPosition::First);
-  }
-  return result;
-}
-
 size_t get_scan_limit(const RelAlgNode* ra, const size_t limit) {
   const auto aggregate = dynamic_cast<const RelAggregate*>(ra);
   if (aggregate) {
@@ -2616,6 +2725,7 @@ ExecutionResult RelAlgExecutor::executeSort(const RelSort* sort,
         eo.running_query_interrupt_freq,
         eo.pending_query_interrupt_freq,
         eo.executor_type,
+        eo.outer_fragment_indices,
     };
 
     groupby_exprs = source_work_unit.exe_unit.groupby_exprs;
@@ -2998,13 +3108,34 @@ ExecutionResult RelAlgExecutor::executeWorkUnit(
     }
   };
 
+  // group bys estimated to have too many groups are aggregated out of core if possible
+  auto execute_with_estimation = [&](const size_t groups_buffer_entry_guess,
+                                     const bool has_ndv_estimation) -> ExecutionResult {
+    if (!render_info && !eo.just_explain && !eo.just_validate) {
+      auto out_of_core_result = executeWorkUnitOutOfCore(ra_exe_unit,
+                                                         work_unit,
+                                                         targets_meta,
+                                                         is_agg,
+                                                         table_infos,
+                                                         co,
+                                                         eo,
+                                                         groups_buffer_entry_guess,
+                                                         queue_time_ms);
+      if (out_of_core_result) {
+        return *out_of_core_result;
+      }
+    }
+    return execute_and_handle_errors(groups_buffer_entry_guess,
+                                     /*has_cardinality_estimation=*/true,
+                                     has_ndv_estimation);
+  };
+
   auto cache_key = ra_exec_unit_desc_for_caching(ra_exe_unit);
   try {
     auto cached_cardinality = executor_->getCachedCardinality(cache_key);
     auto card = cached_cardinality.second;
     if (cached_cardinality.first && card >= 0) {
-      result = execute_and_handle_errors(
-          card, /*has_cardinality_estimation=*/true, /*has_ndv_estimation=*/false);
+      result = execute_with_estimation(card, /*has_ndv_estimation=*/false);
     } else {
       result = execute_and_handle_errors(
           max_groups_buffer_entry_guess,
@@ -3016,7 +3147,7 @@ ExecutionResult RelAlgExecutor::executeWorkUnit(
     auto cached_cardinality = executor_->getCachedCardinality(cache_key);
     auto card = cached_cardinality.second;
     if (cached_cardinality.first && card >= 0) {
-      result = execute_and_handle_errors(card, true, /*has_ndv_estimation=*/true);
+      result = execute_with_estimation(card, /*has_ndv_estimation=*/true);
     } else {
       const auto ndv_groups_estimation =
           getNDVEstimation(work_unit, e.range(), is_agg, co, eo);
@@ -3025,8 +3156,8 @@ ExecutionResult RelAlgExecutor::executeWorkUnit(
                                     : std::min(groups_approx_upper_bound(table_infos),
                                                g_estimator_failure_max_groupby_size);
       CHECK_GT(estimated_groups_buffer_entry_guess, size_t(0));
-      result = execute_and_handle_errors(
-          estimated_groups_buffer_entry_guess, true, /*has_ndv_estimation=*/true);
+      result = execute_with_estimation(estimated_groups_buffer_entry_guess,
+                                       /*has_ndv_estimation=*/true);
       if (!(eo.just_validate || eo.just_explain)) {
         executor_->addToCardinalityCache(cache_key, estimated_groups_buffer_entry_guess);
       }
@@ -3050,6 +3181,138 @@ ExecutionResult RelAlgExecutor::executeWorkUnit(
   return result;
 }
 
+std::optional<ExecutionResult> RelAlgExecutor::executeWorkUnitOutOfCore(
+    const RelAlgExecutionUnit& ra_exe_unit,
+    const WorkUnit& work_unit,
+    const std::vector<TargetMetaInfo>& targets_meta,
+    const bool is_agg,
+    const std::vector<InputTableInfo>& table_infos,
+    const CompilationOptions& co,
+    const ExecutionOptions& eo,
+    const size_t groups_buffer_entry_guess,
+    const int64_t queue_time_ms) {
+  if (!g_enable_out_of_core_aggregation || !g_out_of_core_aggregation_max_groups ||
+      groups_buffer_entry_guess <= g_out_of_core_aggregation_max_groups || !is_agg ||
+      g_cluster || !out_of_core_aggregation::is_supported(ra_exe_unit)) {
+    return std::nullopt;
+  }
+  const auto partition_key =
+      out_of_core_aggregation::get_partition_key(ra_exe_unit, table_infos, executor_);
+  if (!partition_key) {
+    return std::nullopt;
+  }
+  auto get_partition_count = [](const size_t groups) {
+    return std::min((groups + g_out_of_core_aggregation_max_groups - 1) /
+                        g_out_of_core_aggregation_max_groups,
+                    out_of_core_aggregation::kMaxPartitionCount);
+  };
+  // the key ranges still to aggregate, in order, initially split evenly
+  std::deque<out_of_core_aggregation::KeyRange> key_ranges;
+  for (const auto& key_range : out_of_core_aggregation::split_key_range(
+           {partition_key->min, partition_key->max, true, true},
+           get_partition_count(groups_buffer_entry_guess))) {
+    key_ranges.push_back(key_range);
+  }
+  if (key_ranges.size() < 2) {
+    return std::nullopt;
+  }
+  LOG(INFO) << "Aggregating about " << groups_buffer_entry_guess << " groups in at least "
+            << key_ranges.size() << " partitions";
+  auto timer = DEBUG_TIMER(__func__);
+
+  auto row_set_mem_owner = executor_->row_set_mem_owner_;
+  CHECK(row_set_mem_owner);
+  ScopeGuard restore_row_set_mem_owner = [this, row_set_mem_owner] {
+    executor_->row_set_mem_owner_ = row_set_mem_owner;
+  };
+  std::unique_ptr<out_of_core_aggregation::AggregatedPartitions> aggregated_partitions;
+  while (!key_ranges.empty()) {
+    const auto key_range = key_ranges.front();
+    key_ranges.pop_front();
+    const auto partition_exe_unit = out_of_core_aggregation::add_partition_quals(
+        ra_exe_unit,
+        out_of_core_aggregation::make_partition_quals(*partition_key, key_range));
+    // even ranges of key values don't bound the groups of skewed keys, split the ranges
+    // holding too many groups further, as long as the total partition count allows
+    auto partition_groups_buffer_entry_guess =
+        getNDVEstimation({partition_exe_unit, work_unit.body, groups_buffer_entry_guess},
+                         static_cast<int64_t>(groups_buffer_entry_guess),
+                         is_agg,
+                         co,
+                         eo);
+    const auto partition_count = get_partition_count(partition_groups_buffer_entry_guess);
+    const auto total_partition_count = (aggregated_partitions
+                                            ? aggregated_partitions->getPartitionCount()
+                                            : size_t(0)) +
+                                       key_ranges.size() + 1;
+    if (partition_count > 1 && key_range.start < key_range.end &&
+        total_partition_count < out_of_core_aggregation::kMaxPartitionCount) {
+      const auto split_ranges = out_of_core_aggregation::split_key_range(
+          key_range,
+          std::min(partition_count,
+                   out_of_core_aggregation::kMaxPartitionCount - total_partition_count +
+                       1));
+      VLOG(1) << "Splitting the key range [" << key_range.start << ", " << key_range.end
+              << "] with about " << partition_groups_buffer_entry_guess << " groups in "
+              << split_ranges.size() << " ranges";
+      key_ranges.insert(key_ranges.begin(), split_ranges.begin(), split_ranges.end());
+      continue;
+    }
+    // everything allocated while aggregating a partition is released once its groups
+    // are compacted
+    auto partition_mem_owner =
+        row_set_mem_owner->cloneForIntermediateResults(cpu_threads());
+    executor_->row_set_mem_owner_ = partition_mem_owner;
+    partition_groups_buffer_entry_guess =
+        std::max(2 * partition_groups_buffer_entry_guess, size_t(1));
+    ResultSetPtr partition_rows;
+    try {
+      ColumnCacheMap column_cache;
+      partition_rows = executor_->executeWorkUnit(partition_groups_buffer_entry_guess,
+                                                  is_agg,
+                                                  table_infos,
+                                                  partition_exe_unit,
+                                                  co,
+                                                  eo,
+                                                  cat_,
+                                                  nullptr,
+                                                  /*has_cardinality_estimation=*/true,
+                                                  column_cache);
+    } catch (const QueryExecutionError& e) {
+      handlePersistentError(e.getErrorCode());
+      partition_rows = handleOutOfMemoryRetry({partition_exe_unit,
+                                               work_unit.body,
+                                               partition_groups_buffer_entry_guess},
+                                              targets_meta,
+                                              is_agg,
+                                              co,
+                                              eo,
+                                              nullptr,
+                                              e.wasMultifragKernelLaunch(),
+                                              queue_time_ms)
+                           .getRows();
+    }
+    CHECK(partition_rows);
+    if (!aggregated_partitions) {
+      aggregated_partitions =
+          std::make_unique<out_of_core_aggregation::AggregatedPartitions>(
+              partition_rows->getTargetInfos(),
+              row_set_mem_owner,
+              executor_->getCatalog(),
+              executor_->blockSize(),
+              executor_->gridSize());
+    }
+    aggregated_partitions->add(*partition_rows);
+    partition_rows.reset();
+    row_set_mem_owner->adoptStrDictProxies(*partition_mem_owner);
+    executor_->row_set_mem_owner_ = row_set_mem_owner;
+  }
+  CHECK(aggregated_partitions);
+  VLOG(1) << "Aggregated " << aggregated_partitions->getRowCount() << " groups in "
+          << aggregated_partitions->getPartitionCount() << " partitions";
+  return ExecutionResult{aggregated_partitions->getResult(), targets_meta};
+}
+
 std::optional<size_t> RelAlgExecutor::getFilteredCountAll(const WorkUnit& work_unit,
                                                           const bool is_agg,
                                                           const CompilationOptions& co,
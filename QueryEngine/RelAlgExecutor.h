@@ -24,6 +24,7 @@
 #include "QueryEngine/JoinFilterPushDown.h"
 #include "QueryEngine/QueryRewrite.h"
 #include "QueryEngine/RelAlgDagBuilder.h"
+#include "QueryEngine/ResultSetCache.h"
 #include "QueryEngine/SpeculativeTopN.h"
 #include "QueryEngine/StreamingTopN.h"
 #include "Shared/scope.h"
@@ -85,6 +86,13 @@ class RelAlgExecutor : private StorageIOFacility {
 
   size_t getOuterFragmentCount(const CompilationOptions& co, const ExecutionOptions& eo);
 
+  // The outer fragment count of a projection ordered without a limit or an offset,
+  // whose order entries are returned as well, or zero for any other query. Each group
+  // of outer fragments can then be sorted on its own and the sorted results merged.
+  size_t getSortedOuterFragmentCount(const CompilationOptions& co,
+                                     const ExecutionOptions& eo,
+                                     std::list<Analyzer::OrderEntry>& order_entries);
+
   ExecutionResult executeRelAlgQuery(const CompilationOptions& co,
                                      const ExecutionOptions& eo,
                                      const bool just_explain_plan,
@@ -154,11 +162,18 @@ class RelAlgExecutor : private StorageIOFacility {
   void executePostExecutionCallback();
 
  private:
+  size_t getOuterFragmentCountImpl(const CompilationOptions& co,
+                                   const ExecutionOptions& eo,
+                                   std::list<Analyzer::OrderEntry>* order_entries);
+
   ExecutionResult executeRelAlgQueryNoRetry(const CompilationOptions& co,
                                             const ExecutionOptions& eo,
                                             const bool just_explain_plan,
                                             RenderInfo* render_info);
 
+  // Returns nullopt if the results of the query can't be cached.
+  std::optional<ResultSetCacheKey> getResultSetCacheKey();
+
   void executeRelAlgStep(const RaExecutionSequence& seq,
                          const size_t step_idx,
                          const CompilationOptions&,
@@ -300,6 +315,21 @@ class RelAlgExecutor : private StorageIOFacility {
                                          const bool was_multifrag_kernel_launch,
                                          const int64_t queue_time_ms);
 
+  // Aggregates the unit one partition of its group keys at a time, keeping only the
+  // compacted groups of every aggregated partition, if the estimated number of groups
+  // is above g_out_of_core_aggregation_max_groups. Returns nothing if the unit can't be
+  // split.
+  std::optional<ExecutionResult> executeWorkUnitOutOfCore(
+      const RelAlgExecutionUnit& ra_exe_unit,
+      const WorkUnit& work_unit,
+      const std::vector<TargetMetaInfo>& targets_meta,
+      const bool is_agg,
+      const std::vector<InputTableInfo>& table_infos,
+      const CompilationOptions& co,
+      const ExecutionOptions& eo,
+      const size_t groups_buffer_entry_guess,
+      const int64_t queue_time_ms);
+
   // Allows an out of memory error through if CPU retry is enabled. Otherwise, throws an
   // appropriate exception corresponding to the query error code.
   static void handlePersistentError(const int32_t error_code);
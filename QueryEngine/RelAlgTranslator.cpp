@@ -1721,16 +1721,99 @@ bool supported_upper_bound(const RexWindowFunctionOperator* rex_window_function)
   }
 }
 
+int64_t get_frame_offset(const std::shared_ptr<Analyzer::Expr>& offset_expr) {
+  const auto offset_constant =
+      std::dynamic_pointer_cast<const Analyzer::Constant>(offset_expr);
+  if (!offset_constant || offset_constant->get_is_null()) {
+    throw std::runtime_error("Only constant window frame offsets supported");
+  }
+  const auto& offset_ti = offset_constant->get_type_info();
+  int64_t offset{0};
+  switch (offset_ti.get_type()) {
+    case kTINYINT: {
+      offset = offset_constant->get_constval().tinyintval;
+      break;
+    }
+    case kSMALLINT: {
+      offset = offset_constant->get_constval().smallintval;
+      break;
+    }
+    case kINT: {
+      offset = offset_constant->get_constval().intval;
+      break;
+    }
+    case kBIGINT: {
+      offset = offset_constant->get_constval().bigintval;
+      break;
+    }
+    default: {
+      throw std::runtime_error("Only integer window frame offsets supported");
+    }
+  }
+  if (offset < 0) {
+    throw std::runtime_error("Window frame offsets cannot be negative");
+  }
+  return offset;
+}
+
 }  // namespace
 
-std::shared_ptr<Analyzer::Expr> RelAlgTranslator::translateWindowFunction(
-    const RexWindowFunctionOperator* rex_window_function) const {
-  if (!supported_lower_bound(rex_window_function->getLowerBound()) ||
-      !supported_upper_bound(rex_window_function) ||
-      ((rex_window_function->getKind() == SqlWindowFunctionKind::ROW_NUMBER) !=
+Analyzer::WindowFrameBound RelAlgTranslator::translateWindowFrameBound(
+    const RexWindowFunctionOperator::RexWindowBound& window_bound) const {
+  using Type = Analyzer::WindowFrameBound::Type;
+  if (window_bound.unbounded) {
+    CHECK(window_bound.preceding != window_bound.following);
+    const auto type =
+        window_bound.preceding ? Type::UNBOUNDED_PRECEDING : Type::UNBOUNDED_FOLLOWING;
+    return {type, 0};
+  }
+  if (window_bound.is_current_row) {
+    return {Type::CURRENT_ROW, 0};
+  }
+  CHECK(window_bound.offset);
+  CHECK(window_bound.preceding != window_bound.following);
+  return {window_bound.preceding ? Type::PRECEDING : Type::FOLLOWING,
+          get_frame_offset(translateScalarRex(window_bound.offset.get()))};
+}
+
+std::optional<Analyzer::WindowFrame> RelAlgTranslator::translateWindowFrame(
+    const RexWindowFunctionOperator* rex_window_function,
+    const std::vector<std::shared_ptr<Analyzer::Expr>>& order_keys) const {
+  if (supported_lower_bound(rex_window_function->getLowerBound()) &&
+      supported_upper_bound(rex_window_function) &&
+      ((rex_window_function->getKind() == SqlWindowFunctionKind::ROW_NUMBER) ==
        rex_window_function->isRows())) {
+    // the default frame, handled by the generated code
+    return std::nullopt;
+  }
+  // other frames are only supported for aggregates, computed before the projection
+  if (!window_function_is_aggregate(rex_window_function->getKind()) ||
+      order_keys.empty()) {
     throw std::runtime_error("Frame specification not supported");
   }
+  Analyzer::WindowFrame frame{
+      rex_window_function->isRows(),
+      translateWindowFrameBound(rex_window_function->getLowerBound()),
+      translateWindowFrameBound(rex_window_function->getUpperBound())};
+  using Type = Analyzer::WindowFrameBound::Type;
+  const bool has_offset = frame.lower.type == Type::PRECEDING ||
+                          frame.lower.type == Type::FOLLOWING ||
+                          frame.upper.type == Type::PRECEDING ||
+                          frame.upper.type == Type::FOLLOWING;
+  if (!frame.is_rows && has_offset) {
+    if (order_keys.size() != 1) {
+      throw std::runtime_error("RANGE frames with offsets require exactly one order key");
+    }
+    const auto& order_ti = order_keys.front()->get_type_info();
+    if (!order_ti.is_integer() && !order_ti.is_decimal() && !order_ti.is_fp()) {
+      throw std::runtime_error("RANGE frames with offsets require a numeric order key");
+    }
+  }
+  return frame;
+}
+
+std::shared_ptr<Analyzer::Expr> RelAlgTranslator::translateWindowFunction(
+    const RexWindowFunctionOperator* rex_window_function) const {
   std::vector<std::shared_ptr<Analyzer::Expr>> args;
   for (size_t i = 0; i < rex_window_function->size(); ++i) {
     args.push_back(translateScalarRex(rex_window_function->getOperand(i)));
@@ -1743,6 +1826,7 @@ std::shared_ptr<Analyzer::Expr> RelAlgTranslator::translateWindowFunction(
   for (const auto& order_key : rex_window_function->getOrderKeys()) {
     order_keys.push_back(translateScalarRex(order_key.get()));
   }
+  const auto frame = translateWindowFrame(rex_window_function, order_keys);
   auto ti = rex_window_function->getType();
   if (window_function_is_value(rex_window_function->getKind())) {
     CHECK_GE(args.size(), 1u);
@@ -1754,7 +1838,8 @@ std::shared_ptr<Analyzer::Expr> RelAlgTranslator::translateWindowFunction(
       args,
       partition_keys,
       order_keys,
-      translate_collation(rex_window_function->getCollation()));
+      translate_collation(rex_window_function->getCollation()),
+      frame);
 }
 
 Analyzer::ExpressionPtrVector RelAlgTranslator::translateFunctionArgs(
@@ -146,6 +146,13 @@ class RelAlgTranslator {
   std::shared_ptr<Analyzer::Expr> translateWindowFunction(
       const RexWindowFunctionOperator*) const;
 
+  std::optional<Analyzer::WindowFrame> translateWindowFrame(
+      const RexWindowFunctionOperator*,
+      const std::vector<std::shared_ptr<Analyzer::Expr>>& order_keys) const;
+
+  Analyzer::WindowFrameBound translateWindowFrameBound(
+      const RexWindowFunctionOperator::RexWindowBound&) const;
+
   Analyzer::ExpressionPtrVector translateFunctionArgs(const RexFunctionOperator*) const;
 
   std::shared_ptr<Analyzer::Expr> translateUnaryGeoFunction(
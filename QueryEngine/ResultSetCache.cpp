@@ -0,0 +1,138 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QueryEngine/ResultSetCache.h"
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+
+#include "Logger/Logger.h"
+
+bool g_enable_result_set_cache{false};
+size_t g_result_set_cache_max_size_bytes{size_t(1) << 30};  // 1GB
+
+size_t ResultSetCacheKey::hash() const {
+  size_t seed = boost::hash<int>()(db_id);
+  boost::hash_combine(seed, query_plan);
+  for (const auto& table_version : table_versions) {
+    boost::hash_combine(seed, table_version.table_id);
+    boost::hash_combine(seed, table_version.epoch);
+    boost::hash_combine(seed, table_version.tuple_count);
+  }
+  return seed;
+}
+
+ResultSetCache& ResultSetCache::instance() {
+  static ResultSetCache result_set_cache;
+  return result_set_cache;
+}
+
+bool ResultSetCache::isCacheable(const ResultSet& rows) {
+  if (rows.isExplain() || rows.isValidationOnlyRes() || !rows.getRowSetMemOwner()) {
+    return false;
+  }
+  // lazily fetched columns point into chunks pinned in the buffer pool
+  const auto& lazy_fetch_info = rows.getLazyFetchInfo();
+  return std::none_of(lazy_fetch_info.begin(),
+                      lazy_fetch_info.end(),
+                      [](const ColumnLazyFetchInfo& col_lazy_fetch_info) {
+                        return col_lazy_fetch_info.is_lazily_fetched;
+                      });
+}
+
+std::optional<ExecutionResult> ResultSetCache::get(const ResultSetCacheKey& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto range = index_.equal_range(key.hash());
+  for (auto it = range.first; it != range.second; ++it) {
+    auto entry_it = it->second;
+    // a use count of one means no query holds the result set at the moment
+    if (entry_it->key == key && entry_it->result.getRows().use_count() == 1) {
+      ++hits_;
+      lru_.splice(lru_.begin(), lru_, entry_it);
+      entry_it->result.getRows()->moveToBegin();
+      return entry_it->result;
+    }
+  }
+  ++misses_;
+  return std::nullopt;
+}
+
+void ResultSetCache::put(const ResultSetCacheKey& key, const ExecutionResult& result) {
+  const auto& rows = result.getRows();
+  if (!rows || !isCacheable(*rows)) {
+    return;
+  }
+  const auto max_size_bytes = g_result_set_cache_max_size_bytes;
+  const auto entry_size = rows->getRowSetMemOwner()->getAllocatedBytes();
+  if (entry_size > max_size_bytes) {
+    VLOG(1) << "Skipped caching a result set of " << entry_size
+            << " bytes, exceeding the cache budget of " << max_size_bytes << " bytes.";
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto hash = key.hash();
+  const auto range = index_.equal_range(hash);
+  size_t num_replicas{0};
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second->key == key) {
+      if (it->second->result.getRows() == rows ||
+          ++num_replicas >= kMaxReplicasPerKey) {
+        return;
+      }
+    }
+  }
+  lru_.push_front({key, result, entry_size});
+  index_.emplace(hash, lru_.begin());
+  size_bytes_ += entry_size;
+  while (size_bytes_ > max_size_bytes) {
+    CHECK(!lru_.empty());
+    evictEntry(std::prev(lru_.end()));
+  }
+}
+
+void ResultSetCache::clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  VLOG(1) << "Invalidating " << lru_.size() << " cached result sets.";
+  index_.clear();
+  lru_.clear();
+  size_bytes_ = 0;
+}
+
+ResultSetCacheStats ResultSetCache::getStats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ResultSetCacheStats stats;
+  stats.num_entries = lru_.size();
+  stats.size_bytes = size_bytes_;
+  stats.max_size_bytes = g_result_set_cache_max_size_bytes;
+  stats.hits = hits_;
+  stats.misses = misses_;
+  stats.evictions = evictions_;
+  return stats;
+}
+
+void ResultSetCache::evictEntry(EntryList::iterator entry_it) {
+  const auto range = index_.equal_range(entry_it->key.hash());
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second == entry_it) {
+      index_.erase(it);
+      break;
+    }
+  }
+  size_bytes_ -= entry_it->size;
+  ++evictions_;
+  lru_.erase(entry_it);
+}
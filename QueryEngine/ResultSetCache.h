@@ -0,0 +1,123 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    ResultSetCache.h
+ * @brief   Cache of final query results, keyed on the query plan and the versions of
+ *          the tables the query reads.
+ */
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "QueryEngine/Descriptors/RelAlgExecutionDescriptor.h"
+
+extern bool g_enable_result_set_cache;
+extern size_t g_result_set_cache_max_size_bytes;
+
+// Version of a physical table input of a cached query.
+struct ResultSetCacheTableVersion {
+  int table_id;
+  size_t epoch;
+  size_t tuple_count;
+
+  bool operator==(const ResultSetCacheTableVersion& that) const {
+    return table_id == that.table_id && epoch == that.epoch &&
+           tuple_count == that.tuple_count;
+  }
+};
+
+struct ResultSetCacheKey {
+  int db_id;
+  std::string query_plan;  // see RelAlgDagBuilder::getQueryPlanKey
+  std::vector<ResultSetCacheTableVersion> table_versions;  // sorted by table id
+
+  bool operator==(const ResultSetCacheKey& that) const {
+    return db_id == that.db_id && query_plan == that.query_plan &&
+           table_versions == that.table_versions;
+  }
+
+  size_t hash() const;
+};
+
+struct ResultSetCacheStats {
+  size_t num_entries{0};
+  size_t size_bytes{0};
+  size_t max_size_bytes{0};
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
+};
+
+/**
+ * Size-bounded LRU cache of the results of SELECT queries. Inserts change the tuple
+ * count and checkpoints or rollbacks change the epoch of a table, so results computed
+ * from an older version of a table are never returned. Updates, deletes and other
+ * in-place changes clear the cache through the external cache invalidators.
+ *
+ * An entry is charged all the memory held by the RowSetMemoryOwner of its result set,
+ * which the entry keeps alive. Result sets carry an iteration cursor, so a cached result
+ * is only handed out while no other query holds it. Concurrent executions of the same
+ * query cache up to `kMaxReplicasPerKey` copies of the result instead.
+ */
+class ResultSetCache {
+ public:
+  static constexpr size_t kMaxReplicasPerKey{4};
+
+  static ResultSetCache& instance();
+
+  static std::function<void()> getCacheInvalidator() {
+    return []() -> void { instance().clear(); };
+  }
+
+  // Returns true if the result set doesn't reference memory owned by the query.
+  static bool isCacheable(const ResultSet& rows);
+
+  std::optional<ExecutionResult> get(const ResultSetCacheKey& key);
+
+  void put(const ResultSetCacheKey& key, const ExecutionResult& result);
+
+  void clear();
+
+  ResultSetCacheStats getStats();
+
+ private:
+  struct Entry {
+    ResultSetCacheKey key;
+    ExecutionResult result;
+    size_t size;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  // must be called with the mutex held
+  void evictEntry(EntryList::iterator entry_it);
+
+  std::mutex mutex_;
+  EntryList lru_;  // most recently used first
+  std::unordered_multimap<size_t, EntryList::iterator> index_;
+  size_t size_bytes_{0};
+  size_t hits_{0};
+  size_t misses_{0};
+  size_t evictions_{0};
+};
@@ -40,6 +40,8 @@
 
 extern bool g_enable_dynamic_watchdog;
 
+bool g_enable_partitioned_reduction{true};
+
 namespace {
 
 bool use_multithreaded_reduction(const size_t entry_count) {
@@ -375,6 +377,163 @@ void ResultSetStorage::reduce(const ResultSetStorage& that,
   }
 }
 
+// Reduces all the inputs in a single parallel pass. Each worker owns a partition of the
+// group keys across all the inputs: a contiguous range of the entries for perfect hash
+// layouts, where the entry index is the key, and the keys hashing to it for baseline
+// layouts. No two workers ever reduce into the same group, so the aggregates are updated
+// without contention, and the workers are only spawned once for all the inputs instead
+// of once per input. Baseline inputs are first scattered into per worker lists of
+// entries, in parallel as well.
+bool ResultSetStorage::reducePartitioned(
+    const std::vector<const ResultSetStorage*>& that_storages,
+    const ReductionCode& reduction_code) const {
+  if (!g_enable_partitioned_reduction || that_storages.size() < 2) {
+    return false;
+  }
+  const auto query_type = query_mem_desc_.getQueryDescriptionType();
+  if (query_type != QueryDescriptionType::GroupByPerfectHash &&
+      query_type != QueryDescriptionType::GroupByBaselineHash) {
+    return false;
+  }
+  // the reduction interpreter runs under a global lock, it can't be parallelized
+  if (!query_mem_desc_.didOutputColumnar() && !reduction_code.func_ptr) {
+    return false;
+  }
+  size_t total_that_entry_count{0};
+  for (const auto that : that_storages) {
+    CHECK(that->buff_);
+    if (query_type == QueryDescriptionType::GroupByPerfectHash) {
+      CHECK_EQ(query_mem_desc_.getEntryCount(), that->query_mem_desc_.getEntryCount());
+    } else {
+      CHECK_GE(query_mem_desc_.getEntryCount(), that->query_mem_desc_.getEntryCount());
+    }
+    total_that_entry_count += that->query_mem_desc_.getEntryCount();
+  }
+  if (!use_multithreaded_reduction(total_that_entry_count)) {
+    return false;
+  }
+  const size_t worker_count = cpu_threads();
+  CHECK_GT(worker_count, size_t(0));
+  VLOG(1) << "Reducing " << that_storages.size() << " result sets with "
+          << total_that_entry_count << " entries over " << worker_count
+          << " key partitions";
+
+  auto run_workers = [worker_count](const auto& worker) {
+    std::vector<std::future<void>> workers;
+    for (size_t worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
+      workers.emplace_back(std::async(std::launch::async, worker, worker_idx));
+    }
+    for (auto& worker : workers) {
+      worker.wait();
+    }
+    for (auto& worker : workers) {
+      worker.get();
+    }
+  };
+
+  if (query_type == QueryDescriptionType::GroupByPerfectHash) {
+    const auto entry_count = query_mem_desc_.getEntryCount();
+    const auto stride = (entry_count + worker_count - 1) / worker_count;
+    run_workers([this, &that_storages, &reduction_code, entry_count, stride](
+                    const size_t worker_idx) {
+      const auto start_index = std::min(worker_idx * stride, entry_count);
+      const auto end_index = std::min(start_index + stride, entry_count);
+      for (const auto that : that_storages) {
+        if (query_mem_desc_.didOutputColumnar()) {
+          reduceEntriesNoCollisionsColWise(
+              buff_, that->buff_, *that, start_index, end_index, {});
+        } else {
+          run_reduction_code(reduction_code,
+                             buff_,
+                             that->buff_,
+                             start_index,
+                             end_index,
+                             entry_count,
+                             &query_mem_desc_,
+                             &that->query_mem_desc_,
+                             nullptr);
+        }
+      }
+    });
+    return true;
+  }
+
+  // scatter the non-empty input entries to the worker owning their key, every scanning
+  // worker takes an equal share of the entries of all the inputs
+  struct EntryRef {
+    uint32_t storage_idx;
+    uint32_t entry_idx;
+  };
+  std::vector<std::vector<std::vector<EntryRef>>> partitions(
+      worker_count, std::vector<std::vector<EntryRef>>(worker_count));
+  const auto scan_stride = (total_that_entry_count + worker_count - 1) / worker_count;
+  run_workers([&that_storages, &partitions, scan_stride, worker_count](
+                  const size_t worker_idx) {
+    auto& worker_partitions = partitions[worker_idx];
+    const auto scan_start = worker_idx * scan_stride;
+    const auto scan_end = scan_start + scan_stride;
+    size_t storage_start{0};
+    for (size_t storage_idx = 0; storage_idx < that_storages.size(); ++storage_idx) {
+      const auto that = that_storages[storage_idx];
+      const auto that_entry_count = that->query_mem_desc_.getEntryCount();
+      const auto begin = std::max(scan_start, storage_start);
+      const auto end = std::min(scan_end, storage_start + that_entry_count);
+      for (size_t idx = begin; idx < end; ++idx) {
+        const auto entry_idx = idx - storage_start;
+        if (that->isEmptyEntry(entry_idx)) {
+          continue;
+        }
+        worker_partitions[that->getEntryKeyHash(entry_idx) % worker_count].push_back(
+            {static_cast<uint32_t>(storage_idx), static_cast<uint32_t>(entry_idx)});
+      }
+      storage_start += that_entry_count;
+    }
+  });
+  run_workers([this, &that_storages, &partitions, &reduction_code](
+                  const size_t worker_idx) {
+    for (const auto& worker_partitions : partitions) {
+      for (const auto& entry_ref : worker_partitions[worker_idx]) {
+        const auto that = that_storages[entry_ref.storage_idx];
+        const auto that_entry_count = that->query_mem_desc_.getEntryCount();
+        if (query_mem_desc_.didOutputColumnar()) {
+          reduceOneEntryBaseline(
+              buff_, that->buff_, entry_ref.entry_idx, that_entry_count, *that);
+        } else {
+          run_reduction_code(reduction_code,
+                             buff_,
+                             that->buff_,
+                             entry_ref.entry_idx,
+                             entry_ref.entry_idx + 1,
+                             that_entry_count,
+                             &query_mem_desc_,
+                             &that->query_mem_desc_,
+                             nullptr);
+        }
+      }
+    }
+  });
+  return true;
+}
+
+// Hash of the group key of a baseline layout entry, only used to partition the keys
+// between the reduction workers.
+uint32_t ResultSetStorage::getEntryKeyHash(const size_t entry_idx) const {
+  CHECK(query_mem_desc_.getQueryDescriptionType() ==
+        QueryDescriptionType::GroupByBaselineHash);
+  const auto key_count = query_mem_desc_.getGroupbyColCount();
+  if (query_mem_desc_.didOutputColumnar()) {
+    const auto buff_i64 = reinterpret_cast<const int64_t*>(buff_);
+    const auto key = make_key(&buff_i64[key_offset_colwise(entry_idx, 0, true)],
+                              query_mem_desc_.getEntryCount(),
+                              key_count);
+    return key_hash(&key[0], key_count, sizeof(int64_t));
+  }
+  const auto row_ptr = buff_ + entry_idx * get_row_bytes(query_mem_desc_);
+  return key_hash(reinterpret_cast<const int64_t*>(row_ptr),
+                  key_count,
+                  query_mem_desc_.getEffectiveKeyWidth());
+}
+
 namespace {
 
 ALWAYS_INLINE void check_watchdog() {
@@ -1107,6 +1266,16 @@ ResultSet* ResultSetManager::reduce(std::vector<ResultSet*>& result_sets) {
                                       result_rs->getTargetInfos(),
                                       result_rs->getTargetInitVals());
   auto reduction_code = reduction_jit.codegen();
+  if (serialized_varlen_buffer.empty()) {
+    std::vector<const ResultSetStorage*> that_storages;
+    for (auto result_it = result_sets.begin() + 1; result_it != result_sets.end();
+         ++result_it) {
+      that_storages.push_back((*result_it)->storage_.get());
+    }
+    if (result->reducePartitioned(that_storages, reduction_code)) {
+      return result_rs;
+    }
+  }
   size_t ctr = 1;
   for (auto result_it = result_sets.begin() + 1; result_it != result_sets.end();
        ++result_it) {
@@ -100,6 +100,11 @@ class ResultSetStorage {
               const std::vector<std::string>& serialized_varlen_buffer,
               const ReductionCode& reduction_code) const;
 
+  // Reduces all of that_storages at once, see the definition. Returns false without
+  // touching any storage if the layout or the sizes don't allow it.
+  bool reducePartitioned(const std::vector<const ResultSetStorage*>& that_storages,
+                         const ReductionCode& reduction_code) const;
+
   void rewriteAggregateBufferOffsets(
       const std::vector<std::string>& serialized_varlen_buffer) const;
 
@@ -155,6 +160,8 @@ class ResultSetStorage {
   bool isEmptyEntry(const size_t entry_idx) const;
   bool isEmptyEntryColumnar(const size_t entry_idx, const int8_t* buff) const;
 
+  uint32_t getEntryKeyHash(const size_t entry_idx) const;
+
   void reduceOneEntryBaseline(int8_t* this_buff,
                               const int8_t* that_buff,
                               const size_t i,
@@ -175,6 +175,9 @@ std::string ScalarExprToSql::visitWindowFunction(
       result += " ORDER BY " + boost::algorithm::join(order_strs, ",");
     }
   }
+  if (window_func->getFrame()) {
+    result += " " + window_func->getFrame()->toString();
+  }
   result += ")";
   return result;
 }
@@ -46,19 +46,26 @@
   destroyed (when leaving launchCpuCode). The buffers of output
   columns are now owned by the ResultSet instance.
 
+  The singleton is per thread, so that partitionable table functions
+  can run one instance per row range concurrently, each with its own
+  memory manager. The outputs of the instances are concatenated into
+  the buffers of a final memory manager allocated with
+  `allocate_query_buffers`.
+
 */
 
 struct QueryOutputBufferMemoryManager {
   std::unique_ptr<QueryMemoryInitializer> query_buffers;
 
   /*
-    QueryOutputBufferMemoryManager is a dynamic singleton:
-    `get_singleton()` returns a pointer to the singleton instance when
-    in the scope of QueryOutputBufferMemoryManager life-time,
-    otherwise returns nullptr. For internal usage.
+    QueryOutputBufferMemoryManager is a dynamic, thread local
+    singleton: `get_singleton()` returns a pointer to the singleton
+    instance when in the scope of QueryOutputBufferMemoryManager
+    life-time on the calling thread, otherwise returns nullptr. For
+    internal usage.
   */
   static QueryOutputBufferMemoryManager*& get_singleton() {
-    static QueryOutputBufferMemoryManager* instance = nullptr;
+    static thread_local QueryOutputBufferMemoryManager* instance = nullptr;
     return instance;
   }
 
@@ -98,7 +105,39 @@ struct QueryOutputBufferMemoryManager {
     output_column_ptrs[index] = ptr;
   }
 
+  // Return the pointer to the buffer of the index-th output column
+  int64_t* get_output_column_buffer(size_t index) const {
+    CHECK_LT(index, get_ncols());
+    return output_col_buf_ptrs[index];
+  }
+
   void allocate_output_buffers(int64_t output_num_rows) {
+    allocate_query_buffers(output_num_rows);
+
+    // The members layout of Column must match with Column defined in
+    // OmniSciTypes.h
+    struct Column {
+      int8_t* ptr;
+      int64_t size;
+      // just for debugging:
+      std::string toString() const {
+        return "Column{" + ::toString(ptr) + ", " + ::toString(size) + "}";
+      }
+    };
+
+    for (size_t i = 0; i < get_ncols(); i++) {
+      Column* col = reinterpret_cast<Column*>(output_column_ptrs[i]);
+      CHECK(col);
+      // set the members of output Column instances:
+      col->ptr = reinterpret_cast<int8_t*>(output_col_buf_ptrs[i]);
+      col->size = output_num_rows_;
+    }
+  }
+
+  // Allocate the buffers of output columns without updating output
+  // Column instances, used when the outputs are not produced by a
+  // table function call.
+  void allocate_query_buffers(int64_t output_num_rows) {
     CHECK_EQ(output_num_rows_, 0);  // re-allocation of output buffers is not supported
     output_num_rows_ = output_num_rows;
     auto num_out_columns = get_ncols();
@@ -125,27 +164,11 @@ struct QueryOutputBufferMemoryManager {
         nullptr,
         executor_);
 
-    // The members layout of Column must match with Column defined in
-    // OmniSciTypes.h
-    struct Column {
-      int8_t* ptr;
-      int64_t size;
-      // just for debugging:
-      std::string toString() const {
-        return "Column{" + ::toString(ptr) + ", " + ::toString(size) + "}";
-      }
-    };
-
     auto group_by_buffers_ptr = query_buffers->getGroupByBuffersPtr();
     CHECK(group_by_buffers_ptr);
     auto output_buffers_ptr = reinterpret_cast<int64_t*>(group_by_buffers_ptr[0]);
     for (size_t i = 0; i < num_out_columns; i++) {
-      Column* col = reinterpret_cast<Column*>(output_column_ptrs[i]);
-      CHECK(col);
       output_col_buf_ptrs[i] = output_buffers_ptr + i * output_num_rows_;
-      // set the members of output Column instances:
-      col->ptr = reinterpret_cast<int8_t*>(output_col_buf_ptrs[i]);
-      col->size = output_num_rows_;
     }
   }
 
@@ -23,6 +23,10 @@
 #include "QueryEngine/TableFunctions/QueryOutputBufferMemoryManager.h"
 #include "QueryEngine/TableFunctions/TableFunctionCompilationContext.h"
 #include "Shared/funcannotations.h"
+#include "Shared/thread_count.h"
+#include "Shared/threadpool.h"
+
+extern size_t g_table_function_partition_min_rows;
 
 namespace {
 
@@ -75,6 +79,76 @@ size_t get_output_row_count(const TableFunctionExecutionUnit& exe_unit,
   return allocated_output_row_count;
 }
 
+// Number of row ranges to run a partitionable table function over concurrently. Inputs
+// with column lists or with columns of different sizes are not partitioned.
+size_t get_cpu_partition_count(const TableFunctionExecutionUnit& exe_unit,
+                               const std::vector<int64_t>& col_sizes,
+                               const std::vector<size_t>& col_elem_sizes,
+                               const size_t elem_count) {
+  const auto& table_func = exe_unit.table_func;
+  if (!g_table_function_partition_min_rows || !table_func.isPartitionable() ||
+      !(table_func.hasUserSpecifiedOutputSizeMultiplier() ||
+        table_func.hasTableFunctionSpecifiedParameter())) {
+    return 1;
+  }
+  CHECK_EQ(col_sizes.size(), col_elem_sizes.size());
+  for (size_t i = 0; i < col_sizes.size(); ++i) {
+    if (col_sizes[i] &&
+        (!col_elem_sizes[i] || static_cast<size_t>(col_sizes[i]) != elem_count)) {
+      return 1;
+    }
+  }
+  return std::max(std::min(static_cast<size_t>(cpu_threads()),
+                           elem_count / g_table_function_partition_min_rows),
+                  size_t(1));
+}
+
+// Calls the table function over the given input columns, with the output columns
+// allocated through mgr, and returns the number of output rows.
+int64_t call_cpu_table_function(
+    const TableFunctionExecutionUnit& exe_unit,
+    const TableFunctionCompilationContext* compilation_context,
+    std::vector<const int8_t*>& col_buf_ptrs,
+    std::vector<int64_t>& col_sizes,
+    const size_t elem_count,
+    QueryOutputBufferMemoryManager* mgr) {
+  int64_t output_row_count = 0;
+
+  if (!exe_unit.table_func.hasTableFunctionSpecifiedParameter()) {
+    // allocate output buffers because the size is defined by the size
+    // of input buffers
+    output_row_count = get_output_row_count(exe_unit, elem_count);
+  }
+
+  // setup the inputs
+  const auto byte_stream_ptr = reinterpret_cast<const int8_t**>(col_buf_ptrs.data());
+  CHECK(byte_stream_ptr);
+
+  // execute
+  const auto err =
+      compilation_context->getFuncPtr()(byte_stream_ptr,   // input columns buffer
+                                        col_sizes.data(),  // input column sizes
+                                        nullptr,
+                                        &output_row_count);
+
+  if (err) {
+    throw std::runtime_error("Error executing table function: " + std::to_string(err));
+  }
+  if (exe_unit.table_func.hasNonUserSpecifiedOutputSizeConstant()) {
+    if (static_cast<size_t>(output_row_count) != mgr->get_nrows()) {
+      throw std::runtime_error(
+          "Table function with constant sizing parameter must return " +
+          std::to_string(mgr->get_nrows()) + " (got " + std::to_string(output_row_count) +
+          ")");
+    }
+  } else {
+    if (output_row_count < 0 || (size_t)output_row_count > mgr->get_nrows()) {
+      output_row_count = mgr->get_nrows();
+    }
+  }
+  return output_row_count;
+}
+
 }  // namespace
 
 ResultSetPtr TableFunctionExecutionContext::execute(
@@ -96,6 +170,8 @@ ResultSetPtr TableFunctionExecutionContext::execute(
   }
   std::vector<const int8_t*> col_buf_ptrs;
   std::vector<int64_t> col_sizes;
+  // Element width of plain input columns, zero for column lists and literals
+  std::vector<size_t> col_elem_sizes;
   std::optional<size_t> output_column_size;
 
   int col_index = -1;
@@ -144,14 +220,17 @@ ResultSetPtr TableFunctionExecutionContext::execute(
         }
         // columns in the same column_list point to column_list data
         col_buf_ptrs.push_back((const int8_t*)col_list_bufs.back().data());
+        col_elem_sizes.push_back(0);
       } else {
         col_buf_ptrs.push_back(col_buf);
+        col_elem_sizes.push_back(ti.get_size());
       }
       col_sizes.push_back(buf_elem_count);
     } else if (const auto& constant_val = dynamic_cast<Analyzer::Constant*>(input_expr)) {
       // TODO(adb): Unify literal handling with rest of system, either in Codegen or as a
       // separate serialization component
       col_sizes.push_back(0);
+      col_elem_sizes.push_back(0);
       const auto const_val_datum = constant_val->get_constval();
       const auto& ti = constant_val->get_type_info();
       if (ti.is_fp()) {
@@ -210,13 +289,26 @@ ResultSetPtr TableFunctionExecutionContext::execute(
   CHECK_EQ(col_sizes.size(), exe_unit.input_exprs.size());
   CHECK(output_column_size);
   switch (device_type) {
-    case ExecutorDeviceType::CPU:
+    case ExecutorDeviceType::CPU: {
+      const auto partition_count = get_cpu_partition_count(
+          exe_unit, col_sizes, col_elem_sizes, *output_column_size);
+      if (partition_count > 1) {
+        return launchPartitionedCpuCode(exe_unit,
+                                        compilation_context,
+                                        col_buf_ptrs,
+                                        col_sizes,
+                                        col_elem_sizes,
+                                        *output_column_size,
+                                        partition_count,
+                                        executor);
+      }
       return launchCpuCode(exe_unit,
                            compilation_context,
                            col_buf_ptrs,
                            col_sizes,
                            *output_column_size,
                            executor);
+    }
     case ExecutorDeviceType::GPU:
       return launchGpuCode(exe_unit,
                            compilation_context,
@@ -237,45 +329,14 @@ ResultSetPtr TableFunctionExecutionContext::launchCpuCode(
     std::vector<int64_t>& col_sizes,
     const size_t elem_count,
     Executor* executor) {
-  int64_t output_row_count = 0;
-
   // mgr will allocate output buffers on output column resize
   auto mgr = std::make_unique<QueryOutputBufferMemoryManager>(
       exe_unit, executor, col_buf_ptrs, row_set_mem_owner_);
 
-  if (!exe_unit.table_func.hasTableFunctionSpecifiedParameter()) {
-    // allocate output buffers because the size is defined by the size
-    // of input buffers
-    output_row_count = get_output_row_count(exe_unit, elem_count);
-  }
-
-  // setup the inputs
-  const auto byte_stream_ptr = reinterpret_cast<const int8_t**>(col_buf_ptrs.data());
-  CHECK(byte_stream_ptr);
-
-  // execute
   auto timer = DEBUG_TIMER(__func__);
-  const auto err =
-      compilation_context->getFuncPtr()(byte_stream_ptr,   // input columns buffer
-                                        col_sizes.data(),  // input column sizes
-                                        nullptr,
-                                        &output_row_count);
+  const auto output_row_count = call_cpu_table_function(
+      exe_unit, compilation_context, col_buf_ptrs, col_sizes, elem_count, mgr.get());
 
-  if (err) {
-    throw std::runtime_error("Error executing table function: " + std::to_string(err));
-  }
-  if (exe_unit.table_func.hasNonUserSpecifiedOutputSizeConstant()) {
-    if (static_cast<size_t>(output_row_count) != mgr->get_nrows()) {
-      throw std::runtime_error(
-          "Table function with constant sizing parameter must return " +
-          std::to_string(mgr->get_nrows()) + " (got " + std::to_string(output_row_count) +
-          ")");
-    }
-  } else {
-    if (output_row_count < 0 || (size_t)output_row_count > mgr->get_nrows()) {
-      output_row_count = mgr->get_nrows();
-    }
-  }
   // Update entry count, it may differ from allocated mem size
   mgr->query_buffers->getResultSet(0)->updateStorageEntryCount(output_row_count);
 
@@ -301,6 +362,88 @@ ResultSetPtr TableFunctionExecutionContext::launchCpuCode(
   return mgr->query_buffers->getResultSetOwned(0);
 }
 
+ResultSetPtr TableFunctionExecutionContext::launchPartitionedCpuCode(
+    const TableFunctionExecutionUnit& exe_unit,
+    const TableFunctionCompilationContext* compilation_context,
+    std::vector<const int8_t*>& col_buf_ptrs,
+    std::vector<int64_t>& col_sizes,
+    const std::vector<size_t>& col_elem_sizes,
+    const size_t elem_count,
+    const size_t partition_count,
+    Executor* executor) {
+  auto timer = DEBUG_TIMER(__func__);
+  struct PartitionOutput {
+    // Owns the output buffers of the partition until they are concatenated
+    std::unique_ptr<QueryMemoryInitializer> query_buffers;
+    std::vector<const int64_t*> column_buffers;
+    int64_t row_count{0};
+  };
+  const auto num_out_columns = exe_unit.target_exprs.size();
+  std::vector<PartitionOutput> outputs(partition_count);
+  // Every instance runs on its own thread, so that it gets its own (thread local)
+  // output buffer memory manager.
+  const auto run_partition = [&](const size_t partition_idx) {
+    const size_t begin = partition_idx * elem_count / partition_count;
+    const size_t end = (partition_idx + 1) * elem_count / partition_count;
+    auto partition_col_buf_ptrs = col_buf_ptrs;
+    auto partition_col_sizes = col_sizes;
+    for (size_t i = 0; i < col_buf_ptrs.size(); ++i) {
+      if (col_sizes[i]) {
+        partition_col_buf_ptrs[i] += begin * col_elem_sizes[i];
+        partition_col_sizes[i] = end - begin;
+      }
+    }
+    auto mgr = std::make_unique<QueryOutputBufferMemoryManager>(
+        exe_unit, executor, partition_col_buf_ptrs, row_set_mem_owner_);
+    auto& output = outputs[partition_idx];
+    output.row_count = call_cpu_table_function(exe_unit,
+                                               compilation_context,
+                                               partition_col_buf_ptrs,
+                                               partition_col_sizes,
+                                               end - begin,
+                                               mgr.get());
+    for (size_t i = 0; i < num_out_columns; ++i) {
+      output.column_buffers.push_back(mgr->get_output_column_buffer(i));
+    }
+    output.query_buffers = std::move(mgr->query_buffers);
+  };
+  threadpool::ThreadPool<void> thread_pool;
+  for (size_t partition_idx = 0; partition_idx < partition_count; ++partition_idx) {
+    thread_pool.spawn(run_partition, partition_idx);
+  }
+  thread_pool.join();
+
+  // Concatenate the outputs of the partitions. Table functions write the values of an
+  // output column unpadded, at the width of the column type (e.g. 4 bytes for dictionary
+  // encoded text), from the start of the column buffer.
+  int64_t output_row_count = 0;
+  for (const auto& output : outputs) {
+    output_row_count += output.row_count;
+  }
+  std::vector<size_t> out_col_widths;
+  for (const auto target_expr : exe_unit.target_exprs) {
+    const auto col_width = target_expr->get_type_info().get_size();
+    CHECK_GT(col_width, 0);
+    CHECK_LE(col_width, static_cast<int>(sizeof(int64_t)));
+    out_col_widths.push_back(col_width);
+  }
+  auto mgr = std::make_unique<QueryOutputBufferMemoryManager>(
+      exe_unit, executor, col_buf_ptrs, row_set_mem_owner_);
+  mgr->allocate_query_buffers(std::max(output_row_count, int64_t(1)));
+  int64_t row_offset = 0;
+  for (const auto& output : outputs) {
+    for (size_t i = 0; i < num_out_columns; ++i) {
+      std::memcpy(reinterpret_cast<int8_t*>(mgr->get_output_column_buffer(i)) +
+                      row_offset * out_col_widths[i],
+                  output.column_buffers[i],
+                  output.row_count * out_col_widths[i]);
+    }
+    row_offset += output.row_count;
+  }
+  mgr->query_buffers->getResultSet(0)->updateStorageEntryCount(output_row_count);
+  return mgr->query_buffers->getResultSetOwned(0);
+}
+
 namespace {
 enum {
   ERROR_BUFFER,
@@ -48,6 +48,17 @@ class TableFunctionExecutionContext {
                              std::vector<int64_t>& col_sizes,
                              const size_t elem_count,
                              Executor* executor);
+  // Runs a partitionable table function concurrently over partition_count consecutive
+  // row ranges of the input columns and concatenates the outputs.
+  ResultSetPtr launchPartitionedCpuCode(
+      const TableFunctionExecutionUnit& exe_unit,
+      const TableFunctionCompilationContext* compilation_context,
+      std::vector<const int8_t*>& col_buf_ptrs,
+      std::vector<int64_t>& col_sizes,
+      const std::vector<size_t>& col_elem_sizes,
+      const size_t elem_count,
+      const size_t partition_count,
+      Executor* executor);
   ResultSetPtr launchGpuCode(const TableFunctionExecutionUnit& exe_unit,
                              const TableFunctionCompilationContext* compilation_context,
                              std::vector<const int8_t*>& col_buf_ptrs,
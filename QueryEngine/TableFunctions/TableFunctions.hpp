@@ -19,8 +19,8 @@
 
 // clang-format off
 /*
-  UDTF: row_copier(Column<double>, RowMultiplier) -> Column<double>
-  UDTF: row_copier_text(Column<TextEncodingDict>, RowMultiplier) -> Column<TextEncodingDict>
+  UDTF: row_copier(Column<double>, RowMultiplier) -> Column<double> | partitionable
+  UDTF: row_copier_text(Column<TextEncodingDict>, RowMultiplier) -> Column<TextEncodingDict> | partitionable
 */
 // clang-format on
 EXTENSION_NOINLINE int32_t row_copier(const Column<double>& input_col,
@@ -85,9 +85,11 @@ EXTENSION_NOINLINE int32_t row_copier_text(const Column<TextEncodingDict>& input
   return output_row_count;
 }
 
+// clang-format off
 /*
-  UDTF: row_adder(RowMultiplier<1>, Cursor<ColumnDouble, ColumnDouble>) -> ColumnDouble
+  UDTF: row_adder(RowMultiplier<1>, Cursor<ColumnDouble, ColumnDouble>) -> ColumnDouble | partitionable
 */
+// clang-format on
 EXTENSION_NOINLINE int32_t row_adder(const int copy_multiplier,
                                      const Column<double>& input_col1,
                                      const Column<double>& input_col2,
@@ -126,7 +128,7 @@ EXTENSION_NOINLINE int32_t row_adder(const int copy_multiplier,
 
 // clang-format off
 /*
-  UDTF: row_addsub(RowMultiplier, Cursor<double, double>) -> Column<double>, Column<double>
+  UDTF: row_addsub(RowMultiplier, Cursor<double, double>) -> Column<double>, Column<double> | partitionable
 */
 // clang-format on
 EXTENSION_NOINLINE int32_t row_addsub(const int copy_multiplier,
@@ -86,6 +86,13 @@
     run-time function. Run-time functions can be overwitten or removed
     by users. Load-time functions cannot be redefined in run-time.
 
+  - a boolean flag specifying the table function is partitionable,
+    that is, calling it on consecutive row ranges of its input columns
+    and concatenating the outputs gives a valid result for the whole
+    input. Partitionable functions with a RowMultiplier or
+    TableFunctionSpecifiedParameter sizer are executed concurrently
+    over row ranges of large inputs on CPU.
+
   Future notes:
 
   - introduce a list of output column names. Currently, the names of
@@ -127,13 +134,15 @@ class TableFunction {
                 const std::vector<ExtArgumentType>& input_args,
                 const std::vector<ExtArgumentType>& output_args,
                 const std::vector<ExtArgumentType>& sql_args,
-                bool is_runtime)
+                bool is_runtime,
+                bool is_partitionable = false)
       : name_(name)
       , output_sizer_(output_sizer)
       , input_args_(input_args)
       , output_args_(output_args)
       , sql_args_(sql_args)
-      , is_runtime_(is_runtime) {}
+      , is_runtime_(is_runtime)
+      , is_partitionable_(is_partitionable) {}
 
   std::vector<ExtArgumentType> getArgs(const bool ensure_column = false) const {
     std::vector<ExtArgumentType> args;
@@ -214,6 +223,8 @@ class TableFunction {
 
   bool isRuntime() const { return is_runtime_; }
 
+  bool isPartitionable() const { return is_partitionable_; }
+
   inline bool isGPU() const {
     return (name_.find("_cpu_", name_.find("__")) == std::string::npos);
   }
@@ -235,6 +246,8 @@ class TableFunction {
     result += "], sql_args=[";
     result += ExtensionFunctionsWhitelist::toString(sql_args_);
     result += "], is_runtime=" + std::string((is_runtime_ ? "true" : "false"));
+    result +=
+        ", is_partitionable=" + std::string((is_partitionable_ ? "true" : "false"));
     result += ", sizer=" + ::toString(output_sizer_);
     result += ")";
     return result;
@@ -256,6 +269,7 @@ class TableFunction {
   const std::vector<ExtArgumentType> output_args_;
   const std::vector<ExtArgumentType> sql_args_;
   const bool is_runtime_;
+  const bool is_partitionable_;
 };
 
 class TableFunctionsFactory {
@@ -265,7 +279,8 @@ class TableFunctionsFactory {
                   const std::vector<ExtArgumentType>& input_args,
                   const std::vector<ExtArgumentType>& output_args,
                   const std::vector<ExtArgumentType>& sql_args,
-                  bool is_runtime = false);
+                  bool is_runtime = false,
+                  bool is_partitionable = false);
 
   static std::vector<TableFunction> get_table_funcs(const std::string& name,
                                                     const bool is_gpu);
@@ -20,12 +20,21 @@
 #include "LockMgr/LockMgr.h"
 #include "Logger/Logger.h"
 #include "QueryEngine/Execute.h"
+#include "QueryEngine/ExternalCacheInvalidators.h"
 #include "Shared/misc.h"
 #include "Shared/scope.h"
 
 // By default, when rows are deleted, vacuum fragments with a least 10% deleted rows
 float g_vacuum_min_selectivity{0.1};
 
+// By default, automatically re-cluster tables with a sort column when at least half of
+// their fragments overlap other fragments on the sort column
+float g_recluster_min_overlap{0.5};
+
+// Maximum number of fragments whose rows are sorted together in memory when
+// re-clustering. Larger sets of overlapping fragments are merged block by block.
+size_t g_recluster_max_sort_fragments{16};
+
 TableOptimizer::TableOptimizer(const TableDescriptor* td,
                                Executor* executor,
                                const Catalog_Namespace::Catalog& cat)
@@ -115,6 +124,54 @@ inline ExecutionOptions get_execution_options() {
       false, false, false, false, false, false, false, false, 0, false, false, 0, false};
 }
 
+// Returns the sort column of the table, or nullptr if the table has no sort column its
+// rows can be re-clustered on.
+const ColumnDescriptor* get_recluster_column(const Catalog_Namespace::Catalog& cat,
+                                             const TableDescriptor* td) {
+  if (td->sortedColumnId <= 0) {
+    return nullptr;
+  }
+  const auto cd = cat.getMetadataForColumn(td->tableId, td->sortedColumnId);
+  CHECK(cd);
+  const auto& ti = cd->columnType;
+  if (ti.is_number() || ti.is_time() || ti.is_boolean() ||
+      (ti.get_type() == kTEXT && ti.get_compression() == kENCODING_DICT)) {
+    return cd;
+  }
+  return nullptr;
+}
+
+// Range of the sort column in a fragment. Values are compared as doubles, which keeps
+// the order of values of any sort column type.
+std::optional<std::pair<double, double>> get_sort_column_range(
+    const Fragmenter_Namespace::FragmentInfo& fragment,
+    const ColumnDescriptor* cd) {
+  if (fragment.getPhysicalNumTuples() == 0) {
+    return std::nullopt;
+  }
+  const auto& chunk_metadata_map = fragment.getChunkMetadataMapPhysical();
+  const auto chunk_metadata_it = chunk_metadata_map.find(cd->columnId);
+  CHECK(chunk_metadata_it != chunk_metadata_map.end());
+  const auto& stats = chunk_metadata_it->second->chunkStats;
+  const auto& ti = cd->columnType;
+  double min_val, max_val;
+  if (ti.get_type() == kDOUBLE) {
+    min_val = stats.min.doubleval;
+    max_val = stats.max.doubleval;
+  } else if (ti.get_type() == kFLOAT) {
+    min_val = stats.min.floatval;
+    max_val = stats.max.floatval;
+  } else {
+    min_val = extract_min_stat(stats, ti);
+    max_val = extract_max_stat(stats, ti);
+  }
+  if (max_val < min_val) {
+    // only nulls
+    return std::nullopt;
+  }
+  return std::make_pair(min_val, max_val);
+}
+
 }  // namespace
 
 void TableOptimizer::recomputeMetadata() const {
@@ -486,6 +543,180 @@ void TableOptimizer::vacuumFragments(const TableDescriptor* td,
   td->fragmenter->resetSizesFromFragments();
 }
 
+void TableOptimizer::reclusterSortedRows() const {
+  if (!get_recluster_column(cat_, td_)) {
+    throw std::runtime_error("Table " + td_->tableName +
+                             " does not have a numeric, date/time or dictionary encoded "
+                             "text sort column to re-cluster on.");
+  }
+  if (td_->persistenceLevel != Data_Namespace::MemoryLevel::DISK_LEVEL) {
+    throw std::runtime_error("Re-clustering is not supported on temporary tables.");
+  }
+  reclusterSortedRowsImpl(0);
+}
+
+bool TableOptimizer::reclusterSortedRowsAboveMinOverlap() const {
+  if (!get_recluster_column(cat_, td_) ||
+      td_->persistenceLevel != Data_Namespace::MemoryLevel::DISK_LEVEL) {
+    return false;
+  }
+  return reclusterSortedRowsImpl(g_recluster_min_overlap);
+}
+
+bool TableOptimizer::reclusterSortedRowsImpl(const float min_overlap) const {
+  auto timer = DEBUG_TIMER(__func__);
+  const auto table_id = td_->tableId;
+  const auto db_id = cat_.getDatabaseId();
+  const auto table_lock =
+      lockmgr::TableDataLockMgr::getWriteLockForTable({db_id, table_id});
+  const auto shards = cat_.getPhysicalTablesDescriptors(td_);
+  std::vector<std::vector<std::vector<int>>> fragment_groups_per_shard;
+  size_t fragment_count = 0;
+  size_t overlapping_fragment_count = 0;
+  for (const auto shard : shards) {
+    fragment_groups_per_shard.emplace_back(
+        getOverlappingFragmentGroups(shard, fragment_count));
+    for (const auto& fragment_ids : fragment_groups_per_shard.back()) {
+      overlapping_fragment_count += fragment_ids.size();
+    }
+  }
+  if (overlapping_fragment_count == 0 ||
+      overlapping_fragment_count < min_overlap * fragment_count) {
+    return false;
+  }
+
+  const auto table_epochs = cat_.getTableEpochs(db_id, table_id);
+  try {
+    for (size_t i = 0; i < shards.size(); ++i) {
+      reclusterFragments(shards[i], fragment_groups_per_shard[i]);
+    }
+    cat_.checkpoint(table_id);
+  } catch (...) {
+    cat_.setTableEpochsLogExceptions(db_id, table_epochs);
+    throw;
+  }
+  VLOG(1) << "Re-clustered " << overlapping_fragment_count << " out of "
+          << fragment_count << " fragments, table id: " << table_id;
+
+  // rows moved across fragments, so cached join hash tables of the table are stale
+  UpdateTriggeredCacheInvalidator::invalidateCaches();
+  return true;
+}
+
+// Returns the sets of fragments of a physical table whose sort column ranges overlap,
+// leaving out fragments that do not overlap any other fragment. Adds the number of
+// fragments of the table to fragment_count.
+std::vector<std::vector<int>> TableOptimizer::getOverlappingFragmentGroups(
+    const TableDescriptor* td,
+    size_t& fragment_count) const {
+  const auto sort_cd = get_recluster_column(cat_, td);
+  CHECK(sort_cd);
+  CHECK(td->fragmenter);
+  const auto table_info = td->fragmenter->getFragmentsForQuery();
+  // (min, max, fragment id) of every fragment with non-null sort column values
+  std::vector<std::tuple<double, double, int>> ranges;
+  for (const auto& fragment : table_info.fragments) {
+    if (const auto range = get_sort_column_range(fragment, sort_cd)) {
+      ranges.emplace_back(range->first, range->second, fragment.fragmentId);
+    }
+  }
+  fragment_count += ranges.size();
+  std::sort(ranges.begin(), ranges.end());
+
+  std::vector<std::vector<int>> fragment_groups;
+  std::vector<int> fragment_ids;
+  double group_max = 0;
+  auto add_group = [&fragment_groups, &fragment_ids]() {
+    if (fragment_ids.size() > 1) {
+      // keep the rows in fragment order, the order the fragments are scanned in
+      std::sort(fragment_ids.begin(), fragment_ids.end());
+      fragment_groups.push_back(fragment_ids);
+    }
+    fragment_ids.clear();
+  };
+  for (const auto& [min, max, fragment_id] : ranges) {
+    // fragments which only share a boundary value do not overlap, otherwise runs of
+    // equal values longer than a fragment would always be re-clustered
+    if (!fragment_ids.empty() && min >= group_max) {
+      add_group();
+    }
+    group_max = fragment_ids.empty() ? max : std::max(group_max, max);
+    fragment_ids.push_back(fragment_id);
+  }
+  add_group();
+  return fragment_groups;
+}
+
+void TableOptimizer::reclusterFragments(
+    const TableDescriptor* td,
+    const std::vector<std::vector<int>>& fragment_groups) const {
+  const auto sort_cd = get_recluster_column(cat_, td);
+  CHECK(sort_cd);
+  auto sort_rows = [&](const std::vector<int>& fragment_ids) {
+    UpdelRoll updel_roll;
+    updel_roll.catalog = &cat_;
+    updel_roll.logicalTableId = cat_.getLogicalTableId(td->tableId);
+    updel_roll.memoryLevel = Data_Namespace::MemoryLevel::CPU_LEVEL;
+    updel_roll.table_descriptor = td;
+    td->fragmenter->sortRows(
+        &cat_, td, sort_cd, fragment_ids, updel_roll.memoryLevel, updel_roll);
+    updel_roll.stageUpdate();
+  };
+  // Returns true if the ranges of the fragments are ordered by fragment and do not
+  // overlap, in which case sorting their rows would not change any fragment range.
+  auto is_clustered = [&](const std::vector<int>& fragment_ids) {
+    std::map<int, std::optional<std::pair<double, double>>> ranges;
+    for (const auto& fragment : td->fragmenter->getFragmentsForQuery().fragments) {
+      ranges.emplace(fragment.fragmentId, get_sort_column_range(fragment, sort_cd));
+    }
+    std::optional<double> prev_max;
+    for (const auto fragment_id : fragment_ids) {
+      const auto& range = ranges.at(fragment_id);
+      if (!range) {
+        // nulls are sorted first, so fragments with only nulls must come first
+        if (prev_max) {
+          return false;
+        }
+        continue;
+      }
+      if (prev_max && range->first < *prev_max) {
+        return false;
+      }
+      prev_max = range->second;
+    }
+    return true;
+  };
+
+  const size_t max_sort_fragments = std::max(g_recluster_max_sort_fragments, size_t(2));
+  for (const auto& fragment_ids : fragment_groups) {
+    if (fragment_ids.size() <= max_sort_fragments) {
+      sort_rows(fragment_ids);
+      continue;
+    }
+    // Sorting a group that can span the whole table would hold all its rows in memory.
+    // Instead, split the group into blocks of half the maximum number of fragments and
+    // run an odd-even transposition sort over the blocks, where every step sorts the
+    // rows of two adjacent blocks. This orders the whole group after as many phases as
+    // there are blocks and stops early once no pair of blocks overlaps.
+    const size_t block_size = max_sort_fragments / 2;
+    const size_t block_count = (fragment_ids.size() + block_size - 1) / block_size;
+    size_t phases_without_sort = 0;
+    for (size_t phase = 0; phase < block_count && phases_without_sort < 2; ++phase) {
+      bool sorted_rows = false;
+      for (size_t block = phase % 2; block + 1 < block_count; block += 2) {
+        const auto end = std::min((block + 2) * block_size, fragment_ids.size());
+        const std::vector<int> block_fragment_ids(
+            fragment_ids.begin() + block * block_size, fragment_ids.begin() + end);
+        if (!is_clustered(block_fragment_ids)) {
+          sort_rows(block_fragment_ids);
+          sorted_rows = true;
+        }
+      }
+      phases_without_sort = sorted_rows ? 0 : phases_without_sort + 1;
+    }
+  }
+}
+
 void TableOptimizer::vacuumFragmentsAboveMinSelectivity(
     const TableUpdateMetadata& table_update_metadata) const {
   if (td_->persistenceLevel != Data_Namespace::MemoryLevel::DISK_LEVEL) {
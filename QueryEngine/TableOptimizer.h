@@ -72,6 +72,23 @@ class TableOptimizer {
   void vacuumFragmentsAboveMinSelectivity(
       const TableUpdateMetadata& table_update_metadata) const;
 
+  /**
+   * @brief Re-clusters the rows of a table on its sort column.
+   * Inserts only sort the rows of each insert batch, so after many small loads the
+   * fragments hold overlapping ranges of the sort column and fragment skipping no longer
+   * prunes range predicates. Re-clustering sorts the rows of every set of fragments with
+   * overlapping ranges across these fragments, which leaves fragments with ordered,
+   * non-overlapping ranges. Like vacuuming, re-clustering is a checkpointing operation.
+   */
+  void reclusterSortedRows() const;
+
+  /**
+   * Re-clusters the rows of a table on its sort column if the fraction of fragments that
+   * overlap other fragments is at least the configured minimum overlap. Returns true if
+   * the table was re-clustered.
+   */
+  bool reclusterSortedRowsAboveMinOverlap() const;
+
  private:
   DeletedColumnStats recomputeDeletedColumnMetadata(
       const TableDescriptor* td,
@@ -93,6 +110,15 @@ class TableOptimizer {
       const TableDescriptor* td,
       const std::set<size_t>& fragment_indexes) const;
 
+  bool reclusterSortedRowsImpl(const float min_overlap) const;
+
+  std::vector<std::vector<int>> getOverlappingFragmentGroups(
+      const TableDescriptor* td,
+      size_t& fragment_count) const;
+
+  void reclusterFragments(const TableDescriptor* td,
+                          const std::vector<std::vector<int>>& fragment_groups) const;
+
   const TableDescriptor* td_;
   Executor* executor_;
   const Catalog_Namespace::Catalog& cat_;
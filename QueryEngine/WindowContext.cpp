@@ -16,7 +16,12 @@
 
 #include "QueryEngine/WindowContext.h"
 
+#include <atomic>
+#include <cmath>
 #include <numeric>
+#include <optional>
+#include <type_traits>
+#include <variant>
 
 #include "QueryEngine/Descriptors/CountDistinctDescriptor.h"
 #include "QueryEngine/Execute.h"
@@ -26,6 +31,11 @@
 #include "QueryEngine/TypePunning.h"
 #include "Shared/checked_alloc.h"
 #include "Shared/funcannotations.h"
+#include "Shared/threadpool.h"
+
+// Partitions are computed concurrently only when there are enough rows overall to
+// amortize starting the workers.
+size_t g_window_function_parallel_min_rows{100000};
 
 WindowFunctionContext::WindowFunctionContext(
     const Analyzer::WindowFunction* window_func,
@@ -68,10 +78,10 @@ std::vector<int64_t> index_to_row_number(const int64_t* index, const size_t inde
 
 // Returns true iff the current element is greater than the previous, according to the
 // comparator. This is needed because peer rows have to have the same rank.
-bool advance_current_rank(
-    const std::function<bool(const int64_t lhs, const int64_t rhs)>& comparator,
-    const int64_t* index,
-    const size_t i) {
+template <class Comparator>
+bool advance_current_rank(const Comparator& comparator,
+                          const int64_t* index,
+                          const size_t i) {
   if (i == 0) {
     return false;
   }
@@ -79,10 +89,11 @@ bool advance_current_rank(
 }
 
 // Computes the mapping from row position to rank.
+template <class Comparator>
 std::vector<int64_t> index_to_rank(
     const int64_t* index,
     const size_t index_size,
-    const std::function<bool(const int64_t lhs, const int64_t rhs)>& comparator) {
+    const Comparator& comparator) {
   std::vector<int64_t> rank(index_size);
   size_t crt_rank = 1;
   for (size_t i = 0; i < index_size; ++i) {
@@ -95,10 +106,11 @@ std::vector<int64_t> index_to_rank(
 }
 
 // Computes the mapping from row position to dense rank.
+template <class Comparator>
 std::vector<int64_t> index_to_dense_rank(
     const int64_t* index,
     const size_t index_size,
-    const std::function<bool(const int64_t lhs, const int64_t rhs)>& comparator) {
+    const Comparator& comparator) {
   std::vector<int64_t> dense_rank(index_size);
   size_t crt_rank = 1;
   for (size_t i = 0; i < index_size; ++i) {
@@ -111,10 +123,11 @@ std::vector<int64_t> index_to_dense_rank(
 }
 
 // Computes the mapping from row position to percent rank.
+template <class Comparator>
 std::vector<double> index_to_percent_rank(
     const int64_t* index,
     const size_t index_size,
-    const std::function<bool(const int64_t lhs, const int64_t rhs)>& comparator) {
+    const Comparator& comparator) {
   std::vector<double> percent_rank(index_size);
   size_t crt_rank = 1;
   for (size_t i = 0; i < index_size; ++i) {
@@ -128,10 +141,11 @@ std::vector<double> index_to_percent_rank(
 }
 
 // Computes the mapping from row position to cumulative distribution.
+template <class Comparator>
 std::vector<double> index_to_cume_dist(
     const int64_t* index,
     const size_t index_size,
-    const std::function<bool(const int64_t lhs, const int64_t rhs)>& comparator) {
+    const Comparator& comparator) {
   std::vector<double> cume_dist(index_size);
   size_t start_peer_group = 0;
   while (start_peer_group < index_size) {
@@ -267,34 +281,35 @@ void apply_last_value_to_partition(const int32_t* original_indices,
       original_indices, original_indices + partition_size, output_for_partition_buff);
 }
 
-void index_to_partition_end(
-    const int8_t* partition_end,
-    const size_t off,
-    const int64_t* index,
-    const size_t index_size,
-    const std::function<bool(const int64_t lhs, const int64_t rhs)>& comparator) {
-  int64_t partition_end_handle = reinterpret_cast<int64_t>(partition_end);
+// Marks the last row of every peer group. The markers are bytes rather than bits, the
+// partitions are computed concurrently and must not share memory locations.
+template <class Comparator>
+void index_to_partition_end(int8_t* partition_end,
+                            const size_t off,
+                            const int64_t* index,
+                            const size_t index_size,
+                            const Comparator& comparator) {
   for (size_t i = 0; i < index_size; ++i) {
     if (advance_current_rank(comparator, index, i)) {
-      agg_count_distinct_bitmap(&partition_end_handle, off + i - 1, 0);
+      partition_end[off + i - 1] = 1;
     }
   }
   CHECK(index_size);
-  agg_count_distinct_bitmap(&partition_end_handle, off + index_size - 1, 0);
+  partition_end[off + index_size - 1] = 1;
 }
 
-bool pos_is_set(const int64_t bitset, const int64_t pos) {
-  return (reinterpret_cast<const int8_t*>(bitset))[pos >> 3] & (1 << (pos & 7));
+bool pos_is_set(const int64_t partition_end, const int64_t pos) {
+  return reinterpret_cast<const int8_t*>(partition_end)[pos];
 }
 
 // Write value to pending integer outputs collected for all the peer rows. The end of
-// groups is represented by the bitset.
+// groups is represented by the partition end markers.
 template <class T>
 void apply_window_pending_outputs_int(const int64_t handle,
                                       const int64_t value,
-                                      const int64_t bitset,
+                                      const int64_t partition_end,
                                       const int64_t pos) {
-  if (!pos_is_set(bitset, pos)) {
+  if (!pos_is_set(partition_end, pos)) {
     return;
   }
   auto& pending_output_slots = *reinterpret_cast<std::vector<void*>*>(handle);
@@ -306,39 +321,44 @@ void apply_window_pending_outputs_int(const int64_t handle,
 
 }  // namespace
 
-extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_int64(const int64_t handle,
-                                                                  const int64_t value,
-                                                                  const int64_t bitset,
-                                                                  const int64_t pos) {
-  apply_window_pending_outputs_int<int64_t>(handle, value, bitset, pos);
+extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_int64(
+    const int64_t handle,
+    const int64_t value,
+    const int64_t partition_end,
+    const int64_t pos) {
+  apply_window_pending_outputs_int<int64_t>(handle, value, partition_end, pos);
 }
 
-extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_int32(const int64_t handle,
-                                                                  const int64_t value,
-                                                                  const int64_t bitset,
-                                                                  const int64_t pos) {
-  apply_window_pending_outputs_int<int32_t>(handle, value, bitset, pos);
+extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_int32(
+    const int64_t handle,
+    const int64_t value,
+    const int64_t partition_end,
+    const int64_t pos) {
+  apply_window_pending_outputs_int<int32_t>(handle, value, partition_end, pos);
 }
 
-extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_int16(const int64_t handle,
-                                                                  const int64_t value,
-                                                                  const int64_t bitset,
-                                                                  const int64_t pos) {
-  apply_window_pending_outputs_int<int16_t>(handle, value, bitset, pos);
+extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_int16(
+    const int64_t handle,
+    const int64_t value,
+    const int64_t partition_end,
+    const int64_t pos) {
+  apply_window_pending_outputs_int<int16_t>(handle, value, partition_end, pos);
 }
 
-extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_int8(const int64_t handle,
-                                                                 const int64_t value,
-                                                                 const int64_t bitset,
-                                                                 const int64_t pos) {
-  apply_window_pending_outputs_int<int8_t>(handle, value, bitset, pos);
+extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_int8(
+    const int64_t handle,
+    const int64_t value,
+    const int64_t partition_end,
+    const int64_t pos) {
+  apply_window_pending_outputs_int<int8_t>(handle, value, partition_end, pos);
 }
 
-extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_double(const int64_t handle,
-                                                                   const double value,
-                                                                   const int64_t bitset,
-                                                                   const int64_t pos) {
-  if (!pos_is_set(bitset, pos)) {
+extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_double(
+    const int64_t handle,
+    const double value,
+    const int64_t partition_end,
+    const int64_t pos) {
+  if (!pos_is_set(partition_end, pos)) {
     return;
   }
   auto& pending_output_slots = *reinterpret_cast<std::vector<void*>*>(handle);
@@ -348,11 +368,12 @@ extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_double(const int64_t
   pending_output_slots.clear();
 }
 
-extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_float(const int64_t handle,
-                                                                  const float value,
-                                                                  const int64_t bitset,
-                                                                  const int64_t pos) {
-  if (!pos_is_set(bitset, pos)) {
+extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_float(
+    const int64_t handle,
+    const float value,
+    const int64_t partition_end,
+    const int64_t pos) {
+  if (!pos_is_set(partition_end, pos)) {
     return;
   }
   auto& pending_output_slots = *reinterpret_cast<std::vector<void*>*>(handle);
@@ -365,9 +386,9 @@ extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_float(const int64_t
 extern "C" RUNTIME_EXPORT void apply_window_pending_outputs_float_columnar(
     const int64_t handle,
     const float value,
-    const int64_t bitset,
+    const int64_t partition_end,
     const int64_t pos) {
-  if (!pos_is_set(bitset, pos)) {
+  if (!pos_is_set(partition_end, pos)) {
     return;
   }
   auto& pending_output_slots = *reinterpret_cast<std::vector<void*>*>(handle);
@@ -386,7 +407,8 @@ extern "C" RUNTIME_EXPORT void add_window_pending_output(void* pending_output,
 // Returns true iff the aggregate window function requires special multiplicity handling
 // to ensure that peer rows have the same value for the window function.
 bool window_function_requires_peer_handling(const Analyzer::WindowFunction* window_func) {
-  if (!window_function_is_aggregate(window_func->getKind())) {
+  if (!window_function_is_aggregate(window_func->getKind()) ||
+      window_function_is_framed_aggregate(window_func)) {
     return false;
   }
   if (window_func->getOrderKeys().empty()) {
@@ -403,79 +425,815 @@ bool window_function_requires_peer_handling(const Analyzer::WindowFunction* wind
   }
 }
 
+namespace {
+
+// The values of a column, with the sentinel used for nulls.
+template <class T>
+struct ColumnValues {
+  const T* values;
+  T null_val;
+
+  bool isNull(const int32_t pos) const { return values[pos] == null_val; }
+};
+
+template <class T>
+ColumnValues<T> make_column_values(const int8_t* column, const T null_val) {
+  return ColumnValues<T>{reinterpret_cast<const T*>(column), null_val};
+}
+
+// An order key column with its collation.
+template <class T>
+struct OrderKeyColumn {
+  ColumnValues<T> column;
+  bool nulls_first;
+  bool is_desc;
+
+  // Three-way comparison of the rows at the given positions of the column.
+  int compare(const int32_t lhs_pos, const int32_t rhs_pos) const {
+    const auto lhs_val = column.values[lhs_pos];
+    const auto rhs_val = column.values[rhs_pos];
+    int result{0};
+    if (lhs_val == column.null_val || rhs_val == column.null_val) {
+      if (lhs_val != rhs_val) {
+        result = (lhs_val == column.null_val) == nulls_first ? -1 : 1;
+      }
+    } else if (lhs_val < rhs_val) {
+      result = -1;
+    } else if (rhs_val < lhs_val) {
+      result = 1;
+    }
+    return is_desc ? -result : result;
+  }
+};
+
+using AnyOrderKeyColumn = std::variant<OrderKeyColumn<int8_t>,
+                                       OrderKeyColumn<int16_t>,
+                                       OrderKeyColumn<int32_t>,
+                                       OrderKeyColumn<int64_t>,
+                                       OrderKeyColumn<float>,
+                                       OrderKeyColumn<double>>;
+
+template <class T>
+AnyOrderKeyColumn make_order_key_column(const int8_t* column,
+                                        const T null_val,
+                                        const Analyzer::OrderEntry& collation) {
+  return OrderKeyColumn<T>{
+      make_column_values(column, null_val), collation.nulls_first, collation.is_desc};
+}
+
+AnyOrderKeyColumn make_order_key_column(const int8_t* column,
+                                        const SQLTypeInfo& ti,
+                                        const Analyzer::OrderEntry& collation) {
+  if (ti.is_integer() || ti.is_decimal() || ti.is_time() || ti.is_boolean()) {
+    const auto null_val = inline_fixed_encoding_null_val(ti);
+    switch (ti.get_size()) {
+      case 8: {
+        return make_order_key_column<int64_t>(column, null_val, collation);
+      }
+      case 4: {
+        return make_order_key_column<int32_t>(column, null_val, collation);
+      }
+      case 2: {
+        return make_order_key_column<int16_t>(column, null_val, collation);
+      }
+      case 1: {
+        return make_order_key_column<int8_t>(column, null_val, collation);
+      }
+      default: {
+        LOG(FATAL) << "Invalid type size: " << ti.get_size();
+      }
+    }
+  }
+  if (ti.is_fp()) {
+    switch (ti.get_type()) {
+      case kFLOAT: {
+        return make_order_key_column<float>(
+            column, inline_fp_null_value<float>(), collation);
+      }
+      case kDOUBLE: {
+        return make_order_key_column<double>(
+            column, inline_fp_null_value<double>(), collation);
+      }
+      default: {
+        LOG(FATAL) << "Invalid float type";
+      }
+    }
+  }
+  throw std::runtime_error("Type not supported yet");
+}
+
+// Orders the rows of a partition, given as indices into the partition, on a single key.
+// Specialized for the type of the key, which is the common case.
+template <class T>
+class SingleKeyComparator {
+ public:
+  SingleKeyComparator(const OrderKeyColumn<T>& order_key,
+                      const int32_t* partition_indices)
+      : order_key_(order_key), partition_indices_(partition_indices) {}
+
+  bool operator()(const int64_t lhs, const int64_t rhs) const {
+    return order_key_.compare(partition_indices_[lhs], partition_indices_[rhs]) < 0;
+  }
+
+ private:
+  const OrderKeyColumn<T> order_key_;
+  const int32_t* partition_indices_;
+};
+
+// Orders the rows of a partition lexicographically on several keys.
+class MultiKeyComparator {
+ public:
+  MultiKeyComparator(const std::vector<AnyOrderKeyColumn>& order_keys,
+                     const int32_t* partition_indices)
+      : order_keys_(order_keys), partition_indices_(partition_indices) {}
+
+  bool operator()(const int64_t lhs, const int64_t rhs) const {
+    const auto lhs_pos = partition_indices_[lhs];
+    const auto rhs_pos = partition_indices_[rhs];
+    for (const auto& order_key : order_keys_) {
+      const auto result = std::visit(
+          [lhs_pos, rhs_pos](const auto& key) { return key.compare(lhs_pos, rhs_pos); },
+          order_key);
+      if (result) {
+        return result < 0;
+      }
+    }
+    return false;
+  }
+
+ private:
+  const std::vector<AnyOrderKeyColumn>& order_keys_;
+  const int32_t* partition_indices_;
+};
+
+// Calls the callback with the comparator for the rows of a partition.
+template <class Callback>
+void with_partition_comparator(const std::vector<AnyOrderKeyColumn>& order_keys,
+                               const int32_t* partition_indices,
+                               Callback&& callback) {
+  if (order_keys.size() == 1) {
+    std::visit(
+        [partition_indices, &callback](const auto& order_key) {
+          callback(SingleKeyComparator(order_key, partition_indices));
+        },
+        order_keys.front());
+  } else {
+    callback(MultiKeyComparator(order_keys, partition_indices));
+  }
+}
+
+using AnyColumnValues = std::variant<ColumnValues<int8_t>,
+                                     ColumnValues<int16_t>,
+                                     ColumnValues<int32_t>,
+                                     ColumnValues<int64_t>,
+                                     ColumnValues<uint8_t>,
+                                     ColumnValues<uint16_t>,
+                                     ColumnValues<float>,
+                                     ColumnValues<double>>;
+
+// Returns the values of the argument of an aggregate over a frame. Only the nulls matter
+// for COUNT, other aggregates require a numeric argument.
+AnyColumnValues make_frame_argument(const int8_t* column,
+                                    const SQLTypeInfo& ti,
+                                    const SqlWindowFunctionKind kind) {
+  const bool is_count = kind == SqlWindowFunctionKind::COUNT;
+  const bool is_dict_string = ti.is_string() && ti.get_compression() == kENCODING_DICT;
+  if (ti.is_integer() || ti.is_decimal() ||
+      (is_count && (ti.is_time() || ti.is_boolean() || is_dict_string))) {
+    const auto null_val = inline_fixed_encoding_null_val(ti);
+    switch (ti.get_size()) {
+      case 8: {
+        return make_column_values<int64_t>(column, null_val);
+      }
+      case 4: {
+        return make_column_values<int32_t>(column, null_val);
+      }
+      case 2: {
+        if (is_dict_string) {
+          return make_column_values<uint16_t>(column, null_val);
+        }
+        return make_column_values<int16_t>(column, null_val);
+      }
+      case 1: {
+        if (is_dict_string) {
+          return make_column_values<uint8_t>(column, null_val);
+        }
+        return make_column_values<int8_t>(column, null_val);
+      }
+      default: {
+        LOG(FATAL) << "Invalid type size: " << ti.get_size();
+      }
+    }
+  }
+  if (ti.is_fp()) {
+    switch (ti.get_type()) {
+      case kFLOAT: {
+        return make_column_values<float>(column, inline_fp_null_value<float>());
+      }
+      case kDOUBLE: {
+        return make_column_values<double>(column, inline_fp_null_value<double>());
+      }
+      default: {
+        LOG(FATAL) << "Invalid float type";
+      }
+    }
+  }
+  throw std::runtime_error("Window frames not supported for " + ti.get_type_name() +
+                           " arguments yet");
+}
+
+// Writes the values of a numeric column cast to another numeric type, the argument type
+// of an aggregate over a frame like SUM(CAST(x AS DOUBLE)).
+void cast_frame_argument(int8_t* output,
+                         const AnyColumnValues& input,
+                         const SQLTypeInfo& input_ti,
+                         const SQLTypeInfo& output_ti,
+                         const size_t elem_count) {
+  if (!input_ti.is_number() || !output_ti.is_number()) {
+    throw std::runtime_error("Window frames not supported for casts from " +
+                             input_ti.get_type_name() + " to " +
+                             output_ti.get_type_name() + " arguments yet");
+  }
+  const unsigned input_scale = input_ti.is_decimal() ? input_ti.get_scale() : 0;
+  const unsigned output_scale = output_ti.is_decimal() ? output_ti.get_scale() : 0;
+  auto cast_column = [&input, elem_count](auto* values, const auto null_val, auto cast) {
+    using T = std::remove_pointer_t<decltype(values)>;
+    std::visit(
+        [&](const auto& input_values) {
+          for (size_t pos = 0; pos < elem_count; ++pos) {
+            values[pos] = input_values.isNull(pos)
+                              ? null_val
+                              : static_cast<T>(cast(input_values.values[pos]));
+          }
+        },
+        input);
+  };
+  if (output_ti.is_fp()) {
+    const double divisor = exp_to_scale(input_scale);
+    auto cast = [divisor](const auto value) { return value / divisor; };
+    if (output_ti.get_type() == kFLOAT) {
+      cast_column(reinterpret_cast<float*>(output), inline_fp_null_value<float>(), cast);
+    } else {
+      cast_column(
+          reinterpret_cast<double*>(output), inline_fp_null_value<double>(), cast);
+    }
+    return;
+  }
+  // integer and decimal outputs, rounded half away from zero like the decimal casts
+  auto cast = [input_scale, output_scale](const auto value) -> int64_t {
+    if constexpr (std::is_floating_point<decltype(value)>::value) {
+      return std::llround(static_cast<double>(value) * exp_to_scale(output_scale));
+    } else {
+      const int64_t int_value = value;
+      if (output_scale >= input_scale) {
+        return int_value * static_cast<int64_t>(exp_to_scale(output_scale - input_scale));
+      }
+      const auto divisor = static_cast<int64_t>(exp_to_scale(input_scale - output_scale));
+      return (int_value + (int_value < 0 ? -divisor : divisor) / 2) / divisor;
+    }
+  };
+  const auto null_val = inline_int_null_val(output_ti);
+  switch (output_ti.get_size()) {
+    case 8: {
+      cast_column(reinterpret_cast<int64_t*>(output), null_val, cast);
+      break;
+    }
+    case 4: {
+      cast_column(
+          reinterpret_cast<int32_t*>(output), static_cast<int32_t>(null_val), cast);
+      break;
+    }
+    case 2: {
+      cast_column(
+          reinterpret_cast<int16_t*>(output), static_cast<int16_t>(null_val), cast);
+      break;
+    }
+    case 1: {
+      cast_column(reinterpret_cast<int8_t*>(output), static_cast<int8_t>(null_val), cast);
+      break;
+    }
+    default: {
+      LOG(FATAL) << "Invalid type size: " << output_ti.get_size();
+    }
+  }
+}
+
+// Segment tree over the values of a partition in window order. Answers aggregate
+// queries over arbitrary frames in logarithmic time.
+template <class T, class Combine>
+class SegmentTree {
+ public:
+  SegmentTree(const std::vector<T>& leaves, const T identity, Combine combine)
+      : leaf_count_(leaves.size())
+      , identity_(identity)
+      , combine_(combine)
+      , nodes_(2 * leaves.size(), identity) {
+    std::copy(leaves.begin(), leaves.end(), nodes_.begin() + leaf_count_);
+    for (size_t i = leaf_count_; i-- > 1;) {
+      nodes_[i] = combine_(nodes_[2 * i], nodes_[2 * i + 1]);
+    }
+  }
+
+  // Aggregates the values at positions [begin, end).
+  T query(size_t begin, size_t end) const {
+    T result = identity_;
+    for (begin += leaf_count_, end += leaf_count_; begin < end; begin /= 2, end /= 2) {
+      if (begin & 1) {
+        result = combine_(result, nodes_[begin++]);
+      }
+      if (end & 1) {
+        result = combine_(result, nodes_[--end]);
+      }
+    }
+    return result;
+  }
+
+ private:
+  const size_t leaf_count_;
+  const T identity_;
+  const Combine combine_;
+  std::vector<T> nodes_;
+};
+
+// The frames of the rows of a sorted partition, as ranges [begin, end) of positions in
+// the window order.
+struct PartitionFrames {
+  std::vector<int64_t> begin;
+  std::vector<int64_t> end;
+};
+
+int64_t saturating_sub(const int64_t lhs, const int64_t rhs) {
+  if (rhs > 0 && lhs < std::numeric_limits<int64_t>::min() + rhs) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  if (rhs < 0 && lhs > std::numeric_limits<int64_t>::max() + rhs) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  return lhs - rhs;
+}
+
+double saturating_sub(const double lhs, const double rhs) {
+  return lhs - rhs;
+}
+
+// Position of the row a ROWS frame bound refers to, which can be outside of the
+// partition.
+int64_t rows_bound_position(const Analyzer::WindowFrameBound& bound,
+                            const int64_t pos,
+                            const int64_t partition_size) {
+  using Type = Analyzer::WindowFrameBound::Type;
+  // offsets past the partition behave like unbounded ones, capping them avoids overflows
+  const auto offset = std::min(bound.offset, partition_size);
+  switch (bound.type) {
+    case Type::UNBOUNDED_PRECEDING: {
+      return -partition_size - 1;
+    }
+    case Type::PRECEDING: {
+      return pos - offset;
+    }
+    case Type::CURRENT_ROW: {
+      return pos;
+    }
+    case Type::FOLLOWING: {
+      return pos + offset;
+    }
+    case Type::UNBOUNDED_FOLLOWING: {
+      return 2 * partition_size;
+    }
+  }
+  UNREACHABLE();
+  return 0;
+}
+
+bool has_offset(const Analyzer::WindowFrameBound& bound) {
+  return bound.type == Analyzer::WindowFrameBound::Type::PRECEDING ||
+         bound.type == Analyzer::WindowFrameBound::Type::FOLLOWING;
+}
+
+// Computes aggregates over explicit ROWS and RANGE frames. Sums and counts over integers
+// use prefix sums, the other aggregates use a segment tree per partition, so that every
+// frame costs at most a logarithmic number of steps regardless of its size.
+class FrameAggregator {
+ public:
+  FrameAggregator(const Analyzer::WindowFunction* window_func,
+                  const std::vector<AnyOrderKeyColumn>& order_keys,
+                  const int8_t* argument_column)
+      : kind_(window_func->getKind())
+      , frame_(*window_func->getFrame())
+      , order_keys_(order_keys) {
+    const auto& window_func_ti = window_func->get_type_info();
+    if (window_func_ti.is_fp()) {
+      fp_null_val_ = inline_fp_null_val(window_func_ti);
+    } else {
+      int_null_val_ = inline_int_null_val(window_func_ti);
+    }
+    const auto& args = window_func->getArgs();
+    if (!args.empty()) {
+      CHECK(argument_column);
+      const auto& arg_ti = args.front()->get_type_info();
+      argument_ = make_frame_argument(argument_column, arg_ti, kind_);
+      if (arg_ti.is_decimal()) {
+        avg_divisor_ = exp_to_scale(arg_ti.get_scale());
+      }
+    } else {
+      CHECK(kind_ == SqlWindowFunctionKind::COUNT);
+    }
+    if (!frame_.is_rows && (has_offset(frame_.lower) || has_offset(frame_.upper))) {
+      CHECK_EQ(order_keys_.size(), size_t(1));
+      const auto& order_key_ti = window_func->getOrderKeys().front()->get_type_info();
+      if (order_key_ti.is_decimal()) {
+        offset_scale_ = exp_to_scale(order_key_ti.get_scale());
+      }
+    }
+  }
+
+  // Writes the aggregate of the frame of every row of the sorted partition to the slot of
+  // the row, the sorted indices in output_for_partition_buff are overwritten.
+  template <class Comparator>
+  void computePartition(int64_t* output_for_partition_buff,
+                        const int32_t* partition_indices,
+                        const size_t partition_size,
+                        const Comparator& comparator) const {
+    const auto frames = computeFrames(
+        output_for_partition_buff, partition_indices, partition_size, comparator);
+    std::vector<int64_t> results(partition_size);
+    if (argument_) {
+      std::visit(
+          [&](const auto& argument) {
+            aggregate(argument,
+                      output_for_partition_buff,
+                      partition_indices,
+                      frames,
+                      results.data());
+          },
+          *argument_);
+    } else {
+      for (size_t pos = 0; pos < partition_size; ++pos) {
+        results[output_for_partition_buff[pos]] = frames.end[pos] - frames.begin[pos];
+      }
+    }
+    std::copy(results.begin(), results.end(), output_for_partition_buff);
+  }
+
+ private:
+  template <class Comparator>
+  PartitionFrames computeFrames(const int64_t* index,
+                                const int32_t* partition_indices,
+                                const size_t partition_size,
+                                const Comparator& comparator) const {
+    const auto size = static_cast<int64_t>(partition_size);
+    PartitionFrames frames{std::vector<int64_t>(partition_size),
+                           std::vector<int64_t>(partition_size)};
+    if (frame_.is_rows) {
+      for (int64_t pos = 0; pos < size; ++pos) {
+        const auto begin = std::max(
+            int64_t(0), std::min(rows_bound_position(frame_.lower, pos, size), size));
+        frames.begin[pos] = begin;
+        const auto end = rows_bound_position(frame_.upper, pos, size) + 1;
+        frames.end[pos] = std::max(begin, std::min(end, size));
+      }
+      return frames;
+    }
+    // the CURRENT ROW bounds of a RANGE frame include the peers of the row
+    std::vector<int64_t> peer_begin(partition_size);
+    std::vector<int64_t> peer_end(partition_size);
+    for (int64_t pos = 0; pos < size;) {
+      auto end_peer_group = pos + 1;
+      while (end_peer_group < size &&
+             !advance_current_rank(comparator, index, end_peer_group)) {
+        ++end_peer_group;
+      }
+      std::fill(peer_begin.begin() + pos, peer_begin.begin() + end_peer_group, pos);
+      std::fill(
+          peer_end.begin() + pos, peer_end.begin() + end_peer_group, end_peer_group);
+      pos = end_peer_group;
+    }
+    auto limit = [&](const Analyzer::WindowFrameBound& bound,
+                     const int64_t pos,
+                     const bool is_upper) -> int64_t {
+      using Type = Analyzer::WindowFrameBound::Type;
+      switch (bound.type) {
+        case Type::UNBOUNDED_PRECEDING: {
+          return 0;
+        }
+        case Type::UNBOUNDED_FOLLOWING: {
+          return size;
+        }
+        case Type::CURRENT_ROW: {
+          return is_upper ? peer_end[pos] : peer_begin[pos];
+        }
+        default: {
+          return std::visit(
+              [&](const auto& order_key) {
+                return rangeOffsetLimit(order_key,
+                                        index,
+                                        partition_indices,
+                                        size,
+                                        peer_begin,
+                                        peer_end,
+                                        bound,
+                                        pos,
+                                        is_upper);
+              },
+              order_keys_.front());
+        }
+      }
+    };
+    for (int64_t pos = 0; pos < size; ++pos) {
+      frames.begin[pos] = limit(frame_.lower, pos, false);
+      frames.end[pos] = std::max(frames.begin[pos], limit(frame_.upper, pos, true));
+    }
+    return frames;
+  }
+
+  // Returns the limit of a RANGE bound with an offset: the first row whose order key is
+  // not before the bound for lower bounds, the first row after the bound otherwise. Rows
+  // with a null key only have their peers in the frame.
+  template <class T>
+  int64_t rangeOffsetLimit(const OrderKeyColumn<T>& order_key,
+                           const int64_t* index,
+                           const int32_t* partition_indices,
+                           const int64_t partition_size,
+                           const std::vector<int64_t>& peer_begin,
+                           const std::vector<int64_t>& peer_end,
+                           const Analyzer::WindowFrameBound& bound,
+                           const int64_t pos,
+                           const bool is_upper) const {
+    using Key = std::conditional_t<std::is_floating_point<T>::value, double, int64_t>;
+    auto is_null = [&](const int64_t p) {
+      return order_key.column.isNull(partition_indices[index[p]]);
+    };
+    auto key = [&](const int64_t p) {
+      return static_cast<Key>(order_key.column.values[partition_indices[index[p]]]);
+    };
+    if (is_null(pos)) {
+      return is_upper ? peer_end[pos] : peer_begin[pos];
+    }
+    // the rows with a null key are at one end of the partition, peers of each other
+    int64_t non_null_begin = 0;
+    int64_t non_null_end = partition_size;
+    if (is_null(0)) {
+      non_null_begin = peer_end[0];
+    } else if (is_null(partition_size - 1)) {
+      non_null_end = peer_begin[partition_size - 1];
+    }
+    Key offset;
+    if constexpr (std::is_floating_point<T>::value) {
+      offset = static_cast<Key>(bound.offset);
+    } else {
+      offset = bound.offset > std::numeric_limits<int64_t>::max() / offset_scale_
+                   ? std::numeric_limits<int64_t>::max()
+                   : bound.offset * offset_scale_;
+    }
+    const Key distance =
+        bound.type == Analyzer::WindowFrameBound::Type::PRECEDING ? -offset : offset;
+    const auto crt_key = key(pos);
+    // the distance from the current row in the window order grows with the position
+    auto before_limit = [&](const int64_t p) {
+      const auto row_distance = order_key.is_desc ? saturating_sub(crt_key, key(p))
+                                                  : saturating_sub(key(p), crt_key);
+      return is_upper ? row_distance <= distance : row_distance < distance;
+    };
+    auto lo = non_null_begin;
+    auto hi = non_null_end;
+    while (lo < hi) {
+      const auto mid = lo + (hi - lo) / 2;
+      if (before_limit(mid)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    return lo;
+  }
+
+  template <class T>
+  void aggregate(const ColumnValues<T>& argument,
+                 const int64_t* index,
+                 const int32_t* partition_indices,
+                 const PartitionFrames& frames,
+                 int64_t* results) const {
+    using Value = std::conditional_t<std::is_floating_point<T>::value, double, int64_t>;
+    const size_t partition_size = frames.begin.size();
+    Value null_replacement{0};
+    if (kind_ == SqlWindowFunctionKind::MIN) {
+      null_replacement = std::numeric_limits<Value>::max();
+    } else if (kind_ == SqlWindowFunctionKind::MAX) {
+      null_replacement = std::numeric_limits<Value>::lowest();
+    }
+    std::vector<Value> values(partition_size);
+    std::vector<int64_t> non_null_counts(partition_size + 1, 0);
+    for (size_t pos = 0; pos < partition_size; ++pos) {
+      const auto row_pos = partition_indices[index[pos]];
+      const bool is_null = argument.isNull(row_pos);
+      values[pos] =
+          is_null ? null_replacement : static_cast<Value>(argument.values[row_pos]);
+      non_null_counts[pos + 1] = non_null_counts[pos] + !is_null;
+    }
+    auto frame_count = [&](const size_t pos) {
+      return non_null_counts[frames.end[pos]] - non_null_counts[frames.begin[pos]];
+    };
+    auto output = [](const Value value) {
+      if constexpr (std::is_floating_point<Value>::value) {
+        return *reinterpret_cast<const int64_t*>(may_alias_ptr(&value));
+      } else {
+        return value;
+      }
+    };
+    const auto null_output =
+        std::is_floating_point<Value>::value ? nullOutput<double>() : int_null_val_;
+    switch (kind_) {
+      case SqlWindowFunctionKind::COUNT: {
+        for (size_t pos = 0; pos < partition_size; ++pos) {
+          results[index[pos]] = frame_count(pos);
+        }
+        break;
+      }
+      case SqlWindowFunctionKind::SUM:
+      case SqlWindowFunctionKind::AVG: {
+        std::vector<uint64_t> prefix_sums;
+        std::optional<SegmentTree<Value, std::plus<Value>>> sum_tree;
+        if constexpr (std::is_floating_point<Value>::value) {
+          sum_tree.emplace(values, Value(0), std::plus<Value>());
+        } else {
+          // integer prefix sums are exact, differences wrap around like the sums would
+          prefix_sums.resize(partition_size + 1, 0);
+          for (size_t pos = 0; pos < partition_size; ++pos) {
+            prefix_sums[pos + 1] = prefix_sums[pos] + static_cast<uint64_t>(values[pos]);
+          }
+        }
+        for (size_t pos = 0; pos < partition_size; ++pos) {
+          const auto count = frame_count(pos);
+          Value sum;
+          if constexpr (std::is_floating_point<Value>::value) {
+            sum = sum_tree->query(frames.begin[pos], frames.end[pos]);
+          } else {
+            sum = static_cast<int64_t>(prefix_sums[frames.end[pos]] -
+                                       prefix_sums[frames.begin[pos]]);
+          }
+          if (kind_ == SqlWindowFunctionKind::AVG) {
+            const double avg = static_cast<double>(sum) / count / avg_divisor_;
+            results[index[pos]] = count ? *reinterpret_cast<const int64_t*>(
+                                              may_alias_ptr(&avg))
+                                        : nullOutput<double>();
+          } else {
+            results[index[pos]] = count ? output(sum) : null_output;
+          }
+        }
+        break;
+      }
+      case SqlWindowFunctionKind::MIN:
+      case SqlWindowFunctionKind::MAX: {
+        const bool is_min = kind_ == SqlWindowFunctionKind::MIN;
+        const SegmentTree tree(
+            values, null_replacement, [is_min](const Value lhs, const Value rhs) {
+              return is_min ? std::min(lhs, rhs) : std::max(lhs, rhs);
+            });
+        for (size_t pos = 0; pos < partition_size; ++pos) {
+          results[index[pos]] =
+              frame_count(pos) ? output(tree.query(frames.begin[pos], frames.end[pos]))
+                               : null_output;
+        }
+        break;
+      }
+      default: {
+        LOG(FATAL) << "Invalid window function kind";
+      }
+    }
+  }
+
+  template <class T>
+  int64_t nullOutput() const {
+    static_assert(std::is_same<T, double>::value);
+    return *reinterpret_cast<const int64_t*>(may_alias_ptr(&fp_null_val_));
+  }
+
+  const SqlWindowFunctionKind kind_;
+  const Analyzer::WindowFrame frame_;
+  const std::vector<AnyOrderKeyColumn>& order_keys_;
+  std::optional<AnyColumnValues> argument_;
+  int64_t int_null_val_{0};
+  double fp_null_val_{0};
+  // decimal arguments are averaged unscaled
+  uint64_t avg_divisor_{1};
+  // offsets of RANGE frames over decimal order keys are scaled like the keys
+  int64_t offset_scale_{1};
+};
+
+}  // namespace
+
+void WindowFunctionContext::setAggregateArgument(
+    const int8_t* column,
+    const SQLTypeInfo& column_ti,
+    const std::vector<std::shared_ptr<Chunk_NS::Chunk>>& chunks_owner) {
+  CHECK(window_function_is_framed_aggregate(window_func_));
+  CHECK(!window_func_->getArgs().empty());
+  aggregate_argument_owner_ = chunks_owner;
+  aggregate_argument_ = column;
+  const auto& arg_ti = window_func_->getArgs().front()->get_type_info();
+  if (column_ti != arg_ti) {
+    // the argument is a cast of the column, aggregate the cast values
+    auto cast_column = row_set_mem_owner_->allocate(elem_count_ * arg_ti.get_size(),
+                                                       /*thread_idx=*/0);
+    cast_frame_argument(cast_column,
+                        make_frame_argument(column, column_ti, window_func_->getKind()),
+                        column_ti,
+                        arg_ti,
+                        elem_count_);
+    aggregate_argument_ = cast_column;
+  }
+}
+
 void WindowFunctionContext::compute() {
   CHECK(!output_);
   output_ = static_cast<int8_t*>(row_set_mem_owner_->allocate(
       elem_count_ * window_function_buffer_element_size(window_func_->getKind()),
       /*thread_idx=*/0));
-  if (window_function_is_aggregate(window_func_->getKind())) {
+  const bool is_framed_aggregate = window_function_is_framed_aggregate(window_func_);
+  if (window_function_is_aggregate(window_func_->getKind()) && !is_framed_aggregate) {
     fillPartitionStart();
     if (window_function_requires_peer_handling(window_func_)) {
       fillPartitionEnd();
     }
   }
+  std::vector<AnyOrderKeyColumn> order_keys;
+  const auto& order_key_exprs = window_func_->getOrderKeys();
+  const auto& collation = window_func_->getCollation();
+  CHECK_EQ(order_key_exprs.size(), collation.size());
+  CHECK_EQ(order_key_exprs.size(), order_columns_.size());
+  for (size_t order_column_idx = 0; order_column_idx < order_columns_.size();
+       ++order_column_idx) {
+    const auto order_col = dynamic_cast<const Analyzer::ColumnVar*>(
+        order_key_exprs[order_column_idx].get());
+    CHECK(order_col);
+    order_keys.push_back(make_order_key_column(order_columns_[order_column_idx],
+                                               order_col->get_type_info(),
+                                               collation[order_column_idx]));
+  }
+  std::optional<FrameAggregator> frame_aggregator;
+  if (is_framed_aggregate) {
+    frame_aggregator.emplace(window_func_, order_keys, aggregate_argument_);
+  }
   std::unique_ptr<int64_t[]> scratchpad(new int64_t[elem_count_]);
-  int64_t off = 0;
-  for (size_t i = 0; i < partitionCount(); ++i) {
-    auto partition_size = counts()[i];
-    if (partition_size == 0) {
-      continue;
-    }
-    auto output_for_partition_buff = scratchpad.get() + offsets()[i];
-    std::iota(output_for_partition_buff,
-              output_for_partition_buff + partition_size,
-              int64_t(0));
-    std::vector<Comparator> comparators;
-    const auto& order_keys = window_func_->getOrderKeys();
-    const auto& collation = window_func_->getCollation();
-    CHECK_EQ(order_keys.size(), collation.size());
-    for (size_t order_column_idx = 0; order_column_idx < order_columns_.size();
-         ++order_column_idx) {
-      auto order_column_buffer = order_columns_[order_column_idx];
-      const auto order_col =
-          dynamic_cast<const Analyzer::ColumnVar*>(order_keys[order_column_idx].get());
-      CHECK(order_col);
-      const auto& order_col_collation = collation[order_column_idx];
-      const auto asc_comparator = makeComparator(order_col,
-                                                 order_column_buffer,
-                                                 payload() + offsets()[i],
-                                                 order_col_collation.nulls_first);
-      auto comparator = asc_comparator;
-      if (order_col_collation.is_desc) {
-        comparator = [asc_comparator](const int64_t lhs, const int64_t rhs) {
-          return asc_comparator(rhs, lhs);
-        };
-      }
-      comparators.push_back(comparator);
-    }
-    const auto col_tuple_comparator = [&comparators](const int64_t lhs,
-                                                     const int64_t rhs) {
-      for (const auto& comparator : comparators) {
-        if (comparator(lhs, rhs)) {
-          return true;
-        }
+  const size_t partition_count = partitionCount();
+  // the partitions are independent, workers pull them one at a time so that a few large
+  // partitions don't leave the other workers idle
+  std::atomic<size_t> next_partition_idx{0};
+  auto compute_partitions = [&]() {
+    for (size_t i = next_partition_idx++; i < partition_count;
+         i = next_partition_idx++) {
+      const size_t partition_size = counts()[i];
+      if (partition_size == 0) {
+        continue;
       }
-      return false;
-    };
-    std::sort(output_for_partition_buff,
-              output_for_partition_buff + partition_size,
-              col_tuple_comparator);
-    computePartition(output_for_partition_buff,
-                     partition_size,
-                     off,
-                     window_func_,
-                     col_tuple_comparator);
-    if (window_function_is_value(window_func_->getKind()) ||
-        window_function_is_aggregate(window_func_->getKind())) {
-      off += partition_size;
+      const size_t off = offsets()[i];
+      auto output_for_partition_buff = scratchpad.get() + off;
+      std::iota(output_for_partition_buff,
+                output_for_partition_buff + partition_size,
+                int64_t(0));
+      const auto partition_indices = payload() + off;
+      with_partition_comparator(
+          order_keys, partition_indices, [&](const auto& comparator) {
+            if (!order_keys.empty()) {
+              std::sort(output_for_partition_buff,
+                        output_for_partition_buff + partition_size,
+                        comparator);
+            }
+            if (frame_aggregator) {
+              frame_aggregator->computePartition(output_for_partition_buff,
+                                                 partition_indices,
+                                                 partition_size,
+                                                 comparator);
+            } else {
+              computePartition(output_for_partition_buff,
+                               partition_size,
+                               off,
+                               window_func_,
+                               comparator);
+            }
+          });
+    }
+  };
+  const size_t worker_count =
+      elem_count_ >= g_window_function_parallel_min_rows && partition_count > 1
+          ? std::min(static_cast<size_t>(cpu_threads()), partition_count)
+          : size_t(1);
+  if (worker_count > 1) {
+    threadpool::ThreadPool<void> thread_pool;
+    for (size_t worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
+      thread_pool.spawn(compute_partitions);
     }
+    thread_pool.join();
+  } else {
+    compute_partitions();
   }
   if (window_function_is_value(window_func_->getKind()) ||
       window_function_is_aggregate(window_func_->getKind())) {
-    CHECK_EQ(static_cast<size_t>(off), elem_count_);
+    CHECK_EQ(std::accumulate(counts(), counts() + partition_count, size_t(0)),
+             elem_count_);
   }
   auto output_i64 = reinterpret_cast<int64_t*>(output_);
-  if (window_function_is_aggregate(window_func_->getKind())) {
+  if (window_function_is_aggregate(window_func_->getKind()) && !is_framed_aggregate) {
     std::copy(scratchpad.get(), scratchpad.get() + elem_count_, output_i64);
   } else {
     for (size_t i = 0; i < elem_count_; ++i) {
@@ -519,131 +1277,13 @@ size_t WindowFunctionContext::elementCount() const {
   return elem_count_;
 }
 
-namespace {
-
-template <class T>
-bool integer_comparator(const int8_t* order_column_buffer,
-                        const SQLTypeInfo& ti,
-                        const int32_t* partition_indices,
-                        const int64_t lhs,
-                        const int64_t rhs,
-                        const bool nulls_first) {
-  const auto values = reinterpret_cast<const T*>(order_column_buffer);
-  const auto lhs_val = values[partition_indices[lhs]];
-  const auto rhs_val = values[partition_indices[rhs]];
-  const auto null_val = inline_fixed_encoding_null_val(ti);
-  if (lhs_val == null_val && rhs_val == null_val) {
-    return false;
-  }
-  if (lhs_val == null_val && rhs_val != null_val) {
-    return nulls_first;
-  }
-  if (rhs_val == null_val && lhs_val != null_val) {
-    return !nulls_first;
-  }
-  return lhs_val < rhs_val;
-}
-
-template <class T, class NullPatternType>
-bool fp_comparator(const int8_t* order_column_buffer,
-                   const SQLTypeInfo& ti,
-                   const int32_t* partition_indices,
-                   const int64_t lhs,
-                   const int64_t rhs,
-                   const bool nulls_first) {
-  const auto values = reinterpret_cast<const T*>(order_column_buffer);
-  const auto lhs_val = values[partition_indices[lhs]];
-  const auto rhs_val = values[partition_indices[rhs]];
-  const auto null_bit_pattern = null_val_bit_pattern(ti, ti.get_type() == kFLOAT);
-  const auto lhs_bit_pattern =
-      *reinterpret_cast<const NullPatternType*>(may_alias_ptr(&lhs_val));
-  const auto rhs_bit_pattern =
-      *reinterpret_cast<const NullPatternType*>(may_alias_ptr(&rhs_val));
-  if (lhs_bit_pattern == null_bit_pattern && rhs_bit_pattern == null_bit_pattern) {
-    return false;
-  }
-  if (lhs_bit_pattern == null_bit_pattern && rhs_bit_pattern != null_bit_pattern) {
-    return nulls_first;
-  }
-  if (rhs_bit_pattern == null_bit_pattern && lhs_bit_pattern != null_bit_pattern) {
-    return !nulls_first;
-  }
-  return lhs_val < rhs_val;
-}
-
-}  // namespace
-
-std::function<bool(const int64_t lhs, const int64_t rhs)>
-WindowFunctionContext::makeComparator(const Analyzer::ColumnVar* col_var,
-                                      const int8_t* order_column_buffer,
-                                      const int32_t* partition_indices,
-                                      const bool nulls_first) {
-  const auto& ti = col_var->get_type_info();
-  if (ti.is_integer() || ti.is_decimal() || ti.is_time() || ti.is_boolean()) {
-    switch (ti.get_size()) {
-      case 8: {
-        return [order_column_buffer, nulls_first, partition_indices, &ti](
-                   const int64_t lhs, const int64_t rhs) {
-          return integer_comparator<int64_t>(
-              order_column_buffer, ti, partition_indices, lhs, rhs, nulls_first);
-        };
-      }
-      case 4: {
-        return [order_column_buffer, nulls_first, partition_indices, &ti](
-                   const int64_t lhs, const int64_t rhs) {
-          return integer_comparator<int32_t>(
-              order_column_buffer, ti, partition_indices, lhs, rhs, nulls_first);
-        };
-      }
-      case 2: {
-        return [order_column_buffer, nulls_first, partition_indices, &ti](
-                   const int64_t lhs, const int64_t rhs) {
-          return integer_comparator<int16_t>(
-              order_column_buffer, ti, partition_indices, lhs, rhs, nulls_first);
-        };
-      }
-      case 1: {
-        return [order_column_buffer, nulls_first, partition_indices, &ti](
-                   const int64_t lhs, const int64_t rhs) {
-          return integer_comparator<int8_t>(
-              order_column_buffer, ti, partition_indices, lhs, rhs, nulls_first);
-        };
-      }
-      default: {
-        LOG(FATAL) << "Invalid type size: " << ti.get_size();
-      }
-    }
-  }
-  if (ti.is_fp()) {
-    switch (ti.get_type()) {
-      case kFLOAT: {
-        return [order_column_buffer, nulls_first, partition_indices, &ti](
-                   const int64_t lhs, const int64_t rhs) {
-          return fp_comparator<float, int32_t>(
-              order_column_buffer, ti, partition_indices, lhs, rhs, nulls_first);
-        };
-      }
-      case kDOUBLE: {
-        return [order_column_buffer, nulls_first, partition_indices, &ti](
-                   const int64_t lhs, const int64_t rhs) {
-          return fp_comparator<double, int64_t>(
-              order_column_buffer, ti, partition_indices, lhs, rhs, nulls_first);
-        };
-      }
-      default: {
-        LOG(FATAL) << "Invalid float type";
-      }
-    }
-  }
-  throw std::runtime_error("Type not supported yet");
-}
-
+template <class Comparator>
 void WindowFunctionContext::computePartition(
     int64_t* output_for_partition_buff,
     const size_t partition_size,
     const size_t off,
     const Analyzer::WindowFunction* window_func,
-    const std::function<bool(const int64_t lhs, const int64_t rhs)>& comparator) {
+    const Comparator& comparator) {
   switch (window_func->getKind()) {
     case SqlWindowFunctionKind::ROW_NUMBER: {
       const auto row_numbers =
@@ -715,7 +1355,7 @@ void WindowFunctionContext::computePartition(
       const auto partition_row_offsets = payload() + off;
       if (window_function_requires_peer_handling(window_func)) {
         index_to_partition_end(
-            partitionEnd(), off, output_for_partition_buff, partition_size, comparator);
+            partition_end_, off, output_for_partition_buff, partition_size, comparator);
       }
       apply_permutation_to_partition(
           output_for_partition_buff, partition_row_offsets, partition_size);
@@ -748,26 +1388,19 @@ void WindowFunctionContext::fillPartitionStart() {
 }
 
 void WindowFunctionContext::fillPartitionEnd() {
-  CountDistinctDescriptor partition_start_bitmap{CountDistinctImplType::Bitmap,
-                                                 0,
-                                                 static_cast<int64_t>(elem_count_),
-                                                 false,
-                                                 ExecutorDeviceType::CPU,
-                                                 1};
-  partition_end_ = static_cast<int8_t*>(
-      checked_calloc(partition_start_bitmap.bitmapPaddedSizeBytes(), 1));
+  // one byte per row, the peer group ends are marked while computing the partitions
+  partition_end_ = static_cast<int8_t*>(checked_calloc(elem_count_, 1));
   int64_t partition_count = partitionCount();
   std::vector<size_t> partition_offsets(partition_count);
   std::partial_sum(counts(), counts() + partition_count, partition_offsets.begin());
-  auto partition_end_handle = reinterpret_cast<int64_t>(partition_end_);
   for (int64_t i = 0; i < partition_count - 1; ++i) {
     if (partition_offsets[i] == 0) {
       continue;
     }
-    agg_count_distinct_bitmap(&partition_end_handle, partition_offsets[i] - 1, 0);
+    partition_end_[partition_offsets[i] - 1] = 1;
   }
   if (elem_count_) {
-    agg_count_distinct_bitmap(&partition_end_handle, elem_count_ - 1, 0);
+    partition_end_[elem_count_ - 1] = 1;
   }
 }
 
@@ -82,6 +82,14 @@ class WindowFunctionContext {
                       const Analyzer::ColumnVar* col_var,
                       const std::vector<std::shared_ptr<Chunk_NS::Chunk>>& chunks_owner);
 
+  // Adds the buffer of the column argument of an aggregate over an explicit frame to the
+  // context and keeps ownership of it. A column of another type than the argument is
+  // the operand of a cast, its values are cast to the argument type.
+  void setAggregateArgument(
+      const int8_t* column,
+      const SQLTypeInfo& column_ti,
+      const std::vector<std::shared_ptr<Chunk_NS::Chunk>>& chunks_owner);
+
   // Computes the window function result to be used during the actual projection query.
   void compute();
 
@@ -103,14 +111,12 @@ class WindowFunctionContext {
   // Returns a pointer to the partition start bitmap.
   const int8_t* partitionStart() const;
 
-  // Returns a pointer to the partition end bitmap.
+  // Returns a pointer to the partition end markers, one byte per element.
   const int8_t* partitionEnd() const;
 
   // Returns the element count in the columns used by the window function.
   size_t elementCount() const;
 
-  using Comparator = std::function<bool(const int64_t lhs, const int64_t rhs)>;
-
  private:
   // State for a window aggregate. The count field is only used for average.
   struct AggregateState {
@@ -120,17 +126,12 @@ class WindowFunctionContext {
     llvm::Value* row_number = nullptr;
   };
 
-  static Comparator makeComparator(const Analyzer::ColumnVar* col_var,
-                                   const int8_t* partition_values,
-                                   const int32_t* partition_indices,
-                                   const bool nulls_first);
-
-  void computePartition(
-      int64_t* output_for_partition_buff,
-      const size_t partition_size,
-      const size_t off,
-      const Analyzer::WindowFunction* window_func,
-      const std::function<bool(const int64_t lhs, const int64_t rhs)>& comparator);
+  template <class Comparator>
+  void computePartition(int64_t* output_for_partition_buff,
+                        const size_t partition_size,
+                        const size_t off,
+                        const Analyzer::WindowFunction* window_func,
+                        const Comparator& comparator);
 
   void fillPartitionStart();
 
@@ -149,6 +150,10 @@ class WindowFunctionContext {
   std::vector<std::vector<std::shared_ptr<Chunk_NS::Chunk>>> order_columns_owner_;
   // Order column buffers.
   std::vector<const int8_t*> order_columns_;
+  // Keeps ownership of the aggregate argument column.
+  std::vector<std::shared_ptr<Chunk_NS::Chunk>> aggregate_argument_owner_;
+  // Aggregate argument buffer, only set for aggregates over an explicit frame.
+  const int8_t* aggregate_argument_{nullptr};
   // Hash table which contains the partitions specified by the window.
   std::shared_ptr<HashJoin> partitions_;
   // The number of elements in the table.
@@ -158,8 +163,8 @@ class WindowFunctionContext {
   // Markers for partition start used to reinitialize state for aggregate window
   // functions.
   int8_t* partition_start_;
-  // Markers for partition start used to reinitialize state for aggregate window
-  // functions.
+  // Markers for the end of peer groups used to write back the pending outputs of
+  // aggregate window functions, one byte per element.
   int8_t* partition_end_;
   // State for aggregate function over a window.
   AggregateState aggregate_state_;
@@ -207,3 +212,11 @@ class WindowProjectNodeContext {
 bool window_function_is_aggregate(const SqlWindowFunctionKind kind);
 
 bool window_function_requires_peer_handling(const Analyzer::WindowFunction* window_func);
+
+// Returns true iff the window function is an aggregate over an explicit ROWS or RANGE
+// frame. Such aggregates are fully computed before the projection.
+inline bool window_function_is_framed_aggregate(
+    const Analyzer::WindowFunction* window_func) {
+  return window_function_is_aggregate(window_func->getKind()) &&
+         window_func->getFrame().has_value();
+}
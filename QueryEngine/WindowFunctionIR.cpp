@@ -59,6 +59,23 @@ llvm::Value* Executor::codegenWindowFunction(const size_t target_index,
     case SqlWindowFunctionKind::MAX:
     case SqlWindowFunctionKind::SUM:
     case SqlWindowFunctionKind::COUNT: {
+      if (window_function_is_framed_aggregate(window_func)) {
+        // aggregates over explicit frames are fully computed, only load the result
+        const auto& window_func_ti = window_func->get_type_info();
+        const auto output_buff = cgen_state_->llInt(
+            reinterpret_cast<const int64_t>(window_func_context->output()));
+        if (window_func_ti.is_fp()) {
+          const auto value = cgen_state_->emitCall(
+              "percent_window_func", {output_buff, code_generator.posArg(nullptr)});
+          return window_func_ti.get_type() == kFLOAT
+                     ? cgen_state_->ir_builder_.CreateFPTrunc(
+                           value, llvm::Type::getFloatTy(cgen_state_->context_))
+                     : value;
+        }
+        const auto value = cgen_state_->emitCall(
+            "row_number_window_func", {output_buff, code_generator.posArg(nullptr)});
+        return cgen_state_->castToTypeIn(value, window_func_ti.get_size() * 8);
+      }
       return codegenWindowFunctionAggregate(co);
     }
     default: {
@@ -1,7 +1,7 @@
 """Given a list of input files, scan for lines containing UDTF
 specification statements in the following form:
 
-  UDTF: function_name(<arguments>) -> <output column types>
+  UDTF: function_name(<arguments>) -> <output column types> [| <annotation>]
 
 where <arguments> is a comma-separated list of argument types. The
 argument types specifications are:
@@ -21,6 +21,11 @@ argument types specifications are:
 
 The output column types is a comma-separated list of column types, see above.
 
+The optional annotations are:
+  partitionable - the function can be called on consecutive row ranges of its
+  input columns and the outputs concatenated. Requires a RowMultiplier or
+  TableFunctionSpecifiedParameter sizer.
+
 In addition, the following equivalents are suppored:
   Column<T> == ColumnT
   ColumnList<T> == ColumnListT
@@ -135,6 +140,11 @@ for input_file in sys.argv[1:-1]:
             continue
         last_line = None
         line = line[5:]
+        line, *annotations = line.split('|')
+        for a in annotations:
+            if a != 'partitionable':
+                raise ValueError('`%s`: unknown annotation `%s`' % (line, a))
+        is_partitionable = 'partitionable' in annotations
         i = line.find('(')
         j = line.find(')')
         if i == -1 or j == -1:
@@ -214,10 +224,17 @@ for input_file in sys.argv[1:-1]:
         if sizer is None:
             sizer = 'TableFunctionOutputRowSizer{OutputBufferSizeType::kTableFunctionSpecifiedParameter, 1}'
 
+        if is_partitionable:
+            assert ('kUserSpecifiedRowMultiplier' in sizer
+                    or 'kTableFunctionSpecifiedParameter' in sizer), (line, sizer)
+
         input_types = 'std::vector<ExtArgumentType>{%s}' % (', '.join(input_types))
         output_types = 'std::vector<ExtArgumentType>{%s}' % (', '.join(output_types))
         sql_types = 'std::vector<ExtArgumentType>{%s}' % (', '.join(sql_types)) 
-        add = 'TableFunctionsFactory::add("%s", %s, %s, %s, %s);' % (name, sizer, input_types, output_types, sql_types)
+        if is_partitionable:
+            add = 'TableFunctionsFactory::add("%s", %s, %s, %s, %s, /*is_runtime=*/false, /*is_partitionable=*/true);' % (name, sizer, input_types, output_types, sql_types)
+        else:
+            add = 'TableFunctionsFactory::add("%s", %s, %s, %s, %s);' % (name, sizer, input_types, output_types, sql_types)
         add_stmts.append(add)
 
 content = '''
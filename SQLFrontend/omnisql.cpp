@@ -797,6 +797,35 @@ void print_memory_info(ClientContext& context, std::string memory_level) {
 
       tss << std::endl;
     }
+    const auto& pool_stats = nodeIt.buffer_pool_stats;
+    tss << "Buffer Pool: " << pool_stats.hits << " hits, " << pool_stats.misses
+        << " misses, " << pool_stats.evictions << " evictions, "
+        << pool_stats.chunk_index_lock_waits << " of "
+        << pool_stats.chunk_index_lock_acquisitions << " chunk index locks contended"
+        << std::endl;
+    if (!nodeIt.hash_table_caches.empty()) {
+      tss << "Join Hash Table Caches:" << std::endl;
+      tss << "CACHE     ENTRIES    SIZE_MB  MAX_MB       HITS     MISSES  EVICTIONS"
+          << std::endl;
+      for (const auto& cache_info : nodeIt.hash_table_caches) {
+        tss << std::left << std::setfill(' ') << std::setw(9) << cache_info.cache_name
+            << std::right;
+        tss << std::setfill(' ') << std::setw(8) << cache_info.num_entries;
+        tss << std::setfill(' ') << std::setw(11) << cache_info.size_bytes / MB;
+        tss << std::setfill(' ') << std::setw(8) << cache_info.max_size_bytes / MB;
+        tss << std::setfill(' ') << std::setw(11) << cache_info.hits;
+        tss << std::setfill(' ') << std::setw(11) << cache_info.misses;
+        tss << std::setfill(' ') << std::setw(11) << cache_info.evictions;
+        tss << std::endl;
+      }
+    }
+    if (!memory_level.compare("cpu")) {
+      const auto& dict_cache = nodeIt.string_dictionary_cache;
+      tss << "String Dictionary Cache: " << dict_cache.num_entries << " entries, "
+          << dict_cache.size_bytes / MB << " of " << dict_cache.max_size_bytes / MB
+          << " MB, " << dict_cache.hits << " hits, " << dict_cache.misses
+          << " misses, " << dict_cache.evictions << " evictions" << std::endl;
+    }
     tss << "---------------------------------------------------------------" << std::endl;
   }
   std::cout << tss.str() << std::endl;
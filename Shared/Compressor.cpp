@@ -26,6 +26,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 #include <blosc.h>
@@ -36,24 +37,26 @@
 size_t g_compression_limit_bytes{512 * 1024 * 1024};
 
 BloscCompressor::BloscCompressor() {
-  std::lock_guard<std::mutex> compressor_lock_(compressor_lock);
   blosc_init();
   // We use maximum number of threads here since with tests we found that compression
   // speed gets lear scalling with corresponding to the number of threads being used.
 
-  blosc_set_nthreads(std::thread::hardware_concurrency());
+  num_threads_ = std::thread::hardware_concurrency();
 
   // We chosse faster compressor, accepting slightly lower compression ratio
   // https://lz4.github.io/lz4/
 
-  blosc_set_compressor(BLOSC_LZ4HC_COMPNAME);
+  compressor_name_ = BLOSC_LZ4HC_COMPNAME;
 }
 
 BloscCompressor::~BloscCompressor() {
-  std::lock_guard<std::mutex> compressor_lock_(compressor_lock);
   blosc_destroy();
 }
 
+int BloscCompressor::getNumThreads(const size_t buffer_size) const {
+  return buffer_size < g_compression_limit_bytes ? 1 : num_threads_.load();
+}
+
 int64_t BloscCompressor::compress(
     const uint8_t* buffer,
     const size_t buffer_size,
@@ -74,14 +77,17 @@ int64_t BloscCompressor::compress(
   if (buffer_size < min_compressor_bytes && min_compressor_bytes != 0) {
     return 0;
   }
-  std::lock_guard<std::mutex> compressor_lock_(compressor_lock);
-  const auto compressed_len = blosc_compress(5,
-                                             1,
-                                             sizeof(unsigned char),
-                                             buffer_size,
-                                             buffer,
-                                             &compressed_buffer[0],
-                                             compressed_buffer_size);
+  // every call has its own blosc context, concurrent calls don't serialize
+  const auto compressed_len = blosc_compress_ctx(5,
+                                                 1,
+                                                 sizeof(unsigned char),
+                                                 buffer_size,
+                                                 buffer,
+                                                 &compressed_buffer[0],
+                                                 compressed_buffer_size,
+                                                 compressor_name_.load(),
+                                                 0,
+                                                 getNumThreads(buffer_size));
 
   if (compressed_len <= 0) {
     // something went wrong. blosc retrun codes simply don't provide enough information
@@ -125,9 +131,10 @@ size_t BloscCompressor::decompress(const uint8_t* compressed_buffer,
       &compressed_buffer[0], &compressed_buf_len, &decompressed_buf_len, &block_size);
   // check compressed buffer is a blosc compressed buffer.
   if (compressed_buf_len > 0 && decompressed_size == decompressed_buf_len) {
-    std::lock_guard<std::mutex> compressor_lock_(compressor_lock);
-    decompressed_len =
-        blosc_decompress(&compressed_buffer[0], decompressed_buffer, decompressed_size);
+    decompressed_len = blosc_decompress_ctx(&compressed_buffer[0],
+                                            decompressed_buffer,
+                                            decompressed_size,
+                                            getNumThreads(decompressed_size));
   }
 
   if (decompressed_len == 0) {
@@ -221,14 +228,17 @@ BloscCompressor* BloscCompressor::getCompressor() {
 }
 
 int BloscCompressor::setThreads(size_t num_threads) {
-  std::lock_guard<std::mutex> compressor_lock_(compressor_lock);
-  return blosc_set_nthreads(static_cast<int>(num_threads));
+  return num_threads_.exchange(static_cast<int>(num_threads));
 }
 
 int BloscCompressor::setCompressor(std::string& compressor_name) {
-  std::lock_guard<std::mutex> compressor_lock_(compressor_lock);
-  // Blosc is resilent enough to detect that the comprressor that was provided to it was
-  // supported or not. If the compressor is invalid or not supported it will simply keep
-  // current compressor.
-  return blosc_set_compressor(compressor_name.c_str());
+  // If the compressor is invalid or not supported we simply keep the current compressor.
+  const int compressor_code = blosc_compname_to_compcode(compressor_name.c_str());
+  const char* supported_compressor_name{nullptr};
+  if (compressor_code < 0 ||
+      blosc_compcode_to_compname(compressor_code, &supported_compressor_name) < 0) {
+    return -1;
+  }
+  compressor_name_ = supported_compressor_name;
+  return compressor_code;
 }
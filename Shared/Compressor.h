@@ -24,9 +24,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
-#include <mutex>
 #include <stdexcept>
 #include <string>
 
@@ -85,6 +85,11 @@ class BloscCompressor {
 
  private:
   BloscCompressor();
-  std::mutex compressor_lock;
+  // Internal threads of a (de)compression. Buffers below the compression limit, like
+  // table pages, are (de)compressed by the calling thread only.
+  int getNumThreads(const size_t buffer_size) const;
+
+  std::atomic<int> num_threads_;
+  std::atomic<const char*> compressor_name_;
   static BloscCompressor* instance;
 };
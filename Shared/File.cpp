@@ -32,6 +32,15 @@
 #include <stdexcept>
 #include <string>
 
+#ifndef _WIN32
+#include <sys/uio.h>
+#include <climits>
+#endif
+
+#ifdef __linux__
+#include <fcntl.h>
+#endif
+
 #include "Logger/Logger.h"
 #include "OSDependent/omnisci_fs.h"
 
@@ -138,6 +147,59 @@ size_t read(FILE* f, const size_t offset, const size_t size, int8_t* buf) {
   return bytesRead;
 }
 
+size_t readv(FILE* f, const size_t offset, const std::vector<ReadRange>& ranges) {
+  size_t total_size{0};
+  for (const auto& range : ranges) {
+    total_size += range.size;
+  }
+#ifdef _WIN32
+  size_t bytes_read{0};
+  for (const auto& range : ranges) {
+    bytes_read += read(f, offset + bytes_read, range.size, range.buf);
+  }
+#else
+  std::vector<iovec> iovecs;
+  iovecs.reserve(ranges.size());
+  for (const auto& range : ranges) {
+    if (range.size) {
+      iovecs.push_back({range.buf, range.size});
+    }
+  }
+  const int fd = fileno(f);
+  size_t bytes_read{0};
+  size_t iovec_idx{0};
+  while (iovec_idx < iovecs.size()) {
+    const auto iovec_count = std::min(iovecs.size() - iovec_idx, size_t(IOV_MAX));
+    const auto ret = preadv(
+        fd, &iovecs[iovec_idx], static_cast<int>(iovec_count), offset + bytes_read);
+    if (ret < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      LOG(FATAL) << "Error trying to read from file (during preadv) the error was: "
+                 << std::strerror(errno);
+    }
+    CHECK_GT(ret, 0) << "Unexpected end of file at offset " << offset + bytes_read;
+    bytes_read += ret;
+    // skip the buffers filled by a short read and resume within a partially filled one
+    size_t ret_left = ret;
+    while (ret_left) {
+      auto& crt_iovec = iovecs[iovec_idx];
+      if (ret_left >= crt_iovec.iov_len) {
+        ret_left -= crt_iovec.iov_len;
+        ++iovec_idx;
+      } else {
+        crt_iovec.iov_base = static_cast<int8_t*>(crt_iovec.iov_base) + ret_left;
+        crt_iovec.iov_len -= ret_left;
+        ret_left = 0;
+      }
+    }
+  }
+#endif
+  CHECK_EQ(bytes_read, total_size);
+  return bytes_read;
+}
+
 size_t write(FILE* f, const size_t offset, const size_t size, const int8_t* buf) {
   if (g_read_only) {
     LOG(FATAL) << "Error trying to write file '" << f << "', running readonly";
@@ -163,6 +225,22 @@ size_t append(FILE* f, const size_t size, const int8_t* buf) {
   return write(f, fileSize(f), size, buf);
 }
 
+void punchHole(FILE* f, const size_t offset, const size_t size) {
+  if (g_read_only) {
+    LOG(FATAL) << "Error trying to punch a hole in file '" << f << "', running readonly";
+  }
+#ifdef __linux__
+  if (fallocate(fileno(f),
+                FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+                static_cast<off_t>(offset),
+                static_cast<off_t>(size)) != 0 &&
+      errno != EOPNOTSUPP) {
+    LOG(FATAL) << "Error trying to punch a hole in file, the error was: "
+               << std::strerror(errno);
+  }
+#endif
+}
+
 size_t readPage(FILE* f, const size_t pageSize, const size_t pageNum, int8_t* buf) {
   return read(f, pageNum * pageSize, pageSize, buf);
 }
@@ -28,6 +28,7 @@
 #include <cstdio>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "Shared/types.h"
 
@@ -82,6 +83,28 @@ bool removeFile(const std::string basePath, const std::string filename);
  */
 size_t read(FILE* f, const size_t offset, const size_t size, int8_t* buf);
 
+/**
+ * @brief A destination buffer of readv().
+ */
+struct ReadRange {
+  int8_t* buf;
+  size_t size;
+};
+
+/**
+ * @brief Reads consecutive bytes from the offset position in file f into the ranges, in
+ * order, with positioned reads on the file descriptor.
+ *
+ * The position of the file stream is neither used nor moved, so concurrent readers of a
+ * file don't need to serialize. Writes buffered by the file stream must be flushed first.
+ *
+ * @param f Pointer to the FILE.
+ * @param offset The location within the file from which to read.
+ * @param ranges The destination buffers, filled one after the other.
+ * @return size_t The number of bytes read.
+ */
+size_t readv(FILE* f, const size_t offset, const std::vector<ReadRange>& ranges);
+
 /**
  * @brief Writes the specified number of bytes to the offset position in file f from buf.
  *
@@ -105,6 +128,17 @@ size_t write(FILE* f, const size_t offset, const size_t size, const int8_t* buf)
  */
 size_t append(FILE* f, const size_t size, const int8_t* buf);
 
+/**
+ * @brief Releases the disk blocks of the byte range of file f, which then reads as
+ * zeroes. The size of the file is unchanged. Does nothing where the platform or the file
+ * system doesn't support holes. Writes buffered by the file stream must be flushed first.
+ *
+ * @param f Pointer to the FILE.
+ * @param offset The location within the file where the range starts.
+ * @param size The number of bytes of the range.
+ */
+void punchHole(FILE* f, const size_t offset, const size_t size);
+
 /**
  * @brief Reads the specified page from the file f into buf.
  *
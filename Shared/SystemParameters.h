@@ -55,6 +55,9 @@ struct SystemParameters {
   size_t max_gpu_slab_size =
       size_t(1)
       << 32;  // max size of CPU buffer pool memory allocations [bytes], default=4GB
+  bool cpu_buffer_huge_pages = false;  // back CPU buffer pool slabs with huge pages
+  std::string cpu_buffer_numa_policy =
+      "none";  // placement of CPU buffer pool slabs on NUMA nodes: none|interleave|bind
   double gpu_input_mem_limit = 0.9;  // Punt query to CPU if input mem exceeds % GPU mem
   std::string config_file = "";
   std::string ssl_cert_file = "";    // file path to server's certified PKI certificate
@@ -73,6 +76,8 @@ struct SystemParameters {
   size_t calcite_keepalive = false;  // calcite keepalive connection
   int num_executors = 1;
   int num_sessions = -1;  // maximum number of user sessions
+  std::string query_priorities =
+      "";  // comma separated user:priority pairs used by the dispatch queue
 
   SystemParameters() : cuda_block_size(0), cuda_grid_size(0), calcite_max_mem(1024) {}
 };
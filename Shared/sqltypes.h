@@ -778,13 +778,12 @@ class SQLTypeInfo {
       case kSMALLINT:
         switch (compression) {
           case kENCODING_NONE:
+          case kENCODING_RL:
+          case kENCODING_DIFF:
             return sizeof(int16_t);
           case kENCODING_FIXED:
           case kENCODING_SPARSE:
             return comp_param / 8;
-          case kENCODING_RL:
-          case kENCODING_DIFF:
-            break;
           default:
             assert(false);
         }
@@ -792,14 +791,13 @@ class SQLTypeInfo {
       case kINT:
         switch (compression) {
           case kENCODING_NONE:
+          case kENCODING_RL:
+          case kENCODING_DIFF:
             return sizeof(int32_t);
           case kENCODING_FIXED:
           case kENCODING_SPARSE:
           case kENCODING_GEOINT:
             return comp_param / 8;
-          case kENCODING_RL:
-          case kENCODING_DIFF:
-            break;
           default:
             assert(false);
         }
@@ -809,13 +807,12 @@ class SQLTypeInfo {
       case kDECIMAL:
         switch (compression) {
           case kENCODING_NONE:
+          case kENCODING_RL:
+          case kENCODING_DIFF:
             return sizeof(int64_t);
           case kENCODING_FIXED:
           case kENCODING_SPARSE:
             return comp_param / 8;
-          case kENCODING_RL:
-          case kENCODING_DIFF:
-            break;
           default:
             assert(false);
         }
@@ -855,14 +852,14 @@ class SQLTypeInfo {
       case kDATE:
         switch (compression) {
           case kENCODING_NONE:
+          case kENCODING_RL:
+          case kENCODING_DIFF:
             return sizeof(int64_t);
           case kENCODING_FIXED:
             if (type == kTIMESTAMP && dimension > 0) {
               assert(false);  // disable compression for timestamp precisions
             }
             return comp_param / 8;
-          case kENCODING_RL:
-          case kENCODING_DIFF:
           case kENCODING_SPARSE:
             assert(false);
             break;
@@ -924,7 +921,8 @@ int64_t convert_decimal_value_to_scale(const int64_t decimal_value,
 
 inline SQLTypeInfo get_logical_type_info(const SQLTypeInfo& type_info) {
   EncodingType encoding = type_info.get_compression();
-  if (encoding == kENCODING_DATE_IN_DAYS ||
+  if (encoding == kENCODING_DATE_IN_DAYS || encoding == kENCODING_RL ||
+      encoding == kENCODING_DIFF ||
       (encoding == kENCODING_FIXED && type_info.get_type() != kARRAY)) {
     encoding = kENCODING_NONE;
   }
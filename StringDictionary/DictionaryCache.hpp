@@ -18,43 +18,128 @@
 #define DICTIONARY_CACHE_HPP
 
 #include <cstddef>
+#include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 
-template <typename key_t, typename value_t>
+struct DictionaryCacheStats {
+  size_t num_entries{0};
+  size_t size_bytes{0};
+  size_t max_size_bytes{0};
+  size_t hits{0};
+  size_t misses{0};
+  size_t evictions{0};
+};
+
+/**
+ * Thread safe LRU cache of immutable values, bounded by the sum of the sizes the caller
+ * reports for them. Putting a value evicts the least recently used ones until the cache
+ * fits its budget again; values bigger than the whole budget aren't cached. The budget is
+ * read on every put, 0 means unbounded.
+ */
+template <typename key_t, typename value_t, typename hash_t = std::hash<key_t>>
 class DictionaryCache {
  public:
-  DictionaryCache() {}
+  DictionaryCache(const size_t& max_size_bytes) : max_size_bytes_(max_size_bytes) {}
 
-  void put(const key_t& key, const std::shared_ptr<value_t> value) {
-    auto it = cache_items.find(key);
-    if (it != cache_items.end()) {
-      cache_items.erase(it);
+  void put(const key_t& key,
+           const std::shared_ptr<const value_t> value,
+           const size_t size_bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    removeUnlocked(key);
+    const auto max_size_bytes = max_size_bytes_;
+    if (max_size_bytes && size_bytes > max_size_bytes) {
+      return;
+    }
+    lru_items_.push_front({key, value, size_bytes});
+    cache_items_.emplace(key, lru_items_.begin());
+    size_bytes_ += size_bytes;
+    while (max_size_bytes && size_bytes_ > max_size_bytes) {
+      // the new value fits on its own and is the most recently used one
+      eraseUnlocked(std::prev(lru_items_.end()));
+      ++evictions_;
     }
-    cache_items.insert({key, value});
   }
 
-  std::shared_ptr<value_t> get(const key_t& key) {
-    auto it = cache_items.find(key);
-    if (it == cache_items.end()) {
+  std::shared_ptr<const value_t> get(const key_t& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = cache_items_.find(key);
+    if (it == cache_items_.end()) {
+      ++misses_;
       return nullptr;
     }
-    return it->second;
+    ++hits_;
+    lru_items_.splice(lru_items_.begin(), lru_items_, it->second);
+    return it->second->value;
   }
 
-  void remove(const key_t& key) { cache_items.erase(key); }
-
-  bool is_empty() { return cache_items.empty(); }
+  void remove(const key_t& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    removeUnlocked(key);
+  }
 
-  void invalidateInvertedIndex() noexcept {
-    if (!cache_items.empty()) {
-      cache_items.clear();
+  template <typename Predicate>
+  void removeIf(Predicate predicate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = lru_items_.begin(); it != lru_items_.end();) {
+      const auto crt_it = it++;
+      if (predicate(crt_it->key)) {
+        eraseUnlocked(crt_it);
+      }
     }
   }
 
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_items_.clear();
+    lru_items_.clear();
+    size_bytes_ = 0;
+  }
+
+  DictionaryCacheStats getStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DictionaryCacheStats stats;
+    stats.num_entries = lru_items_.size();
+    stats.size_bytes = size_bytes_;
+    stats.max_size_bytes = max_size_bytes_;
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.evictions = evictions_;
+    return stats;
+  }
+
  private:
-  std::unordered_map<key_t, std::shared_ptr<value_t>> cache_items;
+  struct CacheItem {
+    key_t key;
+    std::shared_ptr<const value_t> value;
+    size_t size_bytes;
+  };
+
+  using LruList = std::list<CacheItem>;
+
+  void removeUnlocked(const key_t& key) {
+    auto it = cache_items_.find(key);
+    if (it != cache_items_.end()) {
+      eraseUnlocked(it->second);
+    }
+  }
+
+  void eraseUnlocked(const typename LruList::iterator item_it) {
+    size_bytes_ -= item_it->size_bytes;
+    cache_items_.erase(item_it->key);
+    lru_items_.erase(item_it);
+  }
+
+  const size_t& max_size_bytes_;
+  std::mutex mutex_;
+  LruList lru_items_;  // most recently used first
+  std::unordered_map<key_t, typename LruList::iterator, hash_t> cache_items_;
+  size_t size_bytes_{0};
+  size_t hits_{0};
+  size_t misses_{0};
+  size_t evictions_{0};
 };
 
 #endif  // DICTIONARY_CACHE_HPP
@@ -17,8 +17,10 @@
 #include "StringDictionary/StringDictionary.h"
 
 #include <tbb/parallel_for.h>
+#include <algorithm>
 #include <boost/filesystem/operations.hpp>
 #include <boost/filesystem/path.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/sort/spreadsort/string_sort.hpp>
 #include <future>
 #include <iostream>
@@ -37,6 +39,7 @@
 #include "Shared/sqltypes.h"
 #include "Shared/thread_count.h"
 #include "StringDictionaryClient.h"
+#include "TrigramIndex.h"
 #include "Utils/Regexp.h"
 #include "Utils/StringLike.h"
 
@@ -88,6 +91,8 @@ string_dict_hash_t hash_string(const std::string_view& str) {
 }  // namespace
 
 bool g_enable_stringdict_parallel{false};
+bool g_enable_string_dict_trigram_index{false};
+size_t g_string_dict_cache_max_size_bytes{size_t(1) << 30};
 constexpr int32_t StringDictionary::INVALID_STR_ID;
 constexpr size_t StringDictionary::MAX_STRLEN;
 constexpr size_t StringDictionary::MAX_STRCOUNT;
@@ -109,8 +114,7 @@ StringDictionary::StringDictionary(const std::string& folder,
     , payload_map_(nullptr)
     , offset_file_size_(0)
     , payload_file_size_(0)
-    , payload_file_off_(0)
-    , strings_cache_(nullptr) {
+    , payload_file_off_(0) {
   if (!isTemp && folder.empty()) {
     return;
   }
@@ -264,12 +268,14 @@ size_t StringDictionary::getNumStringsFromStorage(const size_t storage_slots) co
 StringDictionary::StringDictionary(const LeafHostInfo& host, const DictRef dict_ref)
     : folder_("DB_" + std::to_string(dict_ref.dbId) + "_DICT_" +
               std::to_string(dict_ref.dictId))
-    , strings_cache_(nullptr)
     , client_(new StringDictionaryClient(host, dict_ref, true))
     , client_no_timeout_(new StringDictionaryClient(host, dict_ref, false)) {}
 
 StringDictionary::~StringDictionary() noexcept {
   free(CANARY_BUFFER);
+  if (has_cache_entries_) {
+    getCache().removeIf([this](const CacheKey& key) { return key.dict == this; });
+  }
   if (client_) {
     return;
   }
@@ -369,7 +375,6 @@ void StringDictionary::getOrAddBulk(const std::vector<String>& input_strings,
   }
   mapd_lock_guard<mapd_shared_mutex> write_lock(rw_mutex_);
 
-  const size_t initial_str_count = str_count_;
   size_t idx = 0;
   for (const auto& input_string : input_strings) {
     if (input_string.empty()) {
@@ -411,10 +416,6 @@ void StringDictionary::getOrAddBulk(const std::vector<String>& input_strings,
     output_string_ids[idx++] = string_id;
     ++str_count_;
   }
-  const size_t num_strings_added = str_count_ - initial_str_count;
-  if (num_strings_added > 0) {
-    invalidateInvertedIndex();
-  }
 }
 
 template <class T, class String>
@@ -494,11 +495,7 @@ void StringDictionary::getOrAddBulkParallel(const std::vector<String>& input_str
     output_string_ids[input_string_idx++] = shadow_str_count++;
   }
   appendToStorageBulk(input_strings, string_memory_ids, sum_new_string_lengths);
-  const size_t num_strings_added = shadow_str_count - str_count_;
   str_count_ = shadow_str_count;
-  if (num_strings_added > 0) {
-    invalidateInvertedIndex();
-  }
 }
 template void StringDictionary::getOrAddBulk(const std::vector<std::string>& string_vec,
                                              uint8_t* encoded_vec);
@@ -607,22 +604,22 @@ size_t StringDictionary::storageEntryCount() const {
 
 namespace {
 
-bool is_like(const std::string& str,
+bool is_like(const std::string_view str,
              const std::string& pattern,
              const bool icase,
              const bool is_simple,
              const char escape) {
   return icase
              ? (is_simple ? string_ilike_simple(
-                                str.c_str(), str.size(), pattern.c_str(), pattern.size())
-                          : string_ilike(str.c_str(),
+                                str.data(), str.size(), pattern.c_str(), pattern.size())
+                          : string_ilike(str.data(),
                                          str.size(),
                                          pattern.c_str(),
                                          pattern.size(),
                                          escape))
              : (is_simple ? string_like_simple(
-                                str.c_str(), str.size(), pattern.c_str(), pattern.size())
-                          : string_like(str.c_str(),
+                                str.data(), str.size(), pattern.c_str(), pattern.size())
+                          : string_like(str.data(),
                                         str.size(),
                                         pattern.c_str(),
                                         pattern.size(),
@@ -631,114 +628,152 @@ bool is_like(const std::string& str,
 
 }  // namespace
 
-std::vector<int32_t> StringDictionary::getLike(const std::string& pattern,
-                                               const bool icase,
-                                               const bool is_simple,
-                                               const char escape,
-                                               const size_t generation) const {
-  mapd_lock_guard<mapd_shared_mutex> write_lock(rw_mutex_);
-  if (client_) {
-    return client_->get_like(pattern, icase, is_simple, escape, generation);
-  }
-  const auto cache_key = std::make_tuple(pattern, icase, is_simple, escape);
-  const auto it = like_cache_.find(cache_key);
-  if (it != like_cache_.end()) {
-    return it->second;
-  }
-  std::vector<int32_t> result;
-  std::vector<std::thread> workers;
-  int worker_count = cpu_threads();
-  CHECK_GT(worker_count, 0);
+std::optional<std::vector<int32_t>> StringDictionary::getTrigramCandidates(
+    const std::vector<std::string>& literals,
+    const size_t generation) const {
+  // must be called with the read lock held, the index reads strings from storage
+  if (!g_enable_string_dict_trigram_index ||
+      std::none_of(literals.begin(), literals.end(), [](const std::string& literal) {
+        return literal.size() >= 3;
+      })) {
+    return std::nullopt;
+  }
+  std::lock_guard<std::mutex> trigram_index_lock(trigram_index_mutex_);
+  if (!trigram_index_) {
+    const auto index_path =
+        isTemp_ ? std::string{}
+                : (boost::filesystem::path(folder_) / "DictTrigrams").string();
+    trigram_index_ = std::make_unique<TrigramIndex>(index_path);
+    trigram_index_->load(str_count_);
+  }
+  trigram_index_->extend(generation, [this](const int32_t string_id) {
+    return getStringFromStorageFast(string_id);
+  });
+  return trigram_index_->getCandidates(literals, generation);
+}
+
+template <typename Predicate>
+std::vector<int32_t> StringDictionary::getMatchingIds(
+    const std::optional<std::vector<int32_t>>& candidates,
+    const size_t begin_id,
+    const size_t end_id,
+    Predicate predicate) const {
+  // without candidates, all the strings in [begin_id, end_id) are checked
+  CHECK_LE(begin_id, end_id);
+  const size_t num_strings = candidates ? candidates->size() : end_id - begin_id;
+  const size_t worker_count =
+      num_strings > 10000 ? static_cast<size_t>(cpu_threads()) : size_t(1);
+  CHECK_GT(worker_count, size_t(0));
+  const auto stride = (num_strings + worker_count - 1) / worker_count;
   std::vector<std::vector<int32_t>> worker_results(worker_count);
-  CHECK_LE(generation, str_count_);
-  for (int worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
-    workers.emplace_back([&worker_results,
-                          &pattern,
-                          generation,
-                          icase,
-                          is_simple,
-                          escape,
-                          worker_idx,
-                          worker_count,
-                          this]() {
-      for (size_t string_id = worker_idx; string_id < generation;
-           string_id += worker_count) {
-        const auto str = getStringUnlocked(string_id);
-        if (is_like(str, pattern, icase, is_simple, escape)) {
-          worker_results[worker_idx].push_back(string_id);
-        }
+  auto scan = [&candidates,
+               &predicate,
+               &worker_results,
+               begin_id,
+               num_strings,
+               stride,
+               this](const size_t worker_idx) {
+    const auto end_idx = std::min((worker_idx + 1) * stride, num_strings);
+    for (size_t idx = worker_idx * stride; idx < end_idx; ++idx) {
+      const int32_t string_id = candidates ? (*candidates)[idx] : begin_id + idx;
+      if (predicate(getStringFromStorageFast(string_id))) {
+        worker_results[worker_idx].push_back(string_id);
       }
-    });
-  }
-  for (auto& worker : workers) {
-    worker.join();
+    }
+  };
+  if (worker_count == 1) {
+    scan(0);
+  } else {
+    std::vector<std::future<void>> workers;
+    for (size_t worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
+      workers.push_back(std::async(std::launch::async, scan, worker_idx));
+    }
+    for (auto& worker : workers) {
+      worker.get();
+    }
   }
+  std::vector<int32_t> result;
   for (const auto& worker_result : worker_results) {
     result.insert(result.end(), worker_result.begin(), worker_result.end());
   }
-  // place result into cache for reuse if similar query
-  const auto it_ok = like_cache_.insert(std::make_pair(cache_key, result));
+  return result;
+}
 
-  CHECK(it_ok.second);
+template <typename Predicate>
+std::vector<int32_t> StringDictionary::getCachedMatchingIds(
+    const CacheKey& cache_key,
+    const std::vector<std::string>& literals,
+    const size_t generation,
+    Predicate predicate) const {
+  // must be called with the read lock held
+  CHECK_LE(generation, str_count_);
+  const auto cached = getCache().get(cache_key);
+  if (cached && cached->generation >= generation) {
+    return {cached->ids.begin(),
+            std::lower_bound(cached->ids.begin(),
+                             cached->ids.end(),
+                             static_cast<int32_t>(generation))};
+  }
+  // only the strings added since the cached generation need to be checked
+  const size_t begin_id = cached ? cached->generation : 0;
+  auto candidates = getTrigramCandidates(literals, generation);
+  if (candidates && begin_id) {
+    candidates->erase(candidates->begin(),
+                      std::lower_bound(candidates->begin(),
+                                       candidates->end(),
+                                       static_cast<int32_t>(begin_id)));
+  }
+  auto new_ids = getMatchingIds(candidates, begin_id, generation, predicate);
+  auto entry = std::make_shared<CacheEntry>();
+  entry->generation = generation;
+  if (cached) {
+    entry->ids.reserve(cached->ids.size() + new_ids.size());
+    entry->ids.insert(entry->ids.end(), cached->ids.begin(), cached->ids.end());
+    entry->ids.insert(entry->ids.end(), new_ids.begin(), new_ids.end());
+  } else {
+    entry->ids = std::move(new_ids);
+  }
+  // a concurrent query for the same pattern might have placed it already
+  putInCache(cache_key, entry);
+  return entry->ids;
+}
 
-  return result;
+std::vector<int32_t> StringDictionary::getLike(const std::string& pattern,
+                                               const bool icase,
+                                               const bool is_simple,
+                                               const char escape,
+                                               const size_t generation) const {
+  mapd_shared_lock<mapd_shared_mutex> read_lock(rw_mutex_);
+  if (client_) {
+    return client_->get_like(pattern, icase, is_simple, escape, generation);
+  }
+  return getCachedMatchingIds(
+      makeCacheKey(CacheKind::kLike, pattern, icase, is_simple, escape),
+      TrigramIndex::getLikeLiterals(pattern, is_simple, escape),
+      generation,
+      [&](const std::string_view str) {
+        return is_like(str, pattern, icase, is_simple, escape);
+      });
 }
 
 std::vector<int32_t> StringDictionary::getEquals(std::string pattern,
                                                  std::string comp_operator,
                                                  size_t generation) {
-  std::vector<int32_t> result;
-  auto eq_id_itr = equal_cache_.find(pattern);
-  int32_t eq_id = MAX_STRLEN + 1;
-  int32_t cur_size = str_count_;
-  if (eq_id_itr != equal_cache_.end()) {
-    auto eq_id = eq_id_itr->second;
-    if (comp_operator == "=") {
-      result.push_back(eq_id);
-    } else {
-      for (int32_t idx = 0; idx <= cur_size; idx++) {
-        if (idx == eq_id) {
-          continue;
-        }
-        result.push_back(idx);
-      }
-    }
-  } else {
-    std::vector<std::thread> workers;
-    int worker_count = cpu_threads();
-    CHECK_GT(worker_count, 0);
-    std::vector<std::vector<int32_t>> worker_results(worker_count);
-    CHECK_LE(generation, str_count_);
-    for (int worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
-      workers.emplace_back(
-          [&worker_results, &pattern, generation, worker_idx, worker_count, this]() {
-            for (size_t string_id = worker_idx; string_id < generation;
-                 string_id += worker_count) {
-              const auto str = getStringUnlocked(string_id);
-              if (str == pattern) {
-                worker_results[worker_idx].push_back(string_id);
-              }
-            }
-          });
-    }
-    for (auto& worker : workers) {
-      worker.join();
-    }
-    for (const auto& worker_result : worker_results) {
-      result.insert(result.end(), worker_result.begin(), worker_result.end());
-    }
-    if (result.size() > 0) {
-      const auto it_ok = equal_cache_.insert(std::make_pair(pattern, result[0]));
-      CHECK(it_ok.second);
-      eq_id = result[0];
-    }
-    if (comp_operator == "<>") {
-      for (int32_t idx = 0; idx <= cur_size; idx++) {
-        if (idx == eq_id) {
-          continue;
-        }
-        result.push_back(idx);
+  // strings are unique, at most one id matches
+  auto result = getCachedMatchingIds(
+      makeCacheKey(CacheKind::kEqual, pattern),
+      {pattern},
+      generation,
+      [&pattern](const std::string_view str) { return str == pattern; });
+  if (comp_operator == "<>") {
+    const int32_t eq_id = result.empty() ? MAX_STRLEN + 1 : result[0];
+    const int32_t cur_size = str_count_;
+    result.clear();
+    for (int32_t idx = 0; idx <= cur_size; idx++) {
+      if (idx == eq_id) {
+        continue;
       }
+      result.push_back(idx);
     }
   }
   return result;
@@ -762,10 +797,13 @@ std::vector<int32_t> StringDictionary::getCompare(const std::string& pattern,
 
     buildSortedCache();
   }
-  auto cache_index = compare_cache_.get(pattern);
-
-  if (!cache_index) {
-    cache_index = std::make_shared<StringDictionary::compare_cache_value_t>();
+  const auto cache_key = makeCacheKey(CacheKind::kCompare, pattern);
+  auto cached = getCache().get(cache_key);
+  // a cached index is only valid for the sorted cache it was computed on
+  if (!cached || cached->generation != sorted_cache.size()) {
+    auto entry = std::make_shared<CacheEntry>();
+    entry->generation = sorted_cache.size();
+    auto cache_index = &entry->compare_index;
     const auto cache_itr = std::lower_bound(
         sorted_cache.begin(),
         sorted_cache.end(),
@@ -790,8 +828,10 @@ std::vector<int32_t> StringDictionary::getCompare(const std::string& pattern,
       }
     }
 
-    compare_cache_.put(pattern, cache_index);
+    putInCache(cache_key, entry);
+    cached = entry;
   }
+  const auto cache_index = &cached->compare_index;
 
   // since we have a cache in form of vector of ints which is sorted according to
   // corresponding strings in the dictionary all we need is the index of the element
@@ -897,10 +937,10 @@ std::vector<int32_t> StringDictionary::getCompare(const std::string& pattern,
 
 namespace {
 
-bool is_regexp_like(const std::string& str,
+bool is_regexp_like(const std::string_view str,
                     const std::string& pattern,
                     const char escape) {
-  return regexp_like(str.c_str(), str.size(), pattern.c_str(), pattern.size(), escape);
+  return regexp_like(str.data(), str.size(), pattern.c_str(), pattern.size(), escape);
 }
 
 }  // namespace
@@ -908,48 +948,15 @@ bool is_regexp_like(const std::string& str,
 std::vector<int32_t> StringDictionary::getRegexpLike(const std::string& pattern,
                                                      const char escape,
                                                      const size_t generation) const {
-  mapd_lock_guard<mapd_shared_mutex> write_lock(rw_mutex_);
+  mapd_shared_lock<mapd_shared_mutex> read_lock(rw_mutex_);
   if (client_) {
     return client_->get_regexp_like(pattern, escape, generation);
   }
-  const auto cache_key = std::make_pair(pattern, escape);
-  const auto it = regex_cache_.find(cache_key);
-  if (it != regex_cache_.end()) {
-    return it->second;
-  }
-  std::vector<int32_t> result;
-  std::vector<std::thread> workers;
-  int worker_count = cpu_threads();
-  CHECK_GT(worker_count, 0);
-  std::vector<std::vector<int32_t>> worker_results(worker_count);
-  CHECK_LE(generation, str_count_);
-  for (int worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
-    workers.emplace_back([&worker_results,
-                          &pattern,
-                          generation,
-                          escape,
-                          worker_idx,
-                          worker_count,
-                          this]() {
-      for (size_t string_id = worker_idx; string_id < generation;
-           string_id += worker_count) {
-        const auto str = getStringUnlocked(string_id);
-        if (is_regexp_like(str, pattern, escape)) {
-          worker_results[worker_idx].push_back(string_id);
-        }
-      }
-    });
-  }
-  for (auto& worker : workers) {
-    worker.join();
-  }
-  for (const auto& worker_result : worker_results) {
-    result.insert(result.end(), worker_result.begin(), worker_result.end());
-  }
-  const auto it_ok = regex_cache_.insert(std::make_pair(cache_key, result));
-  CHECK(it_ok.second);
-
-  return result;
+  return getCachedMatchingIds(
+      makeCacheKey(CacheKind::kRegexpLike, pattern, false, false, escape),
+      TrigramIndex::getRegexpLiterals(pattern),
+      generation,
+      [&](const std::string_view str) { return is_regexp_like(str, pattern, escape); });
 }
 
 std::shared_ptr<const std::vector<std::string>> StringDictionary::copyStrings() const {
@@ -960,13 +967,21 @@ std::shared_ptr<const std::vector<std::string>> StringDictionary::copyStrings()
         "copying dictionaries from remote server is not supported yet.");
   }
 
-  if (strings_cache_) {
-    return strings_cache_;
+  const auto cached = strings_cache_;
+  if (cached && cached->size() == str_count_) {
+    return cached;
   }
 
-  strings_cache_ = std::make_shared<std::vector<std::string>>();
-  strings_cache_->reserve(str_count_);
-  const bool multithreaded = str_count_ > 10000;
+  // only the strings added since the cached copy need to be read from storage, the
+  // cached copy stays immutable for the callers still holding it
+  auto strings = std::make_shared<std::vector<std::string>>();
+  strings->reserve(str_count_);
+  const size_t first_id = cached ? cached->size() : 0;
+  if (cached) {
+    strings->insert(strings->end(), cached->begin(), cached->end());
+  }
+  const size_t num_new_strings = str_count_ - first_id;
+  const bool multithreaded = num_new_strings > 10000;
   const auto worker_count =
       multithreaded ? static_cast<size_t>(cpu_threads()) : size_t(1);
   CHECK_GT(worker_count, 0UL);
@@ -982,8 +997,10 @@ std::shared_ptr<const std::vector<std::string>> StringDictionary::copyStrings()
   };
   if (multithreaded) {
     std::vector<std::future<void>> workers;
-    const auto stride = (str_count_ + (worker_count - 1)) / worker_count;
-    for (size_t worker_idx = 0, start = 0, end = std::min(start + stride, str_count_);
+    const auto stride = (num_new_strings + (worker_count - 1)) / worker_count;
+    for (size_t worker_idx = 0,
+                start = first_id,
+                end = std::min(start + stride, str_count_);
          worker_idx < worker_count && start < str_count_;
          ++worker_idx, start += stride, end = std::min(start + stride, str_count_)) {
       workers.push_back(std::async(
@@ -994,16 +1011,55 @@ std::shared_ptr<const std::vector<std::string>> StringDictionary::copyStrings()
     }
   } else {
     CHECK_EQ(worker_results.size(), size_t(1));
-    copy(worker_results[0], 0, str_count_);
+    copy(worker_results[0], first_id, str_count_);
   }
 
-  for (const auto& worker_result : worker_results) {
-    strings_cache_->insert(
-        strings_cache_->end(), worker_result.begin(), worker_result.end());
+  for (auto& worker_result : worker_results) {
+    strings->insert(strings->end(),
+                    std::make_move_iterator(worker_result.begin()),
+                    std::make_move_iterator(worker_result.end()));
   }
+  strings_cache_ = strings;
   return strings_cache_;
 }
 
+size_t StringDictionary::CacheKeyHash::operator()(const CacheKey& key) const {
+  size_t hash = std::hash<std::string>{}(key.pattern);
+  boost::hash_combine(hash, key.dict);
+  boost::hash_combine(hash, static_cast<int>(key.kind));
+  boost::hash_combine(hash, key.icase);
+  boost::hash_combine(hash, key.is_simple);
+  boost::hash_combine(hash, key.escape);
+  return hash;
+}
+
+StringDictionary::Cache& StringDictionary::getCache() {
+  // never destroyed, dictionaries with static storage duration drop their entries on
+  // destruction
+  static auto cache = new Cache(g_string_dict_cache_max_size_bytes);
+  return *cache;
+}
+
+DictionaryCacheStats StringDictionary::getCacheStats() {
+  return getCache().getStats();
+}
+
+StringDictionary::CacheKey StringDictionary::makeCacheKey(const CacheKind kind,
+                                                          const std::string& pattern,
+                                                          const bool icase,
+                                                          const bool is_simple,
+                                                          const char escape) const {
+  return {this, kind, pattern, icase, is_simple, escape};
+}
+
+void StringDictionary::putInCache(const CacheKey& key,
+                                  const std::shared_ptr<const CacheEntry>& entry) const {
+  const size_t size_bytes = sizeof(CacheKey) + key.pattern.size() + sizeof(CacheEntry) +
+                            entry->ids.capacity() * sizeof(int32_t);
+  has_cache_entries_ = true;
+  getCache().put(key, entry, size_bytes);
+}
+
 bool StringDictionary::fillRateIsHigh(const size_t num_strings) const noexcept {
   return string_id_string_dict_hash_table_.size() <= num_strings * 2;
 }
@@ -1098,7 +1154,6 @@ int32_t StringDictionary::getOrAddImpl(const std::string_view& str) noexcept {
       hash_cache_[str_count_] = hash;
     }
     ++str_count_;
-    invalidateInvertedIndex();
   }
   return string_id_string_dict_hash_table_[bucket];
 }
@@ -1370,19 +1425,6 @@ void* StringDictionary::addMemoryCapacity(void* addr,
   return new_addr;
 }
 
-void StringDictionary::invalidateInvertedIndex() noexcept {
-  if (!like_cache_.empty()) {
-    decltype(like_cache_)().swap(like_cache_);
-  }
-  if (!regex_cache_.empty()) {
-    decltype(regex_cache_)().swap(regex_cache_);
-  }
-  if (!equal_cache_.empty()) {
-    decltype(equal_cache_)().swap(equal_cache_);
-  }
-  compare_cache_.invalidateInvertedIndex();
-}
-
 // TODO 5 Mar 2021 Nothing will undo the writes to dictionary currently on a failed
 // load.  The next write to the dictionary that does checkpoint will make the
 // uncheckpointed data be written to disk. Only option is a table truncate, and thats
@@ -1403,6 +1445,13 @@ bool StringDictionary::checkpoint() noexcept {
         (omnisci::msync((void*)payload_map_, payload_file_size_, /*async=*/false) == 0);
   ret = ret && (omnisci::fsync(offset_fd_) == 0);
   ret = ret && (omnisci::fsync(payload_fd_) == 0);
+  if (ret) {
+    // the trigram index can always be rebuilt, failing to persist it isn't an error
+    std::lock_guard<std::mutex> trigram_index_lock(trigram_index_mutex_);
+    if (trigram_index_) {
+      trigram_index_->save();
+    }
+  }
   return ret;
 }
 
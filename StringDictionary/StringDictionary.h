@@ -22,15 +22,23 @@
 #include "DictionaryCache.hpp"
 #include "LeafHostInfo.h"
 
+#include <atomic>
 #include <future>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <vector>
 
 extern bool g_enable_stringdict_parallel;
+extern bool g_enable_string_dict_trigram_index;
+// Byte budget of the pattern match caches shared by all dictionaries, 0 means unbounded.
+extern size_t g_string_dict_cache_max_size_bytes;
 
 class StringDictionaryClient;
+class TrigramIndex;
 
 class DictPayloadUnavailable : public std::runtime_error {
  public:
@@ -106,6 +114,9 @@ class StringDictionary {
       const StringDictionary* source_dict,
       const std::map<int32_t, std::string> transient_mapping = {});
 
+  // sizes and hit rates of the pattern match caches of all dictionaries
+  static DictionaryCacheStats getCacheStats();
+
   static void populate_string_array_ids(
       std::vector<std::vector<int32_t>>& dest_array_ids,
       StringDictionary* dest_dict,
@@ -137,6 +148,40 @@ class StringDictionary {
     bool canary;
   };
 
+  enum class CacheKind { kLike, kRegexpLike, kEqual, kCompare };
+
+  struct CacheKey {
+    const StringDictionary* dict;
+    CacheKind kind;
+    std::string pattern;
+    bool icase;
+    bool is_simple;
+    char escape;
+
+    bool operator==(const CacheKey& that) const {
+      return dict == that.dict && kind == that.kind && pattern == that.pattern &&
+             icase == that.icase && is_simple == that.is_simple &&
+             escape == that.escape;
+    }
+  };
+
+  struct CacheKeyHash {
+    size_t operator()(const CacheKey& key) const;
+  };
+
+  // Cached results are immutable and cover the string ids below generation. Since ids
+  // are never reused, an entry is brought up to date after appends by checking the new
+  // strings only.
+  struct CacheEntry {
+    size_t generation{0};
+    std::vector<int32_t> ids;  // sorted ids matching a LIKE, REGEXP or equality pattern
+    compare_cache_value_t compare_index{0, 0};  // generation is sorted_cache.size()
+  };
+
+  using Cache = DictionaryCache<CacheKey, CacheEntry, CacheKeyHash>;
+
+  static Cache& getCache();
+
   void processDictionaryFutures(
       std::vector<std::future<std::vector<std::pair<string_dict_hash_t, unsigned int>>>>&
           dictionary_futures);
@@ -193,7 +238,27 @@ class StringDictionary {
   void* addMemoryCapacity(void* addr,
                           size_t& mem_size,
                           const size_t min_capacity_requested = 0) noexcept;
-  void invalidateInvertedIndex() noexcept;
+  CacheKey makeCacheKey(const CacheKind kind,
+                        const std::string& pattern = {},
+                        const bool icase = false,
+                        const bool is_simple = false,
+                        const char escape = 0) const;
+  void putInCache(const CacheKey& key,
+                  const std::shared_ptr<const CacheEntry>& entry) const;
+  std::optional<std::vector<int32_t>> getTrigramCandidates(
+      const std::vector<std::string>& literals,
+      const size_t generation) const;
+  template <typename Predicate>
+  std::vector<int32_t> getMatchingIds(
+      const std::optional<std::vector<int32_t>>& candidates,
+      const size_t begin_id,
+      const size_t end_id,
+      Predicate predicate) const;
+  template <typename Predicate>
+  std::vector<int32_t> getCachedMatchingIds(const CacheKey& cache_key,
+                                            const std::vector<std::string>& literals,
+                                            const size_t generation,
+                                            Predicate predicate) const;
   std::vector<int32_t> getEquals(std::string pattern,
                                  std::string comp_operator,
                                  size_t generation);
@@ -220,12 +285,12 @@ class StringDictionary {
   size_t payload_file_size_;
   size_t payload_file_off_;
   mutable mapd_shared_mutex rw_mutex_;
-  mutable std::map<std::tuple<std::string, bool, bool, char>, std::vector<int32_t>>
-      like_cache_;
-  mutable std::map<std::pair<std::string, char>, std::vector<int32_t>> regex_cache_;
-  mutable std::map<std::string, int32_t> equal_cache_;
-  mutable DictionaryCache<std::string, compare_cache_value_t> compare_cache_;
-  mutable std::shared_ptr<std::vector<std::string>> strings_cache_;
+  mutable std::unique_ptr<TrigramIndex> trigram_index_;  // built by the first LIKE
+  mutable std::mutex trigram_index_mutex_;
+  mutable std::atomic<bool> has_cache_entries_{false};
+  // copyStrings() result, kept out of the pattern cache so a large dictionary neither
+  // misses its budget nor evicts the LIKE and REGEXP results
+  mutable std::shared_ptr<const std::vector<std::string>> strings_cache_;
   std::unique_ptr<StringDictionaryClient> client_;
   std::unique_ptr<StringDictionaryClient> client_no_timeout_;
 
@@ -0,0 +1,346 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StringDictionary/TrigramIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <future>
+
+#include "Logger/Logger.h"
+#include "Shared/thread_count.h"
+
+namespace {
+
+using Postings = std::unordered_map<uint32_t, std::vector<int32_t>>;
+
+inline char lowercase(const char c) {
+  return ('A' <= c && c <= 'Z') ? 'a' + (c - 'A') : c;
+}
+
+inline uint32_t get_trigram(const char* str) {
+  return (static_cast<uint32_t>(static_cast<uint8_t>(lowercase(str[0]))) << 16) |
+         (static_cast<uint32_t>(static_cast<uint8_t>(lowercase(str[1]))) << 8) |
+         static_cast<uint32_t>(static_cast<uint8_t>(lowercase(str[2])));
+}
+
+void index_strings(Postings& postings,
+                   const int32_t begin_id,
+                   const int32_t end_id,
+                   const std::function<std::string_view(const int32_t)>& get_string) {
+  std::vector<uint32_t> trigrams;
+  for (int32_t string_id = begin_id; string_id < end_id; ++string_id) {
+    const auto str = get_string(string_id);
+    trigrams.clear();
+    for (size_t i = 0; i + 2 < str.size(); ++i) {
+      trigrams.push_back(get_trigram(str.data() + i));
+    }
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+    for (const auto trigram : trigrams) {
+      postings[trigram].push_back(string_id);
+    }
+  }
+}
+
+template <typename T>
+void write_value(std::ofstream& file, const T value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+T read_value(std::ifstream& file) {
+  T value{0};
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return value;
+}
+
+}  // namespace
+
+void TrigramIndex::extend(
+    const size_t num_strings,
+    const std::function<std::string_view(const int32_t)>& get_string) {
+  if (num_strings <= num_indexed_strings_) {
+    return;
+  }
+  const size_t num_new_strings = num_strings - num_indexed_strings_;
+  const size_t worker_count =
+      num_new_strings > 10000 ? static_cast<size_t>(cpu_threads()) : size_t(1);
+  CHECK_GT(worker_count, size_t(0));
+  const auto stride = (num_new_strings + worker_count - 1) / worker_count;
+  std::vector<Postings> worker_postings(worker_count);
+  std::vector<std::future<void>> workers;
+  for (size_t worker_idx = 0; worker_idx < worker_count; ++worker_idx) {
+    const auto begin_id = num_indexed_strings_ + worker_idx * stride;
+    const auto end_id = std::min(begin_id + stride, num_strings);
+    if (begin_id >= end_id) {
+      break;
+    }
+    workers.push_back(std::async(std::launch::async,
+                                 index_strings,
+                                 std::ref(worker_postings[worker_idx]),
+                                 static_cast<int32_t>(begin_id),
+                                 static_cast<int32_t>(end_id),
+                                 std::cref(get_string)));
+  }
+  for (auto& worker : workers) {
+    worker.get();
+  }
+  // the workers index consecutive id ranges, appending their postings in order keeps
+  // the id lists sorted
+  for (auto& postings : worker_postings) {
+    for (auto& [trigram, string_ids] : postings) {
+      auto& all_string_ids = postings_[trigram];
+      all_string_ids.insert(all_string_ids.end(), string_ids.begin(), string_ids.end());
+    }
+    Postings().swap(postings);
+  }
+  num_indexed_strings_ = num_strings;
+  dirty_ = true;
+}
+
+std::optional<std::vector<int32_t>> TrigramIndex::getCandidates(
+    const std::vector<std::string>& literals,
+    const size_t generation) const {
+  CHECK_LE(generation, num_indexed_strings_);
+  std::vector<uint32_t> trigrams;
+  for (const auto& literal : literals) {
+    for (size_t i = 0; i + 2 < literal.size(); ++i) {
+      trigrams.push_back(get_trigram(literal.data() + i));
+    }
+  }
+  if (trigrams.empty()) {
+    return std::nullopt;
+  }
+  std::sort(trigrams.begin(), trigrams.end());
+  trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+  std::vector<const std::vector<int32_t>*> string_id_lists;
+  for (const auto trigram : trigrams) {
+    const auto it = postings_.find(trigram);
+    if (it == postings_.end()) {
+      return std::vector<int32_t>{};
+    }
+    string_id_lists.push_back(&it->second);
+  }
+  // intersect the shortest lists first
+  std::sort(string_id_lists.begin(),
+            string_id_lists.end(),
+            [](const auto lhs, const auto rhs) { return lhs->size() < rhs->size(); });
+  const auto& shortest_list = *string_id_lists.front();
+  std::vector<int32_t> candidates(
+      shortest_list.begin(),
+      std::lower_bound(
+          shortest_list.begin(), shortest_list.end(), static_cast<int32_t>(generation)));
+  std::vector<int32_t> intersection;
+  for (size_t i = 1; i < string_id_lists.size() && !candidates.empty(); ++i) {
+    intersection.clear();
+    std::set_intersection(candidates.begin(),
+                          candidates.end(),
+                          string_id_lists[i]->begin(),
+                          string_id_lists[i]->end(),
+                          std::back_inserter(intersection));
+    candidates.swap(intersection);
+  }
+  return candidates;
+}
+
+bool TrigramIndex::load(const size_t max_num_strings) {
+  if (path_.empty()) {
+    return false;
+  }
+  std::ifstream file(path_, std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  if (read_value<int32_t>(file) != kFileFormatVersion) {
+    LOG(WARNING) << "Ignoring trigram index " << path_ << " of an unknown version";
+    return false;
+  }
+  const auto num_indexed_strings = read_value<uint64_t>(file);
+  if (!file || num_indexed_strings > max_num_strings) {
+    LOG(WARNING) << "Ignoring trigram index " << path_
+                 << " which doesn't match the dictionary";
+    return false;
+  }
+  Postings postings;
+  const auto num_trigrams = read_value<uint64_t>(file);
+  for (uint64_t i = 0; i < num_trigrams && file; ++i) {
+    const auto trigram = read_value<uint32_t>(file);
+    const auto num_string_ids = read_value<uint64_t>(file);
+    if (!file || num_string_ids > num_indexed_strings) {
+      break;
+    }
+    auto& string_ids = postings[trigram];
+    string_ids.resize(num_string_ids);
+    file.read(reinterpret_cast<char*>(string_ids.data()),
+              num_string_ids * sizeof(int32_t));
+  }
+  if (!file || postings.size() != num_trigrams) {
+    LOG(WARNING) << "Ignoring truncated trigram index " << path_;
+    return false;
+  }
+  postings_.swap(postings);
+  num_indexed_strings_ = num_indexed_strings;
+  dirty_ = false;
+  VLOG(1) << "Loaded trigram index " << path_ << " of " << num_indexed_strings_
+          << " strings";
+  return true;
+}
+
+bool TrigramIndex::save() {
+  if (path_.empty() || !dirty_) {
+    return true;
+  }
+  // write to a temporary file first, the index file is always complete
+  const auto tmp_path = path_ + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    write_value<int32_t>(file, kFileFormatVersion);
+    write_value<uint64_t>(file, num_indexed_strings_);
+    write_value<uint64_t>(file, postings_.size());
+    for (const auto& [trigram, string_ids] : postings_) {
+      write_value<uint32_t>(file, trigram);
+      write_value<uint64_t>(file, string_ids.size());
+      file.write(reinterpret_cast<const char*>(string_ids.data()),
+                 string_ids.size() * sizeof(int32_t));
+    }
+    file.flush();
+    if (!file) {
+      LOG(WARNING) << "Could not write the trigram index " << tmp_path;
+      file.close();
+      std::remove(tmp_path.c_str());
+      return false;
+    }
+  }
+  if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+    LOG(WARNING) << "Could not write the trigram index " << path_ << ": "
+                 << std::strerror(errno);
+    std::remove(tmp_path.c_str());
+    return false;
+  }
+  dirty_ = false;
+  return true;
+}
+
+std::vector<std::string> TrigramIndex::getLikeLiterals(const std::string& pattern,
+                                                       const bool is_simple,
+                                                       const char escape) {
+  if (is_simple) {
+    // simple patterns are a literal to search for
+    return {pattern};
+  }
+  std::vector<std::string> literals(1);
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    if (pattern[i] == escape && i + 1 < pattern.size()) {
+      literals.back() += pattern[++i];
+    } else if (pattern[i] == '%' || pattern[i] == '_') {
+      if (!literals.back().empty()) {
+        literals.emplace_back();
+      }
+    } else {
+      literals.back() += pattern[i];
+    }
+  }
+  return literals;
+}
+
+std::vector<std::string> TrigramIndex::getRegexpLiterals(const std::string& pattern) {
+  if (pattern.find('|') != std::string::npos) {
+    return {};
+  }
+  std::vector<std::string> literals(1);
+  auto end_literal = [&literals]() {
+    if (!literals.back().empty()) {
+      literals.emplace_back();
+    }
+  };
+  int group_depth{0};
+  bool last_atom_is_literal{false};
+  for (size_t i = 0; i < pattern.size(); ++i) {
+    const char c = pattern[i];
+    const bool atom_is_literal = last_atom_is_literal;
+    last_atom_is_literal = false;
+    switch (c) {
+      case '[': {
+        // a closing bracket right after the opening one is part of the set
+        size_t j = i + 1;
+        if (j < pattern.size() && pattern[j] == '^') {
+          ++j;
+        }
+        if (j < pattern.size() && pattern[j] == ']') {
+          ++j;
+        }
+        while (j < pattern.size() && pattern[j] != ']') {
+          ++j;
+        }
+        i = j;
+        end_literal();
+        break;
+      }
+      case '(':
+        ++group_depth;
+        end_literal();
+        break;
+      case ')':
+        group_depth = std::max(group_depth - 1, 0);
+        end_literal();
+        break;
+      case '*':
+      case '?':
+      case '{':
+        // the previous atom is optional
+        if (atom_is_literal && !literals.back().empty()) {
+          literals.back().pop_back();
+        }
+        if (c == '{') {
+          while (i < pattern.size() && pattern[i] != '}') {
+            ++i;
+          }
+        }
+        end_literal();
+        break;
+      case '\\':
+        if (i + 1 < pattern.size() && group_depth == 0 &&
+            !std::isalnum(static_cast<unsigned char>(pattern[i + 1]))) {
+          literals.back() += pattern[++i];
+          last_atom_is_literal = true;
+        } else {
+          // character classes like \d
+          ++i;
+          end_literal();
+        }
+        break;
+      case '.':
+      case '+':
+      case '^':
+      case '$':
+      case ']':
+      case '}':
+        end_literal();
+        break;
+      default:
+        if (group_depth == 0) {
+          literals.back() += c;
+          last_atom_is_literal = true;
+        }
+        break;
+    }
+  }
+  return literals;
+}
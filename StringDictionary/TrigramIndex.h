@@ -0,0 +1,82 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file    TrigramIndex.h
+ * @brief   Inverted index from the trigrams of dictionary strings to string ids, used to
+ *          narrow down the strings LIKE and REGEXP patterns have to be checked against.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Maps every trigram (three consecutive bytes, ASCII lower cased) of the indexed strings
+ * to the ascending list of ids of the strings which contain it. A string can only match a
+ * pattern if it contains all the trigrams of the literal parts of the pattern, so the
+ * intersection of their id lists is a superset of the matching ids.
+ *
+ * String ids are dense and never reused, so the index grows incrementally by indexing the
+ * ids added to the dictionary since the last extension. The index isn't thread-safe.
+ */
+class TrigramIndex {
+ public:
+  // An empty path creates an index which isn't persisted.
+  explicit TrigramIndex(const std::string& path) : path_(path) {}
+
+  size_t numIndexedStrings() const { return num_indexed_strings_; }
+
+  // Indexes the strings with ids in [numIndexedStrings(), num_strings).
+  void extend(const size_t num_strings,
+              const std::function<std::string_view(const int32_t)>& get_string);
+
+  // Returns the ascending ids below generation of the strings which contain all the
+  // trigrams of the literals, nullopt if the literals are too short to filter anything.
+  std::optional<std::vector<int32_t>> getCandidates(
+      const std::vector<std::string>& literals,
+      const size_t generation) const;
+
+  // Loads the persisted index, unless it covers more than max_num_strings strings.
+  bool load(const size_t max_num_strings);
+
+  // Persists the index if it changed since it was loaded or last saved.
+  bool save();
+
+  // Returns the parts of a LIKE pattern every matching string must contain.
+  static std::vector<std::string> getLikeLiterals(const std::string& pattern,
+                                                  const bool is_simple,
+                                                  const char escape);
+
+  // Returns the parts of an extended regular expression every matching string must
+  // contain. Bracket expressions and groups are skipped, any pattern with an alternation
+  // yields no literals.
+  static std::vector<std::string> getRegexpLiterals(const std::string& pattern);
+
+  static constexpr int32_t kFileFormatVersion{1};
+
+ private:
+  const std::string path_;
+  std::unordered_map<uint32_t, std::vector<int32_t>> postings_;
+  size_t num_indexed_strings_{0};
+  bool dirty_{false};
+};
@@ -0,0 +1,232 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file BufferMgrTest.cpp
+ * @brief Unit tests for the chunk index, eviction and slab allocation of the BufferMgr
+ * class.
+ */
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "DataMgr/BufferMgr/CpuBufferMgr/CpuBufferMgr.h"
+#include "TestHelpers.h"
+
+class BufferMgrTest : public testing::Test {
+ protected:
+  static constexpr size_t kPageSize{512};
+  static constexpr size_t kSlabNumPages{4};
+
+  void SetUp() override {
+    // two slabs of four pages
+    buffer_mgr_ = std::make_unique<Buffer_Namespace::CpuBufferMgr>(
+        0,
+        2 * kSlabNumPages * kPageSize,
+        nullptr,
+        kSlabNumPages * kPageSize,
+        kSlabNumPages * kPageSize,
+        kPageSize);
+  }
+
+  void TearDown() override { buffer_mgr_.reset(); }
+
+  AbstractBuffer* createBuffer(const ChunkKey& key, const size_t num_pages = 1) {
+    return buffer_mgr_->createBuffer(key, kPageSize, num_pages * kPageSize);
+  }
+
+  // creates unpinned one page chunks {1, 1, 1, i} filling the buffer pool
+  std::vector<ChunkKey> fillBufferPool() {
+    std::vector<ChunkKey> keys;
+    for (int i = 0; i < static_cast<int>(2 * kSlabNumPages); ++i) {
+      keys.push_back({1, 1, 1, i});
+      createBuffer(keys.back())->unPin();
+    }
+    return keys;
+  }
+
+  std::unique_ptr<Buffer_Namespace::CpuBufferMgr> buffer_mgr_;
+};
+
+TEST_F(BufferMgrTest, ReferencedChunksGetSecondChance) {
+  const auto keys = fillBufferPool();
+  EXPECT_EQ(buffer_mgr_->getNumChunks(), keys.size());
+  for (size_t i = 0; i < kSlabNumPages; ++i) {
+    buffer_mgr_->getBuffer(keys[i])->unPin();
+  }
+
+  createBuffer({1, 1, 2, 0})->unPin();
+  const auto stats = buffer_mgr_->getStats();
+  EXPECT_EQ(stats.hits, kSlabNumPages);
+  EXPECT_EQ(stats.evictions, size_t(1));
+  for (size_t i = 0; i < kSlabNumPages; ++i) {
+    EXPECT_TRUE(buffer_mgr_->isBufferOnDevice(keys[i]));
+  }
+  size_t num_unreferenced_on_device = 0;
+  for (size_t i = kSlabNumPages; i < keys.size(); ++i) {
+    num_unreferenced_on_device += buffer_mgr_->isBufferOnDevice(keys[i]);
+  }
+  EXPECT_EQ(num_unreferenced_on_device, kSlabNumPages - 1);
+}
+
+TEST_F(BufferMgrTest, EvictsContiguousPages) {
+  fillBufferPool();
+  createBuffer({1, 1, 2, 0}, kSlabNumPages)->unPin();
+  EXPECT_TRUE(buffer_mgr_->isBufferOnDevice({1, 1, 2, 0}));
+  EXPECT_EQ(buffer_mgr_->getStats().evictions, kSlabNumPages);
+  EXPECT_EQ(buffer_mgr_->getNumChunks(), kSlabNumPages + 1);
+}
+
+TEST_F(BufferMgrTest, ReusesFreedPagesWithoutEviction) {
+  fillBufferPool();
+  buffer_mgr_->deleteBuffersWithPrefix({1, 1});
+  EXPECT_EQ(buffer_mgr_->getNumChunks(), size_t(0));
+
+  for (int i = 0; i < 2; ++i) {
+    createBuffer({1, 2, 1, i}, kSlabNumPages)->unPin();
+  }
+  EXPECT_EQ(buffer_mgr_->getStats().evictions, size_t(0));
+  EXPECT_EQ(buffer_mgr_->getInUseSize(), 2 * kSlabNumPages * kPageSize);
+}
+
+TEST_F(BufferMgrTest, PinnedChunksAreNotEvicted) {
+  std::vector<AbstractBuffer*> buffers;
+  for (int i = 0; i < static_cast<int>(2 * kSlabNumPages); ++i) {
+    buffers.push_back(createBuffer({1, 1, 1, i}));
+  }
+  EXPECT_THROW(createBuffer({1, 1, 2, 0}), OutOfMemory);
+  EXPECT_FALSE(buffer_mgr_->isBufferOnDevice({1, 1, 2, 0}));
+
+  buffers[0]->unPin();
+  createBuffer({1, 1, 2, 0})->unPin();
+  EXPECT_FALSE(buffer_mgr_->isBufferOnDevice({1, 1, 1, 0}));
+  for (size_t i = 1; i < buffers.size(); ++i) {
+    buffers[i]->unPin();
+  }
+}
+
+TEST_F(BufferMgrTest, DeleteBuffersWithPrefix) {
+  createBuffer({1, 1, 1, 0})->unPin();
+  createBuffer({1, 1, 2, 0})->unPin();
+  createBuffer({1, 2, 1, 0})->unPin();
+  createBuffer({2, 1, 1, 0})->unPin();
+
+  buffer_mgr_->deleteBuffersWithPrefix({1, 1});
+  EXPECT_EQ(buffer_mgr_->getNumChunks(), size_t(2));
+  EXPECT_FALSE(buffer_mgr_->isBufferOnDevice({1, 1, 1, 0}));
+  EXPECT_FALSE(buffer_mgr_->isBufferOnDevice({1, 1, 2, 0}));
+
+  buffer_mgr_->deleteBuffersWithPrefix({1});
+  EXPECT_EQ(buffer_mgr_->getNumChunks(), size_t(1));
+  EXPECT_TRUE(buffer_mgr_->isBufferOnDevice({2, 1, 1, 0}));
+  EXPECT_GT(buffer_mgr_->getStats().chunk_index_lock_acquisitions, size_t(0));
+}
+
+TEST_F(BufferMgrTest, CachedHits) {
+  auto buffer = createBuffer({1, 1, 1, 0});
+  buffer->unPin();
+  EXPECT_EQ(buffer_mgr_->getBufferIfCached({1, 1, 1, 0}), buffer);
+  EXPECT_EQ(buffer->getPinCount(), 1);
+  buffer->unPin();
+  // missing chunks and chunks missing some of the bytes are left to getBuffer
+  EXPECT_EQ(buffer_mgr_->getBufferIfCached({1, 1, 2, 0}), nullptr);
+  EXPECT_EQ(buffer_mgr_->getBufferIfCached({1, 1, 1, 0}, buffer->size() + 1), nullptr);
+  EXPECT_EQ(buffer->getPinCount(), 0);
+  const auto stats = buffer_mgr_->getStats();
+  EXPECT_EQ(stats.hits, size_t(1));
+  EXPECT_EQ(stats.misses, size_t(0));
+}
+
+TEST_F(BufferMgrTest, CachedHitsDuringEvictions) {
+  const auto keys = fillBufferPool();
+  std::atomic<bool> stop{false};
+  std::atomic<size_t> num_evicted_while_pinned{0};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back([&] {
+      while (!stop) {
+        for (const auto& key : keys) {
+          if (auto buffer = buffer_mgr_->getBufferIfCached(key)) {
+            if (!buffer_mgr_->isBufferOnDevice(key)) {
+              ++num_evicted_while_pinned;
+            }
+            buffer->unPin();
+          }
+        }
+      }
+    });
+  }
+  for (int i = 0; i < 100; ++i) {
+    createBuffer({1, 1, 2, i})->unPin();
+  }
+  stop = true;
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_EQ(num_evicted_while_pinned, size_t(0));
+  EXPECT_EQ(buffer_mgr_->getNumChunks(), 2 * kSlabNumPages);
+}
+
+TEST(NumaSlabAllocatorTest, ParseNumaPolicy) {
+  EXPECT_EQ(parse_numa_policy("none"), NumaPolicy::kNone);
+  EXPECT_EQ(parse_numa_policy("interleave"), NumaPolicy::kInterleave);
+  EXPECT_EQ(parse_numa_policy("bind"), NumaPolicy::kBind);
+  EXPECT_THROW(parse_numa_policy("local"), std::runtime_error);
+}
+
+TEST(NumaSlabAllocatorTest, HugePageSlabs) {
+  constexpr size_t kPageSize{512};
+  constexpr size_t kSlabSize{4 * kPageSize};
+  for (const auto numa_policy : {NumaPolicy::kNone, NumaPolicy::kBind}) {
+    Buffer_Namespace::CpuBufferMgr buffer_mgr(0,
+                                              2 * kSlabSize,
+                                              nullptr,
+                                              kSlabSize,
+                                              kSlabSize,
+                                              kPageSize,
+                                              nullptr,
+                                              true,
+                                              numa_policy);
+    std::vector<int8_t> data(kSlabSize, 42);
+    for (int i = 0; i < 2; ++i) {
+      auto buffer = buffer_mgr.createBuffer({1, 1, 1, i}, kPageSize, kSlabSize);
+      buffer->append(data.data(), data.size());
+      EXPECT_EQ(buffer->getMemoryPtr()[kSlabSize - 1], 42);
+      buffer->unPin();
+    }
+    EXPECT_EQ(buffer_mgr.getSlabSegments().size(), size_t(2));
+    EXPECT_EQ(buffer_mgr.getAllocated(), 2 * kSlabSize);
+    if (numa_policy == NumaPolicy::kNone) {
+      EXPECT_EQ(buffer_mgr.getChunkNumaNode({1, 1, 1, 0}), -1);
+    }
+    EXPECT_EQ(buffer_mgr.getChunkNumaNode({1, 1, 2, 0}), -1);
+  }
+}
+
+int main(int argc, char** argv) {
+  TestHelpers::init_logger_stderr_only(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+
+  int err{0};
+  try {
+    err = RUN_ALL_TESTS();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what();
+  }
+
+  return err;
+}
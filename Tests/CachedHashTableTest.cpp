@@ -824,6 +824,72 @@ TEST(Delete, JoinCacheInvalidationTest_DropTable) {
   }
 }
 
+namespace {
+
+struct TestCacheKey {
+  const int id;
+
+  bool operator==(const TestCacheKey& that) const { return id == that.id; }
+
+  size_t hash() const { return static_cast<size_t>(id); }
+};
+
+using TestCacheValue = std::shared_ptr<std::vector<int8_t>>;
+
+class HashTableCacheBudget {
+ public:
+  HashTableCacheBudget(const size_t max_size_bytes)
+      : max_size_bytes_backup_(g_hash_table_cache_max_size_bytes) {
+    g_hash_table_cache_max_size_bytes = max_size_bytes;
+  }
+
+  ~HashTableCacheBudget() { g_hash_table_cache_max_size_bytes = max_size_bytes_backup_; }
+
+ private:
+  const size_t max_size_bytes_backup_;
+};
+
+}  // namespace
+
+TEST(HashTableCache, EvictLeastRecentlyUsed) {
+  HashTableCacheBudget budget(300);
+  HashTableCache<TestCacheKey, TestCacheValue> cache(
+      [](const TestCacheValue& value) { return value->size(); }, 4);
+  for (int i = 0; i < 3; ++i) {
+    auto value = std::make_shared<std::vector<int8_t>>(100, i);
+    cache.insert({i}, value);
+  }
+  ASSERT_EQ(cache.getNumberOfCachedHashTables(), size_t(3));
+
+  // touch the oldest entry, the next insertion must evict the second one instead
+  ASSERT_TRUE(cache.get({0}));
+  auto value = std::make_shared<std::vector<int8_t>>(100, 3);
+  cache.insert({3}, value);
+  EXPECT_EQ(cache.getNumberOfCachedHashTables(), size_t(3));
+  EXPECT_TRUE(cache.get({0}));
+  EXPECT_FALSE(cache.get({1}));
+  EXPECT_TRUE(cache.get({2}));
+  EXPECT_TRUE(cache.get({3}));
+
+  const auto stats = cache.getStats();
+  EXPECT_EQ(stats.size_bytes, size_t(300));
+  EXPECT_EQ(stats.hits, size_t(4));
+  EXPECT_EQ(stats.misses, size_t(1));
+  EXPECT_EQ(stats.evictions, size_t(1));
+}
+
+TEST(HashTableCache, SkipOversizedEntries) {
+  HashTableCacheBudget budget(100);
+  HashTableCache<TestCacheKey, TestCacheValue> cache(
+      [](const TestCacheValue& value) { return value->size(); });
+  auto value = std::make_shared<std::vector<int8_t>>(101, 0);
+  cache.insert({0}, value);
+  EXPECT_EQ(cache.getNumberOfCachedHashTables(), size_t(0));
+
+  cache.clear();
+  EXPECT_EQ(cache.getStats().size_bytes, size_t(0));
+}
+
 int main(int argc, char** argv) {
   TestHelpers::init_logger_stderr_only(argc, argv);
   testing::InitGoogleTest(&argc, argv);
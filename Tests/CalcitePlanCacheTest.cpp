@@ -0,0 +1,205 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Calcite/CalcitePlanCache.h"
+#include "DBHandlerTestHelpers.h"
+#include "TestHelpers.h"
+
+TEST(ParameterizeSql, Literals) {
+  const auto sql = parameterize_sql(
+      "SELECT * FROM t WHERE a > -12.50 AND b = 'it''s' AND c < 1e3 AND d <> 7;");
+  ASSERT_EQ(sql.literals.size(), size_t(4));
+  EXPECT_EQ(sql.literals[0].kind, SqlLiteral::Kind::kExactNumeric);
+  EXPECT_EQ(sql.literals[0].value, "-1250");
+  EXPECT_EQ(sql.literals[0].scale, 2);
+  EXPECT_EQ(sql.literals[1].kind, SqlLiteral::Kind::kString);
+  EXPECT_EQ(sql.literals[1].value, "it's");
+  EXPECT_EQ(sql.literals[2].kind, SqlLiteral::Kind::kApproxNumeric);
+  EXPECT_EQ(sql.literals[3].value, "7");
+  EXPECT_TRUE(sql.cacheable);
+
+  // only the values of the literals differ
+  EXPECT_EQ(
+      sql.text,
+      parameterize_sql(
+          "SELECT  * FROM t WHERE a > -99.99 AND b = 'no x' AND c < 2e5 AND d <> 8;")
+          .text);
+  // the inferred type of the literals differs
+  EXPECT_NE(sql.text,
+            parameterize_sql(
+                "SELECT * FROM t WHERE a > 12.5 AND b = 'it''s' AND c < 1e3 AND d <> 7;")
+                .text);
+  EXPECT_NE(sql.text,
+            parameterize_sql(
+                "SELECT * FROM t WHERE a > -12.50 AND b = 'its' AND c < 1e3 AND d <> 7;")
+                .text);
+}
+
+TEST(ParameterizeSql, FixedLiterals) {
+  const auto sql = parameterize_sql(
+      "SELECT x1, \"y 2\" FROM t WHERE d > DATE '2020-01-01' AND x - 1 > 0 "
+      "/* 5 */ AND i < d + INTERVAL '1' DAY;");
+  ASSERT_EQ(sql.literals.size(), size_t(2));
+  EXPECT_EQ(sql.literals[0].value, "1");
+  EXPECT_EQ(sql.literals[1].value, "0");
+  EXPECT_NE(sql.text,
+            parameterize_sql("SELECT x1, \"y 2\" FROM t WHERE d > DATE '2021-01-01' AND "
+                             "x - 1 > 0 /* 5 */ AND i < d + INTERVAL '1' DAY;")
+                .text);
+}
+
+TEST(ParameterizeSql, BindMarkersAndNondeterministicFunctions) {
+  const auto sql = parameterize_sql("SELECT * FROM t WHERE a = ? AND b = '?' AND c = ?;");
+  ASSERT_EQ(sql.bind_markers.size(), size_t(2));
+  EXPECT_EQ(sql.bind_markers[0], size_t(26));
+  EXPECT_EQ(sql.bind_markers[1], size_t(48));
+  EXPECT_FALSE(parameterize_sql("SELECT * FROM t WHERE d > now();").cacheable);
+  EXPECT_FALSE(parameterize_sql("SELECT current_user FROM t;").cacheable);
+}
+
+class CalcitePlanCacheTest : public DBHandlerTestFixture {
+ protected:
+  void SetUp() override {
+    DBHandlerTestFixture::SetUp();
+    g_enable_calcite_plan_cache = true;
+    sql("DROP TABLE IF EXISTS plan_cache_test;");
+    sql("CREATE TABLE plan_cache_test (i INTEGER, t TEXT);");
+    sql("INSERT INTO plan_cache_test VALUES (1, 'a');");
+    sql("INSERT INTO plan_cache_test VALUES (2, 'b');");
+    sql("INSERT INTO plan_cache_test VALUES (3, 'c');");
+    CalcitePlanCache::instance().clear();
+  }
+
+  void TearDown() override {
+    sql("DROP TABLE IF EXISTS plan_cache_test;");
+    g_enable_calcite_plan_cache = false;
+    DBHandlerTestFixture::TearDown();
+  }
+
+  static TBindParameter intParameter(const int64_t value) {
+    TBindParameter parameter;
+    parameter.type = TDatumType::INT;
+    parameter.value.val.int_val = value;
+    parameter.value.is_null = false;
+    return parameter;
+  }
+
+  static TBindParameter stringParameter(const std::string& value) {
+    TBindParameter parameter;
+    parameter.type = TDatumType::STR;
+    parameter.value.val.str_val = value;
+    parameter.value.is_null = false;
+    return parameter;
+  }
+};
+
+TEST_F(CalcitePlanCacheTest, ReuseForDifferentLiterals) {
+  auto& cache = CalcitePlanCache::instance();
+  sqlAndCompareResult("SELECT COUNT(*) FROM plan_cache_test WHERE i > 0;", {{i(3)}});
+
+  // identical statements reuse the plan right away
+  auto hits = cache.getStats().hits;
+  sqlAndCompareResult("SELECT COUNT(*) FROM plan_cache_test WHERE i > 0;", {{i(3)}});
+  EXPECT_GT(cache.getStats().hits, hits);
+
+  // the first statement with another value verifies the literal is a parameter
+  hits = cache.getStats().hits;
+  sqlAndCompareResult("SELECT COUNT(*) FROM plan_cache_test WHERE i > 1;", {{i(2)}});
+
+  sqlAndCompareResult("SELECT COUNT(*) FROM plan_cache_test WHERE i > 2;", {{i(1)}});
+  sqlAndCompareResult("SELECT COUNT(*) FROM plan_cache_test WHERE i > 3;", {{i(0)}});
+  EXPECT_GE(cache.getStats().hits, hits + 2);
+  EXPECT_EQ(cache.getStats().num_entries, size_t(1));
+}
+
+TEST_F(CalcitePlanCacheTest, ClearedOnCatalogChange) {
+  auto& cache = CalcitePlanCache::instance();
+  sqlAndCompareResult("SELECT COUNT(*) FROM plan_cache_test WHERE i > 0;", {{i(3)}});
+  EXPECT_EQ(cache.getStats().num_entries, size_t(1));
+
+  sql("ALTER TABLE plan_cache_test RENAME COLUMN i TO j;");
+  EXPECT_EQ(cache.getStats().num_entries, size_t(0));
+  queryAndAssertPartialException("SELECT COUNT(*) FROM plan_cache_test WHERE i > 0;",
+                                 "not found in any table");
+}
+
+TEST_F(CalcitePlanCacheTest, PreparedStatement) {
+  auto [db_handler, session_id] = getDbHandlerAndSessionId();
+  TPreparedStatement statement;
+  db_handler->prepare_statement(
+      statement,
+      session_id,
+      "SELECT COUNT(*) FROM plan_cache_test WHERE i >= ? AND t <> ? AND t <> '?';");
+  EXPECT_EQ(statement.num_parameters, 2);
+
+  for (int64_t value = -1; value <= 3; ++value) {
+    TQueryResult result;
+    db_handler->sql_execute_prepared(result,
+                                     session_id,
+                                     statement.statement_id,
+                                     {intParameter(value), stringParameter("b")},
+                                     false,
+                                     "",
+                                     -1,
+                                     -1);
+    assertResultSetEqual({{i(value <= 1 ? 2 : 1)}}, result);
+  }
+  EXPECT_GT(CalcitePlanCache::instance().getStats().hits, size_t(0));
+
+  TQueryResult result;
+  executeLambdaAndAssertException(
+      [&] {
+        db_handler->sql_execute_prepared(result,
+                                         session_id,
+                                         statement.statement_id,
+                                         {intParameter(1)},
+                                         false,
+                                         "",
+                                         -1,
+                                         -1);
+      },
+      "Exception: Prepared statement takes 2 parameters, got 1.");
+
+  db_handler->close_prepared_statement(session_id, statement.statement_id);
+  executeLambdaAndAssertException(
+      [&] {
+        db_handler->sql_execute_prepared(result,
+                                         session_id,
+                                         statement.statement_id,
+                                         {intParameter(1), stringParameter("b")},
+                                         false,
+                                         "",
+                                         -1,
+                                         -1);
+      },
+      "Prepared statement " + statement.statement_id + " does not exist.");
+}
+
+int main(int argc, char** argv) {
+  TestHelpers::init_logger_stderr_only(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+  DBHandlerTestFixture::initTestArgs(argc, argv);
+
+  int err{0};
+  try {
+    err = RUN_ALL_TESTS();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what();
+  }
+  return err;
+}
@@ -21,12 +21,14 @@
 #include <llvm/IR/Verifier.h>
 #include <llvm/Support/SourceMgr.h>
 #include <llvm/Support/raw_os_ostream.h>
+#include <boost/filesystem.hpp>
 
 #include "Analyzer/Analyzer.h"
 #include "QueryEngine/CodeGenerator.h"
 #include "QueryEngine/Execute.h"
 #include "QueryEngine/IRCodegenUtils.h"
 #include "QueryEngine/LLVMGlobalContext.h"
+#include "QueryEngine/PersistentCodeCache.h"
 #include "TestHelpers.h"
 
 TEST(CodeGeneratorTest, IntegerConstant) {
@@ -362,6 +364,94 @@ TEST(CodeGeneratorTest, IntegerExprGPU) {
 }
 #endif  // HAVE_CUDA
 
+class PersistentCodeCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    cache_dir_ = boost::filesystem::temp_directory_path() /
+                 boost::filesystem::unique_path("code_cache_%%%%-%%%%");
+  }
+
+  void TearDown() override { boost::filesystem::remove_all(cache_dir_); }
+
+  static void putObject(PersistentCodeCache& code_cache,
+                        const CodeCacheKey& key,
+                        const std::string& object) {
+    code_cache.putObject(PersistentCodeCache::serializeKey(key),
+                         llvm::MemoryBufferRef(object, "object"));
+  }
+
+  static std::string getObject(PersistentCodeCache& code_cache, const CodeCacheKey& key) {
+    auto object = code_cache.getObject(PersistentCodeCache::serializeKey(key));
+    return object ? object->getBuffer().str() : "";
+  }
+
+  boost::filesystem::path cache_dir_;
+};
+
+TEST_F(PersistentCodeCacheTest, RoundTrip) {
+  const CodeCacheKey key{"query_func", "row_func"};
+  const std::string object(100, 'x');
+  {
+    PersistentCodeCache code_cache(cache_dir_.string(), 1 << 20);
+    ASSERT_EQ(getObject(code_cache, key), "");
+    putObject(code_cache, key, object);
+  }
+  // a new cache over the same directory, as after a server restart
+  PersistentCodeCache code_cache(cache_dir_.string(), 1 << 20);
+  EXPECT_EQ(getObject(code_cache, key), object);
+  EXPECT_EQ(getObject(code_cache, {"query_func", "other_row_func"}), "");
+  EXPECT_EQ(getObject(code_cache, {"query_funcrow_func"}), "");
+}
+
+TEST_F(PersistentCodeCacheTest, EvictBySize) {
+  const std::string object(1000, 'x');
+  // room for two entries
+  PersistentCodeCache code_cache(cache_dir_.string(), 2500);
+  putObject(code_cache, {"first"}, object);
+  putObject(code_cache, {"second"}, object);
+  ASSERT_EQ(getObject(code_cache, {"first"}), object);
+  ASSERT_EQ(getObject(code_cache, {"second"}), object);
+  putObject(code_cache, {"third"}, object);
+  EXPECT_LE(code_cache.getSizeBytes(), size_t(2500));
+  EXPECT_EQ(getObject(code_cache, {"third"}), object);
+  const size_t num_cached = (getObject(code_cache, {"first"}) == object) +
+                            (getObject(code_cache, {"second"}) == object);
+  EXPECT_EQ(num_cached, size_t(1));
+}
+
+TEST_F(PersistentCodeCacheTest, KeyedOnUdfModules) {
+  const CodeCacheKey key{"query_func"};
+  const std::string object(100, 'x');
+  PersistentCodeCache code_cache(cache_dir_.string(), 1 << 20);
+  PersistentCodeCache::setUdfModuleIR(PersistentCodeCache::UdfModule::kRuntime,
+                                      "define i32 @udf() { ret i32 1 }");
+  putObject(code_cache, key, object);
+  ASSERT_EQ(getObject(code_cache, key), object);
+  // the same query linked against a changed runtime UDF
+  PersistentCodeCache::setUdfModuleIR(PersistentCodeCache::UdfModule::kRuntime,
+                                      "define i32 @udf() { ret i32 2 }");
+  EXPECT_EQ(getObject(code_cache, key), "");
+  PersistentCodeCache::setUdfModuleIR(PersistentCodeCache::UdfModule::kRuntime,
+                                      "define i32 @udf() { ret i32 1 }");
+  EXPECT_EQ(getObject(code_cache, key), object);
+  PersistentCodeCache::setUdfModuleIR(PersistentCodeCache::UdfModule::kRuntime, "");
+  EXPECT_EQ(getObject(code_cache, key), "");
+}
+
+TEST_F(PersistentCodeCacheTest, Clear) {
+  const std::string object(1000, 'x');
+  PersistentCodeCache code_cache(cache_dir_.string(), 1 << 20);
+  putObject(code_cache, {"first"}, object);
+  putObject(code_cache, {"second"}, object);
+  ASSERT_GT(code_cache.getSizeBytes(), size_t(0));
+  code_cache.clear();
+  EXPECT_EQ(code_cache.getSizeBytes(), size_t(0));
+  EXPECT_EQ(getObject(code_cache, {"first"}), "");
+  EXPECT_EQ(getObject(code_cache, {"second"}), "");
+  putObject(code_cache, {"first"}, object);
+  EXPECT_EQ(getObject(code_cache, {"first"}), object);
+}
+
 int main(int argc, char** argv) {
   TestHelpers::init_logger_stderr_only(argc, argv);
   testing::InitGoogleTest(&argc, argv);
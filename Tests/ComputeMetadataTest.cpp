@@ -19,6 +19,7 @@
 #include "Catalog/Catalog.h"
 #include "DBHandlerTestHelpers.h"
 #include "QueryEngine/TableOptimizer.h"
+#include "ThriftHandler/SortedTableReclusterScheduler.h"
 
 #include <gtest/gtest.h>
 #include <string>
@@ -29,6 +30,8 @@
 #endif
 
 extern float g_vacuum_min_selectivity;
+extern float g_recluster_min_overlap;
+extern size_t g_recluster_max_sort_fragments;
 
 namespace {
 
@@ -1126,6 +1129,217 @@ TEST_F(OptimizeTableVacuumTest, NoneEncodedStringColumnWithAllNullValues) {
   sqlAndCompareResult("select * from test_table;", {{Null}, {Null}});
 }
 
+class OptimizeTableReclusterTest : public DBHandlerTestFixture {
+ protected:
+  void SetUp() override {
+    DBHandlerTestFixture::SetUp();
+    sql("drop table if exists test_table;");
+  }
+
+  void TearDown() override {
+    sql("drop table if exists test_table;");
+    DBHandlerTestFixture::TearDown();
+  }
+
+  void insertValues(const std::vector<int>& values) {
+    for (const auto value : values) {
+      const auto value_str = std::to_string(value);
+      sql("insert into test_table values (" + value_str + ", 'str" + value_str + "', {" +
+          value_str + ", " + value_str + "});");
+    }
+  }
+
+  void assertSortColumnRanges(const std::vector<std::pair<int32_t, int32_t>>& ranges) {
+    const auto& catalog = getCatalog();
+    const auto td = catalog.getMetadataForTable("test_table");
+    CHECK(td);
+    const auto cd = catalog.getMetadataForColumn(td->tableId, "i");
+    CHECK(cd);
+    const auto table_info = td->fragmenter->getFragmentsForQuery();
+    ASSERT_EQ(ranges.size(), table_info.fragments.size());
+    for (size_t i = 0; i < ranges.size(); i++) {
+      const auto metadata_map = table_info.fragments[i].getChunkMetadataMapPhysical();
+      const auto& chunk_stats = metadata_map.at(cd->columnId)->chunkStats;
+      EXPECT_EQ(ranges[i].first, chunk_stats.min.intval);
+      EXPECT_EQ(ranges[i].second, chunk_stats.max.intval);
+    }
+  }
+
+  bool reclusterAboveMinOverlap() {
+    const auto& catalog = getCatalog();
+    const auto td = catalog.getMetadataForTable("test_table");
+    auto executor = Executor::getExecutor(Executor::UNITARY_EXECUTOR_ID);
+    TableOptimizer optimizer(td, executor.get(), catalog);
+    return optimizer.reclusterSortedRowsAboveMinOverlap();
+  }
+};
+
+TEST_F(OptimizeTableReclusterTest, OverlappingFragments) {
+  sql("create table test_table (i integer, t text encoding dict(32), a integer[]) with "
+      "(fragment_size = 2, sort_column = 'i');");
+  insertValues({5, 1, 4, 2, 6, 3});
+  assertSortColumnRanges({{1, 5}, {2, 4}, {3, 6}});
+
+  sql("optimize table test_table with (recluster = 'true');");
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}});
+  sqlAndCompareResult("select * from test_table;",
+                      {{i(1), "str1", array({i(1), i(1)})},
+                       {i(2), "str2", array({i(2), i(2)})},
+                       {i(3), "str3", array({i(3), i(3)})},
+                       {i(4), "str4", array({i(4), i(4)})},
+                       {i(5), "str5", array({i(5), i(5)})},
+                       {i(6), "str6", array({i(6), i(6)})}});
+  sqlAndCompareResult("select count(*) from test_table where i between 3 and 4;",
+                      {{i(2)}});
+}
+
+TEST_F(OptimizeTableReclusterTest, PartiallyOverlappingFragments) {
+  sql("create table test_table (i integer, t text encoding dict(32), a integer[]) with "
+      "(fragment_size = 2, sort_column = 'i');");
+  insertValues({1, 2, 4, 3, 5, 6});
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}});
+  insertValues({8, 7});
+
+  // Fragments that do not overlap other fragments are left unchanged.
+  sql("optimize table test_table with (recluster = 'true');");
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}, {7, 8}});
+  EXPECT_FALSE(reclusterAboveMinOverlap());
+}
+
+TEST_F(OptimizeTableReclusterTest, MinOverlap) {
+  sql("create table test_table (i integer, t text encoding dict(32), a integer[]) with "
+      "(fragment_size = 2, sort_column = 'i');");
+  insertValues({1, 2, 3, 4, 5, 6, 10, 7, 9, 8});
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}, {7, 10}, {8, 9}});
+
+  // Only two of five fragments overlap, which is below the default minimum overlap.
+  EXPECT_FALSE(reclusterAboveMinOverlap());
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}, {7, 10}, {8, 9}});
+
+  const auto orig_min_overlap = g_recluster_min_overlap;
+  g_recluster_min_overlap = 0.3;
+  EXPECT_TRUE(reclusterAboveMinOverlap());
+  g_recluster_min_overlap = orig_min_overlap;
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}});
+}
+
+TEST_F(OptimizeTableReclusterTest, MaxSortFragments) {
+  sql("create table test_table (i integer, t text encoding dict(32), a integer[]) with "
+      "(fragment_size = 2, sort_column = 'i');");
+  insertValues({11, 12, 1, 10, 8, 9, 2, 7, 5, 6, 3, 4});
+  assertSortColumnRanges({{11, 12}, {1, 10}, {8, 9}, {2, 7}, {5, 6}, {3, 4}});
+
+  // All fragments overlap, but at most two fragments are sorted together at a time.
+  const auto orig_max_sort_fragments = g_recluster_max_sort_fragments;
+  g_recluster_max_sort_fragments = 2;
+  sql("optimize table test_table with (recluster = 'true');");
+  g_recluster_max_sort_fragments = orig_max_sort_fragments;
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}});
+  sqlAndCompareResult("select count(*) from test_table where i between 5 and 8;",
+                      {{i(4)}});
+}
+
+TEST_F(OptimizeTableReclusterTest, TableWithoutSortColumn) {
+  sql("create table test_table (i integer);");
+  queryAndAssertPartialException(
+      "optimize table test_table with (recluster = 'true');",
+      "Table test_table does not have a numeric, date/time or dictionary encoded text "
+      "sort column to re-cluster on.");
+  EXPECT_FALSE(reclusterAboveMinOverlap());
+}
+
+class ScheduledReclusterTest : public OptimizeTableReclusterTest {
+ protected:
+  static void SetUpTestSuite() {
+    createDBHandler();
+    SortedTableReclusterScheduler::setWaitDuration(1);
+  }
+
+  static void TearDownTestSuite() { stopScheduler(); }
+
+  static void startScheduler() {
+    is_program_running_ = true;
+    SortedTableReclusterScheduler::start(is_program_running_);
+    ASSERT_TRUE(SortedTableReclusterScheduler::isRunning());
+  }
+
+  static void stopScheduler() {
+    is_program_running_ = false;
+    SortedTableReclusterScheduler::stop();
+    ASSERT_FALSE(SortedTableReclusterScheduler::isRunning());
+  }
+
+  void SetUp() override {
+    OptimizeTableReclusterTest::SetUp();
+    SortedTableReclusterScheduler::resetHasReclusteredTable();
+  }
+
+  void TearDown() override {
+    // stop the scheduler before the table is dropped
+    stopScheduler();
+    OptimizeTableReclusterTest::TearDown();
+  }
+
+  // Returns true if a table was re-clustered within the given number of scheduler
+  // intervals.
+  bool waitForScheduledRecluster(size_t interval_count) {
+    constexpr size_t checks_per_interval = 4;
+    for (size_t i = 0; i < interval_count * checks_per_interval; ++i) {
+      if (SortedTableReclusterScheduler::hasReclusteredTable()) {
+        return true;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    }
+    return SortedTableReclusterScheduler::hasReclusteredTable();
+  }
+
+  inline static std::atomic<bool> is_program_running_;
+};
+
+TEST_F(ScheduledReclusterTest, OverlappingFragments) {
+  sql("create table test_table (i integer, t text encoding dict(32), a integer[]) with "
+      "(fragment_size = 2, sort_column = 'i');");
+  insertValues({5, 1, 4, 2, 6, 3});
+  assertSortColumnRanges({{1, 5}, {2, 4}, {3, 6}});
+
+  startScheduler();
+  ASSERT_TRUE(waitForScheduledRecluster(5));
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}});
+  sqlAndCompareResult("select count(*) from test_table where i between 3 and 4;",
+                      {{i(2)}});
+
+  // The table no longer overlaps, so later intervals leave it unchanged.
+  SortedTableReclusterScheduler::resetHasReclusteredTable();
+  EXPECT_FALSE(waitForScheduledRecluster(2));
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}});
+}
+
+TEST_F(ScheduledReclusterTest, BelowMinOverlap) {
+  sql("create table test_table (i integer, t text encoding dict(32), a integer[]) with "
+      "(fragment_size = 2, sort_column = 'i');");
+  insertValues({1, 2, 3, 4, 5, 6, 10, 7, 9, 8});
+
+  startScheduler();
+  EXPECT_FALSE(waitForScheduledRecluster(2));
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}, {7, 10}, {8, 9}});
+}
+
+TEST_F(ScheduledReclusterTest, StopAndRestart) {
+  sql("create table test_table (i integer, t text encoding dict(32), a integer[]) with "
+      "(fragment_size = 2, sort_column = 'i');");
+  startScheduler();
+  stopScheduler();
+
+  // A stopped scheduler does not re-cluster tables.
+  insertValues({5, 1, 4, 2, 6, 3});
+  EXPECT_FALSE(waitForScheduledRecluster(2));
+  assertSortColumnRanges({{1, 5}, {2, 4}, {3, 6}});
+
+  startScheduler();
+  ASSERT_TRUE(waitForScheduledRecluster(5));
+  assertSortColumnRanges({{1, 2}, {3, 4}, {5, 6}});
+}
+
 class VarLenColumnUpdateTest : public DBHandlerTestFixture {
   void SetUp() override {
     DBHandlerTestFixture::SetUp();
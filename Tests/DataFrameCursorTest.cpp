@@ -0,0 +1,133 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <arrow/api.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/api.h>
+#include <gtest/gtest.h>
+
+#include "DBHandlerTestHelpers.h"
+#include "Shared/ArrowUtil.h"
+#include "TestHelpers.h"
+
+class DataFrameCursorTest : public DBHandlerTestFixture {
+ protected:
+  void SetUp() override {
+    DBHandlerTestFixture::SetUp();
+    sql("DROP TABLE IF EXISTS df_cursor_test;");
+    sql("CREATE TABLE df_cursor_test (i INTEGER, t TEXT ENCODING DICT(32));");
+    for (int i = 0; i < 10; ++i) {
+      sql("INSERT INTO df_cursor_test VALUES (" + std::to_string(i) + ", 't" +
+          std::to_string(i % 3) + "');");
+    }
+  }
+
+  void TearDown() override {
+    sql("DROP TABLE IF EXISTS df_cursor_test;");
+    DBHandlerTestFixture::TearDown();
+  }
+};
+
+TEST_F(DataFrameCursorTest, FetchBatches) {
+  const auto& [db_handler, session_id] = getDbHandlerAndSessionId();
+  TDataFrameCursor cursor;
+  db_handler->sql_execute_df_cursor(cursor,
+                                    session_id,
+                                    "SELECT i, t FROM df_cursor_test ORDER BY i;",
+                                    -1,
+                                    3,
+                                    TArrowTransport::WIRE);
+  ASSERT_FALSE(cursor.schema.empty());
+
+  // the schema followed by the batches forms one Arrow stream
+  std::string stream = cursor.schema;
+  size_t num_batches = 0;
+  while (true) {
+    TDataFrame df;
+    db_handler->fetch_df_batch(df, session_id, cursor.cursor_id);
+    if (df.df_size == 0) {
+      break;
+    }
+    EXPECT_EQ(static_cast<size_t>(df.df_size), df.df_buffer.size());
+    stream += df.df_buffer;
+    ++num_batches;
+  }
+  EXPECT_EQ(num_batches, size_t(4));
+
+  arrow::io::BufferReader reader(reinterpret_cast<const uint8_t*>(stream.data()),
+                                 stream.size());
+  std::shared_ptr<arrow::RecordBatchReader> batch_reader;
+  ARROW_ASSIGN_OR_THROW(batch_reader, arrow::ipc::RecordBatchStreamReader::Open(&reader));
+  std::vector<int64_t> batch_rows;
+  int32_t expected_i = 0;
+  while (true) {
+    std::shared_ptr<arrow::RecordBatch> batch;
+    ARROW_THROW_NOT_OK(batch_reader->ReadNext(&batch));
+    if (!batch) {
+      break;
+    }
+    batch_rows.push_back(batch->num_rows());
+    const auto ints = std::static_pointer_cast<arrow::Int32Array>(batch->column(0));
+    const auto strings =
+        std::static_pointer_cast<arrow::DictionaryArray>(batch->column(1));
+    const auto dictionary =
+        std::static_pointer_cast<arrow::StringArray>(strings->dictionary());
+    for (int64_t row = 0; row < batch->num_rows(); ++row, ++expected_i) {
+      EXPECT_EQ(ints->Value(row), expected_i);
+      EXPECT_EQ(dictionary->GetString(strings->GetValueIndex(row)),
+                "t" + std::to_string(expected_i % 3));
+    }
+  }
+  EXPECT_EQ(batch_rows, (std::vector<int64_t>{3, 3, 3, 1}));
+
+  db_handler->close_df_cursor(session_id, cursor.cursor_id);
+  executeLambdaAndAssertException(
+      [&] {
+        TDataFrame df;
+        db_handler->fetch_df_batch(df, session_id, cursor.cursor_id);
+      },
+      "Data frame cursor " + cursor.cursor_id + " does not exist.");
+}
+
+TEST_F(DataFrameCursorTest, CloseBeforeExhausted) {
+  const auto& [db_handler, session_id] = getDbHandlerAndSessionId();
+  TDataFrameCursor cursor;
+  db_handler->sql_execute_df_cursor(
+      cursor, session_id, "SELECT i FROM df_cursor_test;", -1, 2, TArrowTransport::WIRE);
+  TDataFrame df;
+  db_handler->fetch_df_batch(df, session_id, cursor.cursor_id);
+  EXPECT_GT(df.df_size, 0);
+
+  // the pending prefetch of the next batch is dropped with the cursor
+  db_handler->close_df_cursor(session_id, cursor.cursor_id);
+  executeLambdaAndAssertException(
+      [&] { db_handler->close_df_cursor(session_id, cursor.cursor_id); },
+      "Data frame cursor " + cursor.cursor_id + " does not exist.");
+}
+
+int main(int argc, char** argv) {
+  TestHelpers::init_logger_stderr_only(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+  DBHandlerTestFixture::initTestArgs(argc, argv);
+
+  int err{0};
+  try {
+    err = RUN_ALL_TESTS();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what();
+  }
+  return err;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ImportExport/DelimitedParserUtils.h"
+
+namespace {
+
+std::string make_csv(const size_t num_rows) {
+  std::string csv;
+  for (size_t i = 0; i < num_rows; ++i) {
+    csv += std::to_string(i) + ",some text value " + std::to_string(i % 97) +
+           ",3.14159265,2021-01-01 00:00:00,\"quoted, field\"\n";
+  }
+  return csv;
+}
+
+}  // namespace
+
+//! Find the last row ending of a buffer, as done before parsing every import buffer
+static void BM_FindEnd(benchmark::State& state) {
+  const auto csv = make_csv(state.range(0));
+  import_export::CopyParams copy_params;
+  for (auto _ : state) {
+    unsigned int num_rows{0};
+    bool in_quote{false};
+    benchmark::DoNotOptimize(import_export::delimited_parser::find_end(
+        csv.data(), csv.size(), copy_params, num_rows, 0, in_quote, 0));
+  }
+  state.SetBytesProcessed(state.iterations() * csv.size());
+}
+
+BENCHMARK(BM_FindEnd)->Range(1 << 10, 1 << 18);
+
+//! Split a buffer into the fields of its rows
+static void BM_GetRow(benchmark::State& state) {
+  const auto csv = make_csv(state.range(0));
+  import_export::CopyParams copy_params;
+  std::vector<std::string_view> row;
+  std::vector<std::unique_ptr<char[]>> tmp_buffers;
+  for (auto _ : state) {
+    const char* p = csv.data();
+    const char* buf_end = csv.data() + csv.size();
+    while (p < buf_end) {
+      bool try_single_thread{false};
+      row.clear();
+      tmp_buffers.clear();
+      p = import_export::delimited_parser::get_row(p,
+                                                   buf_end,
+                                                   buf_end,
+                                                   copy_params,
+                                                   nullptr,
+                                                   row,
+                                                   tmp_buffers,
+                                                   try_single_thread,
+                                                   false);
+      benchmark::DoNotOptimize(row.data());
+      ++p;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * csv.size());
+}
+
+BENCHMARK(BM_GetRow)->Range(1 << 10, 1 << 18);
+
+BENCHMARK_MAIN();
@@ -210,6 +210,45 @@ TEST_F(DBEngineSQLTest, FilterAndSimpleAggregation) {
                        "AND z < 102 AND t > 1000 AND t < 1002;"));
 }
 
+TEST_F(DBEngineSQLTest, ArrowRecordBatches) {
+  const size_t num_rows{25};
+  const size_t max_batch_rows{4};
+
+  EXPECT_NO_THROW(SetUp("(x INT, s TEXT ENCODING DICT) WITH (fragment_size=10)"));
+  for (size_t i = 0; i < num_rows; ++i) {
+    run_dml("INSERT INTO dbe_test VALUES(" + std::to_string(i) + ", 's" +
+            std::to_string(i % 3) + "');");
+  }
+
+  auto cursor = ::engine->executeDML("SELECT x, s FROM dbe_test;");
+  ASSERT_TRUE(cursor);
+  size_t row_count = 0;
+  int64_t x_sum = 0;
+  std::shared_ptr<arrow::Array> dictionary;
+  while (auto batch = cursor->getNextArrowRecordBatch(max_batch_rows)) {
+    ASSERT_EQ(2, batch->num_columns());
+    ASSERT_GT(batch->num_rows(), 0);
+    ASSERT_LE(static_cast<size_t>(batch->num_rows()), max_batch_rows);
+    row_count += batch->num_rows();
+
+    const auto& xs = static_cast<const arrow::Int32Array&>(*batch->column(0));
+    for (int64_t i = 0; i < xs.length(); ++i) {
+      x_sum += xs.Value(i);
+    }
+
+    // All batches share the dictionary of the first one.
+    const auto& ss = static_cast<const arrow::DictionaryArray&>(*batch->column(1));
+    if (!dictionary) {
+      dictionary = ss.dictionary();
+    }
+    ASSERT_EQ(dictionary, ss.dictionary());
+    ASSERT_EQ(3, dictionary->length());
+  }
+  ASSERT_EQ(num_rows, row_count);
+  ASSERT_EQ(int64_t(num_rows * (num_rows - 1) / 2), x_sum);
+  ASSERT_FALSE(cursor->getNextArrowRecordBatch(max_batch_rows));
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
 
@@ -21,10 +21,13 @@
 
 #include <gtest/gtest.h>
 #include <boost/filesystem.hpp>
+#include <cstring>
 
 #include "DataMgr/AbstractBuffer.h"
+#include "DataMgr/DiffEncoder.h"
 #include "DataMgr/Encoder.h"
 #include "DataMgr/MemoryLevel.h"
+#include "DataMgr/RunLengthEncoder.h"
 #include "Shared/DatumFetchers.h"
 #include "TestHelpers.h"
 
@@ -763,6 +766,118 @@ TYPED_TEST(FixedLengthArrayNoneEncoderUpdateStatsTest, TypedTest) {
   TestFixture::runTest();
 }
 
+// In memory buffer which supports the operations encoders use when appending data.
+class InMemoryTestBuffer : public TestBuffer {
+ public:
+  InMemoryTestBuffer(const SQLTypeInfo sql_type) : TestBuffer(sql_type) {}
+
+  void read(int8_t* const dst,
+            const size_t num_bytes,
+            const size_t offset,
+            const MemoryLevel dst_buffer_type,
+            const int dst_device_id) override {
+    CHECK_LE(offset + num_bytes, data_.size());
+    std::memcpy(dst, data_.data() + offset, num_bytes);
+  }
+
+  void write(int8_t* src,
+             const size_t num_bytes,
+             const size_t offset,
+             const MemoryLevel src_buffer_type,
+             const int src_device_id) override {
+    if (offset + num_bytes > data_.size()) {
+      data_.resize(offset + num_bytes);
+    }
+    std::memcpy(data_.data() + offset, src, num_bytes);
+    setSize(data_.size());
+  }
+
+  void append(int8_t* src,
+              const size_t num_bytes,
+              const MemoryLevel src_buffer_type,
+              const int device_id) override {
+    data_.resize(size());
+    data_.insert(data_.end(), src, src + num_bytes);
+    setSize(data_.size());
+  }
+
+  int8_t* getMemoryPtr() override { return data_.data(); }
+
+ private:
+  std::vector<int8_t> data_;
+};
+
+class RunLengthAndDiffEncoderTest : public testing::Test {
+ protected:
+  void createBuffer(const SQLTypeInfo& ti) { buffer_.reset(new InMemoryTestBuffer(ti)); }
+
+  template <typename T>
+  void appendData(std::vector<T> data) {
+    auto src_data = reinterpret_cast<int8_t*>(data.data());
+    buffer_->getEncoder()->appendData(src_data, data.size(), buffer_->getSqlType());
+  }
+
+  std::unique_ptr<InMemoryTestBuffer> buffer_;
+};
+
+TEST_F(RunLengthAndDiffEncoderTest, RunLengthAppendContinuesLastRun) {
+  createBuffer(SQLTypeInfo(kINT, false, kENCODING_RL));
+  appendData(std::vector<int32_t>{1, 1, 1, 2, 2});
+  appendData(std::vector<int32_t>{2, 2, NULL_INT, NULL_INT, 3});
+
+  const auto run_count = *reinterpret_cast<int64_t*>(buffer_->getMemoryPtr());
+  ASSERT_EQ(run_count, 4);
+  ASSERT_EQ(buffer_->size(),
+            kRunLengthEncodingHeaderSize + 4 * sizeof(RunLengthEncodedRun));
+  ASSERT_EQ(buffer_->getEncoder()->getNumElems(), size_t(10));
+  const std::vector<int64_t> expected{1, 1, 1, 2, 2, 2, 2, NULL_INT, NULL_INT, 3};
+  ASSERT_EQ(run_length_decode_all(buffer_->getMemoryPtr(), buffer_->size()), expected);
+
+  auto chunk_metadata = std::make_shared<ChunkMetadata>();
+  buffer_->getEncoder()->getMetadata(chunk_metadata);
+  ASSERT_EQ(chunk_metadata->chunkStats.min.intval, 1);
+  ASSERT_EQ(chunk_metadata->chunkStats.max.intval, 3);
+  ASSERT_TRUE(chunk_metadata->chunkStats.has_nulls);
+}
+
+TEST_F(RunLengthAndDiffEncoderTest, DiffRoundTrip) {
+  createBuffer(SQLTypeInfo(kBIGINT, 0, 0, false, kENCODING_DIFF, 16, kNULLT));
+  appendData(std::vector<int64_t>{1000000, 1000010, NULL_BIGINT});
+  appendData(std::vector<int64_t>{999990, 1000000 + 32767});
+
+  ASSERT_EQ(buffer_->size(), kDiffEncodingHeaderSize + 5 * sizeof(int16_t));
+  ASSERT_EQ(*reinterpret_cast<int64_t*>(buffer_->getMemoryPtr()), 1000000);
+  const std::vector<int64_t> expected{
+      1000000, 1000010, NULL_BIGINT, 999990, 1000000 + 32767};
+  ASSERT_EQ(diff_decode_all(buffer_->getMemoryPtr(),
+                            buffer_->size(),
+                            sizeof(int16_t),
+                            inline_int_null_value<int64_t>()),
+            expected);
+}
+
+TEST_F(RunLengthAndDiffEncoderTest, DiffBaselineAfterNulls) {
+  createBuffer(SQLTypeInfo(kBIGINT, 0, 0, false, kENCODING_DIFF, 16, kNULLT));
+  appendData(std::vector<int64_t>{NULL_BIGINT, NULL_BIGINT});
+  appendData(std::vector<int64_t>{NULL_BIGINT, 5000000, 5000100});
+
+  // The baseline is taken from the first non-null value of the second append.
+  ASSERT_EQ(*reinterpret_cast<int64_t*>(buffer_->getMemoryPtr()), 5000000);
+  const std::vector<int64_t> expected{
+      NULL_BIGINT, NULL_BIGINT, NULL_BIGINT, 5000000, 5000100};
+  ASSERT_EQ(diff_decode_all(buffer_->getMemoryPtr(),
+                            buffer_->size(),
+                            sizeof(int16_t),
+                            inline_int_null_value<int64_t>()),
+            expected);
+}
+
+TEST_F(RunLengthAndDiffEncoderTest, DiffOverflow) {
+  createBuffer(SQLTypeInfo(kINT, 0, 0, false, kENCODING_DIFF, 8, kNULLT));
+  appendData(std::vector<int32_t>{100, 120});
+  EXPECT_THROW(appendData(std::vector<int32_t>{300}), std::runtime_error);
+}
+
 int main(int argc, char** argv) {
   TestHelpers::init_logger_stderr_only(argc, argv);
   testing::InitGoogleTest(&argc, argv);
@@ -59,6 +59,8 @@ extern unsigned g_trivial_loop_join_threshold;
 extern bool g_enable_overlaps_hashjoin;
 extern double g_gpu_mem_limit_percent;
 extern size_t g_parallel_top_min;
+extern size_t g_min_cpu_morsel_rows;
+extern size_t g_window_function_parallel_min_rows;
 
 extern bool g_enable_window_functions;
 extern bool g_enable_calcite_view_optimize;
@@ -1484,6 +1486,44 @@ TEST(Select, AggregateOnEmptyDecimalColumn) {
   }
 }
 
+TEST(Select, RunLengthAndDiffEncodedColumns) {
+  const std::string drop_table{"DROP TABLE IF EXISTS rl_diff_test;"};
+  run_ddl_statement(drop_table);
+  g_sqlite_comparator.query(drop_table);
+  run_ddl_statement(
+      "CREATE TABLE rl_diff_test (r INT ENCODING RL, d BIGINT ENCODING DIFF(16), ts "
+      "TIMESTAMP(0) ENCODING DIFF(32), x INT) WITH (fragment_size = 4);");
+  g_sqlite_comparator.query(
+      "CREATE TABLE rl_diff_test (r INT, d BIGINT, ts TIMESTAMP(0), x INT);");
+  // Runs of r span fragments and the first chunk of d starts with nulls, so the
+  // baseline of that chunk comes from a later insert.
+  for (int i = 0; i < 14; ++i) {
+    const auto d = i < 2 ? std::string("NULL") : std::to_string(1000000000 + i * 10);
+    const auto ts = i % 5 == 4 ? std::string("NULL")
+                               : "'2021-01-01 00:00:" + std::to_string(10 + i) + "'";
+    const std::string insert_stmt{"INSERT INTO rl_diff_test VALUES(" +
+                                  std::to_string(i / 3) + ", " + d + ", " + ts + ", " +
+                                  std::to_string(i) + ");"};
+    run_multiple_agg(insert_stmt, ExecutorDeviceType::CPU);
+    g_sqlite_comparator.query(insert_stmt);
+  }
+  for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
+    SKIP_NO_GPU();
+    c("SELECT * FROM rl_diff_test ORDER BY x;", dt);
+    c("SELECT COUNT(*) FROM rl_diff_test WHERE r = 2;", dt);
+    c("SELECT COUNT(*) FROM rl_diff_test WHERE d IS NULL;", dt);
+    c("SELECT COUNT(*) FROM rl_diff_test WHERE ts IS NULL;", dt);
+    c("SELECT MIN(d), MAX(d), SUM(d) FROM rl_diff_test WHERE d > 1000000050;", dt);
+    c("SELECT r, COUNT(*), SUM(x), MIN(d), MAX(d) FROM rl_diff_test GROUP BY r ORDER BY "
+      "r;",
+      dt);
+    c("SELECT SUM(x) FROM rl_diff_test WHERE r BETWEEN 1 AND 3 AND d IS NOT NULL;", dt);
+    c("SELECT COUNT(*) FROM rl_diff_test WHERE ts > '2021-01-01 00:00:15';", dt);
+  }
+  run_ddl_statement(drop_table);
+  g_sqlite_comparator.query(drop_table);
+}
+
 TEST(Select, AggregateConstantValueOnEmptyTable) {
   for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
     SKIP_NO_GPU();
@@ -1559,6 +1599,21 @@ TEST(Select, AggregateOnEmptyTable) {
   }
 }
 
+TEST(Select, FragmentSkipping) {
+  for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
+    SKIP_NO_GPU();
+    c("SELECT COUNT(*) FROM test WHERE str = 'foo';", dt);
+    c("SELECT COUNT(*) FROM test WHERE str = 'not_in_dictionary';", dt);
+    c("SELECT COUNT(*) FROM test WHERE str IN ('foo', 'not_in_dictionary');", dt);
+    c("SELECT COUNT(*) FROM test WHERE x IN (7, 9);", dt);
+    c("SELECT COUNT(*) FROM test WHERE x IN (100, 200);", dt);
+    c("SELECT COUNT(*) FROM test WHERE x IN (7, 8) AND str = 'foo';", dt);
+    c("SELECT COUNT(*) FROM test a, test_inner b WHERE a.x = b.x;", dt);
+    c("SELECT COUNT(*) FROM test a, test_inner b WHERE a.str = b.str;", dt);
+    c("SELECT COUNT(*) FROM test a JOIN test_inner b ON a.x = b.x WHERE a.y > 40;", dt);
+  }
+}
+
 TEST(Select, LimitAndOffset) {
   CHECK(g_num_rows >= 4);
   for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
@@ -7954,6 +8009,53 @@ TEST(Select, SpeculativeTopNSort) {
   }
 }
 
+TEST(Select, SplitFragmentKernels) {
+  SKIP_ALL_ON_AGGREGATOR();
+  const ExecutorDeviceType dt = ExecutorDeviceType::CPU;
+  const std::string drop_old_test{"DROP TABLE IF EXISTS split_fragment_test;"};
+  run_ddl_statement(drop_old_test);
+  g_sqlite_comparator.query(drop_old_test);
+  ScopeGuard reset = [&drop_old_test, orig = g_min_cpu_morsel_rows] {
+    g_min_cpu_morsel_rows = orig;
+    run_ddl_statement(drop_old_test);
+    g_sqlite_comparator.query(drop_old_test);
+  };
+  run_ddl_statement(
+      "CREATE TABLE split_fragment_test (x INT, y BIGINT, str TEXT ENCODING DICT(32));");
+  g_sqlite_comparator.query(
+      "CREATE TABLE split_fragment_test (x INT, y BIGINT, str TEXT);");
+  for (size_t i = 0; i < 100; ++i) {
+    const std::string insert_query{"INSERT INTO split_fragment_test VALUES(" +
+                                   std::to_string(i) + ", " + std::to_string(i % 7) +
+                                   ", 'str" + std::to_string(i % 3) + "');"};
+    run_multiple_agg(insert_query, dt);
+    g_sqlite_comparator.query(insert_query);
+  }
+
+  const auto executor = QR::get()->getExecutor();
+  for (const size_t min_cpu_morsel_rows : {size_t(0), size_t(1)}) {
+    g_min_cpu_morsel_rows = min_cpu_morsel_rows;
+    c("SELECT COUNT(*), SUM(x), MIN(y), MAX(y) FROM split_fragment_test;", dt);
+    // the single fragment is split between the CPU threads
+    if (min_cpu_morsel_rows && cpu_threads() > 1) {
+      EXPECT_GT(executor->getLastKernelCount(), size_t(1));
+    } else {
+      EXPECT_EQ(executor->getLastKernelCount(), size_t(1));
+    }
+    c("SELECT COUNT(*) FROM split_fragment_test WHERE x > 42;", dt);
+    c("SELECT y, COUNT(*), SUM(x) FROM split_fragment_test GROUP BY y ORDER BY y;", dt);
+    c("SELECT str, COUNT(DISTINCT y) FROM split_fragment_test GROUP BY str ORDER BY "
+      "str;",
+      dt);
+    c("SELECT x, y, str FROM split_fragment_test WHERE MOD(x, 3) = 1 ORDER BY x DESC "
+      "LIMIT 20;",
+      dt);
+    // the results of the kernels of a split fragment are put back in the row order
+    c("SELECT x, str FROM split_fragment_test WHERE y > 2;", dt);
+    c("SELECT x FROM split_fragment_test LIMIT 10 OFFSET 45;", dt);
+  }
+}
+
 TEST(Select, GroupByPerfectHash) {
   const auto default_bigint_flag = g_bigint_count;
   ScopeGuard reset = [default_bigint_flag] { g_bigint_count = default_bigint_flag; };
@@ -18755,6 +18857,65 @@ GROUP BY x, y, t ORDER BY x ASC, y ASC, t ASC;)",
     dt);
 }
 
+TEST(Select, WindowFunctionFrames) {
+  const ExecutorDeviceType dt = ExecutorDeviceType::CPU;
+  ScopeGuard reset = [orig = g_window_function_parallel_min_rows] {
+    g_window_function_parallel_min_rows = orig;
+  };
+  // a threshold of 0 computes the partitions of the small test table concurrently
+  size_t test_values[]{size_t(0), g_window_function_parallel_min_rows};
+  for (auto parallel_min_rows : test_values) {
+    g_window_function_parallel_min_rows = parallel_min_rows;
+    for (const std::string frame : {"ROWS BETWEEN 1 PRECEDING AND 1 FOLLOWING",
+                                    "ROWS BETWEEN UNBOUNDED PRECEDING AND 1 PRECEDING",
+                                    "ROWS BETWEEN 2 FOLLOWING AND UNBOUNDED FOLLOWING",
+                                    "RANGE BETWEEN 2 PRECEDING AND CURRENT ROW",
+                                    "RANGE BETWEEN CURRENT ROW AND 3 FOLLOWING"}) {
+      const std::string window = "(PARTITION BY y ORDER BY t ASC " + frame + ")";
+      std::string part1 = "SELECT x, y, t, AVG(x) OVER " + window + " a, MIN(x) OVER " +
+                          window + " m1, MAX(x) OVER " + window + " m2, SUM(x) OVER " +
+                          window + " s, COUNT(x) OVER " + window + " c, COUNT(*) OVER " +
+                          window + " n FROM test_window_func ORDER BY t ASC";
+      c(part1 + ";", part1 + ";", dt);
+    }
+    {
+      std::string part1 =
+          "SELECT x, y, t, SUM(CAST(x AS DOUBLE)) OVER (PARTITION BY y ORDER BY x DESC "
+          "RANGE BETWEEN 3 PRECEDING AND 1 FOLLOWING) s, MAX(CAST(x AS FLOAT)) OVER "
+          "(PARTITION BY y ORDER BY x DESC RANGE BETWEEN 3 PRECEDING AND 1 FOLLOWING) "
+          "m, COUNT(t) OVER (PARTITION BY y ORDER BY x ASC RANGE BETWEEN CURRENT ROW AND "
+          "CURRENT ROW) c FROM test_window_func ORDER BY t ASC";
+      c(part1 + ";", part1 + ";", dt);
+    }
+    {
+      std::string part1 =
+          "SELECT x, y, t, SUM(CAST(x AS DECIMAL(10, 2))) OVER (PARTITION BY y ORDER BY "
+          "t ASC ROWS BETWEEN 1 PRECEDING AND 1 FOLLOWING) s FROM test_window_func ORDER "
+          "BY t ASC";
+      c(part1 + ";", part1 + ";", dt);
+      part1 =
+          "SELECT x, y, t, ROW_NUMBER() OVER (PARTITION BY y ORDER BY t ASC) r, RANK() "
+          "OVER (PARTITION BY y ORDER BY x ASC) rk FROM test_window_func ORDER BY t ASC";
+      c(part1 + ";", part1 + ";", dt);
+    }
+  }
+  EXPECT_THROW(run_multiple_agg("SELECT SUM(x + 1) OVER (PARTITION BY y ORDER BY t ROWS "
+                                "BETWEEN 1 PRECEDING AND 1 FOLLOWING) FROM "
+                                "test_window_func;",
+                                dt),
+               std::runtime_error);
+  EXPECT_THROW(run_multiple_agg("SELECT ROW_NUMBER() OVER (PARTITION BY y ORDER BY t "
+                                "ROWS BETWEEN 1 PRECEDING AND 1 FOLLOWING) FROM "
+                                "test_window_func;",
+                                dt),
+               std::runtime_error);
+  EXPECT_THROW(run_multiple_agg("SELECT SUM(x) OVER (PARTITION BY y ORDER BY y RANGE "
+                                "BETWEEN 1 PRECEDING AND 1 FOLLOWING) FROM "
+                                "test_window_func;",
+                                dt),
+               std::runtime_error);
+}
+
 TEST(Select, WindowFunctionAggregateNoOrder) {
   const ExecutorDeviceType dt = ExecutorDeviceType::CPU;
   {
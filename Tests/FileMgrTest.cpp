@@ -19,6 +19,7 @@
  * @brief Unit tests for FileMgr class.
  */
 #include <gtest/gtest.h>
+#include <sys/stat.h>
 #include <boost/filesystem.hpp>
 
 #include "DataMgr/FileMgr/FileMgr.h"
@@ -1120,6 +1121,127 @@ TEST_F(FileMgrUnitTest, InitializeWithUncheckpointedAppendPages) {
   ASSERT_EQ(buffer->pageCount(), 1U);
 }
 
+TEST_F(FileMgrUnitTest, ReadAcrossPagesAtOffset) {
+  auto fsi = std::make_shared<ForeignStorageInterface>();
+  File_Namespace::GlobalFileMgr gfm(0, fsi, file_mgr_path, 0, page_size_);
+  auto fm = dynamic_cast<File_Namespace::FileMgr*>(gfm.getFileMgr(1, 1));
+  auto buffer = fm->createBuffer({1, 1, 1, 1});
+  const auto page_data_size = page_size_ - buffer->reservedHeaderSize();
+  std::vector<int8_t> write_buffer(page_data_size * 20);
+  for (size_t i = 0; i < write_buffer.size(); ++i) {
+    write_buffer[i] = static_cast<int8_t>(i % 127);
+  }
+  buffer->append(write_buffer.data(), write_buffer.size());
+  ASSERT_EQ(buffer->pageCount(), 20U);
+
+  // the appended pages are not checkpointed, reads must see the buffered writes
+  const size_t offset = page_data_size / 2;
+  const size_t num_bytes = write_buffer.size() - page_data_size;
+  std::vector<int8_t> read_buffer(num_bytes);
+  buffer->read(read_buffer.data(), num_bytes, offset);
+  EXPECT_TRUE(std::equal(
+      read_buffer.begin(), read_buffer.end(), write_buffer.begin() + offset));
+}
+
+TEST_F(FileMgrUnitTest, CompressedPages) {
+  constexpr size_t compressed_page_size{4096};
+  auto fsi = std::make_shared<ForeignStorageInterface>();
+  std::vector<int8_t> expected;
+  {
+    File_Namespace::GlobalFileMgr gfm(0, fsi, file_mgr_path, 0, compressed_page_size);
+    File_Namespace::FileMgrParams file_mgr_params;
+    file_mgr_params.page_compression = true;
+    gfm.setFileMgrParams(1, 1, file_mgr_params);
+    auto fm = dynamic_cast<File_Namespace::FileMgr*>(gfm.getFileMgr(1, 1));
+    ASSERT_TRUE(fm->pageCompressionEnabled());
+    auto buffer = fm->createBuffer({1, 1, 1, 1});
+    const auto page_data_size = buffer->pageDataSize();
+    expected.resize(page_data_size * 5 + page_data_size / 3);
+    for (size_t i = 0; i < expected.size(); ++i) {
+      expected[i] = static_cast<int8_t>((i / 16) % 127);
+    }
+
+    // appends which start and end in the middle of a page
+    const size_t first_append_size = page_data_size + page_data_size / 2;
+    buffer->append(expected.data(), first_append_size);
+    buffer->append(expected.data() + first_append_size,
+                   expected.size() - first_append_size);
+    ASSERT_EQ(buffer->pageCount(), 6U);
+    gfm.checkpoint(1, 1);
+
+    // an overwrite of checkpointed pages creates new versions of them
+    std::vector<int8_t> overwrite(page_data_size * 2);
+    for (size_t i = 0; i < overwrite.size(); ++i) {
+      overwrite[i] = static_cast<int8_t>(i % 7);
+    }
+    const size_t overwrite_offset = page_data_size / 4;
+    buffer->write(overwrite.data(), overwrite.size(), overwrite_offset);
+    std::copy(overwrite.begin(), overwrite.end(), expected.begin() + overwrite_offset);
+
+    std::vector<int8_t> read_buffer(expected.size());
+    buffer->read(read_buffer.data(), read_buffer.size());
+    EXPECT_EQ(read_buffer, expected);
+    gfm.checkpoint(1, 1);
+
+    // an append to the checkpointed last page writes a new version of it, which isn't
+    // checkpointed and leaves the content of the table unchanged
+    const auto checkpointed_page = buffer->getMultiPage().back().current();
+    std::vector<int8_t> append_data(16, 1);
+    buffer->append(append_data.data(), append_data.size());
+    const auto appended_page = buffer->getMultiPage().back().current();
+    EXPECT_GT(appended_page.epoch, checkpointed_page.epoch);
+    EXPECT_TRUE(checkpointed_page.page < appended_page.page ||
+                appended_page.page < checkpointed_page.page);
+  }
+
+  // the page format is kept by the table, whatever the parameters it's opened with
+  File_Namespace::GlobalFileMgr gfm(0, fsi, file_mgr_path, 0, compressed_page_size);
+  gfm.setFileMgrParams(1, 1, File_Namespace::FileMgrParams{});
+  auto fm = dynamic_cast<File_Namespace::FileMgr*>(gfm.getFileMgr(1, 1));
+  ASSERT_TRUE(fm->pageCompressionEnabled());
+  auto buffer = dynamic_cast<File_Namespace::FileBuffer*>(gfm.getBuffer({1, 1, 1, 1}));
+  ASSERT_EQ(buffer->size(), expected.size());
+  const size_t offset = buffer->pageDataSize() / 2;
+  std::vector<int8_t> read_buffer(expected.size() - offset);
+  buffer->read(read_buffer.data(), read_buffer.size(), offset);
+  EXPECT_TRUE(
+      std::equal(read_buffer.begin(), read_buffer.end(), expected.begin() + offset));
+}
+
+namespace {
+size_t get_allocated_data_file_bytes(File_Namespace::FileMgr* fm,
+                                     const File_Namespace::FileBuffer* buffer) {
+  const auto file_id = buffer->getMultiPage().front().current().page.fileId;
+  struct stat file_stat;
+  CHECK_EQ(fstat(fileno(fm->getFileInfoForFileId(file_id)->f), &file_stat), 0);
+  return file_stat.st_blocks * 512;
+}
+}  // namespace
+
+TEST_F(FileMgrUnitTest, CompressedPagesDiskUsage) {
+  constexpr size_t compressed_page_size{256 * 1024};
+  auto fsi = std::make_shared<ForeignStorageInterface>();
+  File_Namespace::GlobalFileMgr gfm(0, fsi, file_mgr_path, 0, compressed_page_size);
+  std::vector<size_t> allocated_bytes;
+  for (const bool page_compression : {false, true}) {
+    const int32_t table_id = page_compression ? 2 : 1;
+    File_Namespace::FileMgrParams file_mgr_params;
+    file_mgr_params.page_compression = page_compression;
+    gfm.setFileMgrParams(1, table_id, file_mgr_params);
+    auto fm = dynamic_cast<File_Namespace::FileMgr*>(gfm.getFileMgr(1, table_id));
+    auto buffer = fm->createBuffer({1, table_id, 1, 1});
+    std::vector<int8_t> data(buffer->pageDataSize() * 8);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<int8_t>((i / 64) % 3);
+    }
+    buffer->append(data.data(), data.size());
+    gfm.checkpoint(1, table_id);
+    allocated_bytes.push_back(get_allocated_data_file_bytes(fm, buffer));
+  }
+  // the compressed pages release the disk blocks they don't fill
+  EXPECT_LT(allocated_bytes[1], allocated_bytes[0] / 2);
+}
+
 int main(int argc, char** argv) {
   TestHelpers::init_logger_stderr_only(argc, argv);
   testing::InitGoogleTest(&argc, argv);
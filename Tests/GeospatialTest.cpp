@@ -16,6 +16,7 @@
 
 #include "TestHelpers.h"
 
+#include "../QueryEngine/GeoFragmentBounds.h"
 #include "../QueryRunner/QueryRunner.h"
 #include "../Shared/scope.h"
 
@@ -1987,6 +1988,20 @@ TEST_F(GeoSpatialTempTables, Geos) {
                   "'MULTIPOLYGON(((1 1,4 1,4 4,1 4,1 1)))')) FROM "
                   "geospatial_test WHERE id = 2;",
                   dt)));
+    // geos-backed ST_Intersection and ST_Difference of every poly with the same square:
+    // the square is prepared after the first row, polys of id < 4 are disjoint from it
+    ASSERT_NEAR(static_cast<double>(40.5),
+                v<double>(run_simple_agg(
+                    "SELECT SUM(ST_Area(ST_Intersection(poly, "
+                    "'POLYGON((2 2,6 2,6 6,2 6,2 2))'))) FROM geospatial_test;",
+                    dt)),
+                static_cast<double>(0.001));
+    ASSERT_NEAR(static_cast<double>(152.0),
+                v<double>(run_simple_agg(
+                    "SELECT SUM(ST_Area(ST_Difference(poly, "
+                    "'POLYGON((2 2,6 2,6 6,2 6,2 2))'))) FROM geospatial_test;",
+                    dt)),
+                static_cast<double>(0.001));
     // geos runtime support for geometry decompression
     ASSERT_NEAR(static_cast<double>(4.5),
                 v<double>(run_simple_agg("SELECT ST_Area(ST_Buffer(gpoly4326, 0.0)) "
@@ -2330,6 +2345,70 @@ TEST_P(GeoSpatialMultiFragTestTablesFixture, LoopJoin) {
   }
 }
 
+TEST_P(GeoSpatialMultiFragTestTablesFixture, FragmentSkipping) {
+  SKIP_ALL_ON_AGGREGATOR();
+
+  // fragments of two points each, from pt(0 0), pt(1 1) to pt(10 10), pt(null null)
+  for (auto dt : {ExecutorDeviceType::CPU, ExecutorDeviceType::GPU}) {
+    SKIP_NO_GPU();
+    GeoFragmentBoundsCache::instance().clear();
+    for (const std::string col : {"pt", "pt_none", "pt_comp"}) {
+      ASSERT_EQ(
+          static_cast<int64_t>(3),
+          v<int64_t>(run_simple_agg(
+              "SELECT count(*) FROM geospatial_multi_frag_test WHERE "
+              "ST_Contains(ST_GeomFromText('POLYGON((1.5 1.5, 4.5 1.5, 4.5 4.5, 1.5 4.5, "
+              "1.5 1.5))', 4326), " +
+                  col + ");",
+              dt)));
+      ASSERT_EQ(static_cast<int64_t>(3),
+                v<int64_t>(run_simple_agg(
+                    "SELECT count(*) FROM geospatial_multi_frag_test WHERE ST_DWithin(" +
+                        col + ", ST_GeomFromText('POINT(7 7)', 4326), 1.5);",
+                    dt)));
+      ASSERT_EQ(
+          static_cast<int64_t>(0),
+          v<int64_t>(run_simple_agg(
+              "SELECT count(*) FROM geospatial_multi_frag_test WHERE ST_Intersects(" +
+                  col +
+                  ", ST_GeomFromText('POLYGON((20 20, 30 20, 30 30, 20 30, 20 20))', "
+                  "4326));",
+              dt)));
+    }
+    // one box per column and fragment
+    ASSERT_EQ(size_t(3 * 6), GeoFragmentBoundsCache::instance().getNumEntries());
+  }
+
+  // appending to a fragment recomputes its box
+  const auto count_in_box = [](const ExecutorDeviceType dt) {
+    return v<int64_t>(run_simple_agg(
+        "SELECT count(*) FROM geospatial_multi_frag_test WHERE "
+        "ST_Contains(ST_GeomFromText('POLYGON((1.5 1.5, 4.5 1.5, 4.5 4.5, 1.5 4.5, 1.5 "
+        "1.5))', 4326), pt_comp);",
+        dt));
+  };
+  run_multiple_agg(
+      "INSERT INTO geospatial_multi_frag_test VALUES ('POINT(20 20)', 'POINT(20 20)', "
+      "'POINT(20 20)');",
+      ExecutorDeviceType::CPU);
+  ASSERT_EQ(static_cast<int64_t>(3), count_in_box(ExecutorDeviceType::CPU));
+  run_multiple_agg(
+      "INSERT INTO geospatial_multi_frag_test VALUES ('POINT(3 2)', 'POINT(3 2)', "
+      "'POINT(3 2)');",
+      ExecutorDeviceType::CPU);
+  ASSERT_EQ(static_cast<int64_t>(4), count_in_box(ExecutorDeviceType::CPU));
+
+  // rolling the table back to an epoch forgets the boxes
+  ASSERT_GT(GeoFragmentBoundsCache::instance().getNumEntries(), size_t(0));
+  const auto& cat = QR::get()->getSession()->getCatalog();
+  const auto td = cat.getMetadataForTable("geospatial_multi_frag_test", false);
+  CHECK(td);
+  const auto db_id = cat.getCurrentDB().dbId;
+  cat.setTableEpochs(db_id, cat.getTableEpochs(db_id, td->tableId));
+  ASSERT_EQ(size_t(0), GeoFragmentBoundsCache::instance().getNumEntries());
+  ASSERT_EQ(static_cast<int64_t>(4), count_in_box(ExecutorDeviceType::CPU));
+}
+
 INSTANTIATE_TEST_SUITE_P(GeospatialMultiFragExecutionTests,
                          GeoSpatialMultiFragTestTablesFixture,
                          ::testing::Values(true, false));
@@ -31,6 +31,9 @@ extern bool g_is_test_env;
 extern bool g_enable_watchdog;
 extern size_t g_big_group_threshold;
 extern size_t g_watchdog_baseline_max_groups;
+extern bool g_enable_out_of_core_aggregation;
+extern size_t g_out_of_core_aggregation_max_groups;
+extern std::string g_base_path;
 
 using QR = QueryRunner::QueryRunner;
 using namespace TestHelpers;
@@ -412,6 +415,101 @@ TEST_F(BigCardinalityThresholdTest, EmptyFilters) {
   }
 }
 
+class OutOfCoreAggregationTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    initial_g_big_group_threshold = g_big_group_threshold;
+    initial_g_out_of_core_aggregation_max_groups = g_out_of_core_aggregation_max_groups;
+    // always estimate the number of groups, and aggregate them in several passes
+    g_big_group_threshold = 1;
+    g_out_of_core_aggregation_max_groups = 500;
+
+    run_ddl_statement("DROP TABLE IF EXISTS out_of_core_agg;");
+    run_ddl_statement(
+        "CREATE TABLE out_of_core_agg (x INT, y BIGINT, str TEXT ENCODING DICT(32), f "
+        "FLOAT);");
+
+    boost::filesystem::path temp_path =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    const std::string filename_with_ext = temp_path.native() + ".csv";
+    std::fstream f(filename_with_ext, f.binary | f.out | f.trunc);
+    CHECK(f.is_open());
+    for (size_t i = 0; i < 2000; i++) {
+      // some null group keys, which must all land in the same group
+      if (i % 97) {
+        f << i % 1000;
+      }
+      f << ", " << i % 3 << ", str" << i % 5 << ", " << i * 0.5 << std::endl;
+    }
+    f.close();
+
+    run_ddl_statement("COPY out_of_core_agg FROM '" + filename_with_ext +
+                      "' WITH (header='false');");
+  }
+
+  void TearDown() override {
+    g_big_group_threshold = initial_g_big_group_threshold;
+    g_out_of_core_aggregation_max_groups = initial_g_out_of_core_aggregation_max_groups;
+    g_enable_out_of_core_aggregation = true;
+    run_ddl_statement("DROP TABLE IF EXISTS out_of_core_agg;");
+  }
+
+  size_t initial_g_big_group_threshold{0};
+  size_t initial_g_out_of_core_aggregation_max_groups{0};
+};
+
+TEST_F(OutOfCoreAggregationTest, MatchesInMemoryAggregation) {
+  const std::string query{
+      "SELECT x, y, str, COUNT(*), SUM(x), AVG(y), MAX(f) FROM out_of_core_agg GROUP "
+      "BY x, y, str ORDER BY x, y, str;"};
+  g_enable_out_of_core_aggregation = false;
+  const auto expected_rows = QR::get()->runSQL(query, ExecutorDeviceType::CPU);
+  g_enable_out_of_core_aggregation = true;
+  const auto rows = QR::get()->runSQL(query, ExecutorDeviceType::CPU);
+
+  ASSERT_GT(expected_rows->rowCount(), g_out_of_core_aggregation_max_groups);
+  ASSERT_EQ(rows->rowCount(), expected_rows->rowCount());
+  while (true) {
+    const auto expected_row = expected_rows->getNextRow(true, true);
+    const auto row = rows->getNextRow(true, true);
+    ASSERT_EQ(row.size(), expected_row.size());
+    if (row.empty()) {
+      break;
+    }
+    for (size_t i = 0; i < row.size(); ++i) {
+      EXPECT_TRUE(boost::get<ScalarTargetValue>(row[i]) ==
+                  boost::get<ScalarTargetValue>(expected_row[i]));
+    }
+  }
+}
+
+TEST_F(OutOfCoreAggregationTest, SkewedKeys) {
+  // almost all the groups are in the lowest thousandth of the key range, the key ranges
+  // holding them are split further
+  run_ddl_statement("INSERT INTO out_of_core_agg VALUES (1000000, 0, 'str0', 0);");
+  const std::string query{
+      "SELECT x, y, COUNT(*), SUM(f) FROM out_of_core_agg GROUP BY x, y ORDER BY x, y;"};
+  g_enable_out_of_core_aggregation = false;
+  const auto expected_rows = QR::get()->runSQL(query, ExecutorDeviceType::CPU);
+  g_enable_out_of_core_aggregation = true;
+  const auto rows = QR::get()->runSQL(query, ExecutorDeviceType::CPU);
+
+  ASSERT_GT(expected_rows->rowCount(), g_out_of_core_aggregation_max_groups);
+  ASSERT_EQ(rows->rowCount(), expected_rows->rowCount());
+  while (true) {
+    const auto expected_row = expected_rows->getNextRow(true, true);
+    const auto row = rows->getNextRow(true, true);
+    ASSERT_EQ(row.size(), expected_row.size());
+    if (row.empty()) {
+      break;
+    }
+    for (size_t i = 0; i < row.size(); ++i) {
+      EXPECT_TRUE(boost::get<ScalarTargetValue>(row[i]) ==
+                  boost::get<ScalarTargetValue>(expected_row[i]));
+    }
+  }
+}
+
 int main(int argc, char** argv) {
   g_is_test_env = true;
 
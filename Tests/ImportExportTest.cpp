@@ -58,6 +58,7 @@ extern bool g_use_date_in_days_default_encoding;
 extern size_t g_leaf_count;
 extern bool g_is_test_env;
 extern bool g_allow_s3_server_privileges;
+extern bool g_enable_external_sort;
 
 namespace {
 
@@ -562,6 +563,48 @@ TEST_F(ImportTestInt, ImportGoodInt) {
   ASSERT_EQ(86u, rows->entryCount());
 };
 
+class ImportTestMixedNumeric : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_NO_THROW(run_ddl_statement("drop table if exists mixed_numeric;"));
+    ASSERT_NO_THROW(run_ddl_statement(
+        "create table mixed_numeric (s text, i int, f float, d double, ts timestamp, "
+        "inn int not null);"));
+  }
+
+  void TearDown() override {
+    ASSERT_NO_THROW(run_ddl_statement("drop table if exists mixed_numeric;"));
+  }
+};
+
+TEST_F(ImportTestMixedNumeric, BadRowsDiscardedWhole) {
+  SKIP_ALL_ON_AGGREGATOR();  // global variable not available on leaf nodes
+  // the numeric and timestamp fields are converted column by column, the rows with an
+  // out of range int or a null in a not null column must be discarded in every column
+  ASSERT_NO_THROW(
+      run_ddl_statement("COPY mixed_numeric FROM "
+                        "'../../Tests/Import/datafiles/mixed_numeric_bad_rows.csv';"));
+
+  auto rows = run_query(
+      "SELECT s, COALESCE(i, -1), inn, ts IS NULL FROM mixed_numeric ORDER BY inn;");
+  ASSERT_EQ(3u, rows->rowCount());
+  const std::vector<std::string> expected_strings{"a", "c", "e"};
+  const std::vector<int64_t> expected_ints{1, 3, -1};
+  const std::vector<int64_t> expected_not_nulls{1, 3, 5};
+  const std::vector<int64_t> expected_null_timestamps{0, 0, 1};
+  for (size_t r = 0; r < expected_strings.size(); ++r) {
+    const auto crt_row = rows->getNextRow(true, true);
+    ASSERT_EQ(size_t(4), crt_row.size());
+    const auto ns = v<NullableString>(crt_row[0]);
+    const auto str = boost::get<std::string>(&ns);
+    ASSERT_TRUE(str);
+    ASSERT_EQ(expected_strings[r], *str);
+    ASSERT_EQ(expected_ints[r], v<int64_t>(crt_row[1]));
+    ASSERT_EQ(expected_not_nulls[r], v<int64_t>(crt_row[2]));
+    ASSERT_EQ(expected_null_timestamps[r], v<int64_t>(crt_row[3]));
+  }
+}
+
 class ImportTestLegacyDate : public ::testing::Test {
  protected:
   void SetUp() override {
@@ -2326,6 +2369,42 @@ TEST_F(ExportTest, CSV_Nulls) {
   ASSERT_NO_THROW(doTestNulls("query_export_test_csv_nulls.csv", "CSV", "*"));
 }
 
+TEST_F(ExportTest, CSV_ExternalSort) {
+  SKIP_ALL_ON_AGGREGATOR();
+  ASSERT_NO_THROW(run_ddl_statement(
+      "CREATE TABLE query_export_test (i INTEGER, s TEXT ENCODING DICT(32), d DOUBLE) "
+      "WITH (fragment_size=16);"));
+  for (int k = 0; k < 100; ++k) {
+    const auto d = k % 5 ? std::to_string(k * 0.5) : std::string("NULL");
+    run_query("INSERT INTO query_export_test VALUES (" + std::to_string(k * 37 % 100) +
+              ", 'str_" + std::to_string(k % 7) + "', " + d + ");");
+  }
+  const std::string select{
+      "SELECT i, s, d FROM query_export_test ORDER BY s DESC, d NULLS FIRST, i"};
+  const auto export_sorted = [&select](const std::string& file,
+                                       const std::string& options) {
+    run_ddl_statement("COPY (" + select + ") TO '" BASE_PATH "/mapd_export/" + file +
+                      "' WITH (header='false'" + options + ");");
+  };
+
+  // a budget of a byte spills every fragment as a run of its own
+  ASSERT_NO_THROW(export_sorted("external_sort.csv", ", sort_memory_budget=1"));
+  {
+    g_enable_external_sort = false;
+    ScopeGuard reset = [] { g_enable_external_sort = true; };
+    ASSERT_NO_THROW(export_sorted("in_memory_sort.csv", ""));
+  }
+  const auto external_lines =
+      readTextFile(BASE_PATH "/mapd_export/external_sort.csv", PLAIN_TEXT);
+  const auto in_memory_lines =
+      readTextFile(BASE_PATH "/mapd_export/in_memory_sort.csv", PLAIN_TEXT);
+  ASSERT_EQ(external_lines.size(), size_t(100));
+  EXPECT_EQ(external_lines, in_memory_lines);
+  EXPECT_TRUE(boost::filesystem::is_empty(BASE_PATH "/mapd_spill"));
+  EXPECT_THROW(export_sorted("external_sort.csv", ", sort_memory_budget=0"),
+               std::runtime_error);
+}
+
 TEST_F(ExportTest, GeoJSON) {
   SKIP_ALL_ON_AGGREGATOR();
   doCreateAndImport();
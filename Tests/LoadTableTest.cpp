@@ -20,11 +20,17 @@
 #include <arrow/ipc/writer.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <future>
+#include <thread>
+
 #ifdef HAVE_AWS_S3
 #include "AwsHelpers.h"
 #include "DataMgr/OmniSciAwsSdk.h"
 #include "Shared/ThriftTypesConvert.h"
 #endif  // HAVE_AWS_S3
+#include "ImportExport/GroupCommitMgr.h"
+#include "LockMgr/LockMgr.h"
 #include "Shared/ArrowUtil.h"
 #include "Tests/DBHandlerTestHelpers.h"
 #include "Tests/TestHelpers.h"
@@ -33,6 +39,10 @@
 #define BASE_PATH "./tmp"
 #endif
 
+extern bool g_enable_ingest_group_commit;
+extern size_t g_ingest_group_commit_rows;
+extern size_t g_ingest_group_commit_interval_ms;
+
 class LoadTableTest : public DBHandlerTestFixture {
  protected:
   void SetUp() override {
@@ -242,6 +252,192 @@ TEST_F(LoadTableTest, DictOutOfBounds) {
   sqlAndCompareResult("SELECT count(*) FROM load_test", {{i(0)}});
 }
 
+class LoadTableGroupCommitTest : public LoadTableTest {
+ protected:
+  void SetUp() override {
+    LoadTableTest::SetUp();
+    g_enable_ingest_group_commit = true;
+    g_ingest_group_commit_rows = 3;
+    // only commit on the number of rows unless a test lowers it
+    g_ingest_group_commit_interval_ms = 60 * 60 * 1000;
+  }
+
+  void TearDown() override {
+    queued_load_.reset();
+    g_enable_ingest_group_commit = false;
+    g_ingest_group_commit_rows = 1000000;
+    g_ingest_group_commit_interval_ms = 1000;
+    LoadTableTest::TearDown();
+  }
+
+  int getTableId() {
+    const auto td = getCatalog().getMetadataForTable("load_test", false);
+    CHECK(td);
+    return td->tableId;
+  }
+
+  int32_t getTableEpoch() {
+    auto& catalog = getCatalog();
+    const auto table_epochs =
+        catalog.getTableEpochs(catalog.getDatabaseId(), getTableId());
+    CHECK_EQ(table_epochs.size(), size_t(1));
+    return table_epochs[0].table_epoch;
+  }
+
+  // Queues a load that never appends, so that the loads ahead of it leave their rows
+  // pending until it leaves the queue.
+  void queueLoad() {
+    queued_load_ =
+        import_export::GroupCommitMgr::instance().queueLoad(getCatalog(), getTableId());
+  }
+
+  void loadRow() {
+    auto* handler = getDbHandlerAndSessionId().first;
+    auto& session = getDbHandlerAndSessionId().second;
+    handler->load_table_binary_columnar(
+        session, "load_test", {i1_column, s_column, nns_column}, {});
+  }
+
+  // Loads a row from another thread, since loads only return once committed.
+  std::future<void> loadRowAsync() {
+    return std::async(std::launch::async, [this] { loadRow(); });
+  }
+
+  // Waits for rows to be appended, they are visible before being committed.
+  void waitForRowCount(const int64_t row_count) {
+    for (int attempt = 0; attempt < 200; ++attempt) {
+      TQueryResult result;
+      sql(result, "SELECT count(*) FROM load_test");
+      if (result.row_set.columns[0].data.int_col[0] == row_count) {
+        return;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    FAIL() << "Timed out waiting for " << row_count << " rows";
+  }
+
+  std::unique_ptr<import_export::GroupCommitMgr::QueuedLoad> queued_load_;
+};
+
+TEST_F(LoadTableGroupCommitTest, CommitWhenNoLoadQueued) {
+  const auto initial_epoch = getTableEpoch();
+  loadRow();
+  EXPECT_EQ(getTableEpoch(), initial_epoch + 1);
+  loadRow();
+  EXPECT_EQ(getTableEpoch(), initial_epoch + 2);
+  sqlAndCompareResult("SELECT count(*) FROM load_test", {{i(2)}});
+}
+
+TEST_F(LoadTableGroupCommitTest, LastQueuedLoadCommits) {
+  g_ingest_group_commit_rows = 1000;
+  const auto initial_epoch = getTableEpoch();
+  auto& group_commit_mgr = import_export::GroupCommitMgr::instance();
+  std::vector<std::future<void>> pending_loads;
+  {
+    // hold the table lock so that both loads queue for it
+    const auto insert_data_lock =
+        lockmgr::InsertDataLockMgr::getWriteLockForTable(getCatalog(), "load_test");
+    pending_loads.emplace_back(loadRowAsync());
+    pending_loads.emplace_back(loadRowAsync());
+    for (int attempt = 0; attempt < 200; ++attempt) {
+      if (group_commit_mgr.getNumQueuedLoads(getCatalog(), getTableId()) == 2) {
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(group_commit_mgr.getNumQueuedLoads(getCatalog(), getTableId()), size_t(2));
+  }
+  for (auto& pending_load : pending_loads) {
+    pending_load.get();
+  }
+  // the first load left its row to the second one
+  EXPECT_EQ(getTableEpoch(), initial_epoch + 1);
+  sqlAndCompareResult("SELECT count(*) FROM load_test", {{i(2)}});
+}
+
+TEST_F(LoadTableGroupCommitTest, CommitOnRowCount) {
+  queueLoad();
+  const auto initial_epoch = getTableEpoch();
+  std::vector<std::future<void>> pending_loads;
+  for (int64_t row_count = 1; row_count < 3; ++row_count) {
+    pending_loads.emplace_back(loadRowAsync());
+    waitForRowCount(row_count);
+    EXPECT_EQ(getTableEpoch(), initial_epoch);
+  }
+  for (const auto& pending_load : pending_loads) {
+    EXPECT_EQ(pending_load.wait_for(std::chrono::milliseconds(0)),
+              std::future_status::timeout);
+  }
+  loadRow();
+  for (auto& pending_load : pending_loads) {
+    pending_load.get();
+  }
+  EXPECT_EQ(getTableEpoch(), initial_epoch + 1);
+  sqlAndCompareResult("SELECT count(*) FROM load_test", {{i(3)}});
+}
+
+TEST_F(LoadTableGroupCommitTest, CommitOnInterval) {
+  queueLoad();
+  g_ingest_group_commit_interval_ms = 50;
+  const auto initial_epoch = getTableEpoch();
+  loadRow();
+  EXPECT_EQ(getTableEpoch(), initial_epoch + 1);
+  sqlAndCompareResult("SELECT * FROM load_test", {{i(1), "s", "nns"}});
+}
+
+TEST_F(LoadTableGroupCommitTest, CommitWhenQueuedLoadLeaves) {
+  queueLoad();
+  const auto initial_epoch = getTableEpoch();
+  auto pending_load = loadRowAsync();
+  waitForRowCount(1);
+  EXPECT_EQ(pending_load.wait_for(std::chrono::milliseconds(0)),
+            std::future_status::timeout);
+
+  // the load the row was left to gives up without appending
+  queued_load_.reset();
+  pending_load.get();
+  EXPECT_EQ(getTableEpoch(), initial_epoch + 1);
+}
+
+TEST_F(LoadTableGroupCommitTest, FailedAppendFailsPendingLoads) {
+  queueLoad();
+  auto pending_load = loadRowAsync();
+  waitForRowCount(1);
+
+  auto* handler = getDbHandlerAndSessionId().first;
+  auto& session = getDbHandlerAndSessionId().second;
+  std::vector<TColumn> columns{i1_column, s_column, nns_column};
+  for (auto& column : columns) {
+    column.nulls.assign(300, false);
+  }
+  columns[0].data.int_col.assign(300, 1);
+  columns[1].data.str_col.clear();
+  for (int value = 0; value < 300; value++) {
+    columns[1].data.str_col.emplace_back(std::to_string(value));
+  }
+  columns[2].data.str_col.assign(300, "nns");
+  executeLambdaAndAssertPartialException(
+      [&]() { handler->load_table_binary_columnar(session, "load_test", columns, {}); },
+      "has exceeded its limit of 8 bits (255 unique values).");
+
+  // the uncommitted row went with the failed append, without having been acknowledged
+  EXPECT_THROW(pending_load.get(), TOmniSciException);
+  sqlAndCompareResult("SELECT count(*) FROM load_test", {{i(0)}});
+}
+
+TEST_F(LoadTableGroupCommitTest, InsertCommitsPendingRows) {
+  queueLoad();
+  const auto initial_epoch = getTableEpoch();
+  auto pending_load = loadRowAsync();
+  waitForRowCount(1);
+
+  sql("INSERT INTO load_test VALUES (2, 's', 'nns');");
+  pending_load.get();
+  // one epoch for the pending row, one for the insert
+  EXPECT_EQ(getTableEpoch(), initial_epoch + 2);
+  sqlAndCompareResult("SELECT i1 FROM load_test ORDER BY i1", {{i(1)}, {i(2)}});
+}
+
 // TODO(max): load_table_binary doesn't support tables with geo columns yet
 TEST_F(LoadTableTest, DISABLED_BinaryAllColumns) {
   auto* handler = getDbHandlerAndSessionId().first;
@@ -17,8 +17,10 @@
 #include "QueryRunner/QueryRunner.h"
 
 #include <gtest/gtest.h>
+#include <cmath>
 #include <functional>
 #include <iostream>
+#include <sstream>
 #include <string>
 
 #include "QueryEngine/ArrowResultSet.h"
@@ -624,6 +626,111 @@ TEST_F(OverlapsTest, CacheBehaviorUnderQueryHint) {
   ASSERT_EQ(QR::get()->getNumberOfCachedOverlapsHashTables(), (size_t)7);
 }
 
+TEST(OverlapsPolygonEdgeIndex, JoinPolyPointContains) {
+  // star shaped polygons with a square hole, with enough edges to be indexed, and a
+  // small square which isn't
+  const auto star_wkt = [](const double cx, const double cy) {
+    std::ostringstream oss;
+    oss.precision(17);
+    oss << "POLYGON((";
+    constexpr int kNumPoints = 64;
+    for (int i = 0; i <= kNumPoints; ++i) {
+      const double angle = 2 * M_PI * (i % kNumPoints) / kNumPoints;
+      const double radius = i % 2 ? 4 : 10;
+      oss << (i ? "," : "") << cx + radius * std::cos(angle) << " "
+          << cy + radius * std::sin(angle);
+    }
+    oss << "),(" << cx - 1 << " " << cy - 1 << "," << cx - 1 << " " << cy + 1 << ","
+        << cx + 1 << " " << cy + 1 << "," << cx + 1 << " " << cy - 1 << "," << cx - 1
+        << " " << cy - 1 << "))";
+    return oss.str();
+  };
+  const auto point_wkt = [](const double x, const double y) {
+    std::ostringstream oss;
+    oss.precision(17);
+    oss << "POINT(" << x << " " << y << ")";
+    return oss.str();
+  };
+
+  QR::get()->runDDLStatement("DROP TABLE IF EXISTS edge_index_polys;");
+  QR::get()->runDDLStatement("DROP TABLE IF EXISTS edge_index_points;");
+  ScopeGuard drop_tables = [] {
+    QR::get()->runDDLStatement("DROP TABLE IF EXISTS edge_index_polys;");
+    QR::get()->runDDLStatement("DROP TABLE IF EXISTS edge_index_points;");
+  };
+  QR::get()->runDDLStatement(
+      "CREATE TABLE edge_index_polys (id INT, poly GEOMETRY(POLYGON, 4326), upoly "
+      "GEOMETRY(POLYGON, 4326) ENCODING NONE) WITH (FRAGMENT_SIZE=2);");
+  QR::get()->runDDLStatement(
+      "CREATE TABLE edge_index_points (id INT, pt GEOMETRY(POINT, 4326), upt "
+      "GEOMETRY(POINT, 4326) ENCODING NONE);");
+
+  const std::vector<std::pair<double, double>> centers{
+      {0, 0}, {25, 5}, {50, -10}, {5, 30}, {30, 30}};
+  int id{0};
+  for (const auto& [cx, cy] : centers) {
+    const auto wkt = star_wkt(cx, cy);
+    QR::get()->runSQL("INSERT INTO edge_index_polys VALUES (" + std::to_string(id++) +
+                          ", '" + wkt + "', '" + wkt + "');",
+                      ExecutorDeviceType::CPU);
+  }
+  const std::string square_wkt{"POLYGON((55 35,60 35,60 40,55 40,55 35))"};
+  QR::get()->runSQL("INSERT INTO edge_index_polys VALUES (" + std::to_string(id++) +
+                        ", '" + square_wkt + "', '" + square_wkt + "');",
+                    ExecutorDeviceType::CPU);
+
+  // a grid of points, and the vertices of the first star, which are on its edges
+  std::vector<std::pair<double, double>> points;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      points.emplace_back(-12 + 3.7 * i, -22 + 3.4 * j);
+    }
+  }
+  for (int i = 0; i < 64; ++i) {
+    const double angle = 2 * M_PI * i / 64;
+    const double radius = i % 2 ? 4 : 10;
+    points.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+  }
+  id = 0;
+  for (const auto& [x, y] : points) {
+    const auto wkt = point_wkt(x, y);
+    QR::get()->runSQL("INSERT INTO edge_index_points VALUES (" + std::to_string(id++) +
+                          ", '" + wkt + "', '" + wkt + "');",
+                      ExecutorDeviceType::CPU);
+  }
+
+  const auto enable_polygon_edge_index_state = g_enable_overlaps_polygon_edge_index;
+  ScopeGuard reset_polygon_edge_index_state = [&enable_polygon_edge_index_state] {
+    g_enable_overlaps_polygon_edge_index = enable_polygon_edge_index_state;
+  };
+
+  executeAllScenarios([&](const ExecutorDeviceType dt) {
+    for (const auto& [poly_col, pt_col] :
+         {std::make_pair("poly", "pt"), std::make_pair("upoly", "upt")}) {
+      const auto sql = std::string("SELECT count(*) FROM edge_index_points AS b JOIN "
+                                   "edge_index_polys AS a ON ST_Contains(a.") +
+                       poly_col + ", b." + pt_col + ");";
+      QR::get()->clearCpuMemory();
+      g_enable_overlaps_polygon_edge_index = false;
+      const auto expected = v<int64_t>(execSQL(sql, dt));
+      ASSERT_GT(expected, 0);
+      ASSERT_EQ(OverlapsJoinHashTable::getPolygonEdgeIndexCache()
+                    ->getNumberOfCachedHashTables(),
+                size_t(0));
+
+      g_enable_overlaps_polygon_edge_index = true;
+      ASSERT_EQ(expected, v<int64_t>(execSQL(sql, dt))) << sql;
+      if (g_enable_overlaps_hashjoin && dt == ExecutorDeviceType::CPU) {
+        ASSERT_EQ(OverlapsJoinHashTable::getPolygonEdgeIndexCache()
+                      ->getNumberOfCachedHashTables(),
+                  size_t(1));
+        // the second run uses the cached index
+        ASSERT_EQ(expected, v<int64_t>(execSQL(sql, dt))) << sql;
+      }
+    }
+  });
+}
+
 class OverlapsJoinHashTableMock : public OverlapsJoinHashTable {
  public:
   struct ExpectedValues {
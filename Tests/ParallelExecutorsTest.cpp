@@ -599,6 +599,86 @@ TEST_F(UpdateDeleteTestEnv, UpdateDelete_TwoTables) {
   }
 }
 
+namespace {
+
+// Occupies the only worker of the queue until released, so that the tasks submitted
+// afterwards are dispatched in scheduling order.
+class DispatchQueueBlocker {
+ public:
+  DispatchQueueBlocker(QueryDispatchQueue& queue) {
+    auto started = std::make_shared<std::promise<void>>();
+    auto release_future = release_.get_future().share();
+    task_ = std::make_shared<QueryDispatchQueue::Task>(
+        [started, release_future](const size_t) {
+          started->set_value();
+          release_future.wait();
+        });
+    auto started_future = started->get_future();
+    queue.submit(task_, /*is_update_delete=*/false);
+    started_future.wait();
+  }
+
+  void release() {
+    release_.set_value();
+    task_->get_future().get();
+  }
+
+ private:
+  std::promise<void> release_;
+  std::shared_ptr<QueryDispatchQueue::Task> task_;
+};
+
+std::vector<std::string> run_in_dispatch_order(
+    QueryDispatchQueue& queue,
+    const std::vector<std::pair<std::string, QueryDispatchQueue::Priority>>& queries) {
+  DispatchQueueBlocker blocker(queue);
+  std::vector<std::string> dispatch_order;
+  std::vector<std::shared_ptr<QueryDispatchQueue::Task>> tasks;
+  for (size_t i = 0; i < queries.size(); ++i) {
+    const auto& [user_name, priority] = queries[i];
+    const auto query_name = user_name + std::to_string(i);
+    // the queue has a single worker, the tasks do not run concurrently
+    tasks.push_back(std::make_shared<QueryDispatchQueue::Task>(
+        [&dispatch_order, query_name](const size_t) {
+          dispatch_order.push_back(query_name);
+        }));
+    queue.submit(tasks.back(), /*is_update_delete=*/false, user_name, priority);
+  }
+  blocker.release();
+  for (auto& task : tasks) {
+    task->get_future().get();
+  }
+  return dispatch_order;
+}
+
+}  // namespace
+
+TEST(DispatchQueue, FairShareAcrossUsers) {
+  QueryDispatchQueue queue(1);
+  const auto normal = QueryDispatchQueue::Priority::kNormal;
+  const auto dispatch_order = run_in_dispatch_order(
+      queue, {{"a", normal}, {"a", normal}, {"a", normal}, {"b", normal}});
+  const std::vector<std::string> expected_order{"a0", "b3", "a1", "a2"};
+  EXPECT_EQ(dispatch_order, expected_order);
+
+  const auto stats = queue.getStats();
+  EXPECT_EQ(stats.queue_depth, size_t(0));
+  EXPECT_EQ(stats.max_queue_depth, size_t(4));
+  EXPECT_EQ(stats.num_dispatched, size_t(5));
+}
+
+TEST(DispatchQueue, InteractiveBeforeBatch) {
+  QueryDispatchQueue queue(1);
+  const auto dispatch_order =
+      run_in_dispatch_order(queue,
+                            {{"a", QueryDispatchQueue::Priority::kBatch},
+                             {"a", QueryDispatchQueue::Priority::kBatch},
+                             {"b", QueryDispatchQueue::Priority::kInteractive},
+                             {"c", QueryDispatchQueue::Priority::kNormal}});
+  const std::vector<std::string> expected_order{"b2", "c3", "a0", "a1"};
+  EXPECT_EQ(dispatch_order, expected_order);
+}
+
 int main(int argc, char* argv[]) {
   g_is_test_env = true;
 
@@ -0,0 +1,127 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "Logger/Logger.h"
+#include "QueryEngine/ResultSet.h"
+#include "QueryEngine/ResultSetCache.h"
+#include "QueryRunner/QueryRunner.h"
+#include "TestHelpers.h"
+
+#ifndef BASE_PATH
+#define BASE_PATH "./tmp"
+#endif
+
+using namespace TestHelpers;
+
+using QR = QueryRunner::QueryRunner;
+
+namespace {
+
+std::shared_ptr<ResultSet> run_query(const std::string& query_str) {
+  return QR::get()->runSQL(query_str, ExecutorDeviceType::CPU, true, true);
+}
+
+int64_t run_simple_agg(const std::string& query_str) {
+  const auto rows = run_query(query_str);
+  const auto crt_row = rows->getNextRow(true, true);
+  CHECK_EQ(size_t(1), crt_row.size());
+  return v<int64_t>(crt_row[0]);
+}
+
+}  // namespace
+
+class ResultSetCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    g_enable_result_set_cache = true;
+    ResultSetCache::instance().clear();
+    QR::get()->runDDLStatement("DROP TABLE IF EXISTS result_set_cache_test;");
+    QR::get()->runDDLStatement("CREATE TABLE result_set_cache_test (x INT);");
+    for (int i = 1; i <= 3; ++i) {
+      run_query("INSERT INTO result_set_cache_test VALUES (" + std::to_string(i) + ");");
+    }
+  }
+
+  void TearDown() override {
+    QR::get()->runDDLStatement("DROP TABLE IF EXISTS result_set_cache_test;");
+    ResultSetCache::instance().clear();
+    g_enable_result_set_cache = false;
+  }
+};
+
+TEST_F(ResultSetCacheTest, ReuseUntilTableChanges) {
+  const std::string query{"SELECT SUM(x) FROM result_set_cache_test;"};
+  auto& cache = ResultSetCache::instance();
+  EXPECT_EQ(int64_t(6), run_simple_agg(query));
+  EXPECT_EQ(size_t(1), cache.getStats().num_entries);
+  const auto hits = cache.getStats().hits;
+  EXPECT_EQ(int64_t(6), run_simple_agg(query));
+  EXPECT_EQ(hits + 1, cache.getStats().hits);
+
+  // the insert changes the tuple count of the table
+  run_query("INSERT INTO result_set_cache_test VALUES (4);");
+  EXPECT_EQ(int64_t(10), run_simple_agg(query));
+  EXPECT_EQ(hits + 1, cache.getStats().hits);
+
+  // the update invalidates the cache
+  run_query("UPDATE result_set_cache_test SET x = 0 WHERE x = 4;");
+  EXPECT_EQ(size_t(0), cache.getStats().num_entries);
+  EXPECT_EQ(int64_t(6), run_simple_agg(query));
+  EXPECT_EQ(int64_t(6), run_simple_agg(query));
+  EXPECT_EQ(hits + 2, cache.getStats().hits);
+}
+
+TEST_F(ResultSetCacheTest, ConcurrentReadersGetReplicas) {
+  const std::string query{"SELECT MAX(x) FROM result_set_cache_test;"};
+  auto& cache = ResultSetCache::instance();
+  const auto held_rows = run_query(query);
+  // the cached result set is held, the query runs again and caches a second copy
+  EXPECT_EQ(int64_t(3), run_simple_agg(query));
+  EXPECT_EQ(size_t(2), cache.getStats().num_entries);
+  const auto hits = cache.getStats().hits;
+  EXPECT_EQ(int64_t(3), run_simple_agg(query));
+  EXPECT_EQ(hits + 1, cache.getStats().hits);
+  const auto crt_row = held_rows->getNextRow(true, true);
+  ASSERT_EQ(size_t(1), crt_row.size());
+  EXPECT_EQ(int64_t(3), v<int64_t>(crt_row[0]));
+}
+
+TEST_F(ResultSetCacheTest, SkipNonDeterministicQueries) {
+  auto& cache = ResultSetCache::instance();
+  EXPECT_EQ(int64_t(3),
+            run_simple_agg("SELECT COUNT(*) FROM result_set_cache_test WHERE NOW() > "
+                           "TIMESTAMP '2000-01-01 00:00:00';"));
+  EXPECT_EQ(size_t(0), cache.getStats().num_entries);
+}
+
+int main(int argc, char** argv) {
+  TestHelpers::init_logger_stderr_only(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+
+  QR::init(BASE_PATH);
+
+  int err{0};
+  try {
+    err = RUN_ALL_TESTS();
+  } catch (const std::exception& e) {
+    LOG(ERROR) << e.what();
+  }
+
+  QR::reset();
+  return err;
+}
@@ -29,6 +29,7 @@
 #include "QueryEngine/ResultSetReductionJIT.h"
 #include "QueryEngine/RuntimeFunctions.h"
 #include "QueryRunner/QueryRunner.h"
+#include "Shared/scope.h"
 #include "StringDictionary/StringDictionary.h"
 #include "Tests/TestHelpers.h"
 
@@ -44,6 +45,7 @@
 using QR = QueryRunner::QueryRunner;
 
 extern bool g_is_test_env;
+extern bool g_enable_partitioned_reduction;
 
 bool skip_tests(const ExecutorDeviceType device_type) {
 #ifdef HAVE_CUDA
@@ -1031,6 +1033,71 @@ void run_reduction(const std::vector<TargetInfo>& target_infos,
   rs_manager.reduce(storage_set);
 }
 
+// Reduces |num_result_sets| result sets filled with the same groups, either with the
+// key partitioned parallel reduction or with the serial pairwise fold, and returns the
+// non-empty rows of the result as sorted numeric tuples.
+std::vector<std::vector<double>> reduce_many(const std::vector<TargetInfo>& target_infos,
+                                             const QueryMemoryDescriptor& query_mem_desc,
+                                             const size_t num_result_sets,
+                                             const bool partitioned) {
+  const auto row_set_mem_owner =
+      std::make_shared<RowSetMemoryOwner>(Executor::getArenaBlockSize());
+  std::vector<std::unique_ptr<ResultSet>> result_sets;
+  std::vector<ResultSet*> storage_set;
+  for (size_t i = 0; i < num_result_sets; ++i) {
+    result_sets.emplace_back(std::make_unique<ResultSet>(target_infos,
+                                                         ExecutorDeviceType::CPU,
+                                                         query_mem_desc,
+                                                         row_set_mem_owner,
+                                                         nullptr,
+                                                         0,
+                                                         0));
+    const auto storage = result_sets.back()->allocateStorage();
+    EvenNumberGenerator generator;
+    fill_storage_buffer(
+        storage->getUnderlyingBuffer(), target_infos, query_mem_desc, generator, 2);
+    storage_set.push_back(result_sets.back().get());
+  }
+  const bool enable_partitioned_reduction = g_enable_partitioned_reduction;
+  ScopeGuard reset_flag = [enable_partitioned_reduction] {
+    g_enable_partitioned_reduction = enable_partitioned_reduction;
+  };
+  g_enable_partitioned_reduction = partitioned;
+  ResultSetManager rs_manager;
+  auto result_rs = rs_manager.reduce(storage_set);
+  std::vector<std::vector<double>> rows;
+  while (true) {
+    const auto row = result_rs->getNextRow(false, false);
+    if (row.empty()) {
+      break;
+    }
+    CHECK_EQ(target_infos.size(), row.size());
+    std::vector<double> values;
+    for (size_t i = 0; i < target_infos.size(); ++i) {
+      values.push_back(target_infos[i].agg_kind == kAVG
+                           ? v<double>(row[i])
+                           : static_cast<double>(v<int64_t>(row[i])));
+    }
+    rows.push_back(values);
+  }
+  std::sort(rows.begin(), rows.end());
+  return rows;
+}
+
+void test_reduce_partitioned(const std::vector<TargetInfo>& target_infos,
+                             const QueryMemoryDescriptor& query_mem_desc) {
+  // enough result sets and entries to go above the multithreaded reduction threshold
+  const size_t num_result_sets{4};
+  const auto expected_rows =
+      reduce_many(target_infos, query_mem_desc, num_result_sets, false);
+  const auto rows = reduce_many(target_infos, query_mem_desc, num_result_sets, true);
+  ASSERT_EQ(expected_rows.size(), query_mem_desc.getEntryCount() / 2);
+  ASSERT_EQ(expected_rows.size(), rows.size());
+  for (size_t i = 0; i < rows.size(); ++i) {
+    ASSERT_EQ(expected_rows[i], rows[i]);
+  }
+}
+
 void test_reduce(const std::vector<TargetInfo>& target_infos,
                  const QueryMemoryDescriptor& query_mem_desc,
                  NumberGenerator& generator1,
@@ -1847,6 +1914,34 @@ TEST(Reduce, BaselineHashColumnar) {
   test_reduce(target_infos, query_mem_desc, generator1, generator2, 1, true);
 }
 
+TEST(ReducePartitioned, PerfectHashOneCol) {
+  const auto target_infos = generate_random_groups_nullable_target_infos();
+  const auto query_mem_desc = perfect_hash_one_col_desc(target_infos, 8, 0, 59999);
+  test_reduce_partitioned(target_infos, query_mem_desc);
+}
+
+TEST(ReducePartitioned, PerfectHashOneColColumnar) {
+  const auto target_infos = generate_random_groups_nullable_target_infos();
+  auto query_mem_desc = perfect_hash_one_col_desc(target_infos, 8, 0, 59999);
+  query_mem_desc.setOutputColumnar(true);
+  test_reduce_partitioned(target_infos, query_mem_desc);
+}
+
+TEST(ReducePartitioned, BaselineHash) {
+  const auto target_infos = generate_random_groups_nullable_target_infos();
+  auto query_mem_desc = baseline_hash_two_col_desc(target_infos, 8);
+  query_mem_desc.setEntryCount(60000);
+  test_reduce_partitioned(target_infos, query_mem_desc);
+}
+
+TEST(ReducePartitioned, BaselineHashColumnar) {
+  const auto target_infos = generate_random_groups_nullable_target_infos();
+  auto query_mem_desc = baseline_hash_two_col_desc(target_infos, 8);
+  query_mem_desc.setEntryCount(60000);
+  query_mem_desc.setOutputColumnar(true);
+  test_reduce_partitioned(target_infos, query_mem_desc);
+}
+
 #ifndef HAVE_TSAN
 // The large buffers tests allocate too much memory to instrument under TSAN
 TEST(ReduceLargeBuffers, PerfectHashOne_Overflow32) {
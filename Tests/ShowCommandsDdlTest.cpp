@@ -1183,6 +1183,19 @@ TEST_F(ShowCreateTableTest, TableWithMaxRollbackEpochs) {
                         "(MAX_ROLLBACK_EPOCHS=10);"}});
 }
 
+TEST_F(ShowCreateTableTest, TableWithPageCompression) {
+  sql("CREATE TABLE showcreatetabletest (c1 INTEGER) WITH (COMPRESSION = 'blosc');");
+  sqlAndCompareResult("SHOW CREATE TABLE showcreatetabletest;",
+                      {{"CREATE TABLE showcreatetabletest (\n  c1 INTEGER)\nWITH "
+                        "(COMPRESSION='BLOSC');"}});
+}
+
+TEST_F(ShowCreateTableTest, TableWithInvalidPageCompression) {
+  queryAndAssertPartialException(
+      "CREATE TABLE showcreatetabletest (c1 INTEGER) WITH (COMPRESSION = 'zip');",
+      "COMPRESSION must be BLOSC or NONE");
+}
+
 namespace {
 const int64_t PAGES_PER_DATA_FILE =
     File_Namespace::FileMgr::DEFAULT_NUM_PAGES_PER_DATA_FILE;
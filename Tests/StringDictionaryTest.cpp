@@ -18,6 +18,9 @@
 
 #include "../StringDictionary/StringDictionary.h"
 
+#include <boost/filesystem.hpp>
+
+#include <algorithm>
 #include <cstdlib>
 #include <limits>
 
@@ -27,6 +30,24 @@
 
 extern bool g_cache_string_hash;
 
+namespace {
+
+std::vector<int32_t> sorted(std::vector<int32_t> ids) {
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+void add_trigram_test_strings(StringDictionary& string_dict) {
+  for (int i = 0; i < 1000; ++i) {
+    string_dict.getOrAdd("Row " + std::to_string(i) + (i % 3 ? " foobar" : " barbaz") +
+                         (i % 7 ? "" : " 50%_off"));
+  }
+  string_dict.getOrAdd("ab");
+  string_dict.getOrAdd("");
+}
+
+}  // namespace
+
 TEST(StringDictionary, AddAndGet) {
   StringDictionary string_dict(BASE_PATH, false, false, g_cache_string_hash);
   auto id1 = string_dict.getOrAdd("foo bar");
@@ -101,6 +122,131 @@ TEST(StringDictionary, RecoverMany) {
   }
 }
 
+TEST(StringDictionary, TrigramIndexMatchesScan) {
+  StringDictionary scanned_dict(std::string{}, true, false, g_cache_string_hash);
+  StringDictionary indexed_dict(std::string{}, true, false, g_cache_string_hash);
+  add_trigram_test_strings(scanned_dict);
+  add_trigram_test_strings(indexed_dict);
+  const auto generation = scanned_dict.storageEntryCount();
+  ASSERT_EQ(generation, indexed_dict.storageEntryCount());
+
+  const std::vector<std::tuple<std::string, bool, bool>> like_patterns{
+      {"%foobar%", false, false},
+      {"%FOOBAR", true, false},
+      {"%FOOBAR", false, false},
+      {"Row 1__ bar%", false, false},
+      {"%50\\%\\_off", false, false},
+      {"%no such string%", false, false},
+      {"%ab%", false, false},
+      {"barbaz", false, true}};
+  for (const auto& [pattern, icase, is_simple] : like_patterns) {
+    const auto expected = sorted(
+        scanned_dict.getLike(pattern, icase, is_simple, '\\', generation));
+    g_enable_string_dict_trigram_index = true;
+    const auto actual =
+        sorted(indexed_dict.getLike(pattern, icase, is_simple, '\\', generation));
+    g_enable_string_dict_trigram_index = false;
+    EXPECT_EQ(expected, actual) << pattern;
+  }
+
+  for (const std::string pattern :
+       {"Row [0-9]+ foobar", "Row 12?3 barbaz.*", "(Row|row) 1.*", ".*50%_off"}) {
+    const auto expected =
+        sorted(scanned_dict.getRegexpLike(pattern, '\\', generation));
+    g_enable_string_dict_trigram_index = true;
+    const auto actual = sorted(indexed_dict.getRegexpLike(pattern, '\\', generation));
+    g_enable_string_dict_trigram_index = false;
+    EXPECT_EQ(expected, actual) << pattern;
+  }
+}
+
+TEST(StringDictionary, TrigramIndexPersists) {
+  const auto folder = boost::filesystem::path(BASE_PATH) / "trigram_index_test";
+  boost::filesystem::remove_all(folder);
+  boost::filesystem::create_directories(folder);
+  g_enable_string_dict_trigram_index = true;
+  std::vector<int32_t> expected;
+  {
+    StringDictionary string_dict(folder.string(), false, false, g_cache_string_hash);
+    add_trigram_test_strings(string_dict);
+    expected = sorted(string_dict.getLike(
+        "%foobar%", false, false, '\\', string_dict.storageEntryCount()));
+    ASSERT_TRUE(string_dict.checkpoint());
+  }
+  EXPECT_TRUE(boost::filesystem::exists(folder / "DictTrigrams"));
+  {
+    StringDictionary string_dict(folder.string(), false, true, g_cache_string_hash);
+    // strings added after the checkpoint extend the loaded index
+    const auto id = string_dict.getOrAdd("a new foobar");
+    expected.push_back(id);
+    EXPECT_EQ(expected,
+              sorted(string_dict.getLike(
+                  "%foobar%", false, false, '\\', string_dict.storageEntryCount())));
+  }
+  g_enable_string_dict_trigram_index = false;
+  boost::filesystem::remove_all(folder);
+}
+
+TEST(StringDictionary, CachedMatchesExtendAfterAppend) {
+  StringDictionary string_dict(std::string{}, true, false, g_cache_string_hash);
+  add_trigram_test_strings(string_dict);
+  const auto old_generation = string_dict.storageEntryCount();
+  const auto old_like =
+      string_dict.getLike("%foobar%", false, false, '\\', old_generation);
+  const auto old_regexp = string_dict.getRegexpLike("Row 1.*", '\\', old_generation);
+  const auto old_strings = string_dict.copyStrings();
+
+  const auto like_id = string_dict.getOrAdd("a new foobar");
+  const auto regexp_id = string_dict.getOrAdd("Row 1 again");
+  const auto generation = string_dict.storageEntryCount();
+  const auto hits_before = StringDictionary::getCacheStats().hits;
+
+  auto expected_like = old_like;
+  expected_like.push_back(like_id);
+  EXPECT_EQ(expected_like,
+            string_dict.getLike("%foobar%", false, false, '\\', generation));
+  auto expected_regexp = old_regexp;
+  expected_regexp.push_back(regexp_id);
+  EXPECT_EQ(expected_regexp, string_dict.getRegexpLike("Row 1.*", '\\', generation));
+  // the extended entries still answer queries on the older generation
+  EXPECT_EQ(old_like,
+            string_dict.getLike("%foobar%", false, false, '\\', old_generation));
+  EXPECT_EQ(StringDictionary::getCacheStats().hits, hits_before + 3);
+
+  const auto strings = string_dict.copyStrings();
+  ASSERT_EQ(strings->size(), generation);
+  EXPECT_EQ(old_strings->size(), old_generation);
+  EXPECT_EQ((*strings)[like_id], "a new foobar");
+  EXPECT_EQ((*strings)[regexp_id], "Row 1 again");
+}
+
+TEST(StringDictionary, CacheStaysWithinBudget) {
+  const auto max_size_bytes = g_string_dict_cache_max_size_bytes;
+  g_string_dict_cache_max_size_bytes = 16 * 1024;
+  const auto evictions_before = StringDictionary::getCacheStats().evictions;
+  {
+    StringDictionary string_dict(std::string{}, true, false, g_cache_string_hash);
+    add_trigram_test_strings(string_dict);
+    const auto generation = string_dict.storageEntryCount();
+    for (int i = 0; i < 100; ++i) {
+      string_dict.getLike(
+          "Row " + std::to_string(i) + "%", false, false, '\\', generation);
+      EXPECT_LE(StringDictionary::getCacheStats().size_bytes,
+                g_string_dict_cache_max_size_bytes);
+    }
+    EXPECT_GT(StringDictionary::getCacheStats().evictions, evictions_before);
+
+    // a copy of the strings larger than the budget is still kept, outside the budget
+    const auto num_entries = StringDictionary::getCacheStats().num_entries;
+    const auto strings = string_dict.copyStrings();
+    EXPECT_EQ(strings, string_dict.copyStrings());
+    EXPECT_EQ(StringDictionary::getCacheStats().num_entries, num_entries);
+  }
+  // destroyed dictionaries drop their entries
+  EXPECT_EQ(StringDictionary::getCacheStats().num_entries, size_t(0));
+  g_string_dict_cache_max_size_bytes = max_size_bytes;
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
 
@@ -20,6 +20,7 @@
 
 #include "QueryEngine/ResultSet.h"
 #include "QueryRunner/QueryRunner.h"
+#include "Shared/scope.h"
 
 #ifndef BASE_PATH
 #define BASE_PATH "./tmp"
@@ -28,6 +29,7 @@
 using QR = QueryRunner::QueryRunner;
 
 extern bool g_enable_table_functions;
+extern size_t g_table_function_partition_min_rows;
 
 namespace {
 
@@ -165,6 +167,45 @@ TEST_F(TableFunctions, GroupByInAndOut) {
   }
 }
 
+TEST_F(TableFunctions, Partitioned) {
+  const auto partition_min_rows = g_table_function_partition_min_rows;
+  ScopeGuard reset_partition_min_rows = [partition_min_rows] {
+    g_table_function_partition_min_rows = partition_min_rows;
+  };
+  // Run row_copier_text over single row partitions, whose 4 byte dictionary encoded
+  // outputs are concatenated
+  g_table_function_partition_min_rows = 1;
+
+  const auto dt = ExecutorDeviceType::CPU;
+  {
+    const auto rows = run_multiple_agg(
+        "SELECT out0 FROM TABLE(row_copier_text(cursor(SELECT base FROM sd_test),"
+        "2)) ORDER BY out0;",
+        dt);
+    ASSERT_EQ(rows->rowCount(), size_t(10));
+    std::vector<std::string> expected_result_set{"bar", "baz", "foo", "hello", "world"};
+    for (size_t i = 0; i < 10; i++) {
+      auto row = rows->getNextRow(true, false);
+      auto s = boost::get<std::string>(TestHelpers::v<NullableString>(row[0]));
+      ASSERT_EQ(s, expected_result_set[i / 2]);
+    }
+  }
+  {
+    const auto rows = run_multiple_agg(
+        "SELECT out0 FROM TABLE(row_copier_text(cursor(SELECT derived FROM sd_test),"
+        "1));",
+        dt);
+    ASSERT_EQ(rows->rowCount(), size_t(5));
+    // the outputs of the partitions are concatenated in input order
+    std::vector<std::string> expected_result_set{"world", "bar", "baz", "foo", "hello"};
+    for (size_t i = 0; i < 5; i++) {
+      auto row = rows->getNextRow(true, false);
+      auto s = boost::get<std::string>(TestHelpers::v<NullableString>(row[0]));
+      ASSERT_EQ(s, expected_result_set[i]);
+    }
+  }
+}
+
 int main(int argc, char** argv) {
   TestHelpers::init_logger_stderr_only(argc, argv);
   testing::InitGoogleTest(&argc, argv);
@@ -20,6 +20,7 @@
 
 #include "QueryEngine/ResultSet.h"
 #include "QueryRunner/QueryRunner.h"
+#include "Shared/scope.h"
 
 #ifndef BASE_PATH
 #define BASE_PATH "./tmp"
@@ -28,6 +29,7 @@
 using QR = QueryRunner::QueryRunner;
 
 extern bool g_enable_table_functions;
+extern size_t g_table_function_partition_min_rows;
 namespace {
 
 inline void run_ddl_statement(const std::string& stmt) {
@@ -278,6 +280,55 @@ TEST_F(TableFunctions, CallFailure) {
   }
 }
 
+TEST_F(TableFunctions, Partitioned) {
+  const auto partition_min_rows = g_table_function_partition_min_rows;
+  ScopeGuard reset_partition_min_rows = [partition_min_rows] {
+    g_table_function_partition_min_rows = partition_min_rows;
+  };
+  // Run every partitionable table function over single row partitions
+  g_table_function_partition_min_rows = 1;
+
+  const auto dt = ExecutorDeviceType::CPU;
+  {
+    const auto rows = run_multiple_agg(
+        "SELECT out0, count(*) FROM TABLE(row_copier(cursor(SELECT d FROM tf_test), 3)) "
+        "GROUP BY out0 ORDER BY out0;",
+        dt);
+    ASSERT_EQ(rows->rowCount(), size_t(5));
+    for (size_t i = 0; i < 5; i++) {
+      auto crt_row = rows->getNextRow(false, false);
+      ASSERT_DOUBLE_EQ(TestHelpers::v<double>(crt_row[0]), i * 1.1);
+      ASSERT_EQ(TestHelpers::v<int64_t>(crt_row[1]), int64_t(3));
+    }
+  }
+  {
+    const auto rows = run_multiple_agg(
+        "SELECT out0, out1 FROM TABLE(row_addsub(2, cursor(SELECT d, d2 FROM "
+        "tf_test))) ORDER BY out0;",
+        dt);
+    ASSERT_EQ(rows->rowCount(), size_t(10));
+    for (size_t i = 0; i < 10; i++) {
+      auto crt_row = rows->getNextRow(false, false);
+      const auto d = (4 - i / 2) * 1.1;
+      const auto d2 = 1.0 - (4 - i / 2) * 2.2;
+      ASSERT_DOUBLE_EQ(TestHelpers::v<double>(crt_row[0]), d + d2);
+      ASSERT_DOUBLE_EQ(TestHelpers::v<double>(crt_row[1]), d - d2);
+    }
+  }
+  {
+    const auto rows = run_multiple_agg(
+        "SELECT count(*) FROM TABLE(row_adder(4, cursor(SELECT d, d2 FROM tf_test)));",
+        dt);
+    auto crt_row = rows->getNextRow(false, false);
+    ASSERT_EQ(TestHelpers::v<int64_t>(crt_row[0]), int64_t(20));
+  }
+  // Failures in any of the partitions are propagated
+  EXPECT_THROW(run_multiple_agg("SELECT out0 FROM TABLE(row_copier(cursor("
+                                "SELECT d FROM tf_test),101));",
+                                dt),
+               std::runtime_error);
+}
+
 int main(int argc, char** argv) {
   TestHelpers::init_logger_stderr_only(argc, argv);
   testing::InitGoogleTest(&argc, argv);
@@ -21,6 +21,7 @@
 #include <iostream>
 
 #include "CommandLineOptions.h"
+#include "DataMgr/Allocators/NumaSlabAllocator.h"
 #include "LeafHostInfo.h"
 #include "MapDRelease.h"
 #include "QueryEngine/GroupByAndAggregate.h"
@@ -48,6 +49,7 @@ extern size_t g_approx_quantile_buffer;
 extern size_t g_approx_quantile_centroids;
 extern size_t g_parallel_top_min;
 extern size_t g_parallel_top_max;
+extern size_t g_window_function_parallel_min_rows;
 extern size_t g_estimator_failure_max_groupby_size;
 
 namespace Catalog_Namespace {
@@ -210,6 +212,55 @@ void CommandLineOptions::fillOptions() {
                               ->default_value(enable_watchdog)
                               ->implicit_value(true),
                           "Enable watchdog.");
+  help_desc.add_options()(
+      "enable-out-of-core-aggregation",
+      po::value<bool>(&g_enable_out_of_core_aggregation)
+          ->default_value(g_enable_out_of_core_aggregation)
+          ->implicit_value(true),
+      "Aggregate group by queries estimated to have more groups than "
+      "out-of-core-aggregation-max-groups in several passes, each over a range of the "
+      "group keys sized by their own estimated number of groups.");
+  help_desc.add_options()(
+      "out-of-core-aggregation-max-groups",
+      po::value<size_t>(&g_out_of_core_aggregation_max_groups)
+          ->default_value(g_out_of_core_aggregation_max_groups),
+      "Estimated number of groups aggregated in a single pass by out of core "
+      "aggregation.");
+  help_desc.add_options()(
+      "enable-external-sort",
+      po::value<bool>(&g_enable_external_sort)
+          ->default_value(g_enable_external_sort)
+          ->implicit_value(true),
+      "Sort the results of ORDER BY queries exported to CSV files in runs of outer "
+      "fragments spilled to disk, then merge the runs, when the results do not fit the "
+      "sort memory budget.");
+  help_desc.add_options()(
+      "external-sort-memory-budget",
+      po::value<size_t>(&g_external_sort_memory_budget)
+          ->default_value(g_external_sort_memory_budget),
+      "Default memory budget in bytes of an external sort, overridden per query by the "
+      "sort_memory_budget option of COPY TO.");
+  help_desc.add_options()(
+      "enable-ingest-group-commit",
+      po::value<bool>(&g_enable_ingest_group_commit)
+          ->default_value(g_enable_ingest_group_commit)
+          ->implicit_value(true),
+      "Share the checkpoints of load_table calls appending to a table concurrently. A "
+      "call waiting for the table lock leaves the commit of the rows appended ahead of "
+      "it to the last waiting call, which commits them with its own. Calls return once "
+      "their rows are committed, and a table is also committed on reaching "
+      "ingest-group-commit-rows pending rows or ingest-group-commit-interval-ms after "
+      "its first uncommitted append.");
+  help_desc.add_options()(
+      "ingest-group-commit-rows",
+      po::value<size_t>(&g_ingest_group_commit_rows)
+          ->default_value(g_ingest_group_commit_rows),
+      "Number of pending rows committing a table with ingest group commit.");
+  help_desc.add_options()(
+      "ingest-group-commit-interval-ms",
+      po::value<size_t>(&g_ingest_group_commit_interval_ms)
+          ->default_value(g_ingest_group_commit_interval_ms),
+      "Maximum time in milliseconds rows stay uncommitted with ingest group commit.");
   help_desc.add_options()(
       "filter-push-down-low-frac",
       po::value<float>(&g_filter_push_down_low_frac)
@@ -265,6 +316,19 @@ void CommandLineOptions::fillOptions() {
                           "Enable/disable inner join fragment skipping. This feature is "
                           "considered stable and is enabled by default. This "
                           "parameter will be removed in a future release.");
+  help_desc.add_options()("enable-geo-fragment-skipping",
+                          po::value<bool>(&g_enable_geo_fragment_skipping)
+                              ->default_value(g_enable_geo_fragment_skipping)
+                              ->implicit_value(true),
+                          "Skip the fragments whose geo column bounding box can't match "
+                          "ST_Contains, ST_Intersects or ST_DWithin with a literal "
+                          "geometry.");
+  help_desc.add_options()("min-cpu-morsel-rows",
+                          po::value<size_t>(&g_min_cpu_morsel_rows)
+                              ->default_value(g_min_cpu_morsel_rows),
+                          "Minimum number of rows of the ranges large fragments are "
+                          "split into to run on several CPU threads, 0 to disable "
+                          "splitting.");
   help_desc.add_options()(
       "max-session-duration",
       po::value<int>(&max_session_duration)->default_value(max_session_duration),
@@ -283,6 +347,13 @@ void CommandLineOptions::fillOptions() {
       "num-reader-threads",
       po::value<size_t>(&num_reader_threads)->default_value(num_reader_threads),
       "Number of reader threads to use.");
+  help_desc.add_options()(
+      "enable-page-compression",
+      po::value<bool>(&g_enable_page_compression)
+          ->default_value(g_enable_page_compression)
+          ->implicit_value(true),
+      "Store the data pages of tables created without a COMPRESSION option Blosc "
+      "compressed.");
   help_desc.add_options()(
       "max-import-threads",
       po::value<size_t>(&g_max_import_threads)->default_value(g_max_import_threads),
@@ -297,6 +368,56 @@ void CommandLineOptions::fillOptions() {
                           po::value<double>(&g_overlaps_target_entries_per_bin)
                               ->default_value(g_overlaps_target_entries_per_bin),
                           "The target number of hash entries per bin for overlaps join");
+  help_desc.add_options()(
+      "enable-overlaps-polygon-edge-index",
+      po::value<bool>(&g_enable_overlaps_polygon_edge_index)
+          ->default_value(g_enable_overlaps_polygon_edge_index)
+          ->implicit_value(true),
+      "Index the edges of the polygons on the build side of overlaps joins, so that "
+      "ST_Contains on CPU only tests the edges around the y of the point.");
+  help_desc.add_options()(
+      "enable-persistent-code-cache",
+      po::value<bool>(&g_enable_persistent_code_cache)
+          ->default_value(g_enable_persistent_code_cache)
+          ->implicit_value(true),
+      "Keep the object code of compiled CPU queries in the data directory, so that it "
+      "can be reused after a server restart.");
+  help_desc.add_options()(
+      "persistent-code-cache-max-size-bytes",
+      po::value<size_t>(&g_persistent_code_cache_max_size_bytes)
+          ->default_value(g_persistent_code_cache_max_size_bytes),
+      "The maximum size in bytes of the persistent code cache. Least recently used "
+      "entries are removed first.");
+  help_desc.add_options()(
+      "hash-table-cache-max-size-bytes",
+      po::value<size_t>(&g_hash_table_cache_max_size_bytes)
+          ->default_value(g_hash_table_cache_max_size_bytes),
+      "The maximum total size in bytes of the cached hash tables of each join hash "
+      "table cache. Least recently used hash tables are evicted first (0 = unbounded).");
+  help_desc.add_options()("enable-result-set-cache",
+                          po::value<bool>(&g_enable_result_set_cache)
+                              ->default_value(g_enable_result_set_cache)
+                              ->implicit_value(true),
+                          "Reuse the results of queries whose input tables haven't "
+                          "changed since the query last ran.");
+  help_desc.add_options()(
+      "result-set-cache-max-size-bytes",
+      po::value<size_t>(&g_result_set_cache_max_size_bytes)
+          ->default_value(g_result_set_cache_max_size_bytes),
+      "The maximum total size in bytes of the cached query results. Least recently used "
+      "results are evicted first.");
+  help_desc.add_options()("enable-calcite-plan-cache",
+                          po::value<bool>(&g_enable_calcite_plan_cache)
+                              ->default_value(g_enable_calcite_plan_cache)
+                              ->implicit_value(true),
+                          "Reuse the Calcite plans of queries which only differ in the "
+                          "values of their literals, skipping the Calcite round trip.");
+  help_desc.add_options()(
+      "calcite-plan-cache-max-entries",
+      po::value<size_t>(&g_calcite_plan_cache_max_entries)
+          ->default_value(g_calcite_plan_cache_max_entries),
+      "The maximum number of distinct statements in the Calcite plan cache. Least "
+      "recently used statements are evicted first.");
   if (!dist_v5_) {
     help_desc.add_options()("port,p",
                             po::value<int>(&system_parameters.omnisci_server_port)
@@ -406,6 +527,20 @@ void CommandLineOptions::fillOptions() {
           ->default_value(g_enable_stringdict_parallel)
           ->implicit_value(true),
       "Allow StringDictionary to parallelize loads using multiple threads");
+  help_desc.add_options()(
+      "enable-string-dict-trigram-index",
+      po::value<bool>(&g_enable_string_dict_trigram_index)
+          ->default_value(g_enable_string_dict_trigram_index)
+          ->implicit_value(true),
+      "Narrow down LIKE and REGEXP evaluation on string dictionaries with a trigram "
+      "index, which is persisted next to the dictionary.");
+  help_desc.add_options()(
+      "string-dict-cache-max-size-bytes",
+      po::value<size_t>(&g_string_dict_cache_max_size_bytes)
+          ->default_value(g_string_dict_cache_max_size_bytes),
+      "The maximum total size in bytes of the LIKE, REGEXP, comparison and string copy "
+      "results cached for all string dictionaries. Least recently used results are "
+      "evicted first (0 = unbounded).");
   help_desc.add_options()(
       "log-user-id",
       po::value<bool>(&Catalog_Namespace::g_log_user_id)
@@ -481,6 +616,13 @@ void CommandLineOptions::fillAdvancedOptions() {
                                po::value<int>(&system_parameters.num_executors)
                                    ->default_value(system_parameters.num_executors),
                                "Number of executors to run in parallel.");
+  developer_desc.add_options()(
+      "query-priorities",
+      po::value<std::string>(&system_parameters.query_priorities)
+          ->default_value(system_parameters.query_priorities),
+      "Comma separated list of user:priority pairs, with priority one of interactive, "
+      "normal (default) or batch. Queued queries of interactive users get a larger share "
+      "of the executors.");
   developer_desc.add_options()(
       "gpu-shared-mem-threshold",
       po::value<size_t>(&g_gpu_smem_threshold)->default_value(g_gpu_smem_threshold),
@@ -504,6 +646,13 @@ void CommandLineOptions::fillAdvancedOptions() {
                                    ->implicit_value(true),
                                "Enables/disables a more optimized columnarization method "
                                "for intermediate steps in multi-step queries.");
+  developer_desc.add_options()(
+      "enable-partitioned-reduction",
+      po::value<bool>(&g_enable_partitioned_reduction)
+          ->default_value(g_enable_partitioned_reduction)
+          ->implicit_value(true),
+      "Reduce the group by results of many kernels in a single parallel pass, each "
+      "thread owning a partition of the group keys across all the results.");
   developer_desc.add_options()(
       "offset-device-by-table-id",
       po::value<bool>(&g_use_table_device_offset)
@@ -521,6 +670,12 @@ void CommandLineOptions::fillAdvancedOptions() {
                                    ->default_value(g_enable_table_functions)
                                    ->implicit_value(true),
                                "Enable experimental table functions support.");
+  developer_desc.add_options()(
+      "table-function-partition-min-rows",
+      po::value<size_t>(&g_table_function_partition_min_rows)
+          ->default_value(g_table_function_partition_min_rows),
+      "Minimum number of input rows per partition when running a partitionable table "
+      "function concurrently over row ranges on CPU (0 disables partitioning).");
   developer_desc.add_options()(
       "jit-debug-ir",
       po::value<bool>(&jit_debug)->default_value(jit_debug)->implicit_value(true),
@@ -567,6 +722,21 @@ void CommandLineOptions::fillAdvancedOptions() {
       "there is not enough free memory to accomodate the target slab size, smaller "
       "slabs will be allocated, down to the minimum size specified by "
       "min-cpu-slab-size.");
+  developer_desc.add_options()(
+      "cpu-buffer-huge-pages",
+      po::value<bool>(&system_parameters.cpu_buffer_huge_pages)
+          ->default_value(system_parameters.cpu_buffer_huge_pages)
+          ->implicit_value(true),
+      "Map CPU buffer pool slabs on huge pages, from the hugetlbfs pool if it has enough "
+      "free pages and else as transparent huge pages.");
+  developer_desc.add_options()(
+      "cpu-buffer-numa-policy",
+      po::value<std::string>(&system_parameters.cpu_buffer_numa_policy)
+          ->default_value(system_parameters.cpu_buffer_numa_policy),
+      "Placement of CPU buffer pool slabs on NUMA nodes: 'none' leaves it to the OS, "
+      "'interleave' spreads the pages of every slab over all nodes, 'bind' places every "
+      "slab on one node, taking the nodes round robin, and runs the CPU kernels of a "
+      "query preferably on the node holding their fragments.");
   developer_desc.add_options()(
       "min-gpu-slab-size",
       po::value<size_t>(&system_parameters.min_gpu_slab_size)
@@ -733,6 +903,12 @@ void CommandLineOptions::fillAdvancedOptions() {
       po::value<size_t>(&g_parallel_top_min)->default_value(g_parallel_top_min),
       "For ResultSets requiring a heap sort, the number of rows necessary to trigger "
       "parallelTop() to sort.");
+  developer_desc.add_options()(
+      "window-function-parallel-min-rows",
+      po::value<size_t>(&g_window_function_parallel_min_rows)
+          ->default_value(g_window_function_parallel_min_rows),
+      "Minimum number of rows of a window function at which its partitions are computed "
+      "concurrently.");
   developer_desc.add_options()(
       "parallel-top-max",
       po::value<size_t>(&g_parallel_top_max)->default_value(g_parallel_top_max),
@@ -747,6 +923,27 @@ void CommandLineOptions::fillAdvancedOptions() {
                                "deleted rows in a fragment at which to perform "
                                "automatic vacuuming. A number greater than 1 can "
                                "be used to disable automatic vacuuming.");
+  developer_desc.add_options()(
+      "recluster-min-overlap",
+      po::value<float>(&g_recluster_min_overlap)
+          ->default_value(g_recluster_min_overlap),
+      "Minimum fraction of fragments with overlapping sort column ranges (with a value "
+      "of 0 implying 0% and a value of 1 implying 100%) at which background "
+      "re-clustering rewrites a table that has a sort column.");
+  developer_desc.add_options()(
+      "recluster-max-sort-fragments",
+      po::value<size_t>(&g_recluster_max_sort_fragments)
+          ->default_value(g_recluster_max_sort_fragments),
+      "Maximum number of fragments whose rows are sorted together in memory when "
+      "re-clustering. Larger sets of overlapping fragments are re-clustered in steps "
+      "that each sort the rows of at most this many fragments.");
+  developer_desc.add_options()(
+      "recluster-interval-seconds",
+      po::value<size_t>(&g_recluster_interval_seconds)
+          ->default_value(g_recluster_interval_seconds),
+      "Interval in seconds at which tables with a sort column are checked for "
+      "overlapping fragments and re-clustered. A value of 0 disables background "
+      "re-clustering.");
   developer_desc.add_options()("enable-automatic-ir-metadata",
                                po::value<bool>(&g_enable_automatic_ir_metadata)
                                    ->default_value(g_enable_automatic_ir_metadata)
@@ -955,6 +1152,17 @@ void CommandLineOptions::validate() {
     throw std::runtime_error{"vacuum-min-selectivity cannot be less than 0."};
   }
   LOG(INFO) << "Vacuum Min Selectivity: " << g_vacuum_min_selectivity;
+
+  if (g_recluster_min_overlap < 0) {
+    throw std::runtime_error{"recluster-min-overlap cannot be less than 0."};
+  }
+
+  if (g_recluster_max_sort_fragments < 2) {
+    throw std::runtime_error{"recluster-max-sort-fragments cannot be less than 2."};
+  }
+
+  // throws on invalid values
+  parse_numa_policy(system_parameters.cpu_buffer_numa_policy);
 }
 
 boost::optional<int> CommandLineOptions::parse_command_line(
@@ -1130,6 +1338,9 @@ boost::optional<int> CommandLineOptions::parse_command_line(
   LOG(INFO) << " cuda grid size  " << system_parameters.cuda_grid_size;
   LOG(INFO) << " Min CPU buffer pool slab size " << system_parameters.min_cpu_slab_size;
   LOG(INFO) << " Max CPU buffer pool slab size " << system_parameters.max_cpu_slab_size;
+  LOG(INFO) << " CPU buffer pool huge pages " << system_parameters.cpu_buffer_huge_pages;
+  LOG(INFO) << " CPU buffer pool NUMA policy "
+            << system_parameters.cpu_buffer_numa_policy;
   LOG(INFO) << " Min GPU buffer pool slab size " << system_parameters.min_gpu_slab_size;
   LOG(INFO) << " Max GPU buffer pool slab size " << system_parameters.max_gpu_slab_size;
   LOG(INFO) << " calcite JVM max memory  " << system_parameters.calcite_max_mem;
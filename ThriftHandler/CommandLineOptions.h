@@ -145,6 +145,14 @@ class CommandLineOptions {
 
 extern bool g_enable_watchdog;
 extern bool g_enable_dynamic_watchdog;
+extern bool g_enable_partitioned_reduction;
+extern bool g_enable_out_of_core_aggregation;
+extern size_t g_out_of_core_aggregation_max_groups;
+extern bool g_enable_external_sort;
+extern size_t g_external_sort_memory_budget;
+extern bool g_enable_ingest_group_commit;
+extern size_t g_ingest_group_commit_rows;
+extern size_t g_ingest_group_commit_interval_ms;
 extern unsigned g_dynamic_watchdog_time_limit;
 extern unsigned g_trivial_loop_join_threshold;
 extern bool g_from_table_reordering;
@@ -153,6 +161,8 @@ extern bool g_allow_cpu_retry;
 extern bool g_null_div_by_zero;
 extern bool g_bigint_count;
 extern bool g_inner_join_fragment_skipping;
+extern bool g_enable_geo_fragment_skipping;
+extern size_t g_min_cpu_morsel_rows;
 extern float g_filter_push_down_low_frac;
 extern float g_filter_push_down_high_frac;
 extern size_t g_filter_push_down_passing_row_ubound;
@@ -161,12 +171,22 @@ extern bool g_optimize_row_initialization;
 extern bool g_enable_overlaps_hashjoin;
 extern bool g_enable_hashjoin_many_to_many;
 extern size_t g_overlaps_max_table_size_bytes;
+extern size_t g_hash_table_cache_max_size_bytes;
+extern bool g_enable_persistent_code_cache;
+extern size_t g_persistent_code_cache_max_size_bytes;
+extern bool g_enable_result_set_cache;
+extern size_t g_result_set_cache_max_size_bytes;
+extern bool g_enable_calcite_plan_cache;
+extern size_t g_calcite_plan_cache_max_entries;
+extern bool g_enable_page_compression;
 extern double g_overlaps_target_entries_per_bin;
+extern bool g_enable_overlaps_polygon_edge_index;
 extern bool g_strip_join_covered_quals;
 extern size_t g_constrained_by_in_threshold;
 extern size_t g_big_group_threshold;
 extern bool g_enable_window_functions;
 extern bool g_enable_table_functions;
+extern size_t g_table_function_partition_min_rows;
 extern size_t g_max_memory_allocation_size;
 extern double g_bump_allocator_step_reduction;
 extern bool g_enable_direct_columnarization;
@@ -199,6 +219,9 @@ extern size_t g_max_import_threads;
 extern bool g_enable_auto_metadata_update;
 extern bool g_allow_s3_server_privileges;
 extern float g_vacuum_min_selectivity;
+extern float g_recluster_min_overlap;
+extern size_t g_recluster_max_sort_fragments;
+extern size_t g_recluster_interval_seconds;
 extern bool g_read_only;
 extern bool g_enable_automatic_ir_metadata;
 extern size_t g_enable_parallel_linearization;
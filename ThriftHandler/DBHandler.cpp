@@ -33,6 +33,7 @@
 #include "MapDRelease.h"
 
 #include "Calcite/Calcite.h"
+#include "Calcite/CalcitePlanCache.h"
 #include "gen-cpp/CalciteServer.h"
 
 #include "QueryEngine/RelAlgExecutor.h"
@@ -60,6 +61,7 @@
 #include "QueryEngine/GpuMemUtils.h"
 #include "QueryEngine/JoinFilterPushDown.h"
 #include "QueryEngine/JsonAccessors.h"
+#include "QueryEngine/PersistentCodeCache.h"
 #include "QueryEngine/QueryDispatchQueue.h"
 #include "QueryEngine/ResultSetBuilder.h"
 #include "QueryEngine/TableFunctions/TableFunctionsFactory.h"
@@ -71,6 +73,7 @@
 #include "Shared/mapd_shared_mutex.h"
 #include "Shared/measure.h"
 #include "Shared/scope.h"
+#include "StringDictionary/StringDictionary.h"
 
 #ifdef HAVE_AWS_S3
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
@@ -90,10 +93,13 @@
 #include <csignal>
 #include <fstream>
 #include <future>
+#include <iomanip>
+#include <limits>
 #include <map>
 #include <memory>
 #include <random>
 #include <regex>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <typeinfo>
@@ -141,8 +147,87 @@ struct ForceDisconnect : public std::runtime_error {
   ForceDisconnect(const std::string& cause) : std::runtime_error(cause) {}
 };
 
+std::string to_sql_literal(const TBindParameter& parameter) {
+  const auto& datum = parameter.value;
+  if (datum.is_null) {
+    return "NULL";
+  }
+  switch (parameter.type) {
+    case TDatumType::BOOL:
+      return datum.val.int_val ? "TRUE" : "FALSE";
+    case TDatumType::TINYINT:
+    case TDatumType::SMALLINT:
+    case TDatumType::INT:
+    case TDatumType::BIGINT:
+      // parenthesized, so that a preceding minus doesn't start a comment
+      return datum.val.int_val < 0 ? "(" + std::to_string(datum.val.int_val) + ")"
+                                   : std::to_string(datum.val.int_val);
+    case TDatumType::FLOAT:
+    case TDatumType::DOUBLE: {
+      if (!std::isfinite(datum.val.real_val)) {
+        throw std::runtime_error("Cannot bind a non-finite floating point value.");
+      }
+      // an approximate numeric literal, which Calcite types as DOUBLE
+      std::ostringstream oss;
+      oss << std::scientific
+          << std::setprecision(std::numeric_limits<double>::max_digits10 - 1)
+          << datum.val.real_val;
+      return datum.val.real_val < 0 ? "(" + oss.str() + ")" : oss.str();
+    }
+    case TDatumType::DECIMAL: {
+      static const std::regex decimal_regex{R"(-?(\d+(\.\d*)?|\.\d+))"};
+      if (!std::regex_match(datum.val.str_val, decimal_regex)) {
+        throw std::runtime_error("Invalid DECIMAL parameter value: " +
+                                 datum.val.str_val);
+      }
+      return datum.val.str_val[0] == '-' ? "(" + datum.val.str_val + ")"
+                                         : datum.val.str_val;
+    }
+    case TDatumType::STR:
+    case TDatumType::TIME:
+    case TDatumType::TIMESTAMP:
+    case TDatumType::DATE:
+      return "'" + boost::replace_all_copy(datum.val.str_val, "'", "''") + "'";
+    default:
+      throw std::runtime_error("Unsupported prepared statement parameter type " +
+                               std::to_string(parameter.type) + ".");
+  }
+}
+
 }  // namespace
 
+// SQL statement with '?' bind markers, see prepare_statement.
+struct PreparedStatement {
+  TSessionId session_id;
+  std::string query;
+  std::vector<size_t> bind_markers;
+
+  std::string bind(const std::vector<TBindParameter>& parameters) const {
+    if (parameters.size() != bind_markers.size()) {
+      throw std::runtime_error("Prepared statement takes " +
+                               std::to_string(bind_markers.size()) +
+                               " parameters, got " + std::to_string(parameters.size()) +
+                               ".");
+    }
+    std::string bound_query;
+    size_t offset = 0;
+    for (size_t i = 0; i < bind_markers.size(); ++i) {
+      bound_query += query.substr(offset, bind_markers[i] - offset);
+      bound_query += to_sql_literal(parameters[i]);
+      offset = bind_markers[i] + 1;
+    }
+    bound_query += query.substr(offset);
+    return bound_query;
+  }
+};
+
+// Result of sql_execute_df_cursor, converted to Arrow one batch per fetch_df_batch.
+struct DataFrameCursor {
+  TSessionId session_id;
+  std::mutex mutex;
+  std::unique_ptr<ArrowResultSetBatchIterator> batches;
+};
+
 template <>
 SessionMap::iterator DBHandler::get_session_it_unsafe(
     const TSessionId& session,
@@ -290,6 +375,23 @@ DBHandler::DBHandler(const std::vector<LeafHostInfo>& db_leaves,
 
 {
   LOG(INFO) << "OmniSci Server " << MAPD_RELEASE;
+  std::vector<std::string> query_priorities;
+  boost::split(query_priorities,
+               system_parameters.query_priorities,
+               boost::is_any_of(","),
+               boost::token_compress_on);
+  for (const auto& user_priority : query_priorities) {
+    if (user_priority.empty()) {
+      continue;
+    }
+    const auto separator_pos = user_priority.rfind(':');
+    if (separator_pos == std::string::npos) {
+      throw std::runtime_error("Invalid query priority " + user_priority +
+                               ", expected user:priority.");
+    }
+    query_priorities_[user_priority.substr(0, separator_pos)] =
+        QueryDispatchQueue::parsePriority(user_priority.substr(separator_pos + 1));
+  }
   initialize(is_new_db);
 }
 
@@ -714,6 +816,28 @@ void DBHandler::disconnect_impl(const SessionMap::iterator& session_it,
     render_group_assignment_map_.erase(session_id);
   }
 
+  {
+    std::lock_guard<std::mutex> lock(df_cursors_mutex_);
+    for (auto it = df_cursors_.begin(); it != df_cursors_.end();) {
+      if (it->second->session_id == session_id) {
+        it = df_cursors_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(prepared_statements_mutex_);
+    for (auto it = prepared_statements_.begin(); it != prepared_statements_.end();) {
+      if (it->second->session_id == session_id) {
+        it = prepared_statements_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
   sessions_.erase(session_it);
   write_lock.unlock();
 
@@ -860,6 +984,17 @@ void DBHandler::get_status(std::vector<TServerStatus>& _return,
   ret.role = getServerRole();
   ret.renderer_status_json =
       render_handler_ ? render_handler_->get_renderer_status_json() : "";
+  CHECK(dispatch_queue_);
+  const auto dispatch_queue_stats = dispatch_queue_->getStats();
+  ret.dispatch_queue_status.queue_depth = dispatch_queue_stats.queue_depth;
+  ret.dispatch_queue_status.max_queue_depth = dispatch_queue_stats.max_queue_depth;
+  ret.dispatch_queue_status.num_dispatched = dispatch_queue_stats.num_dispatched;
+  ret.dispatch_queue_status.wait_time_ms_bucket_bounds.assign(
+      QueryDispatchQueue::kWaitTimeBucketsMs.begin(),
+      QueryDispatchQueue::kWaitTimeBucketsMs.end());
+  ret.dispatch_queue_status.wait_time_ms_histogram.assign(
+      dispatch_queue_stats.wait_time_ms_histogram.begin(),
+      dispatch_queue_stats.wait_time_ms_histogram.end());
 
   _return.push_back(ret);
   if (leaf_aggregator_.leafCount() > 0) {
@@ -1362,6 +1497,63 @@ void DBHandler::sql_execute(ExecutionResult& _return,
   }
 }
 
+void DBHandler::prepare_statement(TPreparedStatement& _return,
+                                  const TSessionId& session,
+                                  const std::string& query_str) {
+  auto stdlog = STDLOG(get_session_ptr(session));
+  auto statement = std::make_shared<PreparedStatement>();
+  statement->session_id = session;
+  statement->query = query_str;
+  statement->bind_markers = parameterize_sql(query_str).bind_markers;
+  {
+    std::lock_guard<std::mutex> lock(prepared_statements_mutex_);
+    _return.statement_id = std::to_string(next_prepared_statement_id_++);
+    prepared_statements_.emplace(_return.statement_id, statement);
+  }
+  _return.num_parameters = statement->bind_markers.size();
+  stdlog.appendNameValuePairs("statement_id", _return.statement_id);
+}
+
+std::shared_ptr<const PreparedStatement> DBHandler::get_prepared_statement(
+    const TSessionId& session,
+    const std::string& statement_id) {
+  std::lock_guard<std::mutex> lock(prepared_statements_mutex_);
+  auto it = prepared_statements_.find(statement_id);
+  if (it == prepared_statements_.end() || it->second->session_id != session) {
+    THROW_MAPD_EXCEPTION("Prepared statement " + statement_id + " does not exist.");
+  }
+  return it->second;
+}
+
+void DBHandler::sql_execute_prepared(TQueryResult& _return,
+                                     const TSessionId& session,
+                                     const std::string& statement_id,
+                                     const std::vector<TBindParameter>& parameters,
+                                     const bool column_format,
+                                     const std::string& nonce,
+                                     const int32_t first_n,
+                                     const int32_t at_most_n) {
+  const auto statement = get_prepared_statement(session, statement_id);
+  std::string query_str;
+  try {
+    query_str = statement->bind(parameters);
+  } catch (const std::exception& e) {
+    THROW_MAPD_EXCEPTION(std::string("Exception: ") + e.what());
+  }
+  // The bound statement differs from earlier executions only in its literals, so with
+  // the Calcite plan cache enabled it is planned without a Calcite round trip.
+  sql_execute(_return, session, query_str, column_format, nonce, first_n, at_most_n);
+}
+
+void DBHandler::close_prepared_statement(const TSessionId& session,
+                                         const std::string& statement_id) {
+  auto stdlog = STDLOG(get_session_ptr(session));
+  stdlog.appendNameValuePairs("statement_id", statement_id);
+  get_prepared_statement(session, statement_id);
+  std::lock_guard<std::mutex> lock(prepared_statements_mutex_);
+  prepared_statements_.erase(statement_id);
+}
+
 int64_t DBHandler::process_geo_copy_from(const TSessionId& session_id) {
   int64_t total_time_ms(0);
   // if the SQL statement we just executed was a geo COPY FROM, the import
@@ -1404,7 +1596,26 @@ void DBHandler::sql_execute_df(TDataFrame& _return,
   auto session_ptr = get_session_ptr(session);
   auto query_state = create_query_state(session_ptr, query_str);
   auto stdlog = STDLOG(session_ptr, query_state);
-
+  sql_execute_df_impl(_return,
+                      session_ptr,
+                      query_state,
+                      query_str,
+                      device_type,
+                      device_id,
+                      first_n,
+                      transport_method);
+}
+
+void DBHandler::sql_execute_df_impl(
+    TDataFrame& _return,
+    std::shared_ptr<Catalog_Namespace::SessionInfo> session_ptr,
+    std::shared_ptr<query_state::QueryState> query_state,
+    const std::string& query_str,
+    const TDeviceType::type device_type,
+    const int32_t device_id,
+    const int32_t first_n,
+    const TArrowTransport::type transport_method,
+    std::unique_ptr<ArrowResultSetConverter>* deferred_converter) {
   if (device_type == TDeviceType::GPU) {
     const auto executor_device_type = session_ptr->get_executor_device_type();
     if (executor_device_type != ExecutorDeviceType::GPU) {
@@ -1457,7 +1668,8 @@ void DBHandler::sql_execute_df(TDataFrame& _return,
                                                          : ExecutorDeviceType::GPU,
                          static_cast<size_t>(device_id),
                          first_n,
-                         transport_method);
+                         transport_method,
+                         deferred_converter);
       return;
     }
   } catch (std::exception& e) {
@@ -1482,6 +1694,88 @@ void DBHandler::sql_execute_gdf(TDataFrame& _return,
                  TArrowTransport::SHARED_MEMORY);
 }
 
+void DBHandler::sql_execute_df_cursor(TDataFrameCursor& _return,
+                                      const TSessionId& session,
+                                      const std::string& query_str,
+                                      const int32_t first_n,
+                                      const int64_t max_batch_rows,
+                                      const TArrowTransport::type transport_method) {
+  auto session_ptr = get_session_ptr(session);
+  auto query_state = create_query_state(session_ptr, query_str);
+  auto stdlog = STDLOG(session_ptr, query_state);
+
+  std::unique_ptr<ArrowResultSetConverter> converter;
+  TDataFrame df;
+  sql_execute_df_impl(df,
+                      session_ptr,
+                      query_state,
+                      query_str,
+                      TDeviceType::CPU,
+                      0,
+                      first_n,
+                      transport_method,
+                      &converter);
+  CHECK(converter);
+  auto cursor = std::make_shared<DataFrameCursor>();
+  cursor->session_id = session;
+  try {
+    cursor->batches = std::make_unique<ArrowResultSetBatchIterator>(std::move(converter),
+                                                                    max_batch_rows);
+    _return.schema = cursor->batches->getSerializedSchema()->ToString();
+  } catch (std::exception& e) {
+    THROW_MAPD_EXCEPTION(std::string("Exception: ") + e.what());
+  }
+  _return.execution_time_ms = df.execution_time_ms;
+  {
+    std::lock_guard<std::mutex> lock(df_cursors_mutex_);
+    _return.cursor_id = std::to_string(next_df_cursor_id_++);
+    df_cursors_.emplace(_return.cursor_id, cursor);
+  }
+  stdlog.appendNameValuePairs("cursor_id", _return.cursor_id);
+}
+
+std::shared_ptr<DataFrameCursor> DBHandler::get_df_cursor(const TSessionId& session,
+                                                          const std::string& cursor_id) {
+  std::lock_guard<std::mutex> lock(df_cursors_mutex_);
+  auto it = df_cursors_.find(cursor_id);
+  if (it == df_cursors_.end() || it->second->session_id != session) {
+    THROW_MAPD_EXCEPTION("Data frame cursor " + cursor_id + " does not exist.");
+  }
+  return it->second;
+}
+
+void DBHandler::fetch_df_batch(TDataFrame& _return,
+                               const TSessionId& session,
+                               const std::string& cursor_id) {
+  auto stdlog = STDLOG(get_session_ptr(session));
+  stdlog.appendNameValuePairs("cursor_id", cursor_id);
+  auto cursor = get_df_cursor(session, cursor_id);
+  std::lock_guard<std::mutex> lock(cursor->mutex);
+  ArrowResult arrow_result;
+  try {
+    _return.arrow_conversion_time_ms += measure<>::execution(
+        [&] { arrow_result = cursor->batches->getNextArrowResult(); });
+  } catch (std::exception& e) {
+    THROW_MAPD_EXCEPTION(std::string("Exception: ") + e.what());
+  }
+  _return.sm_handle =
+      std::string(arrow_result.sm_handle.begin(), arrow_result.sm_handle.end());
+  _return.sm_size = arrow_result.sm_size;
+  _return.df_handle =
+      std::string(arrow_result.df_handle.begin(), arrow_result.df_handle.end());
+  _return.df_buffer =
+      std::string(arrow_result.df_buffer.begin(), arrow_result.df_buffer.end());
+  _return.df_size = arrow_result.df_size;
+}
+
+void DBHandler::close_df_cursor(const TSessionId& session, const std::string& cursor_id) {
+  auto stdlog = STDLOG(get_session_ptr(session));
+  stdlog.appendNameValuePairs("cursor_id", cursor_id);
+  get_df_cursor(session, cursor_id);
+  std::lock_guard<std::mutex> lock(df_cursors_mutex_);
+  df_cursors_.erase(cursor_id);
+}
+
 // For now we have only one user of a data frame in all cases.
 void DBHandler::deallocate_df(const TSessionId& session,
                               const TDataFrame& df,
@@ -1774,14 +2068,29 @@ TQueryResult DBHandler::validate_rel_alg(const std::string& query_ra,
                         ExplainInfo::defaults(),
                         executor_index);
       });
-  CHECK(dispatch_queue_);
-  dispatch_queue_->submit(execute_rel_alg_task, /*is_update_delete=*/false);
+  submitToDispatchQueue(execute_rel_alg_task,
+                        *query_state_proxy.getQueryState().getConstSessionInfo(),
+                        /*is_update_delete=*/false);
   auto result_future = execute_rel_alg_task->get_future();
   result_future.get();
   DBHandler::convertData(_return, result, query_state_proxy, query_ra, true, -1, -1);
   return _return;
 }
 
+void DBHandler::submitToDispatchQueue(std::shared_ptr<QueryDispatchQueue::Task> task,
+                                      const Catalog_Namespace::SessionInfo& session_info,
+                                      const bool is_update_delete) {
+  CHECK(dispatch_queue_);
+  const auto& user_name = session_info.get_currentUser().userName;
+  const auto priority_it = query_priorities_.find(user_name);
+  dispatch_queue_->submit(task,
+                          is_update_delete,
+                          user_name,
+                          priority_it == query_priorities_.end()
+                              ? QueryDispatchQueue::Priority::kNormal
+                              : priority_it->second);
+}
+
 void DBHandler::get_roles(std::vector<std::string>& roles, const TSessionId& session) {
   auto stdlog = STDLOG(get_session_ptr(session));
   auto session_ptr = stdlog.getConstSessionInfo();
@@ -2738,6 +3047,36 @@ void DBHandler::get_memory(std::vector<TNodeMemoryInfo>& _return,
       md.is_free = gpu.memStatus == Buffer_Namespace::MemStatus::FREE;
       nodeInfo.node_memory_data.push_back(md);
     }
+    const auto& buffer_mgr_stats = memInfo.bufferMgrStats;
+    nodeInfo.buffer_pool_stats.hits = buffer_mgr_stats.hits;
+    nodeInfo.buffer_pool_stats.misses = buffer_mgr_stats.misses;
+    nodeInfo.buffer_pool_stats.evictions = buffer_mgr_stats.evictions;
+    nodeInfo.buffer_pool_stats.chunk_index_lock_acquisitions =
+        buffer_mgr_stats.chunk_index_lock_acquisitions;
+    nodeInfo.buffer_pool_stats.chunk_index_lock_waits =
+        buffer_mgr_stats.chunk_index_lock_waits;
+    if (mem_level == Data_Namespace::MemoryLevel::CPU_LEVEL) {
+      // join hash table caches only hold hash tables built on CPU
+      for (const auto& [cache_name, stats] : HashJoin::getHashTableCacheStats()) {
+        THashTableCacheInfo cache_info;
+        cache_info.cache_name = cache_name;
+        cache_info.num_entries = stats.num_entries;
+        cache_info.size_bytes = stats.size_bytes;
+        cache_info.max_size_bytes = stats.max_size_bytes;
+        cache_info.hits = stats.hits;
+        cache_info.misses = stats.misses;
+        cache_info.evictions = stats.evictions;
+        nodeInfo.hash_table_caches.push_back(cache_info);
+      }
+      const auto dict_cache_stats = StringDictionary::getCacheStats();
+      auto& dict_cache = nodeInfo.string_dictionary_cache;
+      dict_cache.num_entries = dict_cache_stats.num_entries;
+      dict_cache.size_bytes = dict_cache_stats.size_bytes;
+      dict_cache.max_size_bytes = dict_cache_stats.max_size_bytes;
+      dict_cache.hits = dict_cache_stats.hits;
+      dict_cache.misses = dict_cache_stats.misses;
+      dict_cache.evictions = dict_cache_stats.evictions;
+    }
     _return.push_back(nodeInfo);
   }
   if (leaf_aggregator_.leafCount() > 0) {
@@ -2904,9 +3243,11 @@ void DBHandler::load_table_binary(const TSessionId& session,
                    << " data :" << row;
       }
     }
-    auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
-        session_ptr->getCatalog(), table_name);
-    if (!loader->load(import_buffers, rows.size(), session_ptr.get())) {
+    if (!load_rows(std::move(schema_read_lock),
+                   *loader,
+                   import_buffers,
+                   rows.size(),
+                   *session_ptr)) {
       THROW_MAPD_EXCEPTION(loader->getErrorMessage());
     }
   } catch (const std::exception& e) {
@@ -2914,6 +3255,46 @@ void DBHandler::load_table_binary(const TSessionId& session,
   }
 }
 
+bool DBHandler::load_rows(
+    std::unique_ptr<lockmgr::AbstractLockContainer<const TableDescriptor*>>
+        schema_read_lock,
+    import_export::Loader& loader,
+    const std::vector<std::unique_ptr<import_export::TypedImportBuffer>>& buffers,
+    const size_t row_count,
+    const Catalog_Namespace::SessionInfo& session_info) {
+  auto& group_commit_mgr = import_export::GroupCommitMgr::instance();
+  std::shared_future<void> committed;
+  {
+    // queued before waiting for the lock, so that the loads ahead leave it the commit
+    std::unique_ptr<import_export::GroupCommitMgr::QueuedLoad> queued_load;
+    if (g_enable_ingest_group_commit) {
+      queued_load = group_commit_mgr.queueLoad(session_info.getCatalog(),
+                                               loader.getTableDesc()->tableId);
+    }
+    const auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
+        session_info.getCatalog(), loader.getTableDesc()->tableName);
+    if (!queued_load) {
+      group_commit_mgr.commitPendingRows(session_info.getCatalog(),
+                                         loader.getTableDesc()->tableId);
+      return loader.load(buffers, row_count, &session_info);
+    }
+    if (!group_commit_mgr.load(
+            loader, buffers, row_count, &session_info, *queued_load, committed)) {
+      return false;
+    }
+  }
+  if (committed.valid()) {
+    // only acknowledge the rows once committed, without blocking the other loads
+    schema_read_lock.reset();
+    try {
+      committed.get();
+    } catch (const std::exception& e) {
+      THROW_MAPD_EXCEPTION(e.what());
+    }
+  }
+  return true;
+}
+
 std::unique_ptr<lockmgr::AbstractLockContainer<const TableDescriptor*>>
 DBHandler::prepare_loader_generic(
     const Catalog_Namespace::SessionInfo& session_info,
@@ -3190,9 +3571,8 @@ void DBHandler::load_table_binary_columnar_internal(
         << ". Issue at column : " << (col_idx + 1) << ". Import aborted";
     THROW_MAPD_EXCEPTION(oss.str());
   }
-  auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
-      session_ptr->getCatalog(), table_name);
-  if (!loader->load(import_buffers, num_rows, session_ptr.get())) {
+  if (!load_rows(
+          std::move(schema_read_lock), *loader, import_buffers, num_rows, *session_ptr)) {
     THROW_MAPD_EXCEPTION(loader->getErrorMessage());
   }
 }
@@ -3307,9 +3687,8 @@ void DBHandler::load_table_binary_arrow(const TSessionId& session,
     // other import paths
     THROW_MAPD_EXCEPTION(std::string("Exception: ") + e.what());
   }
-  auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
-      session_ptr->getCatalog(), table_name);
-  if (!loader->load(import_buffers, num_rows, session_ptr.get())) {
+  if (!load_rows(
+          std::move(schema_read_lock), *loader, import_buffers, num_rows, *session_ptr)) {
     THROW_MAPD_EXCEPTION(loader->getErrorMessage());
   }
 }
@@ -3409,9 +3788,11 @@ void DBHandler::load_table(const TSessionId& session,
         THROW_MAPD_EXCEPTION(std::string("Exception: ") + e.what());
       }
     }
-    auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
-        session_ptr->getCatalog(), table_name);
-    if (!loader->load(import_buffers, rows_completed, session_ptr.get())) {
+    if (!load_rows(std::move(schema_read_lock),
+                   *loader,
+                   import_buffers,
+                   rows_completed,
+                   *session_ptr)) {
       THROW_MAPD_EXCEPTION(loader->getErrorMessage());
     }
 
@@ -4682,6 +5063,8 @@ void DBHandler::import_table(const TSessionId& session,
 
     const auto insert_data_lock = lockmgr::InsertDataLockMgr::getWriteLockForTable(
         session_ptr->getCatalog(), table_name);
+    // so that a failed import only rolls back its own rows
+    import_export::GroupCommitMgr::instance().commitPendingRows(cat, td->tableId);
     std::unique_ptr<import_export::Importer> importer;
     if (leaf_aggregator_.leafCount() > 0) {
       importer.reset(new import_export::Importer(
@@ -5617,14 +6000,16 @@ std::vector<PushedDownFilterInfo> DBHandler::execute_rel_alg(
   return {};
 }
 
-void DBHandler::execute_rel_alg_df(TDataFrame& _return,
-                                   const std::string& query_ra,
-                                   QueryStateProxy query_state_proxy,
-                                   const Catalog_Namespace::SessionInfo& session_info,
-                                   const ExecutorDeviceType device_type,
-                                   const size_t device_id,
-                                   const int32_t first_n,
-                                   const TArrowTransport::type transport_method) const {
+void DBHandler::execute_rel_alg_df(
+    TDataFrame& _return,
+    const std::string& query_ra,
+    QueryStateProxy query_state_proxy,
+    const Catalog_Namespace::SessionInfo& session_info,
+    const ExecutorDeviceType device_type,
+    const size_t device_id,
+    const int32_t first_n,
+    const TArrowTransport::type transport_method,
+    std::unique_ptr<ArrowResultSetConverter>* deferred_converter) const {
   const auto& cat = session_info.getCatalog();
   CHECK(device_type == ExecutorDeviceType::CPU ||
         session_info.get_executor_device_type() == ExecutorDeviceType::GPU);
@@ -5642,7 +6027,7 @@ void DBHandler::execute_rel_alg_df(TDataFrame& _return,
                            /*hoist_literals=*/true,
                            ExecutorOptLevel::Default,
                            g_enable_dynamic_watchdog,
-                           /*allow_lazy_fetch=*/true,
+                           /*allow_lazy_fetch=*/!deferred_converter,
                            /*filter_on_deleted_column=*/true,
                            ExecutorExplainType::Default,
                            intel_jit_profile_};
@@ -5677,7 +6062,7 @@ void DBHandler::execute_rel_alg_df(TDataFrame& _return,
       [&]() { result = ra_executor.executeRelAlgQuery(co, eo, false, nullptr); });
   _return.execution_time_ms -= result.getRows()->getQueueTime();
   const auto rs = result.getRows();
-  const auto converter =
+  auto converter =
       std::make_unique<ArrowResultSetConverter>(rs,
                                                 data_mgr_,
                                                 device_type,
@@ -5685,6 +6070,13 @@ void DBHandler::execute_rel_alg_df(TDataFrame& _return,
                                                 getTargetNames(result.getTargetsMeta()),
                                                 first_n,
                                                 ArrowTransport(transport_method));
+  if (deferred_converter) {
+    // The result gets converted after the table locks are released, which is why lazy
+    // fetch is disabled above.
+    CHECK(device_type == ExecutorDeviceType::CPU);
+    *deferred_converter = std::move(converter);
+    return;
+  }
   ArrowResult arrow_result;
   _return.arrow_conversion_time_ms +=
       measure<>::execution([&] { arrow_result = converter->getArrowResult(); });
@@ -6078,9 +6470,10 @@ void DBHandler::sql_execute_impl(ExecutionResult& _return,
                                    Executor::UNITARY_EXECUTOR_ID,
                                    QuerySessionStatus::QueryStatus::PENDING_QUEUE);
     }
-    dispatch_queue_->submit(execute_rel_alg_task,
-                            pw.getDMLType() == ParserWrapper::DMLType::Update ||
-                                pw.getDMLType() == ParserWrapper::DMLType::Delete);
+    submitToDispatchQueue(execute_rel_alg_task,
+                          *session_ptr,
+                          pw.getDMLType() == ParserWrapper::DMLType::Update ||
+                              pw.getDMLType() == ParserWrapper::DMLType::Delete);
     auto result_future = execute_rel_alg_task->get_future();
     result_future.get();
     return;
@@ -6114,6 +6507,9 @@ void DBHandler::sql_execute_impl(ExecutionResult& _return,
         if (optimize_stmt->shouldVacuumDeletedRows()) {
           optimizer.vacuumDeletedRows();
         }
+        if (optimize_stmt->shouldReclusterSortedRows()) {
+          optimizer.reclusterSortedRows();
+        }
         optimizer.recomputeMetadata();
       }));
       return;
@@ -6407,6 +6803,9 @@ std::pair<TPlanResult, lockmgr::LockedTableDescriptors> DBHandler::parse_to_ra(
               std::make_unique<lockmgr::TableInsertLockContainer<lockmgr::WriteLock>>(
                   lockmgr::TableInsertLockContainer<lockmgr::WriteLock>::acquire(
                       cat->getDatabaseId(), (*locks.back())())));
+          // so that a failed update or delete only rolls back its own changes
+          import_export::GroupCommitMgr::instance().commitPendingRows(
+              *cat, (*locks.back())()->tableId);
         } else {
           locks.emplace_back(
               std::make_unique<lockmgr::TableDataLockContainer<lockmgr::ReadLock>>(
@@ -6835,6 +7234,8 @@ void DBHandler::get_license_claims(TLicenseInfo& _return,
 void DBHandler::shutdown() {
   emergency_shutdown();
 
+  import_export::GroupCommitMgr::instance().commitAll();
+
   if (render_handler_) {
     render_handler_->shutdown();
   }
@@ -6895,6 +7296,10 @@ void DBHandler::register_runtime_extension_functions(
      of loosing all of the caches. TODO: implement more refined code
      cache cleaning. */
   Executor::nukeCacheOfExecutors();
+  // the on-disk object code was linked against the replaced runtime UDFs
+  if (auto persistent_code_cache = PersistentCodeCache::get()) {
+    persistent_code_cache->clear();
+  }
 
   /* Parse LLVM/NVVM IR strings and store it as LLVM module. */
   auto it = device_ir_map.find(std::string{"cpu"});
@@ -33,6 +33,7 @@
 #include "Catalog/Catalog.h"
 #include "Fragmenter/InsertOrderFragmenter.h"
 #include "Geospatial/Transforms.h"
+#include "ImportExport/GroupCommitMgr.h"
 #include "ImportExport/Importer.h"
 #include "ImportExport/RenderGroupAnalyzer.h"
 #include "LockMgr/LockMgr.h"
@@ -156,6 +157,10 @@ namespace File_Namespace {
 struct DiskCacheConfig;
 }
 
+class ArrowResultSetConverter;
+struct DataFrameCursor;
+struct PreparedStatement;
+
 class DBHandler : public OmniSciIf {
  public:
   DBHandler(const std::vector<LeafHostInfo>& db_leaves,
@@ -300,6 +305,21 @@ class DBHandler : public OmniSciIf {
                    const std::string& nonce,
                    const int32_t first_n,
                    const int32_t at_most_n) override;
+  // Prepared statements take the values of their '?' bind markers as parameters. They
+  // are closed with close_prepared_statement or on disconnect.
+  void prepare_statement(TPreparedStatement& _return,
+                         const TSessionId& session,
+                         const std::string& query) override;
+  void sql_execute_prepared(TQueryResult& _return,
+                            const TSessionId& session,
+                            const std::string& statement_id,
+                            const std::vector<TBindParameter>& parameters,
+                            const bool column_format,
+                            const std::string& nonce,
+                            const int32_t first_n,
+                            const int32_t at_most_n) override;
+  void close_prepared_statement(const TSessionId& session,
+                                const std::string& statement_id) override;
   void get_completion_hints(std::vector<TCompletionHint>& hints,
                             const TSessionId& session,
                             const std::string& sql,
@@ -321,6 +341,19 @@ class DBHandler : public OmniSciIf {
                      const TDataFrame& df,
                      const TDeviceType::type device_type,
                      const int32_t device_id) override;
+  // Streams the result of a query as Arrow record batches of bounded size. The cursor
+  // carries the serialized schema, each fetch_df_batch returns the next batch until
+  // one with df_size 0 signals the end.
+  void sql_execute_df_cursor(TDataFrameCursor& _return,
+                             const TSessionId& session,
+                             const std::string& query,
+                             const int32_t first_n,
+                             const int64_t max_batch_rows,
+                             const TArrowTransport::type transport_method) override;
+  void fetch_df_batch(TDataFrame& _return,
+                      const TSessionId& session,
+                      const std::string& cursor_id) override;
+  void close_df_cursor(const TSessionId& session, const std::string& cursor_id) override;
   void interrupt(const TSessionId& query_session,
                  const TSessionId& interrupt_session) override;
   void sql_validate(TRowDescriptor& _return,
@@ -414,6 +447,17 @@ class DBHandler : public OmniSciIf {
                          const std::vector<TRow>& rows,
                          const std::vector<std::string>& column_names) override;
 
+  // Loads rows into the table of the loader, whose schema the caller has locked, through
+  // the group commit manager if enabled. Releases the lock before waiting for the rows to
+  // be committed.
+  bool load_rows(
+      std::unique_ptr<lockmgr::AbstractLockContainer<const TableDescriptor*>>
+          schema_read_lock,
+      import_export::Loader& loader,
+      const std::vector<std::unique_ptr<import_export::TypedImportBuffer>>& buffers,
+      const size_t row_count,
+      const Catalog_Namespace::SessionInfo& session_info);
+
   std::unique_ptr<lockmgr::AbstractLockContainer<const TableDescriptor*>>
   prepare_columnar_loader(
       const Catalog_Namespace::SessionInfo& session_info,
@@ -602,6 +646,11 @@ class DBHandler : public OmniSciIf {
   const bool legacy_syntax_;
 
   std::unique_ptr<QueryDispatchQueue> dispatch_queue_;
+  std::map<std::string, QueryDispatchQueue::Priority> query_priorities_;
+
+  void submitToDispatchQueue(std::shared_ptr<QueryDispatchQueue::Task> task,
+                             const Catalog_Namespace::SessionInfo& session_info,
+                             const bool is_update_delete);
 
   template <typename... ARGS>
   std::shared_ptr<query_state::QueryState> create_query_state(ARGS&&... args) {
@@ -756,14 +805,34 @@ class DBHandler : public OmniSciIf {
       const bool just_calcite_explain,
       const std::vector<PushedDownFilterInfo>& filter_push_down_requests);
 
-  void execute_rel_alg_df(TDataFrame& _return,
-                          const std::string& query_ra,
-                          QueryStateProxy query_state_proxy,
-                          const Catalog_Namespace::SessionInfo& session_info,
-                          const ExecutorDeviceType device_type,
-                          const size_t device_id,
-                          const int32_t first_n,
-                          const TArrowTransport::type transport_method) const;
+  void sql_execute_df_impl(
+      TDataFrame& _return,
+      std::shared_ptr<Catalog_Namespace::SessionInfo> session_ptr,
+      std::shared_ptr<query_state::QueryState> query_state,
+      const std::string& query_str,
+      const TDeviceType::type device_type,
+      const int32_t device_id,
+      const int32_t first_n,
+      const TArrowTransport::type transport_method,
+      std::unique_ptr<ArrowResultSetConverter>* deferred_converter = nullptr);
+
+  void execute_rel_alg_df(
+      TDataFrame& _return,
+      const std::string& query_ra,
+      QueryStateProxy query_state_proxy,
+      const Catalog_Namespace::SessionInfo& session_info,
+      const ExecutorDeviceType device_type,
+      const size_t device_id,
+      const int32_t first_n,
+      const TArrowTransport::type transport_method,
+      std::unique_ptr<ArrowResultSetConverter>* deferred_converter = nullptr) const;
+
+  std::shared_ptr<DataFrameCursor> get_df_cursor(const TSessionId& session,
+                                                 const std::string& cursor_id);
+
+  std::shared_ptr<const PreparedStatement> get_prepared_statement(
+      const TSessionId& session,
+      const std::string& statement_id);
 
   void executeDdl(TQueryResult& _return,
                   const std::string& query_ra,
@@ -946,6 +1015,17 @@ class DBHandler : public OmniSciIf {
   mutable std::mutex handle_to_dev_ptr_mutex_;
   mutable std::unordered_map<std::string, std::string> ipc_handle_to_dev_ptr_;
 
+  // Open data frame cursors, keyed by cursor id
+  std::mutex df_cursors_mutex_;
+  std::unordered_map<std::string, std::shared_ptr<DataFrameCursor>> df_cursors_;
+  uint64_t next_df_cursor_id_{0};
+
+  // Prepared statements, keyed by statement id
+  std::mutex prepared_statements_mutex_;
+  std::unordered_map<std::string, std::shared_ptr<PreparedStatement>>
+      prepared_statements_;
+  uint64_t next_prepared_statement_id_{0};
+
   friend void run_warmup_queries(std::shared_ptr<DBHandler> handler,
                                  std::string base_path,
                                  std::string query_file_path);
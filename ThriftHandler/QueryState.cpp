@@ -195,6 +195,7 @@ logger::Severity StdLog::stdlogBeginSeverity(char const* func) {
       {"sql_execute", logger::Severity::INFO},
       {"sql_execute_df", logger::Severity::INFO},
       {"sql_execute_gdf", logger::Severity::INFO},
+      {"sql_execute_df_cursor", logger::Severity::INFO},
       {"sql_validate", logger::Severity::INFO},
       {"render_vega", logger::Severity::INFO},
       {"get_result_row_for_pixel", logger::Severity::INFO},
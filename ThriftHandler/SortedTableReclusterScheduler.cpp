@@ -0,0 +1,115 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SortedTableReclusterScheduler.h"
+
+#include "Catalog/Catalog.h"
+#include "LockMgr/LockMgr.h"
+#include "QueryEngine/Execute.h"
+#include "QueryEngine/TableOptimizer.h"
+
+size_t g_recluster_interval_seconds{0};  // 0 disables background re-clustering
+
+namespace {
+bool should_recluster_table(const TableDescriptor* td) {
+  return td->sortedColumnId > 0 && !td->isView && td->shard < 0 &&
+         !td->isForeignTable() && !td->isTemporaryTable();
+}
+}  // namespace
+
+void SortedTableReclusterScheduler::reclusterTables(
+    std::atomic<bool>& is_program_running) {
+  auto& sys_catalog = Catalog_Namespace::SysCatalog::instance();
+  for (const auto& catalog : sys_catalog.getCatalogsForAllDbs()) {
+    for (const auto table : catalog->getAllTableMetadata()) {
+      // Exit if scheduler has been stopped asynchronously
+      if (!is_program_running || !is_scheduler_running_) {
+        return;
+      }
+      if (!should_recluster_table(table)) {
+        continue;
+      }
+      try {
+        const auto td_with_lock =
+            lockmgr::TableSchemaLockContainer<lockmgr::ReadLock>::acquireTableDescriptor(
+                *catalog, table->tableName);
+        const auto td = td_with_lock();
+        CHECK(td);
+        auto executor = Executor::getExecutor(Executor::UNITARY_EXECUTOR_ID);
+        const TableOptimizer optimizer(td, executor.get(), *catalog);
+        if (optimizer.reclusterSortedRowsAboveMinOverlap()) {
+          has_reclustered_table_ = true;
+        }
+      } catch (std::exception& e) {
+        LOG(ERROR) << "Scheduled re-clustering for table \"" << table->tableName
+                   << "\" resulted in an error. " << e.what();
+      }
+    }
+  }
+}
+
+void SortedTableReclusterScheduler::start(std::atomic<bool>& is_program_running) {
+  if (is_program_running && !is_scheduler_running_) {
+    is_scheduler_running_ = true;
+    scheduler_thread_ = std::thread([&is_program_running]() {
+      while (is_program_running && is_scheduler_running_) {
+        // A condition variable is used here (instead of a sleep call)
+        // in order to allow for thread wake-up, even in the middle
+        // of a wait interval.
+        {
+          std::unique_lock<std::mutex> wait_lock(wait_mutex_);
+          wait_condition_.wait_for(wait_lock, thread_wait_duration_);
+        }
+        // Exit if scheduler has been stopped asynchronously
+        if (!is_program_running || !is_scheduler_running_) {
+          return;
+        }
+        reclusterTables(is_program_running);
+      }
+    });
+  }
+}
+
+void SortedTableReclusterScheduler::stop() {
+  if (is_scheduler_running_) {
+    is_scheduler_running_ = false;
+    wait_condition_.notify_one();
+    scheduler_thread_.join();
+  }
+}
+
+void SortedTableReclusterScheduler::setWaitDuration(int64_t duration_in_seconds) {
+  thread_wait_duration_ = std::chrono::seconds{duration_in_seconds};
+}
+
+bool SortedTableReclusterScheduler::isRunning() {
+  return is_scheduler_running_;
+}
+
+bool SortedTableReclusterScheduler::hasReclusteredTable() {
+  return has_reclustered_table_;
+}
+
+void SortedTableReclusterScheduler::resetHasReclusteredTable() {
+  has_reclustered_table_ = false;
+}
+
+std::atomic<bool> SortedTableReclusterScheduler::is_scheduler_running_{false};
+std::chrono::seconds SortedTableReclusterScheduler::thread_wait_duration_{60};
+std::thread SortedTableReclusterScheduler::scheduler_thread_;
+std::atomic<bool> SortedTableReclusterScheduler::has_reclustered_table_{false};
+std::mutex SortedTableReclusterScheduler::wait_mutex_;
+std::condition_variable SortedTableReclusterScheduler::wait_condition_;
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2021 OmniSci, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+extern size_t g_recluster_interval_seconds;
+
+/**
+ * Periodically re-clusters tables with a sort column whose fragments hold overlapping
+ * sort column ranges (see TableOptimizer::reclusterSortedRowsAboveMinOverlap).
+ */
+class SortedTableReclusterScheduler {
+ public:
+  static void start(std::atomic<bool>& is_program_running);
+  static void stop();
+  static void setWaitDuration(int64_t duration_in_seconds);
+
+  // The following methods are for testing purposes only
+  static bool isRunning();
+  static bool hasReclusteredTable();
+  static void resetHasReclusteredTable();
+
+ private:
+  static void reclusterTables(std::atomic<bool>& is_program_running);
+
+  static std::atomic<bool> is_scheduler_running_;
+  static std::chrono::seconds thread_wait_duration_;
+  static std::thread scheduler_thread_;
+  static std::atomic<bool> has_reclustered_table_;
+  static std::mutex wait_mutex_;
+  static std::condition_variable wait_condition_;
+};
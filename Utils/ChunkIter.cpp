@@ -23,10 +23,57 @@
 
 #include <cstdlib>
 
+// Decodes a value of a run length (RL) or differential (DIFF) encoded chunk. The
+// chunk header is kept in `second_buf` by the iterator; see DataMgr/RunLengthEncoder.h
+// and DataMgr/DiffEncoder.h for the layouts. For RL chunks `compressed` is a virtual
+// position from which only the row index is derived.
+DEVICE static int64_t run_length_or_diff_decode(const SQLTypeInfo& ti,
+                                                const int8_t* chunk_header,
+                                                const int8_t* compressed,
+                                                const int64_t null_val) {
+  if (ti.get_compression() == kENCODING_RL) {
+    const int64_t row = (compressed - chunk_header) / ti.get_size();
+    const auto run_count = *reinterpret_cast<const int64_t*>(chunk_header);
+    // runs are (value, exclusive end row) pairs following the run count
+    const auto runs = reinterpret_cast<const int64_t*>(chunk_header) + 1;
+    int64_t lo = 0;
+    int64_t hi = run_count - 1;
+    while (lo < hi) {
+      const auto mid = lo + (hi - lo) / 2;
+      if (runs[2 * mid + 1] > row) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+    return runs[2 * lo];
+  }
+  assert(ti.get_compression() == kENCODING_DIFF);
+  const auto baseline = *reinterpret_cast<const int64_t*>(chunk_header);
+  switch (ti.get_comp_param() / 8) {
+    case 1: {
+      const auto delta = *reinterpret_cast<const int8_t*>(compressed);
+      return delta == INT8_MIN ? null_val : baseline + delta;
+    }
+    case 2: {
+      const auto delta = *reinterpret_cast<const int16_t*>(compressed);
+      return delta == INT16_MIN ? null_val : baseline + delta;
+    }
+    case 4: {
+      const auto delta = *reinterpret_cast<const int32_t*>(compressed);
+      return delta == INT32_MIN ? null_val : baseline + delta;
+    }
+    default:
+      assert(false);
+  }
+  return null_val;
+}
+
 DEVICE static void decompress(const SQLTypeInfo& ti,
                               int8_t* compressed,
                               VarlenDatum* result,
-                              Datum* datum) {
+                              Datum* datum,
+                              const int8_t* chunk_header) {
   switch (ti.get_type()) {
     case kSMALLINT:
       result->length = sizeof(int16_t);
@@ -38,6 +85,9 @@ DEVICE static void decompress(const SQLTypeInfo& ti,
           break;
         case kENCODING_RL:
         case kENCODING_DIFF:
+          datum->smallintval = (int16_t)run_length_or_diff_decode(
+              ti, chunk_header, compressed, NULL_SMALLINT);
+          break;
         case kENCODING_SPARSE:
           assert(false);
           break;
@@ -63,6 +113,9 @@ DEVICE static void decompress(const SQLTypeInfo& ti,
           break;
         case kENCODING_RL:
         case kENCODING_DIFF:
+          datum->intval =
+              (int32_t)run_length_or_diff_decode(ti, chunk_header, compressed, NULL_INT);
+          break;
         case kENCODING_SPARSE:
           assert(false);
           break;
@@ -93,6 +146,9 @@ DEVICE static void decompress(const SQLTypeInfo& ti,
           break;
         case kENCODING_RL:
         case kENCODING_DIFF:
+          datum->bigintval =
+              run_length_or_diff_decode(ti, chunk_header, compressed, NULL_BIGINT);
+          break;
         case kENCODING_SPARSE:
           assert(false);
           break;
@@ -123,6 +179,9 @@ DEVICE static void decompress(const SQLTypeInfo& ti,
           break;
         case kENCODING_RL:
         case kENCODING_DIFF:
+          datum->bigintval =
+              run_length_or_diff_decode(ti, chunk_header, compressed, NULL_BIGINT);
+          break;
         case kENCODING_DICT:
         case kENCODING_SPARSE:
         case kENCODING_NONE:
@@ -140,6 +199,14 @@ DEVICE static void decompress(const SQLTypeInfo& ti,
   result->is_null = ti.is_null(*datum);
 }
 
+// RL and DIFF encoded values have no meaningful raw representation and are always
+// decoded.
+DEVICE static bool must_decompress(const ChunkIter* it, const bool uncompress) {
+  const auto compression = it->type_info.get_compression();
+  return (uncompress && compression != kENCODING_NONE) || compression == kENCODING_RL ||
+         compression == kENCODING_DIFF;
+}
+
 void ChunkIter_reset(ChunkIter* it) {
   it->current_pos = it->start_pos;
 }
@@ -159,8 +226,8 @@ DEVICE void ChunkIter_get_next(ChunkIter* it,
 
   if (it->skip_size > 0) {
     // for fixed-size
-    if (uncompress && (it->type_info.get_compression() != kENCODING_NONE)) {
-      decompress(it->type_info, it->current_pos, result, &it->datum);
+    if (must_decompress(it, uncompress)) {
+      decompress(it->type_info, it->current_pos, result, &it->datum, it->second_buf);
     } else {
       result->length = static_cast<size_t>(it->skip_size);
       result->pointer = it->current_pos;
@@ -195,8 +262,8 @@ DEVICE void ChunkIter_get_nth(ChunkIter* it,
   if (it->skip_size > 0) {
     // for fixed-size
     int8_t* current_pos = it->start_pos + n * it->skip_size;
-    if (uncompress && (it->type_info.get_compression() != kENCODING_NONE)) {
-      decompress(it->type_info, current_pos, result, &it->datum);
+    if (must_decompress(it, uncompress)) {
+      decompress(it->type_info, current_pos, result, &it->datum, it->second_buf);
     } else {
       result->length = static_cast<size_t>(it->skip_size);
       result->pointer = current_pos;
@@ -29,6 +29,8 @@
 #include "Parser/ReservedKeywords.h"
 #include "Shared/misc.h"
 
+extern bool g_enable_page_compression;
+
 bool g_use_date_in_days_default_encoding{true};
 
 namespace ddl_utils {
@@ -333,6 +335,62 @@ void validate_and_set_fixed_encoding(ColumnDescriptor& cd,
   }
 }
 
+namespace {
+bool is_run_length_or_diff_encodable(const SQLTypeInfo& ti) {
+  switch (ti.get_type()) {
+    case kSMALLINT:
+    case kINT:
+    case kBIGINT:
+    case kNUMERIC:
+    case kDECIMAL:
+    case kTIME:
+    case kDATE:
+      return true;
+    case kTIMESTAMP:
+      return ti.get_dimension() == 0;
+    default:
+      return false;
+  }
+}
+}  // namespace
+
+void validate_and_set_run_length_encoding(ColumnDescriptor& cd, int encoding_size) {
+  if (!is_run_length_or_diff_encodable(cd.columnType)) {
+    throw std::runtime_error(cd.columnName +
+                             ": RL encoding is only supported on integer, decimal, time, "
+                             "date and timestamp(0) columns.");
+  }
+  if (encoding_size != 0) {
+    throw std::runtime_error(cd.columnName + ": RL encoding does not take a parameter.");
+  }
+  // run length encoding
+  cd.columnType.set_compression(kENCODING_RL);
+  cd.columnType.set_comp_param(0);
+}
+
+void validate_and_set_diff_encoding(ColumnDescriptor& cd, int encoding_size) {
+  if (!is_run_length_or_diff_encodable(cd.columnType)) {
+    throw std::runtime_error(cd.columnName +
+                             ": DIFF encoding is only supported on integer, decimal, "
+                             "time, date and timestamp(0) columns.");
+  }
+  const auto type_size = SQLTypeInfo(cd.columnType.get_type()).get_size() * 8;
+  int comp_param = encoding_size;
+  if (comp_param == 0) {
+    // default to the widest delta narrower than the column itself
+    comp_param = std::min(32, type_size / 2);
+  }
+  if ((comp_param != 8 && comp_param != 16 && comp_param != 32) ||
+      comp_param >= type_size) {
+    throw std::runtime_error(cd.columnName +
+                             ": Compression parameter for DIFF encoding must be 8, 16 or "
+                             "32 and smaller than the column size.");
+  }
+  // differential encoding
+  cd.columnType.set_compression(kENCODING_DIFF);
+  cd.columnType.set_comp_param(comp_param);
+}
+
 void validate_and_set_dictionary_encoding(ColumnDescriptor& cd, int encoding_size) {
   if (!cd.columnType.is_string() && !cd.columnType.is_string_array()) {
     throw std::runtime_error(
@@ -436,15 +494,9 @@ void validate_and_set_encoding(ColumnDescriptor& cd,
     if (boost::iequals(comp, "fixed")) {
       validate_and_set_fixed_encoding(cd, encoding->get_encoding_param(), column_type);
     } else if (boost::iequals(comp, "rl")) {
-      // run length encoding
-      cd.columnType.set_compression(kENCODING_RL);
-      cd.columnType.set_comp_param(0);
-      // throw std::runtime_error("RL(Run Length) encoding not supported yet.");
+      validate_and_set_run_length_encoding(cd, encoding->get_encoding_param());
     } else if (boost::iequals(comp, "diff")) {
-      // differential encoding
-      cd.columnType.set_compression(kENCODING_DIFF);
-      cd.columnType.set_comp_param(0);
-      // throw std::runtime_error("DIFF(differential) encoding not supported yet.");
+      validate_and_set_diff_encoding(cd, encoding->get_encoding_param());
     } else if (boost::iequals(comp, "dict")) {
       validate_and_set_dictionary_encoding(cd, encoding->get_encoding_param());
     } else if (boost::iequals(comp, "NONE")) {
@@ -534,6 +586,7 @@ void set_default_table_attributes(const std::string& table_name,
   td.maxChunkSize = DEFAULT_MAX_CHUNK_SIZE;
   td.fragPageSize = DEFAULT_PAGE_SIZE;
   td.maxRows = DEFAULT_MAX_ROWS;
+  td.pageCompression = g_enable_page_compression;
 }
 
 void validate_non_duplicate_column(const std::string& column_name,
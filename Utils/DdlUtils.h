@@ -112,6 +112,10 @@ void validate_and_set_fixed_encoding(ColumnDescriptor& cd,
                                      int encoding_size,
                                      const SqlType* column_type);
 
+void validate_and_set_run_length_encoding(ColumnDescriptor& cd, int encoding_size);
+
+void validate_and_set_diff_encoding(ColumnDescriptor& cd, int encoding_size);
+
 void validate_and_set_dictionary_encoding(ColumnDescriptor& cd, int encoding_size);
 
 void validate_and_set_none_encoding(ColumnDescriptor& cd);
@@ -156,6 +156,22 @@ struct TDataFrame {
   7: binary df_buffer;
 }
 
+struct TDataFrameCursor {
+  1: string cursor_id;
+  2: binary schema;
+  3: i64 execution_time_ms;
+}
+
+struct TPreparedStatement {
+  1: string statement_id;
+  2: i32 num_parameters;
+}
+
+struct TBindParameter {
+  1: common.TDatumType type;
+  2: TDatum value;
+}
+
 struct TDBInfo {
   1: string db_name;
   2: string db_owner;
@@ -218,6 +234,14 @@ struct TFrontendView {
   5: string view_metadata;
 }
 
+struct TDispatchQueueStatus {
+  1: i64 queue_depth;
+  2: i64 max_queue_depth;
+  3: i64 num_dispatched;
+  4: list<i64> wait_time_ms_bucket_bounds;
+  5: list<i64> wait_time_ms_histogram;
+}
+
 struct TServerStatus {
   1: bool read_only;
   2: string version;
@@ -228,6 +252,7 @@ struct TServerStatus {
   7: bool poly_rendering_enabled;
   8: TRole role;
   9: string renderer_status_json;
+  10: TDispatchQueueStatus dispatch_queue_status;
 }
 
 struct TPixel {
@@ -284,6 +309,33 @@ struct TMemoryData {
   7: bool is_free;
 }
 
+struct THashTableCacheInfo {
+  1: string cache_name;
+  2: i64 num_entries;
+  3: i64 size_bytes;
+  4: i64 max_size_bytes;
+  5: i64 hits;
+  6: i64 misses;
+  7: i64 evictions;
+}
+
+struct TBufferPoolStats {
+  1: i64 hits;
+  2: i64 misses;
+  3: i64 evictions;
+  4: i64 chunk_index_lock_acquisitions;
+  5: i64 chunk_index_lock_waits;
+}
+
+struct TStringDictionaryCacheStats {
+  1: i64 num_entries;
+  2: i64 size_bytes;
+  3: i64 max_size_bytes;
+  4: i64 hits;
+  5: i64 misses;
+  6: i64 evictions;
+}
+
 struct TNodeMemoryInfo {
   1: string host_name;
   2: i64 page_size;
@@ -291,6 +343,9 @@ struct TNodeMemoryInfo {
   4: i64 num_pages_allocated;
   5: bool is_allocation_capped;
   6: list<TMemoryData> node_memory_data;
+  7: list<THashTableCacheInfo> hash_table_caches;
+  8: TBufferPoolStats buffer_pool_stats;
+  9: TStringDictionaryCacheStats string_dictionary_cache;
 }
 
 struct TTableMeta {
@@ -580,9 +635,15 @@ service OmniSci {
   TSessionInfo get_session_info(1: TSessionId session) throws (1: TOmniSciException e)
   # query, render
   TQueryResult sql_execute(1: TSessionId session, 2: string query, 3: bool column_format, 4: string nonce, 5: i32 first_n = -1, 6: i32 at_most_n = -1) throws (1: TOmniSciException e)
+  TPreparedStatement prepare_statement(1: TSessionId session, 2: string query) throws (1: TOmniSciException e)
+  TQueryResult sql_execute_prepared(1: TSessionId session, 2: string statement_id, 3: list<TBindParameter> parameters, 4: bool column_format, 5: string nonce, 6: i32 first_n = -1, 7: i32 at_most_n = -1) throws (1: TOmniSciException e)
+  void close_prepared_statement(1: TSessionId session, 2: string statement_id) throws (1: TOmniSciException e)
   TDataFrame sql_execute_df(1: TSessionId session, 2: string query, 3: common.TDeviceType device_type, 4: i32 device_id = 0, 5: i32 first_n = -1, 6: TArrowTransport transport_method) throws (1: TOmniSciException e)
   TDataFrame sql_execute_gdf(1: TSessionId session, 2: string query, 3: i32 device_id = 0, 4: i32 first_n = -1) throws (1: TOmniSciException e)
   void deallocate_df(1: TSessionId session, 2: TDataFrame df, 3: common.TDeviceType device_type, 4: i32 device_id = 0) throws (1: TOmniSciException e)
+  TDataFrameCursor sql_execute_df_cursor(1: TSessionId session, 2: string query, 3: i32 first_n = -1, 4: i64 max_batch_rows = 0, 5: TArrowTransport transport_method) throws (1: TOmniSciException e)
+  TDataFrame fetch_df_batch(1: TSessionId session, 2: string cursor_id) throws (1: TOmniSciException e)
+  void close_df_cursor(1: TSessionId session, 2: string cursor_id) throws (1: TOmniSciException e)
   void interrupt(1: TSessionId query_session, 2: TSessionId interrupt_session) throws (1: TOmniSciException e)
   TRowDescriptor sql_validate(1: TSessionId session, 2: string query) throws (1: TOmniSciException e)
   list<completion_hints.TCompletionHint> get_completion_hints(1: TSessionId session, 2: string sql, 3: i32 cursor) throws (1: TOmniSciException e)
@@ -95,6 +95,15 @@ class Iface(object):
         """
         pass
 
+    def get_tables_for_database(self, session, database_name):
+        """
+        Parameters:
+         - session
+         - database_name
+
+        """
+        pass
+
     def get_physical_tables(self, session):
         """
         Parameters:
@@ -128,6 +137,16 @@ class Iface(object):
         """
         pass
 
+    def get_table_details_for_database(self, session, table_name, database_name):
+        """
+        Parameters:
+         - session
+         - table_name
+         - database_name
+
+        """
+        pass
+
     def get_internal_table_details(self, session, table_name):
         """
         Parameters:
@@ -137,6 +156,16 @@ class Iface(object):
         """
         pass
 
+    def get_internal_table_details_for_database(self, session, table_name, database_name):
+        """
+        Parameters:
+         - session
+         - table_name
+         - database_name
+
+        """
+        pass
+
     def get_users(self, session):
         """
         Parameters:
@@ -205,6 +234,28 @@ class Iface(object):
         """
         pass
 
+    def set_cur_session(self, parent_session, leaf_session, start_time_str, label):
+        """
+        Parameters:
+         - parent_session
+         - leaf_session
+         - start_time_str
+         - label
+
+        """
+        pass
+
+    def invalidate_cur_session(self, parent_session, leaf_session, start_time_str, label):
+        """
+        Parameters:
+         - parent_session
+         - leaf_session
+         - start_time_str
+         - label
+
+        """
+        pass
+
     def set_table_epoch(self, session, db_id, table_id, new_epoch):
         """
         Parameters:
@@ -286,6 +337,38 @@ class Iface(object):
         """
         pass
 
+    def prepare_statement(self, session, query):
+        """
+        Parameters:
+         - session
+         - query
+
+        """
+        pass
+
+    def sql_execute_prepared(self, session, statement_id, parameters, column_format, nonce, first_n, at_most_n):
+        """
+        Parameters:
+         - session
+         - statement_id
+         - parameters
+         - column_format
+         - nonce
+         - first_n
+         - at_most_n
+
+        """
+        pass
+
+    def close_prepared_statement(self, session, statement_id):
+        """
+        Parameters:
+         - session
+         - statement_id
+
+        """
+        pass
+
     def sql_execute_df(self, session, query, device_type, device_id, first_n, transport_method):
         """
         Parameters:
@@ -321,6 +404,36 @@ class Iface(object):
         """
         pass
 
+    def sql_execute_df_cursor(self, session, query, first_n, max_batch_rows, transport_method):
+        """
+        Parameters:
+         - session
+         - query
+         - first_n
+         - max_batch_rows
+         - transport_method
+
+        """
+        pass
+
+    def fetch_df_batch(self, session, cursor_id):
+        """
+        Parameters:
+         - session
+         - cursor_id
+
+        """
+        pass
+
+    def close_df_cursor(self, session, cursor_id):
+        """
+        Parameters:
+         - session
+         - cursor_id
+
+        """
+        pass
+
     def interrupt(self, query_session, interrupt_session):
         """
         Parameters:
@@ -384,6 +497,43 @@ class Iface(object):
         """
         pass
 
+    def create_custom_expression(self, session, custom_expression):
+        """
+        Parameters:
+         - session
+         - custom_expression
+
+        """
+        pass
+
+    def get_custom_expressions(self, session):
+        """
+        Parameters:
+         - session
+
+        """
+        pass
+
+    def update_custom_expression(self, session, id, expression_json):
+        """
+        Parameters:
+         - session
+         - id
+         - expression_json
+
+        """
+        pass
+
+    def delete_custom_expressions(self, session, custom_expression_ids, do_soft_delete):
+        """
+        Parameters:
+         - session
+         - custom_expression_ids
+         - do_soft_delete
+
+        """
+        pass
+
     def get_dashboard(self, session, dashboard_id):
         """
         Parameters:
@@ -542,6 +692,18 @@ class Iface(object):
         """
         pass
 
+    def load_table_binary_columnar_polys(self, session, table_name, cols, column_names, assign_render_groups):
+        """
+        Parameters:
+         - session
+         - table_name
+         - cols
+         - column_names
+         - assign_render_groups
+
+        """
+        pass
+
     def load_table_binary_arrow(self, session, table_name, arrow_stream, use_column_names):
         """
         Parameters:
@@ -667,23 +829,25 @@ class Iface(object):
         """
         pass
 
-    def start_query(self, leaf_session, parent_session, query_ra, just_explain, outer_fragment_indices):
+    def start_query(self, leaf_session, parent_session, query_ra, start_time_str, just_explain, outer_fragment_indices):
         """
         Parameters:
          - leaf_session
          - parent_session
          - query_ra
+         - start_time_str
          - just_explain
          - outer_fragment_indices
 
         """
         pass
 
-    def execute_query_step(self, pending_query, subquery_id):
+    def execute_query_step(self, pending_query, subquery_id, start_time_str):
         """
         Parameters:
          - pending_query
          - subquery_id
+         - start_time_str
 
         """
         pass
@@ -1152,6 +1316,42 @@ class Client(Iface):
             raise result.e
         raise TApplicationException(TApplicationException.MISSING_RESULT, "get_tables failed: unknown result")
 
+    def get_tables_for_database(self, session, database_name):
+        """
+        Parameters:
+         - session
+         - database_name
+
+        """
+        self.send_get_tables_for_database(session, database_name)
+        return self.recv_get_tables_for_database()
+
+    def send_get_tables_for_database(self, session, database_name):
+        self._oprot.writeMessageBegin('get_tables_for_database', TMessageType.CALL, self._seqid)
+        args = get_tables_for_database_args()
+        args.session = session
+        args.database_name = database_name
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_get_tables_for_database(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = get_tables_for_database_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "get_tables_for_database failed: unknown result")
+
     def get_physical_tables(self, session):
         """
         Parameters:
@@ -1290,6 +1490,44 @@ class Client(Iface):
             raise result.e
         raise TApplicationException(TApplicationException.MISSING_RESULT, "get_table_details failed: unknown result")
 
+    def get_table_details_for_database(self, session, table_name, database_name):
+        """
+        Parameters:
+         - session
+         - table_name
+         - database_name
+
+        """
+        self.send_get_table_details_for_database(session, table_name, database_name)
+        return self.recv_get_table_details_for_database()
+
+    def send_get_table_details_for_database(self, session, table_name, database_name):
+        self._oprot.writeMessageBegin('get_table_details_for_database', TMessageType.CALL, self._seqid)
+        args = get_table_details_for_database_args()
+        args.session = session
+        args.table_name = table_name
+        args.database_name = database_name
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_get_table_details_for_database(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = get_table_details_for_database_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "get_table_details_for_database failed: unknown result")
+
     def get_internal_table_details(self, session, table_name):
         """
         Parameters:
@@ -1326,6 +1564,44 @@ class Client(Iface):
             raise result.e
         raise TApplicationException(TApplicationException.MISSING_RESULT, "get_internal_table_details failed: unknown result")
 
+    def get_internal_table_details_for_database(self, session, table_name, database_name):
+        """
+        Parameters:
+         - session
+         - table_name
+         - database_name
+
+        """
+        self.send_get_internal_table_details_for_database(session, table_name, database_name)
+        return self.recv_get_internal_table_details_for_database()
+
+    def send_get_internal_table_details_for_database(self, session, table_name, database_name):
+        self._oprot.writeMessageBegin('get_internal_table_details_for_database', TMessageType.CALL, self._seqid)
+        args = get_internal_table_details_for_database_args()
+        args.session = session
+        args.table_name = table_name
+        args.database_name = database_name
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_get_internal_table_details_for_database(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = get_internal_table_details_for_database_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "get_internal_table_details_for_database failed: unknown result")
+
     def get_users(self, session):
         """
         Parameters:
@@ -1620,30 +1896,30 @@ class Client(Iface):
             raise result.e
         return
 
-    def set_table_epoch(self, session, db_id, table_id, new_epoch):
+    def set_cur_session(self, parent_session, leaf_session, start_time_str, label):
         """
         Parameters:
-         - session
-         - db_id
-         - table_id
-         - new_epoch
+         - parent_session
+         - leaf_session
+         - start_time_str
+         - label
 
         """
-        self.send_set_table_epoch(session, db_id, table_id, new_epoch)
-        self.recv_set_table_epoch()
+        self.send_set_cur_session(parent_session, leaf_session, start_time_str, label)
+        self.recv_set_cur_session()
 
-    def send_set_table_epoch(self, session, db_id, table_id, new_epoch):
-        self._oprot.writeMessageBegin('set_table_epoch', TMessageType.CALL, self._seqid)
-        args = set_table_epoch_args()
-        args.session = session
-        args.db_id = db_id
-        args.table_id = table_id
-        args.new_epoch = new_epoch
+    def send_set_cur_session(self, parent_session, leaf_session, start_time_str, label):
+        self._oprot.writeMessageBegin('set_cur_session', TMessageType.CALL, self._seqid)
+        args = set_cur_session_args()
+        args.parent_session = parent_session
+        args.leaf_session = leaf_session
+        args.start_time_str = start_time_str
+        args.label = label
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
         self._oprot.trans.flush()
 
-    def recv_set_table_epoch(self):
+    def recv_set_cur_session(self):
         iprot = self._iprot
         (fname, mtype, rseqid) = iprot.readMessageBegin()
         if mtype == TMessageType.EXCEPTION:
@@ -1651,35 +1927,37 @@ class Client(Iface):
             x.read(iprot)
             iprot.readMessageEnd()
             raise x
-        result = set_table_epoch_result()
+        result = set_cur_session_result()
         result.read(iprot)
         iprot.readMessageEnd()
         if result.e is not None:
             raise result.e
         return
 
-    def set_table_epoch_by_name(self, session, table_name, new_epoch):
+    def invalidate_cur_session(self, parent_session, leaf_session, start_time_str, label):
         """
         Parameters:
-         - session
-         - table_name
-         - new_epoch
+         - parent_session
+         - leaf_session
+         - start_time_str
+         - label
 
         """
-        self.send_set_table_epoch_by_name(session, table_name, new_epoch)
-        self.recv_set_table_epoch_by_name()
+        self.send_invalidate_cur_session(parent_session, leaf_session, start_time_str, label)
+        self.recv_invalidate_cur_session()
 
-    def send_set_table_epoch_by_name(self, session, table_name, new_epoch):
-        self._oprot.writeMessageBegin('set_table_epoch_by_name', TMessageType.CALL, self._seqid)
-        args = set_table_epoch_by_name_args()
-        args.session = session
-        args.table_name = table_name
-        args.new_epoch = new_epoch
+    def send_invalidate_cur_session(self, parent_session, leaf_session, start_time_str, label):
+        self._oprot.writeMessageBegin('invalidate_cur_session', TMessageType.CALL, self._seqid)
+        args = invalidate_cur_session_args()
+        args.parent_session = parent_session
+        args.leaf_session = leaf_session
+        args.start_time_str = start_time_str
+        args.label = label
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
         self._oprot.trans.flush()
 
-    def recv_set_table_epoch_by_name(self):
+    def recv_invalidate_cur_session(self):
         iprot = self._iprot
         (fname, mtype, rseqid) = iprot.readMessageBegin()
         if mtype == TMessageType.EXCEPTION:
@@ -1687,29 +1965,103 @@ class Client(Iface):
             x.read(iprot)
             iprot.readMessageEnd()
             raise x
-        result = set_table_epoch_by_name_result()
+        result = invalidate_cur_session_result()
         result.read(iprot)
         iprot.readMessageEnd()
         if result.e is not None:
             raise result.e
         return
 
-    def get_table_epoch(self, session, db_id, table_id):
+    def set_table_epoch(self, session, db_id, table_id, new_epoch):
         """
         Parameters:
          - session
          - db_id
          - table_id
+         - new_epoch
 
         """
-        self.send_get_table_epoch(session, db_id, table_id)
-        return self.recv_get_table_epoch()
+        self.send_set_table_epoch(session, db_id, table_id, new_epoch)
+        self.recv_set_table_epoch()
 
-    def send_get_table_epoch(self, session, db_id, table_id):
-        self._oprot.writeMessageBegin('get_table_epoch', TMessageType.CALL, self._seqid)
-        args = get_table_epoch_args()
-        args.session = session
-        args.db_id = db_id
+    def send_set_table_epoch(self, session, db_id, table_id, new_epoch):
+        self._oprot.writeMessageBegin('set_table_epoch', TMessageType.CALL, self._seqid)
+        args = set_table_epoch_args()
+        args.session = session
+        args.db_id = db_id
+        args.table_id = table_id
+        args.new_epoch = new_epoch
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_set_table_epoch(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = set_table_epoch_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.e is not None:
+            raise result.e
+        return
+
+    def set_table_epoch_by_name(self, session, table_name, new_epoch):
+        """
+        Parameters:
+         - session
+         - table_name
+         - new_epoch
+
+        """
+        self.send_set_table_epoch_by_name(session, table_name, new_epoch)
+        self.recv_set_table_epoch_by_name()
+
+    def send_set_table_epoch_by_name(self, session, table_name, new_epoch):
+        self._oprot.writeMessageBegin('set_table_epoch_by_name', TMessageType.CALL, self._seqid)
+        args = set_table_epoch_by_name_args()
+        args.session = session
+        args.table_name = table_name
+        args.new_epoch = new_epoch
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_set_table_epoch_by_name(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = set_table_epoch_by_name_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.e is not None:
+            raise result.e
+        return
+
+    def get_table_epoch(self, session, db_id, table_id):
+        """
+        Parameters:
+         - session
+         - db_id
+         - table_id
+
+        """
+        self.send_get_table_epoch(session, db_id, table_id)
+        return self.recv_get_table_epoch()
+
+    def send_get_table_epoch(self, session, db_id, table_id):
+        self._oprot.writeMessageBegin('get_table_epoch', TMessageType.CALL, self._seqid)
+        args = get_table_epoch_args()
+        args.session = session
+        args.db_id = db_id
         args.table_id = table_id
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
@@ -1912,6 +2264,122 @@ class Client(Iface):
             raise result.e
         raise TApplicationException(TApplicationException.MISSING_RESULT, "sql_execute failed: unknown result")
 
+    def prepare_statement(self, session, query):
+        """
+        Parameters:
+         - session
+         - query
+
+        """
+        self.send_prepare_statement(session, query)
+        return self.recv_prepare_statement()
+
+    def send_prepare_statement(self, session, query):
+        self._oprot.writeMessageBegin('prepare_statement', TMessageType.CALL, self._seqid)
+        args = prepare_statement_args()
+        args.session = session
+        args.query = query
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_prepare_statement(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = prepare_statement_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "prepare_statement failed: unknown result")
+
+    def sql_execute_prepared(self, session, statement_id, parameters, column_format, nonce, first_n, at_most_n):
+        """
+        Parameters:
+         - session
+         - statement_id
+         - parameters
+         - column_format
+         - nonce
+         - first_n
+         - at_most_n
+
+        """
+        self.send_sql_execute_prepared(session, statement_id, parameters, column_format, nonce, first_n, at_most_n)
+        return self.recv_sql_execute_prepared()
+
+    def send_sql_execute_prepared(self, session, statement_id, parameters, column_format, nonce, first_n, at_most_n):
+        self._oprot.writeMessageBegin('sql_execute_prepared', TMessageType.CALL, self._seqid)
+        args = sql_execute_prepared_args()
+        args.session = session
+        args.statement_id = statement_id
+        args.parameters = parameters
+        args.column_format = column_format
+        args.nonce = nonce
+        args.first_n = first_n
+        args.at_most_n = at_most_n
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_sql_execute_prepared(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = sql_execute_prepared_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "sql_execute_prepared failed: unknown result")
+
+    def close_prepared_statement(self, session, statement_id):
+        """
+        Parameters:
+         - session
+         - statement_id
+
+        """
+        self.send_close_prepared_statement(session, statement_id)
+        self.recv_close_prepared_statement()
+
+    def send_close_prepared_statement(self, session, statement_id):
+        self._oprot.writeMessageBegin('close_prepared_statement', TMessageType.CALL, self._seqid)
+        args = close_prepared_statement_args()
+        args.session = session
+        args.statement_id = statement_id
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_close_prepared_statement(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = close_prepared_statement_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.e is not None:
+            raise result.e
+        return
+
     def sql_execute_df(self, session, query, device_type, device_id, first_n, transport_method):
         """
         Parameters:
@@ -2034,6 +2502,118 @@ class Client(Iface):
             raise result.e
         return
 
+    def sql_execute_df_cursor(self, session, query, first_n, max_batch_rows, transport_method):
+        """
+        Parameters:
+         - session
+         - query
+         - first_n
+         - max_batch_rows
+         - transport_method
+
+        """
+        self.send_sql_execute_df_cursor(session, query, first_n, max_batch_rows, transport_method)
+        return self.recv_sql_execute_df_cursor()
+
+    def send_sql_execute_df_cursor(self, session, query, first_n, max_batch_rows, transport_method):
+        self._oprot.writeMessageBegin('sql_execute_df_cursor', TMessageType.CALL, self._seqid)
+        args = sql_execute_df_cursor_args()
+        args.session = session
+        args.query = query
+        args.first_n = first_n
+        args.max_batch_rows = max_batch_rows
+        args.transport_method = transport_method
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_sql_execute_df_cursor(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = sql_execute_df_cursor_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "sql_execute_df_cursor failed: unknown result")
+
+    def fetch_df_batch(self, session, cursor_id):
+        """
+        Parameters:
+         - session
+         - cursor_id
+
+        """
+        self.send_fetch_df_batch(session, cursor_id)
+        return self.recv_fetch_df_batch()
+
+    def send_fetch_df_batch(self, session, cursor_id):
+        self._oprot.writeMessageBegin('fetch_df_batch', TMessageType.CALL, self._seqid)
+        args = fetch_df_batch_args()
+        args.session = session
+        args.cursor_id = cursor_id
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_fetch_df_batch(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = fetch_df_batch_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "fetch_df_batch failed: unknown result")
+
+    def close_df_cursor(self, session, cursor_id):
+        """
+        Parameters:
+         - session
+         - cursor_id
+
+        """
+        self.send_close_df_cursor(session, cursor_id)
+        self.recv_close_df_cursor()
+
+    def send_close_df_cursor(self, session, cursor_id):
+        self._oprot.writeMessageBegin('close_df_cursor', TMessageType.CALL, self._seqid)
+        args = close_df_cursor_args()
+        args.session = session
+        args.cursor_id = cursor_id
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_close_df_cursor(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = close_df_cursor_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.e is not None:
+            raise result.e
+        return
+
     def interrupt(self, query_session, interrupt_session):
         """
         Parameters:
@@ -2264,26 +2844,26 @@ class Client(Iface):
             raise result.e
         raise TApplicationException(TApplicationException.MISSING_RESULT, "get_result_row_for_pixel failed: unknown result")
 
-    def get_dashboard(self, session, dashboard_id):
+    def create_custom_expression(self, session, custom_expression):
         """
         Parameters:
          - session
-         - dashboard_id
+         - custom_expression
 
         """
-        self.send_get_dashboard(session, dashboard_id)
-        return self.recv_get_dashboard()
+        self.send_create_custom_expression(session, custom_expression)
+        return self.recv_create_custom_expression()
 
-    def send_get_dashboard(self, session, dashboard_id):
-        self._oprot.writeMessageBegin('get_dashboard', TMessageType.CALL, self._seqid)
-        args = get_dashboard_args()
+    def send_create_custom_expression(self, session, custom_expression):
+        self._oprot.writeMessageBegin('create_custom_expression', TMessageType.CALL, self._seqid)
+        args = create_custom_expression_args()
         args.session = session
-        args.dashboard_id = dashboard_id
+        args.custom_expression = custom_expression
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
         self._oprot.trans.flush()
 
-    def recv_get_dashboard(self):
+    def recv_create_custom_expression(self):
         iprot = self._iprot
         (fname, mtype, rseqid) = iprot.readMessageBegin()
         if mtype == TMessageType.EXCEPTION:
@@ -2291,23 +2871,165 @@ class Client(Iface):
             x.read(iprot)
             iprot.readMessageEnd()
             raise x
-        result = get_dashboard_result()
+        result = create_custom_expression_result()
         result.read(iprot)
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
         if result.e is not None:
             raise result.e
-        raise TApplicationException(TApplicationException.MISSING_RESULT, "get_dashboard failed: unknown result")
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "create_custom_expression failed: unknown result")
 
-    def get_dashboards(self, session):
+    def get_custom_expressions(self, session):
         """
         Parameters:
          - session
 
         """
-        self.send_get_dashboards(session)
-        return self.recv_get_dashboards()
+        self.send_get_custom_expressions(session)
+        return self.recv_get_custom_expressions()
+
+    def send_get_custom_expressions(self, session):
+        self._oprot.writeMessageBegin('get_custom_expressions', TMessageType.CALL, self._seqid)
+        args = get_custom_expressions_args()
+        args.session = session
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_get_custom_expressions(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = get_custom_expressions_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "get_custom_expressions failed: unknown result")
+
+    def update_custom_expression(self, session, id, expression_json):
+        """
+        Parameters:
+         - session
+         - id
+         - expression_json
+
+        """
+        self.send_update_custom_expression(session, id, expression_json)
+        self.recv_update_custom_expression()
+
+    def send_update_custom_expression(self, session, id, expression_json):
+        self._oprot.writeMessageBegin('update_custom_expression', TMessageType.CALL, self._seqid)
+        args = update_custom_expression_args()
+        args.session = session
+        args.id = id
+        args.expression_json = expression_json
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_update_custom_expression(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = update_custom_expression_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.e is not None:
+            raise result.e
+        return
+
+    def delete_custom_expressions(self, session, custom_expression_ids, do_soft_delete):
+        """
+        Parameters:
+         - session
+         - custom_expression_ids
+         - do_soft_delete
+
+        """
+        self.send_delete_custom_expressions(session, custom_expression_ids, do_soft_delete)
+        self.recv_delete_custom_expressions()
+
+    def send_delete_custom_expressions(self, session, custom_expression_ids, do_soft_delete):
+        self._oprot.writeMessageBegin('delete_custom_expressions', TMessageType.CALL, self._seqid)
+        args = delete_custom_expressions_args()
+        args.session = session
+        args.custom_expression_ids = custom_expression_ids
+        args.do_soft_delete = do_soft_delete
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_delete_custom_expressions(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = delete_custom_expressions_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.e is not None:
+            raise result.e
+        return
+
+    def get_dashboard(self, session, dashboard_id):
+        """
+        Parameters:
+         - session
+         - dashboard_id
+
+        """
+        self.send_get_dashboard(session, dashboard_id)
+        return self.recv_get_dashboard()
+
+    def send_get_dashboard(self, session, dashboard_id):
+        self._oprot.writeMessageBegin('get_dashboard', TMessageType.CALL, self._seqid)
+        args = get_dashboard_args()
+        args.session = session
+        args.dashboard_id = dashboard_id
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_get_dashboard(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = get_dashboard_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "get_dashboard failed: unknown result")
+
+    def get_dashboards(self, session):
+        """
+        Parameters:
+         - session
+
+        """
+        self.send_get_dashboards(session)
+        return self.recv_get_dashboards()
 
     def send_get_dashboards(self, session):
         self._oprot.writeMessageBegin('get_dashboards', TMessageType.CALL, self._seqid)
@@ -2832,6 +3554,46 @@ class Client(Iface):
             raise result.e
         return
 
+    def load_table_binary_columnar_polys(self, session, table_name, cols, column_names, assign_render_groups):
+        """
+        Parameters:
+         - session
+         - table_name
+         - cols
+         - column_names
+         - assign_render_groups
+
+        """
+        self.send_load_table_binary_columnar_polys(session, table_name, cols, column_names, assign_render_groups)
+        self.recv_load_table_binary_columnar_polys()
+
+    def send_load_table_binary_columnar_polys(self, session, table_name, cols, column_names, assign_render_groups):
+        self._oprot.writeMessageBegin('load_table_binary_columnar_polys', TMessageType.CALL, self._seqid)
+        args = load_table_binary_columnar_polys_args()
+        args.session = session
+        args.table_name = table_name
+        args.cols = cols
+        args.column_names = column_names
+        args.assign_render_groups = assign_render_groups
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_load_table_binary_columnar_polys(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = load_table_binary_columnar_polys_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.e is not None:
+            raise result.e
+        return
+
     def load_table_binary_arrow(self, session, table_name, arrow_stream, use_column_names):
         """
         Parameters:
@@ -3288,25 +4050,27 @@ class Client(Iface):
             raise result.e
         raise TApplicationException(TApplicationException.MISSING_RESULT, "check_table_consistency failed: unknown result")
 
-    def start_query(self, leaf_session, parent_session, query_ra, just_explain, outer_fragment_indices):
+    def start_query(self, leaf_session, parent_session, query_ra, start_time_str, just_explain, outer_fragment_indices):
         """
         Parameters:
          - leaf_session
          - parent_session
          - query_ra
+         - start_time_str
          - just_explain
          - outer_fragment_indices
 
         """
-        self.send_start_query(leaf_session, parent_session, query_ra, just_explain, outer_fragment_indices)
+        self.send_start_query(leaf_session, parent_session, query_ra, start_time_str, just_explain, outer_fragment_indices)
         return self.recv_start_query()
 
-    def send_start_query(self, leaf_session, parent_session, query_ra, just_explain, outer_fragment_indices):
+    def send_start_query(self, leaf_session, parent_session, query_ra, start_time_str, just_explain, outer_fragment_indices):
         self._oprot.writeMessageBegin('start_query', TMessageType.CALL, self._seqid)
         args = start_query_args()
         args.leaf_session = leaf_session
         args.parent_session = parent_session
         args.query_ra = query_ra
+        args.start_time_str = start_time_str
         args.just_explain = just_explain
         args.outer_fragment_indices = outer_fragment_indices
         args.write(self._oprot)
@@ -3330,21 +4094,23 @@ class Client(Iface):
             raise result.e
         raise TApplicationException(TApplicationException.MISSING_RESULT, "start_query failed: unknown result")
 
-    def execute_query_step(self, pending_query, subquery_id):
+    def execute_query_step(self, pending_query, subquery_id, start_time_str):
         """
         Parameters:
          - pending_query
          - subquery_id
+         - start_time_str
 
         """
-        self.send_execute_query_step(pending_query, subquery_id)
+        self.send_execute_query_step(pending_query, subquery_id, start_time_str)
         return self.recv_execute_query_step()
 
-    def send_execute_query_step(self, pending_query, subquery_id):
+    def send_execute_query_step(self, pending_query, subquery_id, start_time_str):
         self._oprot.writeMessageBegin('execute_query_step', TMessageType.CALL, self._seqid)
         args = execute_query_step_args()
         args.pending_query = pending_query
         args.subquery_id = subquery_id
+        args.start_time_str = start_time_str
         args.write(self._oprot)
         self._oprot.writeMessageEnd()
         self._oprot.trans.flush()
@@ -3934,11 +4700,14 @@ class Processor(Iface, TProcessor):
         self._processMap["get_status"] = Processor.process_get_status
         self._processMap["get_hardware_info"] = Processor.process_get_hardware_info
         self._processMap["get_tables"] = Processor.process_get_tables
+        self._processMap["get_tables_for_database"] = Processor.process_get_tables_for_database
         self._processMap["get_physical_tables"] = Processor.process_get_physical_tables
         self._processMap["get_views"] = Processor.process_get_views
         self._processMap["get_tables_meta"] = Processor.process_get_tables_meta
         self._processMap["get_table_details"] = Processor.process_get_table_details
+        self._processMap["get_table_details_for_database"] = Processor.process_get_table_details_for_database
         self._processMap["get_internal_table_details"] = Processor.process_get_internal_table_details
+        self._processMap["get_internal_table_details_for_database"] = Processor.process_get_internal_table_details_for_database
         self._processMap["get_users"] = Processor.process_get_users
         self._processMap["get_databases"] = Processor.process_get_databases
         self._processMap["get_version"] = Processor.process_get_version
@@ -3948,6 +4717,8 @@ class Processor(Iface, TProcessor):
         self._processMap["get_memory"] = Processor.process_get_memory
         self._processMap["clear_cpu_memory"] = Processor.process_clear_cpu_memory
         self._processMap["clear_gpu_memory"] = Processor.process_clear_gpu_memory
+        self._processMap["set_cur_session"] = Processor.process_set_cur_session
+        self._processMap["invalidate_cur_session"] = Processor.process_invalidate_cur_session
         self._processMap["set_table_epoch"] = Processor.process_set_table_epoch
         self._processMap["set_table_epoch_by_name"] = Processor.process_set_table_epoch_by_name
         self._processMap["get_table_epoch"] = Processor.process_get_table_epoch
@@ -3956,15 +4727,25 @@ class Processor(Iface, TProcessor):
         self._processMap["set_table_epochs"] = Processor.process_set_table_epochs
         self._processMap["get_session_info"] = Processor.process_get_session_info
         self._processMap["sql_execute"] = Processor.process_sql_execute
+        self._processMap["prepare_statement"] = Processor.process_prepare_statement
+        self._processMap["sql_execute_prepared"] = Processor.process_sql_execute_prepared
+        self._processMap["close_prepared_statement"] = Processor.process_close_prepared_statement
         self._processMap["sql_execute_df"] = Processor.process_sql_execute_df
         self._processMap["sql_execute_gdf"] = Processor.process_sql_execute_gdf
         self._processMap["deallocate_df"] = Processor.process_deallocate_df
+        self._processMap["sql_execute_df_cursor"] = Processor.process_sql_execute_df_cursor
+        self._processMap["fetch_df_batch"] = Processor.process_fetch_df_batch
+        self._processMap["close_df_cursor"] = Processor.process_close_df_cursor
         self._processMap["interrupt"] = Processor.process_interrupt
         self._processMap["sql_validate"] = Processor.process_sql_validate
         self._processMap["get_completion_hints"] = Processor.process_get_completion_hints
         self._processMap["set_execution_mode"] = Processor.process_set_execution_mode
         self._processMap["render_vega"] = Processor.process_render_vega
         self._processMap["get_result_row_for_pixel"] = Processor.process_get_result_row_for_pixel
+        self._processMap["create_custom_expression"] = Processor.process_create_custom_expression
+        self._processMap["get_custom_expressions"] = Processor.process_get_custom_expressions
+        self._processMap["update_custom_expression"] = Processor.process_update_custom_expression
+        self._processMap["delete_custom_expressions"] = Processor.process_delete_custom_expressions
         self._processMap["get_dashboard"] = Processor.process_get_dashboard
         self._processMap["get_dashboards"] = Processor.process_get_dashboards
         self._processMap["create_dashboard"] = Processor.process_create_dashboard
@@ -3980,6 +4761,7 @@ class Processor(Iface, TProcessor):
         self._processMap["create_link"] = Processor.process_create_link
         self._processMap["load_table_binary"] = Processor.process_load_table_binary
         self._processMap["load_table_binary_columnar"] = Processor.process_load_table_binary_columnar
+        self._processMap["load_table_binary_columnar_polys"] = Processor.process_load_table_binary_columnar_polys
         self._processMap["load_table_binary_arrow"] = Processor.process_load_table_binary_arrow
         self._processMap["load_table"] = Processor.process_load_table
         self._processMap["detect_column_types"] = Processor.process_detect_column_types
@@ -4265,6 +5047,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_get_tables_for_database(self, seqid, iprot, oprot):
+        args = get_tables_for_database_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = get_tables_for_database_result()
+        try:
+            result.success = self._handler.get_tables_for_database(args.session, args.database_name)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("get_tables_for_database", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_get_physical_tables(self, seqid, iprot, oprot):
         args = get_physical_tables_args()
         args.read(iprot)
@@ -4369,6 +5177,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_get_table_details_for_database(self, seqid, iprot, oprot):
+        args = get_table_details_for_database_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = get_table_details_for_database_result()
+        try:
+            result.success = self._handler.get_table_details_for_database(args.session, args.table_name, args.database_name)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("get_table_details_for_database", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_get_internal_table_details(self, seqid, iprot, oprot):
         args = get_internal_table_details_args()
         args.read(iprot)
@@ -4395,6 +5229,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_get_internal_table_details_for_database(self, seqid, iprot, oprot):
+        args = get_internal_table_details_for_database_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = get_internal_table_details_for_database_result()
+        try:
+            result.success = self._handler.get_internal_table_details_for_database(args.session, args.table_name, args.database_name)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("get_internal_table_details_for_database", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_get_users(self, seqid, iprot, oprot):
         args = get_users_args()
         args.read(iprot)
@@ -4629,6 +5489,58 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_set_cur_session(self, seqid, iprot, oprot):
+        args = set_cur_session_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = set_cur_session_result()
+        try:
+            self._handler.set_cur_session(args.parent_session, args.leaf_session, args.start_time_str, args.label)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("set_cur_session", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_invalidate_cur_session(self, seqid, iprot, oprot):
+        args = invalidate_cur_session_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = invalidate_cur_session_result()
+        try:
+            self._handler.invalidate_cur_session(args.parent_session, args.leaf_session, args.start_time_str, args.label)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("invalidate_cur_session", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_set_table_epoch(self, seqid, iprot, oprot):
         args = set_table_epoch_args()
         args.read(iprot)
@@ -4825,13 +5737,13 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
-    def process_sql_execute_df(self, seqid, iprot, oprot):
-        args = sql_execute_df_args()
+    def process_prepare_statement(self, seqid, iprot, oprot):
+        args = prepare_statement_args()
         args.read(iprot)
         iprot.readMessageEnd()
-        result = sql_execute_df_result()
+        result = prepare_statement_result()
         try:
-            result.success = self._handler.sql_execute_df(args.session, args.query, args.device_type, args.device_id, args.first_n, args.transport_method)
+            result.success = self._handler.prepare_statement(args.session, args.query)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -4846,18 +5758,96 @@ class Processor(Iface, TProcessor):
             logging.exception('Unexpected exception in handler')
             msg_type = TMessageType.EXCEPTION
             result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
-        oprot.writeMessageBegin("sql_execute_df", msg_type, seqid)
+        oprot.writeMessageBegin("prepare_statement", msg_type, seqid)
         result.write(oprot)
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
-    def process_sql_execute_gdf(self, seqid, iprot, oprot):
-        args = sql_execute_gdf_args()
+    def process_sql_execute_prepared(self, seqid, iprot, oprot):
+        args = sql_execute_prepared_args()
         args.read(iprot)
         iprot.readMessageEnd()
-        result = sql_execute_gdf_result()
+        result = sql_execute_prepared_result()
         try:
-            result.success = self._handler.sql_execute_gdf(args.session, args.query, args.device_id, args.first_n)
+            result.success = self._handler.sql_execute_prepared(args.session, args.statement_id, args.parameters, args.column_format, args.nonce, args.first_n, args.at_most_n)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("sql_execute_prepared", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_close_prepared_statement(self, seqid, iprot, oprot):
+        args = close_prepared_statement_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = close_prepared_statement_result()
+        try:
+            self._handler.close_prepared_statement(args.session, args.statement_id)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("close_prepared_statement", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_sql_execute_df(self, seqid, iprot, oprot):
+        args = sql_execute_df_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = sql_execute_df_result()
+        try:
+            result.success = self._handler.sql_execute_df(args.session, args.query, args.device_type, args.device_id, args.first_n, args.transport_method)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("sql_execute_df", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_sql_execute_gdf(self, seqid, iprot, oprot):
+        args = sql_execute_gdf_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = sql_execute_gdf_result()
+        try:
+            result.success = self._handler.sql_execute_gdf(args.session, args.query, args.device_id, args.first_n)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -4903,6 +5893,84 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_sql_execute_df_cursor(self, seqid, iprot, oprot):
+        args = sql_execute_df_cursor_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = sql_execute_df_cursor_result()
+        try:
+            result.success = self._handler.sql_execute_df_cursor(args.session, args.query, args.first_n, args.max_batch_rows, args.transport_method)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("sql_execute_df_cursor", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_fetch_df_batch(self, seqid, iprot, oprot):
+        args = fetch_df_batch_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = fetch_df_batch_result()
+        try:
+            result.success = self._handler.fetch_df_batch(args.session, args.cursor_id)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("fetch_df_batch", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_close_df_cursor(self, seqid, iprot, oprot):
+        args = close_df_cursor_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = close_df_cursor_result()
+        try:
+            self._handler.close_df_cursor(args.session, args.cursor_id)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("close_df_cursor", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_interrupt(self, seqid, iprot, oprot):
         args = interrupt_args()
         args.read(iprot)
@@ -5059,6 +6127,110 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_create_custom_expression(self, seqid, iprot, oprot):
+        args = create_custom_expression_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = create_custom_expression_result()
+        try:
+            result.success = self._handler.create_custom_expression(args.session, args.custom_expression)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("create_custom_expression", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_get_custom_expressions(self, seqid, iprot, oprot):
+        args = get_custom_expressions_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = get_custom_expressions_result()
+        try:
+            result.success = self._handler.get_custom_expressions(args.session)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("get_custom_expressions", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_update_custom_expression(self, seqid, iprot, oprot):
+        args = update_custom_expression_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = update_custom_expression_result()
+        try:
+            self._handler.update_custom_expression(args.session, args.id, args.expression_json)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("update_custom_expression", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
+    def process_delete_custom_expressions(self, seqid, iprot, oprot):
+        args = delete_custom_expressions_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = delete_custom_expressions_result()
+        try:
+            self._handler.delete_custom_expressions(args.session, args.custom_expression_ids, args.do_soft_delete)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("delete_custom_expressions", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_get_dashboard(self, seqid, iprot, oprot):
         args = get_dashboard_args()
         args.read(iprot)
@@ -5449,6 +6621,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_load_table_binary_columnar_polys(self, seqid, iprot, oprot):
+        args = load_table_binary_columnar_polys_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = load_table_binary_columnar_polys_result()
+        try:
+            self._handler.load_table_binary_columnar_polys(args.session, args.table_name, args.cols, args.column_names, args.assign_render_groups)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TOmniSciException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("load_table_binary_columnar_polys", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_load_table_binary_arrow(self, seqid, iprot, oprot):
         args = load_table_binary_arrow_args()
         args.read(iprot)
@@ -5767,7 +6965,7 @@ class Processor(Iface, TProcessor):
         iprot.readMessageEnd()
         result = start_query_result()
         try:
-            result.success = self._handler.start_query(args.leaf_session, args.parent_session, args.query_ra, args.just_explain, args.outer_fragment_indices)
+            result.success = self._handler.start_query(args.leaf_session, args.parent_session, args.query_ra, args.start_time_str, args.just_explain, args.outer_fragment_indices)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -5793,7 +6991,7 @@ class Processor(Iface, TProcessor):
         iprot.readMessageEnd()
         result = execute_query_step_result()
         try:
-            result.success = self._handler.execute_query_step(args.pending_query, args.subquery_id)
+            result.success = self._handler.execute_query_step(args.pending_query, args.subquery_id, args.start_time_str)
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
@@ -7137,11 +8335,11 @@ class get_status_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype258, _size255) = iprot.readListBegin()
-                    for _i259 in range(_size255):
-                        _elem260 = TServerStatus()
-                        _elem260.read(iprot)
-                        self.success.append(_elem260)
+                    (_etype286, _size283) = iprot.readListBegin()
+                    for _i287 in range(_size283):
+                        _elem288 = TServerStatus()
+                        _elem288.read(iprot)
+                        self.success.append(_elem288)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7164,8 +8362,8 @@ class get_status_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter261 in self.success:
-                iter261.write(oprot)
+            for iter289 in self.success:
+                iter289.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -7419,10 +8617,10 @@ class get_tables_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype265, _size262) = iprot.readListBegin()
-                    for _i266 in range(_size262):
-                        _elem267 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem267)
+                    (_etype293, _size290) = iprot.readListBegin()
+                    for _i294 in range(_size290):
+                        _elem295 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem295)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7445,8 +8643,8 @@ class get_tables_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter268 in self.success:
-                oprot.writeString(iter268.encode('utf-8') if sys.version_info[0] == 2 else iter268)
+            for iter296 in self.success:
+                oprot.writeString(iter296.encode('utf-8') if sys.version_info[0] == 2 else iter296)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -7476,16 +8674,18 @@ get_tables_result.thrift_spec = (
 )
 
 
-class get_physical_tables_args(object):
+class get_tables_for_database_args(object):
     """
     Attributes:
      - session
+     - database_name
 
     """
 
 
-    def __init__(self, session=None,):
+    def __init__(self, session=None, database_name=None,):
         self.session = session
+        self.database_name = database_name
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -7501,8 +8701,162 @@ class get_physical_tables_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
-            else:
-                iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.database_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('get_tables_for_database_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.database_name is not None:
+            oprot.writeFieldBegin('database_name', TType.STRING, 2)
+            oprot.writeString(self.database_name.encode('utf-8') if sys.version_info[0] == 2 else self.database_name)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(get_tables_for_database_args)
+get_tables_for_database_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'database_name', 'UTF8', None, ),  # 2
+)
+
+
+class get_tables_for_database_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype300, _size297) = iprot.readListBegin()
+                    for _i301 in range(_size297):
+                        _elem302 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem302)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('get_tables_for_database_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRING, len(self.success))
+            for iter303 in self.success:
+                oprot.writeString(iter303.encode('utf-8') if sys.version_info[0] == 2 else iter303)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(get_tables_for_database_result)
+get_tables_for_database_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRING, 'UTF8', False), None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class get_physical_tables_args(object):
+    """
+    Attributes:
+     - session
+
+    """
+
+
+    def __init__(self, session=None,):
+        self.session = session
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
             iprot.readFieldEnd()
         iprot.readStructEnd()
 
@@ -7563,10 +8917,10 @@ class get_physical_tables_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype272, _size269) = iprot.readListBegin()
-                    for _i273 in range(_size269):
-                        _elem274 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem274)
+                    (_etype307, _size304) = iprot.readListBegin()
+                    for _i308 in range(_size304):
+                        _elem309 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem309)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7589,8 +8943,8 @@ class get_physical_tables_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter275 in self.success:
-                oprot.writeString(iter275.encode('utf-8') if sys.version_info[0] == 2 else iter275)
+            for iter310 in self.success:
+                oprot.writeString(iter310.encode('utf-8') if sys.version_info[0] == 2 else iter310)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -7707,10 +9061,10 @@ class get_views_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype279, _size276) = iprot.readListBegin()
-                    for _i280 in range(_size276):
-                        _elem281 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem281)
+                    (_etype314, _size311) = iprot.readListBegin()
+                    for _i315 in range(_size311):
+                        _elem316 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem316)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7733,8 +9087,8 @@ class get_views_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter282 in self.success:
-                oprot.writeString(iter282.encode('utf-8') if sys.version_info[0] == 2 else iter282)
+            for iter317 in self.success:
+                oprot.writeString(iter317.encode('utf-8') if sys.version_info[0] == 2 else iter317)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -7851,11 +9205,11 @@ class get_tables_meta_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype286, _size283) = iprot.readListBegin()
-                    for _i287 in range(_size283):
-                        _elem288 = TTableMeta()
-                        _elem288.read(iprot)
-                        self.success.append(_elem288)
+                    (_etype321, _size318) = iprot.readListBegin()
+                    for _i322 in range(_size318):
+                        _elem323 = TTableMeta()
+                        _elem323.read(iprot)
+                        self.success.append(_elem323)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7878,8 +9232,8 @@ class get_tables_meta_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter289 in self.success:
-                iter289.write(oprot)
+            for iter324 in self.success:
+                iter324.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -8058,18 +9412,20 @@ get_table_details_result.thrift_spec = (
 )
 
 
-class get_internal_table_details_args(object):
+class get_table_details_for_database_args(object):
     """
     Attributes:
      - session
      - table_name
+     - database_name
 
     """
 
 
-    def __init__(self, session=None, table_name=None,):
+    def __init__(self, session=None, table_name=None, database_name=None,):
         self.session = session
         self.table_name = table_name
+        self.database_name = database_name
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -8090,6 +9446,11 @@ class get_internal_table_details_args(object):
                     self.table_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.database_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -8099,7 +9460,7 @@ class get_internal_table_details_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_internal_table_details_args')
+        oprot.writeStructBegin('get_table_details_for_database_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
@@ -8108,6 +9469,10 @@ class get_internal_table_details_args(object):
             oprot.writeFieldBegin('table_name', TType.STRING, 2)
             oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
             oprot.writeFieldEnd()
+        if self.database_name is not None:
+            oprot.writeFieldBegin('database_name', TType.STRING, 3)
+            oprot.writeString(self.database_name.encode('utf-8') if sys.version_info[0] == 2 else self.database_name)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -8124,15 +9489,16 @@ class get_internal_table_details_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_internal_table_details_args)
-get_internal_table_details_args.thrift_spec = (
+all_structs.append(get_table_details_for_database_args)
+get_table_details_for_database_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
     (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+    (3, TType.STRING, 'database_name', 'UTF8', None, ),  # 3
 )
 
 
-class get_internal_table_details_result(object):
+class get_table_details_for_database_result(object):
     """
     Attributes:
      - success
@@ -8175,7 +9541,7 @@ class get_internal_table_details_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_internal_table_details_result')
+        oprot.writeStructBegin('get_table_details_for_database_result')
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.STRUCT, 0)
             self.success.write(oprot)
@@ -8200,23 +9566,25 @@ class get_internal_table_details_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_internal_table_details_result)
-get_internal_table_details_result.thrift_spec = (
+all_structs.append(get_table_details_for_database_result)
+get_table_details_for_database_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TTableDetails, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_users_args(object):
+class get_internal_table_details_args(object):
     """
     Attributes:
      - session
+     - table_name
 
     """
 
 
-    def __init__(self, session=None,):
+    def __init__(self, session=None, table_name=None,):
         self.session = session
+        self.table_name = table_name
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -8232,6 +9600,11 @@ class get_users_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.table_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -8241,11 +9614,15 @@ class get_users_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_users_args')
+        oprot.writeStructBegin('get_internal_table_details_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
+        if self.table_name is not None:
+            oprot.writeFieldBegin('table_name', TType.STRING, 2)
+            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -8262,14 +9639,15 @@ class get_users_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_users_args)
-get_users_args.thrift_spec = (
+all_structs.append(get_internal_table_details_args)
+get_internal_table_details_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
 )
 
 
-class get_users_result(object):
+class get_internal_table_details_result(object):
     """
     Attributes:
      - success
@@ -8292,13 +9670,9 @@ class get_users_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.LIST:
-                    self.success = []
-                    (_etype293, _size290) = iprot.readListBegin()
-                    for _i294 in range(_size290):
-                        _elem295 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem295)
-                    iprot.readListEnd()
+                if ftype == TType.STRUCT:
+                    self.success = TTableDetails()
+                    self.success.read(iprot)
                 else:
                     iprot.skip(ftype)
             elif fid == 1:
@@ -8316,13 +9690,10 @@ class get_users_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_users_result')
+        oprot.writeStructBegin('get_internal_table_details_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter296 in self.success:
-                oprot.writeString(iter296.encode('utf-8') if sys.version_info[0] == 2 else iter296)
-            oprot.writeListEnd()
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
@@ -8344,23 +9715,27 @@ class get_users_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_users_result)
-get_users_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.STRING, 'UTF8', False), None, ),  # 0
+all_structs.append(get_internal_table_details_result)
+get_internal_table_details_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TTableDetails, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_databases_args(object):
+class get_internal_table_details_for_database_args(object):
     """
     Attributes:
      - session
+     - table_name
+     - database_name
 
     """
 
 
-    def __init__(self, session=None,):
+    def __init__(self, session=None, table_name=None, database_name=None,):
         self.session = session
+        self.table_name = table_name
+        self.database_name = database_name
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -8376,6 +9751,16 @@ class get_databases_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.table_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.database_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -8385,11 +9770,19 @@ class get_databases_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_databases_args')
+        oprot.writeStructBegin('get_internal_table_details_for_database_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
+        if self.table_name is not None:
+            oprot.writeFieldBegin('table_name', TType.STRING, 2)
+            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
+            oprot.writeFieldEnd()
+        if self.database_name is not None:
+            oprot.writeFieldBegin('database_name', TType.STRING, 3)
+            oprot.writeString(self.database_name.encode('utf-8') if sys.version_info[0] == 2 else self.database_name)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -8406,14 +9799,16 @@ class get_databases_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_databases_args)
-get_databases_args.thrift_spec = (
+all_structs.append(get_internal_table_details_for_database_args)
+get_internal_table_details_for_database_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+    (3, TType.STRING, 'database_name', 'UTF8', None, ),  # 3
 )
 
 
-class get_databases_result(object):
+class get_internal_table_details_for_database_result(object):
     """
     Attributes:
      - success
@@ -8436,14 +9831,9 @@ class get_databases_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.LIST:
-                    self.success = []
-                    (_etype300, _size297) = iprot.readListBegin()
-                    for _i301 in range(_size297):
-                        _elem302 = TDBInfo()
-                        _elem302.read(iprot)
-                        self.success.append(_elem302)
-                    iprot.readListEnd()
+                if ftype == TType.STRUCT:
+                    self.success = TTableDetails()
+                    self.success.read(iprot)
                 else:
                     iprot.skip(ftype)
             elif fid == 1:
@@ -8461,13 +9851,10 @@ class get_databases_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_databases_result')
+        oprot.writeStructBegin('get_internal_table_details_for_database_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter303 in self.success:
-                iter303.write(oprot)
-            oprot.writeListEnd()
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
@@ -8489,15 +9876,23 @@ class get_databases_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_databases_result)
-get_databases_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.STRUCT, [TDBInfo, None], False), None, ),  # 0
+all_structs.append(get_internal_table_details_for_database_result)
+get_internal_table_details_for_database_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TTableDetails, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_version_args(object):
+class get_users_args(object):
+    """
+    Attributes:
+     - session
+
+    """
+
 
+    def __init__(self, session=None,):
+        self.session = session
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -8508,6 +9903,11 @@ class get_version_args(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -8517,7 +9917,11 @@ class get_version_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_version_args')
+        oprot.writeStructBegin('get_users_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -8534,12 +9938,14 @@ class get_version_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_version_args)
-get_version_args.thrift_spec = (
+all_structs.append(get_users_args)
+get_users_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
 )
 
 
-class get_version_result(object):
+class get_users_result(object):
     """
     Attributes:
      - success
@@ -8562,8 +9968,13 @@ class get_version_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.STRING:
-                    self.success = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype328, _size325) = iprot.readListBegin()
+                    for _i329 in range(_size325):
+                        _elem330 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem330)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 1:
@@ -8581,10 +9992,13 @@ class get_version_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_version_result')
+        oprot.writeStructBegin('get_users_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRING, 0)
-            oprot.writeString(self.success.encode('utf-8') if sys.version_info[0] == 2 else self.success)
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRING, len(self.success))
+            for iter331 in self.success:
+                oprot.writeString(iter331.encode('utf-8') if sys.version_info[0] == 2 else iter331)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
@@ -8606,14 +10020,14 @@ class get_version_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_version_result)
-get_version_result.thrift_spec = (
-    (0, TType.STRING, 'success', 'UTF8', None, ),  # 0
+all_structs.append(get_users_result)
+get_users_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRING, 'UTF8', False), None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class start_heap_profile_args(object):
+class get_databases_args(object):
     """
     Attributes:
      - session
@@ -8647,7 +10061,7 @@ class start_heap_profile_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('start_heap_profile_args')
+        oprot.writeStructBegin('get_databases_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
@@ -8668,22 +10082,24 @@ class start_heap_profile_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(start_heap_profile_args)
-start_heap_profile_args.thrift_spec = (
+all_structs.append(get_databases_args)
+get_databases_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
 )
 
 
-class start_heap_profile_result(object):
+class get_databases_result(object):
     """
     Attributes:
+     - success
      - e
 
     """
 
 
-    def __init__(self, e=None,):
+    def __init__(self, success=None, e=None,):
+        self.success = success
         self.e = e
 
     def read(self, iprot):
@@ -8695,7 +10111,18 @@ class start_heap_profile_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype335, _size332) = iprot.readListBegin()
+                    for _i336 in range(_size332):
+                        _elem337 = TDBInfo()
+                        _elem337.read(iprot)
+                        self.success.append(_elem337)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -8710,7 +10137,14 @@ class start_heap_profile_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('start_heap_profile_result')
+        oprot.writeStructBegin('get_databases_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter338 in self.success:
+                iter338.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -8731,23 +10165,15 @@ class start_heap_profile_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(start_heap_profile_result)
-start_heap_profile_result.thrift_spec = (
-    None,  # 0
+all_structs.append(get_databases_result)
+get_databases_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRUCT, [TDBInfo, None], False), None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class stop_heap_profile_args(object):
-    """
-    Attributes:
-     - session
-
-    """
-
+class get_version_args(object):
 
-    def __init__(self, session=None,):
-        self.session = session
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -8758,11 +10184,6 @@ class stop_heap_profile_args(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
-                if ftype == TType.STRING:
-                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -8772,11 +10193,7 @@ class stop_heap_profile_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('stop_heap_profile_args')
-        if self.session is not None:
-            oprot.writeFieldBegin('session', TType.STRING, 1)
-            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
-            oprot.writeFieldEnd()
+        oprot.writeStructBegin('get_version_args')
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -8793,22 +10210,22 @@ class stop_heap_profile_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(stop_heap_profile_args)
-stop_heap_profile_args.thrift_spec = (
-    None,  # 0
-    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+all_structs.append(get_version_args)
+get_version_args.thrift_spec = (
 )
 
 
-class stop_heap_profile_result(object):
+class get_version_result(object):
     """
     Attributes:
+     - success
      - e
 
     """
 
 
-    def __init__(self, e=None,):
+    def __init__(self, success=None, e=None,):
+        self.success = success
         self.e = e
 
     def read(self, iprot):
@@ -8820,7 +10237,12 @@ class stop_heap_profile_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.STRING:
+                    self.success = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -8835,7 +10257,11 @@ class stop_heap_profile_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('stop_heap_profile_result')
+        oprot.writeStructBegin('get_version_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRING, 0)
+            oprot.writeString(self.success.encode('utf-8') if sys.version_info[0] == 2 else self.success)
+            oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -8856,14 +10282,14 @@ class stop_heap_profile_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(stop_heap_profile_result)
-stop_heap_profile_result.thrift_spec = (
-    None,  # 0
+all_structs.append(get_version_result)
+get_version_result.thrift_spec = (
+    (0, TType.STRING, 'success', 'UTF8', None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_heap_profile_args(object):
+class start_heap_profile_args(object):
     """
     Attributes:
      - session
@@ -8897,7 +10323,7 @@ class get_heap_profile_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_heap_profile_args')
+        oprot.writeStructBegin('start_heap_profile_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
@@ -8918,24 +10344,22 @@ class get_heap_profile_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_heap_profile_args)
-get_heap_profile_args.thrift_spec = (
+all_structs.append(start_heap_profile_args)
+start_heap_profile_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
 )
 
 
-class get_heap_profile_result(object):
+class start_heap_profile_result(object):
     """
     Attributes:
-     - success
      - e
 
     """
 
 
-    def __init__(self, success=None, e=None,):
-        self.success = success
+    def __init__(self, e=None,):
         self.e = e
 
     def read(self, iprot):
@@ -8947,12 +10371,7 @@ class get_heap_profile_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.STRING:
-                    self.success = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 1:
+            if fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -8967,11 +10386,7 @@ class get_heap_profile_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_heap_profile_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRING, 0)
-            oprot.writeString(self.success.encode('utf-8') if sys.version_info[0] == 2 else self.success)
-            oprot.writeFieldEnd()
+        oprot.writeStructBegin('start_heap_profile_result')
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -8992,25 +10407,23 @@ class get_heap_profile_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_heap_profile_result)
-get_heap_profile_result.thrift_spec = (
-    (0, TType.STRING, 'success', 'UTF8', None, ),  # 0
+all_structs.append(start_heap_profile_result)
+start_heap_profile_result.thrift_spec = (
+    None,  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_memory_args(object):
+class stop_heap_profile_args(object):
     """
     Attributes:
      - session
-     - memory_level
 
     """
 
 
-    def __init__(self, session=None, memory_level=None,):
+    def __init__(self, session=None,):
         self.session = session
-        self.memory_level = memory_level
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -9026,11 +10439,6 @@ class get_memory_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
-            elif fid == 2:
-                if ftype == TType.STRING:
-                    self.memory_level = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -9040,15 +10448,11 @@ class get_memory_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_memory_args')
+        oprot.writeStructBegin('stop_heap_profile_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.memory_level is not None:
-            oprot.writeFieldBegin('memory_level', TType.STRING, 2)
-            oprot.writeString(self.memory_level.encode('utf-8') if sys.version_info[0] == 2 else self.memory_level)
-            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -9065,25 +10469,22 @@ class get_memory_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_memory_args)
-get_memory_args.thrift_spec = (
+all_structs.append(stop_heap_profile_args)
+stop_heap_profile_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.STRING, 'memory_level', 'UTF8', None, ),  # 2
 )
 
 
-class get_memory_result(object):
+class stop_heap_profile_result(object):
     """
     Attributes:
-     - success
      - e
 
     """
 
 
-    def __init__(self, success=None, e=None,):
-        self.success = success
+    def __init__(self, e=None,):
         self.e = e
 
     def read(self, iprot):
@@ -9095,18 +10496,7 @@ class get_memory_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.LIST:
-                    self.success = []
-                    (_etype307, _size304) = iprot.readListBegin()
-                    for _i308 in range(_size304):
-                        _elem309 = TNodeMemoryInfo()
-                        _elem309.read(iprot)
-                        self.success.append(_elem309)
-                    iprot.readListEnd()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 1:
+            if fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -9121,14 +10511,7 @@ class get_memory_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_memory_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter310 in self.success:
-                iter310.write(oprot)
-            oprot.writeListEnd()
-            oprot.writeFieldEnd()
+        oprot.writeStructBegin('stop_heap_profile_result')
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -9149,14 +10532,14 @@ class get_memory_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_memory_result)
-get_memory_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.STRUCT, [TNodeMemoryInfo, None], False), None, ),  # 0
+all_structs.append(stop_heap_profile_result)
+stop_heap_profile_result.thrift_spec = (
+    None,  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class clear_cpu_memory_args(object):
+class get_heap_profile_args(object):
     """
     Attributes:
      - session
@@ -9190,7 +10573,7 @@ class clear_cpu_memory_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('clear_cpu_memory_args')
+        oprot.writeStructBegin('get_heap_profile_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
@@ -9211,22 +10594,24 @@ class clear_cpu_memory_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(clear_cpu_memory_args)
-clear_cpu_memory_args.thrift_spec = (
+all_structs.append(get_heap_profile_args)
+get_heap_profile_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
 )
 
 
-class clear_cpu_memory_result(object):
+class get_heap_profile_result(object):
     """
     Attributes:
+     - success
      - e
 
     """
 
 
-    def __init__(self, e=None,):
+    def __init__(self, success=None, e=None,):
+        self.success = success
         self.e = e
 
     def read(self, iprot):
@@ -9238,8 +10623,13 @@ class clear_cpu_memory_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
-                if ftype == TType.STRUCT:
+            if fid == 0:
+                if ftype == TType.STRING:
+                    self.success = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
                 else:
@@ -9253,7 +10643,11 @@ class clear_cpu_memory_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('clear_cpu_memory_result')
+        oprot.writeStructBegin('get_heap_profile_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRING, 0)
+            oprot.writeString(self.success.encode('utf-8') if sys.version_info[0] == 2 else self.success)
+            oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -9274,23 +10668,25 @@ class clear_cpu_memory_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(clear_cpu_memory_result)
-clear_cpu_memory_result.thrift_spec = (
-    None,  # 0
+all_structs.append(get_heap_profile_result)
+get_heap_profile_result.thrift_spec = (
+    (0, TType.STRING, 'success', 'UTF8', None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class clear_gpu_memory_args(object):
+class get_memory_args(object):
     """
     Attributes:
      - session
+     - memory_level
 
     """
 
 
-    def __init__(self, session=None,):
+    def __init__(self, session=None, memory_level=None,):
         self.session = session
+        self.memory_level = memory_level
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -9306,6 +10702,11 @@ class clear_gpu_memory_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.memory_level = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -9315,11 +10716,15 @@ class clear_gpu_memory_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('clear_gpu_memory_args')
+        oprot.writeStructBegin('get_memory_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
+        if self.memory_level is not None:
+            oprot.writeFieldBegin('memory_level', TType.STRING, 2)
+            oprot.writeString(self.memory_level.encode('utf-8') if sys.version_info[0] == 2 else self.memory_level)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -9336,22 +10741,25 @@ class clear_gpu_memory_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(clear_gpu_memory_args)
-clear_gpu_memory_args.thrift_spec = (
+all_structs.append(get_memory_args)
+get_memory_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'memory_level', 'UTF8', None, ),  # 2
 )
 
 
-class clear_gpu_memory_result(object):
+class get_memory_result(object):
     """
     Attributes:
+     - success
      - e
 
     """
 
 
-    def __init__(self, e=None,):
+    def __init__(self, success=None, e=None,):
+        self.success = success
         self.e = e
 
     def read(self, iprot):
@@ -9363,7 +10771,18 @@ class clear_gpu_memory_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype342, _size339) = iprot.readListBegin()
+                    for _i343 in range(_size339):
+                        _elem344 = TNodeMemoryInfo()
+                        _elem344.read(iprot)
+                        self.success.append(_elem344)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -9378,7 +10797,14 @@ class clear_gpu_memory_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('clear_gpu_memory_result')
+        oprot.writeStructBegin('get_memory_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter345 in self.success:
+                iter345.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -9399,29 +10825,23 @@ class clear_gpu_memory_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(clear_gpu_memory_result)
-clear_gpu_memory_result.thrift_spec = (
-    None,  # 0
+all_structs.append(get_memory_result)
+get_memory_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRUCT, [TNodeMemoryInfo, None], False), None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class set_table_epoch_args(object):
+class clear_cpu_memory_args(object):
     """
     Attributes:
      - session
-     - db_id
-     - table_id
-     - new_epoch
 
     """
 
 
-    def __init__(self, session=None, db_id=None, table_id=None, new_epoch=None,):
+    def __init__(self, session=None,):
         self.session = session
-        self.db_id = db_id
-        self.table_id = table_id
-        self.new_epoch = new_epoch
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -9437,21 +10857,6 @@ class set_table_epoch_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
-            elif fid == 2:
-                if ftype == TType.I32:
-                    self.db_id = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 3:
-                if ftype == TType.I32:
-                    self.table_id = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
-                if ftype == TType.I32:
-                    self.new_epoch = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -9461,23 +10866,11 @@ class set_table_epoch_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('set_table_epoch_args')
+        oprot.writeStructBegin('clear_cpu_memory_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.db_id is not None:
-            oprot.writeFieldBegin('db_id', TType.I32, 2)
-            oprot.writeI32(self.db_id)
-            oprot.writeFieldEnd()
-        if self.table_id is not None:
-            oprot.writeFieldBegin('table_id', TType.I32, 3)
-            oprot.writeI32(self.table_id)
-            oprot.writeFieldEnd()
-        if self.new_epoch is not None:
-            oprot.writeFieldBegin('new_epoch', TType.I32, 4)
-            oprot.writeI32(self.new_epoch)
-            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -9494,17 +10887,14 @@ class set_table_epoch_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(set_table_epoch_args)
-set_table_epoch_args.thrift_spec = (
+all_structs.append(clear_cpu_memory_args)
+clear_cpu_memory_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.I32, 'db_id', None, None, ),  # 2
-    (3, TType.I32, 'table_id', None, None, ),  # 3
-    (4, TType.I32, 'new_epoch', None, None, ),  # 4
 )
 
 
-class set_table_epoch_result(object):
+class clear_cpu_memory_result(object):
     """
     Attributes:
      - e
@@ -9539,7 +10929,7 @@ class set_table_epoch_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('set_table_epoch_result')
+        oprot.writeStructBegin('clear_cpu_memory_result')
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -9560,27 +10950,23 @@ class set_table_epoch_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(set_table_epoch_result)
-set_table_epoch_result.thrift_spec = (
+all_structs.append(clear_cpu_memory_result)
+clear_cpu_memory_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class set_table_epoch_by_name_args(object):
+class clear_gpu_memory_args(object):
     """
     Attributes:
      - session
-     - table_name
-     - new_epoch
 
     """
 
 
-    def __init__(self, session=None, table_name=None, new_epoch=None,):
+    def __init__(self, session=None,):
         self.session = session
-        self.table_name = table_name
-        self.new_epoch = new_epoch
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -9596,16 +10982,6 @@ class set_table_epoch_by_name_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
-            elif fid == 2:
-                if ftype == TType.STRING:
-                    self.table_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 3:
-                if ftype == TType.I32:
-                    self.new_epoch = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -9615,19 +10991,11 @@ class set_table_epoch_by_name_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('set_table_epoch_by_name_args')
+        oprot.writeStructBegin('clear_gpu_memory_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.table_name is not None:
-            oprot.writeFieldBegin('table_name', TType.STRING, 2)
-            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
-            oprot.writeFieldEnd()
-        if self.new_epoch is not None:
-            oprot.writeFieldBegin('new_epoch', TType.I32, 3)
-            oprot.writeI32(self.new_epoch)
-            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -9644,16 +11012,14 @@ class set_table_epoch_by_name_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(set_table_epoch_by_name_args)
-set_table_epoch_by_name_args.thrift_spec = (
+all_structs.append(clear_gpu_memory_args)
+clear_gpu_memory_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
-    (3, TType.I32, 'new_epoch', None, None, ),  # 3
 )
 
 
-class set_table_epoch_by_name_result(object):
+class clear_gpu_memory_result(object):
     """
     Attributes:
      - e
@@ -9688,7 +11054,7 @@ class set_table_epoch_by_name_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('set_table_epoch_by_name_result')
+        oprot.writeStructBegin('clear_gpu_memory_result')
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -9709,27 +11075,29 @@ class set_table_epoch_by_name_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(set_table_epoch_by_name_result)
-set_table_epoch_by_name_result.thrift_spec = (
+all_structs.append(clear_gpu_memory_result)
+clear_gpu_memory_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_table_epoch_args(object):
+class set_cur_session_args(object):
     """
     Attributes:
-     - session
-     - db_id
-     - table_id
+     - parent_session
+     - leaf_session
+     - start_time_str
+     - label
 
     """
 
 
-    def __init__(self, session=None, db_id=None, table_id=None,):
-        self.session = session
-        self.db_id = db_id
-        self.table_id = table_id
+    def __init__(self, parent_session=None, leaf_session=None, start_time_str=None, label=None,):
+        self.parent_session = parent_session
+        self.leaf_session = leaf_session
+        self.start_time_str = start_time_str
+        self.label = label
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -9742,17 +11110,22 @@ class get_table_epoch_args(object):
                 break
             if fid == 1:
                 if ftype == TType.STRING:
-                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.parent_session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.I32:
-                    self.db_id = iprot.readI32()
+                if ftype == TType.STRING:
+                    self.leaf_session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
-                if ftype == TType.I32:
-                    self.table_id = iprot.readI32()
+                if ftype == TType.STRING:
+                    self.start_time_str = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRING:
+                    self.label = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             else:
@@ -9764,18 +11137,22 @@ class get_table_epoch_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_table_epoch_args')
-        if self.session is not None:
-            oprot.writeFieldBegin('session', TType.STRING, 1)
-            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+        oprot.writeStructBegin('set_cur_session_args')
+        if self.parent_session is not None:
+            oprot.writeFieldBegin('parent_session', TType.STRING, 1)
+            oprot.writeString(self.parent_session.encode('utf-8') if sys.version_info[0] == 2 else self.parent_session)
             oprot.writeFieldEnd()
-        if self.db_id is not None:
-            oprot.writeFieldBegin('db_id', TType.I32, 2)
-            oprot.writeI32(self.db_id)
+        if self.leaf_session is not None:
+            oprot.writeFieldBegin('leaf_session', TType.STRING, 2)
+            oprot.writeString(self.leaf_session.encode('utf-8') if sys.version_info[0] == 2 else self.leaf_session)
             oprot.writeFieldEnd()
-        if self.table_id is not None:
-            oprot.writeFieldBegin('table_id', TType.I32, 3)
-            oprot.writeI32(self.table_id)
+        if self.start_time_str is not None:
+            oprot.writeFieldBegin('start_time_str', TType.STRING, 3)
+            oprot.writeString(self.start_time_str.encode('utf-8') if sys.version_info[0] == 2 else self.start_time_str)
+            oprot.writeFieldEnd()
+        if self.label is not None:
+            oprot.writeFieldBegin('label', TType.STRING, 4)
+            oprot.writeString(self.label.encode('utf-8') if sys.version_info[0] == 2 else self.label)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -9793,25 +11170,26 @@ class get_table_epoch_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_table_epoch_args)
-get_table_epoch_args.thrift_spec = (
+all_structs.append(set_cur_session_args)
+set_cur_session_args.thrift_spec = (
     None,  # 0
-    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.I32, 'db_id', None, None, ),  # 2
-    (3, TType.I32, 'table_id', None, None, ),  # 3
+    (1, TType.STRING, 'parent_session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'leaf_session', 'UTF8', None, ),  # 2
+    (3, TType.STRING, 'start_time_str', 'UTF8', None, ),  # 3
+    (4, TType.STRING, 'label', 'UTF8', None, ),  # 4
 )
 
 
-class get_table_epoch_result(object):
+class set_cur_session_result(object):
     """
     Attributes:
-     - success
+     - e
 
     """
 
 
-    def __init__(self, success=None,):
-        self.success = success
+    def __init__(self, e=None,):
+        self.e = e
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -9822,9 +11200,10 @@ class get_table_epoch_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.I32:
-                    self.success = iprot.readI32()
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
             else:
@@ -9836,10 +11215,10 @@ class get_table_epoch_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_table_epoch_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.I32, 0)
-            oprot.writeI32(self.success)
+        oprot.writeStructBegin('set_cur_session_result')
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -9857,24 +11236,29 @@ class get_table_epoch_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_table_epoch_result)
-get_table_epoch_result.thrift_spec = (
-    (0, TType.I32, 'success', None, None, ),  # 0
+all_structs.append(set_cur_session_result)
+set_cur_session_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_table_epoch_by_name_args(object):
+class invalidate_cur_session_args(object):
     """
     Attributes:
-     - session
-     - table_name
+     - parent_session
+     - leaf_session
+     - start_time_str
+     - label
 
     """
 
 
-    def __init__(self, session=None, table_name=None,):
-        self.session = session
-        self.table_name = table_name
+    def __init__(self, parent_session=None, leaf_session=None, start_time_str=None, label=None,):
+        self.parent_session = parent_session
+        self.leaf_session = leaf_session
+        self.start_time_str = start_time_str
+        self.label = label
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -9887,31 +11271,49 @@ class get_table_epoch_by_name_args(object):
                 break
             if fid == 1:
                 if ftype == TType.STRING:
-                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.parent_session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
                 if ftype == TType.STRING:
-                    self.table_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.leaf_session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
-            else:
-                iprot.skip(ftype)
-            iprot.readFieldEnd()
-        iprot.readStructEnd()
-
-    def write(self, oprot):
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.start_time_str = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRING:
+                    self.label = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_table_epoch_by_name_args')
-        if self.session is not None:
-            oprot.writeFieldBegin('session', TType.STRING, 1)
-            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+        oprot.writeStructBegin('invalidate_cur_session_args')
+        if self.parent_session is not None:
+            oprot.writeFieldBegin('parent_session', TType.STRING, 1)
+            oprot.writeString(self.parent_session.encode('utf-8') if sys.version_info[0] == 2 else self.parent_session)
             oprot.writeFieldEnd()
-        if self.table_name is not None:
-            oprot.writeFieldBegin('table_name', TType.STRING, 2)
-            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
+        if self.leaf_session is not None:
+            oprot.writeFieldBegin('leaf_session', TType.STRING, 2)
+            oprot.writeString(self.leaf_session.encode('utf-8') if sys.version_info[0] == 2 else self.leaf_session)
+            oprot.writeFieldEnd()
+        if self.start_time_str is not None:
+            oprot.writeFieldBegin('start_time_str', TType.STRING, 3)
+            oprot.writeString(self.start_time_str.encode('utf-8') if sys.version_info[0] == 2 else self.start_time_str)
+            oprot.writeFieldEnd()
+        if self.label is not None:
+            oprot.writeFieldBegin('label', TType.STRING, 4)
+            oprot.writeString(self.label.encode('utf-8') if sys.version_info[0] == 2 else self.label)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -9929,24 +11331,26 @@ class get_table_epoch_by_name_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_table_epoch_by_name_args)
-get_table_epoch_by_name_args.thrift_spec = (
+all_structs.append(invalidate_cur_session_args)
+invalidate_cur_session_args.thrift_spec = (
     None,  # 0
-    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+    (1, TType.STRING, 'parent_session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'leaf_session', 'UTF8', None, ),  # 2
+    (3, TType.STRING, 'start_time_str', 'UTF8', None, ),  # 3
+    (4, TType.STRING, 'label', 'UTF8', None, ),  # 4
 )
 
 
-class get_table_epoch_by_name_result(object):
+class invalidate_cur_session_result(object):
     """
     Attributes:
-     - success
+     - e
 
     """
 
 
-    def __init__(self, success=None,):
-        self.success = success
+    def __init__(self, e=None,):
+        self.e = e
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -9957,9 +11361,10 @@ class get_table_epoch_by_name_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.I32:
-                    self.success = iprot.readI32()
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
             else:
@@ -9971,10 +11376,10 @@ class get_table_epoch_by_name_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_table_epoch_by_name_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.I32, 0)
-            oprot.writeI32(self.success)
+        oprot.writeStructBegin('invalidate_cur_session_result')
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -9992,26 +11397,29 @@ class get_table_epoch_by_name_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_table_epoch_by_name_result)
-get_table_epoch_by_name_result.thrift_spec = (
-    (0, TType.I32, 'success', None, None, ),  # 0
+all_structs.append(invalidate_cur_session_result)
+invalidate_cur_session_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_table_epochs_args(object):
+class set_table_epoch_args(object):
     """
     Attributes:
      - session
      - db_id
      - table_id
+     - new_epoch
 
     """
 
 
-    def __init__(self, session=None, db_id=None, table_id=None,):
+    def __init__(self, session=None, db_id=None, table_id=None, new_epoch=None,):
         self.session = session
         self.db_id = db_id
         self.table_id = table_id
+        self.new_epoch = new_epoch
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10037,6 +11445,11 @@ class get_table_epochs_args(object):
                     self.table_id = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.new_epoch = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -10046,7 +11459,7 @@ class get_table_epochs_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_table_epochs_args')
+        oprot.writeStructBegin('set_table_epoch_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
@@ -10059,6 +11472,10 @@ class get_table_epochs_args(object):
             oprot.writeFieldBegin('table_id', TType.I32, 3)
             oprot.writeI32(self.table_id)
             oprot.writeFieldEnd()
+        if self.new_epoch is not None:
+            oprot.writeFieldBegin('new_epoch', TType.I32, 4)
+            oprot.writeI32(self.new_epoch)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -10075,25 +11492,26 @@ class get_table_epochs_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_table_epochs_args)
-get_table_epochs_args.thrift_spec = (
+all_structs.append(set_table_epoch_args)
+set_table_epoch_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
     (2, TType.I32, 'db_id', None, None, ),  # 2
     (3, TType.I32, 'table_id', None, None, ),  # 3
+    (4, TType.I32, 'new_epoch', None, None, ),  # 4
 )
 
 
-class get_table_epochs_result(object):
+class set_table_epoch_result(object):
     """
     Attributes:
-     - success
+     - e
 
     """
 
 
-    def __init__(self, success=None,):
-        self.success = success
+    def __init__(self, e=None,):
+        self.e = e
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10104,15 +11522,10 @@ class get_table_epochs_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.LIST:
-                    self.success = []
-                    (_etype314, _size311) = iprot.readListBegin()
-                    for _i315 in range(_size311):
-                        _elem316 = TTableEpochInfo()
-                        _elem316.read(iprot)
-                        self.success.append(_elem316)
-                    iprot.readListEnd()
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
             else:
@@ -10124,13 +11537,10 @@ class get_table_epochs_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_table_epochs_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter317 in self.success:
-                iter317.write(oprot)
-            oprot.writeListEnd()
+        oprot.writeStructBegin('set_table_epoch_result')
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -10148,26 +11558,27 @@ class get_table_epochs_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_table_epochs_result)
-get_table_epochs_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.STRUCT, [TTableEpochInfo, None], False), None, ),  # 0
+all_structs.append(set_table_epoch_result)
+set_table_epoch_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class set_table_epochs_args(object):
+class set_table_epoch_by_name_args(object):
     """
     Attributes:
      - session
-     - db_id
-     - table_epochs
+     - table_name
+     - new_epoch
 
     """
 
 
-    def __init__(self, session=None, db_id=None, table_epochs=None,):
+    def __init__(self, session=None, table_name=None, new_epoch=None,):
         self.session = session
-        self.db_id = db_id
-        self.table_epochs = table_epochs
+        self.table_name = table_name
+        self.new_epoch = new_epoch
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10184,19 +11595,13 @@ class set_table_epochs_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.I32:
-                    self.db_id = iprot.readI32()
+                if ftype == TType.STRING:
+                    self.table_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
-                if ftype == TType.LIST:
-                    self.table_epochs = []
-                    (_etype321, _size318) = iprot.readListBegin()
-                    for _i322 in range(_size318):
-                        _elem323 = TTableEpochInfo()
-                        _elem323.read(iprot)
-                        self.table_epochs.append(_elem323)
-                    iprot.readListEnd()
+                if ftype == TType.I32:
+                    self.new_epoch = iprot.readI32()
                 else:
                     iprot.skip(ftype)
             else:
@@ -10208,21 +11613,18 @@ class set_table_epochs_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('set_table_epochs_args')
+        oprot.writeStructBegin('set_table_epoch_by_name_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.db_id is not None:
-            oprot.writeFieldBegin('db_id', TType.I32, 2)
-            oprot.writeI32(self.db_id)
+        if self.table_name is not None:
+            oprot.writeFieldBegin('table_name', TType.STRING, 2)
+            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
             oprot.writeFieldEnd()
-        if self.table_epochs is not None:
-            oprot.writeFieldBegin('table_epochs', TType.LIST, 3)
-            oprot.writeListBegin(TType.STRUCT, len(self.table_epochs))
-            for iter324 in self.table_epochs:
-                iter324.write(oprot)
-            oprot.writeListEnd()
+        if self.new_epoch is not None:
+            oprot.writeFieldBegin('new_epoch', TType.I32, 3)
+            oprot.writeI32(self.new_epoch)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -10240,17 +11642,25 @@ class set_table_epochs_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(set_table_epochs_args)
-set_table_epochs_args.thrift_spec = (
+all_structs.append(set_table_epoch_by_name_args)
+set_table_epoch_by_name_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.I32, 'db_id', None, None, ),  # 2
-    (3, TType.LIST, 'table_epochs', (TType.STRUCT, [TTableEpochInfo, None], False), None, ),  # 3
+    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+    (3, TType.I32, 'new_epoch', None, None, ),  # 3
 )
 
 
-class set_table_epochs_result(object):
+class set_table_epoch_by_name_result(object):
+    """
+    Attributes:
+     - e
 
+    """
+
+
+    def __init__(self, e=None,):
+        self.e = e
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10261,6 +11671,12 @@ class set_table_epochs_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -10270,7 +11686,11 @@ class set_table_epochs_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('set_table_epochs_result')
+        oprot.writeStructBegin('set_table_epoch_by_name_result')
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -10287,21 +11707,27 @@ class set_table_epochs_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(set_table_epochs_result)
-set_table_epochs_result.thrift_spec = (
+all_structs.append(set_table_epoch_by_name_result)
+set_table_epoch_by_name_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_session_info_args(object):
+class get_table_epoch_args(object):
     """
     Attributes:
      - session
+     - db_id
+     - table_id
 
     """
 
 
-    def __init__(self, session=None,):
+    def __init__(self, session=None, db_id=None, table_id=None,):
         self.session = session
+        self.db_id = db_id
+        self.table_id = table_id
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10317,6 +11743,16 @@ class get_session_info_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I32:
+                    self.db_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I32:
+                    self.table_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -10326,11 +11762,19 @@ class get_session_info_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_session_info_args')
+        oprot.writeStructBegin('get_table_epoch_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
+        if self.db_id is not None:
+            oprot.writeFieldBegin('db_id', TType.I32, 2)
+            oprot.writeI32(self.db_id)
+            oprot.writeFieldEnd()
+        if self.table_id is not None:
+            oprot.writeFieldBegin('table_id', TType.I32, 3)
+            oprot.writeI32(self.table_id)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -10347,25 +11791,25 @@ class get_session_info_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_session_info_args)
-get_session_info_args.thrift_spec = (
+all_structs.append(get_table_epoch_args)
+get_table_epoch_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.I32, 'db_id', None, None, ),  # 2
+    (3, TType.I32, 'table_id', None, None, ),  # 3
 )
 
 
-class get_session_info_result(object):
+class get_table_epoch_result(object):
     """
     Attributes:
      - success
-     - e
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None,):
         self.success = success
-        self.e = e
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10377,15 +11821,8 @@ class get_session_info_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.STRUCT:
-                    self.success = TSessionInfo()
-                    self.success.read(iprot)
-                else:
-                    iprot.skip(ftype)
-            elif fid == 1:
-                if ftype == TType.STRUCT:
-                    self.e = TOmniSciException()
-                    self.e.read(iprot)
+                if ftype == TType.I32:
+                    self.success = iprot.readI32()
                 else:
                     iprot.skip(ftype)
             else:
@@ -10397,14 +11834,10 @@ class get_session_info_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_session_info_result')
+        oprot.writeStructBegin('get_table_epoch_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRUCT, 0)
-            self.success.write(oprot)
-            oprot.writeFieldEnd()
-        if self.e is not None:
-            oprot.writeFieldBegin('e', TType.STRUCT, 1)
-            self.e.write(oprot)
+            oprot.writeFieldBegin('success', TType.I32, 0)
+            oprot.writeI32(self.success)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -10422,33 +11855,2294 @@ class get_session_info_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_session_info_result)
-get_session_info_result.thrift_spec = (
-    (0, TType.STRUCT, 'success', [TSessionInfo, None], None, ),  # 0
-    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+all_structs.append(get_table_epoch_result)
+get_table_epoch_result.thrift_spec = (
+    (0, TType.I32, 'success', None, None, ),  # 0
+)
+
+
+class get_table_epoch_by_name_args(object):
+    """
+    Attributes:
+     - session
+     - table_name
+
+    """
+
+
+    def __init__(self, session=None, table_name=None,):
+        self.session = session
+        self.table_name = table_name
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.table_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('get_table_epoch_by_name_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.table_name is not None:
+            oprot.writeFieldBegin('table_name', TType.STRING, 2)
+            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(get_table_epoch_by_name_args)
+get_table_epoch_by_name_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+)
+
+
+class get_table_epoch_by_name_result(object):
+    """
+    Attributes:
+     - success
+
+    """
+
+
+    def __init__(self, success=None,):
+        self.success = success
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.I32:
+                    self.success = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('get_table_epoch_by_name_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.I32, 0)
+            oprot.writeI32(self.success)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(get_table_epoch_by_name_result)
+get_table_epoch_by_name_result.thrift_spec = (
+    (0, TType.I32, 'success', None, None, ),  # 0
+)
+
+
+class get_table_epochs_args(object):
+    """
+    Attributes:
+     - session
+     - db_id
+     - table_id
+
+    """
+
+
+    def __init__(self, session=None, db_id=None, table_id=None,):
+        self.session = session
+        self.db_id = db_id
+        self.table_id = table_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I32:
+                    self.db_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I32:
+                    self.table_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('get_table_epochs_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.db_id is not None:
+            oprot.writeFieldBegin('db_id', TType.I32, 2)
+            oprot.writeI32(self.db_id)
+            oprot.writeFieldEnd()
+        if self.table_id is not None:
+            oprot.writeFieldBegin('table_id', TType.I32, 3)
+            oprot.writeI32(self.table_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(get_table_epochs_args)
+get_table_epochs_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.I32, 'db_id', None, None, ),  # 2
+    (3, TType.I32, 'table_id', None, None, ),  # 3
+)
+
+
+class get_table_epochs_result(object):
+    """
+    Attributes:
+     - success
+
+    """
+
+
+    def __init__(self, success=None,):
+        self.success = success
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype349, _size346) = iprot.readListBegin()
+                    for _i350 in range(_size346):
+                        _elem351 = TTableEpochInfo()
+                        _elem351.read(iprot)
+                        self.success.append(_elem351)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('get_table_epochs_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter352 in self.success:
+                iter352.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(get_table_epochs_result)
+get_table_epochs_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRUCT, [TTableEpochInfo, None], False), None, ),  # 0
+)
+
+
+class set_table_epochs_args(object):
+    """
+    Attributes:
+     - session
+     - db_id
+     - table_epochs
+
+    """
+
+
+    def __init__(self, session=None, db_id=None, table_epochs=None,):
+        self.session = session
+        self.db_id = db_id
+        self.table_epochs = table_epochs
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I32:
+                    self.db_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.table_epochs = []
+                    (_etype356, _size353) = iprot.readListBegin()
+                    for _i357 in range(_size353):
+                        _elem358 = TTableEpochInfo()
+                        _elem358.read(iprot)
+                        self.table_epochs.append(_elem358)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('set_table_epochs_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.db_id is not None:
+            oprot.writeFieldBegin('db_id', TType.I32, 2)
+            oprot.writeI32(self.db_id)
+            oprot.writeFieldEnd()
+        if self.table_epochs is not None:
+            oprot.writeFieldBegin('table_epochs', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRUCT, len(self.table_epochs))
+            for iter359 in self.table_epochs:
+                iter359.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(set_table_epochs_args)
+set_table_epochs_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.I32, 'db_id', None, None, ),  # 2
+    (3, TType.LIST, 'table_epochs', (TType.STRUCT, [TTableEpochInfo, None], False), None, ),  # 3
+)
+
+
+class set_table_epochs_result(object):
+
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('set_table_epochs_result')
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(set_table_epochs_result)
+set_table_epochs_result.thrift_spec = (
+)
+
+
+class get_session_info_args(object):
+    """
+    Attributes:
+     - session
+
+    """
+
+
+    def __init__(self, session=None,):
+        self.session = session
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('get_session_info_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(get_session_info_args)
+get_session_info_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+)
+
+
+class get_session_info_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TSessionInfo()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('get_session_info_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(get_session_info_result)
+get_session_info_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TSessionInfo, None], None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class sql_execute_args(object):
+    """
+    Attributes:
+     - session
+     - query
+     - column_format
+     - nonce
+     - first_n
+     - at_most_n
+
+    """
+
+
+    def __init__(self, session=None, query=None, column_format=None, nonce=None, first_n=-1, at_most_n=-1,):
+        self.session = session
+        self.query = query
+        self.column_format = column_format
+        self.nonce = nonce
+        self.first_n = first_n
+        self.at_most_n = at_most_n
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.BOOL:
+                    self.column_format = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRING:
+                    self.nonce = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I32:
+                    self.first_n = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.at_most_n = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.query is not None:
+            oprot.writeFieldBegin('query', TType.STRING, 2)
+            oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
+            oprot.writeFieldEnd()
+        if self.column_format is not None:
+            oprot.writeFieldBegin('column_format', TType.BOOL, 3)
+            oprot.writeBool(self.column_format)
+            oprot.writeFieldEnd()
+        if self.nonce is not None:
+            oprot.writeFieldBegin('nonce', TType.STRING, 4)
+            oprot.writeString(self.nonce.encode('utf-8') if sys.version_info[0] == 2 else self.nonce)
+            oprot.writeFieldEnd()
+        if self.first_n is not None:
+            oprot.writeFieldBegin('first_n', TType.I32, 5)
+            oprot.writeI32(self.first_n)
+            oprot.writeFieldEnd()
+        if self.at_most_n is not None:
+            oprot.writeFieldBegin('at_most_n', TType.I32, 6)
+            oprot.writeI32(self.at_most_n)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_args)
+sql_execute_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
+    (3, TType.BOOL, 'column_format', None, None, ),  # 3
+    (4, TType.STRING, 'nonce', 'UTF8', None, ),  # 4
+    (5, TType.I32, 'first_n', None, -1, ),  # 5
+    (6, TType.I32, 'at_most_n', None, -1, ),  # 6
+)
+
+
+class sql_execute_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TQueryResult()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_result)
+sql_execute_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TQueryResult, None], None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class prepare_statement_args(object):
+    """
+    Attributes:
+     - session
+     - query
+
+    """
+
+
+    def __init__(self, session=None, query=None,):
+        self.session = session
+        self.query = query
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('prepare_statement_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.query is not None:
+            oprot.writeFieldBegin('query', TType.STRING, 2)
+            oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(prepare_statement_args)
+prepare_statement_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
+)
+
+
+class prepare_statement_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TPreparedStatement()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('prepare_statement_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(prepare_statement_result)
+prepare_statement_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TPreparedStatement, None], None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class sql_execute_prepared_args(object):
+    """
+    Attributes:
+     - session
+     - statement_id
+     - parameters
+     - column_format
+     - nonce
+     - first_n
+     - at_most_n
+
+    """
+
+
+    def __init__(self, session=None, statement_id=None, parameters=None, column_format=None, nonce=None, first_n=-1, at_most_n=-1,):
+        self.session = session
+        self.statement_id = statement_id
+        self.parameters = parameters
+        self.column_format = column_format
+        self.nonce = nonce
+        self.first_n = first_n
+        self.at_most_n = at_most_n
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.statement_id = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.parameters = []
+                    (_etype363, _size360) = iprot.readListBegin()
+                    for _i364 in range(_size360):
+                        _elem365 = TBindParameter()
+                        _elem365.read(iprot)
+                        self.parameters.append(_elem365)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.BOOL:
+                    self.column_format = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.STRING:
+                    self.nonce = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.first_n = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.I32:
+                    self.at_most_n = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_prepared_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.statement_id is not None:
+            oprot.writeFieldBegin('statement_id', TType.STRING, 2)
+            oprot.writeString(self.statement_id.encode('utf-8') if sys.version_info[0] == 2 else self.statement_id)
+            oprot.writeFieldEnd()
+        if self.parameters is not None:
+            oprot.writeFieldBegin('parameters', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRUCT, len(self.parameters))
+            for iter366 in self.parameters:
+                iter366.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.column_format is not None:
+            oprot.writeFieldBegin('column_format', TType.BOOL, 4)
+            oprot.writeBool(self.column_format)
+            oprot.writeFieldEnd()
+        if self.nonce is not None:
+            oprot.writeFieldBegin('nonce', TType.STRING, 5)
+            oprot.writeString(self.nonce.encode('utf-8') if sys.version_info[0] == 2 else self.nonce)
+            oprot.writeFieldEnd()
+        if self.first_n is not None:
+            oprot.writeFieldBegin('first_n', TType.I32, 6)
+            oprot.writeI32(self.first_n)
+            oprot.writeFieldEnd()
+        if self.at_most_n is not None:
+            oprot.writeFieldBegin('at_most_n', TType.I32, 7)
+            oprot.writeI32(self.at_most_n)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_prepared_args)
+sql_execute_prepared_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'statement_id', 'UTF8', None, ),  # 2
+    (3, TType.LIST, 'parameters', (TType.STRUCT, [TBindParameter, None], False), None, ),  # 3
+    (4, TType.BOOL, 'column_format', None, None, ),  # 4
+    (5, TType.STRING, 'nonce', 'UTF8', None, ),  # 5
+    (6, TType.I32, 'first_n', None, -1, ),  # 6
+    (7, TType.I32, 'at_most_n', None, -1, ),  # 7
+)
+
+
+class sql_execute_prepared_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TQueryResult()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_prepared_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_prepared_result)
+sql_execute_prepared_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TQueryResult, None], None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class close_prepared_statement_args(object):
+    """
+    Attributes:
+     - session
+     - statement_id
+
+    """
+
+
+    def __init__(self, session=None, statement_id=None,):
+        self.session = session
+        self.statement_id = statement_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.statement_id = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('close_prepared_statement_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.statement_id is not None:
+            oprot.writeFieldBegin('statement_id', TType.STRING, 2)
+            oprot.writeString(self.statement_id.encode('utf-8') if sys.version_info[0] == 2 else self.statement_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(close_prepared_statement_args)
+close_prepared_statement_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'statement_id', 'UTF8', None, ),  # 2
+)
+
+
+class close_prepared_statement_result(object):
+    """
+    Attributes:
+     - e
+
+    """
+
+
+    def __init__(self, e=None,):
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('close_prepared_statement_result')
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(close_prepared_statement_result)
+close_prepared_statement_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class sql_execute_df_args(object):
+    """
+    Attributes:
+     - session
+     - query
+     - device_type
+     - device_id
+     - first_n
+     - transport_method
+
+    """
+
+
+    def __init__(self, session=None, query=None, device_type=None, device_id=0, first_n=-1, transport_method=None,):
+        self.session = session
+        self.query = query
+        self.device_type = device_type
+        self.device_id = device_id
+        self.first_n = first_n
+        self.transport_method = transport_method
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I32:
+                    self.device_type = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.device_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I32:
+                    self.first_n = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.transport_method = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_df_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.query is not None:
+            oprot.writeFieldBegin('query', TType.STRING, 2)
+            oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
+            oprot.writeFieldEnd()
+        if self.device_type is not None:
+            oprot.writeFieldBegin('device_type', TType.I32, 3)
+            oprot.writeI32(self.device_type)
+            oprot.writeFieldEnd()
+        if self.device_id is not None:
+            oprot.writeFieldBegin('device_id', TType.I32, 4)
+            oprot.writeI32(self.device_id)
+            oprot.writeFieldEnd()
+        if self.first_n is not None:
+            oprot.writeFieldBegin('first_n', TType.I32, 5)
+            oprot.writeI32(self.first_n)
+            oprot.writeFieldEnd()
+        if self.transport_method is not None:
+            oprot.writeFieldBegin('transport_method', TType.I32, 6)
+            oprot.writeI32(self.transport_method)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_df_args)
+sql_execute_df_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
+    (3, TType.I32, 'device_type', None, None, ),  # 3
+    (4, TType.I32, 'device_id', None, 0, ),  # 4
+    (5, TType.I32, 'first_n', None, -1, ),  # 5
+    (6, TType.I32, 'transport_method', None, None, ),  # 6
+)
+
+
+class sql_execute_df_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TDataFrame()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_df_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_df_result)
+sql_execute_df_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TDataFrame, None], None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class sql_execute_gdf_args(object):
+    """
+    Attributes:
+     - session
+     - query
+     - device_id
+     - first_n
+
+    """
+
+
+    def __init__(self, session=None, query=None, device_id=0, first_n=-1,):
+        self.session = session
+        self.query = query
+        self.device_id = device_id
+        self.first_n = first_n
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I32:
+                    self.device_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.first_n = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_gdf_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.query is not None:
+            oprot.writeFieldBegin('query', TType.STRING, 2)
+            oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
+            oprot.writeFieldEnd()
+        if self.device_id is not None:
+            oprot.writeFieldBegin('device_id', TType.I32, 3)
+            oprot.writeI32(self.device_id)
+            oprot.writeFieldEnd()
+        if self.first_n is not None:
+            oprot.writeFieldBegin('first_n', TType.I32, 4)
+            oprot.writeI32(self.first_n)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_gdf_args)
+sql_execute_gdf_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
+    (3, TType.I32, 'device_id', None, 0, ),  # 3
+    (4, TType.I32, 'first_n', None, -1, ),  # 4
+)
+
+
+class sql_execute_gdf_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TDataFrame()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_gdf_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_gdf_result)
+sql_execute_gdf_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TDataFrame, None], None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class deallocate_df_args(object):
+    """
+    Attributes:
+     - session
+     - df
+     - device_type
+     - device_id
+
+    """
+
+
+    def __init__(self, session=None, df=None, device_type=None, device_id=0,):
+        self.session = session
+        self.df = df
+        self.device_type = device_type
+        self.device_id = device_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.df = TDataFrame()
+                    self.df.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I32:
+                    self.device_type = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.device_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('deallocate_df_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.df is not None:
+            oprot.writeFieldBegin('df', TType.STRUCT, 2)
+            self.df.write(oprot)
+            oprot.writeFieldEnd()
+        if self.device_type is not None:
+            oprot.writeFieldBegin('device_type', TType.I32, 3)
+            oprot.writeI32(self.device_type)
+            oprot.writeFieldEnd()
+        if self.device_id is not None:
+            oprot.writeFieldBegin('device_id', TType.I32, 4)
+            oprot.writeI32(self.device_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(deallocate_df_args)
+deallocate_df_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRUCT, 'df', [TDataFrame, None], None, ),  # 2
+    (3, TType.I32, 'device_type', None, None, ),  # 3
+    (4, TType.I32, 'device_id', None, 0, ),  # 4
+)
+
+
+class deallocate_df_result(object):
+    """
+    Attributes:
+     - e
+
+    """
+
+
+    def __init__(self, e=None,):
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('deallocate_df_result')
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(deallocate_df_result)
+deallocate_df_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class sql_execute_df_cursor_args(object):
+    """
+    Attributes:
+     - session
+     - query
+     - first_n
+     - max_batch_rows
+     - transport_method
+
+    """
+
+
+    def __init__(self, session=None, query=None, first_n=-1, max_batch_rows=0, transport_method=None,):
+        self.session = session
+        self.query = query
+        self.first_n = first_n
+        self.max_batch_rows = max_batch_rows
+        self.transport_method = transport_method
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I32:
+                    self.first_n = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.max_batch_rows = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I32:
+                    self.transport_method = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_df_cursor_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.query is not None:
+            oprot.writeFieldBegin('query', TType.STRING, 2)
+            oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
+            oprot.writeFieldEnd()
+        if self.first_n is not None:
+            oprot.writeFieldBegin('first_n', TType.I32, 3)
+            oprot.writeI32(self.first_n)
+            oprot.writeFieldEnd()
+        if self.max_batch_rows is not None:
+            oprot.writeFieldBegin('max_batch_rows', TType.I64, 4)
+            oprot.writeI64(self.max_batch_rows)
+            oprot.writeFieldEnd()
+        if self.transport_method is not None:
+            oprot.writeFieldBegin('transport_method', TType.I32, 5)
+            oprot.writeI32(self.transport_method)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_df_cursor_args)
+sql_execute_df_cursor_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
+    (3, TType.I32, 'first_n', None, -1, ),  # 3
+    (4, TType.I64, 'max_batch_rows', None, 0, ),  # 4
+    (5, TType.I32, 'transport_method', None, None, ),  # 5
+)
+
+
+class sql_execute_df_cursor_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TDataFrameCursor()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('sql_execute_df_cursor_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(sql_execute_df_cursor_result)
+sql_execute_df_cursor_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TDataFrameCursor, None], None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class fetch_df_batch_args(object):
+    """
+    Attributes:
+     - session
+     - cursor_id
+
+    """
+
+
+    def __init__(self, session=None, cursor_id=None,):
+        self.session = session
+        self.cursor_id = cursor_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.cursor_id = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('fetch_df_batch_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.cursor_id is not None:
+            oprot.writeFieldBegin('cursor_id', TType.STRING, 2)
+            oprot.writeString(self.cursor_id.encode('utf-8') if sys.version_info[0] == 2 else self.cursor_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(fetch_df_batch_args)
+fetch_df_batch_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'cursor_id', 'UTF8', None, ),  # 2
+)
+
+
+class fetch_df_batch_result(object):
+    """
+    Attributes:
+     - success
+     - e
+
+    """
+
+
+    def __init__(self, success=None, e=None,):
+        self.success = success
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TDataFrame()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('fetch_df_batch_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(fetch_df_batch_result)
+fetch_df_batch_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TDataFrame, None], None, ),  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
+class close_df_cursor_args(object):
+    """
+    Attributes:
+     - session
+     - cursor_id
+
+    """
+
+
+    def __init__(self, session=None, cursor_id=None,):
+        self.session = session
+        self.cursor_id = cursor_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.cursor_id = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('close_df_cursor_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.cursor_id is not None:
+            oprot.writeFieldBegin('cursor_id', TType.STRING, 2)
+            oprot.writeString(self.cursor_id.encode('utf-8') if sys.version_info[0] == 2 else self.cursor_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(close_df_cursor_args)
+close_df_cursor_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'cursor_id', 'UTF8', None, ),  # 2
+)
+
+
+class close_df_cursor_result(object):
+    """
+    Attributes:
+     - e
+
+    """
+
+
+    def __init__(self, e=None,):
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('close_df_cursor_result')
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(close_df_cursor_result)
+close_df_cursor_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class sql_execute_args(object):
+class interrupt_args(object):
     """
     Attributes:
-     - session
-     - query
-     - column_format
-     - nonce
-     - first_n
-     - at_most_n
+     - query_session
+     - interrupt_session
 
     """
 
 
-    def __init__(self, session=None, query=None, column_format=None, nonce=None, first_n=-1, at_most_n=-1,):
-        self.session = session
-        self.query = query
-        self.column_format = column_format
-        self.nonce = nonce
-        self.first_n = first_n
-        self.at_most_n = at_most_n
+    def __init__(self, query_session=None, interrupt_session=None,):
+        self.query_session = query_session
+        self.interrupt_session = interrupt_session
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10461,32 +14155,12 @@ class sql_execute_args(object):
                 break
             if fid == 1:
                 if ftype == TType.STRING:
-                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.query_session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
                 if ftype == TType.STRING:
-                    self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 3:
-                if ftype == TType.BOOL:
-                    self.column_format = iprot.readBool()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
-                if ftype == TType.STRING:
-                    self.nonce = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 5:
-                if ftype == TType.I32:
-                    self.first_n = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 6:
-                if ftype == TType.I32:
-                    self.at_most_n = iprot.readI32()
+                    self.interrupt_session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             else:
@@ -10498,30 +14172,14 @@ class sql_execute_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('sql_execute_args')
-        if self.session is not None:
-            oprot.writeFieldBegin('session', TType.STRING, 1)
-            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
-            oprot.writeFieldEnd()
-        if self.query is not None:
-            oprot.writeFieldBegin('query', TType.STRING, 2)
-            oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
-            oprot.writeFieldEnd()
-        if self.column_format is not None:
-            oprot.writeFieldBegin('column_format', TType.BOOL, 3)
-            oprot.writeBool(self.column_format)
-            oprot.writeFieldEnd()
-        if self.nonce is not None:
-            oprot.writeFieldBegin('nonce', TType.STRING, 4)
-            oprot.writeString(self.nonce.encode('utf-8') if sys.version_info[0] == 2 else self.nonce)
-            oprot.writeFieldEnd()
-        if self.first_n is not None:
-            oprot.writeFieldBegin('first_n', TType.I32, 5)
-            oprot.writeI32(self.first_n)
+        oprot.writeStructBegin('interrupt_args')
+        if self.query_session is not None:
+            oprot.writeFieldBegin('query_session', TType.STRING, 1)
+            oprot.writeString(self.query_session.encode('utf-8') if sys.version_info[0] == 2 else self.query_session)
             oprot.writeFieldEnd()
-        if self.at_most_n is not None:
-            oprot.writeFieldBegin('at_most_n', TType.I32, 6)
-            oprot.writeI32(self.at_most_n)
+        if self.interrupt_session is not None:
+            oprot.writeFieldBegin('interrupt_session', TType.STRING, 2)
+            oprot.writeString(self.interrupt_session.encode('utf-8') if sys.version_info[0] == 2 else self.interrupt_session)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -10539,29 +14197,23 @@ class sql_execute_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(sql_execute_args)
-sql_execute_args.thrift_spec = (
+all_structs.append(interrupt_args)
+interrupt_args.thrift_spec = (
     None,  # 0
-    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
-    (3, TType.BOOL, 'column_format', None, None, ),  # 3
-    (4, TType.STRING, 'nonce', 'UTF8', None, ),  # 4
-    (5, TType.I32, 'first_n', None, -1, ),  # 5
-    (6, TType.I32, 'at_most_n', None, -1, ),  # 6
+    (1, TType.STRING, 'query_session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'interrupt_session', 'UTF8', None, ),  # 2
 )
 
 
-class sql_execute_result(object):
+class interrupt_result(object):
     """
     Attributes:
-     - success
      - e
 
     """
 
 
-    def __init__(self, success=None, e=None,):
-        self.success = success
+    def __init__(self, e=None,):
         self.e = e
 
     def read(self, iprot):
@@ -10573,13 +14225,7 @@ class sql_execute_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.STRUCT:
-                    self.success = TQueryResult()
-                    self.success.read(iprot)
-                else:
-                    iprot.skip(ftype)
-            elif fid == 1:
+            if fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -10594,11 +14240,7 @@ class sql_execute_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('sql_execute_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRUCT, 0)
-            self.success.write(oprot)
-            oprot.writeFieldEnd()
+        oprot.writeStructBegin('interrupt_result')
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -10619,33 +14261,25 @@ class sql_execute_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(sql_execute_result)
-sql_execute_result.thrift_spec = (
-    (0, TType.STRUCT, 'success', [TQueryResult, None], None, ),  # 0
+all_structs.append(interrupt_result)
+interrupt_result.thrift_spec = (
+    None,  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class sql_execute_df_args(object):
+class sql_validate_args(object):
     """
     Attributes:
      - session
      - query
-     - device_type
-     - device_id
-     - first_n
-     - transport_method
 
     """
 
 
-    def __init__(self, session=None, query=None, device_type=None, device_id=0, first_n=-1, transport_method=None,):
+    def __init__(self, session=None, query=None,):
         self.session = session
         self.query = query
-        self.device_type = device_type
-        self.device_id = device_id
-        self.first_n = first_n
-        self.transport_method = transport_method
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10666,26 +14300,6 @@ class sql_execute_df_args(object):
                     self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
-            elif fid == 3:
-                if ftype == TType.I32:
-                    self.device_type = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
-                if ftype == TType.I32:
-                    self.device_id = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 5:
-                if ftype == TType.I32:
-                    self.first_n = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 6:
-                if ftype == TType.I32:
-                    self.transport_method = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -10695,7 +14309,7 @@ class sql_execute_df_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('sql_execute_df_args')
+        oprot.writeStructBegin('sql_validate_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
@@ -10704,22 +14318,6 @@ class sql_execute_df_args(object):
             oprot.writeFieldBegin('query', TType.STRING, 2)
             oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
             oprot.writeFieldEnd()
-        if self.device_type is not None:
-            oprot.writeFieldBegin('device_type', TType.I32, 3)
-            oprot.writeI32(self.device_type)
-            oprot.writeFieldEnd()
-        if self.device_id is not None:
-            oprot.writeFieldBegin('device_id', TType.I32, 4)
-            oprot.writeI32(self.device_id)
-            oprot.writeFieldEnd()
-        if self.first_n is not None:
-            oprot.writeFieldBegin('first_n', TType.I32, 5)
-            oprot.writeI32(self.first_n)
-            oprot.writeFieldEnd()
-        if self.transport_method is not None:
-            oprot.writeFieldBegin('transport_method', TType.I32, 6)
-            oprot.writeI32(self.transport_method)
-            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -10736,19 +14334,15 @@ class sql_execute_df_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(sql_execute_df_args)
-sql_execute_df_args.thrift_spec = (
+all_structs.append(sql_validate_args)
+sql_validate_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
     (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
-    (3, TType.I32, 'device_type', None, None, ),  # 3
-    (4, TType.I32, 'device_id', None, 0, ),  # 4
-    (5, TType.I32, 'first_n', None, -1, ),  # 5
-    (6, TType.I32, 'transport_method', None, None, ),  # 6
 )
 
 
-class sql_execute_df_result(object):
+class sql_validate_result(object):
     """
     Attributes:
      - success
@@ -10771,9 +14365,14 @@ class sql_execute_df_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.STRUCT:
-                    self.success = TDataFrame()
-                    self.success.read(iprot)
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype370, _size367) = iprot.readListBegin()
+                    for _i371 in range(_size367):
+                        _elem372 = TColumnType()
+                        _elem372.read(iprot)
+                        self.success.append(_elem372)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 1:
@@ -10791,10 +14390,13 @@ class sql_execute_df_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('sql_execute_df_result')
+        oprot.writeStructBegin('sql_validate_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRUCT, 0)
-            self.success.write(oprot)
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter373 in self.success:
+                iter373.write(oprot)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
@@ -10816,29 +14418,27 @@ class sql_execute_df_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(sql_execute_df_result)
-sql_execute_df_result.thrift_spec = (
-    (0, TType.STRUCT, 'success', [TDataFrame, None], None, ),  # 0
+all_structs.append(sql_validate_result)
+sql_validate_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRUCT, [TColumnType, None], False), None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class sql_execute_gdf_args(object):
+class get_completion_hints_args(object):
     """
     Attributes:
      - session
-     - query
-     - device_id
-     - first_n
+     - sql
+     - cursor
 
     """
 
 
-    def __init__(self, session=None, query=None, device_id=0, first_n=-1,):
+    def __init__(self, session=None, sql=None, cursor=None,):
         self.session = session
-        self.query = query
-        self.device_id = device_id
-        self.first_n = first_n
+        self.sql = sql
+        self.cursor = cursor
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -10856,17 +14456,12 @@ class sql_execute_gdf_args(object):
                     iprot.skip(ftype)
             elif fid == 2:
                 if ftype == TType.STRING:
-                    self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.sql = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.I32:
-                    self.device_id = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
-                if ftype == TType.I32:
-                    self.first_n = iprot.readI32()
+                    self.cursor = iprot.readI32()
                 else:
                     iprot.skip(ftype)
             else:
@@ -10878,22 +14473,18 @@ class sql_execute_gdf_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('sql_execute_gdf_args')
+        oprot.writeStructBegin('get_completion_hints_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.query is not None:
-            oprot.writeFieldBegin('query', TType.STRING, 2)
-            oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
-            oprot.writeFieldEnd()
-        if self.device_id is not None:
-            oprot.writeFieldBegin('device_id', TType.I32, 3)
-            oprot.writeI32(self.device_id)
+        if self.sql is not None:
+            oprot.writeFieldBegin('sql', TType.STRING, 2)
+            oprot.writeString(self.sql.encode('utf-8') if sys.version_info[0] == 2 else self.sql)
             oprot.writeFieldEnd()
-        if self.first_n is not None:
-            oprot.writeFieldBegin('first_n', TType.I32, 4)
-            oprot.writeI32(self.first_n)
+        if self.cursor is not None:
+            oprot.writeFieldBegin('cursor', TType.I32, 3)
+            oprot.writeI32(self.cursor)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -10911,17 +14502,16 @@ class sql_execute_gdf_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(sql_execute_gdf_args)
-sql_execute_gdf_args.thrift_spec = (
+all_structs.append(get_completion_hints_args)
+get_completion_hints_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
-    (3, TType.I32, 'device_id', None, 0, ),  # 3
-    (4, TType.I32, 'first_n', None, -1, ),  # 4
+    (2, TType.STRING, 'sql', 'UTF8', None, ),  # 2
+    (3, TType.I32, 'cursor', None, None, ),  # 3
 )
 
 
-class sql_execute_gdf_result(object):
+class get_completion_hints_result(object):
     """
     Attributes:
      - success
@@ -10944,9 +14534,14 @@ class sql_execute_gdf_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.STRUCT:
-                    self.success = TDataFrame()
-                    self.success.read(iprot)
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype377, _size374) = iprot.readListBegin()
+                    for _i378 in range(_size374):
+                        _elem379 = omnisci.completion_hints.ttypes.TCompletionHint()
+                        _elem379.read(iprot)
+                        self.success.append(_elem379)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 1:
@@ -10964,10 +14559,13 @@ class sql_execute_gdf_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('sql_execute_gdf_result')
+        oprot.writeStructBegin('get_completion_hints_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRUCT, 0)
-            self.success.write(oprot)
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter380 in self.success:
+                iter380.write(oprot)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
@@ -10989,29 +14587,25 @@ class sql_execute_gdf_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(sql_execute_gdf_result)
-sql_execute_gdf_result.thrift_spec = (
-    (0, TType.STRUCT, 'success', [TDataFrame, None], None, ),  # 0
+all_structs.append(get_completion_hints_result)
+get_completion_hints_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRUCT, [omnisci.completion_hints.ttypes.TCompletionHint, None], False), None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class deallocate_df_args(object):
+class set_execution_mode_args(object):
     """
     Attributes:
      - session
-     - df
-     - device_type
-     - device_id
+     - mode
 
     """
 
 
-    def __init__(self, session=None, df=None, device_type=None, device_id=0,):
+    def __init__(self, session=None, mode=None,):
         self.session = session
-        self.df = df
-        self.device_type = device_type
-        self.device_id = device_id
+        self.mode = mode
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -11028,19 +14622,8 @@ class deallocate_df_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.STRUCT:
-                    self.df = TDataFrame()
-                    self.df.read(iprot)
-                else:
-                    iprot.skip(ftype)
-            elif fid == 3:
-                if ftype == TType.I32:
-                    self.device_type = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
                 if ftype == TType.I32:
-                    self.device_id = iprot.readI32()
+                    self.mode = iprot.readI32()
                 else:
                     iprot.skip(ftype)
             else:
@@ -11052,22 +14635,14 @@ class deallocate_df_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('deallocate_df_args')
+        oprot.writeStructBegin('set_execution_mode_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.df is not None:
-            oprot.writeFieldBegin('df', TType.STRUCT, 2)
-            self.df.write(oprot)
-            oprot.writeFieldEnd()
-        if self.device_type is not None:
-            oprot.writeFieldBegin('device_type', TType.I32, 3)
-            oprot.writeI32(self.device_type)
-            oprot.writeFieldEnd()
-        if self.device_id is not None:
-            oprot.writeFieldBegin('device_id', TType.I32, 4)
-            oprot.writeI32(self.device_id)
+        if self.mode is not None:
+            oprot.writeFieldBegin('mode', TType.I32, 2)
+            oprot.writeI32(self.mode)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -11085,17 +14660,15 @@ class deallocate_df_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(deallocate_df_args)
-deallocate_df_args.thrift_spec = (
+all_structs.append(set_execution_mode_args)
+set_execution_mode_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.STRUCT, 'df', [TDataFrame, None], None, ),  # 2
-    (3, TType.I32, 'device_type', None, None, ),  # 3
-    (4, TType.I32, 'device_id', None, 0, ),  # 4
+    (2, TType.I32, 'mode', None, None, ),  # 2
 )
 
 
-class deallocate_df_result(object):
+class set_execution_mode_result(object):
     """
     Attributes:
      - e
@@ -11130,7 +14703,7 @@ class deallocate_df_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('deallocate_df_result')
+        oprot.writeStructBegin('set_execution_mode_result')
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -11151,25 +14724,31 @@ class deallocate_df_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(deallocate_df_result)
-deallocate_df_result.thrift_spec = (
+all_structs.append(set_execution_mode_result)
+set_execution_mode_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class interrupt_args(object):
+class render_vega_args(object):
     """
     Attributes:
-     - query_session
-     - interrupt_session
+     - session
+     - widget_id
+     - vega_json
+     - compression_level
+     - nonce
 
     """
 
 
-    def __init__(self, query_session=None, interrupt_session=None,):
-        self.query_session = query_session
-        self.interrupt_session = interrupt_session
+    def __init__(self, session=None, widget_id=None, vega_json=None, compression_level=None, nonce=None,):
+        self.session = session
+        self.widget_id = widget_id
+        self.vega_json = vega_json
+        self.compression_level = compression_level
+        self.nonce = nonce
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -11182,12 +14761,27 @@ class interrupt_args(object):
                 break
             if fid == 1:
                 if ftype == TType.STRING:
-                    self.query_session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
+                if ftype == TType.I64:
+                    self.widget_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
                 if ftype == TType.STRING:
-                    self.interrupt_session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.vega_json = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.compression_level = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.STRING:
+                    self.nonce = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             else:
@@ -11199,14 +14793,26 @@ class interrupt_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('interrupt_args')
-        if self.query_session is not None:
-            oprot.writeFieldBegin('query_session', TType.STRING, 1)
-            oprot.writeString(self.query_session.encode('utf-8') if sys.version_info[0] == 2 else self.query_session)
+        oprot.writeStructBegin('render_vega_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.interrupt_session is not None:
-            oprot.writeFieldBegin('interrupt_session', TType.STRING, 2)
-            oprot.writeString(self.interrupt_session.encode('utf-8') if sys.version_info[0] == 2 else self.interrupt_session)
+        if self.widget_id is not None:
+            oprot.writeFieldBegin('widget_id', TType.I64, 2)
+            oprot.writeI64(self.widget_id)
+            oprot.writeFieldEnd()
+        if self.vega_json is not None:
+            oprot.writeFieldBegin('vega_json', TType.STRING, 3)
+            oprot.writeString(self.vega_json.encode('utf-8') if sys.version_info[0] == 2 else self.vega_json)
+            oprot.writeFieldEnd()
+        if self.compression_level is not None:
+            oprot.writeFieldBegin('compression_level', TType.I32, 4)
+            oprot.writeI32(self.compression_level)
+            oprot.writeFieldEnd()
+        if self.nonce is not None:
+            oprot.writeFieldBegin('nonce', TType.STRING, 5)
+            oprot.writeString(self.nonce.encode('utf-8') if sys.version_info[0] == 2 else self.nonce)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -11224,23 +14830,28 @@ class interrupt_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(interrupt_args)
-interrupt_args.thrift_spec = (
+all_structs.append(render_vega_args)
+render_vega_args.thrift_spec = (
     None,  # 0
-    (1, TType.STRING, 'query_session', 'UTF8', None, ),  # 1
-    (2, TType.STRING, 'interrupt_session', 'UTF8', None, ),  # 2
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.I64, 'widget_id', None, None, ),  # 2
+    (3, TType.STRING, 'vega_json', 'UTF8', None, ),  # 3
+    (4, TType.I32, 'compression_level', None, None, ),  # 4
+    (5, TType.STRING, 'nonce', 'UTF8', None, ),  # 5
 )
 
 
-class interrupt_result(object):
+class render_vega_result(object):
     """
     Attributes:
+     - success
      - e
 
     """
 
 
-    def __init__(self, e=None,):
+    def __init__(self, success=None, e=None,):
+        self.success = success
         self.e = e
 
     def read(self, iprot):
@@ -11252,7 +14863,13 @@ class interrupt_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.STRUCT:
+                    self.success = TRenderResult()
+                    self.success.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -11267,7 +14884,11 @@ class interrupt_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('interrupt_result')
+        oprot.writeStructBegin('render_vega_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
+            oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -11288,25 +14909,35 @@ class interrupt_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(interrupt_result)
-interrupt_result.thrift_spec = (
-    None,  # 0
+all_structs.append(render_vega_result)
+render_vega_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TRenderResult, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class sql_validate_args(object):
+class get_result_row_for_pixel_args(object):
     """
     Attributes:
      - session
-     - query
+     - widget_id
+     - pixel
+     - table_col_names
+     - column_format
+     - pixelRadius
+     - nonce
 
     """
 
 
-    def __init__(self, session=None, query=None,):
+    def __init__(self, session=None, widget_id=None, pixel=None, table_col_names=None, column_format=None, pixelRadius=None, nonce=None,):
         self.session = session
-        self.query = query
+        self.widget_id = widget_id
+        self.pixel = pixel
+        self.table_col_names = table_col_names
+        self.column_format = column_format
+        self.pixelRadius = pixelRadius
+        self.nonce = nonce
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -11323,8 +14954,45 @@ class sql_validate_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
+                if ftype == TType.I64:
+                    self.widget_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.pixel = TPixel()
+                    self.pixel.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.MAP:
+                    self.table_col_names = {}
+                    (_ktype382, _vtype383, _size381) = iprot.readMapBegin()
+                    for _i385 in range(_size381):
+                        _key386 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val387 = []
+                        (_etype391, _size388) = iprot.readListBegin()
+                        for _i392 in range(_size388):
+                            _elem393 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                            _val387.append(_elem393)
+                        iprot.readListEnd()
+                        self.table_col_names[_key386] = _val387
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.BOOL:
+                    self.column_format = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.pixelRadius = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
                 if ftype == TType.STRING:
-                    self.query = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.nonce = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             else:
@@ -11336,14 +15004,41 @@ class sql_validate_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('sql_validate_args')
+        oprot.writeStructBegin('get_result_row_for_pixel_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.query is not None:
-            oprot.writeFieldBegin('query', TType.STRING, 2)
-            oprot.writeString(self.query.encode('utf-8') if sys.version_info[0] == 2 else self.query)
+        if self.widget_id is not None:
+            oprot.writeFieldBegin('widget_id', TType.I64, 2)
+            oprot.writeI64(self.widget_id)
+            oprot.writeFieldEnd()
+        if self.pixel is not None:
+            oprot.writeFieldBegin('pixel', TType.STRUCT, 3)
+            self.pixel.write(oprot)
+            oprot.writeFieldEnd()
+        if self.table_col_names is not None:
+            oprot.writeFieldBegin('table_col_names', TType.MAP, 4)
+            oprot.writeMapBegin(TType.STRING, TType.LIST, len(self.table_col_names))
+            for kiter394, viter395 in self.table_col_names.items():
+                oprot.writeString(kiter394.encode('utf-8') if sys.version_info[0] == 2 else kiter394)
+                oprot.writeListBegin(TType.STRING, len(viter395))
+                for iter396 in viter395:
+                    oprot.writeString(iter396.encode('utf-8') if sys.version_info[0] == 2 else iter396)
+                oprot.writeListEnd()
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        if self.column_format is not None:
+            oprot.writeFieldBegin('column_format', TType.BOOL, 5)
+            oprot.writeBool(self.column_format)
+            oprot.writeFieldEnd()
+        if self.pixelRadius is not None:
+            oprot.writeFieldBegin('pixelRadius', TType.I32, 6)
+            oprot.writeI32(self.pixelRadius)
+            oprot.writeFieldEnd()
+        if self.nonce is not None:
+            oprot.writeFieldBegin('nonce', TType.STRING, 7)
+            oprot.writeString(self.nonce.encode('utf-8') if sys.version_info[0] == 2 else self.nonce)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -11361,15 +15056,20 @@ class sql_validate_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(sql_validate_args)
-sql_validate_args.thrift_spec = (
+all_structs.append(get_result_row_for_pixel_args)
+get_result_row_for_pixel_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.STRING, 'query', 'UTF8', None, ),  # 2
+    (2, TType.I64, 'widget_id', None, None, ),  # 2
+    (3, TType.STRUCT, 'pixel', [TPixel, None], None, ),  # 3
+    (4, TType.MAP, 'table_col_names', (TType.STRING, 'UTF8', TType.LIST, (TType.STRING, 'UTF8', False), False), None, ),  # 4
+    (5, TType.BOOL, 'column_format', None, None, ),  # 5
+    (6, TType.I32, 'pixelRadius', None, None, ),  # 6
+    (7, TType.STRING, 'nonce', 'UTF8', None, ),  # 7
 )
 
 
-class sql_validate_result(object):
+class get_result_row_for_pixel_result(object):
     """
     Attributes:
      - success
@@ -11392,14 +15092,9 @@ class sql_validate_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.LIST:
-                    self.success = []
-                    (_etype328, _size325) = iprot.readListBegin()
-                    for _i329 in range(_size325):
-                        _elem330 = TColumnType()
-                        _elem330.read(iprot)
-                        self.success.append(_elem330)
-                    iprot.readListEnd()
+                if ftype == TType.STRUCT:
+                    self.success = TPixelTableRowResult()
+                    self.success.read(iprot)
                 else:
                     iprot.skip(ftype)
             elif fid == 1:
@@ -11417,13 +15112,10 @@ class sql_validate_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('sql_validate_result')
+        oprot.writeStructBegin('get_result_row_for_pixel_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter331 in self.success:
-                iter331.write(oprot)
-            oprot.writeListEnd()
+            oprot.writeFieldBegin('success', TType.STRUCT, 0)
+            self.success.write(oprot)
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
@@ -11445,27 +15137,25 @@ class sql_validate_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(sql_validate_result)
-sql_validate_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.STRUCT, [TColumnType, None], False), None, ),  # 0
+all_structs.append(get_result_row_for_pixel_result)
+get_result_row_for_pixel_result.thrift_spec = (
+    (0, TType.STRUCT, 'success', [TPixelTableRowResult, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_completion_hints_args(object):
+class create_custom_expression_args(object):
     """
     Attributes:
      - session
-     - sql
-     - cursor
+     - custom_expression
 
     """
 
 
-    def __init__(self, session=None, sql=None, cursor=None,):
+    def __init__(self, session=None, custom_expression=None,):
         self.session = session
-        self.sql = sql
-        self.cursor = cursor
+        self.custom_expression = custom_expression
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -11482,13 +15172,9 @@ class get_completion_hints_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.STRING:
-                    self.sql = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 3:
-                if ftype == TType.I32:
-                    self.cursor = iprot.readI32()
+                if ftype == TType.STRUCT:
+                    self.custom_expression = TCustomExpression()
+                    self.custom_expression.read(iprot)
                 else:
                     iprot.skip(ftype)
             else:
@@ -11500,18 +15186,14 @@ class get_completion_hints_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_completion_hints_args')
+        oprot.writeStructBegin('create_custom_expression_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.sql is not None:
-            oprot.writeFieldBegin('sql', TType.STRING, 2)
-            oprot.writeString(self.sql.encode('utf-8') if sys.version_info[0] == 2 else self.sql)
-            oprot.writeFieldEnd()
-        if self.cursor is not None:
-            oprot.writeFieldBegin('cursor', TType.I32, 3)
-            oprot.writeI32(self.cursor)
+        if self.custom_expression is not None:
+            oprot.writeFieldBegin('custom_expression', TType.STRUCT, 2)
+            self.custom_expression.write(oprot)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -11529,16 +15211,15 @@ class get_completion_hints_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_completion_hints_args)
-get_completion_hints_args.thrift_spec = (
+all_structs.append(create_custom_expression_args)
+create_custom_expression_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.STRING, 'sql', 'UTF8', None, ),  # 2
-    (3, TType.I32, 'cursor', None, None, ),  # 3
+    (2, TType.STRUCT, 'custom_expression', [TCustomExpression, None], None, ),  # 2
 )
 
 
-class get_completion_hints_result(object):
+class create_custom_expression_result(object):
     """
     Attributes:
      - success
@@ -11561,14 +15242,8 @@ class get_completion_hints_result(object):
             if ftype == TType.STOP:
                 break
             if fid == 0:
-                if ftype == TType.LIST:
-                    self.success = []
-                    (_etype335, _size332) = iprot.readListBegin()
-                    for _i336 in range(_size332):
-                        _elem337 = omnisci.completion_hints.ttypes.TCompletionHint()
-                        _elem337.read(iprot)
-                        self.success.append(_elem337)
-                    iprot.readListEnd()
+                if ftype == TType.I32:
+                    self.success = iprot.readI32()
                 else:
                     iprot.skip(ftype)
             elif fid == 1:
@@ -11586,13 +15261,10 @@ class get_completion_hints_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_completion_hints_result')
+        oprot.writeStructBegin('create_custom_expression_result')
         if self.success is not None:
-            oprot.writeFieldBegin('success', TType.LIST, 0)
-            oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter338 in self.success:
-                iter338.write(oprot)
-            oprot.writeListEnd()
+            oprot.writeFieldBegin('success', TType.I32, 0)
+            oprot.writeI32(self.success)
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
@@ -11614,25 +15286,23 @@ class get_completion_hints_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_completion_hints_result)
-get_completion_hints_result.thrift_spec = (
-    (0, TType.LIST, 'success', (TType.STRUCT, [omnisci.completion_hints.ttypes.TCompletionHint, None], False), None, ),  # 0
+all_structs.append(create_custom_expression_result)
+create_custom_expression_result.thrift_spec = (
+    (0, TType.I32, 'success', None, None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class set_execution_mode_args(object):
+class get_custom_expressions_args(object):
     """
     Attributes:
      - session
-     - mode
 
     """
 
 
-    def __init__(self, session=None, mode=None,):
+    def __init__(self, session=None,):
         self.session = session
-        self.mode = mode
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -11648,11 +15318,6 @@ class set_execution_mode_args(object):
                     self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
-            elif fid == 2:
-                if ftype == TType.I32:
-                    self.mode = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -11662,15 +15327,11 @@ class set_execution_mode_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('set_execution_mode_args')
+        oprot.writeStructBegin('get_custom_expressions_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.mode is not None:
-            oprot.writeFieldBegin('mode', TType.I32, 2)
-            oprot.writeI32(self.mode)
-            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -11687,23 +15348,24 @@ class set_execution_mode_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(set_execution_mode_args)
-set_execution_mode_args.thrift_spec = (
+all_structs.append(get_custom_expressions_args)
+get_custom_expressions_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.I32, 'mode', None, None, ),  # 2
 )
 
 
-class set_execution_mode_result(object):
+class get_custom_expressions_result(object):
     """
     Attributes:
+     - success
      - e
 
     """
 
 
-    def __init__(self, e=None,):
+    def __init__(self, success=None, e=None,):
+        self.success = success
         self.e = e
 
     def read(self, iprot):
@@ -11715,7 +15377,18 @@ class set_execution_mode_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 1:
+            if fid == 0:
+                if ftype == TType.LIST:
+                    self.success = []
+                    (_etype400, _size397) = iprot.readListBegin()
+                    for _i401 in range(_size397):
+                        _elem402 = TCustomExpression()
+                        _elem402.read(iprot)
+                        self.success.append(_elem402)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -11730,7 +15403,14 @@ class set_execution_mode_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('set_execution_mode_result')
+        oprot.writeStructBegin('get_custom_expressions_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.LIST, 0)
+            oprot.writeListBegin(TType.STRUCT, len(self.success))
+            for iter403 in self.success:
+                iter403.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -11751,31 +15431,27 @@ class set_execution_mode_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(set_execution_mode_result)
-set_execution_mode_result.thrift_spec = (
-    None,  # 0
+all_structs.append(get_custom_expressions_result)
+get_custom_expressions_result.thrift_spec = (
+    (0, TType.LIST, 'success', (TType.STRUCT, [TCustomExpression, None], False), None, ),  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class render_vega_args(object):
+class update_custom_expression_args(object):
     """
     Attributes:
      - session
-     - widget_id
-     - vega_json
-     - compression_level
-     - nonce
+     - id
+     - expression_json
 
     """
 
 
-    def __init__(self, session=None, widget_id=None, vega_json=None, compression_level=None, nonce=None,):
+    def __init__(self, session=None, id=None, expression_json=None,):
         self.session = session
-        self.widget_id = widget_id
-        self.vega_json = vega_json
-        self.compression_level = compression_level
-        self.nonce = nonce
+        self.id = id
+        self.expression_json = expression_json
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -11792,23 +15468,13 @@ class render_vega_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.I64:
-                    self.widget_id = iprot.readI64()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 3:
-                if ftype == TType.STRING:
-                    self.vega_json = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
                 if ftype == TType.I32:
-                    self.compression_level = iprot.readI32()
+                    self.id = iprot.readI32()
                 else:
                     iprot.skip(ftype)
-            elif fid == 5:
+            elif fid == 3:
                 if ftype == TType.STRING:
-                    self.nonce = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.expression_json = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
                 else:
                     iprot.skip(ftype)
             else:
@@ -11820,26 +15486,18 @@ class render_vega_args(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('render_vega_args')
+        oprot.writeStructBegin('update_custom_expression_args')
         if self.session is not None:
             oprot.writeFieldBegin('session', TType.STRING, 1)
             oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.widget_id is not None:
-            oprot.writeFieldBegin('widget_id', TType.I64, 2)
-            oprot.writeI64(self.widget_id)
-            oprot.writeFieldEnd()
-        if self.vega_json is not None:
-            oprot.writeFieldBegin('vega_json', TType.STRING, 3)
-            oprot.writeString(self.vega_json.encode('utf-8') if sys.version_info[0] == 2 else self.vega_json)
-            oprot.writeFieldEnd()
-        if self.compression_level is not None:
-            oprot.writeFieldBegin('compression_level', TType.I32, 4)
-            oprot.writeI32(self.compression_level)
+        if self.id is not None:
+            oprot.writeFieldBegin('id', TType.I32, 2)
+            oprot.writeI32(self.id)
             oprot.writeFieldEnd()
-        if self.nonce is not None:
-            oprot.writeFieldBegin('nonce', TType.STRING, 5)
-            oprot.writeString(self.nonce.encode('utf-8') if sys.version_info[0] == 2 else self.nonce)
+        if self.expression_json is not None:
+            oprot.writeFieldBegin('expression_json', TType.STRING, 3)
+            oprot.writeString(self.expression_json.encode('utf-8') if sys.version_info[0] == 2 else self.expression_json)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -11857,28 +15515,24 @@ class render_vega_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(render_vega_args)
-render_vega_args.thrift_spec = (
+all_structs.append(update_custom_expression_args)
+update_custom_expression_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.I64, 'widget_id', None, None, ),  # 2
-    (3, TType.STRING, 'vega_json', 'UTF8', None, ),  # 3
-    (4, TType.I32, 'compression_level', None, None, ),  # 4
-    (5, TType.STRING, 'nonce', 'UTF8', None, ),  # 5
+    (2, TType.I32, 'id', None, None, ),  # 2
+    (3, TType.STRING, 'expression_json', 'UTF8', None, ),  # 3
 )
 
 
-class render_vega_result(object):
+class update_custom_expression_result(object):
     """
     Attributes:
-     - success
      - e
 
     """
 
 
-    def __init__(self, success=None, e=None,):
-        self.success = success
+    def __init__(self, e=None,):
         self.e = e
 
     def read(self, iprot):
@@ -11890,13 +15544,7 @@ class render_vega_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.STRUCT:
-                    self.success = TRenderResult()
-                    self.success.read(iprot)
-                else:
-                    iprot.skip(ftype)
-            elif fid == 1:
+            if fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -11911,11 +15559,7 @@ class render_vega_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('render_vega_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRUCT, 0)
-            self.success.write(oprot)
-            oprot.writeFieldEnd()
+        oprot.writeStructBegin('update_custom_expression_result')
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -11936,35 +15580,27 @@ class render_vega_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(render_vega_result)
-render_vega_result.thrift_spec = (
-    (0, TType.STRUCT, 'success', [TRenderResult, None], None, ),  # 0
+all_structs.append(update_custom_expression_result)
+update_custom_expression_result.thrift_spec = (
+    None,  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
 
-class get_result_row_for_pixel_args(object):
+class delete_custom_expressions_args(object):
     """
     Attributes:
      - session
-     - widget_id
-     - pixel
-     - table_col_names
-     - column_format
-     - pixelRadius
-     - nonce
+     - custom_expression_ids
+     - do_soft_delete
 
     """
 
 
-    def __init__(self, session=None, widget_id=None, pixel=None, table_col_names=None, column_format=None, pixelRadius=None, nonce=None,):
+    def __init__(self, session=None, custom_expression_ids=None, do_soft_delete=None,):
         self.session = session
-        self.widget_id = widget_id
-        self.pixel = pixel
-        self.table_col_names = table_col_names
-        self.column_format = column_format
-        self.pixelRadius = pixelRadius
-        self.nonce = nonce
+        self.custom_expression_ids = custom_expression_ids
+        self.do_soft_delete = do_soft_delete
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -11981,91 +15617,44 @@ class get_result_row_for_pixel_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.I64:
-                    self.widget_id = iprot.readI64()
+                if ftype == TType.LIST:
+                    self.custom_expression_ids = []
+                    (_etype407, _size404) = iprot.readListBegin()
+                    for _i408 in range(_size404):
+                        _elem409 = iprot.readI32()
+                        self.custom_expression_ids.append(_elem409)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
-                if ftype == TType.STRUCT:
-                    self.pixel = TPixel()
-                    self.pixel.read(iprot)
-                else:
-                    iprot.skip(ftype)
-            elif fid == 4:
-                if ftype == TType.MAP:
-                    self.table_col_names = {}
-                    (_ktype340, _vtype341, _size339) = iprot.readMapBegin()
-                    for _i343 in range(_size339):
-                        _key344 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val345 = []
-                        (_etype349, _size346) = iprot.readListBegin()
-                        for _i350 in range(_size346):
-                            _elem351 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                            _val345.append(_elem351)
-                        iprot.readListEnd()
-                        self.table_col_names[_key344] = _val345
-                    iprot.readMapEnd()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 5:
                 if ftype == TType.BOOL:
-                    self.column_format = iprot.readBool()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 6:
-                if ftype == TType.I32:
-                    self.pixelRadius = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 7:
-                if ftype == TType.STRING:
-                    self.nonce = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                    self.do_soft_delete = iprot.readBool()
                 else:
-                    iprot.skip(ftype)
-            else:
-                iprot.skip(ftype)
-            iprot.readFieldEnd()
-        iprot.readStructEnd()
-
-    def write(self, oprot):
-        if oprot._fast_encode is not None and self.thrift_spec is not None:
-            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
-            return
-        oprot.writeStructBegin('get_result_row_for_pixel_args')
-        if self.session is not None:
-            oprot.writeFieldBegin('session', TType.STRING, 1)
-            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
-            oprot.writeFieldEnd()
-        if self.widget_id is not None:
-            oprot.writeFieldBegin('widget_id', TType.I64, 2)
-            oprot.writeI64(self.widget_id)
-            oprot.writeFieldEnd()
-        if self.pixel is not None:
-            oprot.writeFieldBegin('pixel', TType.STRUCT, 3)
-            self.pixel.write(oprot)
-            oprot.writeFieldEnd()
-        if self.table_col_names is not None:
-            oprot.writeFieldBegin('table_col_names', TType.MAP, 4)
-            oprot.writeMapBegin(TType.STRING, TType.LIST, len(self.table_col_names))
-            for kiter352, viter353 in self.table_col_names.items():
-                oprot.writeString(kiter352.encode('utf-8') if sys.version_info[0] == 2 else kiter352)
-                oprot.writeListBegin(TType.STRING, len(viter353))
-                for iter354 in viter353:
-                    oprot.writeString(iter354.encode('utf-8') if sys.version_info[0] == 2 else iter354)
-                oprot.writeListEnd()
-            oprot.writeMapEnd()
-            oprot.writeFieldEnd()
-        if self.column_format is not None:
-            oprot.writeFieldBegin('column_format', TType.BOOL, 5)
-            oprot.writeBool(self.column_format)
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('delete_custom_expressions_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
             oprot.writeFieldEnd()
-        if self.pixelRadius is not None:
-            oprot.writeFieldBegin('pixelRadius', TType.I32, 6)
-            oprot.writeI32(self.pixelRadius)
+        if self.custom_expression_ids is not None:
+            oprot.writeFieldBegin('custom_expression_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I32, len(self.custom_expression_ids))
+            for iter410 in self.custom_expression_ids:
+                oprot.writeI32(iter410)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
-        if self.nonce is not None:
-            oprot.writeFieldBegin('nonce', TType.STRING, 7)
-            oprot.writeString(self.nonce.encode('utf-8') if sys.version_info[0] == 2 else self.nonce)
+        if self.do_soft_delete is not None:
+            oprot.writeFieldBegin('do_soft_delete', TType.BOOL, 3)
+            oprot.writeBool(self.do_soft_delete)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -12083,30 +15672,24 @@ class get_result_row_for_pixel_args(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_result_row_for_pixel_args)
-get_result_row_for_pixel_args.thrift_spec = (
+all_structs.append(delete_custom_expressions_args)
+delete_custom_expressions_args.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
-    (2, TType.I64, 'widget_id', None, None, ),  # 2
-    (3, TType.STRUCT, 'pixel', [TPixel, None], None, ),  # 3
-    (4, TType.MAP, 'table_col_names', (TType.STRING, 'UTF8', TType.LIST, (TType.STRING, 'UTF8', False), False), None, ),  # 4
-    (5, TType.BOOL, 'column_format', None, None, ),  # 5
-    (6, TType.I32, 'pixelRadius', None, None, ),  # 6
-    (7, TType.STRING, 'nonce', 'UTF8', None, ),  # 7
+    (2, TType.LIST, 'custom_expression_ids', (TType.I32, None, False), None, ),  # 2
+    (3, TType.BOOL, 'do_soft_delete', None, None, ),  # 3
 )
 
 
-class get_result_row_for_pixel_result(object):
+class delete_custom_expressions_result(object):
     """
     Attributes:
-     - success
      - e
 
     """
 
 
-    def __init__(self, success=None, e=None,):
-        self.success = success
+    def __init__(self, e=None,):
         self.e = e
 
     def read(self, iprot):
@@ -12118,13 +15701,7 @@ class get_result_row_for_pixel_result(object):
             (fname, ftype, fid) = iprot.readFieldBegin()
             if ftype == TType.STOP:
                 break
-            if fid == 0:
-                if ftype == TType.STRUCT:
-                    self.success = TPixelTableRowResult()
-                    self.success.read(iprot)
-                else:
-                    iprot.skip(ftype)
-            elif fid == 1:
+            if fid == 1:
                 if ftype == TType.STRUCT:
                     self.e = TOmniSciException()
                     self.e.read(iprot)
@@ -12139,11 +15716,7 @@ class get_result_row_for_pixel_result(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('get_result_row_for_pixel_result')
-        if self.success is not None:
-            oprot.writeFieldBegin('success', TType.STRUCT, 0)
-            self.success.write(oprot)
-            oprot.writeFieldEnd()
+        oprot.writeStructBegin('delete_custom_expressions_result')
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
@@ -12164,9 +15737,9 @@ class get_result_row_for_pixel_result(object):
 
     def __ne__(self, other):
         return not (self == other)
-all_structs.append(get_result_row_for_pixel_result)
-get_result_row_for_pixel_result.thrift_spec = (
-    (0, TType.STRUCT, 'success', [TPixelTableRowResult, None], None, ),  # 0
+all_structs.append(delete_custom_expressions_result)
+delete_custom_expressions_result.thrift_spec = (
+    None,  # 0
     (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
 )
 
@@ -12407,11 +15980,11 @@ class get_dashboards_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype358, _size355) = iprot.readListBegin()
-                    for _i359 in range(_size355):
-                        _elem360 = TDashboard()
-                        _elem360.read(iprot)
-                        self.success.append(_elem360)
+                    (_etype414, _size411) = iprot.readListBegin()
+                    for _i415 in range(_size411):
+                        _elem416 = TDashboard()
+                        _elem416.read(iprot)
+                        self.success.append(_elem416)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -12434,8 +16007,8 @@ class get_dashboards_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter361 in self.success:
-                iter361.write(oprot)
+            for iter417 in self.success:
+                iter417.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -13017,20 +16590,20 @@ class share_dashboards_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.dashboard_ids = []
-                    (_etype365, _size362) = iprot.readListBegin()
-                    for _i366 in range(_size362):
-                        _elem367 = iprot.readI32()
-                        self.dashboard_ids.append(_elem367)
+                    (_etype421, _size418) = iprot.readListBegin()
+                    for _i422 in range(_size418):
+                        _elem423 = iprot.readI32()
+                        self.dashboard_ids.append(_elem423)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.groups = []
-                    (_etype371, _size368) = iprot.readListBegin()
-                    for _i372 in range(_size368):
-                        _elem373 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.groups.append(_elem373)
+                    (_etype427, _size424) = iprot.readListBegin()
+                    for _i428 in range(_size424):
+                        _elem429 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.groups.append(_elem429)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -13057,15 +16630,15 @@ class share_dashboards_args(object):
         if self.dashboard_ids is not None:
             oprot.writeFieldBegin('dashboard_ids', TType.LIST, 2)
             oprot.writeListBegin(TType.I32, len(self.dashboard_ids))
-            for iter374 in self.dashboard_ids:
-                oprot.writeI32(iter374)
+            for iter430 in self.dashboard_ids:
+                oprot.writeI32(iter430)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.groups is not None:
             oprot.writeFieldBegin('groups', TType.LIST, 3)
             oprot.writeListBegin(TType.STRING, len(self.groups))
-            for iter375 in self.groups:
-                oprot.writeString(iter375.encode('utf-8') if sys.version_info[0] == 2 else iter375)
+            for iter431 in self.groups:
+                oprot.writeString(iter431.encode('utf-8') if sys.version_info[0] == 2 else iter431)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.permissions is not None:
@@ -13191,10 +16764,10 @@ class delete_dashboards_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.dashboard_ids = []
-                    (_etype379, _size376) = iprot.readListBegin()
-                    for _i380 in range(_size376):
-                        _elem381 = iprot.readI32()
-                        self.dashboard_ids.append(_elem381)
+                    (_etype435, _size432) = iprot.readListBegin()
+                    for _i436 in range(_size432):
+                        _elem437 = iprot.readI32()
+                        self.dashboard_ids.append(_elem437)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -13215,8 +16788,8 @@ class delete_dashboards_args(object):
         if self.dashboard_ids is not None:
             oprot.writeFieldBegin('dashboard_ids', TType.LIST, 2)
             oprot.writeListBegin(TType.I32, len(self.dashboard_ids))
-            for iter382 in self.dashboard_ids:
-                oprot.writeI32(iter382)
+            for iter438 in self.dashboard_ids:
+                oprot.writeI32(iter438)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -13349,20 +16922,20 @@ class share_dashboard_args(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.groups = []
-                    (_etype386, _size383) = iprot.readListBegin()
-                    for _i387 in range(_size383):
-                        _elem388 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.groups.append(_elem388)
+                    (_etype442, _size439) = iprot.readListBegin()
+                    for _i443 in range(_size439):
+                        _elem444 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.groups.append(_elem444)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.objects = []
-                    (_etype392, _size389) = iprot.readListBegin()
-                    for _i393 in range(_size389):
-                        _elem394 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.objects.append(_elem394)
+                    (_etype448, _size445) = iprot.readListBegin()
+                    for _i449 in range(_size445):
+                        _elem450 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.objects.append(_elem450)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -13398,15 +16971,15 @@ class share_dashboard_args(object):
         if self.groups is not None:
             oprot.writeFieldBegin('groups', TType.LIST, 3)
             oprot.writeListBegin(TType.STRING, len(self.groups))
-            for iter395 in self.groups:
-                oprot.writeString(iter395.encode('utf-8') if sys.version_info[0] == 2 else iter395)
+            for iter451 in self.groups:
+                oprot.writeString(iter451.encode('utf-8') if sys.version_info[0] == 2 else iter451)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.objects is not None:
             oprot.writeFieldBegin('objects', TType.LIST, 4)
             oprot.writeListBegin(TType.STRING, len(self.objects))
-            for iter396 in self.objects:
-                oprot.writeString(iter396.encode('utf-8') if sys.version_info[0] == 2 else iter396)
+            for iter452 in self.objects:
+                oprot.writeString(iter452.encode('utf-8') if sys.version_info[0] == 2 else iter452)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.permissions is not None:
@@ -13549,20 +17122,20 @@ class unshare_dashboard_args(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.groups = []
-                    (_etype400, _size397) = iprot.readListBegin()
-                    for _i401 in range(_size397):
-                        _elem402 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.groups.append(_elem402)
+                    (_etype456, _size453) = iprot.readListBegin()
+                    for _i457 in range(_size453):
+                        _elem458 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.groups.append(_elem458)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.objects = []
-                    (_etype406, _size403) = iprot.readListBegin()
-                    for _i407 in range(_size403):
-                        _elem408 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.objects.append(_elem408)
+                    (_etype462, _size459) = iprot.readListBegin()
+                    for _i463 in range(_size459):
+                        _elem464 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.objects.append(_elem464)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -13593,15 +17166,15 @@ class unshare_dashboard_args(object):
         if self.groups is not None:
             oprot.writeFieldBegin('groups', TType.LIST, 3)
             oprot.writeListBegin(TType.STRING, len(self.groups))
-            for iter409 in self.groups:
-                oprot.writeString(iter409.encode('utf-8') if sys.version_info[0] == 2 else iter409)
+            for iter465 in self.groups:
+                oprot.writeString(iter465.encode('utf-8') if sys.version_info[0] == 2 else iter465)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.objects is not None:
             oprot.writeFieldBegin('objects', TType.LIST, 4)
             oprot.writeListBegin(TType.STRING, len(self.objects))
-            for iter410 in self.objects:
-                oprot.writeString(iter410.encode('utf-8') if sys.version_info[0] == 2 else iter410)
+            for iter466 in self.objects:
+                oprot.writeString(iter466.encode('utf-8') if sys.version_info[0] == 2 else iter466)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.permissions is not None:
@@ -13732,20 +17305,20 @@ class unshare_dashboards_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.dashboard_ids = []
-                    (_etype414, _size411) = iprot.readListBegin()
-                    for _i415 in range(_size411):
-                        _elem416 = iprot.readI32()
-                        self.dashboard_ids.append(_elem416)
+                    (_etype470, _size467) = iprot.readListBegin()
+                    for _i471 in range(_size467):
+                        _elem472 = iprot.readI32()
+                        self.dashboard_ids.append(_elem472)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.groups = []
-                    (_etype420, _size417) = iprot.readListBegin()
-                    for _i421 in range(_size417):
-                        _elem422 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.groups.append(_elem422)
+                    (_etype476, _size473) = iprot.readListBegin()
+                    for _i477 in range(_size473):
+                        _elem478 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.groups.append(_elem478)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -13772,15 +17345,15 @@ class unshare_dashboards_args(object):
         if self.dashboard_ids is not None:
             oprot.writeFieldBegin('dashboard_ids', TType.LIST, 2)
             oprot.writeListBegin(TType.I32, len(self.dashboard_ids))
-            for iter423 in self.dashboard_ids:
-                oprot.writeI32(iter423)
+            for iter479 in self.dashboard_ids:
+                oprot.writeI32(iter479)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.groups is not None:
             oprot.writeFieldBegin('groups', TType.LIST, 3)
             oprot.writeListBegin(TType.STRING, len(self.groups))
-            for iter424 in self.groups:
-                oprot.writeString(iter424.encode('utf-8') if sys.version_info[0] == 2 else iter424)
+            for iter480 in self.groups:
+                oprot.writeString(iter480.encode('utf-8') if sys.version_info[0] == 2 else iter480)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.permissions is not None:
@@ -13975,11 +17548,11 @@ class get_dashboard_grantees_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype428, _size425) = iprot.readListBegin()
-                    for _i429 in range(_size425):
-                        _elem430 = TDashboardGrantees()
-                        _elem430.read(iprot)
-                        self.success.append(_elem430)
+                    (_etype484, _size481) = iprot.readListBegin()
+                    for _i485 in range(_size481):
+                        _elem486 = TDashboardGrantees()
+                        _elem486.read(iprot)
+                        self.success.append(_elem486)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -14002,8 +17575,8 @@ class get_dashboard_grantees_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter431 in self.success:
-                iter431.write(oprot)
+            for iter487 in self.success:
+                iter487.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -14385,21 +17958,21 @@ class load_table_binary_args(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.rows = []
-                    (_etype435, _size432) = iprot.readListBegin()
-                    for _i436 in range(_size432):
-                        _elem437 = TRow()
-                        _elem437.read(iprot)
-                        self.rows.append(_elem437)
+                    (_etype491, _size488) = iprot.readListBegin()
+                    for _i492 in range(_size488):
+                        _elem493 = TRow()
+                        _elem493.read(iprot)
+                        self.rows.append(_elem493)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.column_names = []
-                    (_etype441, _size438) = iprot.readListBegin()
-                    for _i442 in range(_size438):
-                        _elem443 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.column_names.append(_elem443)
+                    (_etype497, _size494) = iprot.readListBegin()
+                    for _i498 in range(_size494):
+                        _elem499 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.column_names.append(_elem499)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -14424,15 +17997,15 @@ class load_table_binary_args(object):
         if self.rows is not None:
             oprot.writeFieldBegin('rows', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.rows))
-            for iter444 in self.rows:
-                iter444.write(oprot)
+            for iter500 in self.rows:
+                iter500.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.column_names is not None:
             oprot.writeFieldBegin('column_names', TType.LIST, 4)
             oprot.writeListBegin(TType.STRING, len(self.column_names))
-            for iter445 in self.column_names:
-                oprot.writeString(iter445.encode('utf-8') if sys.version_info[0] == 2 else iter445)
+            for iter501 in self.column_names:
+                oprot.writeString(iter501.encode('utf-8') if sys.version_info[0] == 2 else iter501)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -14568,21 +18141,21 @@ class load_table_binary_columnar_args(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.cols = []
-                    (_etype449, _size446) = iprot.readListBegin()
-                    for _i450 in range(_size446):
-                        _elem451 = TColumn()
-                        _elem451.read(iprot)
-                        self.cols.append(_elem451)
+                    (_etype505, _size502) = iprot.readListBegin()
+                    for _i506 in range(_size502):
+                        _elem507 = TColumn()
+                        _elem507.read(iprot)
+                        self.cols.append(_elem507)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.column_names = []
-                    (_etype455, _size452) = iprot.readListBegin()
-                    for _i456 in range(_size452):
-                        _elem457 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.column_names.append(_elem457)
+                    (_etype511, _size508) = iprot.readListBegin()
+                    for _i512 in range(_size508):
+                        _elem513 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.column_names.append(_elem513)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -14607,15 +18180,15 @@ class load_table_binary_columnar_args(object):
         if self.cols is not None:
             oprot.writeFieldBegin('cols', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.cols))
-            for iter458 in self.cols:
-                iter458.write(oprot)
+            for iter514 in self.cols:
+                iter514.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.column_names is not None:
             oprot.writeFieldBegin('column_names', TType.LIST, 4)
             oprot.writeListBegin(TType.STRING, len(self.column_names))
-            for iter459 in self.column_names:
-                oprot.writeString(iter459.encode('utf-8') if sys.version_info[0] == 2 else iter459)
+            for iter515 in self.column_names:
+                oprot.writeString(iter515.encode('utf-8') if sys.version_info[0] == 2 else iter515)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -14708,6 +18281,201 @@ load_table_binary_columnar_result.thrift_spec = (
 )
 
 
+class load_table_binary_columnar_polys_args(object):
+    """
+    Attributes:
+     - session
+     - table_name
+     - cols
+     - column_names
+     - assign_render_groups
+
+    """
+
+
+    def __init__(self, session=None, table_name=None, cols=None, column_names=[
+    ], assign_render_groups=True,):
+        self.session = session
+        self.table_name = table_name
+        self.cols = cols
+        if column_names is self.thrift_spec[4][4]:
+            column_names = [
+            ]
+        self.column_names = column_names
+        self.assign_render_groups = assign_render_groups
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.session = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.table_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.cols = []
+                    (_etype519, _size516) = iprot.readListBegin()
+                    for _i520 in range(_size516):
+                        _elem521 = TColumn()
+                        _elem521.read(iprot)
+                        self.cols.append(_elem521)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.LIST:
+                    self.column_names = []
+                    (_etype525, _size522) = iprot.readListBegin()
+                    for _i526 in range(_size522):
+                        _elem527 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.column_names.append(_elem527)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.BOOL:
+                    self.assign_render_groups = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('load_table_binary_columnar_polys_args')
+        if self.session is not None:
+            oprot.writeFieldBegin('session', TType.STRING, 1)
+            oprot.writeString(self.session.encode('utf-8') if sys.version_info[0] == 2 else self.session)
+            oprot.writeFieldEnd()
+        if self.table_name is not None:
+            oprot.writeFieldBegin('table_name', TType.STRING, 2)
+            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
+            oprot.writeFieldEnd()
+        if self.cols is not None:
+            oprot.writeFieldBegin('cols', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRUCT, len(self.cols))
+            for iter528 in self.cols:
+                iter528.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.column_names is not None:
+            oprot.writeFieldBegin('column_names', TType.LIST, 4)
+            oprot.writeListBegin(TType.STRING, len(self.column_names))
+            for iter529 in self.column_names:
+                oprot.writeString(iter529.encode('utf-8') if sys.version_info[0] == 2 else iter529)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.assign_render_groups is not None:
+            oprot.writeFieldBegin('assign_render_groups', TType.BOOL, 5)
+            oprot.writeBool(self.assign_render_groups)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(load_table_binary_columnar_polys_args)
+load_table_binary_columnar_polys_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'session', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+    (3, TType.LIST, 'cols', (TType.STRUCT, [TColumn, None], False), None, ),  # 3
+    (4, TType.LIST, 'column_names', (TType.STRING, 'UTF8', False), [
+    ], ),  # 4
+    (5, TType.BOOL, 'assign_render_groups', None, True, ),  # 5
+)
+
+
+class load_table_binary_columnar_polys_result(object):
+    """
+    Attributes:
+     - e
+
+    """
+
+
+    def __init__(self, e=None,):
+        self.e = e
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TOmniSciException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('load_table_binary_columnar_polys_result')
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(load_table_binary_columnar_polys_result)
+load_table_binary_columnar_polys_result.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'e', [TOmniSciException, None], None, ),  # 1
+)
+
+
 class load_table_binary_arrow_args(object):
     """
     Attributes:
@@ -14912,21 +18680,21 @@ class load_table_args(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.rows = []
-                    (_etype463, _size460) = iprot.readListBegin()
-                    for _i464 in range(_size460):
-                        _elem465 = TStringRow()
-                        _elem465.read(iprot)
-                        self.rows.append(_elem465)
+                    (_etype533, _size530) = iprot.readListBegin()
+                    for _i534 in range(_size530):
+                        _elem535 = TStringRow()
+                        _elem535.read(iprot)
+                        self.rows.append(_elem535)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.column_names = []
-                    (_etype469, _size466) = iprot.readListBegin()
-                    for _i470 in range(_size466):
-                        _elem471 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.column_names.append(_elem471)
+                    (_etype539, _size536) = iprot.readListBegin()
+                    for _i540 in range(_size536):
+                        _elem541 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.column_names.append(_elem541)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -14951,15 +18719,15 @@ class load_table_args(object):
         if self.rows is not None:
             oprot.writeFieldBegin('rows', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.rows))
-            for iter472 in self.rows:
-                iter472.write(oprot)
+            for iter542 in self.rows:
+                iter542.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.column_names is not None:
             oprot.writeFieldBegin('column_names', TType.LIST, 4)
             oprot.writeListBegin(TType.STRING, len(self.column_names))
-            for iter473 in self.column_names:
-                oprot.writeString(iter473.encode('utf-8') if sys.version_info[0] == 2 else iter473)
+            for iter543 in self.column_names:
+                oprot.writeString(iter543.encode('utf-8') if sys.version_info[0] == 2 else iter543)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -15255,11 +19023,11 @@ class create_table_args(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.row_desc = []
-                    (_etype477, _size474) = iprot.readListBegin()
-                    for _i478 in range(_size474):
-                        _elem479 = TColumnType()
-                        _elem479.read(iprot)
-                        self.row_desc.append(_elem479)
+                    (_etype547, _size544) = iprot.readListBegin()
+                    for _i548 in range(_size544):
+                        _elem549 = TColumnType()
+                        _elem549.read(iprot)
+                        self.row_desc.append(_elem549)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -15295,8 +19063,8 @@ class create_table_args(object):
         if self.row_desc is not None:
             oprot.writeFieldBegin('row_desc', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.row_desc))
-            for iter480 in self.row_desc:
-                iter480.write(oprot)
+            for iter550 in self.row_desc:
+                iter550.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.file_type is not None:
@@ -15613,11 +19381,11 @@ class import_geo_table_args(object):
             elif fid == 5:
                 if ftype == TType.LIST:
                     self.row_desc = []
-                    (_etype484, _size481) = iprot.readListBegin()
-                    for _i485 in range(_size481):
-                        _elem486 = TColumnType()
-                        _elem486.read(iprot)
-                        self.row_desc.append(_elem486)
+                    (_etype554, _size551) = iprot.readListBegin()
+                    for _i555 in range(_size551):
+                        _elem556 = TColumnType()
+                        _elem556.read(iprot)
+                        self.row_desc.append(_elem556)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -15656,8 +19424,8 @@ class import_geo_table_args(object):
         if self.row_desc is not None:
             oprot.writeFieldBegin('row_desc', TType.LIST, 5)
             oprot.writeListBegin(TType.STRUCT, len(self.row_desc))
-            for iter487 in self.row_desc:
-                iter487.write(oprot)
+            for iter557 in self.row_desc:
+                iter557.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.create_params is not None:
@@ -16177,10 +19945,10 @@ class get_all_files_in_archive_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype491, _size488) = iprot.readListBegin()
-                    for _i492 in range(_size488):
-                        _elem493 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem493)
+                    (_etype561, _size558) = iprot.readListBegin()
+                    for _i562 in range(_size558):
+                        _elem563 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem563)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -16203,8 +19971,8 @@ class get_all_files_in_archive_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter494 in self.success:
-                oprot.writeString(iter494.encode('utf-8') if sys.version_info[0] == 2 else iter494)
+            for iter564 in self.success:
+                oprot.writeString(iter564.encode('utf-8') if sys.version_info[0] == 2 else iter564)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -16346,11 +20114,11 @@ class get_layers_in_geo_file_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype498, _size495) = iprot.readListBegin()
-                    for _i499 in range(_size495):
-                        _elem500 = TGeoFileLayerInfo()
-                        _elem500.read(iprot)
-                        self.success.append(_elem500)
+                    (_etype568, _size565) = iprot.readListBegin()
+                    for _i569 in range(_size565):
+                        _elem570 = TGeoFileLayerInfo()
+                        _elem570.read(iprot)
+                        self.success.append(_elem570)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -16373,8 +20141,8 @@ class get_layers_in_geo_file_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter501 in self.success:
-                iter501.write(oprot)
+            for iter571 in self.success:
+                iter571.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -16707,16 +20475,18 @@ class start_query_args(object):
      - leaf_session
      - parent_session
      - query_ra
+     - start_time_str
      - just_explain
      - outer_fragment_indices
 
     """
 
 
-    def __init__(self, leaf_session=None, parent_session=None, query_ra=None, just_explain=None, outer_fragment_indices=None,):
+    def __init__(self, leaf_session=None, parent_session=None, query_ra=None, start_time_str=None, just_explain=None, outer_fragment_indices=None,):
         self.leaf_session = leaf_session
         self.parent_session = parent_session
         self.query_ra = query_ra
+        self.start_time_str = start_time_str
         self.just_explain = just_explain
         self.outer_fragment_indices = outer_fragment_indices
 
@@ -16745,17 +20515,22 @@ class start_query_args(object):
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
+                if ftype == TType.STRING:
+                    self.start_time_str = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
                 if ftype == TType.BOOL:
                     self.just_explain = iprot.readBool()
                 else:
                     iprot.skip(ftype)
-            elif fid == 5:
+            elif fid == 6:
                 if ftype == TType.LIST:
                     self.outer_fragment_indices = []
-                    (_etype505, _size502) = iprot.readListBegin()
-                    for _i506 in range(_size502):
-                        _elem507 = iprot.readI64()
-                        self.outer_fragment_indices.append(_elem507)
+                    (_etype575, _size572) = iprot.readListBegin()
+                    for _i576 in range(_size572):
+                        _elem577 = iprot.readI64()
+                        self.outer_fragment_indices.append(_elem577)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -16781,15 +20556,19 @@ class start_query_args(object):
             oprot.writeFieldBegin('query_ra', TType.STRING, 3)
             oprot.writeString(self.query_ra.encode('utf-8') if sys.version_info[0] == 2 else self.query_ra)
             oprot.writeFieldEnd()
+        if self.start_time_str is not None:
+            oprot.writeFieldBegin('start_time_str', TType.STRING, 4)
+            oprot.writeString(self.start_time_str.encode('utf-8') if sys.version_info[0] == 2 else self.start_time_str)
+            oprot.writeFieldEnd()
         if self.just_explain is not None:
-            oprot.writeFieldBegin('just_explain', TType.BOOL, 4)
+            oprot.writeFieldBegin('just_explain', TType.BOOL, 5)
             oprot.writeBool(self.just_explain)
             oprot.writeFieldEnd()
         if self.outer_fragment_indices is not None:
-            oprot.writeFieldBegin('outer_fragment_indices', TType.LIST, 5)
+            oprot.writeFieldBegin('outer_fragment_indices', TType.LIST, 6)
             oprot.writeListBegin(TType.I64, len(self.outer_fragment_indices))
-            for iter508 in self.outer_fragment_indices:
-                oprot.writeI64(iter508)
+            for iter578 in self.outer_fragment_indices:
+                oprot.writeI64(iter578)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -16814,8 +20593,9 @@ start_query_args.thrift_spec = (
     (1, TType.STRING, 'leaf_session', 'UTF8', None, ),  # 1
     (2, TType.STRING, 'parent_session', 'UTF8', None, ),  # 2
     (3, TType.STRING, 'query_ra', 'UTF8', None, ),  # 3
-    (4, TType.BOOL, 'just_explain', None, None, ),  # 4
-    (5, TType.LIST, 'outer_fragment_indices', (TType.I64, None, False), None, ),  # 5
+    (4, TType.STRING, 'start_time_str', 'UTF8', None, ),  # 4
+    (5, TType.BOOL, 'just_explain', None, None, ),  # 5
+    (6, TType.LIST, 'outer_fragment_indices', (TType.I64, None, False), None, ),  # 6
 )
 
 
@@ -16899,13 +20679,15 @@ class execute_query_step_args(object):
     Attributes:
      - pending_query
      - subquery_id
+     - start_time_str
 
     """
 
 
-    def __init__(self, pending_query=None, subquery_id=None,):
+    def __init__(self, pending_query=None, subquery_id=None, start_time_str=None,):
         self.pending_query = pending_query
         self.subquery_id = subquery_id
+        self.start_time_str = start_time_str
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -16927,6 +20709,11 @@ class execute_query_step_args(object):
                     self.subquery_id = iprot.readI64()
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRING:
+                    self.start_time_str = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -16945,6 +20732,10 @@ class execute_query_step_args(object):
             oprot.writeFieldBegin('subquery_id', TType.I64, 2)
             oprot.writeI64(self.subquery_id)
             oprot.writeFieldEnd()
+        if self.start_time_str is not None:
+            oprot.writeFieldBegin('start_time_str', TType.STRING, 3)
+            oprot.writeString(self.start_time_str.encode('utf-8') if sys.version_info[0] == 2 else self.start_time_str)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -16966,6 +20757,7 @@ execute_query_step_args.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'pending_query', [TPendingQuery, None], None, ),  # 1
     (2, TType.I64, 'subquery_id', None, None, ),  # 2
+    (3, TType.STRING, 'start_time_str', 'UTF8', None, ),  # 3
 )
 
 
@@ -17081,11 +20873,11 @@ class broadcast_serialized_rows_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.row_desc = []
-                    (_etype512, _size509) = iprot.readListBegin()
-                    for _i513 in range(_size509):
-                        _elem514 = TColumnType()
-                        _elem514.read(iprot)
-                        self.row_desc.append(_elem514)
+                    (_etype582, _size579) = iprot.readListBegin()
+                    for _i583 in range(_size579):
+                        _elem584 = TColumnType()
+                        _elem584.read(iprot)
+                        self.row_desc.append(_elem584)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -17121,8 +20913,8 @@ class broadcast_serialized_rows_args(object):
         if self.row_desc is not None:
             oprot.writeFieldBegin('row_desc', TType.LIST, 2)
             oprot.writeListBegin(TType.STRUCT, len(self.row_desc))
-            for iter515 in self.row_desc:
-                iter515.write(oprot)
+            for iter585 in self.row_desc:
+                iter585.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.query_id is not None:
@@ -17431,35 +21223,35 @@ class execute_next_render_step_args(object):
             elif fid == 2:
                 if ftype == TType.MAP:
                     self.merged_data = {}
-                    (_ktype517, _vtype518, _size516) = iprot.readMapBegin()
-                    for _i520 in range(_size516):
-                        _key521 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val522 = {}
-                        (_ktype524, _vtype525, _size523) = iprot.readMapBegin()
-                        for _i527 in range(_size523):
-                            _key528 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                            _val529 = {}
-                            (_ktype531, _vtype532, _size530) = iprot.readMapBegin()
-                            for _i534 in range(_size530):
-                                _key535 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                                _val536 = {}
-                                (_ktype538, _vtype539, _size537) = iprot.readMapBegin()
-                                for _i541 in range(_size537):
-                                    _key542 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                                    _val543 = []
-                                    (_etype547, _size544) = iprot.readListBegin()
-                                    for _i548 in range(_size544):
-                                        _elem549 = TRenderDatum()
-                                        _elem549.read(iprot)
-                                        _val543.append(_elem549)
+                    (_ktype587, _vtype588, _size586) = iprot.readMapBegin()
+                    for _i590 in range(_size586):
+                        _key591 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val592 = {}
+                        (_ktype594, _vtype595, _size593) = iprot.readMapBegin()
+                        for _i597 in range(_size593):
+                            _key598 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                            _val599 = {}
+                            (_ktype601, _vtype602, _size600) = iprot.readMapBegin()
+                            for _i604 in range(_size600):
+                                _key605 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                                _val606 = {}
+                                (_ktype608, _vtype609, _size607) = iprot.readMapBegin()
+                                for _i611 in range(_size607):
+                                    _key612 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                                    _val613 = []
+                                    (_etype617, _size614) = iprot.readListBegin()
+                                    for _i618 in range(_size614):
+                                        _elem619 = TRenderDatum()
+                                        _elem619.read(iprot)
+                                        _val613.append(_elem619)
                                     iprot.readListEnd()
-                                    _val536[_key542] = _val543
+                                    _val606[_key612] = _val613
                                 iprot.readMapEnd()
-                                _val529[_key535] = _val536
+                                _val599[_key605] = _val606
                             iprot.readMapEnd()
-                            _val522[_key528] = _val529
+                            _val592[_key598] = _val599
                         iprot.readMapEnd()
-                        self.merged_data[_key521] = _val522
+                        self.merged_data[_key591] = _val592
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -17480,20 +21272,20 @@ class execute_next_render_step_args(object):
         if self.merged_data is not None:
             oprot.writeFieldBegin('merged_data', TType.MAP, 2)
             oprot.writeMapBegin(TType.STRING, TType.MAP, len(self.merged_data))
-            for kiter550, viter551 in self.merged_data.items():
-                oprot.writeString(kiter550.encode('utf-8') if sys.version_info[0] == 2 else kiter550)
-                oprot.writeMapBegin(TType.STRING, TType.MAP, len(viter551))
-                for kiter552, viter553 in viter551.items():
-                    oprot.writeString(kiter552.encode('utf-8') if sys.version_info[0] == 2 else kiter552)
-                    oprot.writeMapBegin(TType.STRING, TType.MAP, len(viter553))
-                    for kiter554, viter555 in viter553.items():
-                        oprot.writeString(kiter554.encode('utf-8') if sys.version_info[0] == 2 else kiter554)
-                        oprot.writeMapBegin(TType.STRING, TType.LIST, len(viter555))
-                        for kiter556, viter557 in viter555.items():
-                            oprot.writeString(kiter556.encode('utf-8') if sys.version_info[0] == 2 else kiter556)
-                            oprot.writeListBegin(TType.STRUCT, len(viter557))
-                            for iter558 in viter557:
-                                iter558.write(oprot)
+            for kiter620, viter621 in self.merged_data.items():
+                oprot.writeString(kiter620.encode('utf-8') if sys.version_info[0] == 2 else kiter620)
+                oprot.writeMapBegin(TType.STRING, TType.MAP, len(viter621))
+                for kiter622, viter623 in viter621.items():
+                    oprot.writeString(kiter622.encode('utf-8') if sys.version_info[0] == 2 else kiter622)
+                    oprot.writeMapBegin(TType.STRING, TType.MAP, len(viter623))
+                    for kiter624, viter625 in viter623.items():
+                        oprot.writeString(kiter624.encode('utf-8') if sys.version_info[0] == 2 else kiter624)
+                        oprot.writeMapBegin(TType.STRING, TType.LIST, len(viter625))
+                        for kiter626, viter627 in viter625.items():
+                            oprot.writeString(kiter626.encode('utf-8') if sys.version_info[0] == 2 else kiter626)
+                            oprot.writeListBegin(TType.STRUCT, len(viter627))
+                            for iter628 in viter627:
+                                iter628.write(oprot)
                             oprot.writeListEnd()
                         oprot.writeMapEnd()
                     oprot.writeMapEnd()
@@ -17961,10 +21753,10 @@ class get_roles_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype562, _size559) = iprot.readListBegin()
-                    for _i563 in range(_size559):
-                        _elem564 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem564)
+                    (_etype632, _size629) = iprot.readListBegin()
+                    for _i633 in range(_size629):
+                        _elem634 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem634)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -17987,8 +21779,8 @@ class get_roles_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter565 in self.success:
-                oprot.writeString(iter565.encode('utf-8') if sys.version_info[0] == 2 else iter565)
+            for iter635 in self.success:
+                oprot.writeString(iter635.encode('utf-8') if sys.version_info[0] == 2 else iter635)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -18117,11 +21909,11 @@ class get_db_objects_for_grantee_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype569, _size566) = iprot.readListBegin()
-                    for _i570 in range(_size566):
-                        _elem571 = TDBObject()
-                        _elem571.read(iprot)
-                        self.success.append(_elem571)
+                    (_etype639, _size636) = iprot.readListBegin()
+                    for _i640 in range(_size636):
+                        _elem641 = TDBObject()
+                        _elem641.read(iprot)
+                        self.success.append(_elem641)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -18144,8 +21936,8 @@ class get_db_objects_for_grantee_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter572 in self.success:
-                iter572.write(oprot)
+            for iter642 in self.success:
+                iter642.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -18286,11 +22078,11 @@ class get_db_object_privs_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype576, _size573) = iprot.readListBegin()
-                    for _i577 in range(_size573):
-                        _elem578 = TDBObject()
-                        _elem578.read(iprot)
-                        self.success.append(_elem578)
+                    (_etype646, _size643) = iprot.readListBegin()
+                    for _i647 in range(_size643):
+                        _elem648 = TDBObject()
+                        _elem648.read(iprot)
+                        self.success.append(_elem648)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -18313,8 +22105,8 @@ class get_db_object_privs_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter579 in self.success:
-                iter579.write(oprot)
+            for iter649 in self.success:
+                iter649.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -18443,10 +22235,10 @@ class get_all_roles_for_user_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype583, _size580) = iprot.readListBegin()
-                    for _i584 in range(_size580):
-                        _elem585 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success.append(_elem585)
+                    (_etype653, _size650) = iprot.readListBegin()
+                    for _i654 in range(_size650):
+                        _elem655 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success.append(_elem655)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -18469,8 +22261,8 @@ class get_all_roles_for_user_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRING, len(self.success))
-            for iter586 in self.success:
-                oprot.writeString(iter586.encode('utf-8') if sys.version_info[0] == 2 else iter586)
+            for iter656 in self.success:
+                oprot.writeString(iter656.encode('utf-8') if sys.version_info[0] == 2 else iter656)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -19242,11 +23034,11 @@ class get_device_parameters_result(object):
             if fid == 0:
                 if ftype == TType.MAP:
                     self.success = {}
-                    (_ktype588, _vtype589, _size587) = iprot.readMapBegin()
-                    for _i591 in range(_size587):
-                        _key592 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val593 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.success[_key592] = _val593
+                    (_ktype658, _vtype659, _size657) = iprot.readMapBegin()
+                    for _i661 in range(_size657):
+                        _key662 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val663 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.success[_key662] = _val663
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -19269,9 +23061,9 @@ class get_device_parameters_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.MAP, 0)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.success))
-            for kiter594, viter595 in self.success.items():
-                oprot.writeString(kiter594.encode('utf-8') if sys.version_info[0] == 2 else kiter594)
-                oprot.writeString(viter595.encode('utf-8') if sys.version_info[0] == 2 else viter595)
+            for kiter664, viter665 in self.success.items():
+                oprot.writeString(kiter664.encode('utf-8') if sys.version_info[0] == 2 else kiter664)
+                oprot.writeString(viter665.encode('utf-8') if sys.version_info[0] == 2 else viter665)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
@@ -19335,33 +23127,33 @@ class register_runtime_extension_functions_args(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.udfs = []
-                    (_etype599, _size596) = iprot.readListBegin()
-                    for _i600 in range(_size596):
-                        _elem601 = omnisci.extension_functions.ttypes.TUserDefinedFunction()
-                        _elem601.read(iprot)
-                        self.udfs.append(_elem601)
+                    (_etype669, _size666) = iprot.readListBegin()
+                    for _i670 in range(_size666):
+                        _elem671 = omnisci.extension_functions.ttypes.TUserDefinedFunction()
+                        _elem671.read(iprot)
+                        self.udfs.append(_elem671)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.udtfs = []
-                    (_etype605, _size602) = iprot.readListBegin()
-                    for _i606 in range(_size602):
-                        _elem607 = omnisci.extension_functions.ttypes.TUserDefinedTableFunction()
-                        _elem607.read(iprot)
-                        self.udtfs.append(_elem607)
+                    (_etype675, _size672) = iprot.readListBegin()
+                    for _i676 in range(_size672):
+                        _elem677 = omnisci.extension_functions.ttypes.TUserDefinedTableFunction()
+                        _elem677.read(iprot)
+                        self.udtfs.append(_elem677)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.MAP:
                     self.device_ir_map = {}
-                    (_ktype609, _vtype610, _size608) = iprot.readMapBegin()
-                    for _i612 in range(_size608):
-                        _key613 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val614 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.device_ir_map[_key613] = _val614
+                    (_ktype679, _vtype680, _size678) = iprot.readMapBegin()
+                    for _i682 in range(_size678):
+                        _key683 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val684 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.device_ir_map[_key683] = _val684
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -19382,23 +23174,23 @@ class register_runtime_extension_functions_args(object):
         if self.udfs is not None:
             oprot.writeFieldBegin('udfs', TType.LIST, 2)
             oprot.writeListBegin(TType.STRUCT, len(self.udfs))
-            for iter615 in self.udfs:
-                iter615.write(oprot)
+            for iter685 in self.udfs:
+                iter685.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.udtfs is not None:
             oprot.writeFieldBegin('udtfs', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.udtfs))
-            for iter616 in self.udtfs:
-                iter616.write(oprot)
+            for iter686 in self.udtfs:
+                iter686.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.device_ir_map is not None:
             oprot.writeFieldBegin('device_ir_map', TType.MAP, 4)
             oprot.writeMapBegin(TType.STRING, TType.STRING, len(self.device_ir_map))
-            for kiter617, viter618 in self.device_ir_map.items():
-                oprot.writeString(kiter617.encode('utf-8') if sys.version_info[0] == 2 else kiter617)
-                oprot.writeString(viter618.encode('utf-8') if sys.version_info[0] == 2 else viter618)
+            for kiter687, viter688 in self.device_ir_map.items():
+                oprot.writeString(kiter687.encode('utf-8') if sys.version_info[0] == 2 else kiter687)
+                oprot.writeString(viter688.encode('utf-8') if sys.version_info[0] == 2 else viter688)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -236,6 +236,18 @@ class TDBObjectType(object):
     }
 
 
+class TDataSourceType(object):
+    TABLE = 0
+
+    _VALUES_TO_NAMES = {
+        0: "TABLE",
+    }
+
+    _NAMES_TO_VALUES = {
+        "TABLE": 0,
+    }
+
+
 class TDatumVal(object):
     """
     Attributes:
@@ -1482,6 +1494,222 @@ class TDataFrame(object):
         return not (self == other)
 
 
+class TDataFrameCursor(object):
+    """
+    Attributes:
+     - cursor_id
+     - schema
+     - execution_time_ms
+
+    """
+
+
+    def __init__(self, cursor_id=None, schema=None, execution_time_ms=None,):
+        self.cursor_id = cursor_id
+        self.schema = schema
+        self.execution_time_ms = execution_time_ms
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.cursor_id = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.schema = iprot.readBinary()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.execution_time_ms = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TDataFrameCursor')
+        if self.cursor_id is not None:
+            oprot.writeFieldBegin('cursor_id', TType.STRING, 1)
+            oprot.writeString(self.cursor_id.encode('utf-8') if sys.version_info[0] == 2 else self.cursor_id)
+            oprot.writeFieldEnd()
+        if self.schema is not None:
+            oprot.writeFieldBegin('schema', TType.STRING, 2)
+            oprot.writeBinary(self.schema)
+            oprot.writeFieldEnd()
+        if self.execution_time_ms is not None:
+            oprot.writeFieldBegin('execution_time_ms', TType.I64, 3)
+            oprot.writeI64(self.execution_time_ms)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class TPreparedStatement(object):
+    """
+    Attributes:
+     - statement_id
+     - num_parameters
+
+    """
+
+
+    def __init__(self, statement_id=None, num_parameters=None,):
+        self.statement_id = statement_id
+        self.num_parameters = num_parameters
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.statement_id = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I32:
+                    self.num_parameters = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TPreparedStatement')
+        if self.statement_id is not None:
+            oprot.writeFieldBegin('statement_id', TType.STRING, 1)
+            oprot.writeString(self.statement_id.encode('utf-8') if sys.version_info[0] == 2 else self.statement_id)
+            oprot.writeFieldEnd()
+        if self.num_parameters is not None:
+            oprot.writeFieldBegin('num_parameters', TType.I32, 2)
+            oprot.writeI32(self.num_parameters)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class TBindParameter(object):
+    """
+    Attributes:
+     - type
+     - value
+
+    """
+
+
+    def __init__(self, type=None, value=None,):
+        self.type = type
+        self.value = value
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I32:
+                    self.type = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.value = TDatum()
+                    self.value.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TBindParameter')
+        if self.type is not None:
+            oprot.writeFieldBegin('type', TType.I32, 1)
+            oprot.writeI32(self.type)
+            oprot.writeFieldEnd()
+        if self.value is not None:
+            oprot.writeFieldBegin('value', TType.STRUCT, 2)
+            self.value.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
 class TDBInfo(object):
     """
     Attributes:
@@ -2260,30 +2488,24 @@ class TFrontendView(object):
         return not (self == other)
 
 
-class TServerStatus(object):
+class TDispatchQueueStatus(object):
     """
     Attributes:
-     - read_only
-     - version
-     - rendering_enabled
-     - start_time
-     - edition
-     - host_name
-     - poly_rendering_enabled
-     - role
+     - queue_depth
+     - max_queue_depth
+     - num_dispatched
+     - wait_time_ms_bucket_bounds
+     - wait_time_ms_histogram
 
     """
 
 
-    def __init__(self, read_only=None, version=None, rendering_enabled=None, start_time=None, edition=None, host_name=None, poly_rendering_enabled=None, role=None,):
-        self.read_only = read_only
-        self.version = version
-        self.rendering_enabled = rendering_enabled
-        self.start_time = start_time
-        self.edition = edition
-        self.host_name = host_name
-        self.poly_rendering_enabled = poly_rendering_enabled
-        self.role = role
+    def __init__(self, queue_depth=None, max_queue_depth=None, num_dispatched=None, wait_time_ms_bucket_bounds=None, wait_time_ms_histogram=None,):
+        self.queue_depth = queue_depth
+        self.max_queue_depth = max_queue_depth
+        self.num_dispatched = num_dispatched
+        self.wait_time_ms_bucket_bounds = wait_time_ms_bucket_bounds
+        self.wait_time_ms_histogram = wait_time_ms_histogram
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -2295,43 +2517,38 @@ class TServerStatus(object):
             if ftype == TType.STOP:
                 break
             if fid == 1:
-                if ftype == TType.BOOL:
-                    self.read_only = iprot.readBool()
+                if ftype == TType.I64:
+                    self.queue_depth = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.STRING:
-                    self.version = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                if ftype == TType.I64:
+                    self.max_queue_depth = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
-                if ftype == TType.BOOL:
-                    self.rendering_enabled = iprot.readBool()
+                if ftype == TType.I64:
+                    self.num_dispatched = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
-                if ftype == TType.I64:
-                    self.start_time = iprot.readI64()
+                if ftype == TType.LIST:
+                    self.wait_time_ms_bucket_bounds = []
+                    (_etype87, _size84) = iprot.readListBegin()
+                    for _i88 in range(_size84):
+                        _elem89 = iprot.readI64()
+                        self.wait_time_ms_bucket_bounds.append(_elem89)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 5:
-                if ftype == TType.STRING:
-                    self.edition = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 6:
-                if ftype == TType.STRING:
-                    self.host_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 7:
-                if ftype == TType.BOOL:
-                    self.poly_rendering_enabled = iprot.readBool()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 8:
-                if ftype == TType.I32:
-                    self.role = iprot.readI32()
+                if ftype == TType.LIST:
+                    self.wait_time_ms_histogram = []
+                    (_etype93, _size90) = iprot.readListBegin()
+                    for _i94 in range(_size90):
+                        _elem95 = iprot.readI64()
+                        self.wait_time_ms_histogram.append(_elem95)
+                    iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             else:
@@ -2343,18 +2560,161 @@ class TServerStatus(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('TServerStatus')
-        if self.read_only is not None:
-            oprot.writeFieldBegin('read_only', TType.BOOL, 1)
-            oprot.writeBool(self.read_only)
+        oprot.writeStructBegin('TDispatchQueueStatus')
+        if self.queue_depth is not None:
+            oprot.writeFieldBegin('queue_depth', TType.I64, 1)
+            oprot.writeI64(self.queue_depth)
+            oprot.writeFieldEnd()
+        if self.max_queue_depth is not None:
+            oprot.writeFieldBegin('max_queue_depth', TType.I64, 2)
+            oprot.writeI64(self.max_queue_depth)
+            oprot.writeFieldEnd()
+        if self.num_dispatched is not None:
+            oprot.writeFieldBegin('num_dispatched', TType.I64, 3)
+            oprot.writeI64(self.num_dispatched)
+            oprot.writeFieldEnd()
+        if self.wait_time_ms_bucket_bounds is not None:
+            oprot.writeFieldBegin('wait_time_ms_bucket_bounds', TType.LIST, 4)
+            oprot.writeListBegin(TType.I64, len(self.wait_time_ms_bucket_bounds))
+            for iter96 in self.wait_time_ms_bucket_bounds:
+                oprot.writeI64(iter96)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
-        if self.version is not None:
-            oprot.writeFieldBegin('version', TType.STRING, 2)
-            oprot.writeString(self.version.encode('utf-8') if sys.version_info[0] == 2 else self.version)
+        if self.wait_time_ms_histogram is not None:
+            oprot.writeFieldBegin('wait_time_ms_histogram', TType.LIST, 5)
+            oprot.writeListBegin(TType.I64, len(self.wait_time_ms_histogram))
+            for iter97 in self.wait_time_ms_histogram:
+                oprot.writeI64(iter97)
+            oprot.writeListEnd()
             oprot.writeFieldEnd()
-        if self.rendering_enabled is not None:
-            oprot.writeFieldBegin('rendering_enabled', TType.BOOL, 3)
-            oprot.writeBool(self.rendering_enabled)
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class TServerStatus(object):
+    """
+    Attributes:
+     - read_only
+     - version
+     - rendering_enabled
+     - start_time
+     - edition
+     - host_name
+     - poly_rendering_enabled
+     - role
+     - renderer_status_json
+     - dispatch_queue_status
+
+    """
+
+
+    def __init__(self, read_only=None, version=None, rendering_enabled=None, start_time=None, edition=None, host_name=None, poly_rendering_enabled=None, role=None, renderer_status_json=None, dispatch_queue_status=None,):
+        self.read_only = read_only
+        self.version = version
+        self.rendering_enabled = rendering_enabled
+        self.start_time = start_time
+        self.edition = edition
+        self.host_name = host_name
+        self.poly_rendering_enabled = poly_rendering_enabled
+        self.role = role
+        self.renderer_status_json = renderer_status_json
+        self.dispatch_queue_status = dispatch_queue_status
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.BOOL:
+                    self.read_only = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.version = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.BOOL:
+                    self.rendering_enabled = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.start_time = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.STRING:
+                    self.edition = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.STRING:
+                    self.host_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.BOOL:
+                    self.poly_rendering_enabled = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 8:
+                if ftype == TType.I32:
+                    self.role = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 9:
+                if ftype == TType.STRING:
+                    self.renderer_status_json = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 10:
+                if ftype == TType.STRUCT:
+                    self.dispatch_queue_status = TDispatchQueueStatus()
+                    self.dispatch_queue_status.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TServerStatus')
+        if self.read_only is not None:
+            oprot.writeFieldBegin('read_only', TType.BOOL, 1)
+            oprot.writeBool(self.read_only)
+            oprot.writeFieldEnd()
+        if self.version is not None:
+            oprot.writeFieldBegin('version', TType.STRING, 2)
+            oprot.writeString(self.version.encode('utf-8') if sys.version_info[0] == 2 else self.version)
+            oprot.writeFieldEnd()
+        if self.rendering_enabled is not None:
+            oprot.writeFieldBegin('rendering_enabled', TType.BOOL, 3)
+            oprot.writeBool(self.rendering_enabled)
             oprot.writeFieldEnd()
         if self.start_time is not None:
             oprot.writeFieldBegin('start_time', TType.I64, 4)
@@ -2376,6 +2736,14 @@ class TServerStatus(object):
             oprot.writeFieldBegin('role', TType.I32, 8)
             oprot.writeI32(self.role)
             oprot.writeFieldEnd()
+        if self.renderer_status_json is not None:
+            oprot.writeFieldBegin('renderer_status_json', TType.STRING, 9)
+            oprot.writeString(self.renderer_status_json.encode('utf-8') if sys.version_info[0] == 2 else self.renderer_status_json)
+            oprot.writeFieldEnd()
+        if self.dispatch_queue_status is not None:
+            oprot.writeFieldBegin('dispatch_queue_status', TType.STRUCT, 10)
+            self.dispatch_queue_status.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -2506,20 +2874,20 @@ class TPixelTableRowResult(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.table_id = []
-                    (_etype87, _size84) = iprot.readListBegin()
-                    for _i88 in range(_size84):
-                        _elem89 = iprot.readI64()
-                        self.table_id.append(_elem89)
+                    (_etype101, _size98) = iprot.readListBegin()
+                    for _i102 in range(_size98):
+                        _elem103 = iprot.readI64()
+                        self.table_id.append(_elem103)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.row_id = []
-                    (_etype93, _size90) = iprot.readListBegin()
-                    for _i94 in range(_size90):
-                        _elem95 = iprot.readI64()
-                        self.row_id.append(_elem95)
+                    (_etype107, _size104) = iprot.readListBegin()
+                    for _i108 in range(_size104):
+                        _elem109 = iprot.readI64()
+                        self.row_id.append(_elem109)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -2555,15 +2923,15 @@ class TPixelTableRowResult(object):
         if self.table_id is not None:
             oprot.writeFieldBegin('table_id', TType.LIST, 3)
             oprot.writeListBegin(TType.I64, len(self.table_id))
-            for iter96 in self.table_id:
-                oprot.writeI64(iter96)
+            for iter110 in self.table_id:
+                oprot.writeI64(iter110)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.row_id is not None:
             oprot.writeFieldBegin('row_id', TType.LIST, 4)
             oprot.writeListBegin(TType.I64, len(self.row_id))
-            for iter97 in self.row_id:
-                oprot.writeI64(iter97)
+            for iter111 in self.row_id:
+                oprot.writeI64(iter111)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.row_set is not None:
@@ -2863,11 +3231,11 @@ class THardwareInfo(object):
             elif fid == 6:
                 if ftype == TType.LIST:
                     self.gpu_info = []
-                    (_etype101, _size98) = iprot.readListBegin()
-                    for _i102 in range(_size98):
-                        _elem103 = TGpuSpecification()
-                        _elem103.read(iprot)
-                        self.gpu_info.append(_elem103)
+                    (_etype115, _size112) = iprot.readListBegin()
+                    for _i116 in range(_size112):
+                        _elem117 = TGpuSpecification()
+                        _elem117.read(iprot)
+                        self.gpu_info.append(_elem117)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -2904,8 +3272,8 @@ class THardwareInfo(object):
         if self.gpu_info is not None:
             oprot.writeFieldBegin('gpu_info', TType.LIST, 6)
             oprot.writeListBegin(TType.STRUCT, len(self.gpu_info))
-            for iter104 in self.gpu_info:
-                iter104.write(oprot)
+            for iter118 in self.gpu_info:
+                iter118.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -2947,14 +3315,356 @@ class TClusterHardwareInfo(object):
             if ftype == TType.STOP:
                 break
             if fid == 1:
-                if ftype == TType.LIST:
-                    self.hardware_info = []
-                    (_etype108, _size105) = iprot.readListBegin()
-                    for _i109 in range(_size105):
-                        _elem110 = THardwareInfo()
-                        _elem110.read(iprot)
-                        self.hardware_info.append(_elem110)
-                    iprot.readListEnd()
+                if ftype == TType.LIST:
+                    self.hardware_info = []
+                    (_etype122, _size119) = iprot.readListBegin()
+                    for _i123 in range(_size119):
+                        _elem124 = THardwareInfo()
+                        _elem124.read(iprot)
+                        self.hardware_info.append(_elem124)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TClusterHardwareInfo')
+        if self.hardware_info is not None:
+            oprot.writeFieldBegin('hardware_info', TType.LIST, 1)
+            oprot.writeListBegin(TType.STRUCT, len(self.hardware_info))
+            for iter125 in self.hardware_info:
+                iter125.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class TMemoryData(object):
+    """
+    Attributes:
+     - slab
+     - start_page
+     - num_pages
+     - touch
+     - chunk_key
+     - buffer_epoch
+     - is_free
+
+    """
+
+
+    def __init__(self, slab=None, start_page=None, num_pages=None, touch=None, chunk_key=None, buffer_epoch=None, is_free=None,):
+        self.slab = slab
+        self.start_page = start_page
+        self.num_pages = num_pages
+        self.touch = touch
+        self.chunk_key = chunk_key
+        self.buffer_epoch = buffer_epoch
+        self.is_free = is_free
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.slab = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I32:
+                    self.start_page = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.num_pages = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I32:
+                    self.touch = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.LIST:
+                    self.chunk_key = []
+                    (_etype129, _size126) = iprot.readListBegin()
+                    for _i130 in range(_size126):
+                        _elem131 = iprot.readI64()
+                        self.chunk_key.append(_elem131)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.buffer_epoch = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.BOOL:
+                    self.is_free = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TMemoryData')
+        if self.slab is not None:
+            oprot.writeFieldBegin('slab', TType.I64, 1)
+            oprot.writeI64(self.slab)
+            oprot.writeFieldEnd()
+        if self.start_page is not None:
+            oprot.writeFieldBegin('start_page', TType.I32, 2)
+            oprot.writeI32(self.start_page)
+            oprot.writeFieldEnd()
+        if self.num_pages is not None:
+            oprot.writeFieldBegin('num_pages', TType.I64, 3)
+            oprot.writeI64(self.num_pages)
+            oprot.writeFieldEnd()
+        if self.touch is not None:
+            oprot.writeFieldBegin('touch', TType.I32, 4)
+            oprot.writeI32(self.touch)
+            oprot.writeFieldEnd()
+        if self.chunk_key is not None:
+            oprot.writeFieldBegin('chunk_key', TType.LIST, 5)
+            oprot.writeListBegin(TType.I64, len(self.chunk_key))
+            for iter132 in self.chunk_key:
+                oprot.writeI64(iter132)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.buffer_epoch is not None:
+            oprot.writeFieldBegin('buffer_epoch', TType.I32, 6)
+            oprot.writeI32(self.buffer_epoch)
+            oprot.writeFieldEnd()
+        if self.is_free is not None:
+            oprot.writeFieldBegin('is_free', TType.BOOL, 7)
+            oprot.writeBool(self.is_free)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class THashTableCacheInfo(object):
+    """
+    Attributes:
+     - cache_name
+     - num_entries
+     - size_bytes
+     - max_size_bytes
+     - hits
+     - misses
+     - evictions
+
+    """
+
+
+    def __init__(self, cache_name=None, num_entries=None, size_bytes=None, max_size_bytes=None, hits=None, misses=None, evictions=None,):
+        self.cache_name = cache_name
+        self.num_entries = num_entries
+        self.size_bytes = size_bytes
+        self.max_size_bytes = max_size_bytes
+        self.hits = hits
+        self.misses = misses
+        self.evictions = evictions
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.cache_name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.num_entries = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.size_bytes = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.max_size_bytes = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I64:
+                    self.hits = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I64:
+                    self.misses = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.I64:
+                    self.evictions = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('THashTableCacheInfo')
+        if self.cache_name is not None:
+            oprot.writeFieldBegin('cache_name', TType.STRING, 1)
+            oprot.writeString(self.cache_name.encode('utf-8') if sys.version_info[0] == 2 else self.cache_name)
+            oprot.writeFieldEnd()
+        if self.num_entries is not None:
+            oprot.writeFieldBegin('num_entries', TType.I64, 2)
+            oprot.writeI64(self.num_entries)
+            oprot.writeFieldEnd()
+        if self.size_bytes is not None:
+            oprot.writeFieldBegin('size_bytes', TType.I64, 3)
+            oprot.writeI64(self.size_bytes)
+            oprot.writeFieldEnd()
+        if self.max_size_bytes is not None:
+            oprot.writeFieldBegin('max_size_bytes', TType.I64, 4)
+            oprot.writeI64(self.max_size_bytes)
+            oprot.writeFieldEnd()
+        if self.hits is not None:
+            oprot.writeFieldBegin('hits', TType.I64, 5)
+            oprot.writeI64(self.hits)
+            oprot.writeFieldEnd()
+        if self.misses is not None:
+            oprot.writeFieldBegin('misses', TType.I64, 6)
+            oprot.writeI64(self.misses)
+            oprot.writeFieldEnd()
+        if self.evictions is not None:
+            oprot.writeFieldBegin('evictions', TType.I64, 7)
+            oprot.writeI64(self.evictions)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class TBufferPoolStats(object):
+    """
+    Attributes:
+     - hits
+     - misses
+     - evictions
+     - chunk_index_lock_acquisitions
+     - chunk_index_lock_waits
+
+    """
+
+
+    def __init__(self, hits=None, misses=None, evictions=None, chunk_index_lock_acquisitions=None, chunk_index_lock_waits=None,):
+        self.hits = hits
+        self.misses = misses
+        self.evictions = evictions
+        self.chunk_index_lock_acquisitions = chunk_index_lock_acquisitions
+        self.chunk_index_lock_waits = chunk_index_lock_waits
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I64:
+                    self.hits = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I64:
+                    self.misses = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.evictions = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.chunk_index_lock_acquisitions = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I64:
+                    self.chunk_index_lock_waits = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             else:
@@ -2966,13 +3676,26 @@ class TClusterHardwareInfo(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('TClusterHardwareInfo')
-        if self.hardware_info is not None:
-            oprot.writeFieldBegin('hardware_info', TType.LIST, 1)
-            oprot.writeListBegin(TType.STRUCT, len(self.hardware_info))
-            for iter111 in self.hardware_info:
-                iter111.write(oprot)
-            oprot.writeListEnd()
+        oprot.writeStructBegin('TBufferPoolStats')
+        if self.hits is not None:
+            oprot.writeFieldBegin('hits', TType.I64, 1)
+            oprot.writeI64(self.hits)
+            oprot.writeFieldEnd()
+        if self.misses is not None:
+            oprot.writeFieldBegin('misses', TType.I64, 2)
+            oprot.writeI64(self.misses)
+            oprot.writeFieldEnd()
+        if self.evictions is not None:
+            oprot.writeFieldBegin('evictions', TType.I64, 3)
+            oprot.writeI64(self.evictions)
+            oprot.writeFieldEnd()
+        if self.chunk_index_lock_acquisitions is not None:
+            oprot.writeFieldBegin('chunk_index_lock_acquisitions', TType.I64, 4)
+            oprot.writeI64(self.chunk_index_lock_acquisitions)
+            oprot.writeFieldEnd()
+        if self.chunk_index_lock_waits is not None:
+            oprot.writeFieldBegin('chunk_index_lock_waits', TType.I64, 5)
+            oprot.writeI64(self.chunk_index_lock_waits)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -2992,28 +3715,26 @@ class TClusterHardwareInfo(object):
         return not (self == other)
 
 
-class TMemoryData(object):
+class TStringDictionaryCacheStats(object):
     """
     Attributes:
-     - slab
-     - start_page
-     - num_pages
-     - touch
-     - chunk_key
-     - buffer_epoch
-     - is_free
+     - num_entries
+     - size_bytes
+     - max_size_bytes
+     - hits
+     - misses
+     - evictions
 
     """
 
 
-    def __init__(self, slab=None, start_page=None, num_pages=None, touch=None, chunk_key=None, buffer_epoch=None, is_free=None,):
-        self.slab = slab
-        self.start_page = start_page
-        self.num_pages = num_pages
-        self.touch = touch
-        self.chunk_key = chunk_key
-        self.buffer_epoch = buffer_epoch
-        self.is_free = is_free
+    def __init__(self, num_entries=None, size_bytes=None, max_size_bytes=None, hits=None, misses=None, evictions=None,):
+        self.num_entries = num_entries
+        self.size_bytes = size_bytes
+        self.max_size_bytes = max_size_bytes
+        self.hits = hits
+        self.misses = misses
+        self.evictions = evictions
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -3026,42 +3747,32 @@ class TMemoryData(object):
                 break
             if fid == 1:
                 if ftype == TType.I64:
-                    self.slab = iprot.readI64()
+                    self.num_entries = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 2:
-                if ftype == TType.I32:
-                    self.start_page = iprot.readI32()
+                if ftype == TType.I64:
+                    self.size_bytes = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.I64:
-                    self.num_pages = iprot.readI64()
+                    self.max_size_bytes = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
-                if ftype == TType.I32:
-                    self.touch = iprot.readI32()
+                if ftype == TType.I64:
+                    self.hits = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 5:
-                if ftype == TType.LIST:
-                    self.chunk_key = []
-                    (_etype115, _size112) = iprot.readListBegin()
-                    for _i116 in range(_size112):
-                        _elem117 = iprot.readI64()
-                        self.chunk_key.append(_elem117)
-                    iprot.readListEnd()
+                if ftype == TType.I64:
+                    self.misses = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             elif fid == 6:
-                if ftype == TType.I32:
-                    self.buffer_epoch = iprot.readI32()
-                else:
-                    iprot.skip(ftype)
-            elif fid == 7:
-                if ftype == TType.BOOL:
-                    self.is_free = iprot.readBool()
+                if ftype == TType.I64:
+                    self.evictions = iprot.readI64()
                 else:
                     iprot.skip(ftype)
             else:
@@ -3073,37 +3784,30 @@ class TMemoryData(object):
         if oprot._fast_encode is not None and self.thrift_spec is not None:
             oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
             return
-        oprot.writeStructBegin('TMemoryData')
-        if self.slab is not None:
-            oprot.writeFieldBegin('slab', TType.I64, 1)
-            oprot.writeI64(self.slab)
+        oprot.writeStructBegin('TStringDictionaryCacheStats')
+        if self.num_entries is not None:
+            oprot.writeFieldBegin('num_entries', TType.I64, 1)
+            oprot.writeI64(self.num_entries)
             oprot.writeFieldEnd()
-        if self.start_page is not None:
-            oprot.writeFieldBegin('start_page', TType.I32, 2)
-            oprot.writeI32(self.start_page)
-            oprot.writeFieldEnd()
-        if self.num_pages is not None:
-            oprot.writeFieldBegin('num_pages', TType.I64, 3)
-            oprot.writeI64(self.num_pages)
+        if self.size_bytes is not None:
+            oprot.writeFieldBegin('size_bytes', TType.I64, 2)
+            oprot.writeI64(self.size_bytes)
             oprot.writeFieldEnd()
-        if self.touch is not None:
-            oprot.writeFieldBegin('touch', TType.I32, 4)
-            oprot.writeI32(self.touch)
+        if self.max_size_bytes is not None:
+            oprot.writeFieldBegin('max_size_bytes', TType.I64, 3)
+            oprot.writeI64(self.max_size_bytes)
             oprot.writeFieldEnd()
-        if self.chunk_key is not None:
-            oprot.writeFieldBegin('chunk_key', TType.LIST, 5)
-            oprot.writeListBegin(TType.I64, len(self.chunk_key))
-            for iter118 in self.chunk_key:
-                oprot.writeI64(iter118)
-            oprot.writeListEnd()
+        if self.hits is not None:
+            oprot.writeFieldBegin('hits', TType.I64, 4)
+            oprot.writeI64(self.hits)
             oprot.writeFieldEnd()
-        if self.buffer_epoch is not None:
-            oprot.writeFieldBegin('buffer_epoch', TType.I32, 6)
-            oprot.writeI32(self.buffer_epoch)
+        if self.misses is not None:
+            oprot.writeFieldBegin('misses', TType.I64, 5)
+            oprot.writeI64(self.misses)
             oprot.writeFieldEnd()
-        if self.is_free is not None:
-            oprot.writeFieldBegin('is_free', TType.BOOL, 7)
-            oprot.writeBool(self.is_free)
+        if self.evictions is not None:
+            oprot.writeFieldBegin('evictions', TType.I64, 6)
+            oprot.writeI64(self.evictions)
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
@@ -3132,17 +3836,23 @@ class TNodeMemoryInfo(object):
      - num_pages_allocated
      - is_allocation_capped
      - node_memory_data
+     - hash_table_caches
+     - buffer_pool_stats
+     - string_dictionary_cache
 
     """
 
 
-    def __init__(self, host_name=None, page_size=None, max_num_pages=None, num_pages_allocated=None, is_allocation_capped=None, node_memory_data=None,):
+    def __init__(self, host_name=None, page_size=None, max_num_pages=None, num_pages_allocated=None, is_allocation_capped=None, node_memory_data=None, hash_table_caches=None, buffer_pool_stats=None, string_dictionary_cache=None,):
         self.host_name = host_name
         self.page_size = page_size
         self.max_num_pages = max_num_pages
         self.num_pages_allocated = num_pages_allocated
         self.is_allocation_capped = is_allocation_capped
         self.node_memory_data = node_memory_data
+        self.hash_table_caches = hash_table_caches
+        self.buffer_pool_stats = buffer_pool_stats
+        self.string_dictionary_cache = string_dictionary_cache
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -3181,14 +3891,37 @@ class TNodeMemoryInfo(object):
             elif fid == 6:
                 if ftype == TType.LIST:
                     self.node_memory_data = []
-                    (_etype122, _size119) = iprot.readListBegin()
-                    for _i123 in range(_size119):
-                        _elem124 = TMemoryData()
-                        _elem124.read(iprot)
-                        self.node_memory_data.append(_elem124)
+                    (_etype136, _size133) = iprot.readListBegin()
+                    for _i137 in range(_size133):
+                        _elem138 = TMemoryData()
+                        _elem138.read(iprot)
+                        self.node_memory_data.append(_elem138)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.LIST:
+                    self.hash_table_caches = []
+                    (_etype142, _size139) = iprot.readListBegin()
+                    for _i143 in range(_size139):
+                        _elem144 = THashTableCacheInfo()
+                        _elem144.read(iprot)
+                        self.hash_table_caches.append(_elem144)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 8:
+                if ftype == TType.STRUCT:
+                    self.buffer_pool_stats = TBufferPoolStats()
+                    self.buffer_pool_stats.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 9:
+                if ftype == TType.STRUCT:
+                    self.string_dictionary_cache = TStringDictionaryCacheStats()
+                    self.string_dictionary_cache.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -3222,10 +3955,25 @@ class TNodeMemoryInfo(object):
         if self.node_memory_data is not None:
             oprot.writeFieldBegin('node_memory_data', TType.LIST, 6)
             oprot.writeListBegin(TType.STRUCT, len(self.node_memory_data))
-            for iter125 in self.node_memory_data:
-                iter125.write(oprot)
+            for iter145 in self.node_memory_data:
+                iter145.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.hash_table_caches is not None:
+            oprot.writeFieldBegin('hash_table_caches', TType.LIST, 7)
+            oprot.writeListBegin(TType.STRUCT, len(self.hash_table_caches))
+            for iter146 in self.hash_table_caches:
+                iter146.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.buffer_pool_stats is not None:
+            oprot.writeFieldBegin('buffer_pool_stats', TType.STRUCT, 8)
+            self.buffer_pool_stats.write(oprot)
+            oprot.writeFieldEnd()
+        if self.string_dictionary_cache is not None:
+            oprot.writeFieldBegin('string_dictionary_cache', TType.STRUCT, 9)
+            self.string_dictionary_cache.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -3325,21 +4073,21 @@ class TTableMeta(object):
             elif fid == 10:
                 if ftype == TType.LIST:
                     self.col_types = []
-                    (_etype129, _size126) = iprot.readListBegin()
-                    for _i130 in range(_size126):
-                        _elem131 = omnisci.common.ttypes.TTypeInfo()
-                        _elem131.read(iprot)
-                        self.col_types.append(_elem131)
+                    (_etype150, _size147) = iprot.readListBegin()
+                    for _i151 in range(_size147):
+                        _elem152 = omnisci.common.ttypes.TTypeInfo()
+                        _elem152.read(iprot)
+                        self.col_types.append(_elem152)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 11:
                 if ftype == TType.LIST:
                     self.col_names = []
-                    (_etype135, _size132) = iprot.readListBegin()
-                    for _i136 in range(_size132):
-                        _elem137 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.col_names.append(_elem137)
+                    (_etype156, _size153) = iprot.readListBegin()
+                    for _i157 in range(_size153):
+                        _elem158 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.col_names.append(_elem158)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -3388,15 +4136,15 @@ class TTableMeta(object):
         if self.col_types is not None:
             oprot.writeFieldBegin('col_types', TType.LIST, 10)
             oprot.writeListBegin(TType.STRUCT, len(self.col_types))
-            for iter138 in self.col_types:
-                iter138.write(oprot)
+            for iter159 in self.col_types:
+                iter159.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.col_names is not None:
             oprot.writeFieldBegin('col_names', TType.LIST, 11)
             oprot.writeListBegin(TType.STRING, len(self.col_names))
-            for iter139 in self.col_names:
-                oprot.writeString(iter139.encode('utf-8') if sys.version_info[0] == 2 else iter139)
+            for iter160 in self.col_names:
+                oprot.writeString(iter160.encode('utf-8') if sys.version_info[0] == 2 else iter160)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -3456,11 +4204,11 @@ class TTableDetails(object):
             if fid == 1:
                 if ftype == TType.LIST:
                     self.row_desc = []
-                    (_etype143, _size140) = iprot.readListBegin()
-                    for _i144 in range(_size140):
-                        _elem145 = TColumnType()
-                        _elem145.read(iprot)
-                        self.row_desc.append(_elem145)
+                    (_etype164, _size161) = iprot.readListBegin()
+                    for _i165 in range(_size161):
+                        _elem166 = TColumnType()
+                        _elem166.read(iprot)
+                        self.row_desc.append(_elem166)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -3517,8 +4265,8 @@ class TTableDetails(object):
         if self.row_desc is not None:
             oprot.writeFieldBegin('row_desc', TType.LIST, 1)
             oprot.writeListBegin(TType.STRUCT, len(self.row_desc))
-            for iter146 in self.row_desc:
-                iter146.write(oprot)
+            for iter167 in self.row_desc:
+                iter167.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.fragment_size is not None:
@@ -3899,33 +4647,33 @@ class TPendingQuery(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.column_ranges = []
-                    (_etype150, _size147) = iprot.readListBegin()
-                    for _i151 in range(_size147):
-                        _elem152 = TColumnRange()
-                        _elem152.read(iprot)
-                        self.column_ranges.append(_elem152)
+                    (_etype171, _size168) = iprot.readListBegin()
+                    for _i172 in range(_size168):
+                        _elem173 = TColumnRange()
+                        _elem173.read(iprot)
+                        self.column_ranges.append(_elem173)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.dictionary_generations = []
-                    (_etype156, _size153) = iprot.readListBegin()
-                    for _i157 in range(_size153):
-                        _elem158 = TDictionaryGeneration()
-                        _elem158.read(iprot)
-                        self.dictionary_generations.append(_elem158)
+                    (_etype177, _size174) = iprot.readListBegin()
+                    for _i178 in range(_size174):
+                        _elem179 = TDictionaryGeneration()
+                        _elem179.read(iprot)
+                        self.dictionary_generations.append(_elem179)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.table_generations = []
-                    (_etype162, _size159) = iprot.readListBegin()
-                    for _i163 in range(_size159):
-                        _elem164 = TTableGeneration()
-                        _elem164.read(iprot)
-                        self.table_generations.append(_elem164)
+                    (_etype183, _size180) = iprot.readListBegin()
+                    for _i184 in range(_size180):
+                        _elem185 = TTableGeneration()
+                        _elem185.read(iprot)
+                        self.table_generations.append(_elem185)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -3951,22 +4699,22 @@ class TPendingQuery(object):
         if self.column_ranges is not None:
             oprot.writeFieldBegin('column_ranges', TType.LIST, 2)
             oprot.writeListBegin(TType.STRUCT, len(self.column_ranges))
-            for iter165 in self.column_ranges:
-                iter165.write(oprot)
+            for iter186 in self.column_ranges:
+                iter186.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.dictionary_generations is not None:
             oprot.writeFieldBegin('dictionary_generations', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.dictionary_generations))
-            for iter166 in self.dictionary_generations:
-                iter166.write(oprot)
+            for iter187 in self.dictionary_generations:
+                iter187.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.table_generations is not None:
             oprot.writeFieldBegin('table_generations', TType.LIST, 4)
             oprot.writeListBegin(TType.STRUCT, len(self.table_generations))
-            for iter167 in self.table_generations:
-                iter167.write(oprot)
+            for iter188 in self.table_generations:
+                iter188.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.parent_session_id is not None:
@@ -4089,11 +4837,11 @@ class TDataBlockPtr(object):
             elif fid == 2:
                 if ftype == TType.LIST:
                     self.var_len_data = []
-                    (_etype171, _size168) = iprot.readListBegin()
-                    for _i172 in range(_size168):
-                        _elem173 = TVarLen()
-                        _elem173.read(iprot)
-                        self.var_len_data.append(_elem173)
+                    (_etype192, _size189) = iprot.readListBegin()
+                    for _i193 in range(_size189):
+                        _elem194 = TVarLen()
+                        _elem194.read(iprot)
+                        self.var_len_data.append(_elem194)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -4114,8 +4862,8 @@ class TDataBlockPtr(object):
         if self.var_len_data is not None:
             oprot.writeFieldBegin('var_len_data', TType.LIST, 2)
             oprot.writeListBegin(TType.STRUCT, len(self.var_len_data))
-            for iter174 in self.var_len_data:
-                iter174.write(oprot)
+            for iter195 in self.var_len_data:
+                iter195.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -4144,16 +4892,18 @@ class TInsertData(object):
      - column_ids
      - data
      - num_rows
+     - is_default
 
     """
 
 
-    def __init__(self, db_id=None, table_id=None, column_ids=None, data=None, num_rows=None,):
+    def __init__(self, db_id=None, table_id=None, column_ids=None, data=None, num_rows=None, is_default=None,):
         self.db_id = db_id
         self.table_id = table_id
         self.column_ids = column_ids
         self.data = data
         self.num_rows = num_rows
+        self.is_default = is_default
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -4177,21 +4927,21 @@ class TInsertData(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.column_ids = []
-                    (_etype178, _size175) = iprot.readListBegin()
-                    for _i179 in range(_size175):
-                        _elem180 = iprot.readI32()
-                        self.column_ids.append(_elem180)
+                    (_etype199, _size196) = iprot.readListBegin()
+                    for _i200 in range(_size196):
+                        _elem201 = iprot.readI32()
+                        self.column_ids.append(_elem201)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.data = []
-                    (_etype184, _size181) = iprot.readListBegin()
-                    for _i185 in range(_size181):
-                        _elem186 = TDataBlockPtr()
-                        _elem186.read(iprot)
-                        self.data.append(_elem186)
+                    (_etype205, _size202) = iprot.readListBegin()
+                    for _i206 in range(_size202):
+                        _elem207 = TDataBlockPtr()
+                        _elem207.read(iprot)
+                        self.data.append(_elem207)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -4200,6 +4950,16 @@ class TInsertData(object):
                     self.num_rows = iprot.readI64()
                 else:
                     iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.LIST:
+                    self.is_default = []
+                    (_etype211, _size208) = iprot.readListBegin()
+                    for _i212 in range(_size208):
+                        _elem213 = iprot.readBool()
+                        self.is_default.append(_elem213)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -4221,21 +4981,28 @@ class TInsertData(object):
         if self.column_ids is not None:
             oprot.writeFieldBegin('column_ids', TType.LIST, 3)
             oprot.writeListBegin(TType.I32, len(self.column_ids))
-            for iter187 in self.column_ids:
-                oprot.writeI32(iter187)
+            for iter214 in self.column_ids:
+                oprot.writeI32(iter214)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.data is not None:
             oprot.writeFieldBegin('data', TType.LIST, 4)
             oprot.writeListBegin(TType.STRUCT, len(self.data))
-            for iter188 in self.data:
-                iter188.write(oprot)
+            for iter215 in self.data:
+                iter215.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.num_rows is not None:
             oprot.writeFieldBegin('num_rows', TType.I64, 5)
             oprot.writeI64(self.num_rows)
             oprot.writeFieldEnd()
+        if self.is_default is not None:
+            oprot.writeFieldBegin('is_default', TType.LIST, 6)
+            oprot.writeListBegin(TType.BOOL, len(self.is_default))
+            for iter216 in self.is_default:
+                oprot.writeBool(iter216)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -4583,12 +5350,12 @@ class TRawPixelData(object):
             elif fid == 3:
                 if ftype == TType.MAP:
                     self.render_pass_map = {}
-                    (_ktype190, _vtype191, _size189) = iprot.readMapBegin()
-                    for _i193 in range(_size189):
-                        _key194 = iprot.readI32()
-                        _val195 = TRawRenderPassDataResult()
-                        _val195.read(iprot)
-                        self.render_pass_map[_key194] = _val195
+                    (_ktype218, _vtype219, _size217) = iprot.readMapBegin()
+                    for _i221 in range(_size217):
+                        _key222 = iprot.readI32()
+                        _val223 = TRawRenderPassDataResult()
+                        _val223.read(iprot)
+                        self.render_pass_map[_key222] = _val223
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -4613,9 +5380,9 @@ class TRawPixelData(object):
         if self.render_pass_map is not None:
             oprot.writeFieldBegin('render_pass_map', TType.MAP, 3)
             oprot.writeMapBegin(TType.I32, TType.STRUCT, len(self.render_pass_map))
-            for kiter196, viter197 in self.render_pass_map.items():
-                oprot.writeI32(kiter196)
-                viter197.write(oprot)
+            for kiter224, viter225 in self.render_pass_map.items():
+                oprot.writeI32(kiter224)
+                viter225.write(oprot)
             oprot.writeMapEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -4746,35 +5513,35 @@ class TRenderStepResult(object):
             if fid == 1:
                 if ftype == TType.MAP:
                     self.merge_data = {}
-                    (_ktype199, _vtype200, _size198) = iprot.readMapBegin()
-                    for _i202 in range(_size198):
-                        _key203 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        _val204 = {}
-                        (_ktype206, _vtype207, _size205) = iprot.readMapBegin()
-                        for _i209 in range(_size205):
-                            _key210 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                            _val211 = {}
-                            (_ktype213, _vtype214, _size212) = iprot.readMapBegin()
-                            for _i216 in range(_size212):
-                                _key217 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                                _val218 = {}
-                                (_ktype220, _vtype221, _size219) = iprot.readMapBegin()
-                                for _i223 in range(_size219):
-                                    _key224 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                                    _val225 = []
-                                    (_etype229, _size226) = iprot.readListBegin()
-                                    for _i230 in range(_size226):
-                                        _elem231 = TRenderDatum()
-                                        _elem231.read(iprot)
-                                        _val225.append(_elem231)
+                    (_ktype227, _vtype228, _size226) = iprot.readMapBegin()
+                    for _i230 in range(_size226):
+                        _key231 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        _val232 = {}
+                        (_ktype234, _vtype235, _size233) = iprot.readMapBegin()
+                        for _i237 in range(_size233):
+                            _key238 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                            _val239 = {}
+                            (_ktype241, _vtype242, _size240) = iprot.readMapBegin()
+                            for _i244 in range(_size240):
+                                _key245 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                                _val246 = {}
+                                (_ktype248, _vtype249, _size247) = iprot.readMapBegin()
+                                for _i251 in range(_size247):
+                                    _key252 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                                    _val253 = []
+                                    (_etype257, _size254) = iprot.readListBegin()
+                                    for _i258 in range(_size254):
+                                        _elem259 = TRenderDatum()
+                                        _elem259.read(iprot)
+                                        _val253.append(_elem259)
                                     iprot.readListEnd()
-                                    _val218[_key224] = _val225
+                                    _val246[_key252] = _val253
                                 iprot.readMapEnd()
-                                _val211[_key217] = _val218
+                                _val239[_key245] = _val246
                             iprot.readMapEnd()
-                            _val204[_key210] = _val211
+                            _val232[_key238] = _val239
                         iprot.readMapEnd()
-                        self.merge_data[_key203] = _val204
+                        self.merge_data[_key231] = _val232
                     iprot.readMapEnd()
                 else:
                     iprot.skip(ftype)
@@ -4812,20 +5579,20 @@ class TRenderStepResult(object):
         if self.merge_data is not None:
             oprot.writeFieldBegin('merge_data', TType.MAP, 1)
             oprot.writeMapBegin(TType.STRING, TType.MAP, len(self.merge_data))
-            for kiter232, viter233 in self.merge_data.items():
-                oprot.writeString(kiter232.encode('utf-8') if sys.version_info[0] == 2 else kiter232)
-                oprot.writeMapBegin(TType.STRING, TType.MAP, len(viter233))
-                for kiter234, viter235 in viter233.items():
-                    oprot.writeString(kiter234.encode('utf-8') if sys.version_info[0] == 2 else kiter234)
-                    oprot.writeMapBegin(TType.STRING, TType.MAP, len(viter235))
-                    for kiter236, viter237 in viter235.items():
-                        oprot.writeString(kiter236.encode('utf-8') if sys.version_info[0] == 2 else kiter236)
-                        oprot.writeMapBegin(TType.STRING, TType.LIST, len(viter237))
-                        for kiter238, viter239 in viter237.items():
-                            oprot.writeString(kiter238.encode('utf-8') if sys.version_info[0] == 2 else kiter238)
-                            oprot.writeListBegin(TType.STRUCT, len(viter239))
-                            for iter240 in viter239:
-                                iter240.write(oprot)
+            for kiter260, viter261 in self.merge_data.items():
+                oprot.writeString(kiter260.encode('utf-8') if sys.version_info[0] == 2 else kiter260)
+                oprot.writeMapBegin(TType.STRING, TType.MAP, len(viter261))
+                for kiter262, viter263 in viter261.items():
+                    oprot.writeString(kiter262.encode('utf-8') if sys.version_info[0] == 2 else kiter262)
+                    oprot.writeMapBegin(TType.STRING, TType.MAP, len(viter263))
+                    for kiter264, viter265 in viter263.items():
+                        oprot.writeString(kiter264.encode('utf-8') if sys.version_info[0] == 2 else kiter264)
+                        oprot.writeMapBegin(TType.STRING, TType.LIST, len(viter265))
+                        for kiter266, viter267 in viter265.items():
+                            oprot.writeString(kiter266.encode('utf-8') if sys.version_info[0] == 2 else kiter266)
+                            oprot.writeListBegin(TType.STRUCT, len(viter267))
+                            for iter268 in viter267:
+                                iter268.write(oprot)
                             oprot.writeListEnd()
                         oprot.writeMapEnd()
                     oprot.writeMapEnd()
@@ -5298,14 +6065,16 @@ class TServerPermissions(object):
      - create_
      - drop_
      - alter_
+     - usage_
 
     """
 
 
-    def __init__(self, create_=None, drop_=None, alter_=None,):
+    def __init__(self, create_=None, drop_=None, alter_=None, usage_=None,):
         self.create_ = create_
         self.drop_ = drop_
         self.alter_ = alter_
+        self.usage_ = usage_
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5331,6 +6100,11 @@ class TServerPermissions(object):
                     self.alter_ = iprot.readBool()
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.BOOL:
+                    self.usage_ = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5353,6 +6127,10 @@ class TServerPermissions(object):
             oprot.writeFieldBegin('alter_', TType.BOOL, 3)
             oprot.writeBool(self.alter_)
             oprot.writeFieldEnd()
+        if self.usage_ is not None:
+            oprot.writeFieldBegin('usage_', TType.BOOL, 4)
+            oprot.writeBool(self.usage_)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -5485,16 +6263,18 @@ class TDBObject(object):
      - privs
      - grantee
      - privilegeObjectType
+     - objectId
 
     """
 
 
-    def __init__(self, objectName=None, objectType=None, privs=None, grantee=None, privilegeObjectType=None,):
+    def __init__(self, objectName=None, objectType=None, privs=None, grantee=None, privilegeObjectType=None, objectId=None,):
         self.objectName = objectName
         self.objectType = objectType
         self.privs = privs
         self.grantee = grantee
         self.privilegeObjectType = privilegeObjectType
+        self.objectId = objectId
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -5518,10 +6298,10 @@ class TDBObject(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.privs = []
-                    (_etype244, _size241) = iprot.readListBegin()
-                    for _i245 in range(_size241):
-                        _elem246 = iprot.readBool()
-                        self.privs.append(_elem246)
+                    (_etype272, _size269) = iprot.readListBegin()
+                    for _i273 in range(_size269):
+                        _elem274 = iprot.readBool()
+                        self.privs.append(_elem274)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -5535,6 +6315,11 @@ class TDBObject(object):
                     self.privilegeObjectType = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.objectId = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -5556,8 +6341,8 @@ class TDBObject(object):
         if self.privs is not None:
             oprot.writeFieldBegin('privs', TType.LIST, 3)
             oprot.writeListBegin(TType.BOOL, len(self.privs))
-            for iter247 in self.privs:
-                oprot.writeBool(iter247)
+            for iter275 in self.privs:
+                oprot.writeBool(iter275)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.grantee is not None:
@@ -5568,6 +6353,10 @@ class TDBObject(object):
             oprot.writeFieldBegin('privilegeObjectType', TType.I32, 5)
             oprot.writeI32(self.privilegeObjectType)
             oprot.writeFieldEnd()
+        if self.objectId is not None:
+            oprot.writeFieldBegin('objectId', TType.I32, 6)
+            oprot.writeI32(self.objectId)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -5835,10 +6624,10 @@ class TLicenseInfo(object):
             if fid == 1:
                 if ftype == TType.LIST:
                     self.claims = []
-                    (_etype251, _size248) = iprot.readListBegin()
-                    for _i252 in range(_size248):
-                        _elem253 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
-                        self.claims.append(_elem253)
+                    (_etype279, _size276) = iprot.readListBegin()
+                    for _i280 in range(_size276):
+                        _elem281 = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                        self.claims.append(_elem281)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -5855,8 +6644,8 @@ class TLicenseInfo(object):
         if self.claims is not None:
             oprot.writeFieldBegin('claims', TType.LIST, 1)
             oprot.writeListBegin(TType.STRING, len(self.claims))
-            for iter254 in self.claims:
-                oprot.writeString(iter254.encode('utf-8') if sys.version_info[0] == 2 else iter254)
+            for iter282 in self.claims:
+                oprot.writeString(iter282.encode('utf-8') if sys.version_info[0] == 2 else iter282)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -6112,6 +6901,118 @@ class TTableEpochInfo(object):
 
     def __ne__(self, other):
         return not (self == other)
+
+
+class TCustomExpression(object):
+    """
+    Attributes:
+     - id
+     - name
+     - expression_json
+     - data_source_type
+     - data_source_id
+     - is_deleted
+
+    """
+
+
+    def __init__(self, id=None, name=None, expression_json=None, data_source_type=None, data_source_id=None, is_deleted=None,):
+        self.id = id
+        self.name = name
+        self.expression_json = expression_json
+        self.data_source_type = data_source_type
+        self.data_source_id = data_source_id
+        self.is_deleted = is_deleted
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I32:
+                    self.id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.name = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRING:
+                    self.expression_json = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I32:
+                    self.data_source_type = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I32:
+                    self.data_source_id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 7:
+                if ftype == TType.BOOL:
+                    self.is_deleted = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TCustomExpression')
+        if self.id is not None:
+            oprot.writeFieldBegin('id', TType.I32, 1)
+            oprot.writeI32(self.id)
+            oprot.writeFieldEnd()
+        if self.name is not None:
+            oprot.writeFieldBegin('name', TType.STRING, 2)
+            oprot.writeString(self.name.encode('utf-8') if sys.version_info[0] == 2 else self.name)
+            oprot.writeFieldEnd()
+        if self.expression_json is not None:
+            oprot.writeFieldBegin('expression_json', TType.STRING, 4)
+            oprot.writeString(self.expression_json.encode('utf-8') if sys.version_info[0] == 2 else self.expression_json)
+            oprot.writeFieldEnd()
+        if self.data_source_type is not None:
+            oprot.writeFieldBegin('data_source_type', TType.I32, 5)
+            oprot.writeI32(self.data_source_type)
+            oprot.writeFieldEnd()
+        if self.data_source_id is not None:
+            oprot.writeFieldBegin('data_source_id', TType.I32, 6)
+            oprot.writeI32(self.data_source_id)
+            oprot.writeFieldEnd()
+        if self.is_deleted is not None:
+            oprot.writeFieldBegin('is_deleted', TType.BOOL, 7)
+            oprot.writeBool(self.is_deleted)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
 all_structs.append(TDatumVal)
 TDatumVal.thrift_spec = (
     None,  # 0
@@ -6213,6 +7114,25 @@ TDataFrame.thrift_spec = (
     (6, TType.I64, 'arrow_conversion_time_ms', None, None, ),  # 6
     (7, TType.STRING, 'df_buffer', 'BINARY', None, ),  # 7
 )
+all_structs.append(TDataFrameCursor)
+TDataFrameCursor.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'cursor_id', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'schema', 'BINARY', None, ),  # 2
+    (3, TType.I64, 'execution_time_ms', None, None, ),  # 3
+)
+all_structs.append(TPreparedStatement)
+TPreparedStatement.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'statement_id', 'UTF8', None, ),  # 1
+    (2, TType.I32, 'num_parameters', None, None, ),  # 2
+)
+all_structs.append(TBindParameter)
+TBindParameter.thrift_spec = (
+    None,  # 0
+    (1, TType.I32, 'type', None, None, ),  # 1
+    (2, TType.STRUCT, 'value', [TDatum, None], None, ),  # 2
+)
 all_structs.append(TDBInfo)
 TDBInfo.thrift_spec = (
     None,  # 0
@@ -6252,7 +7172,7 @@ TCopyParams.thrift_spec = (
     (23, TType.BOOL, 'geo_assign_render_groups', None, True, ),  # 23
     (24, TType.BOOL, 'geo_explode_collections', None, False, ),  # 24
     (25, TType.I32, 'source_srid', None, 0, ),  # 25
-    (26, TType.STRING, 's3_session_token', 'UTF8', None, ), #26
+    (26, TType.STRING, 's3_session_token', 'UTF8', None, ),  # 26
 )
 all_structs.append(TCreateParams)
 TCreateParams.thrift_spec = (
@@ -6282,6 +7202,15 @@ TFrontendView.thrift_spec = (
     (4, TType.STRING, 'update_time', 'UTF8', None, ),  # 4
     (5, TType.STRING, 'view_metadata', 'UTF8', None, ),  # 5
 )
+all_structs.append(TDispatchQueueStatus)
+TDispatchQueueStatus.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'queue_depth', None, None, ),  # 1
+    (2, TType.I64, 'max_queue_depth', None, None, ),  # 2
+    (3, TType.I64, 'num_dispatched', None, None, ),  # 3
+    (4, TType.LIST, 'wait_time_ms_bucket_bounds', (TType.I64, None, False), None, ),  # 4
+    (5, TType.LIST, 'wait_time_ms_histogram', (TType.I64, None, False), None, ),  # 5
+)
 all_structs.append(TServerStatus)
 TServerStatus.thrift_spec = (
     None,  # 0
@@ -6293,6 +7222,8 @@ TServerStatus.thrift_spec = (
     (6, TType.STRING, 'host_name', 'UTF8', None, ),  # 6
     (7, TType.BOOL, 'poly_rendering_enabled', None, None, ),  # 7
     (8, TType.I32, 'role', None, None, ),  # 8
+    (9, TType.STRING, 'renderer_status_json', 'UTF8', None, ),  # 9
+    (10, TType.STRUCT, 'dispatch_queue_status', [TDispatchQueueStatus, None], None, ),  # 10
 )
 all_structs.append(TPixel)
 TPixel.thrift_spec = (
@@ -6355,6 +7286,36 @@ TMemoryData.thrift_spec = (
     (6, TType.I32, 'buffer_epoch', None, None, ),  # 6
     (7, TType.BOOL, 'is_free', None, None, ),  # 7
 )
+all_structs.append(THashTableCacheInfo)
+THashTableCacheInfo.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'cache_name', 'UTF8', None, ),  # 1
+    (2, TType.I64, 'num_entries', None, None, ),  # 2
+    (3, TType.I64, 'size_bytes', None, None, ),  # 3
+    (4, TType.I64, 'max_size_bytes', None, None, ),  # 4
+    (5, TType.I64, 'hits', None, None, ),  # 5
+    (6, TType.I64, 'misses', None, None, ),  # 6
+    (7, TType.I64, 'evictions', None, None, ),  # 7
+)
+all_structs.append(TBufferPoolStats)
+TBufferPoolStats.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'hits', None, None, ),  # 1
+    (2, TType.I64, 'misses', None, None, ),  # 2
+    (3, TType.I64, 'evictions', None, None, ),  # 3
+    (4, TType.I64, 'chunk_index_lock_acquisitions', None, None, ),  # 4
+    (5, TType.I64, 'chunk_index_lock_waits', None, None, ),  # 5
+)
+all_structs.append(TStringDictionaryCacheStats)
+TStringDictionaryCacheStats.thrift_spec = (
+    None,  # 0
+    (1, TType.I64, 'num_entries', None, None, ),  # 1
+    (2, TType.I64, 'size_bytes', None, None, ),  # 2
+    (3, TType.I64, 'max_size_bytes', None, None, ),  # 3
+    (4, TType.I64, 'hits', None, None, ),  # 4
+    (5, TType.I64, 'misses', None, None, ),  # 5
+    (6, TType.I64, 'evictions', None, None, ),  # 6
+)
 all_structs.append(TNodeMemoryInfo)
 TNodeMemoryInfo.thrift_spec = (
     None,  # 0
@@ -6364,6 +7325,9 @@ TNodeMemoryInfo.thrift_spec = (
     (4, TType.I64, 'num_pages_allocated', None, None, ),  # 4
     (5, TType.BOOL, 'is_allocation_capped', None, None, ),  # 5
     (6, TType.LIST, 'node_memory_data', (TType.STRUCT, [TMemoryData, None], False), None, ),  # 6
+    (7, TType.LIST, 'hash_table_caches', (TType.STRUCT, [THashTableCacheInfo, None], False), None, ),  # 7
+    (8, TType.STRUCT, 'buffer_pool_stats', [TBufferPoolStats, None], None, ),  # 8
+    (9, TType.STRUCT, 'string_dictionary_cache', [TStringDictionaryCacheStats, None], None, ),  # 9
 )
 all_structs.append(TTableMeta)
 TTableMeta.thrift_spec = (
@@ -6448,6 +7412,7 @@ TInsertData.thrift_spec = (
     (3, TType.LIST, 'column_ids', (TType.I32, None, False), None, ),  # 3
     (4, TType.LIST, 'data', (TType.STRUCT, [TDataBlockPtr, None], False), None, ),  # 4
     (5, TType.I64, 'num_rows', None, None, ),  # 5
+    (6, TType.LIST, 'is_default', (TType.BOOL, None, False), None, ),  # 6
 )
 all_structs.append(TPendingRenderQuery)
 TPendingRenderQuery.thrift_spec = (
@@ -6542,6 +7507,7 @@ TServerPermissions.thrift_spec = (
     (1, TType.BOOL, 'create_', None, None, ),  # 1
     (2, TType.BOOL, 'drop_', None, None, ),  # 2
     (3, TType.BOOL, 'alter_', None, None, ),  # 3
+    (4, TType.BOOL, 'usage_', None, None, ),  # 4
 )
 all_structs.append(TDBObjectPermissions)
 TDBObjectPermissions.thrift_spec = (
@@ -6560,6 +7526,7 @@ TDBObject.thrift_spec = (
     (3, TType.LIST, 'privs', (TType.BOOL, None, False), None, ),  # 3
     (4, TType.STRING, 'grantee', 'UTF8', None, ),  # 4
     (5, TType.I32, 'privilegeObjectType', None, None, ),  # 5
+    (6, TType.I32, 'objectId', None, None, ),  # 6
 )
 all_structs.append(TDashboardGrantees)
 TDashboardGrantees.thrift_spec = (
@@ -6607,5 +7574,16 @@ TTableEpochInfo.thrift_spec = (
     (2, TType.I32, 'table_epoch', None, None, ),  # 2
     (3, TType.I32, 'leaf_index', None, None, ),  # 3
 )
+all_structs.append(TCustomExpression)
+TCustomExpression.thrift_spec = (
+    None,  # 0
+    (1, TType.I32, 'id', None, None, ),  # 1
+    (2, TType.STRING, 'name', 'UTF8', None, ),  # 2
+    None,  # 3
+    (4, TType.STRING, 'expression_json', 'UTF8', None, ),  # 4
+    (5, TType.I32, 'data_source_type', None, None, ),  # 5
+    (6, TType.I32, 'data_source_id', None, None, ),  # 6
+    (7, TType.BOOL, 'is_deleted', None, None, ),  # 7
+)
 fix_spec(all_structs)
 del all_structs